@@ -0,0 +1,65 @@
+// balflt_decoder.cpp                                                 -*-C++-*-
+#include <balflt_decoder.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(balflt_decoder_cpp,"$Id$ $CSID$")
+
+namespace BloombergLP {
+namespace balflt {
+
+                               // -------------
+                               // class Decoder
+                               // -------------
+
+// PRIVATE MANIPULATORS
+int Decoder::decodeSlot(bsl::vector<char>         *value,
+                        const RecordRef&           record,
+                        int                        index,
+                        bdlat_TypeCategory::Array )
+{
+    bslstl::StringRef bytes;
+    if (0 != record.getValue(&bytes, index)) {
+        return -1;                                                    // RETURN
+    }
+    value->assign(bytes.begin(), bytes.end());
+    return 0;
+}
+
+// CREATORS
+Decoder::Decoder(bslma::Allocator *basicAllocator)
+: d_buffer(basicAllocator)
+, d_maxDepth(k_DEFAULT_MAX_DEPTH)
+, d_depth(0)
+{
+}
+
+Decoder::Decoder(int maxDepth, bslma::Allocator *basicAllocator)
+: d_buffer(basicAllocator)
+, d_maxDepth(maxDepth)
+, d_depth(0)
+{
+    BSLS_ASSERT(0 < maxDepth);
+}
+
+Decoder::~Decoder()
+{
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
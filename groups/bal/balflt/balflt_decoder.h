@@ -0,0 +1,908 @@
+// balflt_decoder.h                                                   -*-C++-*-
+#ifndef INCLUDED_BALFLT_DECODER
+#define INCLUDED_BALFLT_DECODER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a decoder of 'bdlat'-conforming types from the flat format.
+//
+//@CLASSES:
+//  balflt::Decoder: flat-format decoder
+//
+//@SEE_ALSO: balflt_encoder, balflt_recordref, balflt_flatutil
+//
+//@DESCRIPTION: This component provides a class, 'balflt::Decoder', having a
+// parameterized 'decode' function that decodes a sequence, a choice, or an
+// array of any type supported by 'balflt::Encoder' from the fixed-layout
+// "flat" format described in 'balflt_flatutil'.
+//
+// Decoding is needed only to obtain a value of the generated type: a reader
+// that needs only some of the attributes of an encoded value can read them in
+// place, using 'balflt::RecordRef' (see 'balflt_recordref').  'Decoder' is
+// implemented on top of 'balflt::RecordRef', and so bounds-checks every field
+// it reads; decoding a malformed buffer fails rather than reading outside of
+// the buffer.
+//
+// An attribute that is null, or that is absent from the encoded value (see
+// {'balflt_recordref'|Schema Evolution}), is reset to its default value.  The
+// depth of nested sequences, choices, and arrays that is decoded is limited by
+// the 'maxDepth' supplied at construction.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Decoding a Request
+///- - - - - - - - - - - - - - -
+// Suppose that we receive a 'balb::SimpleRequest' encoded by a
+// 'balflt::Encoder':
+//..
+//  balb::SimpleRequest request;
+//  request.data()           = "Hello, world";
+//  request.responseLength() = 42;
+//
+//  balflt::Encoder   encoder;
+//  bsl::vector<char> buffer;
+//  int rc = encoder.encode(&buffer, request);
+//  assert(0 == rc);
+//..
+// We decode it into a 'balb::SimpleRequest' object:
+//..
+//  balflt::Decoder     decoder;
+//  balb::SimpleRequest result;
+//
+//  rc = decoder.decode(&result, buffer.data(), buffer.size());
+//  assert(0       == rc);
+//  assert(request == result);
+//..
+
+#include <balscm_version.h>
+
+#include <balflt_recordref.h>
+
+#include <bdlat_arrayfunctions.h>
+#include <bdlat_choicefunctions.h>
+#include <bdlat_customizedtypefunctions.h>
+#include <bdlat_enumfunctions.h>
+#include <bdlat_nullablevaluefunctions.h>
+#include <bdlat_sequencefunctions.h>
+#include <bdlat_typecategory.h>
+#include <bdlat_valuetypefunctions.h>
+
+#include <bdlt_date.h>
+#include <bdlt_datetime.h>
+#include <bdlt_datetimetz.h>
+#include <bdlt_datetz.h>
+#include <bdlt_time.h>
+#include <bdlt_timetz.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bslmf_nil.h>
+
+#include <bsls_assert.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_ios.h>
+#include <bsl_streambuf.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+#include <bslstl_stringref.h>
+
+namespace BloombergLP {
+namespace balflt {
+
+                               // =============
+                               // class Decoder
+                               // =============
+
+class Decoder {
+    // This class provides a mechanism to decode 'bdlat'-conforming values from
+    // the flat format.  The memory used to decode from a 'streambuf' is
+    // retained, and reused by subsequent calls to 'decode'.
+
+    // DATA
+    bsl::vector<char> d_buffer;    // encoding, when decoding from a
+                                   // 'streambuf'
+
+    int               d_maxDepth;  // maximum depth of nested blocks
+    int               d_depth;     // depth of the block being decoded
+
+    // FRIENDS
+    friend class Decoder_SlotVisitor;
+    friend struct Decoder_DecodeProxy;
+
+  private:
+    // NOT IMPLEMENTED
+    Decoder(const Decoder&);
+    Decoder& operator=(const Decoder&);
+
+    // PRIVATE MANIPULATORS
+    template <class TYPE>
+    int decodeRoot(TYPE               *value,
+                   const char         *data,
+                   bsl::size_t         length,
+                   bdlat_TypeCategory::Sequence);
+    template <class TYPE>
+    int decodeRoot(TYPE               *value,
+                   const char         *data,
+                   bsl::size_t         length,
+                   bdlat_TypeCategory::Choice);
+    template <class TYPE>
+    int decodeRoot(TYPE               *value,
+                   const char         *data,
+                   bsl::size_t         length,
+                   bdlat_TypeCategory::Array);
+    template <class TYPE>
+    int decodeRoot(TYPE               *value,
+                   const char         *data,
+                   bsl::size_t         length,
+                   bdlat_TypeCategory::CustomizedType);
+    template <class TYPE>
+    int decodeRoot(TYPE               *value,
+                   const char         *data,
+                   bsl::size_t         length,
+                   bdlat_TypeCategory::DynamicType);
+    template <class TYPE, class CATEGORY>
+    int decodeRoot(TYPE *value, const char *, bsl::size_t, CATEGORY);
+        // Decode into the specified 'value' the block at the start of the
+        // specified 'data' having the specified 'length'.  Return 0 on
+        // success, and a non-zero value if 'value' is not a sequence, a
+        // choice, or an array, or if the block can not be decoded.
+
+    template <class TYPE>
+    int decodeBlock(TYPE                         *value,
+                    const RecordRef&              record,
+                    bdlat_TypeCategory::Sequence);
+    template <class TYPE>
+    int decodeBlock(TYPE                      *value,
+                    const RecordRef&           record,
+                    bdlat_TypeCategory::Array);
+    template <class TYPE>
+    int decodeBlock(TYPE *value, const ChoiceRef& choice);
+        // Decode into the specified 'value' the sequence, array, or choice
+        // held by the specified 'record' or 'choice'.  Return 0 on success,
+        // and a non-zero value otherwise.
+
+    int decodeSlot(bsl::vector<char>         *value,
+                   const RecordRef&           record,
+                   int                        index,
+                   bdlat_TypeCategory::Array);
+    template <class TYPE>
+    int decodeSlot(TYPE                      *value,
+                   const RecordRef&           record,
+                   int                        index,
+                   bdlat_TypeCategory::Array);
+    template <class TYPE>
+    int decodeSlot(TYPE                       *value,
+                   const RecordRef&            record,
+                   int                         index,
+                   bdlat_TypeCategory::Choice);
+    template <class TYPE>
+    int decodeSlot(TYPE                               *value,
+                   const RecordRef&                    record,
+                   int                                 index,
+                   bdlat_TypeCategory::CustomizedType);
+    template <class TYPE>
+    int decodeSlot(TYPE                            *value,
+                   const RecordRef&                 record,
+                   int                              index,
+                   bdlat_TypeCategory::DynamicType);
+    template <class TYPE>
+    int decodeSlot(TYPE                            *value,
+                   const RecordRef&                 record,
+                   int                              index,
+                   bdlat_TypeCategory::Enumeration);
+    template <class TYPE>
+    int decodeSlot(TYPE                              *value,
+                   const RecordRef&                   record,
+                   int                                index,
+                   bdlat_TypeCategory::NullableValue);
+    template <class TYPE>
+    int decodeSlot(TYPE                         *value,
+                   const RecordRef&              record,
+                   int                           index,
+                   bdlat_TypeCategory::Sequence);
+    template <class TYPE>
+    int decodeSlot(TYPE                       *value,
+                   const RecordRef&            record,
+                   int                         index,
+                   bdlat_TypeCategory::Simple);
+        // Decode into the specified 'value' the field having the specified
+        // 'index' of the specified 'record'.  Return 0 on success, and a
+        // non-zero value otherwise.  The behavior is undefined unless the
+        // field is present.
+
+    template <class TYPE>
+    int decodeSimple(TYPE *value, const RecordRef& record, int index);
+    int decodeSimple(bool                *value,
+                     const RecordRef&     record,
+                     int                  index);
+    int decodeSimple(char                *value,
+                     const RecordRef&     record,
+                     int                  index);
+    int decodeSimple(signed char         *value,
+                     const RecordRef&     record,
+                     int                  index);
+    int decodeSimple(unsigned char       *value,
+                     const RecordRef&     record,
+                     int                  index);
+    int decodeSimple(short               *value,
+                     const RecordRef&     record,
+                     int                  index);
+    int decodeSimple(unsigned short      *value,
+                     const RecordRef&     record,
+                     int                  index);
+    int decodeSimple(int                 *value,
+                     const RecordRef&     record,
+                     int                  index);
+    int decodeSimple(unsigned int        *value,
+                     const RecordRef&     record,
+                     int                  index);
+    int decodeSimple(bsls::Types::Int64  *value,
+                     const RecordRef&     record,
+                     int                  index);
+    int decodeSimple(bsls::Types::Uint64 *value,
+                     const RecordRef&     record,
+                     int                  index);
+    int decodeSimple(float               *value,
+                     const RecordRef&     record,
+                     int                  index);
+    int decodeSimple(double              *value,
+                     const RecordRef&     record,
+                     int                  index);
+    int decodeSimple(bsl::string         *value,
+                     const RecordRef&     record,
+                     int                  index);
+    int decodeSimple(bdlt::Date          *value,
+                     const RecordRef&     record,
+                     int                  index);
+    int decodeSimple(bdlt::Time          *value,
+                     const RecordRef&     record,
+                     int                  index);
+    int decodeSimple(bdlt::Datetime      *value,
+                     const RecordRef&     record,
+                     int                  index);
+    int decodeSimple(bdlt::DateTz        *value,
+                     const RecordRef&     record,
+                     int                  index);
+    int decodeSimple(bdlt::TimeTz        *value,
+                     const RecordRef&     record,
+                     int                  index);
+    int decodeSimple(bdlt::DatetimeTz    *value,
+                     const RecordRef&     record,
+                     int                  index);
+        // Decode into the specified simple 'value' the field having the
+        // specified 'index' of the specified 'record'.  Return 0 on success,
+        // and a non-zero value if the field is not valid, or if the type of
+        // 'value' is not supported.
+
+  public:
+    // TYPES
+    enum { k_DEFAULT_MAX_DEPTH = 32 };
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(Decoder, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit Decoder(bslma::Allocator *basicAllocator = 0);
+    explicit Decoder(int maxDepth, bslma::Allocator *basicAllocator = 0);
+        // Create a decoder.  Optionally specify the 'maxDepth' of nested
+        // sequences, choices, and arrays that are decoded.  If 'maxDepth' is
+        // not specified, 'k_DEFAULT_MAX_DEPTH' is used.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The behavior is
+        // undefined unless '0 < maxDepth'.
+
+    ~Decoder();
+        // Destroy this object.
+
+    // MANIPULATORS
+    template <class TYPE>
+    int decode(TYPE *result, const char *data, bsl::size_t length);
+        // Decode into the specified 'result' the flat encoding at the start of
+        // the specified 'data' having the specified 'length'.  Return 0 on
+        // success, and a non-zero value otherwise, in which case 'result' is
+        // left in a valid, but unspecified, state.  The behavior is undefined
+        // unless 'data' refers to at least 'length' bytes.
+
+    template <class TYPE>
+    int decode(TYPE *result, bsl::streambuf *streamBuf);
+        // Decode into the specified 'result' the flat encoding read (up to the
+        // end of input) from the specified 'streamBuf'.  Return 0 on success,
+        // and a non-zero value otherwise, in which case 'result' is left in a
+        // valid, but unspecified, state.
+
+    // ACCESSORS
+    int maxDepth() const;
+        // Return the maximum depth of nested sequences, choices, and arrays
+        // decoded by this decoder.
+};
+
+                      // =================================
+                      // private class Decoder_SlotVisitor
+                      // =================================
+
+class Decoder_SlotVisitor {
+    // This component-private class is a visitor decoding the attributes of a
+    // sequence, the elements of an array, or the selection of a choice from
+    // consecutive fields of a block.
+
+    // DATA
+    Decoder          *d_decoder_p;  // decoder (held, not owned)
+    const RecordRef  *d_record_p;   // block being decoded (held, not owned)
+    int               d_index;      // index of the next field
+
+  public:
+    // CREATORS
+    Decoder_SlotVisitor(Decoder *decoder, const RecordRef *record);
+        // Create a visitor decoding from the fields of the specified 'record'
+        // using the specified 'decoder', starting with field 0.
+
+    // MANIPULATORS
+    template <class TYPE, class INFO>
+    int operator()(TYPE *value, const INFO&);
+    template <class TYPE>
+    int operator()(TYPE *value);
+        // Decode the specified 'value' from the next field.  Return 0 on
+        // success, and a non-zero value otherwise.
+};
+
+                     // ==================================
+                     // private struct Decoder_DecodeProxy
+                     // ==================================
+
+struct Decoder_DecodeProxy {
+    // This component-private 'struct' dispatches the decoding of a value of a
+    // dynamic type, or of the value of a nullable value, according to its
+    // category.
+
+    // DATA
+    Decoder         *d_decoder_p;  // decoder (held, not owned)
+    const RecordRef *d_record_p;   // record holding the field, or 0 to
+                                   // decode a block
+    int              d_index;      // index of the field
+    const char      *d_data_p;     // block, if 'd_record_p' is 0
+    bsl::size_t      d_length;     // length of 'd_data_p'
+
+    // MANIPULATORS
+    template <class TYPE>
+    int operator()(TYPE *, bslmf::Nil);
+    template <class TYPE, class CATEGORY>
+    int operator()(TYPE *value, CATEGORY category);
+    template <class TYPE>
+    int operator()(TYPE *value);
+        // Decode the specified 'value', having the optionally specified
+        // 'category', from a block or from a field.  Return 0 on success, and
+        // a non-zero value otherwise.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                               // -------------
+                               // class Decoder
+                               // -------------
+
+// PRIVATE MANIPULATORS
+template <class TYPE>
+inline
+int Decoder::decodeRoot(TYPE                         *value,
+                        const char                   *data,
+                        bsl::size_t                   length,
+                        bdlat_TypeCategory::Sequence  category)
+{
+    RecordRef record;
+    if (0 != record.reset(data, length)) {
+        return -1;                                                    // RETURN
+    }
+    return decodeBlock(value, record, category);
+}
+
+template <class TYPE>
+inline
+int Decoder::decodeRoot(TYPE                       *value,
+                        const char                 *data,
+                        bsl::size_t                 length,
+                        bdlat_TypeCategory::Choice )
+{
+    ChoiceRef choice;
+    if (0 != choice.reset(data, length)) {
+        return -1;                                                    // RETURN
+    }
+    return decodeBlock(value, choice);
+}
+
+template <class TYPE>
+inline
+int Decoder::decodeRoot(TYPE                      *value,
+                        const char                *data,
+                        bsl::size_t                length,
+                        bdlat_TypeCategory::Array  category)
+{
+    RecordRef record;
+    if (0 != record.reset(data, length)) {
+        return -1;                                                    // RETURN
+    }
+    return decodeBlock(value, record, category);
+}
+
+template <class TYPE>
+int Decoder::decodeRoot(TYPE                               *value,
+                        const char                         *data,
+                        bsl::size_t                         length,
+                        bdlat_TypeCategory::CustomizedType )
+{
+    typedef typename
+    bdlat_CustomizedTypeFunctions::BaseType<TYPE>::Type BaseType;
+
+    typedef typename
+    bdlat_TypeCategory::Select<BaseType>::Type          BaseTypeCategory;
+
+    BaseType base;
+    if (0 != decodeRoot(&base, data, length, BaseTypeCategory())) {
+        return -1;                                                    // RETURN
+    }
+    return bdlat_CustomizedTypeFunctions::convertFromBaseType(value, base);
+}
+
+template <class TYPE>
+int Decoder::decodeRoot(TYPE                            *value,
+                        const char                      *data,
+                        bsl::size_t                      length,
+                        bdlat_TypeCategory::DynamicType )
+{
+    Decoder_DecodeProxy proxy = { this, 0, 0, data, length };
+    return bdlat_TypeCategoryUtil::manipulateByCategory(value, proxy);
+}
+
+template <class TYPE, class CATEGORY>
+inline
+int Decoder::decodeRoot(TYPE *, const char *, bsl::size_t, CATEGORY)
+{
+    return -1;
+}
+
+template <class TYPE>
+int Decoder::decodeBlock(TYPE                         *value,
+                         const RecordRef&              record,
+                         bdlat_TypeCategory::Sequence )
+{
+    if (d_depth >= d_maxDepth) {
+        return -1;                                                    // RETURN
+    }
+    ++d_depth;
+
+    Decoder_SlotVisitor visitor(this, &record);
+    const int rc = bdlat_SequenceFunctions::manipulateAttributes(value,
+                                                                 visitor);
+    --d_depth;
+    return rc;
+}
+
+template <class TYPE>
+int Decoder::decodeBlock(TYPE                      *value,
+                         const RecordRef&           record,
+                         bdlat_TypeCategory::Array )
+{
+    if (d_depth >= d_maxDepth) {
+        return -1;                                                    // RETURN
+    }
+    ++d_depth;
+
+    const int size = record.numFields();
+    bdlat_ArrayFunctions::resize(value, size);
+
+    Decoder_SlotVisitor visitor(this, &record);
+    int                 rc = 0;
+    for (int i = 0; 0 == rc && i < size; ++i) {
+        rc = bdlat_ArrayFunctions::manipulateElement(value, visitor, i);
+    }
+    --d_depth;
+    return rc;
+}
+
+template <class TYPE>
+int Decoder::decodeBlock(TYPE *value, const ChoiceRef& choice)
+{
+    if (bdlat_ChoiceFunctions::k_UNDEFINED_SELECTION_ID
+                                                     == choice.selectionId()) {
+        bdlat_ValueTypeFunctions::reset(value);
+        return 0;                                                     // RETURN
+    }
+
+    if (d_depth >= d_maxDepth
+     || 0 != bdlat_ChoiceFunctions::makeSelection(value,
+                                                  choice.selectionId())) {
+        return -1;                                                    // RETURN
+    }
+
+    ++d_depth;
+    Decoder_SlotVisitor visitor(this, &choice.record());
+    const int rc = bdlat_ChoiceFunctions::manipulateSelection(value, visitor);
+    --d_depth;
+    return rc;
+}
+
+template <class TYPE>
+inline
+int Decoder::decodeSlot(TYPE                      *value,
+                        const RecordRef&           record,
+                        int                        index,
+                        bdlat_TypeCategory::Array  category)
+{
+    RecordRef nested;
+    if (0 != record.getValue(&nested, index)) {
+        return -1;                                                    // RETURN
+    }
+    return decodeBlock(value, nested, category);
+}
+
+template <class TYPE>
+inline
+int Decoder::decodeSlot(TYPE                       *value,
+                        const RecordRef&            record,
+                        int                         index,
+                        bdlat_TypeCategory::Choice )
+{
+    ChoiceRef nested;
+    if (0 != record.getValue(&nested, index)) {
+        return -1;                                                    // RETURN
+    }
+    return decodeBlock(value, nested);
+}
+
+template <class TYPE>
+int Decoder::decodeSlot(TYPE                               *value,
+                        const RecordRef&                    record,
+                        int                                 index,
+                        bdlat_TypeCategory::CustomizedType )
+{
+    typedef typename
+    bdlat_CustomizedTypeFunctions::BaseType<TYPE>::Type BaseType;
+
+    typedef typename
+    bdlat_TypeCategory::Select<BaseType>::Type          BaseTypeCategory;
+
+    BaseType base;
+    if (0 != decodeSlot(&base, record, index, BaseTypeCategory())) {
+        return -1;                                                    // RETURN
+    }
+    return bdlat_CustomizedTypeFunctions::convertFromBaseType(value, base);
+}
+
+template <class TYPE>
+int Decoder::decodeSlot(TYPE                            *value,
+                        const RecordRef&                 record,
+                        int                              index,
+                        bdlat_TypeCategory::DynamicType )
+{
+    Decoder_DecodeProxy proxy = { this, &record, index, 0, 0 };
+    return bdlat_TypeCategoryUtil::manipulateByCategory(value, proxy);
+}
+
+template <class TYPE>
+int Decoder::decodeSlot(TYPE                            *value,
+                        const RecordRef&                 record,
+                        int                              index,
+                        bdlat_TypeCategory::Enumeration )
+{
+    int intValue;
+    if (0 != record.getValue(&intValue, index)) {
+        return -1;                                                    // RETURN
+    }
+    return bdlat_EnumFunctions::fromInt(value, intValue);
+}
+
+template <class TYPE>
+int Decoder::decodeSlot(TYPE                              *value,
+                        const RecordRef&                   record,
+                        int                                index,
+                        bdlat_TypeCategory::NullableValue )
+{
+    bdlat_NullableValueFunctions::makeValue(value);
+
+    Decoder_DecodeProxy proxy = { this, &record, index, 0, 0 };
+    return bdlat_NullableValueFunctions::manipulateValue(value, proxy);
+}
+
+template <class TYPE>
+inline
+int Decoder::decodeSlot(TYPE                         *value,
+                        const RecordRef&              record,
+                        int                           index,
+                        bdlat_TypeCategory::Sequence  category)
+{
+    RecordRef nested;
+    if (0 != record.getValue(&nested, index)) {
+        return -1;                                                    // RETURN
+    }
+    return decodeBlock(value, nested, category);
+}
+
+template <class TYPE>
+inline
+int Decoder::decodeSlot(TYPE                       *value,
+                        const RecordRef&            record,
+                        int                         index,
+                        bdlat_TypeCategory::Simple )
+{
+    return decodeSimple(value, record, index);
+}
+
+template <class TYPE>
+inline
+int Decoder::decodeSimple(TYPE *, const RecordRef&, int)
+{
+    return -1;
+}
+
+inline
+int Decoder::decodeSimple(bool *value, const RecordRef& record, int index)
+{
+    return record.getValue(value, index);
+}
+
+inline
+int Decoder::decodeSimple(char *value, const RecordRef& record, int index)
+{
+    return record.getValue(value, index);
+}
+
+inline
+int Decoder::decodeSimple(signed char      *value,
+                          const RecordRef&  record,
+                          int               index)
+{
+    return record.getValue(value, index);
+}
+
+inline
+int Decoder::decodeSimple(unsigned char    *value,
+                          const RecordRef&  record,
+                          int               index)
+{
+    return record.getValue(value, index);
+}
+
+inline
+int Decoder::decodeSimple(short *value, const RecordRef& record, int index)
+{
+    return record.getValue(value, index);
+}
+
+inline
+int Decoder::decodeSimple(unsigned short   *value,
+                          const RecordRef&  record,
+                          int               index)
+{
+    return record.getValue(value, index);
+}
+
+inline
+int Decoder::decodeSimple(int *value, const RecordRef& record, int index)
+{
+    return record.getValue(value, index);
+}
+
+inline
+int Decoder::decodeSimple(unsigned int     *value,
+                          const RecordRef&  record,
+                          int               index)
+{
+    return record.getValue(value, index);
+}
+
+inline
+int Decoder::decodeSimple(bsls::Types::Int64 *value,
+                          const RecordRef&    record,
+                          int                 index)
+{
+    return record.getValue(value, index);
+}
+
+inline
+int Decoder::decodeSimple(bsls::Types::Uint64 *value,
+                          const RecordRef&     record,
+                          int                  index)
+{
+    return record.getValue(value, index);
+}
+
+inline
+int Decoder::decodeSimple(float *value, const RecordRef& record, int index)
+{
+    return record.getValue(value, index);
+}
+
+inline
+int Decoder::decodeSimple(double *value, const RecordRef& record, int index)
+{
+    return record.getValue(value, index);
+}
+
+inline
+int Decoder::decodeSimple(bsl::string      *value,
+                          const RecordRef&  record,
+                          int               index)
+{
+    return record.getValue(value, index);
+}
+
+inline
+int Decoder::decodeSimple(bdlt::Date       *value,
+                          const RecordRef&  record,
+                          int               index)
+{
+    return record.getValue(value, index);
+}
+
+inline
+int Decoder::decodeSimple(bdlt::Time       *value,
+                          const RecordRef&  record,
+                          int               index)
+{
+    return record.getValue(value, index);
+}
+
+inline
+int Decoder::decodeSimple(bdlt::Datetime   *value,
+                          const RecordRef&  record,
+                          int               index)
+{
+    return record.getValue(value, index);
+}
+
+inline
+int Decoder::decodeSimple(bdlt::DateTz     *value,
+                          const RecordRef&  record,
+                          int               index)
+{
+    return record.getValue(value, index);
+}
+
+inline
+int Decoder::decodeSimple(bdlt::TimeTz     *value,
+                          const RecordRef&  record,
+                          int               index)
+{
+    return record.getValue(value, index);
+}
+
+inline
+int Decoder::decodeSimple(bdlt::DatetimeTz *value,
+                          const RecordRef&  record,
+                          int               index)
+{
+    return record.getValue(value, index);
+}
+
+// MANIPULATORS
+template <class TYPE>
+int Decoder::decode(TYPE *result, const char *data, bsl::size_t length)
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(data || 0 == length);
+
+    typedef typename bdlat_TypeCategory::Select<TYPE>::Type Category;
+
+    d_depth = 0;
+    return decodeRoot(result, data, length, Category());
+}
+
+template <class TYPE>
+int Decoder::decode(TYPE *result, bsl::streambuf *streamBuf)
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(streamBuf);
+
+    d_buffer.clear();
+
+    char            chunk[4096];
+    bsl::streamsize numRead;
+    while (0 < (numRead = streamBuf->sgetn(chunk, sizeof chunk))) {
+        d_buffer.insert(d_buffer.end(), chunk, chunk + numRead);
+    }
+    return decode(result, d_buffer.data(), d_buffer.size());
+}
+
+// ACCESSORS
+inline
+int Decoder::maxDepth() const
+{
+    return d_maxDepth;
+}
+
+                      // ---------------------------------
+                      // private class Decoder_SlotVisitor
+                      // ---------------------------------
+
+// CREATORS
+inline
+Decoder_SlotVisitor::Decoder_SlotVisitor(Decoder         *decoder,
+                                         const RecordRef *record)
+: d_decoder_p(decoder)
+, d_record_p(record)
+, d_index(0)
+{
+}
+
+// MANIPULATORS
+template <class TYPE, class INFO>
+inline
+int Decoder_SlotVisitor::operator()(TYPE *value, const INFO&)
+{
+    return this->operator()(value);
+}
+
+template <class TYPE>
+inline
+int Decoder_SlotVisitor::operator()(TYPE *value)
+{
+    typedef typename bdlat_TypeCategory::Select<TYPE>::Type Category;
+
+    const int index = d_index++;
+    if (d_record_p->isNull(index)) {
+        bdlat_ValueTypeFunctions::reset(value);
+        return 0;                                                     // RETURN
+    }
+    return d_decoder_p->decodeSlot(value, *d_record_p, index, Category());
+}
+
+                     // ----------------------------------
+                     // private struct Decoder_DecodeProxy
+                     // ----------------------------------
+
+// MANIPULATORS
+template <class TYPE>
+inline
+int Decoder_DecodeProxy::operator()(TYPE *, bslmf::Nil)
+{
+    BSLS_ASSERT_SAFE(0);
+    return -1;
+}
+
+template <class TYPE, class CATEGORY>
+inline
+int Decoder_DecodeProxy::operator()(TYPE *value, CATEGORY category)
+{
+    return d_record_p
+         ? d_decoder_p->decodeSlot(value, *d_record_p, d_index, category)
+         : d_decoder_p->decodeRoot(value, d_data_p, d_length, category);
+}
+
+template <class TYPE>
+inline
+int Decoder_DecodeProxy::operator()(TYPE *value)
+{
+    typedef typename bdlat_TypeCategory::Select<TYPE>::Type Category;
+
+    return this->operator()(value, Category());
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
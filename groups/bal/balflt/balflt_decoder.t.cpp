@@ -0,0 +1,1048 @@
+// balflt_decoder.t.cpp                                               -*-C++-*-
+#include <balflt_decoder.h>
+
+#include <balflt_encoder.h>
+#include <balflt_flatutil.h>
+#include <balflt_recordref.h>
+
+#include <balb_testmessages.h>
+
+#include <balber_berdecoder.h>
+#include <balber_berencoder.h>
+
+#include <bdldfp_decimal.h>
+
+#include <bdlsb_fixedmeminstreambuf.h>
+#include <bdlsb_memoutstreambuf.h>
+
+#include <bdlt_date.h>
+#include <bdlt_datetime.h>
+#include <bdlt_datetimetz.h>
+#include <bdlt_datetz.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                              TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a decoder of 'bdlat'-conforming types.  We
+// verify that values of the generated types of 'balb_testmessages' encoded by
+// 'balflt::Encoder' (tested independently) are decoded to their original
+// value, including into objects previously holding other values.  As the
+// decoder may be given untrusted input, we verify that every truncation, and
+// many corruptions, of a valid encoding are decoded without reading outside
+// of the buffer, and that the depth of nesting is limited.  Performance is
+// compared with 'balber' in a negative test case.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit Decoder(bslma::Allocator *basicAllocator = 0);
+// [ 2] explicit Decoder(int maxDepth, bslma::Allocator *basicAllocator = 0);
+// [ 2] ~Decoder();
+//
+// MANIPULATORS
+// [ 3] int decode(TYPE *result, const char *data, bsl::size_t length);
+// [ 4] int decode(TYPE *result, const char *data, bsl::size_t length);
+// [ 5] int decode(TYPE *result, const char *data, bsl::size_t length);
+// [ 6] int decode(TYPE *result, const char *data, bsl::size_t length);
+// [ 7] int decode(TYPE *result, bsl::streambuf *streamBuf);
+//
+// ACCESSORS
+// [ 2] int maxDepth() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 8] USAGE EXAMPLE
+// [-1] PERFORMANCE: COMPARISON WITH 'balber'
+// ----------------------------------------------------------------------------
+
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                     NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+#define ASSERT_PASS_RAW(EXPR)  BSLS_ASSERTTEST_ASSERT_PASS_RAW(EXPR)
+#define ASSERT_FAIL_RAW(EXPR)  BSLS_ASSERTTEST_ASSERT_FAIL_RAW(EXPR)
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef balflt::Decoder     Obj;
+typedef balflt::Encoder     Encoder;
+typedef balflt::FlatUtil    Util;
+typedef bsls::Types::Int64  Int64;
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+void populate(balb::Sequence6 *value)
+    // Load into the specified 'value' a value having every attribute set.
+{
+    value->element1().makeValue('a');
+    value->element2().makeValue(balb::CustomString("two"));
+    value->element3().makeValue(balb::CustomInt(3));
+    value->element4() = 4000000000U;
+    value->element5() = 5;
+    value->element6().resize(2);
+    value->element6()[1].makeValue(balb::CustomInt(6));
+    value->element7() = balb::CustomString("seven");
+    value->element8() = balb::CustomInt(-8);
+    value->element9().makeValue(9);
+    value->element10().push_back(10);
+    value->element10().push_back(0);
+    value->element11().push_back(balb::CustomString("eleven"));
+    value->element12().push_back(12);
+    value->element13().resize(1);
+    value->element14().push_back(balb::CustomInt(14));
+    value->element15().resize(3);
+    value->element15()[0].makeValue(15);
+}
+
+void populate(balb::Sequence4 *value)
+    // Load into the specified 'value' a value having every attribute set.
+{
+    const bdlt::DatetimeTz DTTZ(bdlt::Datetime(2026, 10, 19, 8, 30, 0, 123),
+                                -240);
+
+    balb::Sequence3 s3;
+    s3.element1().push_back(balb::Enumerated::NEW_JERSEY);
+    s3.element2().push_back("in sequence 3");
+    s3.element3().makeValue(true);
+    s3.element4().makeValue("four");
+    s3.element6().resize(2);
+    s3.element6()[0].makeValue(balb::Enumerated::LONDON);
+    value->element1().push_back(s3);
+    value->element1().push_back(balb::Sequence3());
+
+    balb::Choice1 c1;
+    c1.makeSelection2(0.5);
+    value->element2().push_back(c1);
+    value->element2().push_back(balb::Choice1());
+
+    value->element3().makeValue(bsl::vector<char>(3, 'x'));
+    value->element4().makeValue(-4);
+    value->element5().makeValue(DTTZ);
+    value->element6().makeValue(balb::CustomString("custom"));
+    value->element7().makeValue(balb::Enumerated::LONDON);
+    value->element8()  = true;
+    value->element9()  = "nine";
+    value->element10() = 10.5;
+    value->element11() = bsl::vector<char>(11, 'b');
+    value->element12() = 12;
+    value->element13() = balb::Enumerated::NEW_JERSEY;
+    value->element14().push_back(true);
+    value->element14().push_back(false);
+    value->element15().push_back(15.25);
+    value->element16().push_back(bsl::vector<char>(16, 'c'));
+    value->element16().push_back(bsl::vector<char>());
+    value->element17().push_back(170);
+    value->element17().push_back(-171);
+    value->element18().push_back(DTTZ);
+    value->element19().push_back(balb::CustomString("nineteen"));
+}
+
+void populate(balb::FeatureTestMessage *value)
+    // Load into the specified 'value' a value nesting sequences, choices, and
+    // arrays.
+{
+    balb::Sequence1& s1 = value->makeSelection1();
+
+    populate(&s1.element1().makeValue().makeSelection1());
+    s1.element2().resize(2);
+    s1.element2()[0].makeSelection1(2);
+    s1.element3().makeSelection2("selection 2");
+    s1.element4().resize(2);
+    s1.element4()[1].makeValue().makeSelection2(4.5);
+    s1.element5().resize(2);
+    s1.element5()[0].makeSelection3(balb::CustomString("five"));
+    s1.element5()[1].makeSelection4(balb::CustomInt(5));
+}
+
+template <class TYPE>
+void testRoundTrip(int line, const TYPE& value, const TYPE& initial)
+    // Encode the specified 'value', decode the encoding into an object having
+    // the specified 'initial' value, and verify that the decoded value is
+    // 'value'.  Use the specified 'line' to report errors.
+{
+    Encoder           encoder;
+    bsl::vector<char> buffer;
+    ASSERTV(line, 0 == encoder.encode(&buffer, value));
+
+    Obj  mX;
+    TYPE result(initial);
+    ASSERTV(line, 0 == mX.decode(&result, buffer.data(), buffer.size()));
+    ASSERTV(line, value == result);
+}
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator         da("default", veryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    switch (test) { case 0:
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Decoding a Request
+///- - - - - - - - - - - - - - -
+// Suppose that we receive a 'balb::SimpleRequest' encoded by a
+// 'balflt::Encoder':
+//..
+    balb::SimpleRequest request;
+    request.data()           = "Hello, world";
+    request.responseLength() = 42;
+
+    balflt::Encoder   encoder;
+    bsl::vector<char> buffer;
+    int rc = encoder.encode(&buffer, request);
+    ASSERT(0 == rc);
+//..
+// We decode it into a 'balb::SimpleRequest' object:
+//..
+    balflt::Decoder     decoder;
+    balb::SimpleRequest result;
+
+    rc = decoder.decode(&result, buffer.data(), buffer.size());
+    ASSERT(0       == rc);
+    ASSERT(request == result);
+//..
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // DECODING FROM A 'streambuf'
+        //
+        // Concerns:
+        //: 1 Decoding from a 'streambuf' reads the whole input, including
+        //:   input longer than the internal chunk size.
+        //:
+        //: 2 The memory used to decode from a 'streambuf' is supplied by the
+        //:   allocator supplied at construction.
+        //
+        // Plan:
+        //: 1 Encode values of increasing size, up to several times the chunk
+        //:   size, and decode them from a 'bdlsb::FixedMemInStreamBuf', using
+        //:   a decoder supplied with a test allocator.  Verify the decoded
+        //:   value, and that the default allocator is not used by the decoder.
+        //:   (C-1..2)
+        //:
+        //: 2 Decode a truncated encoding from a 'streambuf', and verify that
+        //:   decoding fails.  (C-1)
+        //
+        // Testing:
+        //   int decode(TYPE *result, bsl::streambuf *streamBuf);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "DECODING FROM A 'streambuf'" << endl
+                          << "===========================" << endl;
+
+        bslma::TestAllocator oa("object",  veryVerbose);
+        bslma::TestAllocator sa("scratch", veryVerbose);
+
+        Obj mX(&oa);
+        for (int size = 0; size < 20000; size = 2 * size + 1) {
+            if (veryVerbose) { T_ P(size) }
+
+            balb::SimpleRequest value(&sa);
+            value.data().assign(size, 'd');
+            value.responseLength() = size;
+
+            bsl::vector<char> buffer(&sa);
+            ASSERTV(size, 0 == Encoder(&sa).encode(&buffer, value));
+
+            {
+                balb::SimpleRequest result(&sa);
+
+                const Int64 NUM_DEFAULT = da.numAllocations();
+
+                bdlsb::FixedMemInStreamBuf streamBuf(buffer.data(),
+                                                     buffer.size());
+                ASSERTV(size, 0 == mX.decode(&result, &streamBuf));
+                ASSERTV(size, value == result);
+                ASSERTV(size, NUM_DEFAULT == da.numAllocations());
+            }
+            {
+                balb::SimpleRequest result(&sa);
+
+                bdlsb::FixedMemInStreamBuf streamBuf(buffer.data(),
+                                                     buffer.size() - 1);
+                ASSERTV(size, 0 != mX.decode(&result, &streamBuf));
+            }
+        }
+        ASSERT(0 < oa.numAllocations());
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // MAXIMUM DEPTH
+        //
+        // Concerns:
+        //: 1 Decoding a value whose nesting of blocks is at most 'maxDepth'
+        //:   succeeds, and decoding a value nested more deeply fails.
+        //:
+        //: 2 The depth is reset by each call to 'decode', including after a
+        //:   failure.
+        //:
+        //: 3 A choice having no selection does not count as a level of
+        //:   nesting.
+        //
+        // Plan:
+        //: 1 Encode a 'bsl::vector<bsl::vector<bsl::vector<int> > >' (having
+        //:   3 levels of nesting) and decode it with decoders having a maximum
+        //:   depth of 1 to 4.  Decode it twice with each decoder.  (C-1..2)
+        //:
+        //: 2 Decode a 'balb::Choice1' having no selection with a decoder
+        //:   having a maximum depth of 1, and a 'balb::Choice1' having a
+        //:   selection.  (C-3)
+        //
+        // Testing:
+        //   int decode(TYPE *result, const char *data, bsl::size_t length);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "MAXIMUM DEPTH" << endl
+                          << "=============" << endl;
+
+        typedef bsl::vector<int>     V1;
+        typedef bsl::vector<V1>      V2;
+        typedef bsl::vector<V2>      V3;
+
+        V3 value(2, V2(2, V1(2, 7)));
+
+        bsl::vector<char> buffer;
+        ASSERT(0 == Encoder().encode(&buffer, value));
+
+        for (int maxDepth = 1; maxDepth <= 4; ++maxDepth) {
+            Obj mX(maxDepth);  const Obj& X = mX;
+            ASSERTV(maxDepth, maxDepth == X.maxDepth());
+
+            for (int i = 0; i < 2; ++i) {
+                V3 result;
+                const int rc = mX.decode(&result,
+                                         buffer.data(),
+                                         buffer.size());
+                ASSERTV(maxDepth, i, (maxDepth >= 3) == (0 == rc));
+                if (0 == rc) {
+                    ASSERTV(maxDepth, i, value == result);
+                }
+            }
+        }
+
+        {
+            Obj mX(1);
+
+            balb::Choice1 value;
+            ASSERT(0 == Encoder().encode(&buffer, value));
+
+            balb::Choice1 result;
+            result.makeSelection1(1);
+            ASSERT(0 == mX.decode(&result, buffer.data(), buffer.size()));
+            ASSERT(value == result);
+
+            value.makeSelection2(2.5);
+            ASSERT(0 == Encoder().encode(&buffer, value));
+            ASSERT(0 == mX.decode(&result, buffer.data(), buffer.size()));
+            ASSERT(value == result);
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // MALFORMED INPUT
+        //
+        // Concerns:
+        //: 1 Decoding any truncation of a valid encoding fails.
+        //:
+        //: 2 Decoding a corrupted encoding either fails or succeeds, but does
+        //:   not read outside of the buffer, and does not leak memory.
+        //:
+        //: 3 Decoding a value of a type other than the encoded type fails, or
+        //:   succeeds, but does not read outside of the buffer.
+        //:
+        //: 4 Decoding fails if an encoded value can not be represented by the
+        //:   decoded type (e.g., an enumerator, a restricted customized type,
+        //:   or a selection id, that is not valid).
+        //:
+        //: 5 Decoding a type that is not supported fails.
+        //
+        // Plan:
+        //: 1 Encode a 'balb::FeatureTestMessage', and decode every truncation
+        //:   of the encoding, copied to a buffer having exactly the length of
+        //:   the truncation.  (C-1)
+        //:
+        //: 2 For every byte of the encoding, and for several replacement
+        //:   values, decode the encoding having that byte replaced, using an
+        //:   object allocator to detect leaks.  (C-2)
+        //:
+        //: 3 Decode the encoding as a 'balb::Sequence4'.  (C-3)
+        //:
+        //: 4 Encode arrays of 'int' and strings, and decode them as arrays of
+        //:   'balb::Enumerated::Value', 'balb::CustomInt', and
+        //:   'balb::CustomString', and as a 'balb::Choice1'.  (C-4)
+        //:
+        //: 5 Decode as an 'int' and as an array of 'bdldfp::Decimal64'.
+        //:   (C-5)
+        //
+        // Testing:
+        //   int decode(TYPE *result, const char *data, bsl::size_t length);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "MALFORMED INPUT" << endl
+                          << "===============" << endl;
+
+        bslma::TestAllocator oa("object", veryVerbose);
+
+        balb::FeatureTestMessage value;
+        populate(&value);
+
+        bsl::vector<char> buffer;
+        ASSERT(0 == Encoder().encode(&buffer, value));
+
+        if (verbose) cout << "\nTruncations." << endl;
+        {
+            Obj mX;
+            for (bsl::size_t length = 0; length < buffer.size(); ++length) {
+                bsl::vector<char> truncated(buffer.begin(),
+                                            buffer.begin() + length);
+
+                balb::FeatureTestMessage result(&oa);
+                ASSERTV(length, 0 != mX.decode(&result,
+                                               truncated.data(),
+                                               truncated.size()));
+            }
+        }
+
+        if (verbose) cout << "\nCorruptions." << endl;
+        {
+            const unsigned char REPLACEMENT[] = { 0x00, 0x01, 0x7F, 0x80,
+                                                  0xFF };
+            const int NUM_REPLACEMENT = sizeof REPLACEMENT
+                                                        / sizeof *REPLACEMENT;
+
+            Obj mX;
+            int numSuccesses = 0;
+            for (bsl::size_t i = 0; i < buffer.size(); ++i) {
+                for (int j = 0; j < NUM_REPLACEMENT; ++j) {
+                    bsl::vector<char> corrupted(buffer);
+                    corrupted[i] = static_cast<char>(REPLACEMENT[j]);
+
+                    balb::FeatureTestMessage result(&oa);
+                    if (0 == mX.decode(&result,
+                                       corrupted.data(),
+                                       corrupted.size())) {
+                        ++numSuccesses;
+                    }
+                }
+            }
+            if (veryVerbose) { T_ P_(buffer.size()) P(numSuccesses) }
+            ASSERT(0 < numSuccesses);
+            ASSERT(0 == oa.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nOther type." << endl;
+        {
+            // The format is not self-describing: the block of the choice,
+            // having the selection id 0, is read as a sequence having no
+            // fields.
+
+            Obj             mX;
+            balb::Sequence4 result(&oa);
+            populate(&result);
+            ASSERT(0 == mX.decode(&result, buffer.data(), buffer.size()));
+            ASSERT(balb::Sequence4() == result);
+        }
+
+        if (verbose) cout << "\nUnrepresentable values." << endl;
+        {
+            Obj mX;
+
+            bsl::vector<int> ints(1, 1001);
+            ASSERT(0 == Encoder().encode(&buffer, ints));
+
+            bsl::vector<balb::CustomInt> customInts;
+            ASSERT(0 != mX.decode(&customInts, buffer.data(), buffer.size()));
+
+            bsl::vector<balb::Enumerated::Value> enums;
+            ASSERT(0 != mX.decode(&enums, buffer.data(), buffer.size()));
+
+            ints[0] = 1000;
+            ASSERT(0 == Encoder().encode(&buffer, ints));
+            ASSERT(0 == mX.decode(&customInts, buffer.data(), buffer.size()));
+            ASSERT(1 == customInts.size());
+            ASSERT(1000 == customInts[0].toInt());
+
+            ints[0] = balb::Enumerated::LONDON;
+            ASSERT(0 == Encoder().encode(&buffer, ints));
+            ASSERT(0 == mX.decode(&enums, buffer.data(), buffer.size()));
+            ASSERT(1 == enums.size());
+            ASSERT(balb::Enumerated::LONDON == enums[0]);
+
+            bsl::vector<bsl::string> strings(1, "123456789");
+            ASSERT(0 == Encoder().encode(&buffer, strings));
+
+            bsl::vector<balb::CustomString> customStrings;
+            ASSERT(0 != mX.decode(&customStrings,
+                                  buffer.data(),
+                                  buffer.size()));
+
+            balb::Choice2 choice2;
+            choice2.makeSelection4(4);
+            ASSERT(0 == Encoder().encode(&buffer, choice2));
+
+            balb::Choice1 choice1;
+            ASSERT(0 != mX.decode(&choice1, buffer.data(), buffer.size()));
+        }
+
+        if (verbose) cout << "\nUnsupported types." << endl;
+        {
+            Obj mX;
+
+            bsl::vector<int> ints(1, 1);
+            ASSERT(0 == Encoder().encode(&buffer, ints));
+
+            int intValue;
+            ASSERT(0 != mX.decode(&intValue, buffer.data(), buffer.size()));
+
+            bsl::vector<bdldfp::Decimal64> decimals;
+            ASSERT(0 != mX.decode(&decimals, buffer.data(), buffer.size()));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // SCHEMA EVOLUTION
+        //
+        // Concerns:
+        //: 1 An attribute that is absent from the encoding (i.e., whose index
+        //:   is not less than the number of fields of the block) is reset to
+        //:   its default value.
+        //:
+        //: 2 Fields of the encoding beyond the last attribute are ignored.
+        //:
+        //: 3 A null field is decoded as the default value of a non-nullable
+        //:   attribute.
+        //
+        // Plan:
+        //: 1 Encode arrays of 'unsigned int' of 2 and 4 elements, and decode
+        //:   them as a 'balb::UnsignedSequence' (having 3 attributes) whose
+        //:   attributes are initially non-zero.  (C-1..2)
+        //:
+        //: 2 Encode an array of 'bdlb::NullableValue<int>' holding a null
+        //:   value, and decode it as a 'bsl::vector<int>'.  (C-3)
+        //
+        // Testing:
+        //   int decode(TYPE *result, const char *data, bsl::size_t length);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "SCHEMA EVOLUTION" << endl
+                          << "================" << endl;
+
+        Obj               mX;
+        bsl::vector<char> buffer;
+
+        balb::UnsignedSequence initial;
+        initial.element1() = 100;
+        initial.element2() = 200;
+        initial.element3() = 300;
+
+        bsl::vector<unsigned int> fields;
+        fields.push_back(1);
+        fields.push_back(2);
+        ASSERT(0 == Encoder().encode(&buffer, fields));
+        {
+            balb::UnsignedSequence result(initial);
+            ASSERT(0 == mX.decode(&result, buffer.data(), buffer.size()));
+            ASSERT(1 == result.element1());
+            ASSERT(2 == result.element2());
+            ASSERT(0 == result.element3());
+        }
+
+        fields.push_back(3);
+        fields.push_back(4);
+        ASSERT(0 == Encoder().encode(&buffer, fields));
+        {
+            balb::UnsignedSequence result(initial);
+            ASSERT(0 == mX.decode(&result, buffer.data(), buffer.size()));
+            ASSERT(1 == result.element1());
+            ASSERT(2 == result.element2());
+            ASSERT(3 == result.element3());
+        }
+
+        bsl::vector<bdlb::NullableValue<int> > nullables(2);
+        nullables[1].makeValue(5);
+        ASSERT(0 == Encoder().encode(&buffer, nullables));
+        {
+            bsl::vector<int> result(3, 9);
+            ASSERT(0 == mX.decode(&result, buffer.data(), buffer.size()));
+            ASSERT(2 == result.size());
+            ASSERT(0 == result[0]);
+            ASSERT(5 == result[1]);
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // ROUND TRIP
+        //
+        // Concerns:
+        //: 1 Every supported type is decoded to the encoded value.
+        //:
+        //: 2 Decoding into an object holding another value replaces every
+        //:   attribute (including null and absent ones), resizes every array,
+        //:   and resets a choice having no selection.
+        //:
+        //: 3 Decoding does not use the default allocator, other than for
+        //:   the decoded value.
+        //
+        // Plan:
+        //: 1 For values of several generated types, including values nesting
+        //:   sequences, choices, arrays, nullable values, enumerations, and
+        //:   customized types, encode the value, decode it into a
+        //:   default-constructed object and into an object holding another
+        //:   value, and compare the result with the original value.  (C-1..2)
+        //:
+        //: 2 Decode into an object using a test allocator, and verify that the
+        //:   default allocator is not used.  (C-3)
+        //
+        // Testing:
+        //   int decode(TYPE *result, const char *data, bsl::size_t length);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ROUND TRIP" << endl
+                          << "==========" << endl;
+
+        if (verbose) cout << "\nSimple types." << endl;
+        {
+            balb::UnsignedSequence value;
+            value.element1() = 0xFFFFFFFF;
+            value.element2() = 0xFFFF;
+            value.element3() = 0xFFFFFFFFFFFFFFFFULL;
+            testRoundTrip(L_, value, balb::UnsignedSequence());
+            testRoundTrip(L_, balb::UnsignedSequence(), value);
+
+            balb::Sequence2 s2;
+            s2.element1() = balb::CustomString("s2");
+            s2.element2() = 255;
+            s2.element3() = bdlt::DatetimeTz(bdlt::Datetime(1, 1, 1), 1439);
+            s2.element4().makeValue().makeSelection2(-0.0);
+            s2.element5().makeValue(1e300);
+            testRoundTrip(L_, s2, balb::Sequence2());
+            testRoundTrip(L_, balb::Sequence2(), s2);
+
+            bsl::vector<bdlt::Date> dates;
+            dates.push_back(bdlt::Date(1, 1, 1));
+            dates.push_back(bdlt::Date(9999, 12, 31));
+            testRoundTrip(L_, dates, bsl::vector<bdlt::Date>(5));
+
+            bsl::vector<bdlt::Time> times;
+            times.push_back(bdlt::Time());
+            times.push_back(bdlt::Time(23, 59, 59, 999, 999));
+            testRoundTrip(L_, times, bsl::vector<bdlt::Time>());
+
+            bsl::vector<bdlt::DateTz> dateTzs;
+            dateTzs.push_back(bdlt::DateTz(bdlt::Date(2026, 10, 19), -1439));
+            testRoundTrip(L_, dateTzs, bsl::vector<bdlt::DateTz>());
+
+            bsl::vector<bsls::Types::Int64> int64s;
+            int64s.push_back(-1);
+            int64s.push_back(static_cast<Int64>(1) << 62);
+            testRoundTrip(L_, int64s, bsl::vector<bsls::Types::Int64>());
+
+            bsl::vector<float> floats;
+            floats.push_back(-1.5f);
+            testRoundTrip(L_, floats, bsl::vector<float>(2, 1.0f));
+        }
+
+        if (verbose) cout << "\nNested types." << endl;
+        {
+            balb::Sequence6 s6;
+            populate(&s6);
+            testRoundTrip(L_, s6, balb::Sequence6());
+            testRoundTrip(L_, balb::Sequence6(), s6);
+
+            balb::Sequence4 s4;
+            populate(&s4);
+            testRoundTrip(L_, s4, balb::Sequence4());
+            testRoundTrip(L_, balb::Sequence4(), s4);
+
+            balb::FeatureTestMessage message;
+            populate(&message);
+            testRoundTrip(L_, message, balb::FeatureTestMessage());
+
+            balb::FeatureTestMessage other;
+            other.makeSelection6(balb::CustomString("other"));
+            testRoundTrip(L_, message, other);
+            testRoundTrip(L_, other, message);
+            testRoundTrip(L_, balb::FeatureTestMessage(), message);
+        }
+
+        if (verbose) cout << "\nAllocators." << endl;
+        {
+            bslma::TestAllocator oa("object", veryVerbose);
+
+            balb::Sequence4 value;
+            populate(&value);
+
+            bsl::vector<char> buffer;
+            ASSERT(0 == Encoder().encode(&buffer, value));
+
+            const Int64 NUM_DEFAULT = da.numAllocations();
+            {
+                Obj             mX;
+                balb::Sequence4 result(&oa);
+                ASSERT(0     == mX.decode(&result,
+                                          buffer.data(),
+                                          buffer.size()));
+                ASSERT(value == result);
+            }
+            ASSERT(NUM_DEFAULT == da.numAllocations());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND 'maxDepth'
+        //
+        // Concerns:
+        //: 1 A decoder created without a maximum depth has the maximum depth
+        //:   'k_DEFAULT_MAX_DEPTH', and otherwise has the supplied maximum
+        //:   depth.
+        //:
+        //: 2 No memory is allocated on construction.
+        //:
+        //: 3 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create decoders with and without a maximum depth, and verify
+        //:   'maxDepth'.  (C-1)
+        //:
+        //: 2 Verify that the supplied allocator is not used.  (C-2)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for a non-positive maximum depth.  (C-3)
+        //
+        // Testing:
+        //   explicit Decoder(bslma::Allocator *basicAllocator = 0);
+        //   explicit Decoder(int maxDepth, bslma::Allocator *basicAllocator);
+        //   ~Decoder();
+        //   int maxDepth() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS AND 'maxDepth'" << endl
+                          << "=======================" << endl;
+
+        bslma::TestAllocator oa("object", veryVerbose);
+        {
+            const Obj X(&oa);
+            ASSERT(Obj::k_DEFAULT_MAX_DEPTH == X.maxDepth());
+
+            const Obj Y(1, &oa);
+            ASSERT(1 == Y.maxDepth());
+
+            const Obj Z(1000);
+            ASSERT(1000 == Z.maxDepth());
+        }
+        ASSERT(0 == oa.numAllocations());
+        ASSERT(0 == da.numAllocations());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(Obj(1));
+            ASSERT_FAIL(Obj(0));
+            ASSERT_FAIL(Obj(-1));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Encode and decode a 'balb::SimpleRequest' and a
+        //:   'balb::Sequence4'.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        balb::SimpleRequest request;
+        request.data()           = "breathing";
+        request.responseLength() = 3;
+
+        bsl::vector<char> buffer;
+        ASSERT(0 == Encoder().encode(&buffer, request));
+
+        Obj                 mX;
+        balb::SimpleRequest result;
+        ASSERT(0       == mX.decode(&result, buffer.data(), buffer.size()));
+        ASSERT(request == result);
+
+        balb::Sequence4 value;
+        populate(&value);
+        ASSERT(0 == Encoder().encode(&buffer, value));
+
+        balb::Sequence4 decoded;
+        ASSERT(0     == mX.decode(&decoded, buffer.data(), buffer.size()));
+        ASSERT(value == decoded);
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: COMPARISON WITH 'balber'
+        //
+        // Concerns:
+        //: 1 Reading a few attributes of an encoded value in place is much
+        //:   faster than decoding the value with 'balber'.
+        //:
+        //: 2 Encoding and decoding with 'balflt' is competitive with
+        //:   'balber'.
+        //
+        // Plan:
+        //: 1 For a 'balb::Sequence4' having every attribute set, measure the
+        //:   time to encode, to decode, and to read two attributes (by
+        //:   decoding the value with 'balber', and in place with
+        //:   'balflt::RecordRef'), and print the results.  The number of
+        //:   iterations may be supplied as the second argument.  (C-1..2)
+        //
+        // Testing:
+        //   PERFORMANCE: COMPARISON WITH 'balber'
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE: COMPARISON WITH 'balber'" << endl
+             << "=====================================" << endl;
+
+        const int NUM_ITERATIONS = argc > 2 && 0 < bsl::atoi(argv[2])
+                                 ? bsl::atoi(argv[2])
+                                 : 100000;
+
+        balb::Sequence4 value;
+        populate(&value);
+
+        bsls::Stopwatch timer;
+
+        bsl::vector<char>       flatBuffer;
+        bdlsb::MemOutStreamBuf  berBuffer;
+        {
+            Encoder encoder;
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                encoder.encode(&flatBuffer, value);
+            }
+            const double flatTime = timer.elapsedTime();
+
+            balber::BerEncoder berEncoder;
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                berBuffer.reset();
+                berEncoder.encode(&berBuffer, value);
+            }
+            const double berTime = timer.elapsedTime();
+
+            cout << "encode:  balflt " << flatTime << "s ("
+                 << flatBuffer.size() << " bytes), balber " << berTime
+                 << "s (" << berBuffer.length() << " bytes)" << endl;
+        }
+        {
+            Obj             decoder;
+            balb::Sequence4 result;
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                decoder.decode(&result, flatBuffer.data(), flatBuffer.size());
+            }
+            const double flatTime = timer.elapsedTime();
+            ASSERT(value == result);
+
+            balber::BerDecoder berDecoder;
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                bdlsb::FixedMemInStreamBuf streamBuf(berBuffer.data(),
+                                                     berBuffer.length());
+                berDecoder.decode(&streamBuf, &result);
+            }
+            const double berTime = timer.elapsedTime();
+            ASSERT(value == result);
+
+            cout << "decode:  balflt " << flatTime << "s, balber "
+                 << berTime << "s" << endl;
+        }
+        {
+            Int64 sum = 0;
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                balflt::RecordRef record;
+                record.reset(flatBuffer.data(), flatBuffer.size());
+
+                int    element12 = 0;
+                double element10 = 0;
+                record.getValue(&element12,
+                                balb::Sequence4::ATTRIBUTE_INDEX_ELEMENT12);
+                record.getValue(&element10,
+                                balb::Sequence4::ATTRIBUTE_INDEX_ELEMENT10);
+                sum += element12 + static_cast<Int64>(element10);
+            }
+            const double flatTime = timer.elapsedTime();
+
+            balber::BerDecoder berDecoder;
+            balb::Sequence4    result;
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                bdlsb::FixedMemInStreamBuf streamBuf(berBuffer.data(),
+                                                     berBuffer.length());
+                berDecoder.decode(&streamBuf, &result);
+                sum += result.element12()
+                     + static_cast<Int64>(result.element10());
+            }
+            const double berTime = timer.elapsedTime();
+            ASSERT(2 * NUM_ITERATIONS * 22 == sum);
+
+            cout << "2 attributes:  balflt (in place) " << flatTime
+                 << "s, balber (decode) " << berTime << "s" << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,96 @@
+// balflt_encoder.cpp                                                 -*-C++-*-
+#include <balflt_encoder.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(balflt_encoder_cpp,"$Id$ $CSID$")
+
+#include <bsl_cstring.h>
+
+namespace BloombergLP {
+namespace balflt {
+
+                               // -------------
+                               // class Encoder
+                               // -------------
+
+// PRIVATE MANIPULATORS
+bsl::size_t Encoder::beginBlock(unsigned int numSlots, unsigned int word)
+{
+    const bsl::size_t block = FlatUtil::align(d_output_p->size());
+
+    d_output_p->resize(block + FlatUtil::fixedSize(numSlots));
+    FlatUtil::putUint32(d_output_p->data() + block + 4, word);
+    return block;
+}
+
+int Encoder::endBlock(bsl::size_t block)
+{
+    const bsl::size_t end = FlatUtil::align(d_output_p->size());
+    if (end - block > FlatUtil::k_MAX_BLOCK_SIZE) {
+        return -1;                                                    // RETURN
+    }
+
+    d_output_p->resize(end);
+    FlatUtil::putUint32(d_output_p->data() + block,
+                        static_cast<unsigned int>(end - block));
+    return 0;
+}
+
+int Encoder::putBytes(const Encoder_Slot& slot,
+                      const char         *data,
+                      bsl::size_t         size)
+{
+    if (size > FlatUtil::k_MAX_BLOCK_SIZE) {
+        return -1;                                                    // RETURN
+    }
+
+    bsl::size_t offset = slot.d_block;
+    if (0 != size) {
+        offset = FlatUtil::align(d_output_p->size());
+        d_output_p->resize(offset + size);
+        bsl::memcpy(d_output_p->data() + offset, data, size);
+    }
+
+    char *address = slotAddress(slot);
+    FlatUtil::putUint32(address,
+                        static_cast<unsigned int>(offset - slot.d_block));
+    FlatUtil::putUint32(address + 4, static_cast<unsigned int>(size));
+    return 0;
+}
+
+int Encoder::encodeSlot(const Encoder_Slot&       slot,
+                        const bsl::vector<char>&  value,
+                        bdlat_TypeCategory::Array )
+{
+    return putBytes(slot, value.data(), value.size());
+}
+
+// CREATORS
+Encoder::Encoder(bslma::Allocator *basicAllocator)
+: d_buffer(basicAllocator)
+, d_output_p(0)
+{
+}
+
+Encoder::~Encoder()
+{
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
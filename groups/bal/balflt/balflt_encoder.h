@@ -0,0 +1,857 @@
+// balflt_encoder.h                                                   -*-C++-*-
+#ifndef INCLUDED_BALFLT_ENCODER
+#define INCLUDED_BALFLT_ENCODER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an encoder of 'bdlat'-conforming types to the flat format.
+//
+//@CLASSES:
+//  balflt::Encoder: flat-format encoder
+//
+//@SEE_ALSO: balflt_decoder, balflt_recordref, balflt_flatutil
+//
+//@DESCRIPTION: This component provides a class, 'balflt::Encoder', having a
+// parameterized 'encode' function that encodes a sequence, a choice, or an
+// array of any type supported by the 'bdlat' framework into the fixed-layout
+// "flat" format described in 'balflt_flatutil'.  Every attribute of an encoded
+// sequence is stored at an offset determined by the position of the attribute
+// in the sequence, so that readers (see 'balflt_recordref') can access any
+// attribute in place, without a decoding step.
+//
+// The encoder writes each block in a single pass: the fixed part of a block
+// (its header, slots, and presence bitmap) is reserved first, and the
+// variable-size values are appended after it, the slots referring to them
+// being filled in once their offsets are known.
+//
+///Supported Types
+///---------------
+// The following types are supported:
+//: o sequences, choices, arrays, nullable values, enumerations (encoded as
+//:   'int'), and customized types (encoded as their base type);
+//:
+//: o 'bool', 'char', 'signed char', 'unsigned char', 'short',
+//:   'unsigned short', 'int', 'unsigned int', 'bsls::Types::Int64',
+//:   'bsls::Types::Uint64', 'float', 'double', 'bsl::string', and
+//:   'bsl::vector<char>' (encoded as bytes); and
+//:
+//: o 'bdlt::Date', 'bdlt::Time', 'bdlt::Datetime', 'bdlt::DateTz',
+//:   'bdlt::TimeTz', and 'bdlt::DatetimeTz'.
+//
+// Encoding a value having an attribute (or element) of any other simple type
+// (e.g., 'bdldfp::Decimal64') fails.  A nullable value is represented by the
+// presence bit of its slot; a nullable value whose value is itself a nullable
+// value is encoded as its innermost value.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Encoding a Request
+///- - - - - - - - - - - - - - -
+// Suppose that we want to encode a value of the generated sequence type
+// 'balb::SimpleRequest', having the attributes 'data' (a 'bsl::string') and
+// 'responseLength' (an 'int'):
+//..
+//  balb::SimpleRequest request;
+//  request.data()           = "Hello, world";
+//  request.responseLength() = 42;
+//..
+// First, we create an encoder, and encode 'request' into a buffer:
+//..
+//  balflt::Encoder   encoder;
+//  bsl::vector<char> buffer;
+//
+//  int rc = encoder.encode(&buffer, request);
+//  assert(0 == rc);
+//..
+// Then, we observe that the encoding consists of the fixed part of a block
+// having 2 slots (8 bytes of header, 2 slots, and 8 bytes of presence bitmap),
+// followed by the characters of 'data' (padded to a multiple of 8 bytes):
+//..
+//  assert(8 + 2 * 8 + 8 + 16 == buffer.size());
+//..
+// Finally, we read 'responseLength' in place, without decoding 'request' (see
+// 'balflt_recordref'):
+//..
+//  balflt::RecordRef record;
+//  rc = record.reset(buffer.data(), buffer.size());
+//  assert(0 == rc);
+//
+//  int responseLength;
+//  rc = record.getValue(&responseLength,
+//                       balb::SimpleRequest::ATTRIBUTE_INDEX_RESPONSE_LENGTH);
+//  assert(0  == rc);
+//  assert(42 == responseLength);
+//..
+
+#include <balscm_version.h>
+
+#include <balflt_flatutil.h>
+
+#include <bdlat_arrayfunctions.h>
+#include <bdlat_choicefunctions.h>
+#include <bdlat_customizedtypefunctions.h>
+#include <bdlat_enumfunctions.h>
+#include <bdlat_nullablevaluefunctions.h>
+#include <bdlat_sequencefunctions.h>
+#include <bdlat_typecategory.h>
+
+#include <bdlt_date.h>
+#include <bdlt_datetime.h>
+#include <bdlt_datetimetz.h>
+#include <bdlt_datetz.h>
+#include <bdlt_time.h>
+#include <bdlt_timetz.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bslmf_nil.h>
+
+#include <bsls_assert.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_ios.h>
+#include <bsl_streambuf.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace balflt {
+
+                         // ===========================
+                         // private struct Encoder_Slot
+                         // ===========================
+
+struct Encoder_Slot {
+    // This component-private 'struct' identifies a slot of a block being
+    // encoded.
+
+    // DATA
+    bsl::size_t d_block;   // offset of the block in the output
+    bsl::size_t d_bitmap;  // offset of the presence bitmap of the block
+    int         d_index;   // index of the slot in the block
+};
+
+                               // =============
+                               // class Encoder
+                               // =============
+
+class Encoder {
+    // This class provides a mechanism to encode 'bdlat'-conforming values
+    // into the flat format.  The memory used to encode into a 'streambuf' is
+    // retained, and reused by subsequent calls to 'encode'.
+
+    // DATA
+    bsl::vector<char>  d_buffer;    // encoding, when encoding to a
+                                    // 'streambuf'
+
+    bsl::vector<char> *d_output_p;  // encoding in progress (held, not owned)
+
+    // FRIENDS
+    friend class Encoder_SlotVisitor;
+    friend struct Encoder_EncodeProxy;
+
+  private:
+    // NOT IMPLEMENTED
+    Encoder(const Encoder&);
+    Encoder& operator=(const Encoder&);
+
+    // PRIVATE MANIPULATORS
+    bsl::size_t beginBlock(unsigned int numSlots, unsigned int word);
+        // Append to the output the fixed part of a block having the specified
+        // 'numSlots' and 'word', at an 8-byte boundary, and return the offset
+        // of the block in the output.
+
+    int endBlock(bsl::size_t block);
+        // Pad the output to an 8-byte boundary and write the length of the
+        // block at the specified 'block' offset.  Return 0 on success, and a
+        // non-zero value if the block is larger than
+        // 'FlatUtil::k_MAX_BLOCK_SIZE'.
+
+    char *slotAddress(const Encoder_Slot& slot);
+        // Return the address of the specified 'slot' in the output, and mark
+        // 'slot' as present.
+
+    int putBytes(const Encoder_Slot& slot, const char *data, bsl::size_t size);
+        // Append the specified 'size' bytes of the specified 'data' to the
+        // output, and make the specified 'slot' refer to them.  Return 0 on
+        // success, and a non-zero value otherwise.
+
+    template <class TYPE>
+    int putNested(const Encoder_Slot& slot, const TYPE& value);
+        // Append a block holding the specified 'value' to the output, and make
+        // the specified 'slot' refer to it.  Return 0 on success, and a
+        // non-zero value otherwise.
+
+    template <class TYPE>
+    int putTz(const Encoder_Slot& slot, const TYPE& value);
+        // Append the time zone-aware 'value' to the output, and make the
+        // specified 'slot' refer to it.  Return 0 on success, and a non-zero
+        // value otherwise.
+
+    template <class TYPE>
+    int encodeBlock(const TYPE& value, bdlat_TypeCategory::Sequence);
+    template <class TYPE>
+    int encodeBlock(const TYPE& value, bdlat_TypeCategory::Choice);
+    template <class TYPE>
+    int encodeBlock(const TYPE& value, bdlat_TypeCategory::Array);
+    template <class TYPE>
+    int encodeBlock(const TYPE& value, bdlat_TypeCategory::CustomizedType);
+    template <class TYPE>
+    int encodeBlock(const TYPE& value, bdlat_TypeCategory::DynamicType);
+    template <class TYPE, class CATEGORY>
+    int encodeBlock(const TYPE& value, CATEGORY);
+        // Append to the output the block holding the specified 'value'.
+        // Return 0 on success, and a non-zero value if 'value' is not a
+        // sequence, a choice, or an array, or if 'value' can not be encoded.
+
+    int encodeSlot(const Encoder_Slot&        slot,
+                   const bsl::vector<char>&   value,
+                   bdlat_TypeCategory::Array);
+    template <class TYPE>
+    int encodeSlot(const Encoder_Slot&         slot,
+                   const TYPE&                 value,
+                   bdlat_TypeCategory::Array);
+    template <class TYPE>
+    int encodeSlot(const Encoder_Slot&            slot,
+                   const TYPE&                    value,
+                   bdlat_TypeCategory::Choice);
+    template <class TYPE>
+    int encodeSlot(const Encoder_Slot&                  slot,
+                   const TYPE&                          value,
+                   bdlat_TypeCategory::CustomizedType);
+    template <class TYPE>
+    int encodeSlot(const Encoder_Slot&               slot,
+                   const TYPE&                       value,
+                   bdlat_TypeCategory::DynamicType);
+    template <class TYPE>
+    int encodeSlot(const Encoder_Slot&               slot,
+                   const TYPE&                       value,
+                   bdlat_TypeCategory::Enumeration);
+    template <class TYPE>
+    int encodeSlot(const Encoder_Slot&                 slot,
+                   const TYPE&                         value,
+                   bdlat_TypeCategory::NullableValue);
+    template <class TYPE>
+    int encodeSlot(const Encoder_Slot&            slot,
+                   const TYPE&                    value,
+                   bdlat_TypeCategory::Sequence);
+    template <class TYPE>
+    int encodeSlot(const Encoder_Slot&          slot,
+                   const TYPE&                  value,
+                   bdlat_TypeCategory::Simple);
+        // Encode the specified 'value' into the specified 'slot' of the block
+        // being encoded.  Return 0 on success, and a non-zero value otherwise.
+
+    template <class TYPE>
+    int encodeSimple(const Encoder_Slot& slot, const TYPE& value);
+    int encodeSimple(const Encoder_Slot& slot, bool                   value);
+    int encodeSimple(const Encoder_Slot& slot, char                   value);
+    int encodeSimple(const Encoder_Slot& slot, signed char            value);
+    int encodeSimple(const Encoder_Slot& slot, unsigned char          value);
+    int encodeSimple(const Encoder_Slot& slot, short                  value);
+    int encodeSimple(const Encoder_Slot& slot, unsigned short         value);
+    int encodeSimple(const Encoder_Slot& slot, int                    value);
+    int encodeSimple(const Encoder_Slot& slot, unsigned int           value);
+    int encodeSimple(const Encoder_Slot& slot, bsls::Types::Int64     value);
+    int encodeSimple(const Encoder_Slot& slot, bsls::Types::Uint64    value);
+    int encodeSimple(const Encoder_Slot& slot, float                  value);
+    int encodeSimple(const Encoder_Slot& slot, double                 value);
+    int encodeSimple(const Encoder_Slot& slot, const bsl::string&     value);
+    int encodeSimple(const Encoder_Slot& slot, const bdlt::Date&      value);
+    int encodeSimple(const Encoder_Slot& slot, const bdlt::Time&      value);
+    int encodeSimple(const Encoder_Slot& slot, const bdlt::Datetime&  value);
+    int encodeSimple(const Encoder_Slot& slot, const bdlt::DateTz&    value);
+    int encodeSimple(const Encoder_Slot& slot, const bdlt::TimeTz&    value);
+    int encodeSimple(const Encoder_Slot& slot,
+                     const bdlt::DatetimeTz& value);
+        // Encode the specified simple 'value' into the specified 'slot' of the
+        // block being encoded.  Return 0 on success, and a non-zero value if
+        // the type of 'value' is not supported.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(Encoder, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit Encoder(bslma::Allocator *basicAllocator = 0);
+        // Create an encoder.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.
+
+    ~Encoder();
+        // Destroy this object.
+
+    // MANIPULATORS
+    template <class TYPE>
+    int encode(bsl::vector<char> *buffer, const TYPE& value);
+        // Load into the specified 'buffer' the flat encoding of the specified
+        // 'value'.  Return 0 on success, and a non-zero value otherwise.  Note
+        // that the capacity of 'buffer' is reused.
+
+    template <class TYPE>
+    int encode(bsl::streambuf *streamBuf, const TYPE& value);
+        // Write the flat encoding of the specified 'value' to the specified
+        // 'streamBuf'.  Return 0 on success, and a non-zero value otherwise.
+};
+
+                     // ==================================
+                     // private class Encoder_SlotVisitor
+                     // ==================================
+
+class Encoder_SlotVisitor {
+    // This component-private class is a visitor encoding the attributes of a
+    // sequence, the elements of an array, or the selection of a choice into
+    // consecutive slots of a block.
+
+    // DATA
+    Encoder      *d_encoder_p;  // encoder (held, not owned)
+    Encoder_Slot  d_slot;       // next slot to encode
+
+  public:
+    // CREATORS
+    Encoder_SlotVisitor(Encoder      *encoder,
+                        bsl::size_t   block,
+                        unsigned int  numSlots);
+        // Create a visitor encoding into the slots of the block, having the
+        // specified 'numSlots', at the specified 'block' offset of the output
+        // of the specified 'encoder', starting with slot 0.
+
+    // MANIPULATORS
+    template <class TYPE, class INFO>
+    int operator()(const TYPE& value, const INFO&);
+    template <class TYPE>
+    int operator()(const TYPE& value);
+        // Encode the specified 'value' into the next slot.  Return 0 on
+        // success, and a non-zero value otherwise.
+};
+
+                   // ======================================
+                   // private struct Encoder_AttributeCounter
+                   // ======================================
+
+struct Encoder_AttributeCounter {
+    // This component-private 'struct' is a visitor counting the attributes of
+    // a sequence.
+
+    // DATA
+    unsigned int d_count;
+
+    // MANIPULATORS
+    template <class TYPE, class INFO>
+    int operator()(const TYPE&, const INFO&);
+        // Increment 'd_count' and return 0.
+};
+
+                     // ==================================
+                     // private struct Encoder_EncodeProxy
+                     // ==================================
+
+struct Encoder_EncodeProxy {
+    // This component-private 'struct' dispatches the encoding of a value of a
+    // dynamic type, or of the value of a nullable value, according to its
+    // category.
+
+    // DATA
+    Encoder            *d_encoder_p;  // encoder (held, not owned)
+    const Encoder_Slot *d_slot_p;     // slot, or 0 to encode a block
+
+    // MANIPULATORS
+    template <class TYPE>
+    int operator()(const TYPE&, bslmf::Nil);
+    template <class TYPE, class CATEGORY>
+    int operator()(const TYPE& value, CATEGORY category);
+    template <class TYPE>
+    int operator()(const TYPE& value);
+        // Encode the specified 'value', having the optionally specified
+        // 'category', as a block or into a slot.  Return 0 on success, and a
+        // non-zero value otherwise.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                               // -------------
+                               // class Encoder
+                               // -------------
+
+// PRIVATE MANIPULATORS
+template <class TYPE>
+int Encoder::putNested(const Encoder_Slot& slot, const TYPE& value)
+{
+    typedef typename bdlat_TypeCategory::Select<TYPE>::Type Category;
+
+    const bsl::size_t nested = FlatUtil::align(d_output_p->size());
+    if (0 != encodeBlock(value, Category())) {
+        return -1;                                                    // RETURN
+    }
+
+    char *address = slotAddress(slot);
+    FlatUtil::putUint32(address,
+                        static_cast<unsigned int>(nested - slot.d_block));
+    FlatUtil::putUint32(address + 4,
+                        static_cast<unsigned int>(d_output_p->size()
+                                                  - nested));
+    return 0;
+}
+
+template <class TYPE>
+int Encoder::putTz(const Encoder_Slot& slot, const TYPE& value)
+{
+    const bsl::size_t offset = FlatUtil::align(d_output_p->size());
+    d_output_p->resize(offset + FlatUtil::k_TZ_VALUE_SIZE);
+    FlatUtil::putValue(d_output_p->data() + offset, value);
+
+    char *address = slotAddress(slot);
+    FlatUtil::putUint32(address,
+                        static_cast<unsigned int>(offset - slot.d_block));
+    FlatUtil::putUint32(address + 4, FlatUtil::k_TZ_VALUE_SIZE);
+    return 0;
+}
+
+template <class TYPE>
+int Encoder::encodeBlock(const TYPE& value, bdlat_TypeCategory::Sequence)
+{
+    Encoder_AttributeCounter counter = { 0 };
+    bdlat_SequenceFunctions::accessAttributes(value, counter);
+
+    const bsl::size_t   block = beginBlock(counter.d_count, counter.d_count);
+    Encoder_SlotVisitor visitor(this, block, counter.d_count);
+
+    if (0 != bdlat_SequenceFunctions::accessAttributes(value, visitor)) {
+        return -1;                                                    // RETURN
+    }
+    return endBlock(block);
+}
+
+template <class TYPE>
+int Encoder::encodeBlock(const TYPE& value, bdlat_TypeCategory::Choice)
+{
+    const int selectionId = bdlat_ChoiceFunctions::selectionId(value);
+
+    const bsl::size_t block =
+                         beginBlock(1, static_cast<unsigned int>(selectionId));
+
+    if (bdlat_ChoiceFunctions::k_UNDEFINED_SELECTION_ID != selectionId) {
+        Encoder_SlotVisitor visitor(this, block, 1);
+
+        if (0 != bdlat_ChoiceFunctions::accessSelection(value, visitor)) {
+            return -1;                                                // RETURN
+        }
+    }
+    return endBlock(block);
+}
+
+template <class TYPE>
+int Encoder::encodeBlock(const TYPE& value, bdlat_TypeCategory::Array)
+{
+    const bsl::size_t size = bdlat_ArrayFunctions::size(value);
+    if (size > FlatUtil::k_MAX_BLOCK_SIZE / FlatUtil::k_SLOT_SIZE) {
+        return -1;                                                    // RETURN
+    }
+
+    const unsigned int  numSlots = static_cast<unsigned int>(size);
+    const bsl::size_t   block    = beginBlock(numSlots, numSlots);
+    Encoder_SlotVisitor visitor(this, block, numSlots);
+
+    for (bsl::size_t i = 0; i < size; ++i) {
+        if (0 != bdlat_ArrayFunctions::accessElement(value,
+                                                     visitor,
+                                                     static_cast<int>(i))) {
+            return -1;                                                // RETURN
+        }
+    }
+    return endBlock(block);
+}
+
+template <class TYPE>
+int Encoder::encodeBlock(const TYPE&                        value,
+                         bdlat_TypeCategory::CustomizedType)
+{
+    typedef typename
+    bdlat_CustomizedTypeFunctions::BaseType<TYPE>::Type BaseType;
+
+    typedef typename
+    bdlat_TypeCategory::Select<BaseType>::Type          BaseTypeCategory;
+
+    return encodeBlock(bdlat_CustomizedTypeFunctions::convertToBaseType(value),
+                       BaseTypeCategory());
+}
+
+template <class TYPE>
+int Encoder::encodeBlock(const TYPE&                     value,
+                         bdlat_TypeCategory::DynamicType)
+{
+    Encoder_EncodeProxy proxy = { this, 0 };
+    return bdlat_TypeCategoryUtil::accessByCategory(value, proxy);
+}
+
+template <class TYPE, class CATEGORY>
+inline
+int Encoder::encodeBlock(const TYPE&, CATEGORY)
+{
+    return -1;
+}
+
+template <class TYPE>
+inline
+int Encoder::encodeSlot(const Encoder_Slot&       slot,
+                        const TYPE&               value,
+                        bdlat_TypeCategory::Array )
+{
+    return putNested(slot, value);
+}
+
+template <class TYPE>
+inline
+int Encoder::encodeSlot(const Encoder_Slot&        slot,
+                        const TYPE&                value,
+                        bdlat_TypeCategory::Choice )
+{
+    return putNested(slot, value);
+}
+
+template <class TYPE>
+int Encoder::encodeSlot(const Encoder_Slot&                slot,
+                        const TYPE&                        value,
+                        bdlat_TypeCategory::CustomizedType )
+{
+    typedef typename
+    bdlat_CustomizedTypeFunctions::BaseType<TYPE>::Type BaseType;
+
+    typedef typename
+    bdlat_TypeCategory::Select<BaseType>::Type          BaseTypeCategory;
+
+    return encodeSlot(slot,
+                      bdlat_CustomizedTypeFunctions::convertToBaseType(value),
+                      BaseTypeCategory());
+}
+
+template <class TYPE>
+int Encoder::encodeSlot(const Encoder_Slot&             slot,
+                        const TYPE&                     value,
+                        bdlat_TypeCategory::DynamicType )
+{
+    Encoder_EncodeProxy proxy = { this, &slot };
+    return bdlat_TypeCategoryUtil::accessByCategory(value, proxy);
+}
+
+template <class TYPE>
+int Encoder::encodeSlot(const Encoder_Slot&             slot,
+                        const TYPE&                     value,
+                        bdlat_TypeCategory::Enumeration )
+{
+    int intValue;
+    bdlat_EnumFunctions::toInt(&intValue, value);
+    return encodeSimple(slot, intValue);
+}
+
+template <class TYPE>
+int Encoder::encodeSlot(const Encoder_Slot&               slot,
+                        const TYPE&                       value,
+                        bdlat_TypeCategory::NullableValue )
+{
+    if (bdlat_NullableValueFunctions::isNull(value)) {
+        return 0;                                                     // RETURN
+    }
+
+    Encoder_EncodeProxy proxy = { this, &slot };
+    return bdlat_NullableValueFunctions::accessValue(value, proxy);
+}
+
+template <class TYPE>
+inline
+int Encoder::encodeSlot(const Encoder_Slot&          slot,
+                        const TYPE&                  value,
+                        bdlat_TypeCategory::Sequence )
+{
+    return putNested(slot, value);
+}
+
+template <class TYPE>
+inline
+int Encoder::encodeSlot(const Encoder_Slot&        slot,
+                        const TYPE&                value,
+                        bdlat_TypeCategory::Simple )
+{
+    return encodeSimple(slot, value);
+}
+
+template <class TYPE>
+inline
+int Encoder::encodeSimple(const Encoder_Slot&, const TYPE&)
+{
+    return -1;
+}
+
+inline
+char *Encoder::slotAddress(const Encoder_Slot& slot)
+{
+    char *block = d_output_p->data() + slot.d_block;
+    FlatUtil::setPresent(d_output_p->data() + slot.d_bitmap, slot.d_index);
+    return block + FlatUtil::slotOffset(slot.d_index);
+}
+
+inline
+int Encoder::encodeSimple(const Encoder_Slot& slot, bool value)
+{
+    FlatUtil::putValue(slotAddress(slot), value);
+    return 0;
+}
+
+inline
+int Encoder::encodeSimple(const Encoder_Slot& slot, char value)
+{
+    FlatUtil::putValue(slotAddress(slot), value);
+    return 0;
+}
+
+inline
+int Encoder::encodeSimple(const Encoder_Slot& slot, signed char value)
+{
+    FlatUtil::putValue(slotAddress(slot), value);
+    return 0;
+}
+
+inline
+int Encoder::encodeSimple(const Encoder_Slot& slot, unsigned char value)
+{
+    FlatUtil::putValue(slotAddress(slot), value);
+    return 0;
+}
+
+inline
+int Encoder::encodeSimple(const Encoder_Slot& slot, short value)
+{
+    FlatUtil::putValue(slotAddress(slot), value);
+    return 0;
+}
+
+inline
+int Encoder::encodeSimple(const Encoder_Slot& slot, unsigned short value)
+{
+    FlatUtil::putValue(slotAddress(slot), value);
+    return 0;
+}
+
+inline
+int Encoder::encodeSimple(const Encoder_Slot& slot, int value)
+{
+    FlatUtil::putValue(slotAddress(slot), value);
+    return 0;
+}
+
+inline
+int Encoder::encodeSimple(const Encoder_Slot& slot, unsigned int value)
+{
+    FlatUtil::putValue(slotAddress(slot), value);
+    return 0;
+}
+
+inline
+int Encoder::encodeSimple(const Encoder_Slot& slot, bsls::Types::Int64 value)
+{
+    FlatUtil::putValue(slotAddress(slot), value);
+    return 0;
+}
+
+inline
+int Encoder::encodeSimple(const Encoder_Slot& slot, bsls::Types::Uint64 value)
+{
+    FlatUtil::putValue(slotAddress(slot), value);
+    return 0;
+}
+
+inline
+int Encoder::encodeSimple(const Encoder_Slot& slot, float value)
+{
+    FlatUtil::putValue(slotAddress(slot), value);
+    return 0;
+}
+
+inline
+int Encoder::encodeSimple(const Encoder_Slot& slot, double value)
+{
+    FlatUtil::putValue(slotAddress(slot), value);
+    return 0;
+}
+
+inline
+int Encoder::encodeSimple(const Encoder_Slot& slot, const bsl::string& value)
+{
+    return putBytes(slot, value.data(), value.size());
+}
+
+inline
+int Encoder::encodeSimple(const Encoder_Slot& slot, const bdlt::Date& value)
+{
+    FlatUtil::putValue(slotAddress(slot), value);
+    return 0;
+}
+
+inline
+int Encoder::encodeSimple(const Encoder_Slot& slot, const bdlt::Time& value)
+{
+    FlatUtil::putValue(slotAddress(slot), value);
+    return 0;
+}
+
+inline
+int Encoder::encodeSimple(const Encoder_Slot&   slot,
+                          const bdlt::Datetime& value)
+{
+    FlatUtil::putValue(slotAddress(slot), value);
+    return 0;
+}
+
+inline
+int Encoder::encodeSimple(const Encoder_Slot& slot, const bdlt::DateTz& value)
+{
+    return putTz(slot, value);
+}
+
+inline
+int Encoder::encodeSimple(const Encoder_Slot& slot, const bdlt::TimeTz& value)
+{
+    return putTz(slot, value);
+}
+
+inline
+int Encoder::encodeSimple(const Encoder_Slot&     slot,
+                          const bdlt::DatetimeTz& value)
+{
+    return putTz(slot, value);
+}
+
+// MANIPULATORS
+template <class TYPE>
+int Encoder::encode(bsl::vector<char> *buffer, const TYPE& value)
+{
+    BSLS_ASSERT(buffer);
+
+    typedef typename bdlat_TypeCategory::Select<TYPE>::Type Category;
+
+    buffer->clear();
+    d_output_p = buffer;
+    const int rc = encodeBlock(value, Category());
+    d_output_p = 0;
+    return rc;
+}
+
+template <class TYPE>
+int Encoder::encode(bsl::streambuf *streamBuf, const TYPE& value)
+{
+    BSLS_ASSERT(streamBuf);
+
+    if (0 != encode(&d_buffer, value)) {
+        return -1;                                                    // RETURN
+    }
+
+    const bsl::streamsize size = static_cast<bsl::streamsize>(d_buffer.size());
+    return size == streamBuf->sputn(d_buffer.data(), size) ? 0 : -1;
+}
+
+                     // ----------------------------------
+                     // private class Encoder_SlotVisitor
+                     // ----------------------------------
+
+// CREATORS
+inline
+Encoder_SlotVisitor::Encoder_SlotVisitor(Encoder      *encoder,
+                                         bsl::size_t   block,
+                                         unsigned int  numSlots)
+: d_encoder_p(encoder)
+{
+    d_slot.d_block  = block;
+    d_slot.d_bitmap = block + FlatUtil::bitmapOffset(numSlots);
+    d_slot.d_index  = 0;
+}
+
+// MANIPULATORS
+template <class TYPE, class INFO>
+inline
+int Encoder_SlotVisitor::operator()(const TYPE& value, const INFO&)
+{
+    return this->operator()(value);
+}
+
+template <class TYPE>
+inline
+int Encoder_SlotVisitor::operator()(const TYPE& value)
+{
+    typedef typename bdlat_TypeCategory::Select<TYPE>::Type Category;
+
+    const int rc = d_encoder_p->encodeSlot(d_slot, value, Category());
+    ++d_slot.d_index;
+    return rc;
+}
+
+                   // --------------------------------------
+                   // private struct Encoder_AttributeCounter
+                   // --------------------------------------
+
+// MANIPULATORS
+template <class TYPE, class INFO>
+inline
+int Encoder_AttributeCounter::operator()(const TYPE&, const INFO&)
+{
+    ++d_count;
+    return 0;
+}
+
+                     // ----------------------------------
+                     // private struct Encoder_EncodeProxy
+                     // ----------------------------------
+
+// MANIPULATORS
+template <class TYPE>
+inline
+int Encoder_EncodeProxy::operator()(const TYPE&, bslmf::Nil)
+{
+    BSLS_ASSERT_SAFE(0);
+    return -1;
+}
+
+template <class TYPE, class CATEGORY>
+inline
+int Encoder_EncodeProxy::operator()(const TYPE& value, CATEGORY category)
+{
+    return d_slot_p ? d_encoder_p->encodeSlot(*d_slot_p, value, category)
+                    : d_encoder_p->encodeBlock(value, category);
+}
+
+template <class TYPE>
+inline
+int Encoder_EncodeProxy::operator()(const TYPE& value)
+{
+    typedef typename bdlat_TypeCategory::Select<TYPE>::Type Category;
+
+    return this->operator()(value, Category());
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,863 @@
+// balflt_encoder.t.cpp                                               -*-C++-*-
+#include <balflt_encoder.h>
+
+#include <balflt_flatutil.h>
+#include <balflt_recordref.h>
+
+#include <balb_testmessages.h>
+
+#include <bdldfp_decimal.h>
+
+#include <bdlsb_fixedmemoutstreambuf.h>
+#include <bdlsb_memoutstreambuf.h>
+
+#include <bdlt_date.h>
+#include <bdlt_datetime.h>
+#include <bdlt_datetimetz.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+#include <bslstl_stringref.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                              TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is an encoder of 'bdlat'-conforming types.  We
+// encode values of the generated types of 'balb_testmessages', and verify the
+// encoding byte-by-byte for small values, and by reading every field back in
+// place (using 'balflt::RecordRef', tested independently) for larger ones.
+// We also verify that values of unsupported types are rejected, and that
+// encoding to a 'streambuf' produces the same bytes as encoding to a vector.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 6] explicit Encoder(bslma::Allocator *basicAllocator = 0);
+// [ 6] ~Encoder();
+//
+// MANIPULATORS
+// [ 2] int encode(bsl::vector<char> *buffer, const TYPE& value);
+// [ 3] int encode(bsl::vector<char> *buffer, const TYPE& value);
+// [ 4] int encode(bsl::vector<char> *buffer, const TYPE& value);
+// [ 5] int encode(bsl::vector<char> *buffer, const TYPE& value);
+// [ 6] int encode(bsl::streambuf *streamBuf, const TYPE& value);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                     NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+#define ASSERT_PASS_RAW(EXPR)  BSLS_ASSERTTEST_ASSERT_PASS_RAW(EXPR)
+#define ASSERT_FAIL_RAW(EXPR)  BSLS_ASSERTTEST_ASSERT_FAIL_RAW(EXPR)
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef balflt::Encoder     Obj;
+typedef balflt::RecordRef   RecordRef;
+typedef balflt::ChoiceRef   ChoiceRef;
+typedef balflt::FlatUtil    Util;
+typedef bsls::Types::Int64  Int64;
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+bool isWellFormed(const char *block)
+    // Return 'true' if the length of the block at the specified 'block'
+    // address, and the offset of 'block' relative to the (8-byte aligned)
+    // start of the encoding, are multiples of 8, and 'false' otherwise.
+{
+    return 0 == Util::getUint32(block) % Util::k_ALIGNMENT
+        && 0 == reinterpret_cast<bsls::Types::UintPtr>(block)
+                                                          % Util::k_ALIGNMENT;
+}
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator         da("default", veryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Encoding a Request
+///- - - - - - - - - - - - - - -
+// Suppose that we want to encode a value of the generated sequence type
+// 'balb::SimpleRequest', having the attributes 'data' (a 'bsl::string') and
+// 'responseLength' (an 'int'):
+//..
+    balb::SimpleRequest request;
+    request.data()           = "Hello, world";
+    request.responseLength() = 42;
+//..
+// First, we create an encoder, and encode 'request' into a buffer:
+//..
+    balflt::Encoder   encoder;
+    bsl::vector<char> buffer;
+
+    int rc = encoder.encode(&buffer, request);
+    ASSERT(0 == rc);
+//..
+// Then, we observe that the encoding consists of the fixed part of a block
+// having 2 slots (8 bytes of header, 2 slots, and 8 bytes of presence bitmap),
+// followed by the characters of 'data' (padded to a multiple of 8 bytes):
+//..
+    ASSERT(8 + 2 * 8 + 8 + 16 == buffer.size());
+//..
+// Finally, we read 'responseLength' in place, without decoding 'request' (see
+// 'balflt_recordref'):
+//..
+    balflt::RecordRef record;
+    rc = record.reset(buffer.data(), buffer.size());
+    ASSERT(0 == rc);
+
+    int responseLength;
+    rc = record.getValue(&responseLength,
+                         balb::SimpleRequest::ATTRIBUTE_INDEX_RESPONSE_LENGTH);
+    ASSERT(0  == rc);
+    ASSERT(42 == responseLength);
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // ENCODING TO A 'streambuf'
+        //
+        // Concerns:
+        //: 1 Encoding to a 'streambuf' writes the same bytes as encoding to a
+        //:   vector.
+        //:
+        //: 2 Encoding fails if the 'streambuf' does not accept every byte.
+        //:
+        //: 3 The memory used to encode to a 'streambuf' is supplied by the
+        //:   allocator supplied at construction, and is reused.
+        //
+        // Plan:
+        //: 1 Encode a value to a vector and to a 'bdlsb::MemOutStreamBuf',
+        //:   and compare the results.  (C-1)
+        //:
+        //: 2 Encode a value to a 'bdlsb::FixedMemOutStreamBuf' one byte too
+        //:   small, and verify that encoding fails.  (C-2)
+        //:
+        //: 3 Use test allocators to verify that the default allocator is not
+        //:   used, and that encoding a second time does not allocate.  (C-3)
+        //
+        // Testing:
+        //   explicit Encoder(bslma::Allocator *basicAllocator = 0);
+        //   ~Encoder();
+        //   int encode(bsl::streambuf *streamBuf, const TYPE& value);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ENCODING TO A 'streambuf'" << endl
+                          << "=========================" << endl;
+
+        bslma::TestAllocator oa("object",  veryVerbose);
+        bslma::TestAllocator sa("scratch", veryVerbose);
+
+        balb::SimpleRequest request(&sa);
+        request.data()           = "a string long enough to allocate";
+        request.responseLength() = 7;
+
+        bsl::vector<char> expected(&sa);
+        {
+            Obj mX(&sa);
+            ASSERT(0 == mX.encode(&expected, request));
+        }
+
+        const Int64 NUM_DEFAULT = da.numAllocations();
+        {
+            Obj mX(&oa);
+
+            bdlsb::MemOutStreamBuf streamBuf(&sa);
+            ASSERT(0 == mX.encode(&streamBuf, request));
+            ASSERT(expected.size() == streamBuf.length());
+            ASSERT(0 == bsl::memcmp(expected.data(),
+                                    streamBuf.data(),
+                                    expected.size()));
+            ASSERT(0 <  oa.numAllocations());
+
+            const Int64 NUM_OBJECT = oa.numAllocations();
+
+            bsl::vector<char> small(expected.size() - 1, '\0', &sa);
+            bdlsb::FixedMemOutStreamBuf fixed(small.data(), small.size());
+            ASSERT(0 != mX.encode(&fixed, request));
+            ASSERT(NUM_OBJECT == oa.numAllocations());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(NUM_DEFAULT == da.numAllocations());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // UNSUPPORTED TYPES
+        //
+        // Concerns:
+        //: 1 Encoding a value that is not a sequence, a choice, or an array
+        //:   (or a customized type based on one) fails.
+        //:
+        //: 2 Encoding a value having an element of an unsupported simple type
+        //:   fails.
+        //
+        // Plan:
+        //: 1 Encode an 'int', a 'bsl::string', and a customized type based on
+        //:   'bsl::string', and verify that encoding fails.  (C-1)
+        //:
+        //: 2 Encode a 'bsl::vector<bdldfp::Decimal64>', and verify that
+        //:   encoding fails.  (C-2)
+        //
+        // Testing:
+        //   int encode(bsl::vector<char> *buffer, const TYPE& value);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "UNSUPPORTED TYPES" << endl
+                          << "=================" << endl;
+
+        Obj               mX;
+        bsl::vector<char> buffer;
+
+        ASSERT(0 != mX.encode(&buffer, 5));
+        ASSERT(0 != mX.encode(&buffer, bsl::string("abc")));
+        ASSERT(0 != mX.encode(&buffer, balb::CustomString("abc")));
+        ASSERT(0 != mX.encode(&buffer, balb::Enumerated::LONDON));
+
+        bsl::vector<bdldfp::Decimal64> decimals;
+        ASSERT(0 == mX.encode(&buffer, decimals));
+
+        decimals.push_back(BDLDFP_DECIMAL_DD(1.5));
+        ASSERT(0 != mX.encode(&buffer, decimals));
+
+        bsl::vector<int> ints(3, 4);
+        ASSERT(0 == mX.encode(&buffer, ints));
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // ARRAYS, NESTED VALUES, AND CUSTOMIZED TYPES
+        //
+        // Concerns:
+        //: 1 An array attribute is encoded as a nested block whose fields are
+        //:   its elements, except for a 'bsl::vector<char>', which is encoded
+        //:   as bytes.
+        //:
+        //: 2 A sequence attribute is encoded as a nested block, and a choice
+        //:   attribute as a nested block having the selection id as its word.
+        //:
+        //: 3 A null element of an array is represented by a clear presence
+        //:   bit.
+        //:
+        //: 4 A customized type is encoded as its base type, and an
+        //:   enumeration as its 'int' value.
+        //:
+        //: 5 Every nested block starts at an 8-byte boundary, has a length
+        //:   that is a multiple of 8, and is contained in its enclosing block.
+        //
+        // Plan:
+        //: 1 Encode a 'balb::Sequence4' having a value in every attribute,
+        //:   and read every attribute in place.  (C-1..2, 4..5)
+        //:
+        //: 2 Encode a 'balb::Sequence5' having arrays of nullable values,
+        //:   some of them null, and read every element in place.  (C-3)
+        //
+        // Testing:
+        //   int encode(bsl::vector<char> *buffer, const TYPE& value);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ARRAYS, NESTED VALUES, AND CUSTOMIZED TYPES"
+                          << endl
+                          << "==========================================="
+                          << endl;
+
+        typedef balb::Sequence3 S3;
+        typedef balb::Sequence4 S4;
+        typedef balb::Sequence5 S5;
+
+        const bdlt::DatetimeTz DTTZ(bdlt::Datetime(2026, 10, 19, 8, 30),
+                                    -240);
+
+        S4 value;
+        {
+            balb::Sequence3 s3;
+            s3.element1().push_back(balb::Enumerated::NEW_JERSEY);
+            s3.element2().push_back("in sequence 3");
+            value.element1().push_back(s3);
+
+            balb::Choice1 c1;
+            c1.makeSelection2(0.5);
+            value.element2().push_back(c1);
+            value.element2().push_back(balb::Choice1());
+
+            value.element3().makeValue(bsl::vector<char>(3, 'x'));
+            value.element5().makeValue(DTTZ);
+            value.element6().makeValue(balb::CustomString("custom"));
+            value.element7().makeValue(balb::Enumerated::LONDON);
+            value.element8()  = true;
+            value.element9()  = "nine";
+            value.element10() = 10.5;
+            value.element11() = bsl::vector<char>(11, 'b');
+            value.element12() = 12;
+            value.element13() = balb::Enumerated::NEW_JERSEY;
+            value.element14().push_back(true);
+            value.element14().push_back(false);
+            value.element15().push_back(15.25);
+            value.element16().push_back(bsl::vector<char>(16, 'c'));
+            value.element17().push_back(170);
+            value.element17().push_back(171);
+            value.element18().push_back(DTTZ);
+            value.element19().push_back(balb::CustomString("nineteen"));
+        }
+
+        Obj               mX;
+        bsl::vector<char> buffer;
+        ASSERT(0 == mX.encode(&buffer, value));
+        ASSERT(isWellFormed(buffer.data()));
+        ASSERT(buffer.size() == Util::getUint32(buffer.data()));
+
+        RecordRef record;
+        ASSERT(0  == record.reset(buffer.data(), buffer.size()));
+        ASSERT(19 == record.numFields());
+
+        if (verbose) cout << "\nArrays of sequences and choices." << endl;
+        {
+            RecordRef array;
+            ASSERT(0 == record.getValue(&array, S4::ATTRIBUTE_INDEX_ELEMENT1));
+            ASSERT(isWellFormed(array.data()));
+            ASSERT(1 == array.numFields());
+
+            RecordRef s3;
+            ASSERT(0 == array.getValue(&s3, 0));
+            ASSERT(isWellFormed(s3.data()));
+
+            RecordRef enums;
+            int       enumValue;
+            ASSERT(0 == s3.getValue(&enums, S3::ATTRIBUTE_INDEX_ELEMENT1));
+            ASSERT(0 == enums.getValue(&enumValue, 0));
+            ASSERT(balb::Enumerated::NEW_JERSEY == enumValue);
+
+            RecordRef         strings;
+            bslstl::StringRef string;
+            ASSERT(0 == s3.getValue(&strings, S3::ATTRIBUTE_INDEX_ELEMENT2));
+            ASSERT(0 == strings.getValue(&string, 0));
+            ASSERT("in sequence 3" == string);
+            ASSERT(s3.isNull(S3::ATTRIBUTE_INDEX_ELEMENT3));
+
+            ASSERT(0 == record.getValue(&array, S4::ATTRIBUTE_INDEX_ELEMENT2));
+            ASSERT(2 == array.numFields());
+
+            ChoiceRef choice;
+            double    selection;
+            ASSERT(0   == array.getValue(&choice, 0));
+            ASSERT(balb::Choice1::SELECTION_ID_SELECTION2 ==
+                                                        choice.selectionId());
+            ASSERT(0   == choice.getSelection(&selection));
+            ASSERT(0.5 == selection);
+
+            ASSERT(0   == array.getValue(&choice, 1));
+            ASSERT(-1  == choice.selectionId());
+            ASSERT(choice.record().isNull(0));
+        }
+
+        if (verbose) cout << "\nNullable and scalar attributes." << endl;
+        {
+            bslstl::StringRef bytes;
+            ASSERT(0 == record.getValue(&bytes, S4::ATTRIBUTE_INDEX_ELEMENT3));
+            ASSERT("xxx" == bytes);
+
+            ASSERT(record.isNull(S4::ATTRIBUTE_INDEX_ELEMENT4));
+
+            bdlt::DatetimeTz dttz;
+            ASSERT(0 == record.getValue(&dttz, S4::ATTRIBUTE_INDEX_ELEMENT5));
+            ASSERT(DTTZ == dttz);
+
+            bsl::string string;
+            ASSERT(0 == record.getValue(&string,
+                                        S4::ATTRIBUTE_INDEX_ELEMENT6));
+            ASSERT("custom" == string);
+
+            int intValue;
+            ASSERT(0 == record.getValue(&intValue,
+                                        S4::ATTRIBUTE_INDEX_ELEMENT7));
+            ASSERT(balb::Enumerated::LONDON == intValue);
+
+            bool boolValue;
+            ASSERT(0 == record.getValue(&boolValue,
+                                        S4::ATTRIBUTE_INDEX_ELEMENT8));
+            ASSERT(true == boolValue);
+
+            ASSERT(0 == record.getValue(&string,
+                                        S4::ATTRIBUTE_INDEX_ELEMENT9));
+            ASSERT("nine" == string);
+
+            double doubleValue;
+            ASSERT(0 == record.getValue(&doubleValue,
+                                        S4::ATTRIBUTE_INDEX_ELEMENT10));
+            ASSERT(10.5 == doubleValue);
+
+            ASSERT(0 == record.getValue(&string,
+                                        S4::ATTRIBUTE_INDEX_ELEMENT11));
+            ASSERT(bsl::string(11, 'b') == string);
+
+            ASSERT(0 == record.getValue(&intValue,
+                                        S4::ATTRIBUTE_INDEX_ELEMENT12));
+            ASSERT(12 == intValue);
+
+            ASSERT(0 == record.getValue(&intValue,
+                                        S4::ATTRIBUTE_INDEX_ELEMENT13));
+            ASSERT(balb::Enumerated::NEW_JERSEY == intValue);
+        }
+
+        if (verbose) cout << "\nArrays of simple values." << endl;
+        {
+            RecordRef array;
+            bool      boolValue;
+            ASSERT(0 == record.getValue(&array,
+                                        S4::ATTRIBUTE_INDEX_ELEMENT14));
+            ASSERT(2 == array.numFields());
+            ASSERT(0 == array.getValue(&boolValue, 0));
+            ASSERT(true == boolValue);
+            ASSERT(0 == array.getValue(&boolValue, 1));
+            ASSERT(false == boolValue);
+
+            double doubleValue;
+            ASSERT(0 == record.getValue(&array,
+                                        S4::ATTRIBUTE_INDEX_ELEMENT15));
+            ASSERT(0 == array.getValue(&doubleValue, 0));
+            ASSERT(15.25 == doubleValue);
+
+            bslstl::StringRef bytes;
+            ASSERT(0 == record.getValue(&array,
+                                        S4::ATTRIBUTE_INDEX_ELEMENT16));
+            ASSERT(0 == array.getValue(&bytes, 0));
+            ASSERT(bsl::string(16, 'c') == bytes);
+
+            int intValue;
+            ASSERT(0 == record.getValue(&array,
+                                        S4::ATTRIBUTE_INDEX_ELEMENT17));
+            ASSERT(2 == array.numFields());
+            ASSERT(0 == array.getValue(&intValue, 1));
+            ASSERT(171 == intValue);
+
+            bdlt::DatetimeTz dttz;
+            ASSERT(0 == record.getValue(&array,
+                                        S4::ATTRIBUTE_INDEX_ELEMENT18));
+            ASSERT(0 == array.getValue(&dttz, 0));
+            ASSERT(DTTZ == dttz);
+
+            ASSERT(0 == record.getValue(&array,
+                                        S4::ATTRIBUTE_INDEX_ELEMENT19));
+            ASSERT(0 == array.getValue(&bytes, 0));
+            ASSERT("nineteen" == bytes);
+        }
+
+        if (verbose) cout << "\nArrays of nullable values." << endl;
+        {
+            S5 s5;
+            s5.element5().resize(3);
+            s5.element5()[1].makeValue(51);
+            s5.element3().resize(2);
+            s5.element3()[0].makeValue(3.5);
+
+            ASSERT(0 == mX.encode(&buffer, s5));
+            ASSERT(0 == record.reset(buffer.data(), buffer.size()));
+
+            RecordRef array;
+            int       intValue;
+            ASSERT(0 == record.getValue(&array,
+                                        S5::ATTRIBUTE_INDEX_ELEMENT5));
+            ASSERT(3 == array.numFields());
+            ASSERT(array.isNull(0));
+            ASSERT(0 == array.getValue(&intValue, 1));
+            ASSERT(51 == intValue);
+            ASSERT(array.isNull(2));
+
+            double doubleValue;
+            ASSERT(0 == record.getValue(&array,
+                                        S5::ATTRIBUTE_INDEX_ELEMENT3));
+            ASSERT(2 == array.numFields());
+            ASSERT(0 == array.getValue(&doubleValue, 0));
+            ASSERT(3.5 == doubleValue);
+            ASSERT(array.isNull(1));
+
+            // An empty array is a block having no slots.
+
+            ASSERT(0 == record.getValue(&array,
+                                        S5::ATTRIBUTE_INDEX_ELEMENT2));
+            ASSERT(0 == array.numFields());
+            ASSERT(8 == array.length());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CHOICES AND NULLABLE VALUES
+        //
+        // Concerns:
+        //: 1 A choice is encoded as a block having one slot, holding its
+        //:   selection, and having the selection id as its word.
+        //:
+        //: 2 A choice having no selection is encoded as a block whose single
+        //:   slot is absent, and having the word '0xFFFFFFFF'.
+        //:
+        //: 3 A null nullable value is represented by a clear presence bit and
+        //:   a zero slot, and a non-null one as its value.
+        //
+        // Plan:
+        //: 1 Encode a 'balb::Choice2' for each of its selections, and for no
+        //:   selection, and verify the header and slot.  (C-1..2)
+        //:
+        //: 2 Encode a 'balb::Sequence2' having its nullable attributes null,
+        //:   and then non-null, and verify the presence bits.  (C-3)
+        //
+        // Testing:
+        //   int encode(bsl::vector<char> *buffer, const TYPE& value);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CHOICES AND NULLABLE VALUES" << endl
+                          << "===========================" << endl;
+
+        Obj               mX;
+        bsl::vector<char> buffer;
+
+        if (verbose) cout << "\nChoices." << endl;
+        {
+            balb::Choice2 choice;
+
+            ASSERT(0 == mX.encode(&buffer, choice));
+            ASSERT(Util::fixedSize(1) == buffer.size());
+            ASSERT(0xFFFFFFFF == Util::getUint32(buffer.data() + 4));
+            ASSERT(!Util::isPresent(buffer.data() + Util::bitmapOffset(1), 0));
+
+            choice.makeSelection1(true);
+            ASSERT(0 == mX.encode(&buffer, choice));
+            ASSERT(Util::fixedSize(1) == buffer.size());
+            ASSERT(balb::Choice2::SELECTION_ID_SELECTION1 ==
+                                     (int)Util::getUint32(buffer.data() + 4));
+            ASSERT(Util::isPresent(buffer.data() + Util::bitmapOffset(1), 0));
+            ASSERT(1 == Util::getUint64(buffer.data() + Util::slotOffset(0)));
+
+            choice.makeSelection2("choice");
+            ASSERT(0 == mX.encode(&buffer, choice));
+            ASSERT(Util::fixedSize(1) + 8 == buffer.size());
+            ASSERT(balb::Choice2::SELECTION_ID_SELECTION2 ==
+                                     (int)Util::getUint32(buffer.data() + 4));
+
+            ChoiceRef         ref;
+            bslstl::StringRef selection;
+            ASSERT(0 == ref.reset(buffer.data(), buffer.size()));
+            ASSERT(0 == ref.getSelection(&selection));
+            ASSERT("choice" == selection);
+        }
+
+        if (verbose) cout << "\nNullable values." << endl;
+        {
+            typedef balb::Sequence2 S2;
+
+            const int NULL_INDEX[] = { S2::ATTRIBUTE_INDEX_ELEMENT4,
+                                       S2::ATTRIBUTE_INDEX_ELEMENT5 };
+
+            S2 value;
+            value.element1() = balb::CustomString("s");
+            value.element2() = 'u';
+
+            ASSERT(0 == mX.encode(&buffer, value));
+
+            RecordRef record;
+            ASSERT(0 == record.reset(buffer.data(), buffer.size()));
+            ASSERT(5 == record.numFields());
+            for (int i = 0; i < 2; ++i) {
+                const int INDEX = NULL_INDEX[i];
+
+                ASSERTV(INDEX, record.isNull(INDEX));
+                ASSERTV(INDEX, 0 == Util::getUint64(buffer.data()
+                                                  + Util::slotOffset(INDEX)));
+            }
+            ASSERT(!record.isNull(S2::ATTRIBUTE_INDEX_ELEMENT1));
+            ASSERT(!record.isNull(S2::ATTRIBUTE_INDEX_ELEMENT2));
+            ASSERT(!record.isNull(S2::ATTRIBUTE_INDEX_ELEMENT3));
+
+            value.element4().makeValue().makeSelection1(4);
+            value.element5().makeValue(5.5);
+
+            ASSERT(0 == mX.encode(&buffer, value));
+            ASSERT(0 == record.reset(buffer.data(), buffer.size()));
+            for (int i = 0; i < 2; ++i) {
+                ASSERTV(NULL_INDEX[i], !record.isNull(NULL_INDEX[i]));
+            }
+
+            ChoiceRef choice;
+            int       selection;
+            double    element5;
+            ASSERT(0 == record.getValue(&choice,
+                                        S2::ATTRIBUTE_INDEX_ELEMENT4));
+            ASSERT(0 == choice.getSelection(&selection));
+            ASSERT(4 == selection);
+            ASSERT(0 == record.getValue(&element5,
+                                        S2::ATTRIBUTE_INDEX_ELEMENT5));
+            ASSERT(5.5 == element5);
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // LAYOUT
+        //
+        // Concerns:
+        //: 1 A sequence is encoded as a header holding the length of the block
+        //:   and the number of attributes, one 8-byte slot per attribute, in
+        //:   the order of the attributes, and a presence bitmap.
+        //:
+        //: 2 A fixed-size value is stored in its slot, zero-extended to 8
+        //:   bytes.
+        //:
+        //: 3 A variable-size value is stored after the fixed part of its
+        //:   block, at an 8-byte boundary, and its slot holds its offset from
+        //:   the start of the block and its length.
+        //:
+        //: 4 The length of the encoding is a multiple of 8, the padding being
+        //:   zero.
+        //:
+        //: 5 The buffer is cleared before encoding.
+        //
+        // Plan:
+        //: 1 Encode a 'balb::VoidSequence' and a 'balb::UnsignedSequence' into
+        //:   a non-empty buffer, and compare the result with the expected
+        //:   bytes.  (C-1..2, 5)
+        //:
+        //: 2 Encode a 'balb::SimpleRequest', and compare the result with the
+        //:   expected bytes.  (C-3..4)
+        //
+        // Testing:
+        //   int encode(bsl::vector<char> *buffer, const TYPE& value);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "LAYOUT" << endl
+                          << "======" << endl;
+
+        Obj               mX;
+        bsl::vector<char> buffer(5, 'z');
+
+        {
+            const char EXPECTED[] = { 8, 0, 0, 0, 0, 0, 0, 0 };
+
+            ASSERT(0 == mX.encode(&buffer, balb::VoidSequence()));
+            ASSERT(sizeof EXPECTED == buffer.size());
+            ASSERT(0 == bsl::memcmp(EXPECTED, buffer.data(), buffer.size()));
+        }
+        {
+            balb::UnsignedSequence value;
+            value.element1() = 0x89ABCDEF;
+            value.element2() = 0x1234;
+            value.element3() = 0x0102030405060708ULL;
+
+            const unsigned char EXPECTED[] = {
+                40,   0,    0,    0,    3,    0,    0,    0,
+                0xEF, 0xCD, 0xAB, 0x89, 0,    0,    0,    0,
+                0x34, 0x12, 0,    0,    0,    0,    0,    0,
+                8,    7,    6,    5,    4,    3,    2,    1,
+                7,    0,    0,    0,    0,    0,    0,    0,
+            };
+
+            ASSERT(0 == mX.encode(&buffer, value));
+            ASSERT(sizeof EXPECTED == buffer.size());
+            ASSERT(0 == bsl::memcmp(EXPECTED, buffer.data(), buffer.size()));
+        }
+        {
+            balb::SimpleRequest value;
+            value.data()           = "0123456789";
+            value.responseLength() = -2;
+
+            const unsigned char EXPECTED[] = {
+                48,   0,    0,    0,    2,    0,    0,    0,
+                32,   0,    0,    0,    10,   0,    0,    0,
+                0xFE, 0xFF, 0xFF, 0xFF, 0,    0,    0,    0,
+                3,    0,    0,    0,    0,    0,    0,    0,
+                '0',  '1',  '2',  '3',  '4',  '5',  '6',  '7',
+                '8',  '9',  0,    0,    0,    0,    0,    0,
+            };
+
+            ASSERT(0 == mX.encode(&buffer, value));
+            ASSERT(sizeof EXPECTED == buffer.size());
+            ASSERT(0 == bsl::memcmp(EXPECTED, buffer.data(), buffer.size()));
+
+            // An empty string is stored as a zero-length reference.
+
+            value.data().clear();
+            ASSERT(0 == mX.encode(&buffer, value));
+            ASSERT(Util::fixedSize(2) == buffer.size());
+            ASSERT(0 == Util::getUint64(buffer.data() + Util::slotOffset(0)));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Encode a 'balb::SimpleRequest', and read its attributes in place.
+        //:   (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        balb::SimpleRequest request;
+        request.data()           = "breathing";
+        request.responseLength() = 3;
+
+        Obj               mX;
+        bsl::vector<char> buffer;
+        ASSERT(0 == mX.encode(&buffer, request));
+
+        RecordRef record;
+        ASSERT(0 == record.reset(buffer.data(), buffer.size()));
+        ASSERT(2 == record.numFields());
+
+        bsl::string data;
+        int         responseLength;
+        ASSERT(0 == record.getValue(&data, 0));
+        ASSERT(0 == record.getValue(&responseLength, 1));
+        ASSERT("breathing" == data);
+        ASSERT(3 == responseLength);
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,251 @@
+// balflt_flatutil.cpp                                                -*-C++-*-
+#include <balflt_flatutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(balflt_flatutil_cpp,"$Id$ $CSID$")
+
+#include <bdlt_datetimeinterval.h>
+#include <bdlt_timeunitratio.h>
+
+namespace BloombergLP {
+namespace balflt {
+
+namespace {
+namespace u {
+
+typedef bsls::Types::Int64 Int64;
+
+const Int64 k_US_PER_D = bdlt::TimeUnitRatio::k_US_PER_D;
+
+const int k_MAX_DAYS = 3652060;
+    // 'bdlt::Date(9999, 12, 31) - bdlt::Date()'
+
+const Int64 k_DEFAULT_TIME = -1;
+    // representation of the default (24:00) 'bdlt::Time' and 'bdlt::Datetime'
+    // values
+
+const int k_OFFSET_INDEX = 8;
+    // index of the offset in the representation of time zone-aware values
+
+Int64 toMicroseconds(const bdlt::Time& value)
+    // Return the number of microseconds since midnight of the specified
+    // 'value', or 'k_DEFAULT_TIME' if 'value' is 24:00.
+{
+    if (24 == value.hour()) {
+        return k_DEFAULT_TIME;                                        // RETURN
+    }
+    return (value - bdlt::Time(0, 0)).totalMicroseconds();
+}
+
+Int64 toMicroseconds(const bdlt::Datetime& value)
+    // Return the number of microseconds since 0001/01/01T00:00 of the
+    // specified 'value', or 'k_DEFAULT_TIME' if the time of 'value' is 24:00.
+{
+    if (24 == value.hour()) {
+        return k_DEFAULT_TIME;                                        // RETURN
+    }
+    return static_cast<Int64>(value.date() - bdlt::Date()) * k_US_PER_D
+         + toMicroseconds(value.time());
+}
+
+int fromMicroseconds(bdlt::Time *result, Int64 microseconds)
+    // Load into the specified 'result' the time having the specified
+    // 'microseconds' since midnight, or 24:00 if 'microseconds' is
+    // 'k_DEFAULT_TIME'.  Return 0 on success, and a non-zero value if
+    // 'microseconds' is not in the range '[-1 .. k_US_PER_D)'.
+{
+    if (k_DEFAULT_TIME == microseconds) {
+        *result = bdlt::Time();
+        return 0;                                                     // RETURN
+    }
+    if (microseconds < 0 || microseconds >= k_US_PER_D) {
+        return -1;                                                    // RETURN
+    }
+    bdlt::Time time(0, 0);
+    time.addMicroseconds(microseconds);
+    *result = time;
+    return 0;
+}
+
+int fromMicroseconds(bdlt::Datetime *result, Int64 microseconds)
+    // Load into the specified 'result' the datetime having the specified
+    // 'microseconds' since 0001/01/01T00:00, or the default datetime if
+    // 'microseconds' is 'k_DEFAULT_TIME'.  Return 0 on success, and a non-zero
+    // value if 'microseconds' is not in the range of 'bdlt::Datetime'.
+{
+    if (k_DEFAULT_TIME == microseconds) {
+        *result = bdlt::Datetime();
+        return 0;                                                     // RETURN
+    }
+    if (microseconds < 0
+     || microseconds / k_US_PER_D > k_MAX_DAYS) {
+        return -1;                                                    // RETURN
+    }
+    bdlt::Time time(0, 0);
+    time.addMicroseconds(microseconds % k_US_PER_D);
+    *result = bdlt::Datetime(
+                    bdlt::Date() + static_cast<int>(microseconds / k_US_PER_D),
+                    time);
+    return 0;
+}
+
+void putOffset(char *buffer, int offset)
+    // Write the specified 'offset', and its padding, to the specified 'buffer'
+    // holding a time zone-aware value.
+{
+    FlatUtil::putUint64(buffer + k_OFFSET_INDEX,
+                        static_cast<unsigned int>(offset));
+}
+
+int getOffset(const char *buffer)
+    // Return the offset stored in the specified 'buffer' holding a time
+    // zone-aware value.
+{
+    return static_cast<int>(FlatUtil::getUint32(buffer + k_OFFSET_INDEX));
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+                              // ---------------
+                              // struct FlatUtil
+                              // ---------------
+
+// CLASS METHODS
+void FlatUtil::putValue(char *slot, const bdlt::Date& value)
+{
+    BSLS_ASSERT(slot);
+
+    putUint64(slot, static_cast<unsigned int>(value - bdlt::Date()));
+}
+
+void FlatUtil::putValue(char *slot, const bdlt::Time& value)
+{
+    BSLS_ASSERT(slot);
+
+    putUint64(slot, static_cast<Uint64>(u::toMicroseconds(value)));
+}
+
+void FlatUtil::putValue(char *slot, const bdlt::Datetime& value)
+{
+    BSLS_ASSERT(slot);
+
+    putUint64(slot, static_cast<Uint64>(u::toMicroseconds(value)));
+}
+
+void FlatUtil::putValue(char *buffer, const bdlt::DateTz& value)
+{
+    BSLS_ASSERT(buffer);
+
+    putValue(buffer, value.localDate());
+    u::putOffset(buffer, value.offset());
+}
+
+void FlatUtil::putValue(char *buffer, const bdlt::TimeTz& value)
+{
+    BSLS_ASSERT(buffer);
+
+    putValue(buffer, value.localTime());
+    u::putOffset(buffer, value.offset());
+}
+
+void FlatUtil::putValue(char *buffer, const bdlt::DatetimeTz& value)
+{
+    BSLS_ASSERT(buffer);
+
+    putValue(buffer, value.localDatetime());
+    u::putOffset(buffer, value.offset());
+}
+
+int FlatUtil::getValue(bdlt::Date *result, const char *slot)
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(slot);
+
+    const int days = static_cast<int>(getUint32(slot));
+    if (days < 0 || days > u::k_MAX_DAYS) {
+        return -1;                                                    // RETURN
+    }
+    *result = bdlt::Date() + days;
+    return 0;
+}
+
+int FlatUtil::getValue(bdlt::Time *result, const char *slot)
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(slot);
+
+    return u::fromMicroseconds(result, static_cast<Int64>(getUint64(slot)));
+}
+
+int FlatUtil::getValue(bdlt::Datetime *result, const char *slot)
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(slot);
+
+    return u::fromMicroseconds(result, static_cast<Int64>(getUint64(slot)));
+}
+
+int FlatUtil::getValue(bdlt::DateTz *result, const char *buffer)
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(buffer);
+
+    bdlt::Date date;
+    const int  offset = u::getOffset(buffer);
+    if (0 != getValue(&date, buffer)
+     || !bdlt::DateTz::isValid(date, offset)) {
+        return -1;                                                    // RETURN
+    }
+    result->setDateTz(date, offset);
+    return 0;
+}
+
+int FlatUtil::getValue(bdlt::TimeTz *result, const char *buffer)
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(buffer);
+
+    bdlt::Time time;
+    const int  offset = u::getOffset(buffer);
+    if (0 != getValue(&time, buffer)
+     || !bdlt::TimeTz::isValid(time, offset)) {
+        return -1;                                                    // RETURN
+    }
+    result->setTimeTz(time, offset);
+    return 0;
+}
+
+int FlatUtil::getValue(bdlt::DatetimeTz *result, const char *buffer)
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(buffer);
+
+    bdlt::Datetime datetime;
+    const int      offset = u::getOffset(buffer);
+    if (0 != getValue(&datetime, buffer)
+     || !bdlt::DatetimeTz::isValid(datetime, offset)) {
+        return -1;                                                    // RETURN
+    }
+    result->setDatetimeTz(datetime, offset);
+    return 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,551 @@
+// balflt_flatutil.h                                                  -*-C++-*-
+#ifndef INCLUDED_BALFLT_FLATUTIL
+#define INCLUDED_BALFLT_FLATUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide the layout and primitive values of the flat encoding.
+//
+//@CLASSES:
+//  balflt::FlatUtil: namespace for the flat encoding of blocks and values
+//
+//@SEE_ALSO: balflt_recordref, balflt_encoder, balflt_decoder
+//
+//@DESCRIPTION: This component provides a utility 'struct', 'balflt::FlatUtil',
+// that defines the layout of the "flat" encoding of 'bdlat'-conforming types,
+// and that provides functions to write and read the values of the fundamental
+// and date/time types in that encoding.
+//
+// The flat encoding places every attribute of a sequence at an offset that is
+// determined by the position of the attribute in the sequence (rather than by
+// the values of the preceding attributes, as in BER), so that an attribute can
+// be read in place, without decoding the rest of the encoded value.  Values
+// whose size varies (strings, arrays, and nested sequences and choices) are
+// stored after the fixed part of the enclosing value, and are referred to by
+// an offset and a length stored at the fixed position of the attribute.
+//
+///Encoding Format
+///---------------
+// All integers (and the bits of floating-point values) are stored in
+// little-endian byte order.  An encoded value is a *block* having the
+// following layout, where 'N' is the number of slots of the block:
+//..
+//  +---------+--------+-----------+---------+---------+-------------------+
+//  | length  | word   | slot 0    |   ...   | slot N-1| presence bitmap   |
+//  | uint32  | uint32 | 8 bytes   |         | 8 bytes | ceil(N/64)*8 bytes|
+//  +---------+--------+-----------+---------+---------+-------------------+
+//  | variable area (each value aligned on an 8-byte boundary)  ...        |
+//  +---------------------------------------------------------------------+
+//..
+// 'length' is the total size of the block (a multiple of 8), including the
+// variable area.  A sequence is encoded as a block having one slot per
+// attribute, in the order in which the attributes are visited by
+// 'bdlat_SequenceFunctions::accessAttributes', and 'word' is 'N'.  An array is
+// encoded as a block having one slot per element, and 'word' is 'N'.  A
+// choice is encoded as a block having a single slot, holding the selection,
+// and 'word' is the (signed) selection id ('-1' if no selection is made).
+//
+// Bit 'i % 64' of the 64-bit word 'i / 64' of the presence bitmap is set if
+// the value of slot 'i' is present (i.e., is not a null nullable value).  A
+// slot holds either:
+//: o a *fixed* value, stored at the start of the slot (the remaining bytes of
+//:   the slot being 0): 'bool', 'char', 'signed char', 'unsigned char' (1
+//:   byte), 'short', 'unsigned short' (2 bytes), 'int', 'unsigned int',
+//:   'float', 'bdlt::Date', enumerations (4 bytes), 'bsls::Types::Int64',
+//:   'bsls::Types::Uint64', 'double', 'bdlt::Time', and 'bdlt::Datetime' (8
+//:   bytes); or
+//:
+//: o a *reference* to a value in the variable area of the block, stored as a
+//:   'uint32' offset (from the start of the block) followed by a 'uint32'
+//:   length: 'bsl::string' and 'bsl::vector<char>' (the bytes of the value),
+//:   'bdlt::DateTz', 'bdlt::TimeTz', and 'bdlt::DatetimeTz' (16 bytes, see
+//:   'k_TZ_VALUE_SIZE'), and arrays, sequences, and choices (a nested block).
+//
+// A 'bdlt::Date' is stored as the number of days since 0001/01/01, a
+// 'bdlt::Time' as the number of microseconds since midnight, and a
+// 'bdlt::Datetime' as the number of microseconds since 0001/01/01T00:00;
+// the default-constructed 'bdlt::Time' and 'bdlt::Datetime' values (whose
+// time is 24:00) are stored as -1.  The value of a time zone-aware type is
+// stored as the value of its local type, padded to 8 bytes, followed by the
+// offset (in minutes, as an 'int32') and 4 bytes of padding.
+//
+// Note that the format is not self-describing: a reader must know the type of
+// the encoded value, as in other fixed-layout formats such as Simple Binary
+// Encoding or FlatBuffers.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Writing and Reading a Block Header
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we want to lay out a block having 3 slots by hand.  First, we
+// compute the size of the fixed part of the block:
+//..
+//  assert(8 + 3 * 8 + 8 == balflt::FlatUtil::fixedSize(3));
+//
+//  char block[40] = { 0 };
+//..
+// Then, we write the header, and an 'int' value in the second slot:
+//..
+//  balflt::FlatUtil::putUint32(block, sizeof block);
+//  balflt::FlatUtil::putUint32(block + 4, 3);
+//  balflt::FlatUtil::putValue(block + balflt::FlatUtil::slotOffset(1), 42);
+//  balflt::FlatUtil::setPresent(block + balflt::FlatUtil::bitmapOffset(3), 1);
+//..
+// Finally, we read the value back:
+//..
+//  int value;
+//  balflt::FlatUtil::getValue(&value,
+//                             block + balflt::FlatUtil::slotOffset(1));
+//  assert(42 == value);
+//  const char *bitmap = block + balflt::FlatUtil::bitmapOffset(3);
+//  assert(true  == balflt::FlatUtil::isPresent(bitmap, 1));
+//  assert(false == balflt::FlatUtil::isPresent(bitmap, 2));
+//..
+
+#include <balscm_version.h>
+
+#include <bdlt_date.h>
+#include <bdlt_datetime.h>
+#include <bdlt_datetimetz.h>
+#include <bdlt_datetz.h>
+#include <bdlt_time.h>
+#include <bdlt_timetz.h>
+
+#include <bsls_assert.h>
+#include <bsls_byteorder.h>
+#include <bsls_types.h>
+
+#include <bsl_cstring.h>
+
+namespace BloombergLP {
+namespace balflt {
+
+                              // ===============
+                              // struct FlatUtil
+                              // ===============
+
+struct FlatUtil {
+    // This 'struct' provides a namespace for the constants defining the layout
+    // of the flat encoding, and for functions that write and read the values
+    // stored in that encoding.  See the component-level documentation for a
+    // description of the format.
+
+    // TYPES
+    typedef bsls::Types::Int64  Int64;
+    typedef bsls::Types::Uint64 Uint64;
+
+    // CONSTANTS
+    enum {
+        k_HEADER_SIZE    = 8,   // size of the header of a block
+        k_SLOT_SIZE      = 8,   // size of a slot
+        k_ALIGNMENT      = 8,   // alignment of blocks and variable values
+        k_TZ_VALUE_SIZE  = 16,  // size of a time zone-aware value
+        k_MAX_BLOCK_SIZE = 0x7FFFFFF8  // largest supported block
+    };
+
+    // CLASS METHODS
+    static Uint64 bitmapSize(Uint64 numSlots);
+        // Return the size of the presence bitmap of a block having the
+        // specified 'numSlots'.
+
+    static Uint64 bitmapOffset(Uint64 numSlots);
+        // Return the offset of the presence bitmap of a block having the
+        // specified 'numSlots'.
+
+    static Uint64 fixedSize(Uint64 numSlots);
+        // Return the size of the fixed part (header, slots, and presence
+        // bitmap) of a block having the specified 'numSlots'.
+
+    static Uint64 slotOffset(Uint64 index);
+        // Return the offset, from the start of a block, of the slot having the
+        // specified 'index'.
+
+    static Uint64 align(Uint64 size);
+        // Return the specified 'size' rounded up to a multiple of
+        // 'k_ALIGNMENT'.
+
+    static bool isPresent(const char *bitmap, Uint64 index);
+        // Return 'true' if the bit of the specified 'bitmap' for the slot
+        // having the specified 'index' is set, and 'false' otherwise.
+
+    static void setPresent(char *bitmap, Uint64 index);
+        // Set the bit of the specified 'bitmap' for the slot having the
+        // specified 'index'.
+
+    static unsigned int getUint32(const char *address);
+        // Return the little-endian 32-bit unsigned integer at the specified
+        // 'address'.
+
+    static Uint64 getUint64(const char *address);
+        // Return the little-endian 64-bit unsigned integer at the specified
+        // 'address'.
+
+    static void putUint32(char *address, unsigned int value);
+        // Write the specified 'value' as a little-endian 32-bit unsigned
+        // integer at the specified 'address'.
+
+    static void putUint64(char *address, Uint64 value);
+        // Write the specified 'value' as a little-endian 64-bit unsigned
+        // integer at the specified 'address'.
+
+    static void putValue(char *slot, bool               value);
+    static void putValue(char *slot, char               value);
+    static void putValue(char *slot, signed char        value);
+    static void putValue(char *slot, unsigned char      value);
+    static void putValue(char *slot, short              value);
+    static void putValue(char *slot, unsigned short     value);
+    static void putValue(char *slot, int                value);
+    static void putValue(char *slot, unsigned int       value);
+    static void putValue(char *slot, Int64              value);
+    static void putValue(char *slot, Uint64             value);
+    static void putValue(char *slot, float              value);
+    static void putValue(char *slot, double             value);
+    static void putValue(char *slot, const bdlt::Date&     value);
+    static void putValue(char *slot, const bdlt::Time&     value);
+    static void putValue(char *slot, const bdlt::Datetime& value);
+        // Write the specified fixed 'value' to the specified 'slot', and set
+        // the bytes of 'slot' not used by 'value' to 0.
+
+    static void putValue(char *buffer, const bdlt::DateTz&     value);
+    static void putValue(char *buffer, const bdlt::TimeTz&     value);
+    static void putValue(char *buffer, const bdlt::DatetimeTz& value);
+        // Write the specified time zone-aware 'value' to the 'k_TZ_VALUE_SIZE'
+        // bytes at the specified 'buffer'.
+
+    static int getValue(bool               *result, const char *slot);
+    static int getValue(char               *result, const char *slot);
+    static int getValue(signed char        *result, const char *slot);
+    static int getValue(unsigned char      *result, const char *slot);
+    static int getValue(short              *result, const char *slot);
+    static int getValue(unsigned short     *result, const char *slot);
+    static int getValue(int                *result, const char *slot);
+    static int getValue(unsigned int       *result, const char *slot);
+    static int getValue(Int64              *result, const char *slot);
+    static int getValue(Uint64             *result, const char *slot);
+    static int getValue(float              *result, const char *slot);
+    static int getValue(double             *result, const char *slot);
+    static int getValue(bdlt::Date         *result, const char *slot);
+    static int getValue(bdlt::Time         *result, const char *slot);
+    static int getValue(bdlt::Datetime     *result, const char *slot);
+        // Load into the specified 'result' the fixed value stored in the
+        // specified 'slot'.  Return 0 on success, and a non-zero value
+        // (with no effect on 'result') if the stored value does not represent
+        // a valid value of the type of 'result'.
+
+    static int getValue(bdlt::DateTz       *result, const char *buffer);
+    static int getValue(bdlt::TimeTz       *result, const char *buffer);
+    static int getValue(bdlt::DatetimeTz   *result, const char *buffer);
+        // Load into the specified 'result' the time zone-aware value stored in
+        // the 'k_TZ_VALUE_SIZE' bytes at the specified 'buffer'.  Return 0 on
+        // success, and a non-zero value (with no effect on 'result') if the
+        // stored value does not represent a valid value of the type of
+        // 'result'.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                              // ---------------
+                              // struct FlatUtil
+                              // ---------------
+
+// CLASS METHODS
+inline
+FlatUtil::Uint64 FlatUtil::bitmapSize(Uint64 numSlots)
+{
+    return (numSlots + 63) / 64 * 8;
+}
+
+inline
+FlatUtil::Uint64 FlatUtil::bitmapOffset(Uint64 numSlots)
+{
+    return k_HEADER_SIZE + numSlots * k_SLOT_SIZE;
+}
+
+inline
+FlatUtil::Uint64 FlatUtil::fixedSize(Uint64 numSlots)
+{
+    return bitmapOffset(numSlots) + bitmapSize(numSlots);
+}
+
+inline
+FlatUtil::Uint64 FlatUtil::slotOffset(Uint64 index)
+{
+    return k_HEADER_SIZE + index * k_SLOT_SIZE;
+}
+
+inline
+FlatUtil::Uint64 FlatUtil::align(Uint64 size)
+{
+    return (size + (k_ALIGNMENT - 1)) & ~static_cast<Uint64>(k_ALIGNMENT - 1);
+}
+
+inline
+bool FlatUtil::isPresent(const char *bitmap, Uint64 index)
+{
+    BSLS_ASSERT_SAFE(bitmap);
+
+    return (static_cast<unsigned char>(bitmap[index / 8]) >> (index % 8)) & 1;
+}
+
+inline
+void FlatUtil::setPresent(char *bitmap, Uint64 index)
+{
+    BSLS_ASSERT_SAFE(bitmap);
+
+    bitmap[index / 8] = static_cast<char>(bitmap[index / 8]
+                                          | (1 << (index % 8)));
+}
+
+inline
+unsigned int FlatUtil::getUint32(const char *address)
+{
+    BSLS_ASSERT_SAFE(address);
+
+    unsigned int value;
+    bsl::memcpy(&value, address, sizeof value);
+    return BSLS_BYTEORDER_LE_U32_TO_HOST(value);
+}
+
+inline
+FlatUtil::Uint64 FlatUtil::getUint64(const char *address)
+{
+    BSLS_ASSERT_SAFE(address);
+
+    Uint64 value;
+    bsl::memcpy(&value, address, sizeof value);
+    return BSLS_BYTEORDER_LE_U64_TO_HOST(value);
+}
+
+inline
+void FlatUtil::putUint32(char *address, unsigned int value)
+{
+    BSLS_ASSERT_SAFE(address);
+
+    value = BSLS_BYTEORDER_HOST_U32_TO_LE(value);
+    bsl::memcpy(address, &value, sizeof value);
+}
+
+inline
+void FlatUtil::putUint64(char *address, Uint64 value)
+{
+    BSLS_ASSERT_SAFE(address);
+
+    value = BSLS_BYTEORDER_HOST_U64_TO_LE(value);
+    bsl::memcpy(address, &value, sizeof value);
+}
+
+inline
+void FlatUtil::putValue(char *slot, bool value)
+{
+    putUint64(slot, value ? 1 : 0);
+}
+
+inline
+void FlatUtil::putValue(char *slot, char value)
+{
+    putUint64(slot, static_cast<unsigned char>(value));
+}
+
+inline
+void FlatUtil::putValue(char *slot, signed char value)
+{
+    putUint64(slot, static_cast<unsigned char>(value));
+}
+
+inline
+void FlatUtil::putValue(char *slot, unsigned char value)
+{
+    putUint64(slot, value);
+}
+
+inline
+void FlatUtil::putValue(char *slot, short value)
+{
+    putUint64(slot, static_cast<unsigned short>(value));
+}
+
+inline
+void FlatUtil::putValue(char *slot, unsigned short value)
+{
+    putUint64(slot, value);
+}
+
+inline
+void FlatUtil::putValue(char *slot, int value)
+{
+    putUint64(slot, static_cast<unsigned int>(value));
+}
+
+inline
+void FlatUtil::putValue(char *slot, unsigned int value)
+{
+    putUint64(slot, value);
+}
+
+inline
+void FlatUtil::putValue(char *slot, Int64 value)
+{
+    putUint64(slot, static_cast<Uint64>(value));
+}
+
+inline
+void FlatUtil::putValue(char *slot, Uint64 value)
+{
+    putUint64(slot, value);
+}
+
+inline
+void FlatUtil::putValue(char *slot, float value)
+{
+    unsigned int bits;
+    bsl::memcpy(&bits, &value, sizeof bits);
+    putUint64(slot, bits);
+}
+
+inline
+void FlatUtil::putValue(char *slot, double value)
+{
+    Uint64 bits;
+    bsl::memcpy(&bits, &value, sizeof bits);
+    putUint64(slot, bits);
+}
+
+inline
+int FlatUtil::getValue(bool *result, const char *slot)
+{
+    BSLS_ASSERT_SAFE(result);
+    BSLS_ASSERT_SAFE(slot);
+
+    *result = 0 != slot[0];
+    return 0;
+}
+
+inline
+int FlatUtil::getValue(char *result, const char *slot)
+{
+    BSLS_ASSERT_SAFE(result);
+    BSLS_ASSERT_SAFE(slot);
+
+    *result = slot[0];
+    return 0;
+}
+
+inline
+int FlatUtil::getValue(signed char *result, const char *slot)
+{
+    BSLS_ASSERT_SAFE(result);
+    BSLS_ASSERT_SAFE(slot);
+
+    *result = static_cast<signed char>(slot[0]);
+    return 0;
+}
+
+inline
+int FlatUtil::getValue(unsigned char *result, const char *slot)
+{
+    BSLS_ASSERT_SAFE(result);
+    BSLS_ASSERT_SAFE(slot);
+
+    *result = static_cast<unsigned char>(slot[0]);
+    return 0;
+}
+
+inline
+int FlatUtil::getValue(short *result, const char *slot)
+{
+    BSLS_ASSERT_SAFE(result);
+
+    *result = static_cast<short>(getUint32(slot));
+    return 0;
+}
+
+inline
+int FlatUtil::getValue(unsigned short *result, const char *slot)
+{
+    BSLS_ASSERT_SAFE(result);
+
+    *result = static_cast<unsigned short>(getUint32(slot));
+    return 0;
+}
+
+inline
+int FlatUtil::getValue(int *result, const char *slot)
+{
+    BSLS_ASSERT_SAFE(result);
+
+    *result = static_cast<int>(getUint32(slot));
+    return 0;
+}
+
+inline
+int FlatUtil::getValue(unsigned int *result, const char *slot)
+{
+    BSLS_ASSERT_SAFE(result);
+
+    *result = getUint32(slot);
+    return 0;
+}
+
+inline
+int FlatUtil::getValue(Int64 *result, const char *slot)
+{
+    BSLS_ASSERT_SAFE(result);
+
+    *result = static_cast<Int64>(getUint64(slot));
+    return 0;
+}
+
+inline
+int FlatUtil::getValue(Uint64 *result, const char *slot)
+{
+    BSLS_ASSERT_SAFE(result);
+
+    *result = getUint64(slot);
+    return 0;
+}
+
+inline
+int FlatUtil::getValue(float *result, const char *slot)
+{
+    BSLS_ASSERT_SAFE(result);
+
+    const unsigned int bits = getUint32(slot);
+    bsl::memcpy(result, &bits, sizeof bits);
+    return 0;
+}
+
+inline
+int FlatUtil::getValue(double *result, const char *slot)
+{
+    BSLS_ASSERT_SAFE(result);
+
+    const Uint64 bits = getUint64(slot);
+    bsl::memcpy(result, &bits, sizeof bits);
+    return 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,747 @@
+// balflt_flatutil.t.cpp                                              -*-C++-*-
+#include <balflt_flatutil.h>
+
+#include <bdlt_date.h>
+#include <bdlt_datetime.h>
+#include <bdlt_datetimetz.h>
+#include <bdlt_datetz.h>
+#include <bdlt_time.h>
+#include <bdlt_timetz.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_types.h>
+
+#include <bsl_climits.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_limits.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                              TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a utility defining the layout of the flat
+// encoding and providing functions to write and read values in that encoding.
+// We verify the layout arithmetic against computed values, that integers are
+// written in little-endian byte order, that every fixed value is written to
+// the start of its slot (the rest of the slot being 0) and is read back
+// unchanged, and that reading an invalid date/time representation fails.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] Uint64 bitmapSize(Uint64 numSlots);
+// [ 2] Uint64 bitmapOffset(Uint64 numSlots);
+// [ 2] Uint64 fixedSize(Uint64 numSlots);
+// [ 2] Uint64 slotOffset(Uint64 index);
+// [ 2] Uint64 align(Uint64 size);
+// [ 2] bool isPresent(const char *bitmap, Uint64 index);
+// [ 2] void setPresent(char *bitmap, Uint64 index);
+// [ 3] unsigned int getUint32(const char *address);
+// [ 3] Uint64 getUint64(const char *address);
+// [ 3] void putUint32(char *address, unsigned int value);
+// [ 3] void putUint64(char *address, Uint64 value);
+// [ 4] void putValue(char *slot, FUNDAMENTAL value);
+// [ 4] int getValue(FUNDAMENTAL *result, const char *slot);
+// [ 5] void putValue(char *slot, const DATE_OR_TIME& value);
+// [ 5] int getValue(DATE_OR_TIME *result, const char *slot);
+// [ 6] void putValue(char *buffer, const TZ_TYPE& value);
+// [ 6] int getValue(TZ_TYPE *result, const char *buffer);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                     NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+#define ASSERT_PASS_RAW(EXPR)  BSLS_ASSERTTEST_ASSERT_PASS_RAW(EXPR)
+#define ASSERT_FAIL_RAW(EXPR)  BSLS_ASSERTTEST_ASSERT_FAIL_RAW(EXPR)
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef balflt::FlatUtil    Util;
+typedef bsls::Types::Int64  Int64;
+typedef bsls::Types::Uint64 Uint64;
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+template <class TYPE>
+void testRoundTrip(int line, TYPE value, int size)
+    // Verify that the specified 'value' written to a slot uses the first
+    // specified 'size' bytes of the slot, sets the other bytes to 0, and is
+    // read back unchanged.  Use the specified 'line' to report errors.
+{
+    char slot[Util::k_SLOT_SIZE];
+    bsl::memset(slot, 0xFF, sizeof slot);
+
+    Util::putValue(slot, value);
+    for (int i = size; i < Util::k_SLOT_SIZE; ++i) {
+        ASSERTV(line, i, 0 == slot[i]);
+    }
+
+    TYPE result = TYPE();
+    ASSERTV(line, 0 == Util::getValue(&result, slot));
+    ASSERTV(line, value == result);
+}
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator         da("default", veryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Writing and Reading a Block Header
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we want to lay out a block having 3 slots by hand.  First, we
+// compute the size of the fixed part of the block:
+//..
+    ASSERT(8 + 3 * 8 + 8 == balflt::FlatUtil::fixedSize(3));
+
+    char block[40] = { 0 };
+//..
+// Then, we write the header, and an 'int' value in the second slot:
+//..
+    balflt::FlatUtil::putUint32(block, sizeof block);
+    balflt::FlatUtil::putUint32(block + 4, 3);
+    balflt::FlatUtil::putValue(block + balflt::FlatUtil::slotOffset(1), 42);
+    balflt::FlatUtil::setPresent(block + balflt::FlatUtil::bitmapOffset(3), 1);
+//..
+// Finally, we read the value back:
+//..
+    int value;
+    balflt::FlatUtil::getValue(&value,
+                               block + balflt::FlatUtil::slotOffset(1));
+    ASSERT(42 == value);
+    const char *bitmap = block + balflt::FlatUtil::bitmapOffset(3);
+    ASSERT(true  == balflt::FlatUtil::isPresent(bitmap, 1));
+    ASSERT(false == balflt::FlatUtil::isPresent(bitmap, 2));
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TIME ZONE-AWARE VALUES
+        //
+        // Concerns:
+        //: 1 A time zone-aware value is written as its local value, followed
+        //:   by its offset at index 8, and is read back unchanged.
+        //:
+        //: 2 Reading a representation whose local value or offset is invalid
+        //:   fails, and has no effect on the result.
+        //
+        // Plan:
+        //: 1 For a set of values of each type, write the value and verify the
+        //:   bytes of the local value and of the offset, then read it back.
+        //:   (C-1)
+        //:
+        //: 2 Overwrite the offset with out-of-range values, and the local
+        //:   value with an invalid representation, and verify that reading
+        //:   fails and leaves the result unchanged.  (C-2)
+        //
+        // Testing:
+        //   void putValue(char *buffer, const TZ_TYPE& value);
+        //   int getValue(TZ_TYPE *result, const char *buffer);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TIME ZONE-AWARE VALUES" << endl
+                          << "======================" << endl;
+
+        const int OFFSETS[] = { 0, -1, 1, -1439, 1439, 330 };
+        const int NUM_OFFSETS = sizeof OFFSETS / sizeof *OFFSETS;
+
+        for (int ti = 0; ti < NUM_OFFSETS; ++ti) {
+            const int OFFSET = OFFSETS[ti];
+
+            if (veryVerbose) { T_ P(OFFSET) }
+
+            char buffer[Util::k_TZ_VALUE_SIZE];
+
+            const bdlt::DateTz D(bdlt::Date(2026, 10, 19), OFFSET);
+            Util::putValue(buffer, D);
+            ASSERTV(OFFSET, OFFSET == static_cast<int>(
+                                                Util::getUint32(buffer + 8)));
+            ASSERTV(OFFSET, 0 == Util::getUint32(buffer + 12));
+
+            bdlt::DateTz d;
+            ASSERTV(OFFSET, 0 == Util::getValue(&d, buffer));
+            ASSERTV(OFFSET, D == d);
+
+            const bdlt::TimeTz T(bdlt::Time(13, 14, 15, 16, 17), OFFSET);
+            Util::putValue(buffer, T);
+
+            bdlt::TimeTz t;
+            ASSERTV(OFFSET, 0 == Util::getValue(&t, buffer));
+            ASSERTV(OFFSET, T == t);
+
+            const bdlt::DatetimeTz DT(
+                       bdlt::Datetime(2026, 10, 19, 13, 14, 15, 16, 17),
+                       OFFSET);
+            Util::putValue(buffer, DT);
+
+            bdlt::DatetimeTz dt;
+            ASSERTV(OFFSET, 0 == Util::getValue(&dt, buffer));
+            ASSERTV(OFFSET, DT.localDatetime() == dt.localDatetime());
+            ASSERTV(OFFSET, DT.offset()        == dt.offset());
+        }
+
+        if (verbose) cout << "\nDefault values." << endl;
+        {
+            char buffer[Util::k_TZ_VALUE_SIZE];
+
+            Util::putValue(buffer, bdlt::DatetimeTz());
+
+            bdlt::DatetimeTz dt(bdlt::Datetime(2000, 1, 1), 60);
+            ASSERT(0 == Util::getValue(&dt, buffer));
+            ASSERT(bdlt::DatetimeTz() == dt);
+        }
+
+        if (verbose) cout << "\nInvalid representations." << endl;
+        {
+            const int BAD_OFFSETS[] = { 1440, -1440, INT_MAX, INT_MIN };
+            const int NUM_BAD_OFFSETS = sizeof BAD_OFFSETS
+                                      / sizeof *BAD_OFFSETS;
+
+            for (int ti = 0; ti < NUM_BAD_OFFSETS; ++ti) {
+                const int OFFSET = BAD_OFFSETS[ti];
+
+                char buffer[Util::k_TZ_VALUE_SIZE];
+
+                const bdlt::DateTz D(bdlt::Date(2026, 10, 19), 60);
+                bdlt::DateTz       d(D);
+                Util::putValue(buffer, D);
+                Util::putUint32(buffer + 8, OFFSET);
+                ASSERTV(OFFSET, 0 != Util::getValue(&d, buffer));
+                ASSERTV(OFFSET, D == d);
+
+                const bdlt::TimeTz T(bdlt::Time(1, 2), 60);
+                bdlt::TimeTz       t(T);
+                Util::putValue(buffer, T);
+                Util::putUint32(buffer + 8, OFFSET);
+                ASSERTV(OFFSET, 0 != Util::getValue(&t, buffer));
+                ASSERTV(OFFSET, T == t);
+            }
+
+            // The default datetime (24:00) must have a 0 offset.
+
+            char buffer[Util::k_TZ_VALUE_SIZE];
+            Util::putValue(buffer, bdlt::DatetimeTz());
+            Util::putUint32(buffer + 8, 60);
+
+            const bdlt::DatetimeTz DT(bdlt::Datetime(2000, 1, 1), 60);
+            bdlt::DatetimeTz       dt(DT);
+            ASSERT(0 != Util::getValue(&dt, buffer));
+            ASSERT(DT.localDatetime() == dt.localDatetime());
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // DATE AND TIME VALUES
+        //
+        // Concerns:
+        //: 1 A 'bdlt::Date' is written as the number of days since 0001/01/01,
+        //:   a 'bdlt::Time' as microseconds since midnight, and a
+        //:   'bdlt::Datetime' as microseconds since 0001/01/01T00:00.
+        //:
+        //: 2 The default 'bdlt::Time' and 'bdlt::Datetime' values (24:00) are
+        //:   written as -1, and are read back unchanged.
+        //:
+        //: 3 The extreme values of each type are read back unchanged.
+        //:
+        //: 4 Reading a representation that is out of the range of the type
+        //:   fails, and has no effect on the result.
+        //
+        // Plan:
+        //: 1 Write values having known representations and verify the bytes
+        //:   written.  (C-1..2)
+        //:
+        //: 2 Use 'testRoundTrip' for a set of values, including the default
+        //:   and extreme values of each type.  (C-2..3)
+        //:
+        //: 3 Write out-of-range representations using 'putUint64', and verify
+        //:   that 'getValue' fails and leaves the result unchanged.  (C-4)
+        //
+        // Testing:
+        //   void putValue(char *slot, const DATE_OR_TIME& value);
+        //   int getValue(DATE_OR_TIME *result, const char *slot);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "DATE AND TIME VALUES" << endl
+                          << "====================" << endl;
+
+        if (verbose) cout << "\nRepresentation." << endl;
+        {
+            char slot[Util::k_SLOT_SIZE];
+
+            Util::putValue(slot, bdlt::Date(1, 1, 2));
+            ASSERT(1 == Util::getUint64(slot));
+
+            Util::putValue(slot, bdlt::Time(0, 0, 1, 0, 5));
+            ASSERT(1000005 == Util::getUint64(slot));
+
+            Util::putValue(slot, bdlt::Time());
+            ASSERT(-1 == static_cast<Int64>(Util::getUint64(slot)));
+
+            Util::putValue(slot, bdlt::Datetime(1, 1, 2, 0, 0, 0, 0, 1));
+            ASSERT(86400000001LL == static_cast<Int64>(Util::getUint64(slot)));
+
+            Util::putValue(slot, bdlt::Datetime());
+            ASSERT(-1 == static_cast<Int64>(Util::getUint64(slot)));
+        }
+
+        if (verbose) cout << "\nRound trip." << endl;
+        {
+            testRoundTrip(L_, bdlt::Date(),                 4);
+            testRoundTrip(L_, bdlt::Date(2026, 10, 19),     4);
+            testRoundTrip(L_, bdlt::Date(9999, 12, 31),     4);
+
+            testRoundTrip(L_, bdlt::Time(),                      8);
+            testRoundTrip(L_, bdlt::Time(0, 0),                  8);
+            testRoundTrip(L_, bdlt::Time(23, 59, 59, 999, 999),  8);
+
+            testRoundTrip(L_, bdlt::Datetime(),                       8);
+            testRoundTrip(L_, bdlt::Datetime(1, 1, 1, 0, 0),          8);
+            testRoundTrip(L_, bdlt::Datetime(2026, 10, 19, 1, 2, 3, 4, 5),
+                                                                      8);
+            testRoundTrip(L_, bdlt::Datetime(9999, 12, 31, 23, 59, 59, 999,
+                                             999),
+                                                                      8);
+        }
+
+        if (verbose) cout << "\nOut-of-range representations." << endl;
+        {
+            const Int64 US_PER_D = 86400000000LL;
+            const Int64 MAX_DAYS = bdlt::Date(9999, 12, 31) - bdlt::Date();
+
+            const Uint64 BAD_DATES[] = { static_cast<Uint64>(MAX_DAYS + 1),
+                                         0xFFFFFFFF };
+            for (int ti = 0; ti < 2; ++ti) {
+                char slot[Util::k_SLOT_SIZE];
+                Util::putUint64(slot, BAD_DATES[ti]);
+
+                const bdlt::Date D(2000, 1, 1);
+                bdlt::Date       d(D);
+                ASSERTV(ti, 0 != Util::getValue(&d, slot));
+                ASSERTV(ti, D == d);
+            }
+
+            const Int64 BAD_TIMES[] = { US_PER_D, -2, LLONG_MIN };
+            for (int ti = 0; ti < 3; ++ti) {
+                char slot[Util::k_SLOT_SIZE];
+                Util::putUint64(slot, BAD_TIMES[ti]);
+
+                const bdlt::Time T(1, 2, 3);
+                bdlt::Time       t(T);
+                ASSERTV(ti, 0 != Util::getValue(&t, slot));
+                ASSERTV(ti, T == t);
+            }
+
+            const Int64 BAD_DATETIMES[] = { (MAX_DAYS + 1) * US_PER_D,
+                                            -2,
+                                            LLONG_MAX,
+                                            LLONG_MIN };
+            for (int ti = 0; ti < 4; ++ti) {
+                char slot[Util::k_SLOT_SIZE];
+                Util::putUint64(slot, BAD_DATETIMES[ti]);
+
+                const bdlt::Datetime DT(2000, 1, 1, 1, 2, 3);
+                bdlt::Datetime       dt(DT);
+                ASSERTV(ti, 0 != Util::getValue(&dt, slot));
+                ASSERTV(ti, DT == dt);
+            }
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // FUNDAMENTAL VALUES
+        //
+        // Concerns:
+        //: 1 A fixed value is written to the start of its slot, in
+        //:   little-endian byte order, and the rest of the slot is set to 0.
+        //:
+        //: 2 Every value, including the extreme values of each type, is read
+        //:   back unchanged.
+        //:
+        //: 3 Reading a 'bool' treats any non-zero byte as 'true'.
+        //
+        // Plan:
+        //: 1 Use 'testRoundTrip' for the extreme values, and a typical value,
+        //:   of each fundamental type.  (C-1..2)
+        //:
+        //: 2 Write known values and verify the bytes written.  (C-1)
+        //:
+        //: 3 Read a slot whose first byte is 2 as a 'bool'.  (C-3)
+        //
+        // Testing:
+        //   void putValue(char *slot, FUNDAMENTAL value);
+        //   int getValue(FUNDAMENTAL *result, const char *slot);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "FUNDAMENTAL VALUES" << endl
+                          << "==================" << endl;
+
+        testRoundTrip(L_, false, 1);
+        testRoundTrip(L_, true,  1);
+
+        testRoundTrip(L_, 'a',       1);
+        testRoundTrip(L_, static_cast<char>(CHAR_MIN), 1);
+        testRoundTrip(L_, static_cast<char>(CHAR_MAX), 1);
+
+        testRoundTrip(L_, static_cast<signed char>(SCHAR_MIN),   1);
+        testRoundTrip(L_, static_cast<signed char>(SCHAR_MAX),   1);
+        testRoundTrip(L_, static_cast<unsigned char>(UCHAR_MAX), 1);
+
+        testRoundTrip(L_, static_cast<short>(SHRT_MIN),           2);
+        testRoundTrip(L_, static_cast<short>(SHRT_MAX),           2);
+        testRoundTrip(L_, static_cast<unsigned short>(USHRT_MAX), 2);
+
+        testRoundTrip(L_, INT_MIN,  4);
+        testRoundTrip(L_, INT_MAX,  4);
+        testRoundTrip(L_, -1,       4);
+        testRoundTrip(L_, UINT_MAX, 4);
+
+        testRoundTrip(L_, bsl::numeric_limits<Int64>::min(),  8);
+        testRoundTrip(L_, bsl::numeric_limits<Int64>::max(),  8);
+        testRoundTrip(L_, bsl::numeric_limits<Uint64>::max(), 8);
+
+        testRoundTrip(L_, 1.5f,                                4);
+        testRoundTrip(L_, -bsl::numeric_limits<float>::max(), 4);
+        testRoundTrip(L_, bsl::numeric_limits<float>::min(),  4);
+        testRoundTrip(L_, 1.5,                                 8);
+        testRoundTrip(L_, bsl::numeric_limits<double>::max(),  8);
+        testRoundTrip(L_, bsl::numeric_limits<double>::denorm_min(), 8);
+
+        if (verbose) cout << "\nByte order." << endl;
+        {
+            char slot[Util::k_SLOT_SIZE];
+
+            Util::putValue(slot, static_cast<short>(0x0102));
+            ASSERT(0x02 == slot[0]);
+            ASSERT(0x01 == slot[1]);
+
+            Util::putValue(slot, -2);
+            ASSERT('\xFE' == slot[0]);
+            ASSERT('\xFF' == slot[3]);
+            ASSERT(0      == slot[4]);
+
+            Util::putValue(slot, 1.0);
+            ASSERT(0x3FF0000000000000ULL == Util::getUint64(slot));
+        }
+
+        if (verbose) cout << "\nNon-canonical 'bool'." << endl;
+        {
+            char slot[Util::k_SLOT_SIZE] = { 2 };
+
+            bool value = false;
+            ASSERT(0 == Util::getValue(&value, slot));
+            ASSERT(true == value);
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // LITTLE-ENDIAN INTEGERS
+        //
+        // Concerns:
+        //: 1 'putUint32' and 'putUint64' write exactly 4 and 8 bytes,
+        //:   respectively, least significant byte first, at any alignment.
+        //:
+        //: 2 'getUint32' and 'getUint64' read back the values written.
+        //
+        // Plan:
+        //: 1 Write a value whose bytes are distinct at every offset of a
+        //:   buffer filled with a sentinel, and verify every byte of the
+        //:   buffer.  Read the value back.  (C-1..2)
+        //
+        // Testing:
+        //   unsigned int getUint32(const char *address);
+        //   Uint64 getUint64(const char *address);
+        //   void putUint32(char *address, unsigned int value);
+        //   void putUint64(char *address, Uint64 value);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "LITTLE-ENDIAN INTEGERS" << endl
+                          << "======================" << endl;
+
+        for (int offset = 0; offset < 8; ++offset) {
+            char buffer[24];
+
+            bsl::memset(buffer, 'x', sizeof buffer);
+            Util::putUint32(buffer + offset, 0x04030201);
+            for (int i = 0; i < static_cast<int>(sizeof buffer); ++i) {
+                const char EXP = i >= offset && i < offset + 4
+                               ? static_cast<char>(i - offset + 1)
+                               : 'x';
+                ASSERTV(offset, i, EXP == buffer[i]);
+            }
+            ASSERTV(offset, 0x04030201 == Util::getUint32(buffer + offset));
+
+            bsl::memset(buffer, 'x', sizeof buffer);
+            Util::putUint64(buffer + offset, 0x0807060504030201ULL);
+            for (int i = 0; i < static_cast<int>(sizeof buffer); ++i) {
+                const char EXP = i >= offset && i < offset + 8
+                               ? static_cast<char>(i - offset + 1)
+                               : 'x';
+                ASSERTV(offset, i, EXP == buffer[i]);
+            }
+            ASSERTV(offset,
+                    0x0807060504030201ULL == Util::getUint64(buffer + offset));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // LAYOUT
+        //
+        // Concerns:
+        //: 1 The presence bitmap of a block having 'N' slots has
+        //:   'ceil(N / 64) * 8' bytes, and follows the 'N' slots.
+        //:
+        //: 2 Slot 'i' is at offset '8 + 8 * i'.
+        //:
+        //: 3 'align' rounds up to a multiple of 8.
+        //:
+        //: 4 'setPresent' sets only the bit of its index, and 'isPresent'
+        //:   reports it.
+        //:
+        //: 5 The computations do not overflow for the largest 32-bit number
+        //:   of slots.
+        //
+        // Plan:
+        //: 1 Compare the results for a table of numbers of slots, including
+        //:   the boundaries of a bitmap word, with expected values.
+        //:   (C-1..2, 5)
+        //:
+        //: 2 Compare 'align' for the values 0..24 with the expected values.
+        //:   (C-3)
+        //:
+        //: 3 For each index of a 128-bit bitmap, set the bit in a cleared
+        //:   bitmap, and verify that only that bit is present.  (C-4)
+        //
+        // Testing:
+        //   Uint64 bitmapSize(Uint64 numSlots);
+        //   Uint64 bitmapOffset(Uint64 numSlots);
+        //   Uint64 fixedSize(Uint64 numSlots);
+        //   Uint64 slotOffset(Uint64 index);
+        //   Uint64 align(Uint64 size);
+        //   bool isPresent(const char *bitmap, Uint64 index);
+        //   void setPresent(char *bitmap, Uint64 index);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "LAYOUT" << endl
+                          << "======" << endl;
+
+        static const struct {
+            int    d_line;
+            Uint64 d_numSlots;
+            Uint64 d_bitmapSize;
+        } DATA[] = {
+            //LINE  NUM SLOTS    BITMAP SIZE
+            //----  ----------   ----------------
+            { L_,   0,           0                },
+            { L_,   1,           8                },
+            { L_,   63,          8                },
+            { L_,   64,          8                },
+            { L_,   65,          16               },
+            { L_,   128,         16               },
+            { L_,   0xFFFFFFFF,  0x4000000 * 8    },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int    LINE = DATA[ti].d_line;
+            const Uint64 N    = DATA[ti].d_numSlots;
+            const Uint64 EXP  = DATA[ti].d_bitmapSize;
+
+            ASSERTV(LINE, EXP             == Util::bitmapSize(N));
+            ASSERTV(LINE, 8 + 8 * N       == Util::bitmapOffset(N));
+            ASSERTV(LINE, 8 + 8 * N + EXP == Util::fixedSize(N));
+            ASSERTV(LINE, 8 + 8 * N       == Util::slotOffset(N));
+        }
+
+        for (Uint64 size = 0; size <= 24; ++size) {
+            ASSERTV(size, (size + 7) / 8 * 8 == Util::align(size));
+        }
+
+        for (int index = 0; index < 128; ++index) {
+            char bitmap[16] = { 0 };
+
+            Util::setPresent(bitmap, index);
+            for (int i = 0; i < 128; ++i) {
+                ASSERTV(index, i, (i == index) == Util::isPresent(bitmap, i));
+            }
+            ASSERTV(index, (1 << (index % 8)) ==
+                           static_cast<unsigned char>(bitmap[index / 8]));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Lay out a block having two slots, write a value of several types,
+        //:   and read them back.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        char block[32] = { 0 };
+        ASSERT(sizeof block == Util::fixedSize(2));
+
+        Util::putValue(block + Util::slotOffset(0), 3.25);
+        Util::putValue(block + Util::slotOffset(1), bdlt::Date(2026, 10, 19));
+        Util::setPresent(block + Util::bitmapOffset(2), 1);
+
+        double d;
+        ASSERT(0 == Util::getValue(&d, block + Util::slotOffset(0)));
+        ASSERT(3.25 == d);
+
+        bdlt::Date date;
+        ASSERT(0 == Util::getValue(&date, block + Util::slotOffset(1)));
+        ASSERT(bdlt::Date(2026, 10, 19) == date);
+
+        ASSERT(!Util::isPresent(block + Util::bitmapOffset(2), 0));
+        ASSERT( Util::isPresent(block + Util::bitmapOffset(2), 1));
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
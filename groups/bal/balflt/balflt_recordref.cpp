@@ -0,0 +1,234 @@
+// balflt_recordref.cpp                                               -*-C++-*-
+#include <balflt_recordref.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(balflt_recordref_cpp,"$Id$ $CSID$")
+
+#include <bsls_types.h>
+
+///Implementation Notes
+///--------------------
+// A nested block (or string) must lie in the variable area of its enclosing
+// block, i.e., after the fixed part of the enclosing block, and must end
+// before the end of the enclosing block.  A nested block is therefore strictly
+// smaller than its enclosing block, which guarantees that a malformed buffer
+// can not describe a cycle.
+
+namespace BloombergLP {
+namespace balflt {
+
+                              // ---------------
+                              // class RecordRef
+                              // ---------------
+
+// PRIVATE MANIPULATORS
+int RecordRef::resetBlock(const char   *data,
+                          bsl::size_t   length,
+                          unsigned int  numSlots)
+{
+    const unsigned int blockLength = FlatUtil::getUint32(data);
+
+    if (blockLength > length
+     || blockLength > FlatUtil::k_MAX_BLOCK_SIZE
+     || FlatUtil::fixedSize(numSlots) > blockLength) {
+        *this = RecordRef();
+        return -1;                                                    // RETURN
+    }
+
+    d_block_p  = data;
+    d_length   = blockLength;
+    d_numSlots = numSlots;
+    return 0;
+}
+
+// PRIVATE ACCESSORS
+int RecordRef::getReference(const char  **data,
+                            bsl::size_t  *length,
+                            int           index) const
+{
+    typedef bsls::Types::Uint64 Uint64;
+
+    if (isNull(index)) {
+        return -1;                                                    // RETURN
+    }
+
+    const char   *slot   = d_block_p + FlatUtil::slotOffset(index);
+    const Uint64  offset = FlatUtil::getUint32(slot);
+    const Uint64  size   = FlatUtil::getUint32(slot + 4);
+
+    if (0 == size) {
+        *data   = d_block_p;
+        *length = 0;
+        return 0;                                                     // RETURN
+    }
+
+    if (offset < FlatUtil::fixedSize(d_numSlots)
+     || offset + size > d_length) {
+        return -1;                                                    // RETURN
+    }
+
+    *data   = d_block_p + offset;
+    *length = static_cast<bsl::size_t>(size);
+    return 0;
+}
+
+// MANIPULATORS
+int RecordRef::reset(const char *data, bsl::size_t length)
+{
+    BSLS_ASSERT(data || 0 == length);
+
+    if (length < FlatUtil::k_HEADER_SIZE) {
+        *this = RecordRef();
+        return -1;                                                    // RETURN
+    }
+    return resetBlock(data, length, FlatUtil::getUint32(data + 4));
+}
+
+// ACCESSORS
+int RecordRef::getValue(bdlt::DateTz *result, int index) const
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(0 <= index);
+
+    const char  *data;
+    bsl::size_t  length;
+    if (0 != getReference(&data, &length, index)
+     || FlatUtil::k_TZ_VALUE_SIZE != length) {
+        return -1;                                                    // RETURN
+    }
+    return FlatUtil::getValue(result, data);
+}
+
+int RecordRef::getValue(bdlt::TimeTz *result, int index) const
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(0 <= index);
+
+    const char  *data;
+    bsl::size_t  length;
+    if (0 != getReference(&data, &length, index)
+     || FlatUtil::k_TZ_VALUE_SIZE != length) {
+        return -1;                                                    // RETURN
+    }
+    return FlatUtil::getValue(result, data);
+}
+
+int RecordRef::getValue(bdlt::DatetimeTz *result, int index) const
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(0 <= index);
+
+    const char  *data;
+    bsl::size_t  length;
+    if (0 != getReference(&data, &length, index)
+     || FlatUtil::k_TZ_VALUE_SIZE != length) {
+        return -1;                                                    // RETURN
+    }
+    return FlatUtil::getValue(result, data);
+}
+
+int RecordRef::getValue(bslstl::StringRef *result, int index) const
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(0 <= index);
+
+    const char  *data;
+    bsl::size_t  length;
+    if (0 != getReference(&data, &length, index)) {
+        return -1;                                                    // RETURN
+    }
+    result->assign(data, length);
+    return 0;
+}
+
+int RecordRef::getValue(bsl::string *result, int index) const
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(0 <= index);
+
+    const char  *data;
+    bsl::size_t  length;
+    if (0 != getReference(&data, &length, index)) {
+        return -1;                                                    // RETURN
+    }
+    result->assign(data, length);
+    return 0;
+}
+
+int RecordRef::getValue(RecordRef *result, int index) const
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(0 <= index);
+
+    const char  *data;
+    bsl::size_t  length;
+    if (0 != getReference(&data, &length, index)) {
+        return -1;                                                    // RETURN
+    }
+
+    RecordRef nested;
+    if (0 != nested.reset(data, length)) {
+        return -1;                                                    // RETURN
+    }
+    *result = nested;
+    return 0;
+}
+
+int RecordRef::getValue(ChoiceRef *result, int index) const
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(0 <= index);
+
+    const char  *data;
+    bsl::size_t  length;
+    if (0 != getReference(&data, &length, index)) {
+        return -1;                                                    // RETURN
+    }
+
+    ChoiceRef nested;
+    if (0 != nested.reset(data, length)) {
+        return -1;                                                    // RETURN
+    }
+    *result = nested;
+    return 0;
+}
+
+                              // ---------------
+                              // class ChoiceRef
+                              // ---------------
+
+// MANIPULATORS
+int ChoiceRef::reset(const char *data, bsl::size_t length)
+{
+    BSLS_ASSERT(data || 0 == length);
+
+    const int rc = length < FlatUtil::k_HEADER_SIZE
+                 ? -1
+                 : d_record.resetBlock(data, length, 1);
+    if (0 != rc) {
+        *this = ChoiceRef();
+        return -1;                                                    // RETURN
+    }
+
+    d_selectionId = static_cast<int>(FlatUtil::getUint32(data + 4));
+    return 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,389 @@
+// balflt_recordref.h                                                 -*-C++-*-
+#ifndef INCLUDED_BALFLT_RECORDREF
+#define INCLUDED_BALFLT_RECORDREF
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide in-place read access to flat-encoded values.
+//
+//@CLASSES:
+//  balflt::RecordRef: reference to a flat-encoded sequence or array
+//  balflt::ChoiceRef: reference to a flat-encoded choice
+//
+//@SEE_ALSO: balflt_flatutil, balflt_encoder, balflt_decoder
+//
+//@DESCRIPTION: This component provides two in-core value-semantic reference
+// types, 'balflt::RecordRef' and 'balflt::ChoiceRef', that refer to a block
+// of a value encoded in the flat format (see 'balflt_flatutil'), and that read
+// the fields of the block in place, without decoding the value.
+//
+// A 'balflt::RecordRef' refers to the encoding of a sequence, whose fields are
+// its attributes (indexed in the order in which they are visited by
+// 'bdlat_SequenceFunctions::accessAttributes'), or of an array, whose fields
+// are its elements.  A 'balflt::ChoiceRef' refers to the encoding of a choice,
+// having a selection id and (unless the selection id is '-1') a selection.
+// Fields of fixed-size types are read from their slot in constant time;
+// strings are returned as a 'bslstl::StringRef' referring to the encoded
+// bytes; and nested sequences, arrays, and choices are returned as (nested)
+// references.
+//
+// The buffer referred to is never modified, and must outlive the references
+// to it.  Every access is bounds-checked against the block being read, so that
+// reading a malformed or truncated buffer fails (by returning a non-zero
+// value) rather than reading outside of the buffer.
+//
+///Schema Evolution
+///----------------
+// A field whose index is not less than the number of fields of the encoded
+// block reads as null.  Therefore, a reader built for a version of a sequence
+// having attributes appended (as nullable attributes) can read values encoded
+// using the previous version, and a reader built for the previous version
+// ignores the appended attributes.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Reading a Field Without Decoding
+///- - - - - - - - - - - - - - - - - - - - - -
+// Suppose that 'data' and 'length' describe the flat encoding (produced by a
+// 'balflt::Encoder') of a sequence whose attribute 1 is the name of a security
+// (a 'bsl::string') and whose attribute 2 is its price (a 'double'):
+//..
+//  const char        *data   = encoding.data();
+//  const bsl::size_t  length = encoding.size();
+//..
+// First, we create a 'balflt::RecordRef' and bind it to the buffer, which
+// validates the header of the block:
+//..
+//  balflt::RecordRef record;
+//  int rc = record.reset(data, length);
+//  assert(0 == rc);
+//..
+// Then, we read the two fields in place:
+//..
+//  bslstl::StringRef name;
+//  double            price;
+//
+//  rc = record.getValue(&name, 1);
+//  assert(0 == rc);
+//  rc = record.getValue(&price, 2);
+//  assert(0 == rc);
+//..
+// Notice that 'name' refers to the bytes of the encoding; no memory is
+// allocated, and no other field is read.
+
+#include <balscm_version.h>
+
+#include <balflt_flatutil.h>
+
+#include <bdlt_date.h>
+#include <bdlt_datetime.h>
+#include <bdlt_datetimetz.h>
+#include <bdlt_datetz.h>
+#include <bdlt_time.h>
+#include <bdlt_timetz.h>
+
+#include <bslmf_istriviallycopyable.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_string.h>
+
+#include <bslstl_stringref.h>
+
+namespace BloombergLP {
+namespace balflt {
+
+class ChoiceRef;
+
+                              // ===============
+                              // class RecordRef
+                              // ===============
+
+class RecordRef {
+    // This in-core value-semantic type refers to a flat-encoded block holding
+    // a sequence or an array, and provides bounds-checked, in-place access to
+    // its fields.  See the component-level documentation for details.
+
+    // DATA
+    const char   *d_block_p;   // start of the block, or 0 if unbound
+    unsigned int  d_length;    // length of the block
+    unsigned int  d_numSlots;  // number of slots of the block
+
+    // FRIENDS
+    friend class ChoiceRef;
+
+    // PRIVATE MANIPULATORS
+    int resetBlock(const char   *data,
+                   bsl::size_t   length,
+                   unsigned int  numSlots);
+        // Bind this reference to the block, having the specified 'numSlots',
+        // at the start of the specified 'data' having the specified 'length'.
+        // Return 0 on success, and a non-zero value (leaving this reference
+        // unbound) if the block is not contained in 'data' or is not large
+        // enough to hold its fixed part.
+
+    // PRIVATE ACCESSORS
+    int getReference(const char **data, bsl::size_t *length, int index) const;
+        // Load into the specified 'data' and 'length' the address and length
+        // of the variable-size value referred to by the slot having the
+        // specified 'index'.  Return 0 on success, and a non-zero value if the
+        // field is null, or if the value is not contained in the block.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(RecordRef, bsl::is_trivially_copyable);
+
+    // CREATORS
+    RecordRef();
+        // Create an unbound reference, having no fields.
+
+    //! RecordRef(const RecordRef& original) = default;
+    //! ~RecordRef() = default;
+
+    // MANIPULATORS
+    //! RecordRef& operator=(const RecordRef& rhs) = default;
+
+    int reset(const char *data, bsl::size_t length);
+        // Bind this reference to the block at the start of the specified
+        // 'data' having the specified 'length' (e.g., the result of encoding a
+        // sequence using 'balflt::Encoder').  Return 0 on success, and a
+        // non-zero value (leaving this reference unbound) if 'data' does not
+        // begin with a valid block header.
+
+    // ACCESSORS
+    const char *data() const;
+        // Return the address of the block referred to by this reference, or 0
+        // if this reference is unbound.
+
+    int length() const;
+        // Return the length of the block referred to by this reference.
+
+    int numFields() const;
+        // Return the number of fields of the block referred to by this
+        // reference.
+
+    bool isNull(int index) const;
+        // Return 'true' if the field having the specified 'index' is null or
+        // is absent (i.e., 'numFields() <= index'), and 'false' otherwise.
+        // The behavior is undefined unless '0 <= index'.
+
+    template <class TYPE>
+    int getValue(TYPE *result, int index) const;
+        // Load into the specified 'result' the value of the field having the
+        // specified 'index'.  Return 0 on success, and a non-zero value (with
+        // no effect on 'result') if the field is null or absent, or if the
+        // encoded value is not valid.  The behavior is undefined unless
+        // '0 <= index', and 'TYPE' is the type of the field, being a
+        // fundamental type, 'bsls::Types::Int64', 'bsls::Types::Uint64',
+        // 'bdlt::Date', 'bdlt::Time', or 'bdlt::Datetime' (enumerations are
+        // read as 'int').
+
+    int getValue(bdlt::DateTz     *result, int index) const;
+    int getValue(bdlt::TimeTz     *result, int index) const;
+    int getValue(bdlt::DatetimeTz *result, int index) const;
+        // Load into the specified 'result' the time zone-aware value of the
+        // field having the specified 'index'.  Return 0 on success, and a
+        // non-zero value (with no effect on 'result') if the field is null or
+        // absent, or if the encoded value is not valid.  The behavior is
+        // undefined unless '0 <= index'.
+
+    int getValue(bslstl::StringRef *result, int index) const;
+        // Load into the specified 'result' a reference to the bytes of the
+        // string (or 'bsl::vector<char>') field having the specified 'index'.
+        // Return 0 on success, and a non-zero value (with no effect on
+        // 'result') if the field is null or absent, or if its bytes are not
+        // contained in the block.  The behavior is undefined unless
+        // '0 <= index'.
+
+    int getValue(bsl::string *result, int index) const;
+        // Load into the specified 'result' a copy of the string field having
+        // the specified 'index'.  Return 0 on success, and a non-zero value
+        // (with no effect on 'result') if the field is null or absent, or if
+        // its bytes are not contained in the block.  The behavior is undefined
+        // unless '0 <= index'.
+
+    int getValue(RecordRef *result, int index) const;
+        // Bind the specified 'result' to the nested sequence or array field
+        // having the specified 'index'.  Return 0 on success, and a non-zero
+        // value (with no effect on 'result') if the field is null or absent,
+        // or if the nested block is not valid.  The behavior is undefined
+        // unless '0 <= index'.
+
+    int getValue(ChoiceRef *result, int index) const;
+        // Bind the specified 'result' to the nested choice field having the
+        // specified 'index'.  Return 0 on success, and a non-zero value (with
+        // no effect on 'result') if the field is null or absent, or if the
+        // nested block is not valid.  The behavior is undefined unless
+        // '0 <= index'.
+};
+
+                              // ===============
+                              // class ChoiceRef
+                              // ===============
+
+class ChoiceRef {
+    // This in-core value-semantic type refers to a flat-encoded block holding
+    // a choice, and provides bounds-checked, in-place access to its
+    // selection.  See the component-level documentation for details.
+
+    // DATA
+    RecordRef d_record;       // block holding the selection in field 0
+    int       d_selectionId;  // selection id, or -1 if no selection is made
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(ChoiceRef, bsl::is_trivially_copyable);
+
+    // CREATORS
+    ChoiceRef();
+        // Create an unbound reference, having no selection.
+
+    //! ChoiceRef(const ChoiceRef& original) = default;
+    //! ~ChoiceRef() = default;
+
+    // MANIPULATORS
+    //! ChoiceRef& operator=(const ChoiceRef& rhs) = default;
+
+    int reset(const char *data, bsl::size_t length);
+        // Bind this reference to the block at the start of the specified
+        // 'data' having the specified 'length' (e.g., the result of encoding a
+        // choice using 'balflt::Encoder').  Return 0 on success, and a
+        // non-zero value (leaving this reference unbound) if 'data' does not
+        // begin with a valid block header.
+
+    // ACCESSORS
+    const RecordRef& record() const;
+        // Return a reference to the block of this choice, viewed as a record
+        // whose field 0 is the selection.
+
+    int selectionId() const;
+        // Return the id of the selection of the choice referred to by this
+        // reference, or -1 if no selection is made.
+
+    template <class TYPE>
+    int getSelection(TYPE *result) const;
+        // Load into the specified 'result' the value of the selection of the
+        // choice referred to by this reference.  Return 0 on success, and a
+        // non-zero value (with no effect on 'result') if no selection is made,
+        // or if the encoded value is not valid.  The behavior is undefined
+        // unless 'TYPE' is the type of the selection (see
+        // 'RecordRef::getValue').
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                              // ---------------
+                              // class RecordRef
+                              // ---------------
+
+// CREATORS
+inline
+RecordRef::RecordRef()
+: d_block_p(0)
+, d_length(0)
+, d_numSlots(0)
+{
+}
+
+// ACCESSORS
+inline
+const char *RecordRef::data() const
+{
+    return d_block_p;
+}
+
+inline
+int RecordRef::length() const
+{
+    return static_cast<int>(d_length);
+}
+
+inline
+int RecordRef::numFields() const
+{
+    return static_cast<int>(d_numSlots);
+}
+
+inline
+bool RecordRef::isNull(int index) const
+{
+    BSLS_ASSERT_SAFE(0 <= index);
+
+    return static_cast<unsigned int>(index) >= d_numSlots
+        || !FlatUtil::isPresent(d_block_p + FlatUtil::bitmapOffset(d_numSlots),
+                                index);
+}
+
+template <class TYPE>
+inline
+int RecordRef::getValue(TYPE *result, int index) const
+{
+    BSLS_ASSERT_SAFE(result);
+    BSLS_ASSERT_SAFE(0 <= index);
+
+    if (isNull(index)) {
+        return -1;                                                    // RETURN
+    }
+    return FlatUtil::getValue(result,
+                              d_block_p + FlatUtil::slotOffset(index));
+}
+
+                              // ---------------
+                              // class ChoiceRef
+                              // ---------------
+
+// CREATORS
+inline
+ChoiceRef::ChoiceRef()
+: d_record()
+, d_selectionId(-1)
+{
+}
+
+// ACCESSORS
+inline
+const RecordRef& ChoiceRef::record() const
+{
+    return d_record;
+}
+
+inline
+int ChoiceRef::selectionId() const
+{
+    return d_selectionId;
+}
+
+template <class TYPE>
+inline
+int ChoiceRef::getSelection(TYPE *result) const
+{
+    return d_record.getValue(result, 0);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
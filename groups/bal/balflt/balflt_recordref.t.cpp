@@ -0,0 +1,966 @@
+// balflt_recordref.t.cpp                                             -*-C++-*-
+#include <balflt_recordref.h>
+
+#include <balflt_flatutil.h>
+
+#include <bdlt_date.h>
+#include <bdlt_datetime.h>
+#include <bdlt_datetimetz.h>
+#include <bdlt_datetz.h>
+#include <bdlt_time.h>
+#include <bdlt_timetz.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+
+#include <bslstl_stringref.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                              TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The components under test are two reference types reading flat-encoded
+// blocks in place.  The blocks are built in the test driver using
+// 'balflt::FlatUtil' (by the 'BlockWriter' helper), so that malformed blocks
+// can be built as easily as valid ones.  We verify that every field is read
+// from its slot, that null and absent fields read as null, and that every
+// header, offset, and length is bounds-checked, a malformed block being
+// rejected without effect on the result.
+// ----------------------------------------------------------------------------
+// RecordRef
+// [ 2] RecordRef();
+// [ 2] int reset(const char *data, bsl::size_t length);
+// [ 2] const char *data() const;
+// [ 2] int length() const;
+// [ 2] int numFields() const;
+// [ 3] bool isNull(int index) const;
+// [ 3] int getValue(TYPE *result, int index) const;
+// [ 4] int getValue(TZ_TYPE *result, int index) const;
+// [ 4] int getValue(bslstl::StringRef *result, int index) const;
+// [ 4] int getValue(bsl::string *result, int index) const;
+// [ 5] int getValue(RecordRef *result, int index) const;
+// [ 5] int getValue(ChoiceRef *result, int index) const;
+//
+// ChoiceRef
+// [ 5] ChoiceRef();
+// [ 5] int reset(const char *data, bsl::size_t length);
+// [ 5] const RecordRef& record() const;
+// [ 5] int selectionId() const;
+// [ 5] int getSelection(TYPE *result) const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                     NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+#define ASSERT_PASS_RAW(EXPR)  BSLS_ASSERTTEST_ASSERT_PASS_RAW(EXPR)
+#define ASSERT_FAIL_RAW(EXPR)  BSLS_ASSERTTEST_ASSERT_FAIL_RAW(EXPR)
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef balflt::RecordRef   Obj;
+typedef balflt::ChoiceRef   ChoiceObj;
+typedef balflt::FlatUtil    Util;
+typedef bsls::Types::Int64  Int64;
+
+// ============================================================================
+//                       HELPER CLASSES FOR TESTING
+// ----------------------------------------------------------------------------
+
+class BlockWriter {
+    // This class writes a flat-encoded block to a buffer supplied at
+    // construction, which is assumed to be large enough, and 8-byte aligned.
+
+    // DATA
+    char         *d_block_p;   // start of the block
+    unsigned int  d_numSlots;  // number of slots of the block
+    bsl::size_t   d_end;       // end of the data written to the block
+
+    // PRIVATE MANIPULATORS
+    char *slot(int index)
+        // Mark the slot having the specified 'index' as present, and return
+        // its address.
+    {
+        Util::setPresent(d_block_p + Util::bitmapOffset(d_numSlots), index);
+        return d_block_p + Util::slotOffset(index);
+    }
+
+  public:
+    // CREATORS
+    BlockWriter(char *buffer, unsigned int numSlots, unsigned int word)
+        // Create a writer of a block having the specified 'numSlots' and
+        // 'word' at the specified 'buffer'.
+    : d_block_p(buffer)
+    , d_numSlots(numSlots)
+    , d_end(Util::fixedSize(numSlots))
+    {
+        bsl::memset(buffer, 0, d_end);
+        Util::putUint32(buffer + 4, word);
+    }
+
+    // MANIPULATORS
+    template <class TYPE>
+    void putFixed(int index, const TYPE& value)
+        // Write the specified fixed 'value' to the slot having the specified
+        // 'index'.
+    {
+        Util::putValue(slot(index), value);
+    }
+
+    void putReference(int index, unsigned int offset, unsigned int length)
+        // Make the slot having the specified 'index' refer to the specified
+        // 'length' bytes at the specified 'offset'.
+    {
+        char *address = slot(index);
+        Util::putUint32(address,     offset);
+        Util::putUint32(address + 4, length);
+    }
+
+    void putBytes(int index, const char *data, bsl::size_t length)
+        // Append the specified 'length' bytes of the specified 'data' to the
+        // block, and make the slot having the specified 'index' refer to them.
+    {
+        d_end = Util::align(d_end);
+        bsl::memcpy(d_block_p + d_end, data, length);
+        putReference(index,
+                     static_cast<unsigned int>(d_end),
+                     static_cast<unsigned int>(length));
+        d_end += length;
+    }
+
+    template <class TYPE>
+    void putTz(int index, const TYPE& value)
+        // Append the specified time zone-aware 'value' to the block, and make
+        // the slot having the specified 'index' refer to it.
+    {
+        char buffer[Util::k_TZ_VALUE_SIZE];
+        Util::putValue(buffer, value);
+        putBytes(index, buffer, sizeof buffer);
+    }
+
+    char *nested()
+        // Return the address at which a nested block is appended.
+    {
+        d_end = Util::align(d_end);
+        return d_block_p + d_end;
+    }
+
+    void commitNested(int index, bsl::size_t length)
+        // Make the slot having the specified 'index' refer to the nested
+        // block, having the specified 'length', at 'nested()'.
+    {
+        putReference(index,
+                     static_cast<unsigned int>(d_end),
+                     static_cast<unsigned int>(length));
+        d_end += length;
+    }
+
+    bsl::size_t finish()
+        // Write the length of the block, and return it.
+    {
+        d_end = Util::align(d_end);
+        Util::putUint32(d_block_p, static_cast<unsigned int>(d_end));
+        return d_end;
+    }
+};
+
+union AlignedBuffer {
+    // This union provides an 8-byte aligned buffer.
+
+    char                d_buffer[1024];
+    bsls::Types::Int64  d_align;
+};
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator         da("default", veryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        AlignedBuffer encoding;
+        bsl::size_t   encodingLength;
+        {
+            BlockWriter writer(encoding.d_buffer, 3, 3);
+            writer.putFixed(0, 1234);
+            writer.putBytes(1, "IBM", 3);
+            writer.putFixed(2, 162.5);
+            encodingLength = writer.finish();
+        }
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Reading a Field Without Decoding
+///- - - - - - - - - - - - - - - - - - - - - -
+// Suppose that 'data' and 'length' describe the flat encoding (produced by a
+// 'balflt::Encoder') of a sequence whose attribute 1 is the name of a security
+// (a 'bsl::string') and whose attribute 2 is its price (a 'double'):
+//..
+    const char        *data   = encoding.d_buffer;
+    const bsl::size_t  length = encodingLength;
+//..
+// First, we create a 'balflt::RecordRef' and bind it to the buffer, which
+// validates the header of the block:
+//..
+    balflt::RecordRef record;
+    int rc = record.reset(data, length);
+    ASSERT(0 == rc);
+//..
+// Then, we read the two fields in place:
+//..
+    bslstl::StringRef name;
+    double            price;
+
+    rc = record.getValue(&name, 1);
+    ASSERT(0 == rc);
+    rc = record.getValue(&price, 2);
+    ASSERT(0 == rc);
+//..
+// Notice that 'name' refers to the bytes of the encoding; no memory is
+// allocated, and no other field is read.
+
+        ASSERT("IBM" == name);
+        ASSERT(data + Util::fixedSize(3) == name.data());
+        ASSERT(162.5 == price);
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // NESTED BLOCKS AND CHOICES
+        //
+        // Concerns:
+        //: 1 A nested sequence or array field is bound to a 'RecordRef'
+        //:   referring to the nested block, and a nested choice field to a
+        //:   'ChoiceRef'.
+        //:
+        //: 2 A 'ChoiceRef' reports the (signed) selection id stored in the
+        //:   header of its block, and reads the selection from field 0.
+        //:
+        //: 3 A choice having no selection has the selection id -1, and
+        //:   reading its selection fails.
+        //:
+        //: 4 A nested block that is not contained in the reference to it, or
+        //:   whose fixed part does not fit in its length, is rejected,
+        //:   without effect on the result.
+        //:
+        //: 5 A default-constructed 'ChoiceRef' has no selection.
+        //
+        // Plan:
+        //: 1 Build a record holding a nested array of 'int', and a nested
+        //:   choice selecting a string, and read them.  (C-1..2)
+        //:
+        //: 2 Build a choice having no selection, and read it.  (C-3)
+        //:
+        //: 3 Corrupt the length of the nested block (in its header and in the
+        //:   reference to it), and verify that binding fails.  (C-4)
+        //:
+        //: 4 Verify the accessors of a default-constructed 'ChoiceRef'.
+        //:   (C-5)
+        //
+        // Testing:
+        //   int getValue(RecordRef *result, int index) const;
+        //   int getValue(ChoiceRef *result, int index) const;
+        //   ChoiceRef();
+        //   int reset(const char *data, bsl::size_t length);
+        //   const RecordRef& record() const;
+        //   int selectionId() const;
+        //   int getSelection(TYPE *result) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "NESTED BLOCKS AND CHOICES" << endl
+                          << "=========================" << endl;
+
+        if (verbose) cout << "\nDefault 'ChoiceRef'." << endl;
+        {
+            const ChoiceObj X;
+            ASSERT(-1 == X.selectionId());
+            ASSERT(0  == X.record().numFields());
+
+            int value;
+            ASSERT(0 != X.getSelection(&value));
+        }
+
+        AlignedBuffer buffer;
+        bsl::size_t   length;
+        {
+            BlockWriter writer(buffer.d_buffer, 2, 2);
+
+            BlockWriter array(writer.nested(), 3, 3);
+            array.putFixed(0, 10);
+            array.putFixed(1, 20);
+            array.putFixed(2, 30);
+            writer.commitNested(0, array.finish());
+
+            BlockWriter choice(writer.nested(), 1, 7);
+            choice.putBytes(0, "selected", 8);
+            writer.commitNested(1, choice.finish());
+
+            length = writer.finish();
+        }
+
+        if (verbose) cout << "\nValid nested blocks." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+            ASSERT(0 == mX.reset(buffer.d_buffer, length));
+
+            Obj array;
+            ASSERT(0 == X.getValue(&array, 0));
+            ASSERT(3 == array.numFields());
+            for (int i = 0; i < 3; ++i) {
+                int value;
+                ASSERTV(i, 0 == array.getValue(&value, i));
+                ASSERTV(i, 10 * (i + 1) == value);
+            }
+
+            ChoiceObj choice;
+            ASSERT(0 == X.getValue(&choice, 1));
+            ASSERT(7 == choice.selectionId());
+            ASSERT(1 == choice.record().numFields());
+
+            bslstl::StringRef selection;
+            ASSERT(0 == choice.getSelection(&selection));
+            ASSERT("selected" == selection);
+
+            // The format is not self-describing: the block of the choice is
+            // read as a record having 7 fields, which does not fit.
+
+            Obj asRecord;
+            ASSERT(0 != X.getValue(&asRecord, 1));
+        }
+
+        if (verbose) cout << "\nNo selection." << endl;
+        {
+            AlignedBuffer choiceBuffer;
+            BlockWriter   writer(choiceBuffer.d_buffer, 1, 0xFFFFFFFF);
+            const bsl::size_t LENGTH = writer.finish();
+
+            ChoiceObj mX;  const ChoiceObj& X = mX;
+            ASSERT(0  == mX.reset(choiceBuffer.d_buffer, LENGTH));
+            ASSERT(-1 == X.selectionId());
+
+            int value = 5;
+            ASSERT(0 != X.getSelection(&value));
+            ASSERT(5 == value);
+        }
+
+        if (verbose) cout << "\nMalformed nested blocks." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+            ASSERT(0 == mX.reset(buffer.d_buffer, length));
+
+            const unsigned int ARRAY_OFFSET = Util::getUint32(
+                                     buffer.d_buffer + Util::slotOffset(0));
+            char *arrayHeader = buffer.d_buffer + ARRAY_OFFSET;
+            const unsigned int ARRAY_LENGTH = Util::getUint32(arrayHeader);
+
+            // Nested length larger than the reference to it.
+
+            Util::putUint32(arrayHeader, ARRAY_LENGTH + 8);
+
+            Obj       nested;
+            ChoiceObj choice;
+            ASSERT(0 != X.getValue(&nested, 0));
+            ASSERT(0 == nested.numFields());
+            ASSERT(0 != X.getValue(&choice, 0));
+            ASSERT(-1 == choice.selectionId());
+
+            // Fixed part larger than the nested block.
+
+            Util::putUint32(arrayHeader, ARRAY_LENGTH);
+            Util::putUint32(arrayHeader + 4, 4);
+            ASSERT(0 != X.getValue(&nested, 0));
+            ASSERT(0 == nested.numFields());
+
+            // A choice requires room for its single slot and bitmap.
+
+            Util::putUint32(arrayHeader, 16);
+            ASSERT(0 != X.getValue(&choice, 0));
+
+            // Nested block too short to hold a header.
+
+            Util::putUint32(arrayHeader + 4, 3);
+            Util::putUint32(arrayHeader, ARRAY_LENGTH);
+            Util::putUint32(buffer.d_buffer + Util::slotOffset(0) + 4, 4);
+            ASSERT(0 != X.getValue(&nested, 0));
+            ASSERT(0 != X.getValue(&choice, 0));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // VARIABLE-SIZE FIELDS
+        //
+        // Concerns:
+        //: 1 A string field is read as a 'bslstl::StringRef' referring to the
+        //:   bytes in the block (without copying), or as a copy into a
+        //:   'bsl::string'.
+        //:
+        //: 2 A reference having length 0 reads as an empty string, whatever
+        //:   its offset.
+        //:
+        //: 3 A time zone-aware field is read from the 16 bytes it refers to.
+        //:
+        //: 4 A reference is rejected, without effect on the result, if it
+        //:   points into the fixed part of the block, if it extends past the
+        //:   end of the block, or (for a time zone-aware field) if its length
+        //:   is not 16.
+        //
+        // Plan:
+        //: 1 Build a block holding strings and time zone-aware values, and
+        //:   read them.  (C-1..3)
+        //:
+        //: 2 Using a table of offsets and lengths, including the boundaries of
+        //:   the variable area and values near 2^32, overwrite a reference
+        //:   and verify that reading succeeds or fails as expected.  (C-4)
+        //
+        // Testing:
+        //   int getValue(TZ_TYPE *result, int index) const;
+        //   int getValue(bslstl::StringRef *result, int index) const;
+        //   int getValue(bsl::string *result, int index) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "VARIABLE-SIZE FIELDS" << endl
+                          << "====================" << endl;
+
+        const bdlt::DateTz     DTZ(bdlt::Date(2026, 10, 19), -300);
+        const bdlt::TimeTz     TTZ(bdlt::Time(12, 34, 56, 789), 60);
+        const bdlt::DatetimeTz DTTZ(bdlt::Datetime(2026, 10, 19, 1, 2, 3),
+                                    330);
+
+        AlignedBuffer buffer;
+        bsl::size_t   length;
+        {
+            BlockWriter writer(buffer.d_buffer, 6, 6);
+            writer.putBytes(0, "hello, world", 12);
+            writer.putReference(1, 0, 0);
+            writer.putReference(2, 12345, 0);
+            writer.putTz(3, DTZ);
+            writer.putTz(4, TTZ);
+            writer.putTz(5, DTTZ);
+            length = writer.finish();
+        }
+
+        Obj mX;  const Obj& X = mX;
+        ASSERT(0 == mX.reset(buffer.d_buffer, length));
+
+        if (verbose) cout << "\nStrings." << endl;
+        {
+            bslstl::StringRef ref;
+            ASSERT(0 == X.getValue(&ref, 0));
+            ASSERT("hello, world" == ref);
+            ASSERT(buffer.d_buffer + Util::fixedSize(6) == ref.data());
+
+            bslma::TestAllocator sa("string", veryVerbose);
+            bsl::string          s(&sa);
+            ASSERT(0 == X.getValue(&s, 0));
+            ASSERT("hello, world" == s);
+
+            for (int i = 1; i <= 2; ++i) {
+                ref = "x";
+                s   = "x";
+                ASSERTV(i, 0 == X.getValue(&ref, i));
+                ASSERTV(i, ref.isEmpty());
+                ASSERTV(i, 0 == X.getValue(&s, i));
+                ASSERTV(i, s.empty());
+            }
+        }
+
+        if (verbose) cout << "\nTime zone-aware values." << endl;
+        {
+            bdlt::DateTz     dtz;
+            bdlt::TimeTz     ttz;
+            bdlt::DatetimeTz dttz;
+
+            ASSERT(0 == X.getValue(&dtz,  3));
+            ASSERT(0 == X.getValue(&ttz,  4));
+            ASSERT(0 == X.getValue(&dttz, 5));
+            ASSERT(DTZ  == dtz);
+            ASSERT(TTZ  == ttz);
+            ASSERT(DTTZ == dttz);
+
+            // Wrong length.
+
+            ASSERT(0 != X.getValue(&dtz, 0));
+            ASSERT(DTZ == dtz);
+        }
+
+        if (verbose) cout << "\nBounds." << endl;
+        {
+            const unsigned int FIXED = static_cast<unsigned int>(
+                                                          Util::fixedSize(6));
+            const unsigned int LEN   = static_cast<unsigned int>(length);
+
+            static const struct {
+                int          d_line;
+                unsigned int d_offset;   // 0xFFFFFFFF: 'FIXED', 0xFFFFFFFE:
+                                         // 'LEN'
+                int          d_delta;    // added to the offset
+                unsigned int d_length;
+                bool         d_valid;
+            } DATA[] = {
+                //LINE  OFFSET       DELTA  LENGTH       VALID
+                //----  ----------   -----  ----------   -----
+                { L_,   0xFFFFFFFF,   0,    1,           true  },
+                { L_,   0xFFFFFFFF,  -1,    1,           false },
+                { L_,   0,            0,    1,           false },
+                { L_,   0,            8,    1,           false },
+                { L_,   0xFFFFFFFE,  -1,    1,           true  },
+                { L_,   0xFFFFFFFE,   0,    1,           false },
+                { L_,   0xFFFFFFFE,  -8,    8,           true  },
+                { L_,   0xFFFFFFFE,  -8,    9,           false },
+                { L_,   0xFFFFFFFF,   0,    0xFFFFFFFF,  false },
+                { L_,   0xFFFFFFF0,   0,    0x20,        false },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int          LINE   = DATA[ti].d_line;
+                const unsigned int BASE   = 0xFFFFFFFF == DATA[ti].d_offset
+                                          ? FIXED
+                                          : 0xFFFFFFFE == DATA[ti].d_offset
+                                          ? LEN
+                                          : DATA[ti].d_offset;
+                const unsigned int OFFSET = BASE + DATA[ti].d_delta;
+                const unsigned int LENGTH = DATA[ti].d_length;
+                const bool         VALID  = DATA[ti].d_valid;
+
+                if (veryVerbose) { T_ P_(LINE) P_(OFFSET) P(LENGTH) }
+
+                char *slot = buffer.d_buffer + Util::slotOffset(0);
+                Util::putUint32(slot,     OFFSET);
+                Util::putUint32(slot + 4, LENGTH);
+
+                bslstl::StringRef ref("unchanged");
+                ASSERTV(LINE, VALID == (0 == X.getValue(&ref, 0)));
+                if (VALID) {
+                    ASSERTV(LINE, buffer.d_buffer + OFFSET == ref.data());
+                    ASSERTV(LINE, LENGTH == ref.length());
+                }
+                else {
+                    ASSERTV(LINE, "unchanged" == ref);
+                }
+            }
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // FIXED FIELDS AND NULLS
+        //
+        // Concerns:
+        //: 1 'isNull' reports the presence bit of a field, and reports a field
+        //:   whose index is not less than 'numFields()' as null.
+        //:
+        //: 2 A fixed field is read from its slot.
+        //:
+        //: 3 Reading a null or absent field fails, without effect on the
+        //:   result.
+        //:
+        //: 4 Fields beyond the first 64 use the subsequent bitmap words.
+        //:
+        //: 5 Reading a field holding an invalid date fails.
+        //
+        // Plan:
+        //: 1 Build a block of 70 slots in which every third slot is present
+        //:   and holds its index, and verify 'isNull' and 'getValue' for
+        //:   indices '0 .. 80'.  (C-1..4)
+        //:
+        //: 2 Build a block holding a value of several fixed types, and read
+        //:   each value.  (C-2)
+        //:
+        //: 3 Overwrite a date slot with an invalid representation and verify
+        //:   that reading it fails.  (C-5)
+        //
+        // Testing:
+        //   bool isNull(int index) const;
+        //   int getValue(TYPE *result, int index) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "FIXED FIELDS AND NULLS" << endl
+                          << "======================" << endl;
+
+        if (verbose) cout << "\nPresence." << endl;
+        {
+            const int N = 70;
+
+            AlignedBuffer buffer;
+            BlockWriter   writer(buffer.d_buffer, N, N);
+            for (int i = 0; i < N; i += 3) {
+                writer.putFixed(i, i);
+            }
+            const bsl::size_t LENGTH = writer.finish();
+
+            Obj mX;  const Obj& X = mX;
+            ASSERT(0 == mX.reset(buffer.d_buffer, LENGTH));
+
+            for (int i = 0; i < N + 10; ++i) {
+                const bool NULL_FIELD = i >= N || 0 != i % 3;
+
+                ASSERTV(i, NULL_FIELD == X.isNull(i));
+
+                int value = -1;
+                ASSERTV(i, NULL_FIELD == (0 != X.getValue(&value, i)));
+                ASSERTV(i, (NULL_FIELD ? -1 : i) == value);
+            }
+        }
+
+        if (verbose) cout << "\nFixed types." << endl;
+        {
+            AlignedBuffer buffer;
+            BlockWriter   writer(buffer.d_buffer, 8, 8);
+            writer.putFixed(0, true);
+            writer.putFixed(1, 'z');
+            writer.putFixed(2, static_cast<short>(-12345));
+            writer.putFixed(3, 4000000000U);
+            writer.putFixed(4, -(static_cast<Int64>(1) << 40));
+            writer.putFixed(5, 0.25f);
+            writer.putFixed(6, bdlt::Date(2026, 10, 19));
+            writer.putFixed(7, bdlt::Datetime(2026, 10, 19, 1, 2, 3, 4, 5));
+            const bsl::size_t LENGTH = writer.finish();
+
+            Obj mX;  const Obj& X = mX;
+            ASSERT(0 == mX.reset(buffer.d_buffer, LENGTH));
+
+            bool           b;
+            char           c;
+            short          s;
+            unsigned int   u;
+            Int64          i64;
+            float          f;
+            bdlt::Date     d;
+            bdlt::Datetime dt;
+
+            ASSERT(0 == X.getValue(&b,   0));
+            ASSERT(0 == X.getValue(&c,   1));
+            ASSERT(0 == X.getValue(&s,   2));
+            ASSERT(0 == X.getValue(&u,   3));
+            ASSERT(0 == X.getValue(&i64, 4));
+            ASSERT(0 == X.getValue(&f,   5));
+            ASSERT(0 == X.getValue(&d,   6));
+            ASSERT(0 == X.getValue(&dt,  7));
+
+            ASSERT(true                                         == b);
+            ASSERT('z'                                          == c);
+            ASSERT(-12345                                       == s);
+            ASSERT(4000000000U                                  == u);
+            ASSERT(-(static_cast<Int64>(1) << 40)               == i64);
+            ASSERT(0.25f                                        == f);
+            ASSERT(bdlt::Date(2026, 10, 19)                     == d);
+            ASSERT(bdlt::Datetime(2026, 10, 19, 1, 2, 3, 4, 5)  == dt);
+
+            Util::putUint64(buffer.d_buffer + Util::slotOffset(6),
+                            0xFFFFFFFF);
+            ASSERT(0 != X.getValue(&d, 6));
+            ASSERT(bdlt::Date(2026, 10, 19) == d);
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS, 'reset', AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 A default-constructed 'RecordRef' is unbound and has no fields.
+        //:
+        //: 2 'reset' binds to a block whose header describes a block contained
+        //:   in the supplied length, large enough for its fixed part.
+        //:
+        //: 3 'reset' rejects (leaving the reference unbound) a buffer shorter
+        //:   than a header, a block longer than the buffer, and a block too
+        //:   short for its fixed part, including for numbers of slots whose
+        //:   fixed part would overflow 32 bits.
+        //:
+        //: 4 The buffer is not modified and no memory is allocated.
+        //
+        // Plan:
+        //: 1 Verify the accessors of a default-constructed object.  (C-1)
+        //:
+        //: 2 Using a table of header values and buffer lengths, write the
+        //:   header to a buffer and verify the result of 'reset' and the
+        //:   accessors.  (C-2..3)
+        //:
+        //: 3 Compare the buffer with a copy, and verify that the default
+        //:   allocator is not used.  (C-4)
+        //
+        // Testing:
+        //   RecordRef();
+        //   int reset(const char *data, bsl::size_t length);
+        //   const char *data() const;
+        //   int length() const;
+        //   int numFields() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS, 'reset', AND BASIC ACCESSORS" << endl
+                          << "======================================" << endl;
+
+        {
+            const Obj X;
+            ASSERT(0 == X.data());
+            ASSERT(0 == X.length());
+            ASSERT(0 == X.numFields());
+            ASSERT(X.isNull(0));
+        }
+
+        static const struct {
+            int          d_line;
+            unsigned int d_blockLength;  // length in the header
+            unsigned int d_numSlots;     // word in the header
+            bsl::size_t  d_length;       // length supplied to 'reset'
+            bool         d_valid;
+        } DATA[] = {
+            //LINE  BLOCK LENGTH  NUM SLOTS    LENGTH  VALID
+            //----  ------------  -----------  ------  -----
+            { L_,   8,            0,           8,      true  },
+            { L_,   8,            0,           7,      false },
+            { L_,   8,            0,           0,      false },
+            { L_,   8,            0,           64,     true  },
+            { L_,   16,           0,           8,      false },
+            { L_,   24,           1,           24,     true  },
+            { L_,   16,           1,           24,     false },
+            { L_,   32,           1,           32,     true  },
+            { L_,   40,           2,           40,     true  },
+            { L_,   24,           2,           40,     false },
+            { L_,   528,          64,          528,    true  },
+            { L_,   536,          65,          536,    false },
+            { L_,   544,          65,          544,    true  },
+            { L_,   0,            0,           8,      false },
+            { L_,   64,           0x20000000,  64,     false },
+            { L_,   64,           0xFFFFFFFF,  64,     false },
+            { L_,   0xFFFFFFF8,   0,           64,     false },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int          LINE         = DATA[ti].d_line;
+            const unsigned int BLOCK_LENGTH = DATA[ti].d_blockLength;
+            const unsigned int NUM_SLOTS    = DATA[ti].d_numSlots;
+            const bsl::size_t  LENGTH       = DATA[ti].d_length;
+            const bool         VALID        = DATA[ti].d_valid;
+
+            if (veryVerbose) { T_ P_(LINE) P_(BLOCK_LENGTH) P(NUM_SLOTS) }
+
+            AlignedBuffer buffer;
+            bsl::memset(buffer.d_buffer, 0, sizeof buffer.d_buffer);
+            Util::putUint32(buffer.d_buffer,     BLOCK_LENGTH);
+            Util::putUint32(buffer.d_buffer + 4, NUM_SLOTS);
+
+            AlignedBuffer copy(buffer);
+
+            Obj mX;  const Obj& X = mX;
+
+            // Bind to a valid block first, to verify that a failed 'reset'
+            // leaves the reference unbound.
+
+            char valid[8] = { 8 };
+            ASSERTV(LINE, 0 == mX.reset(valid, sizeof valid));
+
+            ASSERTV(LINE, VALID == (0 == mX.reset(buffer.d_buffer, LENGTH)));
+            if (VALID) {
+                ASSERTV(LINE, buffer.d_buffer                == X.data());
+                ASSERTV(LINE, static_cast<int>(BLOCK_LENGTH) == X.length());
+                ASSERTV(LINE, static_cast<int>(NUM_SLOTS)    == X.numFields());
+            }
+            else {
+                ASSERTV(LINE, 0 == X.data());
+                ASSERTV(LINE, 0 == X.length());
+                ASSERTV(LINE, 0 == X.numFields());
+            }
+            ASSERTV(LINE, 0 == bsl::memcmp(buffer.d_buffer,
+                                           copy.d_buffer,
+                                           sizeof buffer.d_buffer));
+        }
+
+        ASSERT(0 == da.numAllocations());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The classes are sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Build a block holding an 'int', a string, a null field, and a
+        //:   nested record, and read each field.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        AlignedBuffer buffer;
+        bsl::size_t   length;
+        {
+            BlockWriter writer(buffer.d_buffer, 4, 4);
+            writer.putFixed(0, 42);
+            writer.putBytes(1, "abc", 3);
+
+            BlockWriter nested(writer.nested(), 1, 1);
+            nested.putFixed(0, 2.5);
+            writer.commitNested(3, nested.finish());
+
+            length = writer.finish();
+        }
+
+        Obj mX;  const Obj& X = mX;
+        ASSERT(0 == mX.reset(buffer.d_buffer, length));
+        ASSERT(4 == X.numFields());
+        ASSERT(static_cast<int>(length) == X.length());
+
+        int i;
+        ASSERT(0 == X.getValue(&i, 0));
+        ASSERT(42 == i);
+
+        bslstl::StringRef s;
+        ASSERT(0 == X.getValue(&s, 1));
+        ASSERT("abc" == s);
+
+        ASSERT(X.isNull(2));
+        ASSERT(0 != X.getValue(&i, 2));
+
+        Obj nested;
+        ASSERT(0 == X.getValue(&nested, 3));
+        ASSERT(1 == nested.numFields());
+
+        double d;
+        ASSERT(0 == nested.getValue(&d, 0));
+        ASSERT(2.5 == d);
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
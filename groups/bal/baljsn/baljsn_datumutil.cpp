@@ -10,11 +10,14 @@ BSLS_IDENT("$Id$ $CSID$")
 #include <bdlb_chartype.h>
 #include <bdlb_numericparseutil.h>
 #include <bdld_datum.h>
+#include <bdld_datumarena.h>
 #include <bdld_datumarraybuilder.h>
+#include <bdld_datummapbuilder.h>
 #include <bdld_datummapowningkeysbuilder.h>
 #include <bdld_manageddatum.h>
 #include <bdlde_utf8util.h>
 #include <bdlma_bufferedsequentialallocator.h>
+#include <bdlma_localsequentialallocator.h>
 #include <bdlsb_memoutstreambuf.h>
 
 #include <bsl_iostream.h>
@@ -22,6 +25,7 @@ BSLS_IDENT("$Id$ $CSID$")
 #include <bsl_string.h>
 #include <bsl_unordered_set.h>
 #include <bsls_alignedbuffer.h>
+#include <bsls_assert.h>
 
 namespace BloombergLP {
 namespace baljsn {
@@ -30,12 +34,15 @@ namespace {
 
 // LOCAL METHODS
 static int decodeValue(bdld::ManagedDatum *result,
+                       bdld::DatumArena   *arena,
                        bsl::ostream       *errorStream,
                        baljsn::Tokenizer  *tokenizer,
                        int                 maxNestedDepth);
     // Decode into the specified '*result' the JSON object in the specified
     // '*tokenizer', updating the specified '*errorStream' if any errors are
-    // detected, including if the specified 'maxNestedDepth' is exceeded.
+    // detected, including if the specified 'maxNestedDepth' is exceeded.  If
+    // the specified 'arena' is not 0, the keys of the decoded objects are
+    // interned in 'arena', which must supply the memory of 'result'.
 
 static int encodeValue(SimpleFormatter    *formatter,
                        const bdld::Datum&  datum,
@@ -47,13 +54,77 @@ static int encodeValue(SimpleFormatter    *formatter,
     // used for this value.  Return 0 on success, and a negative value if
     // 'datum' cannot be encoded'.
 
+static int decodeArenaObject(bdld::ManagedDatum *result,
+                             bdld::DatumArena   *arena,
+                             bsl::ostream       *errorStream,
+                             baljsn::Tokenizer  *tokenizer,
+                             int                 maxNestedDepth)
+    // Decode into the specified '*result' the members of the JSON object in
+    // the specified '*tokenizer', which must refer to the token following the
+    // start of the object, interning their keys in the specified 'arena',
+    // which must supply the memory of 'result'.  Update the specified
+    // '*errorStream' if any errors are detected, including if the specified
+    // 'maxNestedDepth' is exceeded.
+{
+    // Interned keys are unique, so duplicate keys are detected by address.
+
+    bdlma::LocalSequentialAllocator<512> keysAllocator;
+    bsl::unordered_set<const char *>     keys(&keysAllocator);
+
+    bdld::DatumMapBuilder builder(arena->allocator());
+
+    while (baljsn::Tokenizer::e_END_OBJECT != tokenizer->tokenType()) {
+        // If not e_END_OBJECT, we expect e_ELEMENT_NAME
+        if (baljsn::Tokenizer::e_ELEMENT_NAME != tokenizer->tokenType()) {
+            return -2;                                                // RETURN
+        }
+
+        bslstl::StringRef newKey;
+        tokenizer->value(&newKey);
+        const bslstl::StringRef key = arena->internKey(newKey);
+
+        // Advance from e_ELEMENT_NAME.  decodeValue checks the token, so we
+        // don't need to do it here.
+        tokenizer->advanceToNextToken();
+
+        bdld::ManagedDatum elementValue(result->allocator());
+
+        int rc = decodeValue(&elementValue,
+                             arena,
+                             errorStream,
+                             tokenizer,
+                             maxNestedDepth);
+
+        if (0 != rc) {
+            if (errorStream) {
+                *errorStream << "decodeValue failed, rc = " << rc << '\n';
+            }
+            return -3;                                                // RETURN
+        }
+
+        // Keep the FIRST instance of any duplicate keys.
+        if (keys.insert(key.data()).second) {
+            builder.pushBack(key, elementValue.release());
+        }
+
+        // Advance from e_ELEMENT_VALUE to e_ELEMENT_NAME or e_END_OBJECT
+        tokenizer->advanceToNextToken();
+    }
+
+    result->adopt(builder.commit());
+    return 0;
+}
+
 static int decodeObject(bdld::ManagedDatum *result,
+                        bdld::DatumArena   *arena,
                         bsl::ostream       *errorStream,
                         baljsn::Tokenizer  *tokenizer,
                         int                 maxNestedDepth)
     // Decode into the specified '*result' the JSON object in the specified
     // '*tokenizer', updating the specified '*errorStream' if any errors are
-    // detected, including if the specified 'maxNestedDepth' is exceeded.
+    // detected, including if the specified 'maxNestedDepth' is exceeded.  If
+    // the specified 'arena' is not 0, the keys of the object are interned in
+    // 'arena', which must supply the memory of 'result'.
 {
     if (maxNestedDepth < 0) {
         if (errorStream) {
@@ -71,6 +142,14 @@ static int decodeObject(bdld::ManagedDatum *result,
         return -1;                                                    // RETURN
     }
 
+    if (arena) {
+        return decodeArenaObject(result,
+                                 arena,
+                                 errorStream,
+                                 tokenizer,
+                                 maxNestedDepth);                     // RETURN
+    }
+
     bsl::unordered_set<bsl::string> keys;
     bsl::string                     key;
 
@@ -92,8 +171,11 @@ static int decodeObject(bdld::ManagedDatum *result,
 
         bdld::ManagedDatum elementValue(result->allocator());
 
-        int rc =
-            decodeValue(&elementValue, errorStream, tokenizer, maxNestedDepth);
+        int rc = decodeValue(&elementValue,
+                             0,
+                             errorStream,
+                             tokenizer,
+                             maxNestedDepth);
 
         if (0 != rc) {
             if (errorStream) {
@@ -117,12 +199,15 @@ static int decodeObject(bdld::ManagedDatum *result,
 }
 
 static int decodeArray(bdld::ManagedDatum *result,
+                       bdld::DatumArena   *arena,
                        bsl::ostream       *errorStream,
                        baljsn::Tokenizer  *tokenizer,
                        int                 maxNestedDepth)
     // Decode into the specified '*result' the JSON array in the specified
     // '*tokenizer', updating the specified '*errorStream' if any errors are
-    // detected, including if the specified 'maxNestedDepth' is exceeded.
+    // detected, including if the specified 'maxNestedDepth' is exceeded.  If
+    // the specified 'arena' is not 0, the keys of the decoded objects are
+    // interned in 'arena', which must supply the memory of 'result'.
 {
     if (maxNestedDepth < 0) {
         if (errorStream) {
@@ -146,8 +231,11 @@ static int decodeArray(bdld::ManagedDatum *result,
         // decodeValue checks the token, so we don't need to do it here.
         bdld::ManagedDatum elementValue(result->allocator());
 
-        int rc =
-            decodeValue(&elementValue, errorStream, tokenizer, maxNestedDepth);
+        int rc = decodeValue(&elementValue,
+                             arena,
+                             errorStream,
+                             tokenizer,
+                             maxNestedDepth);
 
         if (0 != rc) {
             if (errorStream) {
@@ -302,6 +390,7 @@ static int extractValue(bdld::ManagedDatum *result,
 
     if ('"' == value[0]) {
         bsl::string str(result->allocator());
+        str.reserve(value.length());
 
         if (0 == extractString(&str, value)) {
             result->adopt(bdld::Datum::copyString(str, result->allocator()));
@@ -322,14 +411,18 @@ static int extractValue(bdld::ManagedDatum *result,
 }
 
 static int decodeValue(bdld::ManagedDatum *result,
+                       bdld::DatumArena   *arena,
                        bsl::ostream       *errorStream,
                        baljsn::Tokenizer  *tokenizer,
                        int                 maxNestedDepth)
 {
     switch (tokenizer->tokenType()) {
       case baljsn::Tokenizer::e_START_OBJECT: {
-        int rc =
-            decodeObject(result, errorStream, tokenizer, maxNestedDepth - 1);
+        int rc = decodeObject(result,
+                              arena,
+                              errorStream,
+                              tokenizer,
+                              maxNestedDepth - 1);
         if (0 != rc) {
             if (errorStream) {
                 *errorStream << "decodeObject failed, rc = " << rc << '\n';
@@ -338,8 +431,11 @@ static int decodeValue(bdld::ManagedDatum *result,
         }
       } break;
       case baljsn::Tokenizer::e_START_ARRAY: {
-        int rc =
-            decodeArray(result, errorStream, tokenizer, maxNestedDepth - 1);
+        int rc = decodeArray(result,
+                             arena,
+                             errorStream,
+                             tokenizer,
+                             maxNestedDepth - 1);
         if (0 != rc) {
             if (errorStream) {
                 *errorStream << "decodeArray failed, rc = " << rc << '\n';
@@ -499,17 +595,17 @@ static int encodeValue(SimpleFormatter    *formatter,
     return result;
 }
 
-}  // close unnamed namespace
-
-                              // ----------------
-                              // struct DatumUtil
-                              // ----------------
-
-// CLASS METHODS
-int DatumUtil::decode(bdld::ManagedDatum         *result,
-                      bsl::ostream               *errorStream,
-                      bsl::streambuf             *jsonBuffer,
-                      const DatumDecoderOptions&  options)
+static int decodeDocument(bdld::ManagedDatum         *result,
+                          bdld::DatumArena           *arena,
+                          bsl::ostream               *errorStream,
+                          bsl::streambuf             *jsonBuffer,
+                          const DatumDecoderOptions&  options)
+    // Decode into the specified '*result' the JSON document provided by the
+    // specified 'jsonBuffer', according to the specified 'options', updating
+    // the specified '*errorStream' if any errors are detected.  If the
+    // specified 'arena' is not 0, the keys of the decoded objects are interned
+    // in 'arena', which must supply the memory of 'result'.  Return 0 on
+    // success, and a negative value otherwise.
 {
     bsls::AlignedBuffer<8 * 1024>      buffer;
     bdlma::BufferedSequentialAllocator bsa(
@@ -527,10 +623,11 @@ int DatumUtil::decode(bdld::ManagedDatum         *result,
         return -1;                                                    // RETURN
     }
 
-    bdld::ManagedDatum value(result->allocator());
-
-    int rc =
-        decodeValue(&value, errorStream, &tokenizer, options.maxNestedDepth());
+    int rc = decodeValue(result,
+                         arena,
+                         errorStream,
+                         &tokenizer,
+                         options.maxNestedDepth());
     if (0 != rc) {
         if (errorStream) {
             *errorStream << "decodeValue failed, rc = " << rc << '\n';
@@ -547,10 +644,52 @@ int DatumUtil::decode(bdld::ManagedDatum         *result,
         return -3;                                                    // RETURN
     }
 
+    return 0;
+}
+
+}  // close unnamed namespace
+
+                              // ----------------
+                              // struct DatumUtil
+                              // ----------------
+
+// CLASS METHODS
+int DatumUtil::decode(bdld::ManagedDatum         *result,
+                      bsl::ostream               *errorStream,
+                      bsl::streambuf             *jsonBuffer,
+                      const DatumDecoderOptions&  options)
+{
+    bdld::ManagedDatum value(result->allocator());
+
+    int rc = decodeDocument(&value, 0, errorStream, jsonBuffer, options);
+    if (0 != rc) {
+        return rc;                                                    // RETURN
+    }
+
     result->adopt(value.release());
     return 0;
 }
 
+int DatumUtil::decode(bdld::Datum                *result,
+                      bdld::DatumArena           *arena,
+                      bsl::ostream               *errorStream,
+                      bsl::streambuf             *jsonBuffer,
+                      const DatumDecoderOptions&  options)
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(arena);
+
+    bdld::ManagedDatum value(arena->allocator());
+
+    int rc = decodeDocument(&value, arena, errorStream, jsonBuffer, options);
+    if (0 != rc) {
+        return rc;                                                    // RETURN
+    }
+
+    *result = value.release();
+    return 0;
+}
+
 int DatumUtil::encode(bsl::string                *result,
                       const bdld::Datum&          datum,
                       const DatumEncoderOptions&  options)
@@ -5,6 +5,7 @@
 
 #include <bsl_climits.h>
 #include <bsl_cstddef.h>
+#include <bsl_cstdio.h>
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
 #include <bsl_iostream.h>
@@ -15,15 +16,18 @@
 
 #include <bslma_default.h>
 #include <bslma_defaultallocatorguard.h>
+#include <bslma_newdeleteallocator.h>
 #include <bslma_testallocator.h>            // to verify that we do not
 #include <bslma_testallocatormonitor.h>     // allocate any memory
 
 #include <bsls_alignedbuffer.h>
 #include <bsls_asserttest.h>
 #include <bsls_compilerfeatures.h>
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
 #include <bdld_datum.h>
+#include <bdld_datumarena.h>
 #include <bdld_datumarraybuilder.h>
 #include <bdld_datumerror.h>
 #include <bdld_datummaker.h>
@@ -75,12 +79,17 @@ using namespace bsl;
 // [ 5] int decode(MgedDatum*, streamBuf*, const DDOptions&);
 // [ 5] int decode(MgedDatum*, ostream*, streamBuf*);
 // [ 5] int decode(MgedDatum*, ostream*, streamBuf*, const DDOptions&);
+// [ 7] int decode(Datum*, DatumArena*, const StrRef&);
+// [ 7] int decode(Datum*, DatumArena*, const StrRef&, const DDOptions&);
+// [ 7] int decode(Datum*, DatumArena*, os*, const StrRef&, const DDOpt&);
+// [ 7] int decode(Datum*, DatumArena*, os*, streamBuf*, const DDOptions&);
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 2] BREATHING DECODE TEST
 // [ 3] BREATHING ENCODE TEST
 // [ 4] BREATHING ROUND-TRIP TEST
-// [ 7] USAGE EXAMPLE
+// [ 8] USAGE EXAMPLE
+// [-1] PERFORMANCE: DECODING INTO AN ARENA
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -257,7 +266,7 @@ int main(int argc, char *argv[])
     bslma::TestAllocatorMonitor gam(&ga);
 
     switch (test) { case 0:
-      case 7: {
+      case 8: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -457,6 +466,177 @@ int main(int argc, char *argv[])
 // number, and 'double' is the supported representation of a JSON number (see
 // {'Supported Types'}).
       } break;
+      case 7: {
+        //---------------------------------------------------------------------
+        // DECODE INTO AN ARENA
+        //   This case tests the 'decode' methods loading a 'Datum' built in a
+        //   'bdld::DatumArena'.
+        //
+        // Concerns:
+        //: 1 Decoding into an arena produces the same return code, and (on
+        //:   success) the same value, as decoding into a 'ManagedDatum'.
+        //:
+        //: 2 JSON objects with duplicate keys are decoded correctly,
+        //:   preserving the first key/value pair for a given key.
+        //:
+        //: 3 The keys of the decoded objects are interned: equal keys refer
+        //:   to the same memory.
+        //:
+        //: 4 All memory for the decoded value is supplied by the arena, and
+        //:   'result' is unchanged on failure.
+        //:
+        //: 5 The 'options' and 'errorStream' arguments are forwarded.
+        //
+        // Plan:
+        //: 1 For a table of valid and invalid JSON strings, decode each string
+        //:   into a 'ManagedDatum' and into an arena, and compare the return
+        //:   codes and values.  Verify that no memory from the default
+        //:   allocator remains in use.  (C-1..2, 4)
+        //:
+        //: 2 Decode an array of objects having the same keys, and verify that
+        //:   the keys of the objects have the same address, and the number of
+        //:   keys interned by the arena.  (C-3)
+        //:
+        //: 3 Decode JSON exceeding the default maximum depth with and without
+        //:   options, and with an error stream.  (C-5)
+        //
+        // Testing:
+        //  int decode(Datum*, DatumArena*, const StrRef&);
+        //  int decode(Datum*, DatumArena*, const StrRef&, const DDOptions&);
+        //  int decode(Datum*, DatumArena*, os*, const StrRef&, const DDOpt&);
+        //  int decode(Datum*, DatumArena*, os*, streamBuf*, const DDOptions&);
+        //---------------------------------------------------------------------
+
+        if (verbose) cout << endl << "DECODE INTO AN ARENA" << endl
+                                  << "====================" << endl;
+
+        static const struct {
+            int         d_line;
+            const char *d_json_p;
+        } DATA[] = {
+            { L_, ""                                                   },
+            { L_, "null"                                               },
+            { L_, "nul"                                                },
+            { L_, "2.5"                                                },
+            { L_, "\"hello\""                                          },
+            { L_, "\"esc\\u0041\\n\\\"aped\""                          },
+            { L_, "\"" STR256 "\""                                     },
+            { L_, "true"                                               },
+            { L_, "[]"                                                 },
+            { L_, "[}"                                                 },
+            { L_, "[]]"                                                },
+            { L_, "{}"                                                 },
+            { L_, "{\"\":1}"                                           },
+            { L_, "{\"\":1,\"\":2}"                                    },
+            { L_, "{\"a\":1,\"b\":2,\"a\":3}"                          },
+            { L_, "{\"a\":{\"a\":{\"a\":[\"a\"]}}}"                    },
+            { L_, "{\"a\":{\"a\":1,\"a\":2},\"b\":[{\"a\":1},{\"b\":2}]}" },
+            { L_, "{\"a\":1,\"b\":}"                                   },
+            { L_, "{\"a\":1 \"b\":2}"                                  },
+            { L_, "[{\"k\":\"" STR256 "\"},{\"k\":\"" STR64 "\"}]"     },
+            { L_, LONG_JSON_ARRAY                                      },
+            { L_, LONG_JSON_OBJECT                                     },
+            { L_, DEEP_JSON_OBJECT                                     },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE = DATA[ti].d_line;
+            const char *JSON = DATA[ti].d_json_p;
+
+            if (veryVerbose) { T_ P_(LINE) P(JSON) }
+
+            MD        expected(&ta);
+            const int EXPECTED_RC = Util::decode(&expected, JSON);
+
+            bslma::TestAllocator oa("arena", veryVeryVeryVerbose);
+            bdld::DatumArena     arena(&oa);
+
+            bslma::TestAllocatorMonitor dam(&da);
+
+            const D INITIAL = D::createInteger(-1);
+            D       result  = INITIAL;
+
+            int rc = Util::decode(&result, &arena, JSON);
+
+            ASSERTV(LINE, EXPECTED_RC, rc, EXPECTED_RC == rc);
+            if (0 == rc) {
+                ASSERTV(LINE, *expected, result, *expected == result);
+            }
+            else {
+                ASSERTV(LINE, INITIAL == result);
+            }
+            ASSERTV(LINE, dam.isInUseSame());
+        }
+
+        if (verbose) cout << "\nTesting interning of keys." << endl;
+        {
+            bslma::TestAllocator oa("arena", veryVeryVeryVerbose);
+            bdld::DatumArena     arena(&oa);
+
+            D result;
+
+            int rc = Util::decode(&result,
+                                  &arena,
+                                  "[{\"first\":\"Bart\",\"last\":\"Simpson\"},"
+                                  " {\"first\":\"Lisa\",\"last\":\"Simpson\"},"
+                                  " {\"last\":\"Flanders\",\"first\":\"Ned\"}"
+                                  "]");
+            ASSERTV(rc, 0 == rc);
+            ASSERTV(2 == arena.numInternedKeys());
+
+            const DAR people = result.theArray();
+            ASSERTV(3 == people.length());
+            ASSERTV(people[0].theMap()[0].key().data() ==
+                                      people[1].theMap()[0].key().data());
+            ASSERTV(people[0].theMap()[0].key().data() ==
+                                      people[2].theMap()[1].key().data());
+            ASSERTV(people[0].theMap()[1].key().data() ==
+                                      people[2].theMap()[0].key().data());
+            ASSERTV("Ned" == people[2].theMap().find("first")->theString());
+
+            arena.release();
+            ASSERTV(0 == arena.numInternedKeys());
+        }
+
+        if (verbose) cout << "\nTesting forwarding of arguments." << endl;
+        {
+            bslma::TestAllocator        oa("arena", veryVeryVeryVerbose);
+            bdld::DatumArena            arena(&oa);
+            baljsn::DatumDecoderOptions opt;
+            bsl::ostringstream          os(&ta);
+
+            MD expected(&ta);
+            opt.setMaxNestedDepth(96);
+            ASSERTV(0 == Util::decode(&expected, DEEP_JSON_ARRAY, opt));
+
+            D result;
+
+            int rc = Util::decode(&result, &arena, DEEP_JSON_ARRAY);
+            ASSERTV(rc, 0 != rc);
+
+            rc = Util::decode(&result, &arena, DEEP_JSON_ARRAY, opt);
+            ASSERTV(rc, 0 == rc);
+            ASSERTV(*expected == result);
+
+            opt.setMaxNestedDepth(95);
+            rc = Util::decode(&result, &arena, &os, DEEP_JSON_ARRAY, opt);
+            ASSERTV(rc, 0 != rc);
+            ASSERTV(os.str(), 0 != os.str().length());
+
+            os.str("");
+            os.clear();
+
+            opt.setMaxNestedDepth(96);
+            bdlsb::FixedMemInStreamBuf isb(DEEP_JSON_ARRAY,
+                                           bsl::strlen(DEEP_JSON_ARRAY));
+            result = D::createNull();
+            rc = Util::decode(&result, &arena, &os, &isb, opt);
+            ASSERTV(rc, 0 == rc);
+            ASSERTV(*expected == result);
+            ASSERTV(os.str(), 0 == os.str().length());
+        }
+      } break;
       case 6: {
         //---------------------------------------------------------------------
         // ENCODE AND PRINT TEST
@@ -2506,6 +2686,108 @@ int main(int argc, char *argv[])
         ASSERTV(datum, other, datum == other);
 
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: DECODING INTO AN ARENA
+        //
+        // Concerns:
+        //: 1 Decoding into an arena performs fewer allocations, and takes
+        //:   less time (to decode and to release the value), than decoding
+        //:   into a 'ManagedDatum'.
+        //
+        // Plan:
+        //: 1 Decode a document holding an array of objects having the same
+        //:   keys into a 'ManagedDatum' and into an arena, and report the
+        //:   number of allocations and the time taken to decode and release
+        //:   the value.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: DECODING INTO AN ARENA
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: DECODING INTO AN ARENA" << endl
+                          << "===================================" << endl;
+
+        const int NUM_RECORDS    = 10000;
+        const int NUM_ITERATIONS = 20;
+
+        bsl::string json("[", &ta);
+        for (int i = 0; i < NUM_RECORDS; ++i) {
+            char record[128];
+            bsl::sprintf(record,
+                         "%s{\"id\":%d,\"symbol\":\"SYMBOL%05d\","
+                         "\"venue\":\"PRIMARY EXCHANGE\","
+                         "\"price\":%d.25,\"side\":\"BUY\"}",
+                         i ? "," : "",
+                         i,
+                         i,
+                         i);
+            json += record;
+        }
+        json += "]";
+
+        bslma::Allocator *ma = &bslma::NewDeleteAllocator::singleton();
+
+        {
+            bslma::TestAllocator oa("counting", veryVeryVeryVerbose);
+
+            MD result(&oa);
+            ASSERTV(0 == Util::decode(&result, json));
+            cout << "allocations (ManagedDatum): " << oa.numAllocations()
+                 << endl;
+        }
+        {
+            bslma::TestAllocator oa("counting", veryVeryVeryVerbose);
+            bdld::DatumArena     arena(&oa);
+
+            D result;
+            ASSERTV(0 == Util::decode(&result, &arena, json));
+            cout << "allocations (DatumArena):   " << oa.numAllocations()
+                 << endl;
+        }
+
+        bsls::Stopwatch decode;
+        bsls::Stopwatch teardown;
+        for (int i = 0; i < NUM_ITERATIONS; ++i) {
+            MD result(ma);
+
+            decode.start();
+            ASSERTV(0 == Util::decode(&result, json));
+            decode.stop();
+
+            teardown.start();
+            result.makeNull();
+            teardown.stop();
+        }
+        cout << "ManagedDatum: decode "
+             << decode.elapsedTime() / NUM_ITERATIONS * 1000 << " ms"
+             << ", destroy "
+             << teardown.elapsedTime() / NUM_ITERATIONS * 1000 << " ms"
+             << endl;
+
+        decode.reset();
+        teardown.reset();
+        {
+            bdld::DatumArena arena(ma);
+            for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                D result;
+
+                decode.start();
+                ASSERTV(0 == Util::decode(&result, &arena, json));
+                decode.stop();
+
+                teardown.start();
+                arena.release();
+                teardown.stop();
+            }
+        }
+        cout << "DatumArena:   decode "
+             << decode.elapsedTime() / NUM_ITERATIONS * 1000 << " ms"
+             << ", release "
+             << teardown.elapsedTime() / NUM_ITERATIONS * 1000 << " ms"
+             << endl;
+      } break;
       default: {
         cerr << "WARNING: CASE '" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -4,7 +4,7 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(baljsn_encoder_cpp,"$Id$ $CSID$")
 
-#include <bdlde_base64encoder.h>
+#include <bdlde_base64util.h>
 
 namespace BloombergLP {
 namespace baljsn {
@@ -20,30 +20,17 @@ int Encoder_EncodeImplUtil::encodeCharArray(
                                   const EncoderOptions& encoderOptions)
 {
     bsl::string base64String;
-    bdlde::Base64Encoder encoder(0);
-    base64String.resize(
-       bdlde::Base64Encoder::encodedLength(static_cast<int>(value.size()), 0));
+    base64String.resize(bdlde::Base64Util::encodedLength(value.size(), 0));
 
-    // Ensure length is a multiple of 4.
-
-    BSLS_ASSERT(0 == (base64String.length() & 0x03));
+    const bsl::size_t numOut = bdlde::Base64Util::encode(base64String.data(),
+                                                         value.data(),
+                                                         value.size(),
+                                                         0);
 
-    int numOut;
-    int numIn;
-    int rc = encoder.convert(base64String.begin(),
-                             &numOut,
-                             &numIn,
-                             value.begin(),
-                             value.end());
-
-    if (rc < 0) {
-        return rc;                                                    // RETURN
-    }
+    // Ensure length is a multiple of 4.
 
-    rc = encoder.endConvert(base64String.begin() + numOut);
-    if (rc < 0) {
-        return rc;                                                    // RETURN
-    }
+    BSLS_ASSERT(0 == (numOut & 0x03));
+    (void)numOut;
 
     return encodeSimpleValue(formatter,
                   base64String,
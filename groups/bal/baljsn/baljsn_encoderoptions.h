@@ -32,10 +32,8 @@ BSLS_IDENT("$Id: $")
 //                      bool           true            none
 //  datetimeFractionalSecondPrecision
 //                      int            3               >= 0 and <= 6
-//  maxFloatPrecision   int            bsl::numeric_limits<float>::digits10
-//                                                     >= 1 and <= 9
-//  maxDoublePrecision  int            bsl::numeric_limits<double>::digits10
-//                                                     >= 1 and <= 17
+//  maxFloatPrecision   int            0               >= 0 and <= 9
+//  maxDoublePrecision  int            0               >= 0 and <= 17
 //..
 //: o 'encodingStyle': encoding style used to encode the JSON data.
 //:
@@ -72,10 +70,16 @@ BSLS_IDENT("$Id: $")
 //:                                        'DatetimeTz'.
 //:
 //: o 'maxFloatPrecision': option specifying the maximum number of decimal
-//:                        places used to encode each 'float' value.
+//:                        places used to encode each 'float' value.  If the
+//:                        option value is 0 (the default), each 'float' value
+//:                        is encoded with the fewest digits that round-trip
+//:                        (see 'bdlb_floatformatutil').
 //:
 //: o 'maxDoublePrecision': option specifying the maximum number of decimal
-//:                         places used to encode each 'double' value.
+//:                         places used to encode each 'double' value.  If the
+//:                         option value is 0 (the default), each 'double'
+//:                         value is encoded with the fewest digits that
+//:                         round-trip (see 'bdlb_floatformatutil').
 //
 ///Implementation Note
 ///- - - - - - - - - -
@@ -113,11 +117,8 @@ BSLS_IDENT("$Id: $")
 //  assert(false == options.encodeNullElements());
 //  assert(false == options.encodeInfAndNaNAsStrings());
 //  assert(3     == options.datetimeFractionalSecondPrecision());
-//  assert(bsl::numeric_limits<float>::digits10
-//                                             == options.maxFloatPrecision());
-//  assert(bsl::numeric_limits<double>::digits10
-//                                            ==
-//                                            options.maxDoublePrecision());
+//  assert(0     == options.maxFloatPrecision());
+//  assert(0     == options.maxDoublePrecision());
 //  assert(true == options.encodeQuotedDecimal64());
 //..
 // Next, we populate that object to encode in a pretty format using a
@@ -197,7 +198,8 @@ class EncoderOptions {
     // milliseconds printed with date time values.  By default a precision of
     // '3' decimal places is used.  The 'MaxFloatPrecision' and
     // 'MaxDoublePrecision' attributes allow specifying the maximum precision
-    // for 'float' and 'double' values.
+    // for 'float' and 'double' values.  By default (a precision of '0') each
+    // value is encoded with the fewest digits that round-trip.
 
     // INSTANCE DATA
     int                   d_initialIndentLevel;
@@ -705,7 +707,7 @@ void EncoderOptions::setDatetimeFractionalSecondPrecision(int value)
 inline
 void EncoderOptions::setMaxFloatPrecision(int value)
 {
-    BSLS_ASSERT(1 <= value     );
+    BSLS_ASSERT(0 <= value     );
     BSLS_ASSERT(     value <= 9);
 
     d_maxFloatPrecision = value;
@@ -714,7 +716,7 @@ void EncoderOptions::setMaxFloatPrecision(int value)
 inline
 void EncoderOptions::setMaxDoublePrecision(int value)
 {
-    BSLS_ASSERT(1 <= value     );
+    BSLS_ASSERT(0 <= value     );
     BSLS_ASSERT(     value <= 17);
 
     d_maxDoublePrecision = value;
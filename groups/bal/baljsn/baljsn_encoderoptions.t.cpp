@@ -309,7 +309,7 @@ const DefaultDataRow DEFAULT_DATA[] =
 //----  ------     ---     -----     ---    ---    ----- --- -- --  ---
 
 // default (must be first)
-{ L_,       0,       0,    COMPACT,  false, false, false, 3, 6, 15, true  },
+{ L_,       0,       0,    COMPACT,  false, false, false, 3, 0,  0, true  },
 
 // 'initialIndentLevel'
 { L_,       1,       0,    PRETTY,   false, false, false, 3, 9, 17, true  },
@@ -432,10 +432,8 @@ int main(int argc, char *argv[])
     ASSERT(false == options.encodeNullElements());
     ASSERT(false == options.encodeInfAndNaNAsStrings());
     ASSERT(3     == options.datetimeFractionalSecondPrecision());
-    ASSERT(bsl::numeric_limits<float>::digits10
-                                               == options.maxFloatPrecision());
-    ASSERT(bsl::numeric_limits<double>::digits10
-                                              == options.maxDoublePrecision());
+    ASSERT(0     == options.maxFloatPrecision());
+    ASSERT(0     == options.maxDoublePrecision());
     ASSERT(true == options.encodeQuotedDecimal64());
 //..
 // Next, we populate that object to encode in a pretty format using a
@@ -1551,8 +1549,8 @@ int main(int argc, char *argv[])
                                  "encodeNullElements = true"                 NL
                                  "encodeInfAndNaNAsStrings = true"           NL
                                  "datetimeFractionalSecondPrecision = 3"     NL
-                                 "maxFloatPrecision = 6"                     NL
-                                 "maxDoublePrecision = 15"                   NL
+                                 "maxFloatPrecision = 0"                     NL
+                                 "maxDoublePrecision = 0"                   NL
                                  "encodeQuotedDecimal64 = true"              NL
                                         "]"                                  NL
                                                                              },
@@ -1566,8 +1564,8 @@ int main(int argc, char *argv[])
                                  " encodeNullElements = true"                NL
                                  " encodeInfAndNaNAsStrings = true"          NL
                                  " datetimeFractionalSecondPrecision = 3"    NL
-                                 " maxFloatPrecision = 6"                    NL
-                                 " maxDoublePrecision = 15"                  NL
+                                 " maxFloatPrecision = 0"                    NL
+                                 " maxDoublePrecision = 0"                  NL
                                  " encodeQuotedDecimal64 = true"             NL
                                        "]"                                   NL
                                                                              },
@@ -1581,8 +1579,8 @@ int main(int argc, char *argv[])
                                  "encodeNullElements = false"                SP
                                  "encodeInfAndNaNAsStrings = true"           SP
                                  "datetimeFractionalSecondPrecision = 3"     SP
-                                 "maxFloatPrecision = 6"                     SP
-                                 "maxDoublePrecision = 15"                   SP
+                                 "maxFloatPrecision = 0"                     SP
+                                 "maxDoublePrecision = 0"                   SP
                                  "encodeQuotedDecimal64 = true"              SP
                                        "]"
                                                                              },
@@ -1603,8 +1601,8 @@ int main(int argc, char *argv[])
                                  "encodeNullElements = true"                 NL
                                  "encodeInfAndNaNAsStrings = true"           NL
                                  "datetimeFractionalSecondPrecision = 3"     NL
-                                 "maxFloatPrecision = 6"                     NL
-                                 "maxDoublePrecision = 15"                   NL
+                                 "maxFloatPrecision = 0"                     NL
+                                 "maxDoublePrecision = 0"                   NL
                                  "encodeQuotedDecimal64 = true"              NL
                                        "]"                                   NL
                                                                              },
@@ -1618,8 +1616,8 @@ int main(int argc, char *argv[])
                          "        encodeNullElements = false"                NL
                          "        encodeInfAndNaNAsStrings = true"           NL
                          "        datetimeFractionalSecondPrecision = 3"     NL
-                         "        maxFloatPrecision = 6"                     NL
-                         "        maxDoublePrecision = 15"                   NL
+                         "        maxFloatPrecision = 0"                     NL
+                         "        maxDoublePrecision = 0"                   NL
                          "        encodeQuotedDecimal64 = true"              NL
                                "      ]"                                     NL
                                                                              },
@@ -1633,8 +1631,8 @@ int main(int argc, char *argv[])
                                  "encodeNullElements = false"                SP
                                  "encodeInfAndNaNAsStrings = true"           SP
                                  "datetimeFractionalSecondPrecision = 3"     SP
-                                 "maxFloatPrecision = 6"                     SP
-                                 "maxDoublePrecision = 15"                   SP
+                                 "maxFloatPrecision = 0"                     SP
+                                 "maxDoublePrecision = 0"                   SP
                                  "encodeQuotedDecimal64 = true"              SP
                                        "]"
                                                                              },
@@ -1648,8 +1646,8 @@ int main(int argc, char *argv[])
                                  "encodeNullElements = true"                 NL
                                  "encodeInfAndNaNAsStrings = true"           NL
                                  "datetimeFractionalSecondPrecision = 3"     NL
-                                 "maxFloatPrecision = 6"                     NL
-                                 "maxDoublePrecision = 15"                   NL
+                                 "maxFloatPrecision = 0"                     NL
+                                 "maxDoublePrecision = 0"                   NL
                                  "encodeQuotedDecimal64 = true"              NL
                                        "]"                                   NL
                                                                              },
@@ -1663,8 +1661,8 @@ int main(int argc, char *argv[])
                          "        encodeNullElements = false"                NL
                          "        encodeInfAndNaNAsStrings = true"           NL
                          "        datetimeFractionalSecondPrecision = 3"     NL
-                         "        maxFloatPrecision = 6"                     NL
-                         "        maxDoublePrecision = 15"                   NL
+                         "        maxFloatPrecision = 0"                     NL
+                         "        maxDoublePrecision = 0"                   NL
                          "        encodeQuotedDecimal64 = true"              NL
                                "      ]"                                     NL
                                                                              },
@@ -1677,8 +1675,8 @@ int main(int argc, char *argv[])
                                  "encodeNullElements = true"                 SP
                                  "encodeInfAndNaNAsStrings = true"           SP
                                  "datetimeFractionalSecondPrecision = 3"     SP
-                                 "maxFloatPrecision = 6"                     SP
-                                 "maxDoublePrecision = 15"                   SP
+                                 "maxFloatPrecision = 0"                     SP
+                                 "maxDoublePrecision = 0"                   SP
                                  "encodeQuotedDecimal64 = false"             SP
                                        "]"
                                                                              },
@@ -1699,8 +1697,8 @@ int main(int argc, char *argv[])
                          "         encodeNullElements = true"                NL
                          "         encodeInfAndNaNAsStrings = true"          NL
                          "         datetimeFractionalSecondPrecision = 3"    NL
-                         "         maxFloatPrecision = 6"                    NL
-                         "         maxDoublePrecision = 15"                  NL
+                         "         maxFloatPrecision = 0"                    NL
+                         "         maxDoublePrecision = 0"                  NL
                          "         encodeQuotedDecimal64 = true"             NL
                                "      ]"                                     NL
                                                                              },
@@ -1721,8 +1719,8 @@ int main(int argc, char *argv[])
                                  "encodeNullElements = true"                 SP
                                  "encodeInfAndNaNAsStrings = true"           SP
                                  "datetimeFractionalSecondPrecision = 3"     SP
-                                 "maxFloatPrecision = 6"                     SP
-                                 "maxDoublePrecision = 15"                   SP
+                                 "maxFloatPrecision = 0"                     SP
+                                 "maxDoublePrecision = 0"                   SP
                                  "encodeQuotedDecimal64 = true"              SP
                                  "]" },
 
@@ -1735,8 +1733,8 @@ int main(int argc, char *argv[])
                                  "encodeNullElements = false"                SP
                                  "encodeInfAndNaNAsStrings = true"           SP
                                  "datetimeFractionalSecondPrecision = 3"     SP
-                                 "maxFloatPrecision = 6"                     SP
-                                 "maxDoublePrecision = 15"                   SP
+                                 "maxFloatPrecision = 0"                     SP
+                                 "maxDoublePrecision = 0"                   SP
                                  "encodeQuotedDecimal64 = true"              SP
                                  "]" },
 
@@ -1876,8 +1874,8 @@ int main(int argc, char *argv[])
         const bool  D5   = false;                // 'encodeNullElements'
         const bool  D6   = false;                // 'encodeInfAndNaNAsStrings'
         const int   D7   = 3;                    // 'datetimePrecision'
-        const int   D8   = 6;                    // 'maxFloatPrecision'
-        const int   D9   = 15;                   // 'maxDoublePrecision'
+        const int   D8   = 0;                    // 'maxFloatPrecision'
+        const int   D9   = 0;                    // 'maxDoublePrecision'
         const bool  D10  = true;                 // 'encodeQuotedDecimal64'
 
                        // ----------------------------
@@ -2088,8 +2086,8 @@ int main(int argc, char *argv[])
         const bool  D5   = false;                // 'encodeNullElements'
         const bool  D6   = false;                // 'encodeInfAndNaNAsStrings'
         const int   D7   = 3;            // 'datetimeFractionalSecondPrecision'
-        const int   D8   = 6;                    // 'maxFloatPrecision'
-        const int   D9   = 15;                   // 'maxDoublePrecision'
+        const int   D8   = 0;                    // 'maxFloatPrecision'
+        const int   D9   = 0;                    // 'maxDoublePrecision'
         const bool  D10  = true;                 // 'encodeQuotedDecimal64'
         // 'A' values.
 
@@ -2710,16 +2708,16 @@ int main(int argc, char *argv[])
 
             if (veryVerbose) cout << "\tmaxFloatPrecision" << endl;
             {
-                ASSERT_SAFE_FAIL(obj.setMaxFloatPrecision(0));
-                ASSERT_SAFE_PASS(obj.setMaxFloatPrecision(1));
+                ASSERT_SAFE_FAIL(obj.setMaxFloatPrecision(-1));
+                ASSERT_SAFE_PASS(obj.setMaxFloatPrecision(0));
                 ASSERT_SAFE_PASS(obj.setMaxFloatPrecision(9));
                 ASSERT_SAFE_FAIL(obj.setMaxFloatPrecision(10));
             }
 
             if (veryVerbose) cout << "\tmaxDoublePrecision" << endl;
             {
-                ASSERT_SAFE_FAIL(obj.setMaxDoublePrecision(0));
-                ASSERT_SAFE_PASS(obj.setMaxDoublePrecision(1));
+                ASSERT_SAFE_FAIL(obj.setMaxDoublePrecision(-1));
+                ASSERT_SAFE_PASS(obj.setMaxDoublePrecision(0));
                 ASSERT_SAFE_PASS(obj.setMaxDoublePrecision(17));
                 ASSERT_SAFE_FAIL(obj.setMaxDoublePrecision(18));
             }
@@ -2759,8 +2757,8 @@ int main(int argc, char *argv[])
         const bool  D5   = false;                // 'encodeNullElements'
         const bool  D6   = false;                // 'encodeInfAndNaNAsStrings'
         const int   D7   = 3;            // 'datetimeFractionalSecondPrecision'
-        const int   D8   = 6;                    // 'maxFloatPrecision'
-        const int   D9   = 15;                   // 'maxDoublePrecision'
+        const int   D8   = 0;                    // 'maxFloatPrecision'
+        const int   D9   = 0;                    // 'maxDoublePrecision'
         const bool  D10  = true;                 // 'encodeQuotedDecimal64'
 
         if (verbose) cout <<
@@ -2866,12 +2864,12 @@ int main(int argc, char *argv[])
 
         // Attribute 8 Values: 'maxFloatPrecision'
 
-        const T8 D8 = 6;           // default value
+        const T8 D8 = 0;           // default value
         const T8 A8 = 6;
 
         // Attribute 9 Values: 'maxDoublePrecision'
 
-        const T9 D9 = 15;          // default value
+        const T9 D9 = 0;           // default value
         const T9 A9 = 9;
 
         // Attribute 10 Values: 'encodeQuotedDecimal64'
@@ -6,7 +6,7 @@ BSLS_IDENT_RCSID(baljsn_parserutil_cpp,"$Id$ $CSID$")
 
 #include <bdlma_bufferedsequentialallocator.h>
 
-#include <bdlde_base64decoder.h>
+#include <bdlde_base64util.h>
 #include <bdlde_charconvertutf32.h>
 
 #include <bdlb_chartype.h>
@@ -624,25 +624,19 @@ int ParserUtil::getValue(bsl::vector<char> *value,
         return -1;                                                    // RETURN
     }
 
-    value->clear();
-
-    bdlde::Base64Decoder base64Decoder(true);
-    bsl::back_insert_iterator<bsl::vector<char> > outputIterator(*value);
-
-    rc = base64Decoder.convert(outputIterator,
-                               base64String.begin(),
-                               base64String.end());
-
-    if (rc < 0) {
-        return rc;                                                    // RETURN
-    }
-
-    rc = base64Decoder.endConvert(outputIterator);
+    value->resize(bdlde::Base64Util::maxDecodedLength(base64String.size()));
 
-    if (rc < 0) {
-        return rc;                                                    // RETURN
+    bsl::size_t numOut = 0;
+    rc = bdlde::Base64Util::decode(value->data(),
+                                   &numOut,
+                                   base64String.data(),
+                                   base64String.size());
+    if (rc) {
+        value->clear();
+        return -1;                                                    // RETURN
     }
 
+    value->resize(numOut);
     return 0;
 }
 }  // close package namespace
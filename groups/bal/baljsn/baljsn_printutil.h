@@ -82,6 +82,7 @@ BSLS_IDENT("$Id: $")
 #include <baljsn_encoderoptions.h>
 
 #include <bdlb_float.h>
+#include <bdlb_floatformatutil.h>
 
 #include <bdldfp_decimal.h>
 #include <bdldfp_decimalconvertutil.h>
@@ -117,8 +118,10 @@ struct PrintUtil {
     template <class TYPE>
     static int maxStreamPrecision(const baljsn::EncoderOptions *options);
         // Return the maximum precision for streaming values of the specified
-        // template parameter 'TYPE' using the specified 'options' to decide.
-        // The behavior is undefined unless 'TYPE' is 'float' or 'double'.
+        // template parameter 'TYPE' using the specified 'options' to decide,
+        // or 0 if values are to be streamed with the fewest digits that
+        // round-trip.  The behavior is undefined unless 'TYPE' is 'float' or
+        // 'double'.
 
   public:
     // CLASS METHODS
@@ -136,7 +139,10 @@ struct PrintUtil {
                                   const EncoderOptions *options);
         // Encode the specified floating point 'value' into JSON and output the
         // result to the specified 'stream'.  Use the optionally-specified
-        // 'options' to decide how 'value' is encoded.
+        // 'options' to decide how 'value' is encoded.  If 'options' is 0, or
+        // specifies a maximum precision of 0 for 'TYPE', 'value' is encoded
+        // with the fewest digits that round-trip (see
+        // 'bdlb_floatformatutil').
 
     static int printString(bsl::ostream&             stream,
                            const bslstl::StringRef&  value);
@@ -229,9 +235,7 @@ template <>
 inline
 int PrintUtil::maxStreamPrecision<float>(const baljsn::EncoderOptions *options)
 {
-    return options
-           ? options->maxFloatPrecision()
-           : bsl::numeric_limits<float>::digits10;
+    return options ? options->maxFloatPrecision() : 0;
 }
 
 template <>
@@ -239,10 +243,7 @@ inline
 int PrintUtil::maxStreamPrecision<double>(
                                          const baljsn::EncoderOptions *options)
 {
-
-    return options
-           ? options->maxDoublePrecision()
-           : bsl::numeric_limits<double>::digits10;
+    return options ? options->maxDoublePrecision() : 0;
 }
 
 // CLASS METHODS
@@ -302,6 +303,13 @@ int PrintUtil::printFloatingPoint(bsl::ostream&                 stream,
         const int k_SIZE = 32;
         char      buffer[k_SIZE];
 
+        const int precision = maxStreamPrecision<TYPE>(options);
+        if (0 == precision) {
+            stream.write(buffer,
+                         bdlb::FloatFormatUtil::formatShortest(buffer, value));
+            return 0;                                                 // RETURN
+        }
+
 #if defined(BSLS_PLATFORM_CMP_MSVC)
 #define snprintf _snprintf
 #endif
@@ -309,7 +317,7 @@ int PrintUtil::printFloatingPoint(bsl::ostream&                 stream,
         const int len = snprintf(buffer,
                                  k_SIZE,
                                  "%-1.*g",
-                                 maxStreamPrecision<TYPE>(options),
+                                 precision,
                                  value);
 
 #if defined(BSLS_PLATFORM_CMP_MSVC)
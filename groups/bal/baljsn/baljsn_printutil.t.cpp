@@ -13,6 +13,7 @@
 #include <bslim_testutil.h>
 #include <bsls_platform.h>
 
+#include <bsl_cfloat.h>
 #include <bsl_climits.h>
 #include <bsl_cmath.h>
 #include <bsl_cstdlib.h>
@@ -697,6 +698,9 @@ int main(int argc, char *argv[])
         //: 2 Encoded numbers used default format.
         //:
         //: 3 Encoding 'unsigned char' prints a number instead of string.
+        //:
+        //: 4 By default, and when the maximum precision option is 0, floating
+        //:   point numbers are encoded with the fewest digits that round-trip.
         //
         // Plan:
         //: 1 Use the table-driven technique:
@@ -744,17 +748,14 @@ int main(int argc, char *argv[])
                 { L_,           10.0f,  "10" },
                 { L_,           -1.5f,  "-1.5" },
                 { L_,         -1.5e1f,  "-15" },
-#if defined(BALJSN_PRINTUTIL_EXTRA_ZERO_PADDING_FOR_EXPONENTS)
-                { L_,   -1.23456e-20f,  "-1.23456e-020" },
-                { L_,    1.23456e-20f,  "1.23456e-020" },
-#else
                 { L_,   -1.23456e-20f,  "-1.23456e-20" },
                 { L_,    1.23456e-20f,  "1.23456e-20" },
-#endif
                 { L_,         1.0e-1f,  "0.1" },
                 { L_,       0.123456f,  "0.123456" },
-                { L_,    0.123456789f,  "0.123457" },
-                { L_,   0.1234567891f,  "0.123457" },
+                { L_,    0.123456789f,  "0.12345679" },
+                { L_,   0.1234567891f,  "0.12345679" },
+                { L_,         1.0e9f,  "1e+09" },
+                { L_,        FLT_MAX,  "3.4028235e+38" },
             };
             const int NUM_DATA = sizeof DATA / sizeof *DATA;
 
@@ -865,6 +866,8 @@ int main(int argc, char *argv[])
                 { L_,  0.1234567891f, 1, "0.1" },
                 { L_,  0.1234567891f, 4, "0.1235" },
                 { L_,  0.1234567891f, 9, "0.123456791" },
+                { L_,  0.1234567891f, 0, "0.12345679" },
+                { L_,           0.1f, 0, "0.1" },
 
 #if defined(BALJSN_PRINTUTIL_EXTRA_ZERO_PADDING_FOR_EXPONENTS)
                 { L_,           10.0, 1, "1e+001" },
@@ -930,8 +933,13 @@ int main(int argc, char *argv[])
                 { L_,             1.0e-1,  "0.1" },
                 { L_,          2.23e-308,  "2.23e-308" },
                 { L_,   0.12345678912345,  "0.12345678912345" },
-                { L_,  0.12345678901234567,  "0.123456789012346" },
-                { L_, 0.123456789012345678,  "0.123456789012346" },
+                { L_,  0.12345678901234567,  "0.12345678901234566" },
+                { L_, 0.123456789012345678,  "0.12345678901234568" },
+                { L_,          0.1 + 0.2,  "0.30000000000000004" },
+                { L_,             100.25,  "100.25" },
+                { L_,               1e16,  "10000000000000000" },
+                { L_,               1e17,  "1e+17" },
+                { L_,            DBL_MAX,  "1.7976931348623157e+308" },
             };
             const int NUM_DATA = sizeof DATA / sizeof *DATA;
 
@@ -987,6 +995,9 @@ int main(int argc, char *argv[])
       { L_,     0.123456789012345678, 15, "0.123456789012346" },
       { L_,     0.123456789012345678, 16, "0.1234567890123457" },
       { L_,     0.123456789012345678, 17, "0.12345678901234568" },
+      { L_,     0.123456789012345678,  0, "0.12345678901234568" },
+      { L_,                      0.1,  0, "0.1" },
+      { L_,                 3.14e300,  0, "3.14e+300" },
 
 #if defined(BALJSN_PRINTUTIL_EXTRA_ZERO_PADDING_FOR_EXPONENTS)
       { L_,                     10.0,  1, "1e+001" },
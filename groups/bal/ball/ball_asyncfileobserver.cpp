@@ -96,6 +96,10 @@ void AsyncFileObserver::publishThreadEntryPoint()
             done = true;
         }
         else {
+            // Format a deferred message (if any) on this thread.
+
+            asyncRecord.d_record->fixedFields().formatDeferredMessage();
+
             d_fileObserver.publish(*asyncRecord.d_record,
                                    asyncRecord.d_context);
         }
@@ -213,6 +213,17 @@ BSLS_IDENT("$Id: $")
 // is desired instead, consider using either the '%D' or '%O' format
 // specification supported by 'ball_recordstringformatter'.
 //
+///Deferred Message Formatting
+///- - - - - - - - - - - - - -
+// The message of a record logged by the 'BALL_LOGDEFER_*' macros of
+// 'ball_log' is captured as a format string and arguments (see
+// 'ball_deferredmessage'), and formatted only when it is first read.  The
+// publication thread of an async file observer formats the deferred message
+// of each record it dequeues before publishing it, so that the formatting
+// cost is not borne by the logging thread (unless another observer, or a
+// triggered publication of the logger's record buffer, reads the message
+// first).
+//
 ///Log Record Timestamps
 ///---------------------
 // By default, the timestamp attributes of published records are written in UTC
@@ -0,0 +1,473 @@
+// ball_compressedfilestreambuf.cpp                                   -*-C++-*-
+#include <ball_compressedfilestreambuf.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ball_compressedfilestreambuf_cpp,"$Id$ $CSID$")
+
+#include <ball_compressedfileutil.h>  // for testing only
+
+#include <bdlf_memfn.h>
+
+#include <bslma_default.h>
+
+#include <bslmt_lockguard.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_climits.h>
+#include <bsl_cstring.h>
+
+#include <zstd/zstd.h>
+
+///Implementation Notes
+///--------------------
+// The put area of the stream buffer is always one of the 'k_NUM_BUFFERS'
+// buffers allocated at 'reset' (except after an error, when it is empty).
+// Every other buffer is either free, pending (in 'd_pendingFrames'), or being
+// compressed by the compression thread, which returns it to the free buffers
+// once its frame is written.  Buffers are exchanged, and frames handed off,
+// under 'd_mutex'; the characters of a buffer are only accessed by the thread
+// owning it (the writing thread for the put area, the compression thread for
+// the frame being compressed).
+//
+// The compression thread exists while the stream buffer is associated with a
+// file, so that 'clear' (and thus a log file rotation) completes only once
+// every frame has been written.
+//
+// After an error, the compression thread discards the frames handed off to it
+// rather than writing them, since a frame written after a partially written
+// frame would not be decodable.
+
+namespace BloombergLP {
+namespace ball {
+
+namespace {
+namespace u {
+
+int compressFrame(bsl::size_t                          *numBytesWritten,
+                  ZSTD_CCtx                            *context,
+                  bsl::vector<char>                    *output,
+                  const char                           *frame,
+                  bsl::size_t                           frameLength,
+                  bdls::FilesystemUtil::FileDescriptor  descriptor)
+    // Compress the specified 'frameLength' characters at the specified 'frame'
+    // into a Zstandard frame, using the specified 'context' and 'output'
+    // buffer, and write it to the file having the specified 'descriptor'.
+    // Load the size of the frame written into the specified
+    // 'numBytesWritten'.  Return 0 on success, and a non-zero value otherwise.
+{
+    const bsl::size_t length = ZSTD_compress2(context,
+                                              output->data(),
+                                              output->size(),
+                                              frame,
+                                              frameLength);
+    if (ZSTD_isError(length)) {
+        return -1;                                                    // RETURN
+    }
+
+    const char  *data      = output->data();
+    bsl::size_t  remaining = length;
+
+    while (0 < remaining) {
+        const int chunk = static_cast<int>(
+                                 bsl::min<bsl::size_t>(remaining, INT_MAX));
+
+        const int rc = bdls::FilesystemUtil::write(descriptor, data, chunk);
+        if (0 >= rc) {
+            return -1;                                                // RETURN
+        }
+
+        data      += rc;
+        remaining -= rc;
+    }
+
+    *numBytesWritten = length;
+    return 0;
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+                       // -----------------------------
+                       // class CompressedFileStreamBuf
+                       // -----------------------------
+
+// CONSTANTS
+const bsl::size_t CompressedFileStreamBuf::k_DEFAULT_FRAME_SIZE;
+const int         CompressedFileStreamBuf::k_NUM_BUFFERS;
+
+// PRIVATE MANIPULATORS
+void CompressedFileStreamBuf::deallocateBuffers()
+{
+    BSLS_ASSERT(!isOpened());
+
+    for (bsl::size_t i = 0; i < d_buffers.size(); ++i) {
+        d_allocator_p->deallocate(d_buffers[i]);
+    }
+    d_buffers.clear();
+    d_freeBuffers.clear();
+}
+
+int CompressedFileStreamBuf::handOff(bool waitFlag)
+{
+    char              *buffer = pbase();
+    const bsl::size_t  length = pptr() - pbase();
+
+    setp(0, 0);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    if (0 < length) {
+        d_pendingFrames.push_back(Frame(buffer, length));
+        d_numBytesHandedOff += length;
+        d_workCondition.signal();
+        buffer = 0;
+    }
+
+    if (waitFlag) {
+        while (!d_pendingFrames.empty() || d_busyFlag) {
+            d_doneCondition.wait(&d_mutex);
+        }
+    }
+
+    if (!buffer) {
+        while (d_freeBuffers.empty()) {
+            d_doneCondition.wait(&d_mutex);
+        }
+        buffer = d_freeBuffers.back();
+        d_freeBuffers.pop_back();
+    }
+
+    if (d_errorFlag) {
+        d_freeBuffers.push_back(buffer);
+        return -1;                                                    // RETURN
+    }
+
+    setp(buffer, buffer + d_frameSize);
+    return 0;
+}
+
+void CompressedFileStreamBuf::run()
+{
+    ZSTD_CCtx *context = ZSTD_createCCtx();
+
+    const bool contextFlag =
+           context
+        && !ZSTD_isError(ZSTD_CCtx_setParameter(context,
+                                                ZSTD_c_compressionLevel,
+                                                d_compressionLevel))
+        && !ZSTD_isError(ZSTD_CCtx_setParameter(context,
+                                                ZSTD_c_checksumFlag,
+                                                1));
+
+    bsl::vector<char> output(ZSTD_compressBound(d_frameSize),
+                             d_allocator_p);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    if (!contextFlag) {
+        d_errorFlag = true;
+    }
+
+    while (true) {
+        while (d_pendingFrames.empty() && !d_stopFlag) {
+            d_workCondition.wait(&d_mutex);
+        }
+        if (d_pendingFrames.empty()) {
+            break;
+        }
+
+        const Frame frame     = d_pendingFrames.front();
+        const bool  errorFlag = d_errorFlag;
+
+        d_pendingFrames.pop_front();
+        d_busyFlag = true;
+
+        int         rc     = 0;
+        bsl::size_t length = 0;
+
+        if (!errorFlag) {
+            bslmt::LockGuardUnlock<bslmt::Mutex> unlockGuard(&d_mutex);
+
+            rc = u::compressFrame(&length,
+                                  context,
+                                  &output,
+                                  frame.first,
+                                  frame.second,
+                                  d_descriptor);
+        }
+
+        d_busyFlag = false;
+        d_freeBuffers.push_back(frame.first);
+
+        if (0 != rc) {
+            d_errorFlag = true;
+        }
+        else {
+            d_position += static_cast<bsls::Types::Int64>(length);
+        }
+
+        d_doneCondition.broadcast();
+    }
+
+    ZSTD_freeCCtx(context);
+}
+
+// CLASS METHODS
+bool CompressedFileStreamBuf::isValidCompressionLevel(int level)
+{
+    return ZSTD_minCLevel() <= level && level <= ZSTD_maxCLevel();
+}
+
+// CREATORS
+CompressedFileStreamBuf::CompressedFileStreamBuf(
+                                              bslma::Allocator *basicAllocator)
+: d_descriptor(bdls::FilesystemUtil::k_INVALID_FD)
+, d_willCloseFlag(false)
+, d_frameSize(k_DEFAULT_FRAME_SIZE)
+, d_compressionLevel(0)
+, d_buffers(basicAllocator)
+, d_freeBuffers(basicAllocator)
+, d_pendingFrames(basicAllocator)
+, d_busyFlag(false)
+, d_stopFlag(false)
+, d_errorFlag(false)
+, d_position(0)
+, d_numBytesHandedOff(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+CompressedFileStreamBuf::~CompressedFileStreamBuf()
+{
+    clear();
+    deallocateBuffers();
+}
+
+// MANIPULATORS
+int CompressedFileStreamBuf::clear()
+{
+    if (!isOpened()) {
+        return 0;                                                     // RETURN
+    }
+
+    int rc = handOff(true);
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        d_stopFlag = true;
+        d_workCondition.signal();
+    }
+    bslmt::ThreadUtil::join(d_thread);
+
+    if (pbase()) {
+        d_freeBuffers.push_back(pbase());
+        setp(0, 0);
+    }
+
+    if (d_errorFlag) {
+        rc = -1;
+    }
+    if (d_willCloseFlag && 0 != bdls::FilesystemUtil::close(d_descriptor)) {
+        rc = -1;
+    }
+
+    d_descriptor        = bdls::FilesystemUtil::k_INVALID_FD;
+    d_willCloseFlag     = false;
+    d_stopFlag          = false;
+    d_errorFlag         = false;
+    d_position          = 0;
+    d_numBytesHandedOff = 0;
+
+    return rc;
+}
+
+int CompressedFileStreamBuf::flush()
+{
+    if (!isOpened()) {
+        return 0;                                                     // RETURN
+    }
+
+    return handOff(true);
+}
+
+int CompressedFileStreamBuf::reset(
+                     bdls::FilesystemUtil::FileDescriptor descriptor,
+                     bool                                 willCloseOnResetFlag,
+                     bsl::size_t                          frameSize,
+                     int                                  compressionLevel)
+{
+    BSLS_ASSERT(bdls::FilesystemUtil::k_INVALID_FD != descriptor);
+    BSLS_ASSERT(isValidCompressionLevel(compressionLevel));
+
+    int rc = clear();
+
+    const bdls::FilesystemUtil::Offset fileSize = bdls::FilesystemUtil::seek(
+                                       descriptor,
+                                       0,
+                                       bdls::FilesystemUtil::e_SEEK_FROM_END);
+    if (0 > fileSize) {
+        if (willCloseOnResetFlag) {
+            bdls::FilesystemUtil::close(descriptor);
+        }
+        return -1;                                                    // RETURN
+    }
+
+    if (0 == frameSize) {
+        frameSize = k_DEFAULT_FRAME_SIZE;
+    }
+    if (frameSize != d_frameSize) {
+        deallocateBuffers();
+        d_frameSize = frameSize;
+    }
+    if (d_buffers.empty()) {
+        d_buffers.reserve(k_NUM_BUFFERS);
+        d_freeBuffers.reserve(k_NUM_BUFFERS);
+
+        for (int i = 0; i < k_NUM_BUFFERS; ++i) {
+            d_buffers.push_back(static_cast<char *>(
+                                      d_allocator_p->allocate(d_frameSize)));
+            d_freeBuffers.push_back(d_buffers.back());
+        }
+    }
+
+    d_descriptor       = descriptor;
+    d_willCloseFlag    = willCloseOnResetFlag;
+    d_compressionLevel = compressionLevel;
+    d_position         = fileSize;
+
+    typedef CompressedFileStreamBuf Self;
+
+    if (0 != bslmt::ThreadUtil::create(&d_thread,
+                                       bdlf::MemFnUtil::memFn(&Self::run,
+                                                              this))) {
+        if (willCloseOnResetFlag) {
+            bdls::FilesystemUtil::close(descriptor);
+        }
+        d_descriptor = bdls::FilesystemUtil::k_INVALID_FD;
+        d_position   = 0;
+        return -1;                                                    // RETURN
+    }
+
+    char *buffer = d_freeBuffers.back();
+    d_freeBuffers.pop_back();
+    setp(buffer, buffer + d_frameSize);
+
+    return rc;
+}
+
+// ACCESSORS
+bsls::Types::Int64 CompressedFileStreamBuf::numBytesWritten() const
+{
+    if (!isOpened()) {
+        return 0;                                                     // RETURN
+    }
+    return d_numBytesHandedOff + (pptr() - pbase());
+}
+
+bsls::Types::Int64 CompressedFileStreamBuf::position() const
+{
+    if (!isOpened()) {
+        return -1;                                                    // RETURN
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return d_position;
+}
+
+// PROTECTED MANIPULATORS
+CompressedFileStreamBuf::int_type
+CompressedFileStreamBuf::overflow(int_type c)
+{
+    if (!isOpened() || 0 != handOff(false)) {
+        return traits_type::eof();                                    // RETURN
+    }
+
+    if (traits_type::eq_int_type(c, traits_type::eof())) {
+        return traits_type::not_eof(c);                               // RETURN
+    }
+
+    *pptr() = traits_type::to_char_type(c);
+    pbump(1);
+
+    return c;
+}
+
+CompressedFileStreamBuf::pos_type
+CompressedFileStreamBuf::seekoff(off_type                offset,
+                                 bsl::ios_base::seekdir  whence,
+                                 bsl::ios_base::openmode mode)
+{
+    if (!isOpened()
+     || 0 != offset
+     || bsl::ios_base::beg == whence
+     || 0 == (mode & bsl::ios_base::out)) {
+        return pos_type(-1);                                          // RETURN
+    }
+
+    return pos_type(position());
+}
+
+CompressedFileStreamBuf::pos_type
+CompressedFileStreamBuf::seekpos(pos_type, bsl::ios_base::openmode)
+{
+    return pos_type(-1);
+}
+
+int CompressedFileStreamBuf::sync()
+{
+    if (!isOpened()) {
+        return -1;                                                    // RETURN
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return d_errorFlag ? -1 : 0;
+}
+
+bsl::streamsize CompressedFileStreamBuf::xsputn(const char      *buffer,
+                                                bsl::streamsize  numBytes)
+{
+    BSLS_ASSERT(buffer || 0 == numBytes);
+
+    bsl::streamsize numWritten = 0;
+
+    while (numWritten < numBytes) {
+        if (epptr() == pptr()
+         && traits_type::eq_int_type(overflow(), traits_type::eof())) {
+            break;
+        }
+
+        const bsl::streamsize n = bsl::min<bsl::streamsize>(
+                                                        numBytes - numWritten,
+                                                        epptr() - pptr());
+
+        bsl::memcpy(pptr(), buffer + numWritten, static_cast<bsl::size_t>(n));
+        pbump(static_cast<int>(n));
+        numWritten += n;
+    }
+
+    return numWritten;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,389 @@
+// ball_compressedfilestreambuf.h                                     -*-C++-*-
+#ifndef INCLUDED_BALL_COMPRESSEDFILESTREAMBUF
+#define INCLUDED_BALL_COMPRESSEDFILESTREAMBUF
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an output stream buffer writing compressed file frames.
+//
+//@CLASSES:
+//  ball::CompressedFileStreamBuf: output 'streambuf' compressing in background
+//
+//@SEE_ALSO: ball_compressedfileutil, ball_fileobserver2
+//
+//@DESCRIPTION: This component provides a class,
+// 'ball::CompressedFileStreamBuf', that implements the output portion of the
+// 'bsl::basic_streambuf' protocol by compressing the characters written to it
+// with the Zstandard algorithm, and appending them to a file.  Characters are
+// collected in a buffer of a fixed size, the *frame* *size*; each time the
+// buffer is full, it is handed off to a thread owned by the stream buffer,
+// which compresses it into a single Zstandard frame (carrying its
+// uncompressed size and a checksum of its content) and writes that frame to
+// the file, while the thread writing to the stream buffer continues with
+// another buffer.  The writing thread therefore only copies characters and,
+// once per frame, exchanges buffers; it blocks only if the compression thread
+// falls so far behind that all buffers are waiting to be compressed.
+//
+// Each frame is independently decodable, and a file written by a
+// 'CompressedFileStreamBuf' is a sequence of frames, in the standard Zstandard
+// format, that can be read by 'ball::CompressedFileUtil' (see
+// 'ball_compressedfileutil') or by the 'zstd' command-line tool.  Since a
+// frame is written only when complete, a file that is appended to by a process
+// that terminates abnormally contains the frames completed before
+// termination, and no partial frame (unless the process terminates while
+// writing a frame).
+// Appending to a file that already contains frames (e.g., when a log file is
+// reopened) produces a file that is decoded as the concatenation of the
+// content of both.
+//
+///Frame Boundaries
+///----------------
+// 'sync' (and therefore 'bsl::ostream::flush') does *not* end the current
+// frame: doing so on every flush would reduce the compression ratio of output
+// that is flushed often (e.g., after each log record) to almost nothing.
+// Instead, characters written are buffered until the frame is full, the
+// 'flush' manipulator of this class is called, or the stream buffer is
+// cleared, reset, or destroyed.  Note that, until then, characters written are
+// not visible to readers of the file, and are lost if the process terminates
+// abnormally.
+//
+///Position
+///--------
+// 'seekoff' supports reporting the current position (as used by
+// 'bsl::ostream::tellp'), which is the size of the file *after* the frames
+// written so far: i.e., the offset in the file at which the next frame will be
+// written.  The position therefore grows in steps, as frames are written, and
+// lags the characters written to the stream buffer by up to several frames.
+// No other form of seeking is supported.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Writing a Compressed File
+///- - - - - - - - - - - - - - - - - -
+// Suppose that we want to write a large amount of repetitive text, such as a
+// log, to a file, using as little disk bandwidth as possible.
+//
+// First, we open the file:
+//..
+//  typedef bdls::FilesystemUtil FileUtil;
+//
+//  FileUtil::FileDescriptor fd = FileUtil::open(fileName,
+//                                               FileUtil::e_OPEN_OR_CREATE,
+//                                               FileUtil::e_READ_WRITE,
+//                                               FileUtil::e_TRUNCATE);
+//  assert(FileUtil::k_INVALID_FD != fd);
+//..
+// Then, we create a 'ball::CompressedFileStreamBuf', associate it with the
+// file, using 16 kilobyte frames, and create an 'bsl::ostream' using it:
+//..
+//  ball::CompressedFileStreamBuf streamBuf;
+//
+//  int rc = streamBuf.reset(fd, true, 16 * 1024);
+//  assert(0 == rc);
+//
+//  bsl::ostream os(&streamBuf);
+//..
+// Next, we write the text:
+//..
+//  for (int i = 0; i < 10000; ++i) {
+//      os << "INFO request " << i << " processed successfully\n";
+//  }
+//  assert(os);
+//..
+// Then, we clear the stream buffer, which compresses and writes the last
+// frame, waits for all frames to be written, and closes the file:
+//..
+//  rc = streamBuf.clear();
+//  assert(0 == rc);
+//..
+// Finally, we read the file back with 'ball::CompressedFileUtil', and observe
+// that it is a fraction of the size of its content:
+//..
+//  bsl::ostringstream content;
+//
+//  rc = ball::CompressedFileUtil::decompressFile(content, fileName);
+//  assert(0 == rc);
+//  assert(FileUtil::getFileSize(fileName) * 5 <
+//                                    static_cast<int>(content.str().size()));
+//..
+
+#include <balscm_version.h>
+
+#include <bdls_filesystemutil.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_condition.h>
+#include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_deque.h>
+#include <bsl_ios.h>
+#include <bsl_streambuf.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace ball {
+
+                       // =============================
+                       // class CompressedFileStreamBuf
+                       // =============================
+
+class CompressedFileStreamBuf : public bsl::streambuf {
+    // This class implements the output portion of the 'bsl::streambuf'
+    // protocol, compressing the characters written to it into independently
+    // decodable Zstandard frames that are written to a file by a thread owned
+    // by this object.  Input and seeking (other than reporting the current
+    // position) are not supported.
+
+    // PRIVATE TYPES
+    typedef bdls::FilesystemUtil::FileDescriptor FileDescriptor;
+    typedef bsl::pair<char *, bsl::size_t>       Frame;
+
+    // DATA
+    FileDescriptor             d_descriptor;        // file written, or
+                                                    // 'k_INVALID_FD'
+
+    bool                       d_willCloseFlag;     // 'true' if
+                                                    // 'd_descriptor' is
+                                                    // closed by 'clear'
+
+    bsl::size_t                d_frameSize;         // size of each buffer
+
+    int                        d_compressionLevel;  // Zstandard level
+
+    bsl::vector<char *>        d_buffers;           // all buffers (owned)
+
+    bsl::vector<char *>        d_freeBuffers;       // buffers available to
+                                                    // the put area
+
+    bsl::deque<Frame>          d_pendingFrames;     // buffers waiting to be
+                                                    // compressed
+
+    bool                       d_busyFlag;          // 'true' while the
+                                                    // thread compresses a
+                                                    // frame
+
+    bool                       d_stopFlag;          // 'true' if the thread
+                                                    // is to exit
+
+    bool                       d_errorFlag;         // 'true' if compressing
+                                                    // or writing failed
+
+    bsls::Types::Int64         d_position;          // size of the file after
+                                                    // the frames written
+
+    bsls::Types::Int64         d_numBytesHandedOff; // characters handed off
+                                                    // to the thread
+
+    mutable bslmt::Mutex       d_mutex;             // guards the state
+                                                    // shared with the thread
+
+    bslmt::Condition           d_workCondition;     // signaled when a frame
+                                                    // is pending, or on stop
+
+    bslmt::Condition           d_doneCondition;     // signaled when a frame
+                                                    // has been written
+
+    bslmt::ThreadUtil::Handle  d_thread;            // compression thread
+
+    bslma::Allocator          *d_allocator_p;       // memory allocator (held)
+
+  private:
+    // NOT IMPLEMENTED
+    CompressedFileStreamBuf(const CompressedFileStreamBuf&);
+    CompressedFileStreamBuf& operator=(const CompressedFileStreamBuf&);
+
+    // PRIVATE MANIPULATORS
+    void deallocateBuffers();
+        // Deallocate the buffers of this object.  The behavior is undefined
+        // unless this object is not associated with a file.
+
+    int handOff(bool waitFlag);
+        // Hand off the characters in the put area, if any, to be compressed,
+        // and make a free buffer the put area, waiting for one if necessary.
+        // If the specified 'waitFlag' is 'true', also wait for all frames
+        // handed off to be written.  Return 0 on success, and a non-zero
+        // value if an error occurred (in which case the put area is empty).
+
+    void run();
+        // Compress and write the frames handed off to this object until it is
+        // stopped and no frame is pending.  This method is the body of the
+        // compression thread.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(CompressedFileStreamBuf,
+                                   bslma::UsesBslmaAllocator);
+
+    // CONSTANTS
+    static const bsl::size_t k_DEFAULT_FRAME_SIZE = 64 * 1024;
+        // default number of characters compressed into each frame
+
+    static const int         k_NUM_BUFFERS = 4;
+        // number of buffers, including that of the put area
+
+    // CLASS METHODS
+    static bool isValidCompressionLevel(int level);
+        // Return 'true' if the specified 'level' is a compression level
+        // supported by the Zstandard library (including 0, selecting the
+        // default level, and the negative levels trading compression ratio
+        // for speed), and 'false' otherwise.
+
+    // CREATORS
+    explicit CompressedFileStreamBuf(bslma::Allocator *basicAllocator = 0);
+        // Create a stream buffer that is not associated with a file.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.
+
+    virtual ~CompressedFileStreamBuf();
+        // Clear this stream buffer (see 'clear') and destroy it.
+
+    // MANIPULATORS
+    int clear();
+        // Compress and write the characters not yet written, wait for all
+        // frames to be written, stop the compression thread, close the
+        // associated file if so specified at 'reset', and disassociate this
+        // object from the file.  Return 0 on success, and a non-zero value
+        // otherwise (in which case this object is still disassociated from
+        // the file).  This method has no effect, and returns 0, if this object
+        // is not associated with a file.
+
+    int flush();
+        // Compress the characters written since the last frame into a frame,
+        // even if it is not full, and wait for all frames to be written.
+        // Return 0 on success, and a non-zero value if an error occurred (now
+        // or earlier).  This method has no effect, and returns 0, if no
+        // characters have been written since the last frame.  Note that
+        // frequent calls reduce the compression ratio.
+
+    int reset(bdls::FilesystemUtil::FileDescriptor descriptor,
+              bool                                 willCloseOnResetFlag = true,
+              bsl::size_t                          frameSize = 0,
+              int                                  compressionLevel = 0);
+        // Clear this stream buffer (see 'clear') and associate it with the
+        // specified 'descriptor', to the end of which frames are appended.
+        // Optionally specify a 'willCloseOnResetFlag' indicating whether
+        // 'descriptor' is closed when this object is cleared, reset, or
+        // destroyed.  Optionally specify a 'frameSize', the number of
+        // characters compressed into each frame; if 'frameSize' is 0,
+        // 'k_DEFAULT_FRAME_SIZE' is used.  Optionally specify a
+        // 'compressionLevel'; if 'compressionLevel' is 0, the default level of
+        // the Zstandard library is used.  Return 0 on success, and a non-zero
+        // value otherwise (in which case this object is not associated with a
+        // file, and 'descriptor' is closed if 'willCloseOnResetFlag' is
+        // 'true').  The behavior is undefined unless 'descriptor' refers to a
+        // file open for writing, and
+        // 'isValidCompressionLevel(compressionLevel)'.
+
+    // ACCESSORS
+    bsl::size_t frameSize() const;
+        // Return the number of characters compressed into each frame.
+
+    bool isOpened() const;
+        // Return 'true' if this object is associated with a file, and 'false'
+        // otherwise.
+
+    bsls::Types::Int64 numBytesWritten() const;
+        // Return the number of (uncompressed) characters written to this
+        // object since it was last reset, or 0 if it is not associated with a
+        // file.
+
+    bsls::Types::Int64 position() const;
+        // Return the size of the associated file after the frames written so
+        // far (see {Position}), or -1 if this object is not associated with a
+        // file.
+
+  protected:
+    // PROTECTED MEMBER FUNCTIONS
+
+    // The following member functions override protected virtual functions
+    // inherited from the base class, and are specified to be protected as part
+    // of the standard library 'bsl::streambuf' interface.
+
+    // PROTECTED MANIPULATORS
+    virtual int_type overflow(int_type c = traits_type::eof());
+        // Hand off the full put area to be compressed and, unless the
+        // optionally specified 'c' is 'traits_type::eof()', write 'c' to the
+        // next buffer.  Return 'traits_type::eof()' on failure, and a value
+        // other than 'traits_type::eof()' otherwise.
+
+    virtual pos_type seekoff(
+        off_type                offset,
+        bsl::ios_base::seekdir  whence,
+        bsl::ios_base::openmode mode = bsl::ios_base::in | bsl::ios_base::out);
+        // Return the current position, as for 'position', if the specified
+        // 'offset' is 0, the specified 'whence' is 'bsl::ios_base::cur' or
+        // 'bsl::ios_base::end', and the optionally specified 'mode' includes
+        // 'bsl::ios_base::out', and -1 otherwise.
+
+    virtual pos_type seekpos(
+        pos_type                position,
+        bsl::ios_base::openmode mode = bsl::ios_base::in | bsl::ios_base::out);
+        // Return -1.  Note that the specified 'position' and 'mode' are
+        // ignored, since seeking is not supported.
+
+    virtual int sync();
+        // Return 0 if this object is associated with a file and no output
+        // error has occurred, and -1 otherwise.  Note that this method does
+        // not end the current frame (see {Frame Boundaries}).
+
+    virtual bsl::streamsize xsputn(const char      *buffer,
+                                   bsl::streamsize  numBytes);
+        // Write up to the specified 'numBytes' characters from the specified
+        // 'buffer' to this object, handing off each buffer filled, and return
+        // the number of characters written.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                       // -----------------------------
+                       // class CompressedFileStreamBuf
+                       // -----------------------------
+
+// ACCESSORS
+inline
+bsl::size_t CompressedFileStreamBuf::frameSize() const
+{
+    return d_frameSize;
+}
+
+inline
+bool CompressedFileStreamBuf::isOpened() const
+{
+    return bdls::FilesystemUtil::k_INVALID_FD != d_descriptor;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,929 @@
+// ball_compressedfilestreambuf.t.cpp                                 -*-C++-*-
+#include <ball_compressedfilestreambuf.h>
+
+#include <ball_compressedfileutil.h>
+
+#include <bdls_fdstreambuf.h>
+#include <bdls_filesystemutil.h>
+#include <bdls_pathutil.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_platform.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_fstream.h>
+#include <bsl_iostream.h>
+#include <bsl_ostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+#include <zstd/zstd.h>
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>
+#endif
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+using bsl::flush;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test provides a mechanism, an output stream buffer
+// compressing the characters written to it into Zstandard frames written to a
+// file by a thread it owns.  It is tested by writing to files in a temporary
+// directory, and decompressing them with 'ball::CompressedFileUtil'; the
+// frames of the files are also inspected with the Zstandard library, to verify
+// that they are complete, independent, and of the expected content sizes.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] static bool isValidCompressionLevel(int level);
+//
+// CREATORS
+// [ 2] explicit CompressedFileStreamBuf(bslma::Allocator *basicAllocator);
+// [ 2] ~CompressedFileStreamBuf();
+//
+// MANIPULATORS
+// [ 2] int clear();
+// [ 3] int flush();
+// [ 2] int reset(descriptor, willCloseFlag, frameSize, compressionLevel);
+// [ 3] int_type overflow(int_type c);
+// [ 3] pos_type seekoff(off_type, seekdir, openmode);
+// [ 3] pos_type seekpos(pos_type, openmode);
+// [ 3] int sync();
+// [ 3] bsl::streamsize xsputn(const char *buffer, bsl::streamsize numBytes);
+//
+// ACCESSORS
+// [ 2] bsl::size_t frameSize() const;
+// [ 2] bool isOpened() const;
+// [ 3] bsls::Types::Int64 numBytesWritten() const;
+// [ 3] bsls::Types::Int64 position() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CONCERN: OUTPUT ERRORS
+// [ 5] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST: FLUSHED LOG LINES
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                GLOBAL TYPEDEFS/CONSTANTS/VARIABLES FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef ball::CompressedFileStreamBuf Obj;
+typedef bdls::FilesystemUtil          FUtil;
+typedef bsls::Types::Int64            Int64;
+
+int                 test;
+bool             verbose;
+bool         veryVerbose;
+bool     veryVeryVerbose;
+bool veryVeryVeryVerbose;
+
+// ============================================================================
+//                       GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+class TempDirectoryGuard {
+    // This class implements a scoped temporary directory guard.  The guard
+    // tries to create a temporary directory in the system-wide temp directory
+    // and falls back to the current directory.
+
+    // DATA
+    bsl::string       d_dirName;      // path to the created directory
+    bslma::Allocator *d_allocator_p;  // memory allocator (held, not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    TempDirectoryGuard(const TempDirectoryGuard&);
+    TempDirectoryGuard& operator=(const TempDirectoryGuard&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(TempDirectoryGuard,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit TempDirectoryGuard(bslma::Allocator *basicAllocator = 0)
+        // Create temporary directory in the system-wide temp or current
+        // directory.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.
+    : d_dirName(bslma::Default::allocator(basicAllocator))
+    , d_allocator_p(bslma::Default::allocator(basicAllocator))
+    {
+        bsl::string tmpPath(d_allocator_p);
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+        char tmpPathBuf[MAX_PATH];
+        GetTempPath(MAX_PATH, tmpPathBuf);
+        tmpPath.assign(tmpPathBuf);
+#else
+        const char *envTmpPath = bsl::getenv("TMPDIR");
+        if (envTmpPath) {
+            tmpPath.assign(envTmpPath);
+        }
+#endif
+
+        int res = bdls::PathUtil::appendIfValid(&tmpPath, "ball_");
+        ASSERTV(tmpPath, 0 == res);
+
+        res = bdls::FilesystemUtil::createTemporaryDirectory(&d_dirName,
+                                                             tmpPath);
+        ASSERTV(tmpPath, 0 == res);
+    }
+
+    ~TempDirectoryGuard()
+        // Destroy this object and remove the temporary directory (recursively)
+        // created at construction.
+    {
+        bdls::FilesystemUtil::remove(d_dirName, true);
+    }
+
+    // ACCESSORS
+    const bsl::string& getTempDirName() const
+        // Return a 'const' reference to the name of the created temporary
+        // directory.
+    {
+        return d_dirName;
+    }
+};
+
+namespace u {
+
+FUtil::FileDescriptor openForAppend(const bsl::string& path)
+    // Open, for appending, the file at the specified 'path', creating it if it
+    // does not exist, and return its descriptor.
+{
+    return FUtil::open(path, FUtil::e_OPEN_OR_CREATE, FUtil::e_READ_APPEND);
+}
+
+bsl::string readFile(const bsl::string& path)
+    // Return the content of the file at the specified 'path'.
+{
+    bsl::ifstream      in(path.c_str(), bsl::ios::in | bsl::ios::binary);
+    bsl::ostringstream content;
+    content << in.rdbuf();
+    return content.str();
+}
+
+bsl::string decompressFile(const bsl::string& path)
+    // Return the decompressed content of the file at the specified 'path',
+    // which must consist of complete frames.
+{
+    bsl::ostringstream content;
+    const int          rc = ball::CompressedFileUtil::decompressFile(
+                                                                content,
+                                                                path.c_str());
+    ASSERTV(path, rc, 0 == rc);
+    return content.str();
+}
+
+int frameContentSizes(bsl::vector<Int64> *sizes, const bsl::string& path)
+    // Load into the specified 'sizes' the content size of each frame of the
+    // file at the specified 'path'.  Return 0 if the file consists of
+    // complete frames, each declaring its content size, and a non-zero value
+    // otherwise.
+{
+    const bsl::string frames = readFile(path);
+
+    sizes->clear();
+
+    bsl::size_t offset = 0;
+    while (offset < frames.size()) {
+        const char        *frame  = frames.data() + offset;
+        const bsl::size_t  length = ZSTD_findFrameCompressedSize(
+                                                      frame,
+                                                      frames.size() - offset);
+        if (ZSTD_isError(length)) {
+            return -1;                                                // RETURN
+        }
+
+        const unsigned long long size = ZSTD_getFrameContentSize(frame,
+                                                                 length);
+        if (ZSTD_CONTENTSIZE_UNKNOWN == size
+         || ZSTD_CONTENTSIZE_ERROR == size) {
+            return -1;                                                // RETURN
+        }
+
+        sizes->push_back(static_cast<Int64>(size));
+        offset += length;
+    }
+    return 0;
+}
+
+char patternChar(Int64 position)
+    // Return the character expected at the specified 'position' of a file
+    // written in the output test.
+{
+    return static_cast<char>('a' + position % 23);
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    test                = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    verbose             = argc > 2;
+    veryVerbose         = argc > 3;
+    veryVeryVerbose     = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        TempDirectoryGuard tempDirGuard;
+
+        bsl::string fileNameString(tempDirGuard.getTempDirName());
+        bdls::PathUtil::appendRaw(&fileNameString, "usage.log");
+        const char *const fileName       = fileNameString.c_str();
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Writing a Compressed File
+///- - - - - - - - - - - - - - - - - -
+// Suppose that we want to write a large amount of repetitive text, such as a
+// log, to a file, using as little disk bandwidth as possible.
+//
+// First, we open the file:
+//..
+    typedef bdls::FilesystemUtil FileUtil;
+
+    FileUtil::FileDescriptor fd = FileUtil::open(fileName,
+                                                 FileUtil::e_OPEN_OR_CREATE,
+                                                 FileUtil::e_READ_WRITE,
+                                                 FileUtil::e_TRUNCATE);
+    ASSERT(FileUtil::k_INVALID_FD != fd);
+//..
+// Then, we create a 'ball::CompressedFileStreamBuf', associate it with the
+// file, using 16 kilobyte frames, and create an 'bsl::ostream' using it:
+//..
+    ball::CompressedFileStreamBuf streamBuf;
+
+    int rc = streamBuf.reset(fd, true, 16 * 1024);
+    ASSERT(0 == rc);
+
+    bsl::ostream os(&streamBuf);
+//..
+// Next, we write the text:
+//..
+    for (int i = 0; i < 10000; ++i) {
+        os << "INFO request " << i << " processed successfully\n";
+    }
+    ASSERT(os);
+//..
+// Then, we clear the stream buffer, which compresses and writes the last
+// frame, waits for all frames to be written, and closes the file:
+//..
+    rc = streamBuf.clear();
+    ASSERT(0 == rc);
+//..
+// Finally, we read the file back with 'ball::CompressedFileUtil', and observe
+// that it is a fraction of the size of its content:
+//..
+    bsl::ostringstream content;
+
+    rc = ball::CompressedFileUtil::decompressFile(content, fileName);
+    ASSERT(0 == rc);
+    ASSERT(FileUtil::getFileSize(fileName) * 5 <
+                                      static_cast<int>(content.str().size()));
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCERN: OUTPUT ERRORS
+        //
+        // Concerns:
+        //: 1 A failure to write a frame is reported by 'flush', 'sync', and
+        //:   'clear', and by the failure of subsequent output, without
+        //:   blocking the writing thread.
+        //:
+        //: 2 After a failure, the stream buffer can be reset to another file,
+        //:   which is written normally.
+        //
+        // Plan:
+        //: 1 Associate the stream buffer with a descriptor open for reading
+        //:   only, write several frames, and verify the results of 'flush',
+        //:   'sync', further output, and 'clear'.  (C-1)
+        //:
+        //: 2 Reset the stream buffer to a writable file, write to it, and
+        //:   verify its content.  (C-2)
+        //
+        // Testing:
+        //   CONCERN: OUTPUT ERRORS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: OUTPUT ERRORS" << endl
+                          << "======================" << endl;
+
+        TempDirectoryGuard tempDirGuard;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        bsl::string readOnlyPath(tempDirGuard.getTempDirName());
+        bdls::PathUtil::appendRaw(&readOnlyPath, "readonly");
+        {
+            bsl::ofstream out(readOnlyPath.c_str());
+        }
+
+        Obj          mX(&ta);  const Obj& X = mX;
+        bsl::ostream os(&mX);
+
+        FUtil::FileDescriptor fd = FUtil::open(readOnlyPath,
+                                               FUtil::e_OPEN,
+                                               FUtil::e_READ_ONLY);
+        ASSERT(FUtil::k_INVALID_FD != fd);
+
+        ASSERT(0 == mX.reset(fd, true, 1024));
+
+        const bsl::string LINE(100, 'x');
+        for (int i = 0; i < 10 * Obj::k_NUM_BUFFERS; ++i) {
+            os << LINE << '\n';
+        }
+
+        ASSERT(0 != mX.flush());
+        ASSERT(-1 == mX.pubsync());
+
+        for (int i = 0; i < 10 * Obj::k_NUM_BUFFERS; ++i) {
+            os << LINE << '\n';
+        }
+        ASSERT(!os);
+        ASSERT(0 == FUtil::getFileSize(readOnlyPath));
+
+        ASSERT(0 != mX.clear());
+        ASSERT(!X.isOpened());
+
+        bsl::string path(tempDirGuard.getTempDirName());
+        bdls::PathUtil::appendRaw(&path, "writable");
+
+        ASSERT(0 == mX.reset(u::openForAppend(path), true, 1024));
+        os.clear();
+        os << LINE << '\n';
+        ASSERT(os);
+        ASSERT(0 == mX.clear());
+        ASSERT(LINE + '\n' == u::decompressFile(path));
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING OUTPUT
+        //
+        // Concerns:
+        //: 1 Characters written with 'sputc' and 'sputn', in any mixture and
+        //:   of any length, are written to the file in order, including across
+        //:   frames, with every frame but the last having the content size of
+        //:   the frame size.
+        //:
+        //: 2 'sync' (and thus 'bsl::ostream::flush') does not end a frame, and
+        //:   returns 0 while the stream buffer is associated with a file.
+        //:
+        //: 3 'flush' ends the current frame (if not empty), and waits for the
+        //:   frames to be written, after which 'position' and 'tellp' report
+        //:   the size of the file.
+        //:
+        //: 4 'numBytesWritten' reports the number of characters written since
+        //:   'reset'.
+        //:
+        //: 5 Frames are appended to a file that already contains frames.
+        //:
+        //: 6 Seeking other than to report the position fails.
+        //:
+        //: 7 Output at high compression levels, where the writing thread must
+        //:   wait for buffers, is written completely.
+        //
+        // Plan:
+        //: 1 Using small frames, write a pattern through an 'ostream' in
+        //:   chunks of varying lengths (including lengths greater than the
+        //:   frame size), single characters, and 'flush'es, checking
+        //:   'numBytesWritten' after each chunk.  Clear the stream buffer,
+        //:   compare the decompressed file with the pattern, and verify the
+        //:   content sizes of its frames.  (C-1, 2, 4)
+        //:
+        //: 2 Call 'flush' between writes, and verify the position, the file
+        //:   size, and the frame sizes.  (C-3)
+        //:
+        //: 3 Reset the stream buffer to the same file, write, clear, and
+        //:   verify the decompressed content.  (C-5)
+        //:
+        //: 4 Call 'pubseekoff' and 'pubseekpos' with various arguments.  (C-6)
+        //:
+        //: 5 Write a large amount of output with small frames at a high
+        //:   compression level, and verify the decompressed file.  (C-7)
+        //
+        // Testing:
+        //   int flush();
+        //   int_type overflow(int_type c);
+        //   pos_type seekoff(off_type, seekdir, openmode);
+        //   pos_type seekpos(pos_type, openmode);
+        //   int sync();
+        //   bsl::streamsize xsputn(const char *buffer, bsl::streamsize);
+        //   bsls::Types::Int64 numBytesWritten() const;
+        //   bsls::Types::Int64 position() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING OUTPUT" << endl
+                          << "==============" << endl;
+
+        TempDirectoryGuard tempDirGuard;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        const int FRAME_SIZE = 1024;
+
+        if (verbose) cout << "\tTesting chunks across frames." << endl;
+        {
+            static const int CHUNKS[] = { 0, 1, 7, 100, 1023, 1024, 1025, 1,
+                                          3000, 2, 5000, 17, 4096, 999 };
+            const int NUM_CHUNKS = static_cast<int>(sizeof CHUNKS /
+                                                    sizeof *CHUNKS);
+
+            bsl::string path(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&path, "chunks");
+
+            Obj          mX(&ta);  const Obj& X = mX;
+            bsl::ostream os(&mX);
+
+            ASSERT(0 == mX.reset(u::openForAppend(path), true, FRAME_SIZE));
+            ASSERT(0 == X.position());
+            ASSERT(0 == os.tellp());
+
+            Int64       expectedWritten = 0;
+            bsl::string expected;
+
+            for (int pass = 0; pass < 3; ++pass) {
+                for (int ci = 0; ci < NUM_CHUNKS; ++ci) {
+                    const int CHUNK = CHUNKS[ci];
+
+                    bsl::string chunk;
+                    for (int i = 0; i < CHUNK; ++i) {
+                        chunk += u::patternChar(expectedWritten + i);
+                    }
+
+                    if (1 == CHUNK && 0 == pass % 2) {
+                        os.put(chunk[0]);
+                    }
+                    else {
+                        os.write(chunk.data(), CHUNK);
+                    }
+                    os << flush;
+                    ASSERT(os);
+
+                    expectedWritten += CHUNK;
+                    expected        += chunk;
+
+                    ASSERTV(pass, ci, X.numBytesWritten(),
+                            expectedWritten == X.numBytesWritten());
+                    ASSERTV(pass, ci, 0 == mX.pubsync());
+                }
+            }
+
+            ASSERT(0 == mX.clear());
+            ASSERT(!X.isOpened());
+            ASSERT(-1 == X.position());
+            ASSERT(0  == X.numBytesWritten());
+
+            ASSERT(expected == u::decompressFile(path));
+
+            bsl::vector<Int64> sizes;
+            ASSERT(0 == u::frameContentSizes(&sizes, path));
+            const Int64 NUM_FRAMES = (expectedWritten + FRAME_SIZE - 1)
+                                                                 / FRAME_SIZE;
+            ASSERTV(sizes.size(),
+                    NUM_FRAMES == static_cast<Int64>(sizes.size()));
+            for (bsl::size_t i = 0; i + 1 < sizes.size(); ++i) {
+                ASSERTV(i, sizes[i], FRAME_SIZE == sizes[i]);
+            }
+        }
+
+        if (verbose) cout << "\tTesting 'flush' and appending." << endl;
+        {
+            bsl::string path(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&path, "flush");
+
+            Obj          mX(&ta);  const Obj& X = mX;
+            bsl::ostream os(&mX);
+
+            ASSERT(0 == mX.reset(u::openForAppend(path), true, FRAME_SIZE));
+
+            ASSERT(0 == mX.flush());
+            ASSERT(0 == X.position());
+
+            os << "first";
+            ASSERT(0 == mX.flush());
+            ASSERT(0 == mX.flush());
+
+            const Int64 size = FUtil::getFileSize(path);
+            ASSERT(0 < size);
+            ASSERT(size == X.position());
+            ASSERT(size == os.tellp());
+
+            os << "second";
+            ASSERT(0 == mX.flush());
+            ASSERT(size < X.position());
+            ASSERT(X.position() == FUtil::getFileSize(path));
+
+            ASSERT(0 == mX.clear());
+
+            bsl::vector<Int64> sizes;
+            ASSERT(0 == u::frameContentSizes(&sizes, path));
+            ASSERT(2 == sizes.size());
+            ASSERT("firstsecond" == u::decompressFile(path));
+
+            // Append.
+
+            const Int64 fileSize = FUtil::getFileSize(path);
+
+            ASSERT(0 == mX.reset(u::openForAppend(path)));
+            ASSERT(fileSize == X.position());
+            ASSERT(Obj::k_DEFAULT_FRAME_SIZE == X.frameSize());
+            os << "third";
+            ASSERT(0 == mX.clear());
+
+            ASSERT("firstsecondthird" == u::decompressFile(path));
+        }
+
+        if (verbose) cout << "\tTesting seeking." << endl;
+        {
+            bsl::string path(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&path, "seek");
+
+            Obj mX(&ta);
+
+            typedef bsl::ios_base IOS;
+
+            ASSERT(-1 == mX.pubseekoff(0, IOS::cur, IOS::out));
+
+            ASSERT(0 == mX.reset(u::openForAppend(path)));
+
+            ASSERT( 0 == mX.pubseekoff(0, IOS::cur, IOS::out));
+            ASSERT( 0 == mX.pubseekoff(0, IOS::end, IOS::out));
+            ASSERT( 0 == mX.pubseekoff(0, IOS::cur));
+            ASSERT(-1 == mX.pubseekoff(0, IOS::beg, IOS::out));
+            ASSERT(-1 == mX.pubseekoff(1, IOS::cur, IOS::out));
+            ASSERT(-1 == mX.pubseekoff(0, IOS::cur, IOS::in));
+            ASSERT(-1 == mX.pubseekpos(0, IOS::out));
+        }
+
+        if (verbose) cout << "\tTesting a high compression level." << endl;
+        {
+            bsl::string path(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&path, "level");
+
+            Obj          mX(&ta);
+            bsl::ostream os(&mX);
+
+            ASSERT(0 == mX.reset(u::openForAppend(path), true, 4096, 19));
+
+            bsl::ostringstream expected;
+            for (int i = 0; i < 20000; ++i) {
+                os       << "line " << i << " of " << i * 31 << '\n';
+                expected << "line " << i << " of " << i * 31 << '\n';
+            }
+            ASSERT(0 == mX.clear());
+
+            ASSERT(expected.str() == u::decompressFile(path));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING CREATORS, 'reset', AND 'clear'
+        //
+        // Concerns:
+        //: 1 A default-constructed object is not associated with a file, and
+        //:   has the default frame size.
+        //:
+        //: 2 'reset' associates the object with a file, with the specified (or
+        //:   default) frame size, and 'clear' (and the destructor) writes the
+        //:   characters written, and closes the file if so specified.
+        //:
+        //: 3 'reset' to another file clears the previous one.
+        //:
+        //: 4 'clear' has no effect if the object is not associated with a
+        //:   file.
+        //:
+        //: 5 'isValidCompressionLevel' accepts exactly the levels supported by
+        //:   the Zstandard library.
+        //:
+        //: 6 All memory is supplied by the specified allocator, and released
+        //:   on destruction.
+        //
+        // Plan:
+        //: 1 Exercise the creators, 'reset', and 'clear', with both values of
+        //:   'willCloseOnResetFlag', using a test allocator, and verify the
+        //:   accessors, the files written, and the state of the descriptors.
+        //:   (C-1..4, 6)
+        //:
+        //: 2 Verify 'isValidCompressionLevel' at the boundaries of the levels
+        //:   supported.  (C-5)
+        //
+        // Testing:
+        //   static bool isValidCompressionLevel(int level);
+        //   explicit CompressedFileStreamBuf(bslma::Allocator *);
+        //   ~CompressedFileStreamBuf();
+        //   int clear();
+        //   int reset(descriptor, willCloseFlag, frameSize, compressionLevel);
+        //   bsl::size_t frameSize() const;
+        //   bool isOpened() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING CREATORS, 'reset', AND 'clear'" << endl
+                          << "======================================" << endl;
+
+        TempDirectoryGuard tempDirGuard;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        bsl::string pathA(tempDirGuard.getTempDirName());
+        bdls::PathUtil::appendRaw(&pathA, "a");
+        bsl::string pathB(tempDirGuard.getTempDirName());
+        bdls::PathUtil::appendRaw(&pathB, "b");
+        bsl::string pathC(tempDirGuard.getTempDirName());
+        bdls::PathUtil::appendRaw(&pathC, "c");
+
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT(!X.isOpened());
+            ASSERT(Obj::k_DEFAULT_FRAME_SIZE == X.frameSize());
+            ASSERT(-1 == X.position());
+            ASSERT(0 == mX.clear());
+
+            bslma::TestAllocatorMonitor tam(&ta);
+
+            ASSERT(0 == mX.reset(u::openForAppend(pathA), true, 100));
+            ASSERT(X.isOpened());
+            ASSERT(100 == X.frameSize());
+            ASSERT(tam.isInUseUp());
+
+            mX.sputn("abc", 3);
+
+            // Reset to another file, which is not closed.
+
+            FUtil::FileDescriptor fdB = u::openForAppend(pathB);
+            ASSERT(0 == mX.reset(fdB, false));
+            ASSERT(X.isOpened());
+            ASSERT(Obj::k_DEFAULT_FRAME_SIZE == X.frameSize());
+            ASSERT("abc" == u::decompressFile(pathA));
+
+            mX.sputn("def", 3);
+            ASSERT(0 == mX.clear());
+            ASSERT(!X.isOpened());
+            ASSERT("def" == u::decompressFile(pathB));
+
+            ASSERT(3 == FUtil::write(fdB, "xyz", 3));
+            ASSERT(0 == FUtil::close(fdB));
+
+            // The destructor clears the stream buffer.
+
+            ASSERT(0 == mX.reset(u::openForAppend(pathC), true, 0, -5));
+            mX.sputn("ghi", 3);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT("ghi" == u::decompressFile(pathC));
+
+        if (verbose) cout << "\tTesting 'isValidCompressionLevel'." << endl;
+        {
+            ASSERT( Obj::isValidCompressionLevel(0));
+            ASSERT( Obj::isValidCompressionLevel(1));
+            ASSERT( Obj::isValidCompressionLevel(-1));
+            ASSERT( Obj::isValidCompressionLevel(ZSTD_maxCLevel()));
+            ASSERT(!Obj::isValidCompressionLevel(ZSTD_maxCLevel() + 1));
+            ASSERT( Obj::isValidCompressionLevel(ZSTD_minCLevel()));
+            ASSERT(!Obj::isValidCompressionLevel(ZSTD_minCLevel() - 1));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Write text spanning several frames through an 'ostream', clear
+        //:   the stream buffer, and decompress the file.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        TempDirectoryGuard tempDirGuard;
+
+        bsl::string path(tempDirGuard.getTempDirName());
+        bdls::PathUtil::appendRaw(&path, "breathing");
+
+        Obj          mX;  const Obj& X = mX;
+        bsl::ostream os(&mX);
+
+        ASSERT(!X.isOpened());
+        ASSERT(0 == mX.reset(u::openForAppend(path), true, 4096));
+        ASSERT(X.isOpened());
+
+        bsl::ostringstream expected;
+        for (int i = 0; i < 1000; ++i) {
+            os       << "breathing " << i << '\n' << flush;
+            expected << "breathing " << i << '\n';
+        }
+        ASSERT(os);
+
+        ASSERT(0 == mX.clear());
+        ASSERT(!X.isOpened());
+
+        ASSERT(expected.str() == u::decompressFile(path));
+        ASSERT(FUtil::getFileSize(path) <
+                                   static_cast<Int64>(expected.str().size()));
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: FLUSHED LOG LINES
+        //
+        // Concerns:
+        //: 1 Writing log-like lines, each flushed, through a
+        //:   'CompressedFileStreamBuf' writes a fraction of the bytes written
+        //:   through a 'bdls::FdStreamBuf', at a comparable cost to the
+        //:   writing thread.
+        //
+        // Plan:
+        //: 1 Write the same lines, flushing after each, through both stream
+        //:   buffers, and report the elapsed times and file sizes.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST: FLUSHED LOG LINES
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST: FLUSHED LOG LINES" << endl
+                          << "===================================" << endl;
+
+        TempDirectoryGuard tempDirGuard;
+
+        const int NUM_LINES = argc > 2 ? bsl::atoi(argv[2]) : 200000;
+
+        {
+            bsl::string path(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&path, "fd");
+
+            bdls::FdStreamBuf streamBuf(u::openForAppend(path), true);
+            bsl::ostream      os(&streamBuf);
+
+            bsls::Stopwatch timer;
+            timer.start();
+            for (int i = 0; i < NUM_LINES; ++i) {
+                os << "19OCT2026_10:21:33.123 4242:140239 INFO server.cpp:"
+                   << 100 + i % 50 << " REQUEST processed id=" << i
+                   << " status=OK\n" << flush;
+            }
+            streamBuf.clear();
+            timer.stop();
+
+            cout << "FdStreamBuf:             " << timer.elapsedTime() << "s, "
+                 << FUtil::getFileSize(path) << " bytes" << endl;
+        }
+        {
+            bsl::string path(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&path, "compressed");
+
+            Obj          streamBuf;
+            bsl::ostream os(&streamBuf);
+
+            bsls::Stopwatch timer;
+            timer.start();
+            ASSERT(0 == streamBuf.reset(u::openForAppend(path)));
+            for (int i = 0; i < NUM_LINES; ++i) {
+                os << "19OCT2026_10:21:33.123 4242:140239 INFO server.cpp:"
+                   << 100 + i % 50 << " REQUEST processed id=" << i
+                   << " status=OK\n" << flush;
+            }
+            ASSERT(0 == streamBuf.clear());
+            timer.stop();
+
+            cout << "CompressedFileStreamBuf: " << timer.elapsedTime() << "s, "
+                 << FUtil::getFileSize(path) << " bytes" << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
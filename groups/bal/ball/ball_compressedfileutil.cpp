@@ -0,0 +1,209 @@
+// ball_compressedfileutil.cpp                                        -*-C++-*-
+#include <ball_compressedfileutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ball_compressedfileutil_cpp,"$Id$ $CSID$")
+
+#include <bsls_assert.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstring.h>
+#include <bsl_fstream.h>
+#include <bsl_ios.h>
+#include <bsl_istream.h>
+#include <bsl_ostream.h>
+#include <bsl_vector.h>
+
+#include <zstd/zstd.h>
+#include <zstd/zstd_errors.h>
+
+///Implementation Notes
+///--------------------
+// The input is read into a buffer, and the extent of the next frame is found
+// with 'ZSTD_findFrameCompressedSize', which fails with 'srcSize_wrong' when
+// the buffer does not yet contain the whole frame; more input is then read,
+// growing the buffer if the frame does not fit.  A complete frame is decoded
+// with the streaming API into an output buffer of the size recommended by the
+// library, so that frames of any content size are decoded in bounded memory.
+// Skippable frames are decoded as empty.
+
+namespace BloombergLP {
+namespace ball {
+
+namespace {
+namespace u {
+
+enum {
+    k_READ_SIZE = 128 * 1024  // minimum number of bytes read at a time
+};
+
+class DecompressionContextGuard {
+    // This class implements a guard freeing a Zstandard decompression context
+    // on destruction.
+
+    // DATA
+    ZSTD_DCtx *d_context_p;  // guarded context (owned)
+
+  private:
+    // NOT IMPLEMENTED
+    DecompressionContextGuard(const DecompressionContextGuard&);
+    DecompressionContextGuard& operator=(const DecompressionContextGuard&);
+
+  public:
+    // CREATORS
+    explicit DecompressionContextGuard(ZSTD_DCtx *context)
+        // Create a guard freeing the specified 'context' on destruction.
+    : d_context_p(context)
+    {
+    }
+
+    ~DecompressionContextGuard()
+        // Free the guarded context, and destroy this object.
+    {
+        ZSTD_freeDCtx(d_context_p);
+    }
+};
+
+int decompressFrame(bsl::ostream&      output,
+                    bsl::vector<char> *outputBuffer,
+                    ZSTD_DCtx         *context,
+                    const char        *frame,
+                    bsl::size_t        frameLength)
+    // Decompress the complete Zstandard frame of the specified 'frameLength'
+    // at the specified 'frame', using the specified 'context' and
+    // 'outputBuffer', and write its content to the specified 'output'.
+    // Return 0 on success, and a non-zero value otherwise.
+{
+    ZSTD_inBuffer input = { frame, frameLength, 0 };
+    bsl::size_t   rc;
+    bool          fullFlag;
+
+    do {
+        ZSTD_outBuffer buffer = { outputBuffer->data(),
+                                  outputBuffer->size(),
+                                  0 };
+
+        rc = ZSTD_decompressStream(context, &buffer, &input);
+        if (ZSTD_isError(rc)) {
+            return -1;                                                // RETURN
+        }
+
+        output.write(outputBuffer->data(),
+                     static_cast<bsl::streamsize>(buffer.pos));
+        if (!output) {
+            return -1;                                                // RETURN
+        }
+
+        fullFlag = buffer.pos == buffer.size;
+    } while (input.pos < input.size || (0 != rc && fullFlag));
+
+    return 0 == rc ? 0 : -1;
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+                          // -------------------------
+                          // struct CompressedFileUtil
+                          // -------------------------
+
+// CLASS METHODS
+int CompressedFileUtil::decompress(bsl::ostream& output, bsl::istream& input)
+{
+    ZSTD_DCtx *context = ZSTD_createDCtx();
+    if (!context) {
+        return -1;                                                    // RETURN
+    }
+    u::DecompressionContextGuard guard(context);
+
+    bsl::vector<char> inputBuffer(u::k_READ_SIZE);
+    bsl::vector<char> outputBuffer(ZSTD_DStreamOutSize());
+    bsl::size_t       begin   = 0;  // start of the unconsumed input
+    bsl::size_t       end     = 0;  // end of the input read
+    bool              eofFlag = false;
+
+    while (true) {
+        const bsl::size_t length = end - begin;
+
+        if (0 < length) {
+            const bsl::size_t frameLength = ZSTD_findFrameCompressedSize(
+                                                          &inputBuffer[begin],
+                                                          length);
+
+            if (!ZSTD_isError(frameLength)) {
+                if (0 != u::decompressFrame(output,
+                                            &outputBuffer,
+                                            context,
+                                            &inputBuffer[begin],
+                                            frameLength)) {
+                    return -1;                                        // RETURN
+                }
+                begin += frameLength;
+                continue;
+            }
+
+            if (ZSTD_error_srcSize_wrong != ZSTD_getErrorCode(frameLength)) {
+                return -1;                                            // RETURN
+            }
+        }
+
+        // The unconsumed input is empty, or an incomplete frame.
+
+        if (eofFlag) {
+            return 0 == length ? 0 : 1;                               // RETURN
+        }
+
+        if (0 < begin) {
+            bsl::memmove(inputBuffer.data(), &inputBuffer[begin], length);
+            begin = 0;
+            end   = length;
+        }
+        if (inputBuffer.size() - end < u::k_READ_SIZE) {
+            inputBuffer.resize(bsl::max<bsl::size_t>(inputBuffer.size() * 2,
+                                                     end + u::k_READ_SIZE));
+        }
+
+        input.read(&inputBuffer[end],
+                   static_cast<bsl::streamsize>(inputBuffer.size() - end));
+        end += static_cast<bsl::size_t>(input.gcount());
+
+        if (!input) {
+            if (input.bad() || !input.eof()) {
+                return -1;                                            // RETURN
+            }
+            eofFlag = true;
+        }
+    }
+}
+
+int CompressedFileUtil::decompressFile(bsl::ostream&  output,
+                                       const char    *fileName)
+{
+    BSLS_ASSERT(fileName);
+
+    bsl::ifstream input(fileName, bsl::ios_base::in | bsl::ios_base::binary);
+    if (!input.is_open()) {
+        return -1;                                                    // RETURN
+    }
+
+    return decompress(output, input);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,107 @@
+// ball_compressedfileutil.h                                          -*-C++-*-
+#ifndef INCLUDED_BALL_COMPRESSEDFILEUTIL
+#define INCLUDED_BALL_COMPRESSEDFILEUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide utilities to read files of compressed frames.
+//
+//@CLASSES:
+//  ball::CompressedFileUtil: namespace for reading compressed log files
+//
+//@SEE_ALSO: ball_compressedfilestreambuf, ball_fileobserver2
+//
+//@DESCRIPTION: This component provides a namespace,
+// 'ball::CompressedFileUtil', for functions that decompress a sequence of
+// Zstandard frames, such as the log files written by 'ball::FileObserver2'
+// with compression enabled (see 'ball_compressedfilestreambuf'), to a stream.
+//
+// Frames are decoded one at a time, and the content of each is written to the
+// output stream as it is decoded, so that the memory used does not depend on
+// the size of the input.  A sequence of frames that ends with an incomplete
+// frame (e.g., a log file that is still being written, or whose writer
+// terminated abnormally while writing a frame) is decoded up to that frame,
+// which is reported by a distinct return status.  Any other malformed frame,
+// including one whose checksum does not match its content, is reported as an
+// error; the content of the frames preceding it has been written.
+//
+// The 'm_balllogcat' application (in 'standalones') is a command-line front
+// end to this component.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Reading a Compressed Log File
+///- - - - - - - - - - - - - - - - - - - -
+// Suppose that a 'ball::FileObserver2' with compression enabled has written
+// the log file named by 'fileName', and that we want to print its content.
+//
+// We decompress the file to 'bsl::cout', accepting a file that ends with an
+// incomplete frame:
+//..
+//  int rc = ball::CompressedFileUtil::decompressFile(bsl::cout, fileName);
+//  if (0 > rc) {
+//      bsl::cerr << "Cannot decompress " << fileName << '\n';
+//  }
+//  else if (0 < rc) {
+//      bsl::cerr << fileName << " ends with an incomplete frame\n";
+//  }
+//..
+
+#include <balscm_version.h>
+
+#include <bsl_iosfwd.h>
+
+namespace BloombergLP {
+namespace ball {
+
+                          // =========================
+                          // struct CompressedFileUtil
+                          // =========================
+
+struct CompressedFileUtil {
+    // This 'struct' provides a namespace for functions that decompress
+    // sequences of Zstandard frames.
+
+    // CLASS METHODS
+    static int decompress(bsl::ostream& output, bsl::istream& input);
+        // Decompress the sequence of Zstandard frames read from the specified
+        // 'input' until its end, and write their content to the specified
+        // 'output'.  Return 0 on success, 1 if 'input' ends with an incomplete
+        // frame (in which case the content of every frame preceding it has
+        // been written), and a negative value if a frame is malformed, or if
+        // reading 'input' or writing 'output' fails.
+
+    static int decompressFile(bsl::ostream& output, const char *fileName);
+        // Decompress the sequence of Zstandard frames in the file having the
+        // specified 'fileName', and write their content to the specified
+        // 'output'.  Return 0 on success, 1 if the file ends with an
+        // incomplete frame (in which case the content of every frame
+        // preceding it has been written), and a negative value if the file
+        // cannot be opened, a frame is malformed, or if reading the file or
+        // writing 'output' fails.  The behavior is undefined unless
+        // 'fileName' is not 0.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
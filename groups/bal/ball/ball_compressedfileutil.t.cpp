@@ -0,0 +1,607 @@
+// ball_compressedfileutil.t.cpp                                      -*-C++-*-
+#include <ball_compressedfileutil.h>
+
+#include <bdls_filesystemutil.h>
+#include <bdls_pathutil.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_platform.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_fstream.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+#include <zstd/zstd.h>
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>
+#endif
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+using bsl::flush;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test provides utility functions decompressing
+// sequences of Zstandard frames.  Sequences are built from frames produced by
+// the Zstandard library directly (and from hand-built skippable frames), and
+// the functions are verified to reproduce the content of the frames, to report
+// a truncated last frame distinctly (having written the content of the frames
+// preceding it), and to report malformed input as an error.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] int decompress(bsl::ostream& output, bsl::istream& input);
+// [ 3] int decompressFile(bsl::ostream& output, const char *fileName);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                GLOBAL TYPEDEFS/CONSTANTS/VARIABLES FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef ball::CompressedFileUtil Util;
+typedef bdls::FilesystemUtil     FUtil;
+
+int                 test;
+bool             verbose;
+bool         veryVerbose;
+bool     veryVeryVerbose;
+bool veryVeryVeryVerbose;
+
+// ============================================================================
+//                       GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+class TempDirectoryGuard {
+    // This class implements a scoped temporary directory guard.  The guard
+    // tries to create a temporary directory in the system-wide temp directory
+    // and falls back to the current directory.
+
+    // DATA
+    bsl::string       d_dirName;      // path to the created directory
+    bslma::Allocator *d_allocator_p;  // memory allocator (held, not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    TempDirectoryGuard(const TempDirectoryGuard&);
+    TempDirectoryGuard& operator=(const TempDirectoryGuard&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(TempDirectoryGuard,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit TempDirectoryGuard(bslma::Allocator *basicAllocator = 0)
+        // Create temporary directory in the system-wide temp or current
+        // directory.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.
+    : d_dirName(bslma::Default::allocator(basicAllocator))
+    , d_allocator_p(bslma::Default::allocator(basicAllocator))
+    {
+        bsl::string tmpPath(d_allocator_p);
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+        char tmpPathBuf[MAX_PATH];
+        GetTempPath(MAX_PATH, tmpPathBuf);
+        tmpPath.assign(tmpPathBuf);
+#else
+        const char *envTmpPath = bsl::getenv("TMPDIR");
+        if (envTmpPath) {
+            tmpPath.assign(envTmpPath);
+        }
+#endif
+
+        int res = bdls::PathUtil::appendIfValid(&tmpPath, "ball_");
+        ASSERTV(tmpPath, 0 == res);
+
+        res = bdls::FilesystemUtil::createTemporaryDirectory(&d_dirName,
+                                                             tmpPath);
+        ASSERTV(tmpPath, 0 == res);
+    }
+
+    ~TempDirectoryGuard()
+        // Destroy this object and remove the temporary directory (recursively)
+        // created at construction.
+    {
+        bdls::FilesystemUtil::remove(d_dirName, true);
+    }
+
+    // ACCESSORS
+    const bsl::string& getTempDirName() const
+        // Return a 'const' reference to the name of the created temporary
+        // directory.
+    {
+        return d_dirName;
+    }
+};
+
+namespace u {
+
+bsl::string compress(const bsl::string& content, bool checksumFlag = true)
+    // Return a single Zstandard frame of the specified 'content', including
+    // a checksum unless the optionally specified 'checksumFlag' is 'false'.
+{
+    ZSTD_CCtx *context = ZSTD_createCCtx();
+    ZSTD_CCtx_setParameter(context, ZSTD_c_checksumFlag, checksumFlag);
+
+    bsl::vector<char> frame(ZSTD_compressBound(content.size()));
+
+    const bsl::size_t length = ZSTD_compress2(context,
+                                              frame.data(),
+                                              frame.size(),
+                                              content.data(),
+                                              content.size());
+    ZSTD_freeCCtx(context);
+
+    ASSERT(!ZSTD_isError(length));
+    return bsl::string(frame.data(), ZSTD_isError(length) ? 0 : length);
+}
+
+bsl::string skippableFrame(const bsl::string& payload)
+    // Return a skippable Zstandard frame having the specified 'payload'.
+{
+    const unsigned int magic = 0x184D2A50;
+    const unsigned int size  = static_cast<unsigned int>(payload.size());
+
+    bsl::string frame;
+    for (int i = 0; i < 4; ++i) {
+        frame += static_cast<char>((magic >> (8 * i)) & 0xff);
+    }
+    for (int i = 0; i < 4; ++i) {
+        frame += static_cast<char>((size >> (8 * i)) & 0xff);
+    }
+    return frame + payload;
+}
+
+bsl::string text(int length, int seed)
+    // Return a string of the specified 'length' of compressible text, varied
+    // by the specified 'seed'.
+{
+    bsl::ostringstream out;
+    for (int i = 0; static_cast<int>(out.tellp()) < length; ++i) {
+        out << "record " << seed << ':' << i % 97 << " value=" << i * 7919
+            << '\n';
+    }
+    return out.str().substr(0, length);
+}
+
+void writeFile(const bsl::string& path, const bsl::string& content)
+    // Replace the content of the file at the specified 'path' with the
+    // specified 'content'.
+{
+    bsl::ofstream out(path.c_str(), bsl::ios::out | bsl::ios::binary);
+    out << content;
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    test                = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    verbose             = argc > 2;
+    veryVerbose         = argc > 3;
+    veryVeryVerbose     = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        TempDirectoryGuard tempDirGuard;
+
+        bsl::string fileNameString(tempDirGuard.getTempDirName());
+        bdls::PathUtil::appendRaw(&fileNameString, "usage.log");
+        const char *const fileName       = fileNameString.c_str();
+
+        u::writeFile(fileNameString,
+                     u::compress("usage example record\n")
+                   + u::compress("usage example record\n").substr(0, 5));
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Reading a Compressed Log File
+///- - - - - - - - - - - - - - - - - - - -
+// Suppose that a 'ball::FileObserver2' with compression enabled has written
+// the log file named by 'fileName', and that we want to print its content.
+//
+// We decompress the file to 'bsl::cout', accepting a file that ends with an
+// incomplete frame:
+//..
+    int rc = ball::CompressedFileUtil::decompressFile(bsl::cout, fileName);
+    if (0 > rc) {
+        bsl::cerr << "Cannot decompress " << fileName << '\n';
+    }
+    else if (0 < rc) {
+        bsl::cerr << fileName << " ends with an incomplete frame\n";
+    }
+//..
+
+        ASSERTV(rc, 1 == rc);
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'decompressFile'
+        //
+        // Concerns:
+        //: 1 'decompressFile' decompresses the content of the named file, and
+        //:   reports a truncated last frame as 'decompress' does.
+        //:
+        //: 2 A file that cannot be opened is reported as an error, and nothing
+        //:   is written.
+        //
+        // Plan:
+        //: 1 Decompress files containing a sequence of frames, with and
+        //:   without truncation, and an empty file.  (C-1)
+        //:
+        //: 2 Decompress a file that does not exist.  (C-2)
+        //
+        // Testing:
+        //   int decompressFile(bsl::ostream& output, const char *fileName);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'decompressFile'" << endl
+                          << "========================" << endl;
+
+        TempDirectoryGuard tempDirGuard;
+
+        const bsl::string A = u::text(100 * 1000, 1);
+        const bsl::string B = u::text(1000, 2);
+
+        const bsl::string FRAMES = u::compress(A) + u::compress(B);
+
+        bsl::string path(tempDirGuard.getTempDirName());
+        bdls::PathUtil::appendRaw(&path, "frames");
+        {
+            u::writeFile(path, FRAMES);
+
+            bsl::ostringstream output;
+            ASSERT(0 == Util::decompressFile(output, path.c_str()));
+            ASSERT(A + B == output.str());
+        }
+        {
+            u::writeFile(path, FRAMES.substr(0, FRAMES.size() - 1));
+
+            bsl::ostringstream output;
+            ASSERT(1 == Util::decompressFile(output, path.c_str()));
+            ASSERT(A == output.str());
+        }
+        {
+            u::writeFile(path, "");
+
+            bsl::ostringstream output;
+            ASSERT(0 == Util::decompressFile(output, path.c_str()));
+            ASSERT(output.str().empty());
+        }
+        {
+            bsl::string missing(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&missing, "missing");
+
+            bsl::ostringstream output;
+            ASSERT(0 > Util::decompressFile(output, missing.c_str()));
+            ASSERT(output.str().empty());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'decompress'
+        //
+        // Concerns:
+        //: 1 The content of any sequence of frames, of any content sizes
+        //:   (including empty, and larger than both the read size and the
+        //:   output buffer of the implementation), with or without checksums,
+        //:   and including skippable frames, is written in order.
+        //:
+        //: 2 A sequence ending with an incomplete frame, truncated anywhere
+        //:   (including within its header), is reported by a return of 1,
+        //:   having written the content of every frame preceding it.
+        //:
+        //: 3 Input that is not a frame, and a frame whose checksum does not
+        //:   match its content, are reported by a negative return, having
+        //:   written the content of every frame preceding it.
+        //:
+        //: 4 A failure to write the output is reported by a negative return.
+        //
+        // Plan:
+        //: 1 Using a table of sequences of frame content sizes, build and
+        //:   decompress each sequence, and verify the output.  (C-1)
+        //:
+        //: 2 For each sequence of case 1, decompress every truncation of the
+        //:   sequence within its last frame, and verify the return value and
+        //:   output.  (C-2)
+        //:
+        //: 3 Decompress a valid frame followed by garbage, and by a frame with
+        //:   a corrupted checksum.  (C-3)
+        //:
+        //: 4 Decompress to a stream in a failed state.  (C-4)
+        //
+        // Testing:
+        //   int decompress(bsl::ostream& output, bsl::istream& input);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'decompress'" << endl
+                          << "====================" << endl;
+
+        static const struct {
+            int  d_line;
+            int  d_numFrames;
+            int  d_sizes[4];       // content sizes; -1 for a skippable frame
+            bool d_checksumFlag;
+        } DATA[] = {
+            //LINE  NUM  SIZES                           CHECKSUM
+            //----  ---  ------------------------------  --------
+            { L_,    1,  {       0,      0,    0,    0 },  true   },
+            { L_,    1,  {       1,      0,    0,    0 },  true   },
+            { L_,    1,  {    1000,      0,    0,    0 },  false  },
+            { L_,    2,  {    1000,   2000,    0,    0 },  true   },
+            { L_,    3,  {   65536,      0, 4096,    0 },  true   },
+            { L_,    2,  {  300000,     10,    0,    0 },  true   },
+            { L_,    3,  {     100,     -1,  100,    0 },  true   },
+            { L_,    4,  {      -1,    100,   -1,  500 },  false  },
+            { L_,    2,  { 1000000, 200000,    0,    0 },  true   },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE     = DATA[ti].d_line;
+            const int   NUM      = DATA[ti].d_numFrames;
+            const bool  CHECKSUM = DATA[ti].d_checksumFlag;
+
+            if (veryVerbose) { T_ P(LINE) }
+
+            bsl::string frames;
+            bsl::string content;
+            bsl::string leadingContent;   // content of all but the last frame
+            bsl::size_t lastFrameOffset = 0;
+
+            for (int i = 0; i < NUM; ++i) {
+                const int SIZE = DATA[ti].d_sizes[i];
+
+                leadingContent  = content;
+                lastFrameOffset = frames.size();
+
+                if (0 > SIZE) {
+                    frames += u::skippableFrame("skipped payload");
+                }
+                else {
+                    const bsl::string TEXT = u::text(SIZE, i);
+
+                    frames  += u::compress(TEXT, CHECKSUM);
+                    content += TEXT;
+                }
+            }
+
+            {
+                bsl::istringstream input(frames);
+                bsl::ostringstream output;
+
+                const int rc = Util::decompress(output, input);
+                ASSERTV(LINE, rc, 0 == rc);
+                ASSERTV(LINE, content == output.str());
+            }
+
+            // Truncate within the last frame, at the start, within the
+            // header, just after it, in the middle, and before the end.
+
+            const bsl::size_t lastFrameSize = frames.size() - lastFrameOffset;
+            const bsl::size_t CUTS[] = { 0,
+                                         1,
+                                         4,
+                                         6,
+                                         lastFrameSize / 2,
+                                         lastFrameSize - 1 };
+            const int NUM_CUTS = static_cast<int>(sizeof CUTS / sizeof *CUTS);
+
+            for (int ci = 0; ci < NUM_CUTS; ++ci) {
+                const bsl::size_t CUT = CUTS[ci];
+
+                if (CUT >= lastFrameSize) {
+                    continue;
+                }
+
+                bsl::istringstream input(
+                                   frames.substr(0, lastFrameOffset + CUT));
+                bsl::ostringstream output;
+
+                const int rc = Util::decompress(output, input);
+                ASSERTV(LINE, CUT, rc, (0 == CUT ? 0 : 1) == rc);
+                ASSERTV(LINE, CUT, leadingContent == output.str());
+            }
+        }
+
+        if (verbose) cout << "\tTesting malformed input." << endl;
+        {
+            const bsl::string TEXT  = u::text(5000, 3);
+            const bsl::string FRAME = u::compress(TEXT);
+
+            {
+                bsl::istringstream input(FRAME + "this is not a frame");
+                bsl::ostringstream output;
+
+                ASSERT(0 > Util::decompress(output, input));
+                ASSERT(TEXT == output.str());
+            }
+            {
+                // The checksum is the last 4 bytes of the frame.
+
+                bsl::string corrupted(FRAME);
+                corrupted[corrupted.size() - 1] ^= 0x5a;
+
+                bsl::istringstream input(FRAME + corrupted);
+                bsl::ostringstream output;
+
+                ASSERT(0 > Util::decompress(output, input));
+                ASSERT(TEXT.size() <= output.str().size());
+                ASSERT(TEXT == output.str().substr(0, TEXT.size()));
+            }
+        }
+
+        if (verbose) cout << "\tTesting output failure." << endl;
+        {
+            bsl::istringstream input(u::compress(u::text(100, 4)));
+            bsl::ostringstream output;
+            output.setstate(bsl::ios::badbit);
+
+            ASSERT(0 > Util::decompress(output, input));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Decompress a sequence of two frames, and a truncated sequence.
+        //:   (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        const bsl::string FRAMES = u::compress("hello, ")
+                                 + u::compress("world\n");
+        {
+            bsl::istringstream input(FRAMES);
+            bsl::ostringstream output;
+
+            ASSERT(0 == Util::decompress(output, input));
+            ASSERT("hello, world\n" == output.str());
+        }
+        {
+            bsl::istringstream input(FRAMES.substr(0, FRAMES.size() - 2));
+            bsl::ostringstream output;
+
+            ASSERT(1 == Util::decompress(output, input));
+            ASSERT("hello, " == output.str());
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,496 @@
+// ball_deferredmessage.cpp                                           -*-C++-*-
+#include <ball_deferredmessage.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ball_deferredmessage_cpp,"$Id$ $CSID$")
+
+#include <bslma_default.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdio.h>
+#include <bsl_cstring.h>
+#include <bsl_limits.h>
+#include <bsl_vector.h>
+
+///Implementation Notes
+///--------------------
+// 'formatMessage' copies the text between conversion specifications directly
+// to the stream buffer, and formats each conversion specification separately
+// by calling 'snprintf' with a rewritten specification: any '*' width or
+// precision is replaced by the value of its (captured) argument, the length
+// modifier is replaced by the one matching the captured type of the argument
+// ('ll' for integers, none otherwise), and the conversion is replaced, if
+// necessary, by one matching the captured type (see {Formatting} in the
+// component documentation).  'snprintf' is therefore always called with an
+// argument of the type its format expects.
+
+namespace BloombergLP {
+namespace ball {
+namespace {
+namespace u {
+
+enum {
+    k_SPEC_CAPACITY   = 64,  // capacity of a rewritten conversion
+                             // specification
+
+    k_OUTPUT_CAPACITY = 256  // capacity of the buffer to which one
+                             // conversion is formatted, above which a buffer
+                             // is allocated
+};
+
+bool isFlag(char character)
+    // Return 'true' if the specified 'character' is a 'printf' flag
+    // character, and 'false' otherwise.
+{
+    return '-' == character
+        || '+' == character
+        || ' ' == character
+        || '#' == character
+        || '0' == character
+        || '\'' == character;
+}
+
+bool isLengthModifier(char character)
+    // Return 'true' if the specified 'character' is (part of) a 'printf'
+    // length modifier, and 'false' otherwise.
+{
+    return 'h' == character
+        || 'l' == character
+        || 'L' == character
+        || 'q' == character
+        || 'j' == character
+        || 'z' == character
+        || 't' == character;
+}
+
+bool isDigit(char character)
+    // Return 'true' if the specified 'character' is a decimal digit, and
+    // 'false' otherwise.
+{
+    return '0' <= character && character <= '9';
+}
+
+template <class INTEGER>
+INTEGER clampedValue(double value)
+    // Return the specified 'value' converted to the specified 'INTEGER' type
+    // (rounding toward zero), the limit of 'INTEGER' nearest to 'value' if
+    // 'value' is outside the range of 'INTEGER', or 0 if 'value' is a NaN.
+{
+    typedef bsl::numeric_limits<INTEGER> Limits;
+
+    if (value != value) {
+        return 0;                                                     // RETURN
+    }
+
+    // The limits of 'INTEGER' are (close to) powers of 2, which are exactly
+    // representable as 'double': a 'value' strictly between them converts to
+    // 'INTEGER' without overflow.
+
+    if (value <= static_cast<double>(Limits::min())) {
+        return Limits::min();                                         // RETURN
+    }
+    if (value >= static_cast<double>(Limits::max())) {
+        return Limits::max();                                         // RETURN
+    }
+    return static_cast<INTEGER>(value);
+}
+
+int clampedWidth(int value)
+    // Return the specified 'value' limited to the range
+    // '[-DeferredMessage::k_MAX_WIDTH .. DeferredMessage::k_MAX_WIDTH]'.
+{
+    return bsl::max<int>(-DeferredMessage::k_MAX_WIDTH,
+                         bsl::min<int>(value, DeferredMessage::k_MAX_WIDTH));
+}
+
+int parseWidth(const char **input)
+    // Return the value of the decimal digits at the specified '*input',
+    // limited to 'DeferredMessage::k_MAX_WIDTH', and advance '*input' past
+    // them.
+{
+    int value = 0;
+    while (isDigit(**input)) {
+        if (value <= DeferredMessage::k_MAX_WIDTH) {
+            value = value * 10 + (**input - '0');
+        }
+        ++*input;
+    }
+    return clampedWidth(value);
+}
+
+void appendNumber(char **position, int value)
+    // Write the decimal representation of the specified 'value' to the
+    // specified '*position', and advance '*position' past it.
+{
+    *position += bsl::sprintf(*position, "%d", value);
+}
+
+template <class TYPE>
+void formatOne(bsl::streambuf *streamBuf, const char *spec, TYPE value)
+    // Write to the specified 'streamBuf' the specified 'value' formatted by
+    // 'snprintf' according to the specified 'spec'.  The behavior is
+    // undefined unless 'spec' holds exactly one conversion specification,
+    // expecting an argument of type 'TYPE'.
+{
+    char      buffer[k_OUTPUT_CAPACITY];
+    const int length = bsl::snprintf(buffer, sizeof buffer, spec, value);
+    if (length < 0) {
+        return;                                                       // RETURN
+    }
+    if (length < static_cast<int>(sizeof buffer)) {
+        streamBuf->sputn(buffer, length);
+        return;                                                       // RETURN
+    }
+
+    bsl::vector<char> largeBuffer(length + 1,
+                                  '\0',
+                                  bslma::Default::defaultAllocator());
+    bsl::snprintf(largeBuffer.data(), largeBuffer.size(), spec, value);
+    streamBuf->sputn(largeBuffer.data(), length);
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+                           // ---------------------
+                           // class DeferredMessage
+                           // ---------------------
+
+// CREATORS
+DeferredMessage::DeferredMessage(const DeferredMessage& original)
+: d_format_p(original.d_format_p)
+, d_numArguments(original.d_numArguments)
+, d_stringLength(original.d_stringLength)
+{
+    bsl::memcpy(d_arguments,
+                original.d_arguments,
+                d_numArguments * sizeof *d_arguments);
+    bsl::memcpy(d_strings, original.d_strings, d_stringLength);
+}
+
+// MANIPULATORS
+DeferredMessage& DeferredMessage::operator=(const DeferredMessage& rhs)
+{
+    if (this != &rhs) {
+        d_format_p     = rhs.d_format_p;
+        d_numArguments = rhs.d_numArguments;
+        d_stringLength = rhs.d_stringLength;
+        bsl::memcpy(d_arguments,
+                    rhs.d_arguments,
+                    d_numArguments * sizeof *d_arguments);
+        bsl::memcpy(d_strings, rhs.d_strings, d_stringLength);
+    }
+    return *this;
+}
+
+void DeferredMessage::appendArgument(const char *value)
+{
+    Argument& argument = nextArgument(e_STRING);
+
+    if (!value) {
+        argument.d_type    = e_POINTER;
+        argument.d_pointer = 0;
+        return;                                                       // RETURN
+    }
+
+    const bsl::size_t size = bsl::strlen(value) + 1;  // with terminator
+
+    if (size > static_cast<bsl::size_t>(k_STRING_CAPACITY - d_stringLength)) {
+        // The string does not fit: hold it by address, rather than truncate
+        // it.
+
+        argument.d_type    = e_BORROWED;
+        argument.d_pointer = value;
+        return;                                                       // RETURN
+    }
+
+    argument.d_stringOffset = d_stringLength;
+
+    bsl::memcpy(d_strings + d_stringLength, value, size);
+    d_stringLength += static_cast<int>(size);
+}
+
+// PRIVATE ACCESSORS
+int DeferredMessage::intValue(int index) const
+{
+    BSLS_ASSERT(0 <= index);
+    BSLS_ASSERT(index < d_numArguments);
+
+    typedef bsl::numeric_limits<int> IntLimits;
+
+    const Argument& argument = d_arguments[index];
+    switch (argument.d_type) {
+      case e_SIGNED: {
+        const bsls::Types::Int64 value = argument.d_signed;
+        return value < IntLimits::min() ? IntLimits::min()
+             : value > IntLimits::max() ? IntLimits::max()
+             : static_cast<int>(value);                               // RETURN
+      }
+      case e_UNSIGNED: {
+        const bsls::Types::Uint64 value = argument.d_unsigned;
+        return value > static_cast<bsls::Types::Uint64>(IntLimits::max())
+               ? IntLimits::max()
+               : static_cast<int>(value);                             // RETURN
+      }
+      case e_DOUBLE: {
+        return u::clampedValue<int>(argument.d_double);               // RETURN
+      }
+      default: {
+        return 0;                                                     // RETURN
+      }
+    }
+}
+
+// ACCESSORS
+void DeferredMessage::formatMessage(bsl::streambuf *streamBuf) const
+{
+    BSLS_ASSERT(streamBuf);
+
+    const char *input = d_format_p;
+    if (!input) {
+        return;                                                       // RETURN
+    }
+
+    int nextArgument = 0;
+
+    while (*input) {
+        const char *text = input;
+        while (*input && '%' != *input) {
+            ++input;
+        }
+        if (input != text) {
+            streamBuf->sputn(text, input - text);
+        }
+        if (!*input) {
+            break;
+        }
+
+        // '*input' is '%'.
+
+        const char *specBegin = input++;
+
+        if ('%' == *input) {
+            streamBuf->sputc('%');
+            ++input;
+            continue;
+        }
+
+        char  spec[u::k_SPEC_CAPACITY];
+        char *output = spec;
+
+        *output++ = '%';
+
+        int numFlags = 0;
+        while (u::isFlag(*input)) {
+            if (numFlags < 8) {
+                *output++ = *input;
+                ++numFlags;
+            }
+            ++input;
+        }
+
+        if ('*' == *input) {
+            ++input;
+            if (nextArgument < d_numArguments) {
+                u::appendNumber(&output,
+                                u::clampedWidth(intValue(nextArgument++)));
+            }
+        }
+        else if (u::isDigit(*input)) {
+            u::appendNumber(&output, u::parseWidth(&input));
+        }
+
+        if ('.' == *input) {
+            *output++ = *input++;
+            if ('*' == *input) {
+                ++input;
+                if (nextArgument < d_numArguments) {
+                    const int precision = intValue(nextArgument++);
+                    if (0 <= precision) {
+                        u::appendNumber(&output, u::clampedWidth(precision));
+                    }
+                    else {
+                        // A negative precision is taken as if the precision
+                        // were omitted.
+
+                        --output;
+                    }
+                }
+            }
+            else if (u::isDigit(*input)) {
+                u::appendNumber(&output, u::parseWidth(&input));
+            }
+        }
+
+        while (u::isLengthModifier(*input)) {
+            ++input;
+        }
+
+        char conversion = *input;
+        if (!conversion) {
+            // Incomplete specification at the end of the format string:
+            // write it as is.
+
+            streamBuf->sputn(specBegin, input - specBegin);
+            break;
+        }
+        ++input;
+
+        if ('n' == conversion) {
+            if (nextArgument < d_numArguments) {
+                ++nextArgument;
+            }
+            continue;
+        }
+
+        if (!bsl::strchr("diouxXcfFeEgGaAsp", conversion)) {
+            // Unknown conversion: write the specification as is.
+
+            streamBuf->sputn(specBegin, input - specBegin);
+            continue;
+        }
+
+        if (nextArgument == d_numArguments) {
+            continue;
+        }
+
+        const Argument& argument = d_arguments[nextArgument++];
+
+        const bool isIntegerConversion = bsl::strchr("diouxX", conversion);
+        const bool isDoubleConversion  = bsl::strchr("fFeEgGaA", conversion);
+
+        switch (argument.d_type) {
+          case e_SIGNED:
+          case e_UNSIGNED: {
+            const bool isSigned = e_SIGNED == argument.d_type;
+
+            const long long          signedValue =
+                                 isSigned
+                                 ? static_cast<long long>(argument.d_signed)
+                                 : static_cast<long long>(argument.d_unsigned);
+            const unsigned long long unsignedValue =
+                                 static_cast<unsigned long long>(signedValue);
+
+            if (isDoubleConversion) {
+                *output++ = conversion;
+                *output   = '\0';
+                u::formatOne(streamBuf,
+                             spec,
+                             isSigned
+                             ? static_cast<double>(signedValue)
+                             : static_cast<double>(unsignedValue));
+            }
+            else if ('c' == conversion) {
+                *output++ = conversion;
+                *output   = '\0';
+                u::formatOne(streamBuf, spec, static_cast<int>(signedValue));
+            }
+            else {
+                if (!isIntegerConversion) {
+                    conversion = isSigned ? 'd' : 'u';
+                }
+                *output++ = 'l';
+                *output++ = 'l';
+                *output++ = conversion;
+                *output   = '\0';
+                if ('d' == conversion || 'i' == conversion) {
+                    if (isSigned) {
+                        u::formatOne(streamBuf, spec, signedValue);
+                    }
+                    else {
+                        // Format as unsigned, keeping the flags and width.
+
+                        output[-1] = 'u';
+                        u::formatOne(streamBuf, spec, unsignedValue);
+                    }
+                }
+                else {
+                    u::formatOne(streamBuf, spec, unsignedValue);
+                }
+            }
+          } break;
+          case e_DOUBLE: {
+            if (isIntegerConversion || 'c' == conversion) {
+                if ('c' == conversion) {
+                    *output++ = conversion;
+                    *output   = '\0';
+                    u::formatOne(streamBuf,
+                                 spec,
+                                 u::clampedValue<int>(argument.d_double));
+                }
+                else {
+                    typedef long long LongLong;
+
+                    *output++ = 'l';
+                    *output++ = 'l';
+                    *output++ = 'd';
+                    *output   = '\0';
+                    u::formatOne(streamBuf,
+                                 spec,
+                                 u::clampedValue<LongLong>(argument.d_double));
+                }
+            }
+            else {
+                *output++ = isDoubleConversion ? conversion : 'g';
+                *output   = '\0';
+                u::formatOne(streamBuf, spec, argument.d_double);
+            }
+          } break;
+          case e_POINTER: {
+            if (!argument.d_pointer && 's' == conversion) {
+                *output++ = 's';
+                *output   = '\0';
+                u::formatOne(streamBuf, spec, "(null)");
+            }
+            else {
+                // Other conversions of a pointer are not portable; format it
+                // as a pointer (without a precision, which 'p' does not
+                // accept).
+
+                output    = spec;
+                *output++ = '%';
+                *output++ = 'p';
+                *output   = '\0';
+                u::formatOne(streamBuf, spec, argument.d_pointer);
+            }
+          } break;
+          case e_STRING: {
+            *output++ = 's';
+            *output   = '\0';
+            u::formatOne(streamBuf,
+                         spec,
+                         static_cast<const char *>(
+                                        d_strings + argument.d_stringOffset));
+          } break;
+          case e_BORROWED: {
+            *output++ = 's';
+            *output   = '\0';
+            u::formatOne(streamBuf,
+                         spec,
+                         static_cast<const char *>(argument.d_pointer));
+          } break;
+          default: {
+            BSLS_ASSERT(!"Unreachable");
+          }
+        }
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,556 @@
+// ball_deferredmessage.h                                             -*-C++-*-
+#ifndef INCLUDED_BALL_DEFERREDMESSAGE
+#define INCLUDED_BALL_DEFERREDMESSAGE
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a 'printf'-style log message formatted after capture.
+//
+//@CLASSES:
+//  ball::DeferredMessage: format string and captured arguments of a message
+//
+//@SEE_ALSO: ball_recordattributes, ball_log
+//
+//@DESCRIPTION: This component provides an in-core mechanism,
+// 'ball::DeferredMessage', that captures, in a compact binary form, a
+// 'printf'-style format string and the arguments to be formatted according to
+// it, so that the (comparatively expensive) formatting of the message text
+// can be done later, and on another thread.  Capturing a message copies the
+// address of the format string and the value of each argument into storage
+// held within the object; no memory is allocated, and no text is formatted.
+// 'formatMessage' writes the formatted text to a stream buffer.
+//
+// A message is *self-contained* if it depends on no argument having been
+// captured by address other than its format string (see
+// {Supported Arguments}); only a self-contained message may be formatted
+// after the arguments of the capture have been modified or destroyed.
+//
+// 'ball::DeferredMessage' is the representation of the messages logged by the
+// 'BALL_LOGDEFER_*' macros of 'ball_log', whose records are formatted by
+// the thread that first reads their message attribute (see
+// 'ball_recordattributes'), e.g., the publication thread of a
+// 'ball::AsyncFileObserver'.
+//
+///Format String Lifetime
+///----------------------
+// Only the *address* of the format string is captured.  The format string
+// must therefore remain valid, and unchanged, until the message has been
+// formatted for the last time; in practice, it must be a string literal.
+//
+///Supported Arguments
+///-------------------
+// The following argument types can be captured (by 'appendArgument', or by
+// 'capture' on platforms that support variadic templates):
+//
+//: o Integral types (including 'bool', the character types, and unscoped
+//:   enumerations, which are promoted to 'int'), captured as a 64-bit signed
+//:   or unsigned value.
+//:
+//: o 'float', 'double', and 'long double', captured as a 'double' (a
+//:   'long double' may therefore lose precision).
+//:
+//: o 'const char *' (and 'char *'), whose null-terminated string is *copied*
+//:   into the object, so that it need not outlive the call.  The strings of
+//:   the arguments of one message share 'k_STRING_CAPACITY' bytes of storage
+//:   (including a null terminator for each).  A string that does not fit in
+//:   the remaining storage is *not* copied, but captured by address, so that
+//:   the message is no longer self-contained ('capture' then returns a
+//:   non-zero value, and 'isSelfContained' returns 'false'): such a message
+//:   must be formatted while the string is still valid.  A null pointer is
+//:   formatted as "(null)".
+//:
+//: o Any other pointer, captured as a 'const void *'.
+//
+// At most 'k_MAX_NUM_ARGUMENTS' arguments can be captured; each '*' width or
+// precision in the format string consumes one (integral) argument, as it does
+// for 'printf'.
+//
+///Formatting
+///----------
+// 'formatMessage' interprets the format string as 'printf' does, with the
+// following exceptions, which ensure that formatting a captured message never
+// has undefined behavior:
+//
+//: o The length modifiers of a conversion specification (e.g., 'l', 'll',
+//:   'h', 'z') are ignored; each argument is formatted using the type with
+//:   which it was captured.
+//:
+//: o An argument whose captured type does not match its conversion is
+//:   converted: a numeric argument is converted to the type the conversion
+//:   expects, and a string formatted by a numeric conversion (or a number by
+//:   a 's' conversion) is written as if its natural conversion ('s', 'd',
+//:   'u', 'g', or 'p') had been specified.
+//:
+//: o A pointer argument is formatted as if by "%p", whatever its conversion
+//:   (except that a null string is formatted by a 's' conversion as
+//:   "(null)").
+//:
+//: o A conversion specification for which no argument was captured writes
+//:   nothing, and an 'n' conversion (which would store the number of
+//:   characters written) is ignored.
+//:
+//: o A floating-point argument formatted by an integer (or 'c') conversion,
+//:   or used as a '*' width or precision, is converted to the nearest value
+//:   of the expected integer type (a NaN being converted to 0).
+//:
+//: o A width or precision larger than 'k_MAX_WIDTH' is reduced to
+//:   'k_MAX_WIDTH'.  As for 'printf', a negative '*' precision is taken as
+//:   if the precision were omitted, and a negative '*' width as a '-' flag
+//:   followed by a positive width.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Formatting a Message Captured Earlier
+/// - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose a latency-critical thread needs to report the execution of an
+// order, but must not spend the time needed to format the report.
+//
+// First, the critical thread captures the format string and the arguments;
+// note that the symbol is copied, so the buffer holding it may be reused
+// immediately:
+//..
+//  char symbol[8] = "IBM";
+//
+//  ball::DeferredMessage message;
+//  message.reset("executed %d shares of %s at %.2f");
+//  message.appendArgument(400);
+//  message.appendArgument(symbol);
+//  message.appendArgument(126.375);
+//
+//  bsl::strcpy(symbol, "XXX");
+//..
+// Then, another thread formats the message:
+//..
+//  bdlsb::MemOutStreamBuf streamBuf;
+//  message.formatMessage(&streamBuf);
+//
+//  const bsl::string text(streamBuf.data(), streamBuf.length());
+//  assert("executed 400 shares of IBM at 126.38" == text);
+//..
+// Finally, we note that, on platforms supporting variadic templates, the
+// message can be captured in one call:
+//..
+//  #if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+//  message.capture("executed %d shares of %s at %.2f", 400, "IBM", 126.375);
+//  #endif
+//..
+
+#include <balscm_version.h>
+
+#include <bslmf_assert.h>
+
+#include <bsls_assert.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_types.h>
+
+#include <bsl_streambuf.h>
+
+namespace BloombergLP {
+namespace ball {
+
+                           // =====================
+                           // class DeferredMessage
+                           // =====================
+
+class DeferredMessage {
+    // This class provides storage for a 'printf'-style format string and the
+    // arguments to be formatted according to it.  The format string is held
+    // by address; the arguments are held by value, their strings being
+    // copied if they fit in the storage of the object, and held by address
+    // otherwise.  Copying an object copies the captured arguments (but not
+    // the strings held by address).
+
+  public:
+    // PUBLIC CONSTANTS
+    enum {
+        k_MAX_NUM_ARGUMENTS = 12,  // maximum number of captured arguments
+
+        k_STRING_CAPACITY   = 192, // bytes shared by the copies of the string
+                                   // arguments, including null terminators
+
+        k_MAX_WIDTH         = 4096 // largest width or precision with which
+                                   // an argument is formatted
+    };
+
+  private:
+    // PRIVATE TYPES
+    enum ArgumentType {
+        // This enumeration defines the types with which arguments are
+        // captured.
+
+        e_SIGNED,    // 'bsls::Types::Int64'
+        e_UNSIGNED,  // 'bsls::Types::Uint64'
+        e_DOUBLE,    // 'double'
+        e_POINTER,   // 'const void *'
+        e_STRING,    // copied string
+        e_BORROWED   // string held by address, as 'const void *'
+    };
+
+    struct Argument {
+        // This 'struct' holds one captured argument.
+
+        int                     d_type;           // 'ArgumentType' value
+        union {
+            bsls::Types::Int64  d_signed;
+            bsls::Types::Uint64 d_unsigned;
+            double              d_double;
+            const void         *d_pointer;
+            int                 d_stringOffset;   // offset in 'd_strings'
+        };
+    };
+
+    // DATA
+    const char *d_format_p;      // format string (held, not owned)
+
+    int         d_numArguments;  // number of captured arguments
+
+    int         d_stringLength;  // number of bytes of 'd_strings' in use
+
+    Argument    d_arguments[k_MAX_NUM_ARGUMENTS];
+                                 // captured arguments
+
+    char        d_strings[k_STRING_CAPACITY];
+                                 // null-terminated copies of the string
+                                 // arguments
+
+    // PRIVATE MANIPULATORS
+    Argument& nextArgument(ArgumentType type);
+        // Return a reference to the next unused argument slot, having its type
+        // set to the specified 'type'.  The behavior is undefined unless
+        // 'numArguments() < k_MAX_NUM_ARGUMENTS'.
+
+    void appendSigned(bsls::Types::Int64 value);
+    void appendUnsigned(bsls::Types::Uint64 value);
+        // Capture the specified 'value' as the next argument.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+    void appendArguments();
+    template <class FIRST, class... REST>
+    void appendArguments(const FIRST& first, const REST&... rest);
+        // Capture the specified 'first' and 'rest' arguments, in order.
+#endif
+
+    // PRIVATE ACCESSORS
+    int intValue(int index) const;
+        // Return the value of the argument at the specified 'index' converted
+        // to 'int', or 0 if that argument is not a number or is a NaN.  A
+        // value outside the range of 'int' is converted to the nearest limit
+        // of that range.  The behavior is undefined unless
+        // '0 <= index < numArguments()'.
+
+  public:
+    // CREATORS
+    DeferredMessage();
+        // Create an empty deferred message, having no format string and no
+        // captured arguments.  Note that formatting an empty message writes
+        // nothing.
+
+    DeferredMessage(const DeferredMessage& original);
+        // Create a deferred message having the format string and captured
+        // arguments of the specified 'original' object.
+
+    //! ~DeferredMessage() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    DeferredMessage& operator=(const DeferredMessage& rhs);
+        // Assign to this object the format string and captured arguments of
+        // the specified 'rhs' object, and return a reference providing
+        // modifiable access to this object.
+
+    void appendArgument(bool value);
+    void appendArgument(char value);
+    void appendArgument(signed char value);
+    void appendArgument(unsigned char value);
+    void appendArgument(short value);
+    void appendArgument(unsigned short value);
+    void appendArgument(int value);
+    void appendArgument(unsigned int value);
+    void appendArgument(long value);
+    void appendArgument(unsigned long value);
+    void appendArgument(long long value);
+    void appendArgument(unsigned long long value);
+    void appendArgument(float value);
+    void appendArgument(double value);
+    void appendArgument(long double value);
+    void appendArgument(const void *value);
+        // Capture the specified 'value' as the next argument of this message
+        // (see {Supported Arguments}).  The behavior is undefined unless
+        // 'numArguments() < k_MAX_NUM_ARGUMENTS'.
+
+    void appendArgument(const char *value);
+    void appendArgument(char *value);
+        // Capture a copy of the specified null-terminated string 'value' (or,
+        // if 'value' is null, a null string) as the next argument of this
+        // message.  If the remaining string storage of this message cannot
+        // hold 'value', capture 'value' by address instead, so that this
+        // message is no longer self-contained.  The behavior is undefined
+        // unless 'numArguments() < k_MAX_NUM_ARGUMENTS'.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+    template <class... ARGS>
+    int capture(const char *format, const ARGS&... arguments);
+        // Set the format string of this message to the specified 'format',
+        // and capture the specified 'arguments', discarding any previously
+        // captured arguments.  'format' is held by address (see
+        // {Format String Lifetime}).  Return 0 if the resulting message is
+        // self-contained, and a non-zero value if some string arguments did
+        // not fit in its storage and were captured by address, in which case
+        // the message must be formatted before those arguments are modified
+        // or destroyed.  This method fails to compile unless each argument
+        // has one of the {Supported Arguments} types, and there are at most
+        // 'k_MAX_NUM_ARGUMENTS' arguments.
+#endif
+
+    void reset(const char *format = 0);
+        // Set the format string of this message to the optionally specified
+        // 'format', and discard the captured arguments.  If 'format' is not
+        // specified, this message is empty.  'format' is held by address (see
+        // {Format String Lifetime}).
+
+    // ACCESSORS
+    void formatMessage(bsl::streambuf *streamBuf) const;
+        // Write to the specified 'streamBuf' the text formatted from the
+        // format string and captured arguments of this message (see
+        // {Formatting}).  Write nothing if this message is empty.
+
+    const char *formatString() const;
+        // Return the address of the format string of this message, or 0 if
+        // this message is empty.
+
+    bool isSelfContained() const;
+        // Return 'true' if every string argument of this message was copied
+        // into its storage, and 'false' if some string argument was captured
+        // by address (see {Supported Arguments}).
+
+    int numArguments() const;
+        // Return the number of arguments captured by this message.
+};
+
+// ============================================================================
+//                              INLINE DEFINITIONS
+// ============================================================================
+
+                           // ---------------------
+                           // class DeferredMessage
+                           // ---------------------
+
+// PRIVATE MANIPULATORS
+inline
+DeferredMessage::Argument& DeferredMessage::nextArgument(ArgumentType type)
+{
+    BSLS_ASSERT(d_numArguments < k_MAX_NUM_ARGUMENTS);
+
+    Argument& argument = d_arguments[d_numArguments++];
+    argument.d_type = type;
+    return argument;
+}
+
+inline
+void DeferredMessage::appendSigned(bsls::Types::Int64 value)
+{
+    nextArgument(e_SIGNED).d_signed = value;
+}
+
+inline
+void DeferredMessage::appendUnsigned(bsls::Types::Uint64 value)
+{
+    nextArgument(e_UNSIGNED).d_unsigned = value;
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+inline
+void DeferredMessage::appendArguments()
+{
+}
+
+template <class FIRST, class... REST>
+inline
+void DeferredMessage::appendArguments(const FIRST& first, const REST&... rest)
+{
+    appendArgument(first);
+    appendArguments(rest...);
+}
+#endif
+
+// CREATORS
+inline
+DeferredMessage::DeferredMessage()
+: d_format_p(0)
+, d_numArguments(0)
+, d_stringLength(0)
+{
+}
+
+// MANIPULATORS
+inline
+void DeferredMessage::appendArgument(bool value)
+{
+    appendSigned(value);
+}
+
+inline
+void DeferredMessage::appendArgument(char value)
+{
+    appendSigned(value);
+}
+
+inline
+void DeferredMessage::appendArgument(signed char value)
+{
+    appendSigned(value);
+}
+
+inline
+void DeferredMessage::appendArgument(unsigned char value)
+{
+    appendUnsigned(value);
+}
+
+inline
+void DeferredMessage::appendArgument(short value)
+{
+    appendSigned(value);
+}
+
+inline
+void DeferredMessage::appendArgument(unsigned short value)
+{
+    appendUnsigned(value);
+}
+
+inline
+void DeferredMessage::appendArgument(int value)
+{
+    appendSigned(value);
+}
+
+inline
+void DeferredMessage::appendArgument(unsigned int value)
+{
+    appendUnsigned(value);
+}
+
+inline
+void DeferredMessage::appendArgument(long value)
+{
+    appendSigned(value);
+}
+
+inline
+void DeferredMessage::appendArgument(unsigned long value)
+{
+    appendUnsigned(value);
+}
+
+inline
+void DeferredMessage::appendArgument(long long value)
+{
+    appendSigned(value);
+}
+
+inline
+void DeferredMessage::appendArgument(unsigned long long value)
+{
+    appendUnsigned(value);
+}
+
+inline
+void DeferredMessage::appendArgument(float value)
+{
+    nextArgument(e_DOUBLE).d_double = value;
+}
+
+inline
+void DeferredMessage::appendArgument(double value)
+{
+    nextArgument(e_DOUBLE).d_double = value;
+}
+
+inline
+void DeferredMessage::appendArgument(long double value)
+{
+    nextArgument(e_DOUBLE).d_double = static_cast<double>(value);
+}
+
+inline
+void DeferredMessage::appendArgument(const void *value)
+{
+    nextArgument(e_POINTER).d_pointer = value;
+}
+
+inline
+void DeferredMessage::appendArgument(char *value)
+{
+    appendArgument(static_cast<const char *>(value));
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+template <class... ARGS>
+inline
+int DeferredMessage::capture(const char *format, const ARGS&... arguments)
+{
+    BSLMF_ASSERT(sizeof...(ARGS) <= k_MAX_NUM_ARGUMENTS);
+
+    reset(format);
+    appendArguments(arguments...);
+
+    return isSelfContained() ? 0 : -1;
+}
+#endif
+
+inline
+void DeferredMessage::reset(const char *format)
+{
+    d_format_p     = format;
+    d_numArguments = 0;
+    d_stringLength = 0;
+}
+
+// ACCESSORS
+inline
+const char *DeferredMessage::formatString() const
+{
+    return d_format_p;
+}
+
+inline
+bool DeferredMessage::isSelfContained() const
+{
+    for (int i = 0; i < d_numArguments; ++i) {
+        if (e_BORROWED == d_arguments[i].d_type) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+inline
+int DeferredMessage::numArguments() const
+{
+    return d_numArguments;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
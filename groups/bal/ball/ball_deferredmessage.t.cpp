@@ -0,0 +1,795 @@
+// ball_deferredmessage.t.cpp                                         -*-C++-*-
+#include <ball_deferredmessage.h>
+
+#include <bdlsb_memoutstreambuf.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_stopwatch.h>
+
+#include <bsl_climits.h>
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_limits.h>
+#include <bsl_string.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is an in-core mechanism that captures a format
+// string and arguments, and formats them later.  We verify that the arguments
+// of each supported type are captured (strings being copied), that copies
+// hold the same captured arguments, and that 'formatMessage' produces the
+// same text as 'sprintf' for well-formed formats, and well-defined text for
+// formats incompatible with the captured arguments.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] DeferredMessage();
+// [ 2] DeferredMessage(const DeferredMessage& original);
+//
+// MANIPULATORS
+// [ 2] DeferredMessage& operator=(const DeferredMessage& rhs);
+// [ 3] void appendArgument(<arithmetic type> value);
+// [ 3] void appendArgument(const void *value);
+// [ 3] void appendArgument(const char *value);
+// [ 3] void appendArgument(char *value);
+// [ 2] int capture(const char *format, const ARGS&... arguments);
+// [ 2] void reset(const char *format = 0);
+//
+// ACCESSORS
+// [ 3] void formatMessage(bsl::streambuf *streamBuf) const;
+// [ 2] const char *formatString() const;
+// [ 3] bool isSelfContained() const;
+// [ 2] int numArguments() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CONCERN: incompatible formats are formatted without UB
+// [ 5] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                     NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+#define ASSERT_PASS_RAW(EXPR)  BSLS_ASSERTTEST_ASSERT_PASS_RAW(EXPR)
+#define ASSERT_FAIL_RAW(EXPR)  BSLS_ASSERTTEST_ASSERT_FAIL_RAW(EXPR)
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef ball::DeferredMessage Obj;
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static bsl::string format(const Obj& message)
+    // Return the text formatted from the specified 'message'.  Note that the
+    // stream buffer used does not allocate from the default allocator.
+{
+    bdlsb::MemOutStreamBuf streamBuf(bslma::Default::globalAllocator());
+    message.formatMessage(&streamBuf);
+    return bsl::string(streamBuf.data(), streamBuf.length());
+}
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator         da("default", veryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Example 1: Formatting a Message Captured Earlier
+/// - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose a latency-critical thread needs to report the execution of an
+// order, but must not spend the time needed to format the report.
+//
+// First, the critical thread captures the format string and the arguments;
+// note that the symbol is copied, so the buffer holding it may be reused
+// immediately:
+//..
+    char symbol[8] = "IBM";
+
+    ball::DeferredMessage message;
+    message.reset("executed %d shares of %s at %.2f");
+    message.appendArgument(400);
+    message.appendArgument(symbol);
+    message.appendArgument(126.375);
+
+    bsl::strcpy(symbol, "XXX");
+//..
+// Then, another thread formats the message:
+//..
+    bdlsb::MemOutStreamBuf streamBuf;
+    message.formatMessage(&streamBuf);
+
+    const bsl::string text(streamBuf.data(), streamBuf.length());
+    ASSERT("executed 400 shares of IBM at 126.38" == text);
+//..
+// Finally, we note that, on platforms supporting variadic templates, the
+// message can be captured in one call:
+//..
+    #if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+    message.capture("executed %d shares of %s at %.2f", 400, "IBM", 126.375);
+    #endif
+//..
+    ASSERT("executed 400 shares of IBM at 126.38" == format(message));
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCERN: INCOMPATIBLE FORMATS ARE FORMATTED WITHOUT UB
+        //
+        // Concerns:
+        //: 1 Length modifiers are ignored.
+        //:
+        //: 2 A numeric argument is converted to the type its conversion
+        //:   expects.
+        //:
+        //: 3 A string formatted by a numeric conversion, or a number formatted
+        //:   by a 's' conversion, is formatted by its natural conversion.
+        //:
+        //: 4 A pointer is formatted as by "%p", and a null string as
+        //:   "(null)".
+        //:
+        //: 5 A conversion without an argument writes nothing, an 'n'
+        //:   conversion is ignored, and an unknown or incomplete conversion
+        //:   specification is written as is.
+        //:
+        //: 6 A NaN or out-of-range floating-point argument formatted by an
+        //:   integer conversion, or used as a '*' width or precision, is
+        //:   converted to 0 or to the nearest limit of the expected type.
+        //:
+        //: 7 A negative '*' precision is ignored, a negative '*' width
+        //:   left-justifies, and widths and precisions are limited to
+        //:   'k_MAX_WIDTH'.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, capture messages whose formats
+        //:   are incompatible with their arguments, and verify the formatted
+        //:   text.  (C-1..5)
+        //:
+        //: 2 Capture NaNs, infinities, and values outside the range of the
+        //:   expected integer types, and verify the formatted text.  (C-6)
+        //:
+        //: 3 Capture negative and very large widths and precisions, and
+        //:   verify the formatted text.  (C-7)
+        //
+        // Testing:
+        //   CONCERN: incompatible formats are formatted without UB
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: INCOMPATIBLE FORMATS ARE FORMATTED "
+                          << "WITHOUT UB" << endl
+                          << "============================================"
+                          << "==========" << endl;
+
+        int        anObject;
+        const void *POINTER = &anObject;
+        char        pointerText[32];
+        bsl::sprintf(pointerText, "%p", POINTER);
+
+        Obj mX;  const Obj& X = mX;
+
+        if (veryVerbose) cout << "\tLength modifiers." << endl;
+        {
+            mX.reset("%hd %lld %zu %Lf %hhx");
+            mX.appendArgument(100000);
+            mX.appendArgument(7);
+            mX.appendArgument(8u);
+            mX.appendArgument(1.5);
+            mX.appendArgument(300);
+            ASSERTV(format(X), "100000 7 8 1.500000 12c" == format(X));
+        }
+
+        if (veryVerbose) cout << "\tNumeric conversions." << endl;
+        {
+            mX.reset("%d %f %c %x %u %e");
+            mX.appendArgument(2.75);
+            mX.appendArgument(3);
+            mX.appendArgument(65.0);
+            mX.appendArgument(-1);
+            mX.appendArgument(-1);
+            mX.appendArgument(static_cast<unsigned char>(2));
+            ASSERTV(format(X),
+                    "2 3.000000 A ffffffffffffffff 18446744073709551615 "
+                    "2.000000e+00" == format(X));
+
+            mX.reset("%d %i");
+            mX.appendArgument(ULLONG_MAX);
+            mX.appendArgument(static_cast<unsigned short>(65535));
+            ASSERTV(format(X), "18446744073709551615 65535" == format(X));
+        }
+
+        if (veryVerbose) cout << "\tNatural conversions." << endl;
+        {
+            mX.reset("%5d|%s|%s|%s|%.3s");
+            mX.appendArgument("abc");
+            mX.appendArgument(-12);
+            mX.appendArgument(12u);
+            mX.appendArgument(0.5);
+            mX.appendArgument("abcdef");
+            ASSERTV(format(X), "  abc|-12|12|0.5|abc" == format(X));
+        }
+
+        if (veryVerbose) cout << "\tPointers." << endl;
+        {
+            mX.reset("%p %d %s %s");
+            mX.appendArgument(POINTER);
+            mX.appendArgument(POINTER);
+            mX.appendArgument(POINTER);
+            mX.appendArgument(static_cast<const char *>(0));
+
+            const bsl::string EXPECTED = bsl::string(pointerText) + ' '
+                                       + pointerText + ' '
+                                       + pointerText + " (null)";
+            ASSERTV(format(X), EXPECTED, EXPECTED == format(X));
+        }
+
+        if (veryVerbose) cout << "\tMissing arguments, 'n', unknown." << endl;
+        {
+            mX.reset("a%db%nc%s%");
+            mX.appendArgument(1);
+            mX.appendArgument(2);
+            ASSERTV(format(X), "a1bc%" == format(X));
+
+            mX.reset("%k %5.2k %d");
+            mX.appendArgument(3);
+            ASSERTV(format(X), "%k %5.2k 3" == format(X));
+
+            mX.reset("%*d|%-*.*f");
+            mX.appendArgument(4);
+            ASSERTV(format(X), "|" == format(X));
+        }
+
+        const double NAN_VALUE = bsl::numeric_limits<double>::quiet_NaN();
+        const double INF_VALUE = bsl::numeric_limits<double>::infinity();
+
+        const bsl::string MAX_PADDING(Obj::k_MAX_WIDTH - 1, ' ');
+
+        if (veryVerbose) cout << "\tOut-of-range numbers." << endl;
+        {
+            mX.reset("%d|%*d|%.*f|%c");
+            mX.appendArgument(NAN_VALUE);
+            mX.appendArgument(1e300);
+            mX.appendArgument(5);
+            mX.appendArgument(-3);
+            mX.appendArgument(2.5);
+            mX.appendArgument(1e20);
+            ASSERTV(format(X),
+                    "0|" + MAX_PADDING + "5|2.500000|\xff" == format(X));
+
+            mX.reset("%d %d %d %d %d %i");
+            mX.appendArgument(1e20);
+            mX.appendArgument(-1e20);
+            mX.appendArgument(INF_VALUE);
+            mX.appendArgument(-INF_VALUE);
+            mX.appendArgument(-NAN_VALUE);
+            mX.appendArgument(-2.75);
+            char limitsText[64];
+            bsl::sprintf(limitsText, "%lld %lld", LLONG_MAX, LLONG_MIN);
+            ASSERTV(format(X),
+                    bsl::string(limitsText) + ' ' + limitsText + " 0 -2" ==
+                                                                   format(X));
+
+            mX.reset("%c%c%c");
+            mX.appendArgument(-1e20);
+            mX.appendArgument(NAN_VALUE);
+            mX.appendArgument(66.9);
+            ASSERTV(format(X), bsl::string("\0\0B", 3) == format(X));
+
+            mX.reset("%*d|%.*d|%*d");
+            mX.appendArgument(-NAN_VALUE);
+            mX.appendArgument(1);
+            mX.appendArgument(ULLONG_MAX);
+            mX.appendArgument(2);
+            mX.appendArgument(-1e300);
+            mX.appendArgument(3);
+            ASSERTV(format(X),
+                    "1|" + bsl::string(Obj::k_MAX_WIDTH - 1, '0') + "2|3" +
+                                                 MAX_PADDING == format(X));
+        }
+
+        if (veryVerbose) cout << "\tWidths and precisions." << endl;
+        {
+            mX.reset("%.*f|%.*s|%-*d|%*d|%.*e");
+            mX.appendArgument(-3);
+            mX.appendArgument(2.5);
+            mX.appendArgument(INT_MIN);
+            mX.appendArgument("abc");
+            mX.appendArgument(3);
+            mX.appendArgument(1);
+            mX.appendArgument(-3);
+            mX.appendArgument(2);
+            mX.appendArgument(-1.5);
+            mX.appendArgument(0.5);
+            ASSERTV(format(X),
+                    "2.500000|abc|1  |2  |5.000000e-01" == format(X));
+
+            mX.reset("%99999999999d|%.99999999999f|%05d");
+            mX.appendArgument(7);
+            mX.appendArgument(1);
+            mX.appendArgument(42);
+            ASSERTV(format(X),
+                    MAX_PADDING + "7|1." +
+                    bsl::string(Obj::k_MAX_WIDTH, '0') + "|00042" ==
+                                                                   format(X));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'appendArgument' AND 'formatMessage'
+        //
+        // Concerns:
+        //: 1 An argument of each supported type is captured with its value.
+        //:
+        //: 2 'formatMessage' produces the same text as 'sprintf' for a format
+        //:   compatible with the arguments, including flags, widths,
+        //:   precisions, '*' widths and precisions, and '%%'.
+        //:
+        //: 3 String arguments are copied, and a string that does not fit in
+        //:   the remaining storage is held by address, not truncated, making
+        //:   the message not self-contained.
+        //:
+        //: 4 Text longer than the internal formatting buffer is formatted
+        //:   completely.
+        //:
+        //: 5 An empty message formats to nothing.
+        //
+        // Plan:
+        //: 1 Capture one argument of each type, and compare the formatted text
+        //:   with that of 'sprintf'.  (C-1..2)
+        //:
+        //: 2 Capture strings from a buffer, overwrite the buffer, and verify
+        //:   the formatted text.  Capture strings exceeding the storage, and
+        //:   verify 'isSelfContained' and that they are formatted entirely.
+        //:   (C-3)
+        //:
+        //: 3 Format a string argument with a large width.  (C-4)
+        //:
+        //: 4 Format a default-constructed object.  (C-5)
+        //
+        // Testing:
+        //   void appendArgument(<arithmetic type> value);
+        //   void appendArgument(const void *value);
+        //   void appendArgument(const char *value);
+        //   void appendArgument(char *value);
+        //   void formatMessage(bsl::streambuf *streamBuf) const;
+        //   bool isSelfContained() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'appendArgument' AND 'formatMessage'"
+                          << endl
+                          << "============================================"
+                          << endl;
+
+        char expected[512];
+
+        if (veryVerbose) cout << "\tEach argument type." << endl;
+        {
+            const char *FORMAT = "%d %c %d %u %hd %hu %d %u %ld %lu %lld %llu";
+
+            Obj mX;  const Obj& X = mX;
+            mX.reset(FORMAT);
+            mX.appendArgument(true);
+            mX.appendArgument('x');
+            mX.appendArgument(static_cast<signed char>(-5));
+            ASSERT(3 == X.numArguments());
+            mX.appendArgument(static_cast<unsigned char>(250));
+            mX.appendArgument(static_cast<short>(-300));
+            mX.appendArgument(static_cast<unsigned short>(60000));
+            mX.appendArgument(INT_MIN);
+            mX.appendArgument(UINT_MAX);
+            mX.appendArgument(LONG_MIN);
+            mX.appendArgument(ULONG_MAX);
+            mX.appendArgument(LLONG_MIN);
+            mX.appendArgument(ULLONG_MAX);
+            ASSERT(Obj::k_MAX_NUM_ARGUMENTS == X.numArguments());
+
+            bsls::AssertTestHandlerGuard hG;
+            ASSERT_SAFE_FAIL(mX.appendArgument(1));
+
+            bsl::sprintf(expected,
+                         "%d %c %d %u %hd %hu %d %u %ld %lu %lld %llu",
+                         true, 'x', -5, 250u, -300, 60000, INT_MIN, UINT_MAX,
+                         LONG_MIN, ULONG_MAX, LLONG_MIN, ULLONG_MAX);
+            const bsl::string EXPECTED = expected;
+            ASSERTV(format(X), EXPECTED, EXPECTED == format(X));
+
+            int         anObject;
+            const void *POINTER = &anObject;
+
+            mX.reset("%f %f %Lf %p %+08.3f|%-6d|%#x|%*.*e|%%");
+            mX.appendArgument(1.25f);
+            mX.appendArgument(-2.5);
+            mX.appendArgument(3.75L);
+            mX.appendArgument(POINTER);
+            mX.appendArgument(3.14159);
+            mX.appendArgument(42);
+            mX.appendArgument(255);
+            mX.appendArgument(12);
+            mX.appendArgument(2);
+            mX.appendArgument(12345.678);
+
+            bsl::sprintf(expected,
+                         "%f %f %Lf %p %+08.3f|%-6d|%#x|%*.*e|%%",
+                         1.25f, -2.5, 3.75L, POINTER, 3.14159, 42, 255,
+                         12, 2, 12345.678);
+            ASSERTV(format(X), expected, expected == format(X));
+        }
+
+        if (veryVerbose) cout << "\tString copies." << endl;
+        {
+            char buffer[16] = "first";
+
+            Obj mX;  const Obj& X = mX;
+            mX.reset("%s-%s-%s");
+            mX.appendArgument(buffer);
+            mX.appendArgument(static_cast<const char *>(buffer));
+            bsl::strcpy(buffer, "second");
+            mX.appendArgument(static_cast<const char *>(""));
+            bsl::strcpy(buffer, "third");
+
+            ASSERTV(format(X), "first-first-" == format(X));
+            ASSERT(X.isSelfContained());
+        }
+
+        if (veryVerbose) cout << "\tStrings exceeding the storage." << endl;
+        {
+            const bsl::string LONG(Obj::k_STRING_CAPACITY - 11, 'a');
+            const bsl::string VERY_LONG(Obj::k_STRING_CAPACITY * 2, 'b');
+
+            Obj mX;  const Obj& X = mX;
+            mX.reset("%s|%s|%s|%s");
+            mX.appendArgument(LONG.c_str());
+            ASSERT(X.isSelfContained());
+            mX.appendArgument("0123456789abc");  // held by address
+            ASSERT(!X.isSelfContained());
+            mX.appendArgument("more");           // still fits
+            mX.appendArgument("");
+
+            ASSERTV(format(X),
+                    LONG + "|0123456789abc|more|" == format(X));
+
+            mX.reset("<%s>");
+            ASSERT(X.isSelfContained());
+            mX.appendArgument(VERY_LONG.c_str());
+            ASSERT(!X.isSelfContained());
+            ASSERTV(format(X), "<" + VERY_LONG + ">" == format(X));
+
+            // A string of 'k_STRING_CAPACITY - 1' characters just fits.
+
+            const char *FITS = VERY_LONG.c_str() + VERY_LONG.size()
+                                               - (Obj::k_STRING_CAPACITY - 1);
+
+            mX.reset("<%s>");
+            mX.appendArgument(FITS);
+            ASSERT(X.isSelfContained());
+        }
+
+        if (veryVerbose) cout << "\tLong output." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+            mX.reset("[%1000s]");
+            mX.appendArgument("x");
+
+            const bsl::string EXPECTED = "[" + bsl::string(999, ' ') + "x]";
+            ASSERTV(format(X).size(), EXPECTED == format(X));
+        }
+
+        if (veryVerbose) cout << "\tEmpty message." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+            ASSERT("" == format(X));
+
+            mX.reset("no conversions");
+            ASSERT("no conversions" == format(X));
+        }
+        ASSERTV(da.numBlocksInUse(), 0 == da.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING CREATORS, 'reset', 'capture', AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 A default-constructed object has no format string and no
+        //:   arguments.
+        //:
+        //: 2 'reset' sets the format string (by address) and discards the
+        //:   arguments.
+        //:
+        //: 3 'capture' sets the format string and captures its arguments,
+        //:   and returns a non-zero value if and only if a string argument
+        //:   does not fit in the storage of the message.
+        //:
+        //: 4 The copy constructor and the assignment operator copy the format
+        //:   string and the arguments, including their strings, and
+        //:   assignment supports aliasing.
+        //:
+        //: 5 No memory is allocated.
+        //
+        // Plan:
+        //: 1 Exercise each method and verify the accessors and the formatted
+        //:   text, using a test allocator installed as the default to verify
+        //:   that no memory is allocated.  (C-1..5)
+        //
+        // Testing:
+        //   DeferredMessage();
+        //   DeferredMessage(const DeferredMessage& original);
+        //   DeferredMessage& operator=(const DeferredMessage& rhs);
+        //   int capture(const char *format, const ARGS&... arguments);
+        //   void reset(const char *format = 0);
+        //   const char *formatString() const;
+        //   int numArguments() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING CREATORS, 'reset', 'capture', AND "
+                          << "ACCESSORS" << endl
+                          << "=========================================="
+                          << "=========" << endl;
+
+        const char *FORMAT = "%s=%d";
+
+        Obj mX;  const Obj& X = mX;
+        ASSERT(0 == X.formatString());
+        ASSERT(0 == X.numArguments());
+
+        mX.reset(FORMAT);
+        ASSERT(FORMAT == X.formatString());
+        ASSERT(0      == X.numArguments());
+
+        mX.appendArgument("key");
+        mX.appendArgument(5);
+        ASSERT(2 == X.numArguments());
+        ASSERT("key=5" == format(X));
+
+        Obj mY(X);  const Obj& Y = mY;
+        ASSERT(FORMAT == Y.formatString());
+        ASSERT(2      == Y.numArguments());
+        ASSERT("key=5" == format(Y));
+
+        mX.reset();
+        ASSERT(0 == X.formatString());
+        ASSERT(0 == X.numArguments());
+        ASSERT("key=5" == format(Y));
+
+        mX = Y;
+        ASSERT(FORMAT == X.formatString());
+        ASSERT("key=5" == format(X));
+
+        mX = X;
+        ASSERT("key=5" == format(X));
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+        ASSERT(0 == mX.capture("%s %s %d %.1f", "a", "b", 3, 4.0));
+        ASSERT(4 == X.numArguments());
+        ASSERT("a b 3 4.0" == format(X));
+
+        ASSERT(0 == mX.capture("none"));
+        ASSERT(0 == X.numArguments());
+        ASSERT("none" == format(X));
+#endif
+
+        ASSERTV(da.numBlocksInUse(), 0 == da.numAllocations());
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+        {
+            const bsl::string LONG(Obj::k_STRING_CAPACITY, 'x');
+
+            ASSERT(0 != mX.capture("%d:%s", 7, LONG.c_str()));
+            ASSERT(2 == X.numArguments());
+            ASSERT(!X.isSelfContained());
+            ASSERT("7:" + LONG == format(X));
+
+            ASSERT(0 == mX.capture("%d", 7));
+            ASSERT(X.isSelfContained());
+        }
+#endif
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Capture a message, format it, and verify the text.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        Obj mX;  const Obj& X = mX;
+
+        mX.reset("%d %s %.2f%%");
+        mX.appendArgument(1);
+        mX.appendArgument("two");
+        mX.appendArgument(3.0);
+
+        ASSERT(3 == X.numArguments());
+        ASSERTV(format(X), "1 two 3.00%" == format(X));
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 Capturing a message is much cheaper than formatting it.
+        //
+        // Plan:
+        //: 1 Capture, and separately format, a typical message repeatedly,
+        //:   and report the time per operation.  The number of iterations may
+        //:   be supplied as the second argument (default 1000000).
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        const int NUM_ITERATIONS = argc > 2 && 0 < bsl::atoi(argv[2])
+                                 ? bsl::atoi(argv[2])
+                                 : 1000000;
+
+        Obj                    mX;
+        bdlsb::MemOutStreamBuf streamBuf(bslma::Default::globalAllocator());
+        bsls::Stopwatch        timer;
+
+        timer.start();
+        for (int i = 0; i < NUM_ITERATIONS; ++i) {
+            mX.reset("order %d: %s %d @ %.4f");
+            mX.appendArgument(i);
+            mX.appendArgument("IBM");
+            mX.appendArgument(100);
+            mX.appendArgument(126.375);
+        }
+        timer.stop();
+        const double captureTime = timer.elapsedTime();
+
+        timer.reset();
+        timer.start();
+        for (int i = 0; i < NUM_ITERATIONS; ++i) {
+            streamBuf.pubseekpos(0);
+            mX.formatMessage(&streamBuf);
+        }
+        timer.stop();
+        const double formatTime = timer.elapsedTime();
+
+        cout << "capture: " << captureTime / NUM_ITERATIONS * 1e9
+             << " ns, format: " << formatTime / NUM_ITERATIONS * 1e9
+             << " ns" << endl;
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -18,7 +18,9 @@ BSLS_IDENT_RCSID(ball_fileobserver2_cpp,"$Id$ $CSID$")
 
 #include <bdlf_memfn.h>
 
+#include <bdls_asyncfileio.h>
 #include <bdls_filesystemutil.h>
+#include <bdls_pathutil.h>
 #include <bdls_processutil.h>
 
 #include <bdlt_currenttime.h>
@@ -27,7 +29,12 @@ BSLS_IDENT_RCSID(ball_fileobserver2_cpp,"$Id$ $CSID$")
 #include <bdlt_localtimeoffset.h>
 #include <bdlt_time.h>
 
+#include <bslma_default.h>
+
+#include <bslmt_condition.h>
 #include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
 
 #include <bsls_assert.h>
 #include <bsls_log.h>
@@ -109,6 +116,19 @@ enum {
     k_ERROR_BUFFER_SIZE   = k_MAX_PATH_LENGTH + 256
 };
 
+enum {
+    // Default size, in kilobytes, by which log files are grown in mapped
+    // output mode if rotation on size is not in effect.
+
+    k_DEFAULT_PREALLOCATION_SIZE = 64 * 1024
+};
+
+enum {
+    // Default size, in kilobytes, of the frames of compressed log files.
+
+    k_DEFAULT_COMPRESSION_FRAME_SIZE = 64
+};
+
 static int getErrorCode(void)
     // Return the system-specific error code.
 {
@@ -316,6 +336,152 @@ static int openLogFile(bsl::ostream *stream, const char *filename)
     return 0;
 }
 
+static int openMappedLogFile(bdls::MappedOutputStreamBuf *streamBuf,
+                             const char                  *filename,
+                             bsls::Types::Int64           growthIncrement)
+    // Open the file with the specified 'filename' for appending through the
+    // specified 'streamBuf', growing the file by at least the specified
+    // 'growthIncrement' bytes at a time.  Return 0 on success, and a non-zero
+    // value otherwise.
+{
+    BSLS_ASSERT(streamBuf);
+    BSLS_ASSERT(filename);
+
+    typedef bdls::FilesystemUtil FileUtil;
+
+    FileUtil::FileDescriptor fd = FileUtil::open(filename,
+                                                 FileUtil::e_OPEN_OR_CREATE,
+                                                 FileUtil::e_READ_WRITE,
+                                                 FileUtil::e_KEEP);
+
+    if (fd == FileUtil::k_INVALID_FD) {
+        char errorBuffer[k_ERROR_BUFFER_SIZE];
+
+        snprintf(errorBuffer,
+                 sizeof errorBuffer,
+                 "Cannot open log file %s: %s. "
+                 "File logging will be disabled!",
+                 filename,
+                 bsl::strerror(getErrorCode()));
+        bsls::Log::platformDefaultMessageHandler(bsls::LogSeverity::e_ERROR,
+                                                 __FILE__,
+                                                 __LINE__,
+                                                 errorBuffer);
+        return -1;                                                    // RETURN
+    }
+
+    const FileUtil::Offset fileSize = FileUtil::seek(
+                                                  fd,
+                                                  0,
+                                                  FileUtil::e_SEEK_FROM_END);
+
+    if (0 > fileSize) {
+        FileUtil::close(fd);
+    }
+
+    if (0 > fileSize
+     || 0 != streamBuf->reset(fd, fileSize, true, growthIncrement)) {
+        char errorBuffer[k_ERROR_BUFFER_SIZE];
+
+        snprintf(errorBuffer,
+                 sizeof errorBuffer,
+                 "Cannot map log file %s: %s. "
+                 "File logging will be disabled!",
+                 filename,
+                 bsl::strerror(getErrorCode()));
+        bsls::Log::platformDefaultMessageHandler(bsls::LogSeverity::e_ERROR,
+                                                 __FILE__,
+                                                 __LINE__,
+                                                 errorBuffer);
+        return -1;                                                    // RETURN
+    }
+
+    return 0;
+}
+
+static int openCompressedLogFile(CompressedFileStreamBuf *streamBuf,
+                                 const char              *filename,
+                                 int                      frameSize,
+                                 int                      compressionLevel)
+    // Open the file with the specified 'filename' for appending frames of the
+    // specified 'frameSize' kilobytes, compressed at the specified
+    // 'compressionLevel', through the specified 'streamBuf'.  Return 0 on
+    // success, and a non-zero value otherwise.
+{
+    BSLS_ASSERT(streamBuf);
+    BSLS_ASSERT(filename);
+
+    typedef bdls::FilesystemUtil FileUtil;
+
+    FileUtil::FileDescriptor fd = FileUtil::open(filename,
+                                                 FileUtil::e_OPEN_OR_CREATE,
+                                                 FileUtil::e_READ_APPEND,
+                                                 FileUtil::e_KEEP);
+
+    if (fd == FileUtil::k_INVALID_FD) {
+        char errorBuffer[k_ERROR_BUFFER_SIZE];
+
+        snprintf(errorBuffer,
+                 sizeof errorBuffer,
+                 "Cannot open log file %s: %s. "
+                 "File logging will be disabled!",
+                 filename,
+                 bsl::strerror(getErrorCode()));
+        bsls::Log::platformDefaultMessageHandler(bsls::LogSeverity::e_ERROR,
+                                                 __FILE__,
+                                                 __LINE__,
+                                                 errorBuffer);
+        return -1;                                                    // RETURN
+    }
+
+    if (0 != streamBuf->reset(fd,
+                              true,
+                              static_cast<bsl::size_t>(frameSize) * 1024,
+                              compressionLevel)) {
+        char errorBuffer[k_ERROR_BUFFER_SIZE];
+
+        snprintf(errorBuffer,
+                 sizeof errorBuffer,
+                 "Cannot start compression of log file %s. "
+                 "File logging will be disabled!",
+                 filename);
+        bsls::Log::platformDefaultMessageHandler(bsls::LogSeverity::e_ERROR,
+                                                 __FILE__,
+                                                 __LINE__,
+                                                 errorBuffer);
+        return -1;                                                    // RETURN
+    }
+
+    return 0;
+}
+
+static bsl::string preallocatedFileName(const bsl::string& logFileName,
+                                        const bsl::string& logFilePattern)
+    // Return the name of the file preallocated, in mapped output mode, for
+    // the log file following the one having the specified 'logFileName',
+    // whose name is derived from the specified 'logFilePattern': a hidden
+    // file in the directory of 'logFileName', named after the leaf of
+    // 'logFilePattern'.
+{
+    bsl::string logFileLeaf;
+    bsl::string patternLeaf;
+
+    if (0 != bdls::PathUtil::getLeaf(&logFileLeaf, logFileName)) {
+        logFileLeaf.clear();
+    }
+    if (0 != bdls::PathUtil::getLeaf(&patternLeaf, logFilePattern)) {
+        patternLeaf = logFilePattern;
+    }
+
+    bsl::string result(logFileName,
+                       0,
+                       logFileName.size() - logFileLeaf.size());
+    result += '.';
+    result += patternLeaf;
+    result += ".preallocated";
+    return result;
+}
+
 bool fuzzyEqual(const bdlt::Datetime&         a,
                 const bdlt::Datetime&         b,
                 const bdlt::DatetimeInterval& interval)
@@ -394,11 +560,260 @@ static bdlt::Datetime computeNextRotationTime(
 
 }  // close unnamed namespace
 
+                   // ====================================
+                   // class FileObserver2_FilePreallocator
+                   // ====================================
+
+class FileObserver2_FilePreallocator {
+    // This class implements a mechanism that creates, in a thread of its own,
+    // a file of a requested name and size, with its space reserved on disk,
+    // and hands it over, open, to a client that asks for it by name.  At most
+    // one such file is requested, or ready, at a time.
+
+    // PRIVATE TYPES
+    typedef bdls::FilesystemUtil FileUtil;
+
+    // DATA
+    bslmt::Mutex              d_mutex;            // protects the following
+
+    bslmt::Condition          d_condition;        // signaled on a request
+
+    bsl::string               d_requestedPath;    // file to create, or empty
+
+    bsls::Types::Int64        d_requestedSize;    // size of the file to create
+
+    bsl::string               d_readyPath;        // created file, or empty
+
+    FileUtil::FileDescriptor  d_readyDescriptor;  // descriptor of the created
+                                                  // file
+
+    bool                      d_stopFlag;         // 'true' once 'stop' called
+
+    bslmt::ThreadUtil::Handle d_thread;           // preallocating thread
+
+  private:
+    // NOT IMPLEMENTED
+    FileObserver2_FilePreallocator(const FileObserver2_FilePreallocator&);
+    FileObserver2_FilePreallocator& operator=(
+                                        const FileObserver2_FilePreallocator&);
+
+    // PRIVATE MANIPULATORS
+    void discardReadyFile();
+        // Close and remove the created file, if any.  The behavior is
+        // undefined unless the caller locked 'd_mutex'.
+
+    void run();
+        // Create the requested files until 'stop' is called.
+
+  public:
+    // CREATORS
+    explicit FileObserver2_FilePreallocator(bslma::Allocator *basicAllocator);
+        // Create a preallocator whose thread is not started, using the
+        // specified 'basicAllocator' to supply memory.
+
+    ~FileObserver2_FilePreallocator();
+        // Stop this object (see 'stop') and destroy it.
+
+    // MANIPULATORS
+    void cancel();
+        // Withdraw the pending request, if any, and close and remove the
+        // created file, if any.
+
+    void request(const bsl::string& path, bsls::Types::Int64 size);
+        // Request that a file at the specified 'path' be created, with the
+        // specified 'size' reserved on disk, replacing any pending request,
+        // and discarding any created file having another path.  This method
+        // has no effect if a file at 'path' has already been created.
+
+    int start();
+        // Start the thread of this object.  Return 0 on success, and a
+        // non-zero value otherwise.
+
+    void stop();
+        // Stop and join the thread of this object, if started, and close and
+        // remove the created file, if any.
+
+    bool take(FileUtil::FileDescriptor *descriptor, const bsl::string& path);
+        // If a file at the specified 'path' has been created, load its
+        // descriptor, open for reading and writing, into the specified
+        // 'descriptor', relinquish the file to the caller, and return 'true';
+        // otherwise, return 'false' without waiting.
+};
+
+                   // ------------------------------------
+                   // class FileObserver2_FilePreallocator
+                   // ------------------------------------
+
+// PRIVATE MANIPULATORS
+void FileObserver2_FilePreallocator::discardReadyFile()
+{
+    if (!d_readyPath.empty()) {
+        FileUtil::close(d_readyDescriptor);
+        FileUtil::remove(d_readyPath);
+
+        d_readyPath.clear();
+        d_readyDescriptor = FileUtil::k_INVALID_FD;
+    }
+}
+
+void FileObserver2_FilePreallocator::run()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    while (true) {
+        while (!d_stopFlag && d_requestedPath.empty()) {
+            d_condition.wait(&d_mutex);
+        }
+        if (d_stopFlag) {
+            break;
+        }
+
+        const bsl::string        path(d_requestedPath);
+        const bsls::Types::Int64 size = d_requestedSize;
+
+        FileUtil::FileDescriptor fd;
+        bool                     success;
+        {
+            bslmt::LockGuardUnlock<bslmt::Mutex> unlockGuard(&d_mutex);
+
+            fd = FileUtil::open(path,
+                                FileUtil::e_OPEN_OR_CREATE,
+                                FileUtil::e_READ_WRITE,
+                                FileUtil::e_TRUNCATE);
+
+            success = FileUtil::k_INVALID_FD != fd
+                   && 0 == FileUtil::growFile(fd, size, true);
+        }
+
+        if (success && !d_stopFlag && path == d_requestedPath) {
+            d_requestedPath.clear();
+            d_readyPath       = path;
+            d_readyDescriptor = fd;
+        }
+        else {
+            // The file could not be created, or is no longer wanted.  A
+            // failed request is not retried.
+
+            if (FileUtil::k_INVALID_FD != fd) {
+                FileUtil::close(fd);
+                FileUtil::remove(path);
+            }
+            if (path == d_requestedPath) {
+                d_requestedPath.clear();
+            }
+        }
+    }
+
+    discardReadyFile();
+}
+
+// CREATORS
+FileObserver2_FilePreallocator::FileObserver2_FilePreallocator(
+                                              bslma::Allocator *basicAllocator)
+: d_mutex()
+, d_condition()
+, d_requestedPath(basicAllocator)
+, d_requestedSize(0)
+, d_readyPath(basicAllocator)
+, d_readyDescriptor(FileUtil::k_INVALID_FD)
+, d_stopFlag(false)
+, d_thread(bslmt::ThreadUtil::invalidHandle())
+{
+}
+
+FileObserver2_FilePreallocator::~FileObserver2_FilePreallocator()
+{
+    stop();
+}
+
+// MANIPULATORS
+void FileObserver2_FilePreallocator::cancel()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    d_requestedPath.clear();
+    discardReadyFile();
+}
+
+void FileObserver2_FilePreallocator::request(const bsl::string&  path,
+                                             bsls::Types::Int64  size)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    if (path == d_readyPath) {
+        return;                                                       // RETURN
+    }
+
+    discardReadyFile();
+
+    d_requestedPath = path;
+    d_requestedSize = size;
+    d_condition.signal();
+}
+
+int FileObserver2_FilePreallocator::start()
+{
+    BSLS_ASSERT(bslmt::ThreadUtil::invalidHandle() == d_thread);
+
+    typedef FileObserver2_FilePreallocator Self;
+
+    return bslmt::ThreadUtil::create(&d_thread,
+                                     bdlf::MemFnUtil::memFn(&Self::run, this));
+}
+
+void FileObserver2_FilePreallocator::stop()
+{
+    if (bslmt::ThreadUtil::invalidHandle() == d_thread) {
+        return;                                                       // RETURN
+    }
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        d_stopFlag = true;
+        d_condition.signal();
+    }
+
+    bslmt::ThreadUtil::join(d_thread);
+    d_thread = bslmt::ThreadUtil::invalidHandle();
+}
+
+bool FileObserver2_FilePreallocator::take(
+                                     FileUtil::FileDescriptor *descriptor,
+                                     const bsl::string&        path)
+{
+    BSLS_ASSERT(descriptor);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    if (d_readyPath.empty() || path != d_readyPath) {
+        return false;                                                 // RETURN
+    }
+
+    *descriptor = d_readyDescriptor;
+
+    d_readyPath.clear();
+    d_readyDescriptor = FileUtil::k_INVALID_FD;
+
+    return true;
+}
+
                           // -------------------
                           // class FileObserver2
                           // -------------------
 
 // PRIVATE MANIPULATORS
+int FileObserver2::closeLogFile()
+{
+    if (d_compressedStreamBuf.isOpened()) {
+        return d_compressedStreamBuf.clear();                         // RETURN
+    }
+    if (d_mappedStreamBuf.isOpened()) {
+        return d_mappedStreamBuf.clear();                             // RETURN
+    }
+    return d_logStreamBuf.clear();
+}
+
 void FileObserver2::logRecordDefault(bsl::ostream& stream,
                                      const Record& record)
 
@@ -454,11 +869,77 @@ void FileObserver2::logRecordDefault(bsl::ostream& stream,
     stream.flush();
 }
 
+int FileObserver2::openCurrentLogFile()
+{
+    BSLS_ASSERT(!isLogFileOpened());
+
+    if (d_compressionFrameSize) {
+        d_logOutStream.rdbuf(&d_compressedStreamBuf);
+
+        const int rc = openCompressedLogFile(&d_compressedStreamBuf,
+                                             d_logFileName.c_str(),
+                                             d_compressionFrameSize,
+                                             d_compressionLevel);
+        if (0 == rc) {
+            d_logOutStream.clear();
+        }
+        return rc;                                                    // RETURN
+    }
+
+    if (!d_preallocator_p) {
+        d_logOutStream.rdbuf(&d_logStreamBuf);
+        return openLogFile(&d_logOutStream, d_logFileName.c_str());  // RETURN
+    }
+
+    typedef bdls::FilesystemUtil FileUtil;
+
+    d_logOutStream.rdbuf(&d_mappedStreamBuf);
+
+    const bsls::Types::Int64 size             = preallocationBytes();
+    const bsl::string        preallocatedName = preallocatedFileName(
+                                                            d_logFileName,
+                                                            d_logFilePattern);
+
+    // Use the preallocated file, if it is ready, unless the log file already
+    // exists (e.g., because it could not be renamed on rotation), in which
+    // case it is appended to.
+
+    int                      rc = -1;
+    FileUtil::FileDescriptor fd;
+
+    if (d_preallocator_p->take(&fd, preallocatedName)) {
+        if (!FileUtil::exists(d_logFileName)
+         && 0 == FileUtil::move(preallocatedName, d_logFileName)) {
+            rc = d_mappedStreamBuf.reset(fd, 0, true, size);
+            if (0 != rc) {
+                FileUtil::remove(d_logFileName);
+            }
+        }
+        else {
+            FileUtil::close(fd);
+            FileUtil::remove(preallocatedName);
+        }
+    }
+
+    if (0 != rc) {
+        rc = openMappedLogFile(&d_mappedStreamBuf,
+                               d_logFileName.c_str(),
+                               size);
+    }
+
+    if (0 == rc) {
+        d_logOutStream.clear();
+        d_preallocator_p->request(preallocatedName, size);
+    }
+
+    return rc;
+}
+
 int FileObserver2::rotateFile(bsl::string *rotatedLogFileName)
 {
     BSLS_ASSERT(rotatedLogFileName);
 
-    if (!d_logStreamBuf.isOpened()) {
+    if (!isLogFileOpened()) {
         return 1;                                                     // RETURN
     }
 
@@ -466,7 +947,7 @@ int FileObserver2::rotateFile(bsl::string *rotatedLogFileName)
 
     int returnStatus = k_ROTATE_SUCCESS;
 
-    if (0 != d_logStreamBuf.clear()) {
+    if (0 != closeLogFile()) {
         char errorBuffer[k_ERROR_BUFFER_SIZE];
 
         snprintf(errorBuffer,
@@ -527,7 +1008,7 @@ int FileObserver2::rotateFile(bsl::string *rotatedLogFileName)
                                                   d_logFileTimestampUtc);
     }
 
-    if (0 != openLogFile(&d_logOutStream, d_logFileName.c_str())) {
+    if (0 != openCurrentLogFile()) {
         char errorBuffer[k_ERROR_BUFFER_SIZE];
 
         snprintf(errorBuffer,
@@ -554,7 +1035,7 @@ int FileObserver2::rotateIfNecessary(bsl::string           *rotatedLogFileName,
     BSLS_ASSERT(d_rotationInterval.totalSeconds() >= 0);
     BSLS_ASSERT(rotatedLogFileName);
 
-    if (!d_logStreamBuf.isOpened()) {
+    if (!isLogFileOpened()) {
         return 1;                                                     // RETURN
     }
 
@@ -577,6 +1058,23 @@ int FileObserver2::rotateIfNecessary(bsl::string           *rotatedLogFileName,
     return 1;
 }
 
+// PRIVATE ACCESSORS
+bool FileObserver2::isLogFileOpened() const
+{
+    return d_logStreamBuf.isOpened()
+        || d_mappedStreamBuf.isOpened()
+        || d_compressedStreamBuf.isOpened();
+}
+
+bsls::Types::Int64 FileObserver2::preallocationBytes() const
+{
+    const int size = d_preallocationSize ? d_preallocationSize
+                   : d_rotationSize      ? d_rotationSize
+                   : k_DEFAULT_PREALLOCATION_SIZE;
+
+    return static_cast<bsls::Types::Int64>(size) * 1024;
+}
+
 // CREATORS
 FileObserver2::FileObserver2(bslma::Allocator *basicAllocator)
 : d_logStreamBuf(bdls::FilesystemUtil::k_INVALID_FD,
@@ -584,6 +1082,8 @@ FileObserver2::FileObserver2(bslma::Allocator *basicAllocator)
                  true,
                  false,
                  basicAllocator)
+, d_mappedStreamBuf()
+, d_compressedStreamBuf(basicAllocator)
 , d_logOutStream(&d_logStreamBuf)
 , d_logFilePattern(basicAllocator)
 , d_logFileName(basicAllocator)
@@ -598,23 +1098,41 @@ FileObserver2::FileObserver2(bslma::Allocator *basicAllocator)
                  bsl::allocator<FileObserver2::OnFileRotationCallback>(
                                                                basicAllocator))
 , d_rotationCbMutex()
+, d_preallocator_p(0)
+, d_preallocationSize(0)
+, d_compressionFrameSize(0)
+, d_compressionLevel(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
 }
 
 FileObserver2::~FileObserver2()
 {
-    if (d_logStreamBuf.isOpened()) {
-        d_logStreamBuf.clear();
+    if (isLogFileOpened()) {
+        closeLogFile();
+    }
+    if (d_preallocator_p) {
+        d_allocator_p->deleteObject(d_preallocator_p);
     }
 }
 
 // MANIPULATORS
+void FileObserver2::disableCompression()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    d_compressionFrameSize = 0;
+}
+
 void FileObserver2::disableFileLogging()
 {
     bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
 
-    if (d_logStreamBuf.isOpened()) {
-        d_logStreamBuf.clear();
+    if (isLogFileOpened()) {
+        closeLogFile();
+    }
+    if (d_preallocator_p) {
+        d_preallocator_p->cancel();
     }
 }
 
@@ -623,6 +1141,26 @@ void FileObserver2::disableLifetimeRotation()
     disableTimeIntervalRotation();
 }
 
+void FileObserver2::disableMappedOutput()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    if (!d_preallocator_p) {
+        return;                                                       // RETURN
+    }
+
+    d_allocator_p->deleteObject(d_preallocator_p);
+    d_preallocator_p = 0;
+
+    // A mapped log file is not reopened if compression is enabled, since
+    // compression only applies to the log files opened subsequently.
+
+    if (d_mappedStreamBuf.isOpened() && !d_compressionFrameSize) {
+        d_mappedStreamBuf.clear();
+        openCurrentLogFile();
+    }
+}
+
 void FileObserver2::disablePublishInLocalTime()
 {
     bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
@@ -644,13 +1182,30 @@ void FileObserver2::disableTimeIntervalRotation()
     d_rotationInterval.setTotalSeconds(0);
 }
 
+int FileObserver2::enableCompression(int frameSize, int compressionLevel)
+{
+    BSLS_ASSERT(0 <= frameSize);
+
+    if (!CompressedFileStreamBuf::isValidCompressionLevel(compressionLevel)) {
+        return -1;                                                    // RETURN
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    d_compressionFrameSize = frameSize ? frameSize
+                                       : k_DEFAULT_COMPRESSION_FRAME_SIZE;
+    d_compressionLevel     = compressionLevel;
+
+    return 0;
+}
+
 int FileObserver2::enableFileLogging(const char *logFilenamePattern)
 {
     BSLS_ASSERT(logFilenamePattern);
 
     bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
 
-    if (d_logStreamBuf.isOpened()) {
+    if (isLogFileOpened()) {
         return 1;                                                     // RETURN
     }
 
@@ -676,7 +1231,7 @@ int FileObserver2::enableFileLogging(const char *logFilenamePattern)
                                                   d_logFileTimestampUtc);
     }
 
-    return openLogFile(&d_logOutStream, d_logFileName.c_str());
+    return openCurrentLogFile();
 }
 
 int FileObserver2::enableFileLogging(const char *logFilenamePattern,
@@ -713,6 +1268,35 @@ void FileObserver2::forceRotation()
     }
 }
 
+int FileObserver2::enableMappedOutput(int preallocationSize)
+{
+    BSLS_ASSERT(0 <= preallocationSize);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    d_preallocationSize = preallocationSize;
+
+    if (d_preallocator_p) {
+        return 0;                                                     // RETURN
+    }
+
+    d_preallocator_p = new (*d_allocator_p) FileObserver2_FilePreallocator(
+                                                                d_allocator_p);
+
+    if (0 != d_preallocator_p->start()) {
+        d_allocator_p->deleteObject(d_preallocator_p);
+        d_preallocator_p = 0;
+        return -1;                                                    // RETURN
+    }
+
+    if (d_logStreamBuf.isOpened() && !d_compressionFrameSize) {
+        d_logStreamBuf.clear();
+        return openCurrentLogFile();                                  // RETURN
+    }
+
+    return 0;
+}
+
 void FileObserver2::enablePublishInLocalTime()
 {
     bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
@@ -729,7 +1313,7 @@ void FileObserver2::publish(const Record& record, const Context&)
         rotationStatus = rotateIfNecessary(&rotatedFileName,
                                            record.fixedFields().timestamp());
 
-        if (d_logStreamBuf.isOpened()) {
+        if (isLogFileOpened()) {
             d_logFileFunctor(d_logOutStream, record);
 
             if (!d_logOutStream) {
@@ -746,7 +1330,7 @@ void FileObserver2::publish(const Record& record, const Context&)
                                                     __LINE__,
                                                     errorBuffer);
 
-                d_logStreamBuf.clear();
+                closeLogFile();
             }
         }
     }
@@ -789,7 +1373,7 @@ void FileObserver2::rotateOnTimeInterval(
 
     // Need to determine the next rotation time if the file is already opened.
 
-    if (d_logStreamBuf.isOpened()) {
+    if (isLogFileOpened()) {
         d_nextRotationTimeUtc = computeNextRotationTime(
                                                   d_rotationReferenceLocalTime,
                                                   d_rotationInterval,
@@ -811,6 +1395,14 @@ void FileObserver2::setLogFileFunctor(const LogRecordFunctor& logFileFunctor)
     d_logFileFunctor = logFileFunctor;
 }
 
+void FileObserver2::setAsyncFileIo(bdls::AsyncFileIo *asyncFileIo,
+                                   bool               syncFlag)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    d_logStreamBuf.setAsyncFileIo(asyncFileIo, syncFlag);
+}
+
 void FileObserver2::setOnFileRotationCallback(
                               const OnFileRotationCallback& onRotationCallback)
 {
@@ -819,11 +1411,18 @@ void FileObserver2::setOnFileRotationCallback(
 }
 
 // ACCESSORS
+bool FileObserver2::isCompressionEnabled() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return 0 != d_compressionFrameSize;
+}
+
 bool FileObserver2::isFileLoggingEnabled() const
 {
     bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
 
-    return d_logStreamBuf.isOpened();
+    return isLogFileOpened();
 }
 
 bool FileObserver2::isFileLoggingEnabled(bsl::string *result) const
@@ -832,7 +1431,7 @@ bool FileObserver2::isFileLoggingEnabled(bsl::string *result) const
 
     bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
 
-    bool rc = d_logStreamBuf.isOpened();
+    bool rc = isLogFileOpened();
     if (rc) {
         result->assign(d_logFileName);
     }
@@ -840,6 +1439,13 @@ bool FileObserver2::isFileLoggingEnabled(bsl::string *result) const
     return rc;
 }
 
+bool FileObserver2::isMappedOutputEnabled() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return 0 != d_preallocator_p;
+}
+
 bool FileObserver2::isPublishInLocalTimeEnabled() const
 {
     bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
@@ -851,7 +1457,7 @@ bdlt::DatetimeInterval FileObserver2::localTimeOffset() const
 {
     bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
 
-    bdlt::Datetime timestamp = d_logStreamBuf.isOpened()
+    bdlt::Datetime timestamp = isLogFileOpened()
                                ? d_logFileTimestampUtc
                                : bdlt::CurrentTime::utc();
 
@@ -12,7 +12,9 @@ BSLS_IDENT("$Id: $")
 //  ball::FileObserver2: observer that outputs log records to a file
 //
 //@SEE_ALSO: ball_record, ball_context, ball_observer,
-//           ball_recordstringformatter
+//           ball_recordstringformatter, ball_compressedfilestreambuf,
+//           ball_compressedfileutil, bdls_asyncfileio,
+//           bdls_mappedoutputstreambuf
 //
 //@DESCRIPTION: This component provides a concrete implementation of the
 // 'ball::Observer' protocol, 'ball::FileObserver2', for publishing log records
@@ -23,18 +25,25 @@ BSLS_IDENT("$Id: $")
 //               ( ball::FileObserver2 )
 //                `-------------------'
 //                         |              ctor
+//                         |              disableCompression
 //                         |              disableFileLogging
+//                         |              disableMappedOutput
 //                         |              disableTimeIntervalRotation
 //                         |              disableSizeRotation
 //                         |              disablePublishInLocalTime
+//                         |              enableCompression
 //                         |              enableFileLogging
+//                         |              enableMappedOutput
 //                         |              enablePublishInLocalTime
 //                         |              forceRotation
 //                         |              rotateOnSize
 //                         |              rotateOnTimeInterval
+//                         |              setAsyncFileIo
 //                         |              setLogFileFunctor
 //                         |              setOnFileRotationCallback
+//                         |              isCompressionEnabled
 //                         |              isFileLoggingEnabled
+//                         |              isMappedOutputEnabled
 //                         |              isPublishInLocalTimeEnabled
 //                         |              rotationLifetime
 //                         |              rotationSize
@@ -80,6 +89,12 @@ BSLS_IDENT("$Id: $")
 // |             | disableTimeIntervalRotation |                              |
 // |             | setOnFileRotationCallback   |                              |
 // +-------------+-----------------------------+------------------------------+
+// | File Output | setAsyncFileIo              | isMappedOutputEnabled        |
+// |             | enableMappedOutput          | isCompressionEnabled         |
+// |             | disableMappedOutput         |                              |
+// |             | enableCompression           |                              |
+// |             | disableCompression          |                              |
+// +-------------+-----------------------------+------------------------------+
 //..
 // In general, a 'ball::FileObserver2' object can be dynamically configured
 // throughout its lifetime (in particular, before or after being registered
@@ -238,6 +253,81 @@ BSLS_IDENT("$Id: $")
 // in the filename.  In any case, logging resumes to a new, initially empty,
 // file.
 //
+///Asynchronous File Output
+///-------------------------
+// By default, each published record is written to the log file by a blocking
+// system call on the publishing thread.  If a started 'bdls::AsyncFileIo'
+// object is supplied to 'setAsyncFileIo', publishing a record instead copies
+// it to a buffer, and the 'AsyncFileIo' object writes it to the log file;
+// records published while a write is in progress are written together once
+// it completes (see {'bdls_fdstreambuf'|Asynchronous Output}).  Optionally,
+// each such write is followed by a data sync, so that records become durable
+// in groups ("group commit") without a publishing thread waiting for the
+// storage device.  Closing the log file (e.g., on rotation) waits for the
+// writes in progress to complete.
+//
+///Mapped File Output
+///------------------
+// For high volumes of records, a file observer can instead write its log
+// files through a memory mapping, by calling 'enableMappedOutput'.  In this
+// mode:
+//
+//: o Each log file is grown, with its space reserved on disk (e.g., by
+//:   'posix_fallocate'), in large increments -- by default, of the rotation
+//:   size, if rotation on size is in effect -- rather than by each write.
+//:
+//: o Records are copied into a window of the log file mapped in memory (see
+//:   'bdls_mappedoutputstreambuf'), so that publishing a record makes no
+//:   system call, except when the window is moved.  Writeback of each window
+//:   to disk is initiated as the window is moved.
+//:
+//: o The next log file is created and preallocated in advance, by a thread
+//:   owned by the file observer, as a hidden file in the directory of the
+//:   current log file; a rotation then renames it, rather than creating a
+//:   file on the publishing thread.  (If the next log file is to be in another
+//:   directory, or the preallocated file is not ready, the new log file is
+//:   created on the publishing thread, as in the default mode.)
+//
+// A log file is truncated to the size of the records written to it when it is
+// closed (e.g., on rotation).  Note that, until then, its size on disk is that
+// of the preallocated space, and that a log file left by a process that
+// terminated abnormally ends with unspecified (typically zero) bytes.  Records
+// are visible to readers of the log file as soon as they are published, but
+// (as in the default mode) are not synchronized to disk.  Also note that the
+// 'bdls::AsyncFileIo' object (if any) supplied to 'setAsyncFileIo' is not
+// used in this mode.
+//
+///Compressed File Output
+///----------------------
+// A file observer can compress its log files, by calling 'enableCompression',
+// so that (for typical log records) a fraction of the bytes published is
+// written to disk.  In this mode, records are written to the log file through
+// a 'ball::CompressedFileStreamBuf', which collects them into frames of a
+// size specified to 'enableCompression' (by default, 64 kilobytes); each full
+// frame is compressed with the Zstandard algorithm, and written to the log
+// file, by a thread owned by the stream buffer, so that publishing a record
+// only copies it (see 'ball_compressedfilestreambuf').  Each frame is
+// independently decodable, and a log file is a sequence of frames in the
+// standard Zstandard format, which can be read by 'ball::CompressedFileUtil',
+// the 'm_balllogcat' application built on it, or the 'zstd' command-line
+// tool.
+//
+// Note that records are not written to the log file until their frame is
+// full, or the log file is closed (e.g., on rotation), so that they are not
+// visible to readers of the log file until then, and the records of an
+// incomplete frame are lost if the process terminates abnormally.  Also note
+// that rotation on size (see 'rotateOnSize') applies to the compressed size of
+// the log file, which grows as frames are written.
+//
+// Compression takes effect for the log files opened after 'enableCompression'
+// (or 'disableCompression') is called -- i.e., on the next rotation, or when
+// file logging is next enabled -- so that the records of a log file are
+// either all compressed or all uncompressed; a log file that already exists
+// is appended to in its format only if that is the format in effect when it is
+// opened.  Neither the 'bdls::AsyncFileIo' object (if any) supplied to
+// 'setAsyncFileIo' nor mapped output (see {Mapped File Output}) is used for
+// compressed log files.
+//
 ///Thread Safety
 ///-------------
 // All methods of 'ball::FileObserver2' are thread-safe, and can be called
@@ -302,10 +392,12 @@ BSLS_IDENT("$Id: $")
 
 #include <balscm_version.h>
 
+#include <ball_compressedfilestreambuf.h>
 #include <ball_observer.h>
 #include <ball_severity.h>
 
 #include <bdls_fdstreambuf.h>
+#include <bdls_mappedoutputstreambuf.h>
 
 #include <bdlt_datetime.h>
 #include <bdlt_datetimeinterval.h>
@@ -317,6 +409,8 @@ BSLS_IDENT("$Id: $")
 
 #include <bslmt_mutex.h>
 
+#include <bsls_types.h>
+
 #include <bsl_fstream.h>
 #include <bsl_functional.h>
 #include <bsl_iosfwd.h>
@@ -324,9 +418,17 @@ BSLS_IDENT("$Id: $")
 #include <bsl_string.h>
 
 namespace BloombergLP {
+
+namespace bdls {
+
+class AsyncFileIo;
+
+}  // close package namespace
+
 namespace ball {
 
 class Context;
+class FileObserver2_FilePreallocator;
 class Record;
 
                           // ===================
@@ -365,9 +467,19 @@ class FileObserver2 : public Observer {
     bdls::FdStreamBuf      d_logStreamBuf;             // stream buffer for
                                                        // file logging
 
+    bdls::MappedOutputStreamBuf
+                           d_mappedStreamBuf;          // stream buffer for
+                                                       // mapped file logging
+
+    CompressedFileStreamBuf
+                           d_compressedStreamBuf;      // stream buffer for
+                                                       // compressed file
+                                                       // logging
+
     bsl::ostream           d_logOutStream;             // output stream for
                                                        // file logging (refers
-                                                       // to 'd_logStreamBuf')
+                                                       // to one of the stream
+                                                       // buffers above)
 
     bsl::string            d_logFilePattern;           // log filename pattern
 
@@ -419,6 +531,33 @@ class FileObserver2 : public Observer {
                                                        // called with 'd_mutex'
                                                        // unlocked
 
+    FileObserver2_FilePreallocator
+                          *d_preallocator_p;           // creator of
+                                                       // preallocated log
+                                                       // files if mapped
+                                                       // output is enabled,
+                                                       // and 0 otherwise
+                                                       // (owned)
+
+    int                    d_preallocationSize;        // size by which log
+                                                       // files are grown in
+                                                       // mapped output mode
+                                                       // (in kilobytes), or 0
+                                                       // for the default
+
+    int                    d_compressionFrameSize;     // size of the frames
+                                                       // of compressed log
+                                                       // files (in kilobytes),
+                                                       // or 0 if compression
+                                                       // is disabled
+
+    int                    d_compressionLevel;         // Zstandard compression
+                                                       // level of compressed
+                                                       // log files
+
+    bslma::Allocator      *d_allocator_p;              // memory allocator
+                                                       // (held, not owned)
+
   private:
     // NOT IMPLEMENTED
     FileObserver2(const FileObserver2&);
@@ -426,10 +565,26 @@ class FileObserver2 : public Observer {
 
   private:
     // PRIVATE MANIPULATORS
+    int closeLogFile();
+        // Close the log file of this file observer.  Return 0 on success, and
+        // a non-zero value otherwise.  The behavior is undefined unless the
+        // caller acquired the lock for this object.
+
     void logRecordDefault(bsl::ostream& stream, const Record& record);
         // Write the specified log 'record' to the specified output 'stream'
         // using the default record format of this file observer.
 
+    int openCurrentLogFile();
+        // Open, for appending, the log file named by 'd_logFileName', through
+        // 'd_compressedStreamBuf' if compression is enabled, through a memory
+        // mapping if mapped output is enabled, and through 'd_logStreamBuf'
+        // otherwise.  Return 0 on success, and a non-zero value otherwise.
+        // If (only) mapped output is enabled, use the preallocated
+        // file if one is ready for the directory of the log file (and the log
+        // file does not exist), and request the preallocation of the next log
+        // file.  The behavior is undefined unless the caller acquired the lock
+        // for this object, and no log file is open.
+
     int rotateFile(bsl::string *rotatedLogFileName);
         // Perform a log file rotation by closing the current log file of this
         // file observer, renaming the closed log file if necessary, and
@@ -453,6 +608,17 @@ class FileObserver2 : public Observer {
         // and the 'rotateOnSize' methods, respectively.  The behavior is
         // undefined unless the caller acquired the lock for this object.
 
+    // PRIVATE ACCESSORS
+    bool isLogFileOpened() const;
+        // Return 'true' if a log file of this file observer is open, and
+        // 'false' otherwise.  The behavior is undefined unless the caller
+        // acquired the lock for this object.
+
+    bsls::Types::Int64 preallocationBytes() const;
+        // Return the number of bytes by which log files are grown in mapped
+        // output mode.  The behavior is undefined unless the caller acquired
+        // the lock for this object.
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(FileObserver2, bslma::UsesBslmaAllocator);
@@ -473,6 +639,11 @@ class FileObserver2 : public Observer {
         // and destroy this file observer.
 
     // MANIPULATORS
+    void disableCompression();
+        // Disable compression for this file observer (see {Compressed File
+        // Output}), starting with the next log file opened.  This method has
+        // no effect if compression is not enabled.
+
     void disableFileLogging();
         // Disable file logging for this file observer.  This method has no
         // effect if file logging is not enabled.  Note that records
@@ -486,6 +657,14 @@ class FileObserver2 : public Observer {
         //
         // !DEPRECATED!: Use 'disableTimeIntervalRotation' instead.
 
+    void disableMappedOutput();
+        // Disable mapped output for this file observer (see {Mapped File
+        // Output}), stopping its preallocating thread and removing any
+        // preallocated file not yet used.  If file logging is enabled, the
+        // current log file is closed and reopened for (blocking, or
+        // asynchronous) appending.  This method has no effect if mapped output
+        // is not enabled.
+
     void disableTimeIntervalRotation();
         // Disable log file rotation based on a periodic time interval for this
         // file observer.  This method has no effect if
@@ -503,6 +682,22 @@ class FileObserver2 : public Observer {
         // enabled.  Note that this method also affects log filenames (see {Log
         // Filename Patterns}).
 
+    int enableCompression(int frameSize = 0, int compressionLevel = 0);
+        // Enable compression for this file observer (see {Compressed File
+        // Output}), starting with the next log file opened.  Optionally
+        // specify a 'frameSize', the number of kilobytes of records
+        // compressed into each independently decodable frame; if 'frameSize'
+        // is 0, 64 kilobytes are used.  Optionally specify a
+        // 'compressionLevel' of the Zstandard algorithm, where higher levels
+        // trade speed for compression ratio, and negative levels the reverse;
+        // if 'compressionLevel' is 0, the default level of the Zstandard
+        // library (3) is used.  Return 0 on success, and a non-zero value if
+        // 'compressionLevel' is not supported (see
+        // 'CompressedFileStreamBuf::isValidCompressionLevel'), in which case
+        // this method has no effect.  If compression is already enabled, the
+        // specified values apply to the log files opened subsequently.  The
+        // behavior is undefined unless '0 <= frameSize'.
+
     int enableFileLogging(const char *logFilenamePattern);
         // Enable logging of all records published to this file observer to a
         // file whose name is derived from the specified 'logFilenamePattern'.
@@ -544,6 +739,21 @@ class FileObserver2 : public Observer {
         // (use the ".%T" pattern to replicate 'true == appendTimestampFlag'
         // behavior).
 
+    int enableMappedOutput(int preallocationSize = 0);
+        // Enable mapped output for this file observer (see {Mapped File
+        // Output}).  Optionally specify a 'preallocationSize' (in kilobytes)
+        // by which each log file is grown, with its space reserved on disk; if
+        // 'preallocationSize' is 0, the rotation size is used if rotation on
+        // size is in effect, and 64 megabytes otherwise.  If file logging is
+        // enabled, the current log file is closed and reopened for appending
+        // through a memory mapping.  Return 0 on success, and a non-zero value
+        // if the preallocating thread could not be created (in which case
+        // mapped output is not enabled) or the current log file could not be
+        // reopened (in which case file logging is disabled).  If mapped output
+        // is already enabled, only the preallocation size is updated, taking
+        // effect for the next log file.  The behavior is undefined unless
+        // '0 <= preallocationSize'.
+
     void enablePublishInLocalTime();
         // Enable publishing of the timestamp attribute of records in local
         // time by this file observer.  This method has no effect if publishing
@@ -606,6 +816,17 @@ class FileObserver2 : public Observer {
         // of 'bdlt::Datetime(1, 1, 1)' and an interval of 24 hours would
         // configure a periodic rotation at midnight each day.
 
+    void setAsyncFileIo(bdls::AsyncFileIo *asyncFileIo,
+                        bool               syncFlag = false);
+        // Write records to the log file of this file observer using the
+        // specified 'asyncFileIo', or, if 'asyncFileIo' is 0, using blocking
+        // system calls on the publishing thread (the default).  If the
+        // optionally specified 'syncFlag' is 'true', follow each asynchronous
+        // write with a data sync.  See {Asynchronous File Output}.  The
+        // behavior is undefined unless 'asyncFileIo' (if not 0) is started,
+        // and remains started until this method is called with 0 or this file
+        // observer is destroyed.
+
     void setLogFileFunctor(const LogRecordFunctor& logFileFunctor);
         // Set the formatting functor used when writing records to the log file
         // of this file observer to the specified 'logFileFunctor'.  Note that
@@ -627,6 +848,10 @@ class FileObserver2 : public Observer {
         // write to the 'ball' log).
 
     // ACCESSORS
+    bool isCompressionEnabled() const;
+        // Return 'true' if this file observer compresses the log files opened
+        // subsequently (see {Compressed File Output}), and 'false' otherwise.
+
     bool isFileLoggingEnabled() const;
     bool isFileLoggingEnabled(bsl::string *result) const;
         // Return 'true' if file logging is enabled for this file observer, and
@@ -636,6 +861,10 @@ class FileObserver2 : public Observer {
         // the 'publish' method of this file observer will be dropped when this
         // method returns 'false'.
 
+    bool isMappedOutputEnabled() const;
+        // Return 'true' if this file observer writes its log files through a
+        // memory mapping (see {Mapped File Output}), and 'false' otherwise.
+
     bool isPublishInLocalTimeEnabled() const;
         // Return 'true' if this file observer writes the timestamp attribute
         // of records that it publishes in local time, and 'false' otherwise
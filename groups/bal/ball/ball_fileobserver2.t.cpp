@@ -1,6 +1,7 @@
 // ball_fileobserver2.t.cpp                                           -*-C++-*-
 #include <ball_fileobserver2.h>
 
+#include <ball_compressedfileutil.h>
 #include <ball_context.h>
 #include <ball_log.h>
 #include <ball_loggermanager.h>
@@ -13,6 +14,7 @@
 
 #include <bdlb_tokenizer.h>
 
+#include <bdls_asyncfileio.h>
 #include <bdls_filesystemutil.h>
 #include <bdls_pathutil.h>
 #include <bdls_processutil.h>
@@ -43,6 +45,7 @@
 #include <bsls_timeinterval.h>
 #include <bsls_types.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_climits.h>
 #include <bsl_cstddef.h>
 #include <bsl_cstdlib.h>
@@ -52,6 +55,7 @@
 #include <bsl_iomanip.h>
 #include <bsl_iostream.h>
 #include <bsl_sstream.h>
+#include <bsl_vector.h>
 
 #ifdef BSLS_PLATFORM_OS_UNIX
 #include <glob.h>
@@ -91,13 +95,17 @@ using bsl::flush;
 // [ 1] ~FileObserver2();
 //
 // MANIPULATORS
+// [16] void disableCompression();
 // [ 1] void disableFileLogging();
 // [ 2] void disableLifetimeRotation();
+// [15] void disableMappedOutput();
 // [ 1] void disablePublishInLocalTime();
 // [ 2] void disableSizeRotation();
 // [ 8] void disableTimeIntervalRotation();
+// [16] int  enableCompression(int frameSize, int compressionLevel);
 // [ 1] int  enableFileLogging(const char *fileName);
 // [ 1] int  enableFileLogging(const char *fileName, bool timestampFlag);
+// [15] int  enableMappedOutput(int preallocationSize);
 // [ 1] void enablePublishInLocalTime();
 // [ 1] void publish(const Record& record, const Context& context);
 // [ 1] void publish(const shared_ptr<Record>&, const Context&);
@@ -106,17 +114,23 @@ using bsl::flush;
 // [ 2] void rotateOnLifetime(DatetimeInterval& interval);
 // [ 8] void rotateOnTimeInterval(const DatetimeInterval& interval);
 // [ 9] void rotateOnTimeInterval(const DtInterval& i, const Datetime& s);
+// [14] void setAsyncFileIo(bdls::AsyncFileIo *, bool);
 // [ 1] void setLogFileFunctor(const logRecordFunctor& logFileFunctor);
 // [ 5] void setOnFileRotationCallback(const OnFileRotationCallback&);
 //
 // ACCESSORS
+// [16] bool isCompressionEnabled() const;
 // [ 1] bool isFileLoggingEnabled() const;
 // [ 1] bool isFileLoggingEnabled(bsl::string *result) const;
+// [15] bool isMappedOutputEnabled() const;
 // [ 1] bool isPublishInLocalTimeEnabled() const;
 // [ 2] DatetimeInterval rotationLifetime() const;
 // [ 2] int rotationSize() const;
 // ----------------------------------------------------------------------------
-// [13] USAGE EXAMPLE
+// [17] USAGE EXAMPLE
+// [16] CONCERN: COMPRESSED FILE OUTPUT
+// [15] CONCERN: MAPPED FILE OUTPUT
+// [14] CONCERN: ASYNCHRONOUS FILE OUTPUT
 // [12] CONCERN: CURRENT LOCAL-TIME OFFSET IN TIMESTAMP
 // [11] CONCERN: TIME CALLBACKS ARE CALLED
 // [10] CONCERN: ROTATION CAN BE ENABLED AFTER FILE LOGGING
@@ -575,6 +589,79 @@ int getNumLines(const char *fileName)
     return numLines;
 }
 
+int countLines(const bsl::string& content)
+    // Return the number of '\n' characters in the specified 'content'.
+{
+    return static_cast<int>(bsl::count(content.begin(), content.end(), '\n'));
+}
+
+int decompressFileIntoString(const bsl::string&  fileName,
+                             bsl::string        *content)
+    // Load into the specified 'content' the decompressed content of the file
+    // having the specified 'fileName'.  Return the status of
+    // 'ball::CompressedFileUtil::decompressFile'.
+{
+    bsl::ostringstream os;
+    const int          rc = ball::CompressedFileUtil::decompressFile(
+                                                            os,
+                                                            fileName.c_str());
+    *content = os.str();
+    return rc;
+}
+
+class RotatedFileCollector {
+    // This class provides a functor matching the signature of
+    // 'ball::FileObserver2::OnFileRotationCallback' that moves each file
+    // rotated successfully to a unique name (as the names of files rotated
+    // within the same second would otherwise collide), and appends that name
+    // to a vector.
+
+    // DATA
+    bsl::vector<bsl::string> *d_names_p;  // collected file names (held)
+
+  public:
+    // CREATORS
+    explicit RotatedFileCollector(bsl::vector<bsl::string> *names)
+        // Create a collector appending to the specified 'names'.
+    : d_names_p(names)
+    {
+    }
+
+    // ACCESSORS
+    void operator()(int status, const bsl::string& rotatedFileName) const
+        // If the specified 'status' is 0, move the file having the specified
+        // 'rotatedFileName' to a unique name, and append that name to the
+        // names of this object.
+    {
+        if (0 != status) {
+            return;                                                   // RETURN
+        }
+
+        bsl::ostringstream newName;
+        newName << rotatedFileName << ".collected." << d_names_p->size();
+
+        ASSERT(0 == bdls::FilesystemUtil::move(rotatedFileName.c_str(),
+                                               newName.str().c_str()));
+        d_names_p->push_back(newName.str());
+    }
+};
+
+bool containsNul(const bsl::string& fileName)
+    // Return 'true' if the file with the specified 'fileName' contains a
+    // '\0' character, and 'false' otherwise.
+{
+    bsl::ifstream fs(fileName.c_str(), bsl::ios::in | bsl::ios::binary);
+    ASSERT(fs.is_open());
+
+    char c;
+    while (fs.get(c)) {
+        if ('\0' == c) {
+            return true;                                              // RETURN
+        }
+    }
+    return false;
+}
+
 struct TestCurrentTimeCallback {
   private:
     // DATA
@@ -712,7 +799,7 @@ int main(int argc, char *argv[])
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:
-      case 14: {
+      case 17: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -788,6 +875,616 @@ int main(int argc, char *argv[])
 //..
 
       } break;
+      case 16: {
+        // --------------------------------------------------------------------
+        // CONCERN: COMPRESSED FILE OUTPUT
+        //
+        // Concerns:
+        //: 1 Compression is disabled by default, and is enabled and disabled
+        //:   by 'enableCompression' and 'disableCompression'; an invalid
+        //:   compression level is rejected without effect.
+        //:
+        //: 2 With compression enabled, records are all written to the log
+        //:   file as Zstandard frames, which are complete once file logging is
+        //:   disabled.
+        //:
+        //: 3 Rotations, forced or on size, preserve every record, and every
+        //:   rotated file consists of complete frames.
+        //:
+        //: 4 Enabling or disabling compression while file logging is enabled
+        //:   takes effect for the next log file opened.
+        //:
+        //: 5 Compression takes precedence over mapped output.
+        //
+        // Plan:
+        //: 1 Verify 'isCompressionEnabled' before and after calls to
+        //:   'enableCompression', with valid and invalid levels, and
+        //:   'disableCompression'.  (C-1)
+        //:
+        //: 2 Publish records with compression enabled, and verify the line
+        //:   count and content of the decompressed log file after file logging
+        //:   is disabled.  (C-2)
+        //:
+        //: 3 Publish records with a forced rotation, and then with a small
+        //:   rotation size, collecting the names of the rotated files, and
+        //:   verify that each decompresses completely, and the total line
+        //:   count.  (C-3)
+        //:
+        //: 4 Enable and disable compression between records and forced
+        //:   rotations, and verify which files are compressed.  (C-4)
+        //:
+        //: 5 Publish records with both compression and mapped output enabled,
+        //:   and verify that the log file is compressed.  (C-5)
+        //
+        // Testing:
+        //   void disableCompression();
+        //   int  enableCompression(int frameSize, int compressionLevel);
+        //   bool isCompressionEnabled() const;
+        //   CONCERN: COMPRESSED FILE OUTPUT
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nCONCERN: COMPRESSED FILE OUTPUT"
+                          << "\n===============================" << endl;
+
+        typedef bdls::FilesystemUtil FileUtil;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        TempDirectoryGuard tempDirGuard;
+
+        const int NUM_RECORDS = 500;
+
+        if (verbose) cout << "\tTesting enabling and disabling." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT(!X.isCompressionEnabled());
+            ASSERT(0 == mX.enableCompression());
+            ASSERT( X.isCompressionEnabled());
+            mX.disableCompression();
+            ASSERT(!X.isCompressionEnabled());
+
+            ASSERT(0 != mX.enableCompression(16, 100));
+            ASSERT(!X.isCompressionEnabled());
+
+            ASSERT(0 == mX.enableCompression(16, 19));
+            ASSERT( X.isCompressionEnabled());
+            ASSERT(0 == mX.enableCompression(0, -1));
+            ASSERT( X.isCompressionEnabled());
+            mX.disableCompression();
+            ASSERT(!X.isCompressionEnabled());
+            mX.disableCompression();
+            ASSERT(!X.isCompressionEnabled());
+        }
+
+        if (verbose) cout << "\tTesting output." << endl;
+        {
+            bsl::string fileName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&fileName, "compressed.log");
+
+            Obj mX(&ta);
+
+            ASSERT(0 == mX.enableCompression(4));
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+
+            for (int i = 0; i < NUM_RECORDS; ++i) {
+                char message[32];
+                snprintf(message, sizeof message, "record %05d.", i);
+                publishRecord(&mX, message);
+            }
+            mX.disableFileLogging();
+
+            bsl::string content;
+            ASSERT(0 == decompressFileIntoString(fileName, &content));
+            ASSERT(2 * NUM_RECORDS == countLines(content));
+            ASSERT(FileUtil::getFileSize(fileName) <
+                                   static_cast<bsls::Types::Int64>(
+                                                             content.size()));
+
+            bsl::size_t position = 0;
+            for (int i = 0; i < NUM_RECORDS; ++i) {
+                char message[32];
+                snprintf(message, sizeof message, "record %05d.", i);
+
+                position = content.find(message, position);
+                ASSERTV(i, bsl::string::npos != position);
+                if (bsl::string::npos == position) {
+                    break;
+                }
+            }
+
+            // Reenabling file logging appends frames to the log file.
+
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+            publishRecord(&mX, "appended");
+            mX.disableFileLogging();
+
+            ASSERT(0 == decompressFileIntoString(fileName, &content));
+            ASSERT(2 * NUM_RECORDS + 2 == countLines(content));
+            ASSERT(bsl::string::npos != content.find("appended"));
+        }
+
+        if (verbose) cout << "\tTesting rotation." << endl;
+        {
+            bsl::string fileName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&fileName, "rotated.log");
+
+            bsl::vector<bsl::string> rotatedFileNames;
+
+            Obj mX(&ta);
+
+            mX.setOnFileRotationCallback(
+                                 RotatedFileCollector(&rotatedFileNames));
+            ASSERT(0 == mX.enableCompression(1));
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+
+            for (int i = 0; i < NUM_RECORDS; ++i) {
+                publishRecord(&mX, "before forced rotation");
+            }
+            mX.forceRotation();
+            ASSERT(1 == rotatedFileNames.size());
+
+            // Records are highly compressible, so a small rotation size
+            // (which applies to the compressed size) needs many of them.
+
+            mX.rotateOnSize(1);
+
+            for (int i = 0; i < 20 * NUM_RECORDS; ++i) {
+                char message[32];
+                snprintf(message, sizeof message, "rotating %05d", i);
+                publishRecord(&mX, message);
+            }
+            mX.disableFileLogging();
+
+            ASSERTV(rotatedFileNames.size(), 2 < rotatedFileNames.size());
+
+            bsl::string content;
+            ASSERT(0 == decompressFileIntoString(fileName, &content));
+            int numLines = countLines(content);
+
+            for (bsl::size_t i = 0; i < rotatedFileNames.size(); ++i) {
+                const bsl::string& NAME = rotatedFileNames[i];
+
+                ASSERTV(NAME, 0 == decompressFileIntoString(NAME, &content));
+                numLines += countLines(content);
+            }
+            ASSERTV(numLines, 2 * 21 * NUM_RECORDS == numLines);
+        }
+
+        if (verbose) cout << "\tTesting switching modes." << endl;
+        {
+            bsl::string fileName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&fileName, "switched.log");
+
+            bsl::vector<bsl::string> rotatedFileNames;
+
+            Obj mX(&ta);  const Obj& X = mX;
+
+            mX.setOnFileRotationCallback(
+                                 RotatedFileCollector(&rotatedFileNames));
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+            publishRecord(&mX, "uncompressed");
+
+            // Compression applies from the next log file.
+
+            ASSERT(0 == mX.enableCompression());
+            ASSERT(X.isFileLoggingEnabled());
+            publishRecord(&mX, "still uncompressed");
+            ASSERT(4 == getNumLines(fileName.c_str()));
+
+            mX.forceRotation();
+            ASSERT(1 == rotatedFileNames.size());
+            publishRecord(&mX, "compressed");
+
+            // Disabling compression also applies from the next log file.
+
+            mX.disableCompression();
+            publishRecord(&mX, "still compressed");
+
+            mX.forceRotation();
+            ASSERT(2 == rotatedFileNames.size());
+            publishRecord(&mX, "uncompressed again");
+            mX.disableFileLogging();
+
+            bsl::string content;
+            ASSERT(4 == readFileIntoString(__LINE__,
+                                           rotatedFileNames[0],
+                                           content));
+            ASSERT(bsl::string::npos != content.find("still uncompressed"));
+
+            ASSERT(0 == decompressFileIntoString(rotatedFileNames[1],
+                                                 &content));
+            ASSERT(4 == countLines(content));
+            ASSERT(bsl::string::npos != content.find("still compressed"));
+
+            ASSERT(2 == getNumLines(fileName.c_str()));
+            ASSERT(0  > decompressFileIntoString(fileName, &content));
+        }
+
+        if (verbose) cout << "\tTesting with mapped output." << endl;
+        {
+            bsl::string fileName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&fileName, "precedence.log");
+
+            Obj mX(&ta);
+
+            ASSERT(0 == mX.enableMappedOutput(1024));
+            ASSERT(0 == mX.enableCompression());
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+
+            for (int i = 0; i < NUM_RECORDS; ++i) {
+                publishRecord(&mX, "compressed, not mapped");
+            }
+            mX.disableFileLogging();
+
+            ASSERT(1024 * 1024 > FileUtil::getFileSize(fileName));
+
+            bsl::string content;
+            ASSERT(0 == decompressFileIntoString(fileName, &content));
+            ASSERT(2 * NUM_RECORDS == countLines(content));
+        }
+      } break;
+      case 15: {
+        // --------------------------------------------------------------------
+        // CONCERN: MAPPED FILE OUTPUT
+        //
+        // Concerns:
+        //: 1 Mapped output is disabled by default, and is enabled and disabled
+        //:   by 'enableMappedOutput' and 'disableMappedOutput'.
+        //:
+        //: 2 In mapped output mode, records are all written to the log file,
+        //:   which is preallocated while open and truncated to the records
+        //:   written when closed.
+        //:
+        //: 3 A preallocated file for the next log file is created in the
+        //:   background, and removed when file logging or mapped output is
+        //:   disabled.
+        //:
+        //: 4 Rotations, forced or on size, preserve every record.
+        //:
+        //: 5 Enabling or disabling mapped output while file logging is
+        //:   enabled reopens the log file, which is appended to.
+        //
+        // Plan:
+        //: 1 Verify 'isMappedOutputEnabled' before and after calls to
+        //:   'enableMappedOutput' and 'disableMappedOutput'.  (C-1)
+        //:
+        //: 2 Publish records with mapped output enabled, verifying the size
+        //:   of the log file while open, and its line count and content after
+        //:   file logging is disabled.  (C-2)
+        //:
+        //: 3 Wait for the preallocated file to appear, and verify that it is
+        //:   removed when file logging, and then when mapped output, is
+        //:   disabled.  (C-3)
+        //:
+        //: 4 Publish records with a forced rotation, and then with a small
+        //:   rotation size, collecting the names of the rotated files, and
+        //:   verify the total line count, and that no file contains a '\0'.
+        //:   (C-4)
+        //:
+        //: 5 Enable and disable mapped output between records, and verify the
+        //:   line count and content of the log file.  (C-5)
+        //
+        // Testing:
+        //   void disableMappedOutput();
+        //   int  enableMappedOutput(int preallocationSize);
+        //   bool isMappedOutputEnabled() const;
+        //   CONCERN: MAPPED FILE OUTPUT
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nCONCERN: MAPPED FILE OUTPUT"
+                          << "\n===========================" << endl;
+
+        typedef bdls::FilesystemUtil FileUtil;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        TempDirectoryGuard tempDirGuard;
+
+        const int NUM_RECORDS = 500;
+
+        if (verbose) cout << "\tTesting enabling and disabling." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT(!X.isMappedOutputEnabled());
+            ASSERT(0 == mX.enableMappedOutput());
+            ASSERT( X.isMappedOutputEnabled());
+            ASSERT(0 == mX.enableMappedOutput(1024));
+            ASSERT( X.isMappedOutputEnabled());
+            mX.disableMappedOutput();
+            ASSERT(!X.isMappedOutputEnabled());
+            mX.disableMappedOutput();
+            ASSERT(!X.isMappedOutputEnabled());
+        }
+
+        if (verbose) cout << "\tTesting output and preallocation." << endl;
+        {
+            bsl::string fileName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&fileName, "mapped.log");
+
+            bsl::string preallocatedName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&preallocatedName,
+                                      ".mapped.log.preallocated");
+
+            Obj mX(&ta);
+
+            ASSERT(0 == mX.enableMappedOutput(1024));
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+
+            for (int i = 0; i < NUM_RECORDS; ++i) {
+                char message[32];
+                snprintf(message, sizeof message, "record %05d.", i);
+                publishRecord(&mX, message);
+            }
+
+            ASSERT(1024 * 1024 <= FileUtil::getFileSize(fileName));
+
+            for (int i = 0; i < 500 && !FileUtil::exists(preallocatedName);
+                                                                         ++i) {
+                bslmt::ThreadUtil::microSleep(10 * 1000);
+            }
+            ASSERT(FileUtil::exists(preallocatedName));
+            ASSERT(1024 * 1024 == FileUtil::getFileSize(preallocatedName));
+
+            mX.disableFileLogging();
+            ASSERT(!FileUtil::exists(preallocatedName));
+
+            ASSERT(2 * NUM_RECORDS == getNumLines(fileName.c_str()));
+            ASSERT(!containsNul(fileName));
+
+            bsl::string content;
+            ASSERT(2 * NUM_RECORDS ==
+                             readFileIntoString(__LINE__, fileName, content));
+
+            bsl::size_t position = 0;
+            for (int i = 0; i < NUM_RECORDS; ++i) {
+                char message[32];
+                snprintf(message, sizeof message, "record %05d.", i);
+
+                position = content.find(message, position);
+                ASSERTV(i, bsl::string::npos != position);
+                if (bsl::string::npos == position) {
+                    break;
+                }
+            }
+
+            // Reenabling file logging appends to the log file.
+
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+            publishRecord(&mX, "appended");
+            mX.disableMappedOutput();
+            ASSERT(!FileUtil::exists(preallocatedName));
+            mX.disableFileLogging();
+
+            ASSERT(2 * NUM_RECORDS + 2 == getNumLines(fileName.c_str()));
+            ASSERT(!containsNul(fileName));
+        }
+
+        if (verbose) cout << "\tTesting rotation." << endl;
+        {
+            bsl::string fileName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&fileName, "rotated.log");
+
+            bsl::vector<bsl::string> rotatedFileNames;
+
+            Obj mX(&ta);
+
+            mX.setOnFileRotationCallback(
+                                 RotatedFileCollector(&rotatedFileNames));
+            ASSERT(0 == mX.enableMappedOutput());
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+
+            for (int i = 0; i < NUM_RECORDS; ++i) {
+                publishRecord(&mX, "before forced rotation");
+            }
+            mX.forceRotation();
+            ASSERT(1 == rotatedFileNames.size());
+
+            // Rotate on size with a preallocation size equal to the rotation
+            // size.
+
+            mX.rotateOnSize(16);
+            ASSERT(0 == mX.enableMappedOutput(0));
+
+            for (int i = 0; i < 4 * NUM_RECORDS; ++i) {
+                publishRecord(&mX, "rotating on size");
+            }
+            mX.disableFileLogging();
+
+            ASSERTV(rotatedFileNames.size(), 5 < rotatedFileNames.size());
+
+            int numLines = getNumLines(fileName.c_str());
+            ASSERT(!containsNul(fileName));
+
+            for (bsl::size_t i = 0; i < rotatedFileNames.size(); ++i) {
+                const bsl::string& NAME = rotatedFileNames[i];
+
+                numLines += getNumLines(NAME.c_str());
+                ASSERTV(NAME, !containsNul(NAME));
+                if (0 < i) {
+                    ASSERTV(NAME,
+                            16 * 1024 + 1024 > FileUtil::getFileSize(NAME));
+                }
+            }
+            ASSERTV(numLines, 2 * 5 * NUM_RECORDS == numLines);
+        }
+
+        if (verbose) cout << "\tTesting switching modes." << endl;
+        {
+            bsl::string fileName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&fileName, "switched.log");
+
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+            publishRecord(&mX, "blocking");
+
+            ASSERT(0 == mX.enableMappedOutput());
+            ASSERT(X.isFileLoggingEnabled());
+            publishRecord(&mX, "mapped");
+
+            mX.disableMappedOutput();
+            ASSERT(X.isFileLoggingEnabled());
+            publishRecord(&mX, "blocking again");
+
+            ASSERT(6 == getNumLines(fileName.c_str()));
+            mX.disableFileLogging();
+
+            ASSERT(6 == getNumLines(fileName.c_str()));
+            ASSERT(!containsNul(fileName));
+
+            bsl::string content;
+            readFileIntoString(__LINE__, fileName, content);
+
+            const bsl::size_t first  = content.find("blocking");
+            const bsl::size_t second = content.find("mapped");
+            const bsl::size_t third  = content.find("blocking again");
+            ASSERT(first < second);
+            ASSERT(second < third);
+            ASSERT(bsl::string::npos != third);
+        }
+      } break;
+      case 14: {
+        // --------------------------------------------------------------------
+        // CONCERN: ASYNCHRONOUS FILE OUTPUT
+        //
+        // Concerns:
+        //: 1 Records published after 'setAsyncFileIo' is called with a
+        //:   started 'bdls::AsyncFileIo' object are all written to the log
+        //:   file, in the order in which they were published, with or without
+        //:   data syncs.
+        //:
+        //: 2 Rotating the log file waits for the writes in progress, so that
+        //:   each record is written to the file that was current when the
+        //:   record was published.
+        //:
+        //: 3 Calling 'setAsyncFileIo' with 0 restores synchronous output.
+        //:
+        //: 4 No asynchronous request is pending once file logging is
+        //:   disabled.
+        //
+        // Plan:
+        //: 1 For each value of 'syncFlag', publish a sequence of numbered
+        //:   records using an 'AsyncFileIo' object, disable file logging, and
+        //:   verify the content of the log file.  (C-1,4)
+        //:
+        //: 2 Publish records, force a rotation, publish more records, and
+        //:   verify the number of records in the rotated and in the current
+        //:   log files.  (C-2)
+        //:
+        //: 3 Call 'setAsyncFileIo' with 0, publish a record, and verify that
+        //:   it is in the log file before file logging is disabled.  (C-3)
+        //
+        // Testing:
+        //   void setAsyncFileIo(bdls::AsyncFileIo *, bool);
+        //   CONCERN: ASYNCHRONOUS FILE OUTPUT
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nCONCERN: ASYNCHRONOUS FILE OUTPUT"
+                          << "\n=================================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        TempDirectoryGuard tempDirGuard;
+
+        bdls::AsyncFileIo asyncFileIo(&ta);
+        ASSERT(0 == asyncFileIo.start());
+
+        const int NUM_RECORDS = 500;
+
+        if (verbose) cout << "\tTesting record order and content." << endl;
+
+        for (int syncFlag = 0; syncFlag < 2; ++syncFlag) {
+            bsl::string fileName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&fileName,
+                                      syncFlag ? "sync.log" : "nosync.log");
+
+            Obj mX(&ta);  const Obj& X = mX;
+
+            mX.setAsyncFileIo(&asyncFileIo, syncFlag);
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+
+            for (int i = 0; i < NUM_RECORDS; ++i) {
+                char message[32];
+                snprintf(message, sizeof message, "record %05d.", i);
+                publishRecord(&mX, message);
+            }
+            mX.disableFileLogging();
+            ASSERT(!X.isFileLoggingEnabled());
+            ASSERTV(syncFlag, 0 == asyncFileIo.numPendingRequests());
+
+            ASSERTV(syncFlag, 2 * NUM_RECORDS ==
+                                              getNumLines(fileName.c_str()));
+
+            bsl::string content;
+            ASSERT(2 * NUM_RECORDS ==
+                             readFileIntoString(__LINE__, fileName, content));
+
+            bsl::size_t position = 0;
+            for (int i = 0; i < NUM_RECORDS; ++i) {
+                char message[32];
+                snprintf(message, sizeof message, "record %05d.", i);
+
+                position = content.find(message, position);
+                ASSERTV(syncFlag, i, bsl::string::npos != position);
+                if (bsl::string::npos == position) {
+                    break;
+                }
+            }
+        }
+
+        if (verbose) cout << "\tTesting rotation." << endl;
+        {
+            bsl::string fileName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&fileName, "rotate.log");
+
+            LogRotationCallbackTester cb(&ta);
+
+            Obj mX(&ta);
+
+            mX.setAsyncFileIo(&asyncFileIo, false);
+            mX.setOnFileRotationCallback(cb);
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+
+            for (int i = 0; i < NUM_RECORDS; ++i) {
+                publishRecord(&mX, "before rotation");
+            }
+            mX.forceRotation();
+
+            ASSERT(1 == cb.numInvocations());
+            ASSERT(0 == cb.status());
+            ASSERT(2 * NUM_RECORDS ==
+                                 getNumLines(cb.rotatedFileName().c_str()));
+
+            for (int i = 0; i < NUM_RECORDS / 2; ++i) {
+                publishRecord(&mX, "after rotation");
+            }
+            mX.disableFileLogging();
+
+            ASSERT(NUM_RECORDS == getNumLines(fileName.c_str()));
+        }
+
+        if (verbose) cout << "\tTesting synchronous output." << endl;
+        {
+            bsl::string fileName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&fileName, "synchronous.log");
+
+            Obj mX(&ta);
+
+            mX.setAsyncFileIo(&asyncFileIo, true);
+            mX.setAsyncFileIo(0);
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+
+            publishRecord(&mX, "synchronous");
+            ASSERT(0 == asyncFileIo.numPendingRequests());
+            ASSERT(2 == getNumLines(fileName.c_str()));
+
+            mX.disableFileLogging();
+        }
+
+        asyncFileIo.stop();
+      } break;
       case 13: {
         // --------------------------------------------------------------------
         // REPRODUCE BUG FROM DRQS 123123158
@@ -48,6 +48,13 @@ BSLS_IDENT("$Id: $")
 //  BALL_LOGVA_ERROR(MSG, ...): produce 'e_ERROR' record using 'printf' format
 //  BALL_LOGVA_FATAL(MSG, ...): produce 'e_FATAL' record using 'printf' format
 //  BALL_LOGVA(SEV, MSG, ...): produce a 'SEV' log record using 'printf' format
+//  BALL_LOGDEFER_TRACE(MSG, ...): 'e_TRACE' record formatted when published
+//  BALL_LOGDEFER_DEBUG(MSG, ...): 'e_DEBUG' record formatted when published
+//  BALL_LOGDEFER_INFO( MSG, ...): 'e_INFO' record formatted when published
+//  BALL_LOGDEFER_WARN( MSG, ...): 'e_WARN' record formatted when published
+//  BALL_LOGDEFER_ERROR(MSG, ...): 'e_ERROR' record formatted when published
+//  BALL_LOGDEFER_FATAL(MSG, ...): 'e_FATAL' record formatted when published
+//  BALL_LOGDEFER(SEV, MSG, ...): 'SEV' record formatted when published
 //  BALL_LOG_TRACE_BLOCK: set code block with 'e_TRACE' condition of execution
 //  BALL_LOG_DEBUG_BLOCK: set code block with 'e_DEBUG' condition of execution
 //  BALL_LOG_INFO_BLOCK: set a code block with 'e_INFO' condition of execution
@@ -329,6 +336,36 @@ BSLS_IDENT("$Id: $")
 //      compatible with the format specification in 'MSG'.  Note that each use
 //      of this macro must be terminated by a ';'.
 //..
+// On platforms supporting variadic templates, a last set of 'printf'-style
+// macros *defers* the formatting of the message: the calling thread captures
+// the address of the format specification and the values of the arguments
+// (see 'ball_deferredmessage'), and the message is formatted when it is first
+// read, typically by the observer publishing the record.  When records are
+// published by a 'ball::AsyncFileObserver', the formatting is therefore done
+// by its publication thread, rather than by the thread that logs:
+//..
+//  BALL_LOGDEFER_TRACE(MSG, ...);
+//  BALL_LOGDEFER_DEBUG(MSG, ...);
+//  BALL_LOGDEFER_INFO( MSG, ...);
+//  BALL_LOGDEFER_WARN( MSG, ...);
+//  BALL_LOGDEFER_ERROR(MSG, ...);
+//  BALL_LOGDEFER_FATAL(MSG, ...);
+//  BALL_LOGDEFER(SEVERITY, MSG, ...);
+//      Capture the specified '...' optional arguments, if any, to be
+//      formatted according to the 'printf'-style format specification in the
+//      specified 'MSG', and log a record having the resulting deferred message
+//      with the severity indicated by the name of the macro (e.g.,
+//      'BALL_LOGDEFER_INFO' logs with severity 'ball::Severity::e_INFO') or
+//      with the specified 'SEVERITY'.  'MSG' must be a string literal (or
+//      otherwise remain valid until the record is published), and each
+//      optional argument must be of arithmetic, enumeration, or pointer type;
+//      the strings of 'const char *' arguments are copied, except that the
+//      message is formatted immediately if a string is too long to be copied.
+//      The number and types of the optional arguments are checked against
+//      'MSG' by compilers that check 'printf' formats, but an incompatible
+//      argument never has undefined behavior.  Note that each use of these
+//      macros must be terminated by a ';'.
+//..
 //
 ///Macros for Logging Code Blocks
 /// - - - - - - - - - - - - - - -
@@ -933,6 +970,7 @@ BSLS_IDENT("$Id: $")
 #include <bslma_managedptr.h>
 
 #include <bsls_annotation.h>
+#include <bsls_compilerfeatures.h>
 #include <bsls_keyword.h>
 #include <bsls_performancehint.h>
 #include <bsls_platform.h>
@@ -1357,6 +1395,80 @@ do {                                                                          \
 #define BALL_LOGVA_FATAL(...)                                                 \
     BALL_LOGVA_CONST_IMP(BloombergLP::ball::Severity::e_FATAL, __VA_ARGS__)
 
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+
+                 // ====================================
+                 // Implementation Details: Do *NOT* Use
+                 // ====================================
+
+// BALL_LOGDEFER_CONST_IMP requires its first argument to be a compile-time
+// constant, while all the others may be variables.  The call to
+// 'Log::checkFormat', which is never executed, lets the compiler check the
+// arguments against the format.
+
+#define BALL_LOGDEFER_CONST_IMP(SEVERITY, ...)                                \
+do {                                                                          \
+    if (const BloombergLP::ball::CategoryHolder *ball_log_cAtEgOrYhOlDeR =    \
+               BloombergLP::ball::Log::categoryHolderIfEnabled<(SEVERITY)>(   \
+                      ball_log_getCategoryHolder(BALL_LOG_CATEGORYHOLDER))) { \
+        BloombergLP::ball::Log::logDeferredMessage(                           \
+                                       ball_log_cAtEgOrYhOlDeR->category(),   \
+                                       (SEVERITY),                            \
+                                       __FILE__,                              \
+                                       __LINE__,                              \
+                                       __VA_ARGS__);                          \
+        if (false) {                                                          \
+            BloombergLP::ball::Log::checkFormat(__VA_ARGS__);                 \
+        }                                                                     \
+    }                                                                         \
+} while(0)
+
+                      // ==========================
+                      // Deferred-formatting macros
+                      // ==========================
+
+// BALL_LOGDEFER allows all its arguments to be calculated at run-time, at a
+// cost in performance.
+
+#define BALL_LOGDEFER(SEVERITY, ...)                                          \
+do {                                                                          \
+    const BloombergLP::ball::CategoryHolder *ball_log_cAtEgOrYhOlDeR =        \
+                         ball_log_getCategoryHolder(BALL_LOG_CATEGORYHOLDER); \
+    if (ball_log_cAtEgOrYhOlDeR->threshold() >= (SEVERITY) &&                 \
+           BloombergLP::ball::Log::isCategoryEnabled(ball_log_cAtEgOrYhOlDeR, \
+                                                     (SEVERITY))) {           \
+        BloombergLP::ball::Log::logDeferredMessage(                           \
+                                       ball_log_cAtEgOrYhOlDeR->category(),   \
+                                       (SEVERITY),                            \
+                                       __FILE__,                              \
+                                       __LINE__,                              \
+                                       __VA_ARGS__);                          \
+        if (false) {                                                          \
+            BloombergLP::ball::Log::checkFormat(__VA_ARGS__);                 \
+        }                                                                     \
+    }                                                                         \
+} while(0)
+
+#define BALL_LOGDEFER_TRACE(...)                                              \
+    BALL_LOGDEFER_CONST_IMP(BloombergLP::ball::Severity::e_TRACE, __VA_ARGS__)
+
+#define BALL_LOGDEFER_DEBUG(...)                                              \
+    BALL_LOGDEFER_CONST_IMP(BloombergLP::ball::Severity::e_DEBUG, __VA_ARGS__)
+
+#define BALL_LOGDEFER_INFO( ...)                                              \
+    BALL_LOGDEFER_CONST_IMP(BloombergLP::ball::Severity::e_INFO,  __VA_ARGS__)
+
+#define BALL_LOGDEFER_WARN( ...)                                              \
+    BALL_LOGDEFER_CONST_IMP(BloombergLP::ball::Severity::e_WARN,  __VA_ARGS__)
+
+#define BALL_LOGDEFER_ERROR(...)                                              \
+    BALL_LOGDEFER_CONST_IMP(BloombergLP::ball::Severity::e_ERROR, __VA_ARGS__)
+
+#define BALL_LOGDEFER_FATAL(...)                                              \
+    BALL_LOGDEFER_CONST_IMP(BloombergLP::ball::Severity::e_FATAL, __VA_ARGS__)
+
+#endif
+
                        // ==============
                        // Utility Macros
                        // ==============
@@ -1427,6 +1539,12 @@ struct Log {
         // note that 'snprintf' is not part of standard C++-98, so its
         // functionality is provided here.
 
+    static void checkFormat(const char *format, ...)
+                                                 BSLS_ANNOTATION_PRINTF(1, 2);
+        // Do nothing.  Note that this function is called only from code that
+        // is never executed, to let the compiler check the arguments of the
+        // deferred-formatting macros against the specified 'format'.
+
     static Record *getRecord(const Category *category,
                              const char     *file,
                              int             line);
@@ -1485,6 +1603,29 @@ struct Log {
         // obtained by a call to 'Log::getRecord', and, if 'category' is not
         // 0, the logger manager singleton is initialized.
 
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+    template <class... ARGS>
+    static void logDeferredMessage(const Category *category,
+                                   int             severity,
+                                   const char     *fileName,
+                                   int             lineNumber,
+                                   const char     *format,
+                                   const ARGS&...  arguments);
+        // Log a record having the specified 'fileName', 'lineNumber', and
+        // 'severity', the name of the specified 'category', and a deferred
+        // message having the specified 'printf'-style 'format' and
+        // 'arguments', to be formatted when the message is first read (see
+        // 'ball_recordattributes').  The record is stored, passed to the
+        // registered observer, and triggers publication as by 'logMessage'.
+        // 'format' is held by address, and must remain valid until the record
+        // is published.  If a string argument is too long to be copied into
+        // the deferred message, the message is formatted before this method
+        // returns.  This method fails to compile unless each argument has a
+        // type supported by 'ball::DeferredMessage'.  The behavior is
+        // undefined unless 'severity' is in the range '[1 .. 255]' and, if
+        // 'category' is not 0, the logger manager singleton is initialized.
+#endif
+
     static char *obtainMessageBuffer(bslmt::Mutex **mutex,
                                      int           *bufferSize);
         // Block until access to the buffer used for formatting messages in
@@ -1797,6 +1938,32 @@ const CategoryHolder *Log::categoryHolderIfEnabled(
     return 0;
 }
 
+inline
+void Log::checkFormat(const char *, ...)
+{
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+template <class... ARGS>
+inline
+void Log::logDeferredMessage(const Category *category,
+                             int             severity,
+                             const char     *fileName,
+                             int             lineNumber,
+                             const char     *format,
+                             const ARGS&...  arguments)
+{
+    Record *record = getRecord(category, fileName, lineNumber);
+    if (0 != record->fixedFields().setDeferredMessage(format, arguments...)) {
+        // A string argument is held by address, and may not outlive this
+        // call: format the message now.
+
+        record->fixedFields().formatDeferredMessage();
+    }
+    logMessage(category, severity, record);
+}
+#endif
+
 inline
 const Category *Log::setCategoryHierarchically(const char *categoryName)
 {
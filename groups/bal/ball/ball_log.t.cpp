@@ -10,6 +10,7 @@
 #include <ball_defaultattributecontainer.h>
 #include <ball_fileobserver2.h>
 #include <ball_loggermanagerconfiguration.h>
+#include <ball_observer.h>
 #include <ball_predicate.h>
 #include <ball_record.h>
 #include <ball_recordstringformatter.h>
@@ -48,6 +49,7 @@
 #include <bsls_assert.h>
 #include <bsls_atomic.h>
 #include <bsls_compilerfeatures.h>
+#include <bsls_keyword.h>
 #include <bsls_stopwatch.h>
 #include <bsls_timeutil.h>
 #include <bsls_types.h>
@@ -166,6 +168,8 @@ using bsl::flush;
 // [38] RULE-BASED LOGGING USAGE EXAMPLE
 // [39] CLASS-SCOPE LOGGING USAGE EXAMPLE
 // [40] BASIC LOGGING USAGE EXAMPLE
+// [41] DEFERRED-FORMATTING MACROS
+// [-3] DEFERRED-FORMATTING MACRO PERFORMANCE TEST
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -2927,6 +2931,72 @@ void *workerThreadPerformance(void *)
 
 }  // close namespace BALL_LOG_TEST_CASE_MINUS_2
 
+// ============================================================================
+//                         CASE 41 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace BALL_LOG_TEST_CASE_41 {
+
+class RetainingObserver : public BloombergLP::ball::Observer {
+    // This concrete observer retains the last record published to it, without
+    // copying it or reading its message.
+
+    // DATA
+    bsl::shared_ptr<const BloombergLP::ball::Record> d_record;
+
+  public:
+    // MANIPULATORS
+    void publish(
+           const bsl::shared_ptr<const BloombergLP::ball::Record>& record,
+           const BloombergLP::ball::Context&) BSLS_KEYWORD_OVERRIDE
+        // Retain the specified 'record'.
+    {
+        d_record = record;
+    }
+
+    void releaseRecords() BSLS_KEYWORD_OVERRIDE
+        // Release the retained record.
+    {
+        d_record.reset();
+    }
+
+    // ACCESSORS
+    const bsl::shared_ptr<const BloombergLP::ball::Record>& record() const
+        // Return the last record published to this observer.
+    {
+        return d_record;
+    }
+};
+
+}  // close namespace BALL_LOG_TEST_CASE_41
+
+// ============================================================================
+//                         CASE -3 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace BALL_LOG_TEST_CASE_MINUS_3 {
+
+class DiscardingObserver : public BloombergLP::ball::Observer {
+    // This concrete observer discards the records published to it, without
+    // reading their messages (as an asynchronous observer does on the
+    // publishing thread).
+
+  public:
+    // MANIPULATORS
+    void publish(const bsl::shared_ptr<const BloombergLP::ball::Record>&,
+                 const BloombergLP::ball::Context&) BSLS_KEYWORD_OVERRIDE
+        // Discard the specified record.
+    {
+    }
+
+    void releaseRecords() BSLS_KEYWORD_OVERRIDE
+        // Do nothing.
+    {
+    }
+};
+
+}  // close namespace BALL_LOG_TEST_CASE_MINUS_3
+
 // ============================================================================
 //                              MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -2944,6 +3014,225 @@ int main(int argc, char *argv[])
     TestAllocator ta("test", veryVeryVeryVerbose);
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 41: {
+        // --------------------------------------------------------------------
+        // DEFERRED-FORMATTING MACROS
+        //
+        // Concerns:
+        //: 1 Each 'BALL_LOGDEFER_*' macro logs a record having the severity,
+        //:   file name, and line number of the macro invocation, and the
+        //:   message formatted from its arguments.
+        //:
+        //: 2 String arguments are copied when the macro is invoked.
+        //:
+        //: 3 The record is not formatted when it is logged, and is formatted
+        //:   when its message is first read.
+        //:
+        //: 4 The arguments are not evaluated unless the severity is enabled.
+        //:
+        //: 5 'BALL_LOGDEFER' accepts a severity computed at run-time.
+        //:
+        //: 6 A string argument too long to be copied into the deferred
+        //:   message is formatted in full before the macro returns.
+        //
+        // Plan:
+        //: 1 Log, from a category having all severities enabled, by each
+        //:   macro, overwriting a string argument after each invocation, and
+        //:   verify the record published to a test observer.  (C-1..2)
+        //:
+        //: 2 Log to an observer that retains the published record without
+        //:   reading it, and verify that the record has a deferred message,
+        //:   which is formatted when read.  Then log a string longer than
+        //:   'ball::DeferredMessage::k_STRING_CAPACITY', overwrite it, and
+        //:   verify that the retained record was formatted when logged, and
+        //:   has the complete message.  (C-3, 6)
+        //:
+        //: 3 Log from a category having all severities disabled, with an
+        //:   argument having a side effect, and verify that no record is
+        //:   published and the side effect does not occur.  (C-4)
+        //:
+        //: 4 Invoke 'BALL_LOGDEFER' with each severity in a loop.  (C-5)
+        //
+        // Testing:
+        //   BALL_LOGDEFER
+        //   BALL_LOGDEFER_TRACE
+        //   BALL_LOGDEFER_DEBUG
+        //   BALL_LOGDEFER_INFO
+        //   BALL_LOGDEFER_WARN
+        //   BALL_LOGDEFER_ERROR
+        //   BALL_LOGDEFER_FATAL
+        // --------------------------------------------------------------------
+
+        if (verbose) bsl::cout << "\nDEFERRED-FORMATTING MACROS"
+                               << "\n==========================" << bsl::endl;
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+        using namespace BloombergLP;
+
+        ball::LoggerManagerConfiguration lmc;
+        ball::LoggerManagerScopedGuard   lmg(lmc, &ta);
+
+        bsl::shared_ptr<ball::TestObserver> observer(
+                               new (ta) ball::TestObserver(&bsl::cout, &ta),
+                               &ta);
+
+        ball::LoggerManager& manager = ball::LoggerManager::singleton();
+        ASSERT(0 == manager.registerObserver(observer, "test"));
+
+        ball::Administration::addCategory("all", Sev::e_TRACE,
+                                                 Sev::e_TRACE, 0, 0);
+        ball::Administration::addCategory("none", 0, 0, 0, 0);
+
+        const char *FILE = __FILE__;
+
+        if (veryVerbose) bsl::cout << "\tEach macro." << bsl::endl;
+        {
+            BALL_LOG_SET_CATEGORY("all");
+            const Cat *CAT = BALL_LOG_CATEGORY;
+
+            char name[8];
+            int  line;
+            int  numPublished = observer->numPublishedRecords();
+
+            bsl::strcpy(name, "trace");
+            line = L_ + 1;
+            BALL_LOGDEFER_TRACE("%s %d %.1f", name, 1, 1.5);
+            bsl::strcpy(name, "XXXXX");
+            ASSERT(++numPublished == observer->numPublishedRecords());
+            ASSERT(u::isRecordOkay(observer, CAT, Sev::e_TRACE, FILE, line,
+                                   "trace 1 1.5"));
+
+            bsl::strcpy(name, "debug");
+            line = L_ + 1;
+            BALL_LOGDEFER_DEBUG("%s %d %.1f", name, 2, 2.5);
+            bsl::strcpy(name, "XXXXX");
+            ASSERT(++numPublished == observer->numPublishedRecords());
+            ASSERT(u::isRecordOkay(observer, CAT, Sev::e_DEBUG, FILE, line,
+                                   "debug 2 2.5"));
+
+            bsl::strcpy(name, "info");
+            line = L_ + 1;
+            BALL_LOGDEFER_INFO("%s %d %.1f", name, 3, 3.5);
+            bsl::strcpy(name, "XXXXX");
+            ASSERT(++numPublished == observer->numPublishedRecords());
+            ASSERT(u::isRecordOkay(observer, CAT, Sev::e_INFO, FILE, line,
+                                   "info 3 3.5"));
+
+            bsl::strcpy(name, "warn");
+            line = L_ + 1;
+            BALL_LOGDEFER_WARN("%s %d %.1f", name, 4, 4.5);
+            bsl::strcpy(name, "XXXXX");
+            ASSERT(++numPublished == observer->numPublishedRecords());
+            ASSERT(u::isRecordOkay(observer, CAT, Sev::e_WARN, FILE, line,
+                                   "warn 4 4.5"));
+
+            bsl::strcpy(name, "error");
+            line = L_ + 1;
+            BALL_LOGDEFER_ERROR("%s %d %.1f", name, 5, 5.5);
+            bsl::strcpy(name, "XXXXX");
+            ASSERT(++numPublished == observer->numPublishedRecords());
+            ASSERT(u::isRecordOkay(observer, CAT, Sev::e_ERROR, FILE, line,
+                                   "error 5 5.5"));
+
+            bsl::strcpy(name, "fatal");
+            line = L_ + 1;
+            BALL_LOGDEFER_FATAL("%s %d %.1f", name, 6, 6.5);
+            bsl::strcpy(name, "XXXXX");
+            ASSERT(++numPublished == observer->numPublishedRecords());
+            ASSERT(u::isRecordOkay(observer, CAT, Sev::e_FATAL, FILE, line,
+                                   "fatal 6 6.5"));
+
+            line = L_ + 1;
+            BALL_LOGDEFER_INFO("no arguments");
+            ASSERT(++numPublished == observer->numPublishedRecords());
+            ASSERT(u::isRecordOkay(observer, CAT, Sev::e_INFO, FILE, line,
+                                   "no arguments"));
+        }
+
+        if (veryVerbose) bsl::cout << "\tRun-time severity." << bsl::endl;
+        {
+            BALL_LOG_SET_CATEGORY("all");
+            const Cat *CAT = BALL_LOG_CATEGORY;
+
+            const int SEVERITIES[] = { Sev::e_TRACE, Sev::e_DEBUG,
+                                       Sev::e_INFO,  Sev::e_WARN,
+                                       Sev::e_ERROR, Sev::e_FATAL };
+            const int NUM_SEVERITIES = sizeof SEVERITIES / sizeof *SEVERITIES;
+
+            for (int i = 0; i < NUM_SEVERITIES; ++i) {
+                const int SEVERITY     = SEVERITIES[i];
+                const int numPublished = observer->numPublishedRecords();
+                const int line         = L_ + 1;
+                BALL_LOGDEFER(SEVERITY, "severity %d", SEVERITY);
+
+                char expected[32];
+                bsl::sprintf(expected, "severity %d", SEVERITY);
+                ASSERTV(i, numPublished + 1 ==
+                                             observer->numPublishedRecords());
+                ASSERTV(i, u::isRecordOkay(observer, CAT, SEVERITY, FILE,
+                                           line, expected));
+            }
+        }
+
+        if (veryVerbose) bsl::cout << "\tFormatted when read." << bsl::endl;
+        {
+            using namespace BALL_LOG_TEST_CASE_41;
+
+            // The test observer copies the record, formatting its message.
+
+            ASSERT(0 == manager.deregisterObserver("test"));
+
+            bsl::shared_ptr<RetainingObserver> retainingObserver =
+                                  bsl::allocate_shared<RetainingObserver>(&ta);
+            ASSERT(0 == manager.registerObserver(retainingObserver,
+                                                 "retaining"));
+
+            BALL_LOG_SET_CATEGORY("all");
+
+            BALL_LOGDEFER_INFO("retained %d", 8);
+
+            const bsl::shared_ptr<const ball::Record>& record =
+                                                   retainingObserver->record();
+            ASSERT(record);
+
+            const ball::RecordAttributes& attributes = record->fixedFields();
+            ASSERT(true  == attributes.hasDeferredMessage());
+            ASSERT(0     == bsl::strcmp("retained 8", attributes.message()));
+            ASSERT(false == attributes.hasDeferredMessage());
+
+            bsl::string longName(ball::DeferredMessage::k_STRING_CAPACITY + 8,
+                                 'a');
+            const bsl::string EXPECTED = "long " + longName + " 9";
+
+            BALL_LOGDEFER_INFO("long %s %d", longName.c_str(), 9);
+            longName.assign(longName.size(), 'X');
+
+            const bsl::shared_ptr<const ball::Record>& longRecord =
+                                                   retainingObserver->record();
+            ASSERT(longRecord);
+            ASSERT(false    == longRecord->fixedFields().hasDeferredMessage());
+            ASSERT(EXPECTED == longRecord->fixedFields().messageRef());
+
+            ASSERT(0 == manager.deregisterObserver("retaining"));
+            ASSERT(0 == manager.registerObserver(observer, "test"));
+        }
+
+        if (veryVerbose) bsl::cout << "\tDisabled." << bsl::endl;
+        {
+            BALL_LOG_SET_CATEGORY("none");
+
+            const int numPublished = observer->numPublishedRecords();
+            int       numCalls     = 0;
+            BALL_LOGDEFER_FATAL("%d", ++numCalls);
+            BALL_LOGDEFER(Sev::e_INFO, "%d", ++numCalls);
+            ASSERT(numPublished == observer->numPublishedRecords());
+            ASSERT(0            == numCalls);
+        }
+#else
+        if (verbose) bsl::cout << "Skipped: no variadic templates."
+                               << bsl::endl;
+#endif
+      } break;
       case 40: {
         // --------------------------------------------------------------------
         // BASIC LOGGING USAGE EXAMPLE
@@ -12026,6 +12315,90 @@ if (verbose) bsl::cout << "printf-style macro usage" << bsl::endl;
                   << " seconds."
                   << bsl::endl;
       } break;
+      case -3: {
+        // --------------------------------------------------------------------
+        // DEFERRED-FORMATTING MACRO PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 Logging by 'BALL_LOGDEFER_INFO' takes, on the logging thread,
+        //:   less time than logging the same message by 'BALL_LOG_INFO' or
+        //:   'BALL_LOGVA_INFO'.
+        //
+        // Plan:
+        //: 1 Log a typical message, having integer, floating point, and
+        //:   string arguments, by each macro in turn to an observer that
+        //:   discards records without reading their messages (as an
+        //:   asynchronous observer does on the logging thread), and report the
+        //:   time per invocation.  The number of iterations may be supplied
+        //:   as the second argument (default 1000000).
+        // --------------------------------------------------------------------
+
+        if (verbose) bsl::cout << "\nDEFERRED-FORMATTING MACRO PERFORMANCE"
+                               << "\n====================================="
+                               << bsl::endl;
+
+        using namespace BALL_LOG_TEST_CASE_MINUS_3;
+        using namespace BloombergLP;
+
+        const int NUM_ITERATIONS = argc > 2 && 0 < bsl::atoi(argv[2])
+                                 ? bsl::atoi(argv[2])
+                                 : 1000000;
+
+        ball::LoggerManagerConfiguration lmc;
+        lmc.setDefaultThresholdLevelsIfValid(
+                                 ball::Severity::e_OFF,    // record level
+                                 ball::Severity::e_INFO,   // passthrough level
+                                 ball::Severity::e_OFF,    // trigger level
+                                 ball::Severity::e_OFF);   // triggerAll level
+
+        ball::LoggerManagerScopedGuard lmg(lmc);
+        ball::LoggerManager& manager = ball::LoggerManager::singleton();
+
+        ASSERT(0 == manager.registerObserver(
+                                    bsl::make_shared<DiscardingObserver>(),
+                                    "discarding"));
+
+        BALL_LOG_SET_CATEGORY("Performance");
+
+        const char   *SYMBOL = "IBM";
+        const double  PRICE  = 126.375;
+
+        bsls::Stopwatch timer;
+
+        timer.start();
+        for (int i = 0; i < NUM_ITERATIONS; ++i) {
+            BALL_LOG_INFO << "order " << i << ": " << SYMBOL << ' ' << 100
+                          << " @ " << PRICE;
+        }
+        timer.stop();
+        const double streamTime = timer.accumulatedWallTime();
+
+        timer.reset();
+        timer.start();
+        for (int i = 0; i < NUM_ITERATIONS; ++i) {
+            BALL_LOGVA_INFO("order %d: %s %d @ %.4f", i, SYMBOL, 100, PRICE);
+        }
+        timer.stop();
+        const double printfTime = timer.accumulatedWallTime();
+
+        timer.reset();
+        timer.start();
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+        for (int i = 0; i < NUM_ITERATIONS; ++i) {
+            BALL_LOGDEFER_INFO("order %d: %s %d @ %.4f",
+                               i, SYMBOL, 100, PRICE);
+        }
+#endif
+        timer.stop();
+        const double deferTime = timer.accumulatedWallTime();
+
+        bsl::cout << "BALL_LOG_INFO:      "
+                  << streamTime / NUM_ITERATIONS * 1e9 << " ns\n"
+                  << "BALL_LOGVA_INFO:    "
+                  << printfTime / NUM_ITERATIONS * 1e9 << " ns\n"
+                  << "BALL_LOGDEFER_INFO: "
+                  << deferTime  / NUM_ITERATIONS * 1e9 << " ns" << bsl::endl;
+      } break;
       default: {
         bsl::cerr << "WARNING: CASE `" << test << "' NOT FOUND." << bsl::endl;
         testStatus = -1;
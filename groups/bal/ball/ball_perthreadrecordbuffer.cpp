@@ -0,0 +1,506 @@
+// ball_perthreadrecordbuffer.cpp                                     -*-C++-*-
+#include <ball_perthreadrecordbuffer.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ball_perthreadrecordbuffer_cpp,"$Id$ $CSID$")
+
+#include <bdlt_datetime.h>
+
+#include <bslma_default.h>
+
+#include <bslmf_movableref.h>
+
+#include <bslmt_lockguard.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_spinlock.h>
+
+#include <bsl_algorithm.h>
+
+///Implementation Notes
+///--------------------
+// Each ring ('PerThreadRecordBuffer_Ring') is written only by the thread that
+// owns it, and is read only by 'merge' and 'removeAll'.  Its spin lock is
+// therefore contended only while the ring is being drained, and a drain holds
+// the lock only long enough to swap the ring's slots with an empty vector
+// allocated beforehand (memory is never allocated, and records are never
+// destroyed by a drain, while the lock is held).
+//
+// The sum of the sizes of held records, 'd_totalSize', is the only state
+// shared by the 'pushBack' calls of different threads.  A record's size is
+// added when the record is pushed, and subtracted when it is discarded or
+// popped, wherever it is held at that time.
+//
+// The association of a thread with its ring uses a thread-specific key (rather
+// than a 'thread_local' variable) because each record buffer needs its own
+// association, and because the key's cleanup function provides notification
+// of the exit of the thread, so that the ring can be reused.  A released ring
+// is reused only once it is empty, so that the records of an exited thread are
+// not evicted by the thread that takes over its ring.
+
+namespace BloombergLP {
+namespace ball {
+namespace {
+namespace u {
+
+bsls::Types::Int64 recordSize(const Record& record)
+    // Return the size charged against the budget for the specified 'record'.
+{
+    return static_cast<bsls::Types::Int64>(record.numAllocatedBytes())
+         + static_cast<bsls::Types::Int64>(
+               bsls::AlignmentUtil::roundUpToMaximalAlignment(sizeof(Record)));
+}
+
+struct TimestampLess {
+    // This 'struct' provides an ordering of record handles by the timestamps
+    // of the records.
+
+    bool operator()(const bsl::shared_ptr<Record>& lhs,
+                    const bsl::shared_ptr<Record>& rhs) const
+        // Return 'true' if the timestamp of the record referred to by the
+        // specified 'lhs' is earlier than that of the record referred to by
+        // the specified 'rhs', and 'false' otherwise.
+    {
+        return lhs->fixedFields().timestamp() < rhs->fixedFields().timestamp();
+    }
+};
+
+}  // close namespace u
+}  // close unnamed namespace
+
+                     // ================================
+                     // class PerThreadRecordBuffer_Ring
+                     // ================================
+
+class PerThreadRecordBuffer_Ring {
+    // This component-private class provides a fixed-capacity ring buffer of
+    // record handles, written by a single thread.  All members other than
+    // 'd_isReleased' must be accessed only while 'd_lock' is held.
+
+  public:
+    // PUBLIC TYPES
+    typedef bsl::vector<bsl::shared_ptr<Record> > Slots;
+
+    // PUBLIC DATA
+    bsls::SpinLock     d_lock;        // protects the other members
+
+    Slots              d_slots;       // record handles
+
+    int                d_head;        // index of the oldest record
+
+    int                d_length;      // number of records
+
+    bsls::Types::Int64 d_numBytes;    // sum of the sizes of the records
+
+    bsls::AtomicBool   d_isReleased;  // 'true' if the owning thread exited
+
+  private:
+    // NOT IMPLEMENTED
+    PerThreadRecordBuffer_Ring(const PerThreadRecordBuffer_Ring&);
+    PerThreadRecordBuffer_Ring& operator=(const PerThreadRecordBuffer_Ring&);
+
+  public:
+    // CREATORS
+    PerThreadRecordBuffer_Ring(int capacity, bslma::Allocator *allocator)
+        // Create an empty ring having the specified 'capacity', using the
+        // specified 'allocator' to supply memory.
+    : d_lock(bsls::SpinLock::s_unlocked)
+    , d_slots(capacity, allocator)
+    , d_head(0)
+    , d_length(0)
+    , d_numBytes(0)
+    , d_isReleased(false)
+    {
+    }
+
+    // MANIPULATORS
+    bsls::Types::Int64 popOldest()
+        // Remove the oldest record from this ring, and return its size.  The
+        // behavior is undefined unless '0 < d_length'.
+    {
+        BSLS_ASSERT(0 < d_length);
+
+        bsl::shared_ptr<Record>& slot = d_slots[d_head];
+
+        const bsls::Types::Int64 size = u::recordSize(*slot);
+        slot.reset();
+
+        d_head = (d_head + 1) % static_cast<int>(d_slots.size());
+        --d_length;
+        d_numBytes -= size;
+        return size;
+    }
+
+    void push(const bsl::shared_ptr<Record>& handle, bsls::Types::Int64 size)
+        // Append the specified 'handle', of the specified 'size', to this
+        // ring.  The behavior is undefined unless the ring is not full.
+    {
+        const int capacity = static_cast<int>(d_slots.size());
+
+        BSLS_ASSERT(d_length < capacity);
+
+        d_slots[(d_head + d_length) % capacity] = handle;
+        ++d_length;
+        d_numBytes += size;
+    }
+
+    void takeAll(Slots *slots, int *head, int *length)
+        // Exchange the slots of this ring with the specified 'slots', loading
+        // the index of the oldest of the taken records into the specified
+        // 'head' and their number into the specified 'length', and make this
+        // ring empty.  The behavior is undefined unless 'slots' holds as many
+        // empty handles as this ring has slots.
+    {
+        BSLS_ASSERT(slots->size() == d_slots.size());
+
+        d_slots.swap(*slots);
+        *head      = d_head;
+        *length    = d_length;
+        d_head     = 0;
+        d_length   = 0;
+        d_numBytes = 0;
+    }
+
+    // ACCESSORS
+    bool isFull() const
+        // Return 'true' if this ring is full, and 'false' otherwise.
+    {
+        return d_length == static_cast<int>(d_slots.size());
+    }
+};
+
+                        // ---------------------------
+                        // class PerThreadRecordBuffer
+                        // ---------------------------
+
+// PRIVATE CLASS METHODS
+void PerThreadRecordBuffer::releaseRing(void *ring)
+{
+    static_cast<PerThreadRecordBuffer_Ring *>(ring)->d_isReleased.store(true);
+}
+
+// PRIVATE MANIPULATORS
+PerThreadRecordBuffer_Ring *PerThreadRecordBuffer::localRing()
+{
+    PerThreadRecordBuffer_Ring *ring =
+                                    static_cast<PerThreadRecordBuffer_Ring *>(
+                                        bslmt::ThreadUtil::getSpecific(d_key));
+    if (ring) {
+        return ring;                                                  // RETURN
+    }
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_ringsMutex);
+
+        for (RingList::iterator it = d_rings.begin();
+             it != d_rings.end();
+             ++it) {
+            if ((*it)->d_isReleased.load()) {
+                bsls::SpinLockGuard ringGuard(&(*it)->d_lock);
+                if (0 == (*it)->d_length) {
+                    ring = *it;
+                    ring->d_isReleased.store(false);
+                    break;
+                }
+            }
+        }
+
+        if (!ring) {
+            d_rings.reserve(d_rings.size() + 1);
+            ring = new (*d_allocator_p) PerThreadRecordBuffer_Ring(
+                                                         d_maxRecordsPerThread,
+                                                         d_allocator_p);
+            d_rings.push_back(ring);
+            d_numRings.addRelaxed(1);
+        }
+    }
+
+    if (0 != bslmt::ThreadUtil::setSpecific(d_key, ring)) {
+        ring->d_isReleased.store(true);
+        return 0;                                                     // RETURN
+    }
+    return ring;
+}
+
+// PRIVATE ACCESSORS
+void PerThreadRecordBuffer::merge() const
+{
+    typedef PerThreadRecordBuffer_Ring::Slots Slots;
+
+    const bsl::deque<bsl::shared_ptr<Record> >::size_type numHeld =
+                                                            d_sequence.size();
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_ringsMutex);
+
+        Slots slots(d_maxRecordsPerThread, d_allocator_p);
+
+        for (RingList::const_iterator it = d_rings.begin();
+             it != d_rings.end();
+             ++it) {
+            PerThreadRecordBuffer_Ring *ring = *it;
+
+            int head;
+            int length;
+            {
+                bsls::SpinLockGuard ringGuard(&ring->d_lock);
+                if (0 == ring->d_length) {
+                    continue;                                       // CONTINUE
+                }
+                ring->takeAll(&slots, &head, &length);
+            }
+
+            for (int i = 0; i < length; ++i) {
+                bsl::shared_ptr<Record>& slot =
+                                          slots[(head + i) % slots.size()];
+                d_sequence.push_back(bslmf::MovableRefUtil::move(slot));
+            }
+        }
+    }
+
+    if (numHeld != d_sequence.size()) {
+        bsl::stable_sort(d_sequence.begin() + numHeld,
+                         d_sequence.end(),
+                         u::TimestampLess());
+    }
+
+    while (d_totalSize.load() > d_maxTotalSize && !d_sequence.empty()) {
+        d_totalSize.add(-u::recordSize(*d_sequence.front()));
+        d_sequence.pop_front();
+    }
+}
+
+void PerThreadRecordBuffer::mergeOutsideSequence() const
+{
+    if (0 == d_sequenceDepth) {
+        merge();
+    }
+}
+
+// CREATORS
+PerThreadRecordBuffer::PerThreadRecordBuffer(
+                                        int               maxTotalSize,
+                                        bslma::Allocator *basicAllocator)
+: d_maxTotalSize(maxTotalSize)
+, d_maxRecordsPerThread(k_DEFAULT_MAX_RECORDS_PER_THREAD)
+, d_totalSize(0)
+, d_numRings(0)
+, d_rings(basicAllocator)
+, d_sequence(basicAllocator)
+, d_sequenceDepth(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 < maxTotalSize);
+
+    int rc = bslmt::ThreadUtil::createKey(&d_key, &releaseRing);
+    BSLS_ASSERT_OPT(0 == rc);
+    (void)rc;
+}
+
+PerThreadRecordBuffer::PerThreadRecordBuffer(
+                                        int               maxTotalSize,
+                                        int               maxRecordsPerThread,
+                                        bslma::Allocator *basicAllocator)
+: d_maxTotalSize(maxTotalSize)
+, d_maxRecordsPerThread(maxRecordsPerThread)
+, d_totalSize(0)
+, d_numRings(0)
+, d_rings(basicAllocator)
+, d_sequence(basicAllocator)
+, d_sequenceDepth(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 < maxTotalSize);
+    BSLS_ASSERT(0 < maxRecordsPerThread);
+
+    int rc = bslmt::ThreadUtil::createKey(&d_key, &releaseRing);
+    BSLS_ASSERT_OPT(0 == rc);
+    (void)rc;
+}
+
+PerThreadRecordBuffer::~PerThreadRecordBuffer()
+{
+    bslmt::ThreadUtil::deleteKey(d_key);
+
+    for (RingList::iterator it = d_rings.begin(); it != d_rings.end(); ++it) {
+        d_allocator_p->deleteObject(*it);
+    }
+}
+
+// MANIPULATORS
+void PerThreadRecordBuffer::beginSequence()
+{
+    d_mutex.lock();
+    if (0 == d_sequenceDepth++) {
+        merge();
+    }
+}
+
+void PerThreadRecordBuffer::endSequence()
+{
+    BSLS_ASSERT(0 < d_sequenceDepth);
+
+    --d_sequenceDepth;
+    d_mutex.unlock();
+}
+
+void PerThreadRecordBuffer::popBack()
+{
+    bslmt::LockGuard<bslmt::RecursiveMutex> guard(&d_mutex);
+    mergeOutsideSequence();
+
+    BSLS_ASSERT(!d_sequence.empty());
+
+    d_totalSize.add(-u::recordSize(*d_sequence.back()));
+    d_sequence.pop_back();
+}
+
+void PerThreadRecordBuffer::popFront()
+{
+    bslmt::LockGuard<bslmt::RecursiveMutex> guard(&d_mutex);
+    mergeOutsideSequence();
+
+    BSLS_ASSERT(!d_sequence.empty());
+
+    d_totalSize.add(-u::recordSize(*d_sequence.front()));
+    d_sequence.pop_front();
+}
+
+int PerThreadRecordBuffer::pushBack(const bsl::shared_ptr<Record>& handle)
+{
+    const bsls::Types::Int64 size = u::recordSize(*handle);
+    if (size > d_maxTotalSize) {
+        return -1;                                                    // RETURN
+    }
+
+    PerThreadRecordBuffer_Ring *ring = localRing();
+    if (!ring) {
+        return -1;                                                    // RETURN
+    }
+
+    bsls::SpinLockGuard guard(&ring->d_lock);
+
+    if (ring->isFull()) {
+        d_totalSize.addRelaxed(-ring->popOldest());
+    }
+    ring->push(handle, size);
+
+    bsls::Types::Int64 total = d_totalSize.add(size);
+    if (total > d_maxTotalSize) {
+        const bsls::Types::Int64 fairShare = d_maxTotalSize
+                                           / d_numRings.loadRelaxed();
+
+        while (total > d_maxTotalSize
+            && 1 < ring->d_length
+            && ring->d_numBytes > fairShare) {
+            total = d_totalSize.add(-ring->popOldest());
+        }
+    }
+    return 0;
+}
+
+int PerThreadRecordBuffer::pushFront(const bsl::shared_ptr<Record>& handle)
+{
+    const bsls::Types::Int64 size = u::recordSize(*handle);
+    if (size > d_maxTotalSize) {
+        return -1;                                                    // RETURN
+    }
+
+    bslmt::LockGuard<bslmt::RecursiveMutex> guard(&d_mutex);
+    mergeOutsideSequence();
+
+    d_sequence.push_front(handle);
+
+    bsls::Types::Int64 total = d_totalSize.add(size);
+    while (total > d_maxTotalSize && 1 < d_sequence.size()) {
+        total = d_totalSize.add(-u::recordSize(*d_sequence.back()));
+        d_sequence.pop_back();
+    }
+    return 0;
+}
+
+void PerThreadRecordBuffer::removeAll()
+{
+    typedef PerThreadRecordBuffer_Ring::Slots Slots;
+
+    bslmt::LockGuard<bslmt::RecursiveMutex> guard(&d_mutex);
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> ringsGuard(&d_ringsMutex);
+
+        Slots slots(d_maxRecordsPerThread, d_allocator_p);
+
+        for (RingList::iterator it = d_rings.begin();
+             it != d_rings.end();
+             ++it) {
+            PerThreadRecordBuffer_Ring *ring = *it;
+
+            int                head;
+            int                length;
+            bsls::Types::Int64 numBytes;
+            {
+                bsls::SpinLockGuard ringGuard(&ring->d_lock);
+                numBytes = ring->d_numBytes;
+                ring->takeAll(&slots, &head, &length);
+            }
+            d_totalSize.add(-numBytes);
+
+            for (int i = 0; i < length; ++i) {
+                slots[(head + i) % slots.size()].reset();
+            }
+        }
+    }
+
+    while (!d_sequence.empty()) {
+        d_totalSize.add(-u::recordSize(*d_sequence.back()));
+        d_sequence.pop_back();
+    }
+}
+
+// ACCESSORS
+const bsl::shared_ptr<Record>& PerThreadRecordBuffer::back() const
+{
+    bslmt::LockGuard<bslmt::RecursiveMutex> guard(&d_mutex);
+    mergeOutsideSequence();
+
+    BSLS_ASSERT(!d_sequence.empty());
+
+    return d_sequence.back();
+}
+
+const bsl::shared_ptr<Record>& PerThreadRecordBuffer::front() const
+{
+    bslmt::LockGuard<bslmt::RecursiveMutex> guard(&d_mutex);
+    mergeOutsideSequence();
+
+    BSLS_ASSERT(!d_sequence.empty());
+
+    return d_sequence.front();
+}
+
+int PerThreadRecordBuffer::length() const
+{
+    bslmt::LockGuard<bslmt::RecursiveMutex> guard(&d_mutex);
+    mergeOutsideSequence();
+
+    return static_cast<int>(d_sequence.size());
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
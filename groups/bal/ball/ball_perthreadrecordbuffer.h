@@ -0,0 +1,440 @@
+// ball_perthreadrecordbuffer.h                                       -*-C++-*-
+#ifndef INCLUDED_BALL_PERTHREADRECORDBUFFER
+#define INCLUDED_BALL_PERTHREADRECORDBUFFER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a record buffer made of per-thread ring buffers.
+//
+//@CLASSES:
+//  ball::PerThreadRecordBuffer: record buffer with per-thread ring buffers
+//
+//@SEE_ALSO: ball_recordbuffer, ball_fixedsizerecordbuffer, ball_loggermanager
+//
+//@DESCRIPTION: This component provides a concrete thread-safe implementation
+// of the 'ball::RecordBuffer' protocol, 'ball::PerThreadRecordBuffer', that is
+// designed for "record-then-trigger" logging at high volume (e.g., recording
+// every 'TRACE' record in production so that the records preceding an error
+// can be published when the error is logged):
+//..
+//              ( ball::PerThreadRecordBuffer )
+//                            |              ctor
+//                            V
+//                  ( ball::RecordBuffer )
+//                                           dtor
+//                                           beginSequence
+//                                           endSequence
+//                                           popBack
+//                                           popFront
+//                                           pushBack
+//                                           pushFront
+//                                           removeAll
+//                                           length
+//                                           back
+//                                           front
+//..
+// 'ball::FixedSizeRecordBuffer' serializes every 'pushBack' on a single mutex,
+// so that the cost of recording a record grows with the number of threads
+// logging concurrently.  A 'ball::PerThreadRecordBuffer' instead gives each
+// thread that calls 'pushBack' its own fixed-capacity ring buffer of record
+// handles.  A 'pushBack' touches only the ring buffer of the calling thread,
+// and the budget counter shared by all threads, and so does not contend with
+// the 'pushBack' calls of other threads.
+//
+// The records of the ring buffers are merged into a single sequence, ordered
+// by timestamp, only when the contents of the buffer are inspected: by
+// 'beginSequence' (which is how 'ball::Logger' publishes the buffer when a
+// trigger fires), or by any other method called outside a
+// 'beginSequence'/'endSequence' pair.  Between 'beginSequence' and
+// 'endSequence' the buffer behaves as a double-ended queue of the merged
+// records, oldest at the front; records pushed by other threads in the
+// meantime are held in their ring buffers and merged by the next sequence.
+// The records taken from the ring buffers by a merge are sorted by timestamp
+// (records having equal timestamps keep the order in which they were pushed)
+// and appended to the back of the merged sequence, after the records merged
+// earlier and any record pushed to the front.
+//
+///Memory Budget
+///-------------
+// A 'ball::PerThreadRecordBuffer' is created with a budget, 'maxTotalSize', on
+// the sum of the sizes of the records it holds (the size of a record being
+// the memory allocated by the record plus the footprint of the record object
+// itself), and with a capacity, 'maxRecordsPerThread', for each ring buffer.
+// The budget is enforced as follows:
+//
+//: o A record whose size exceeds the budget is discarded by 'pushBack' (and
+//:   'pushFront').
+//:
+//: o When a ring buffer is full, 'pushBack' discards the oldest record in the
+//:   ring buffer of the calling thread.
+//:
+//: o When the budget is exceeded, 'pushBack' discards the oldest records in
+//:   the ring buffer of the calling thread while that ring buffer holds more
+//:   than its fair share of the budget (i.e., 'maxTotalSize' divided by the
+//:   number of ring buffers).  A thread that logs heavily therefore recycles
+//:   its own records, rather than evicting those of quieter threads.
+//:
+//: o When the ring buffers are merged, the oldest records are discarded until
+//:   the budget is met.
+//
+// Since 'pushBack' never discards the records of other threads, the budget may
+// be exceeded between merges (e.g., while a thread that holds less than its
+// fair share is recording); it is met again by the next merge.  The memory
+// used by the ring buffers themselves (one record handle for each of
+// the 'maxRecordsPerThread' slots of each ring buffer) is not counted against
+// the budget.
+//
+// A ring buffer is created the first time a thread calls 'pushBack', and is
+// kept when the thread exits (so that the records of a thread that has exited
+// can still be published); once its records have been merged, the ring
+// buffer of an exited thread is reused by the next thread that calls
+// 'pushBack' for the first time.  The number of ring buffers is therefore
+// bounded by the maximum number of threads that record to the buffer between
+// two merges.
+//
+///Thread Safety
+///-------------
+// 'ball::PerThreadRecordBuffer' is fully thread-safe, except that, as for
+// 'ball::FixedSizeRecordBuffer', the references returned by 'front' and
+// 'back' are valid only until the buffer is next modified, so those methods
+// should be called between 'beginSequence' and 'endSequence'.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Recording Records on Several Threads
+///- - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose a service records the records of several worker threads, and must
+// publish the most recent records, in the order they were created, when an
+// error occurs.
+//
+// First, we create a record buffer with a budget of 1M bytes, and a ring
+// buffer capacity of 256 records per thread:
+//..
+//  bslma::Allocator *allocator = bslma::Default::defaultAllocator();
+//
+//  ball::PerThreadRecordBuffer recordBuffer(1024 * 1024, 256, allocator);
+//..
+// Then, each worker thread creates records (as 'ball::Logger' does) and
+// pushes them to the back of the buffer (note that the threads do not contend
+// with each other):
+//..
+//  void recordMessages(ball::PerThreadRecordBuffer *buffer, int id)
+//  {
+//      bslma::Allocator *allocator = bslma::Default::defaultAllocator();
+//
+//      for (int i = 0; i < 100; ++i) {
+//          bsl::shared_ptr<ball::Record> handle;
+//          handle.createInplace(allocator, allocator);
+//
+//          bsl::ostringstream message;
+//          message << "thread " << id << " message " << i;
+//          handle->fixedFields().setMessage(message.str().c_str());
+//          handle->fixedFields().setTimestamp(bdlt::CurrentTime::utc());
+//
+//          buffer->pushBack(handle);
+//      }
+//  }
+//..
+// Next, we run four workers:
+//..
+//  bslmt::ThreadGroup threads;
+//  for (int id = 0; id < 4; ++id) {
+//      threads.addThread(bdlf::BindUtil::bind(&recordMessages,
+//                                             &recordBuffer,
+//                                             id));
+//  }
+//  threads.joinAll();
+//..
+// Finally, when an error occurs we publish the buffer, in the same way as
+// 'ball::Logger' does when a trigger fires.  The records of the four threads
+// are merged in timestamp order:
+//..
+//  recordBuffer.beginSequence();
+//
+//  assert(400 == recordBuffer.length());
+//
+//  bdlt::Datetime previous = recordBuffer.front()->fixedFields().timestamp();
+//  while (recordBuffer.length()) {
+//      const ball::Record& record = *recordBuffer.front();
+//
+//      assert(previous <= record.fixedFields().timestamp());
+//      previous = record.fixedFields().timestamp();
+//
+//      recordBuffer.popFront();
+//  }
+//
+//  recordBuffer.endSequence();
+//..
+
+#include <balscm_version.h>
+
+#include <ball_record.h>
+#include <ball_recordbuffer.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_mutex.h>
+#include <bslmt_recursivemutex.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_atomic.h>
+#include <bsls_types.h>
+
+#include <bsl_deque.h>
+#include <bsl_memory.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace ball {
+
+class PerThreadRecordBuffer_Ring;
+
+                        // ===========================
+                        // class PerThreadRecordBuffer
+                        // ===========================
+
+class PerThreadRecordBuffer : public RecordBuffer {
+    // This class provides a concrete, thread-safe implementation of the
+    // 'RecordBuffer' protocol in which the records pushed to the back of the
+    // buffer are held in a ring buffer owned by the pushing thread, and merged
+    // in timestamp order when the buffer is inspected.  See {Memory Budget}
+    // for the policy by which records are discarded.
+
+    // PRIVATE TYPES
+    typedef bsl::vector<PerThreadRecordBuffer_Ring *> RingList;
+
+    // DATA
+    bslmt::ThreadUtil::Key          d_key;         // thread-specific key
+                                                   // holding the ring of the
+                                                   // calling thread
+
+    bsls::Types::Int64              d_maxTotalSize;
+                                                   // budget on the sum of the
+                                                   // sizes of held records
+
+    int                             d_maxRecordsPerThread;
+                                                   // capacity of each ring
+
+    mutable bsls::AtomicInt64       d_totalSize;   // sum of the sizes of held
+                                                   // records
+
+    bsls::AtomicInt                 d_numRings;    // number of rings
+
+    mutable bslmt::Mutex            d_ringsMutex;  // protects 'd_rings'
+
+    RingList                        d_rings;       // all rings, owned
+
+    mutable bslmt::RecursiveMutex   d_mutex;       // protects 'd_sequence'
+                                                   // and 'd_sequenceDepth'
+
+    mutable bsl::deque<bsl::shared_ptr<Record> >
+                                    d_sequence;    // merged records, oldest
+                                                   // first
+
+    int                             d_sequenceDepth;
+                                                   // number of unmatched
+                                                   // 'beginSequence' calls
+
+    bslma::Allocator               *d_allocator_p; // memory allocator (held,
+                                                   // not owned)
+
+    // NOT IMPLEMENTED
+    PerThreadRecordBuffer(const PerThreadRecordBuffer&);
+    PerThreadRecordBuffer& operator=(const PerThreadRecordBuffer&);
+
+    // PRIVATE CLASS METHODS
+    static void releaseRing(void *ring);
+        // Mark the specified 'ring' as no longer owned by a thread.  This
+        // function is the cleanup function of the thread-specific key, and is
+        // called when a thread that owns a ring exits.
+
+    // PRIVATE MANIPULATORS
+    PerThreadRecordBuffer_Ring *localRing();
+        // Return the ring owned by the calling thread, creating it (or
+        // reusing the empty ring of an exited thread) if the calling thread
+        // does not own one.  Return 0 if the calling thread cannot be
+        // associated with a ring.
+
+    // PRIVATE ACCESSORS
+    void merge() const;
+        // Move the records of every ring, sorted by timestamp, to the back of
+        // the merged sequence, and discard the records at its front until the
+        // budget is met.  The behavior is undefined unless 'd_mutex' is
+        // locked by the calling thread.
+
+    void mergeOutsideSequence() const;
+        // Call 'merge' unless the calling thread is between 'beginSequence'
+        // and 'endSequence'.  The behavior is undefined unless 'd_mutex' is
+        // locked by the calling thread.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(PerThreadRecordBuffer,
+                                   bslma::UsesBslmaAllocator);
+
+    // PUBLIC TYPES
+    enum {
+        k_DEFAULT_MAX_RECORDS_PER_THREAD = 1024
+                                  // default capacity of each ring buffer
+    };
+
+    // CREATORS
+    explicit
+    PerThreadRecordBuffer(int               maxTotalSize,
+                          bslma::Allocator *basicAllocator = 0);
+    PerThreadRecordBuffer(int               maxTotalSize,
+                          int               maxRecordsPerThread,
+                          bslma::Allocator *basicAllocator = 0);
+        // Create a record buffer holding records whose sizes sum to at most
+        // the specified 'maxTotalSize' bytes (see {Memory Budget}), in ring
+        // buffers each having a capacity of the optionally specified
+        // 'maxRecordsPerThread' records (or
+        // 'k_DEFAULT_MAX_RECORDS_PER_THREAD' if 'maxRecordsPerThread' is not
+        // specified).  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.  The behavior is undefined unless
+        // '0 < maxTotalSize' and '0 < maxRecordsPerThread'.
+
+    virtual ~PerThreadRecordBuffer();
+        // Remove all record handles from this record buffer and destroy this
+        // record buffer.  The behavior is undefined if any thread is calling
+        // a method of this record buffer.
+
+    // MANIPULATORS
+    virtual void beginSequence();
+        // *Lock* this record buffer so that a sequence of method invocations
+        // on this record buffer can occur uninterrupted by other threads, and
+        // merge the records held in the ring buffers of all threads into this
+        // buffer in timestamp order.  The buffer remains *locked* until
+        // 'endSequence' is called.  Records pushed to the back of the buffer
+        // by other threads while it is *locked* are not visible until the next
+        // sequence.  It is valid to invoke other methods on this record buffer
+        // between the calls to 'beginSequence' and 'endSequence'.
+
+    virtual void endSequence();
+        // *Unlock* this record buffer, thus allowing other threads to access
+        // it.  The behavior is undefined unless the buffer is already *locked*
+        // by 'beginSequence'.
+
+    virtual void popBack();
+        // Remove from this record buffer the record handle positioned at the
+        // back end of the buffer (i.e., the newest record).  The behavior is
+        // undefined unless '0 < length()'.
+
+    virtual void popFront();
+        // Remove from this record buffer the record handle positioned at the
+        // front end of the buffer (i.e., the oldest record).  The behavior is
+        // undefined unless '0 < length()'.
+
+    virtual int pushBack(const bsl::shared_ptr<Record>& handle);
+        // Push the specified 'handle' at the back end of the ring buffer of
+        // the calling thread.  Return 0 on success, and a non-zero value if
+        // the record was discarded.  Records held by the ring buffer of the
+        // calling thread may be discarded to accommodate the record (see
+        // {Memory Budget}).  Note that this method does not lock this buffer.
+
+    virtual int pushFront(const bsl::shared_ptr<Record>& handle);
+        // Push the specified 'handle' at the front end of this record buffer.
+        // Return 0 on success, and a non-zero value if the record was
+        // discarded.  Records from the back end of the buffer may be removed
+        // to accommodate the record.  Note that this method locks this buffer
+        // and merges the ring buffers, and so is much slower than 'pushBack'.
+
+    virtual void removeAll();
+        // Remove all record handles stored in this record buffer, including
+        // those held in the ring buffers of all threads.  Note that 'length()'
+        // is now 0.
+
+    // ACCESSORS
+    virtual const bsl::shared_ptr<Record>& back() const;
+        // Return a reference of the shared pointer referring to the record
+        // positioned at the back end of this record buffer.  The behavior is
+        // undefined unless this record buffer has been locked by the
+        // 'beginSequence' method and unless '0 < length()'.
+
+    virtual const bsl::shared_ptr<Record>& front() const;
+        // Return a reference of the shared pointer referring to the record
+        // positioned at the front end of this record buffer.  The behavior is
+        // undefined unless this record buffer has been locked by the
+        // 'beginSequence' method and unless '0 < length()'.
+
+    virtual int length() const;
+        // Return the number of record handles in this record buffer.  Note
+        // that, between 'beginSequence' and 'endSequence', records pushed by
+        // other threads since 'beginSequence' are not counted.
+
+    int maxRecordsPerThread() const;
+        // Return the capacity of the ring buffer of each thread.
+
+    bsls::Types::Int64 maxTotalSize() const;
+        // Return the budget on the sum of the sizes of the records held by
+        // this record buffer.
+
+    int numRingBuffers() const;
+        // Return the number of ring buffers held by this record buffer.
+
+    bsls::Types::Int64 totalSize() const;
+        // Return the sum of the sizes of the records held by this record
+        // buffer.  Note that the value returned may be out of date by the time
+        // it is used.
+};
+
+// ============================================================================
+//                              INLINE DEFINITIONS
+// ============================================================================
+
+                        // ---------------------------
+                        // class PerThreadRecordBuffer
+                        // ---------------------------
+
+// ACCESSORS
+inline
+int PerThreadRecordBuffer::maxRecordsPerThread() const
+{
+    return d_maxRecordsPerThread;
+}
+
+inline
+bsls::Types::Int64 PerThreadRecordBuffer::maxTotalSize() const
+{
+    return d_maxTotalSize;
+}
+
+inline
+int PerThreadRecordBuffer::numRingBuffers() const
+{
+    return d_numRings.loadRelaxed();
+}
+
+inline
+bsls::Types::Int64 PerThreadRecordBuffer::totalSize() const
+{
+    return d_totalSize.loadRelaxed();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,999 @@
+// ball_perthreadrecordbuffer.t.cpp                                   -*-C++-*-
+#include <ball_perthreadrecordbuffer.h>
+
+#include <ball_fixedsizerecordbuffer.h>
+#include <ball_record.h>
+
+#include <bdlf_bind.h>
+
+#include <bdlt_currenttime.h>
+#include <bdlt_datetime.h>
+#include <bdlt_datetimeinterval.h>
+#include <bdlt_epochutil.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadgroup.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_memory.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a thread-safe mechanism implementing the
+// 'ball::RecordBuffer' protocol.  We first verify, on a single thread, that
+// records pushed to the back are merged in timestamp order, that the pop and
+// push-front manipulators and the accessors behave as a double-ended queue of
+// the merged records, and that the memory budget and ring buffer capacity are
+// enforced as documented.  We then verify, with several threads, that the
+// records of all threads are merged in order without loss, that the ring
+// buffers of exited threads are reused, that records pushed during a sequence
+// are deferred to the next sequence, and that a thread recording heavily does
+// not evict the records of quieter threads.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] PerThreadRecordBuffer(int maxTotalSize, Allocator *a = 0);
+// [ 2] PerThreadRecordBuffer(int maxTotalSize, int maxPerThread, *a = 0);
+// [ 2] ~PerThreadRecordBuffer();
+//
+// MANIPULATORS
+// [ 2] void beginSequence();
+// [ 2] void endSequence();
+// [ 2] void popBack();
+// [ 2] void popFront();
+// [ 2] int pushBack(const bsl::shared_ptr<ball::Record>& handle);
+// [ 3] int pushFront(const bsl::shared_ptr<ball::Record>& handle);
+// [ 3] void removeAll();
+//
+// ACCESSORS
+// [ 2] const bsl::shared_ptr<ball::Record>& back() const;
+// [ 2] const bsl::shared_ptr<ball::Record>& front() const;
+// [ 2] int length() const;
+// [ 2] int maxRecordsPerThread() const;
+// [ 2] bsls::Types::Int64 maxTotalSize() const;
+// [ 5] int numRingBuffers() const;
+// [ 4] bsls::Types::Int64 totalSize() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CONCERN: the memory budget and ring capacity are enforced
+// [ 5] CONCERN: records of concurrent threads are merged in order
+// [ 6] CONCERN: a heavily recording thread evicts its own records
+// [ 7] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                     NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+#define ASSERT_PASS_RAW(EXPR)  BSLS_ASSERTTEST_ASSERT_PASS_RAW(EXPR)
+#define ASSERT_FAIL_RAW(EXPR)  BSLS_ASSERTTEST_ASSERT_FAIL_RAW(EXPR)
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef ball::PerThreadRecordBuffer Obj;
+typedef bsl::shared_ptr<ball::Record> Handle;
+typedef bsls::Types::Int64            Int64;
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static Handle makeRecord(int               milliseconds,
+                         const char       *message,
+                         bslma::Allocator *allocator)
+    // Return a handle to a new record, using the specified 'allocator' to
+    // supply memory, having the specified 'message' and a timestamp the
+    // specified 'milliseconds' after the epoch.
+{
+    Handle handle;
+    handle.createInplace(allocator, allocator);
+
+    handle->fixedFields().setMessage(message);
+    handle->fixedFields().setTimestamp(
+                     bdlt::EpochUtil::epoch()
+                   + bdlt::DatetimeInterval(0, 0, 0, 0, milliseconds));
+    return handle;
+}
+
+static Int64 recordSize(const Handle& handle)
+    // Return the size charged against the budget of a record buffer for the
+    // record referred to by the specified 'handle'.
+{
+    return handle->numAllocatedBytes()
+         + static_cast<Int64>(bsls::AlignmentUtil::roundUpToMaximalAlignment(
+                                                        sizeof(ball::Record)));
+}
+
+static int timestampOf(const Handle& handle)
+    // Return the number of milliseconds since the epoch of the timestamp of
+    // the record referred to by the specified 'handle'.
+{
+    return static_cast<int>((handle->fixedFields().timestamp()
+                           - bdlt::EpochUtil::epoch()).totalMilliseconds());
+}
+
+static void recordNumberedMessages(Obj              *buffer,
+                                   int               id,
+                                   int               numRecords,
+                                   bslmt::Barrier   *barrier,
+                                   bslma::Allocator *allocator)
+    // Wait on the specified 'barrier', then push to the back of the specified
+    // 'buffer' the specified 'numRecords' records, created using the
+    // specified 'allocator', whose messages are "<id> <i>" for the specified
+    // 'id' and the index 'i' of the record, and whose timestamps are the
+    // current time.
+{
+    barrier->wait();
+
+    for (int i = 0; i < numRecords; ++i) {
+        Handle handle;
+        handle.createInplace(allocator, allocator);
+
+        bsl::ostringstream message;
+        message << id << ' ' << i;
+        handle->fixedFields().setMessage(message.str().c_str());
+        handle->fixedFields().setTimestamp(bdlt::CurrentTime::utc());
+
+        ASSERTV(id, i, 0 == buffer->pushBack(handle));
+    }
+}
+
+template <class BUFFER>
+static void pushRecords(BUFFER         *buffer,
+                        const Handle&   handle,
+                        int             numRecords,
+                        bslmt::Barrier *barrier)
+    // Wait on the specified 'barrier', then push the specified 'handle' to the
+    // back of the specified 'buffer' the specified 'numRecords' times.
+{
+    barrier->wait();
+
+    for (int i = 0; i < numRecords; ++i) {
+        buffer->pushBack(handle);
+    }
+}
+
+// ============================================================================
+//                                USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Example 1: Recording Records on Several Threads
+///- - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose a service records the records of several worker threads, and must
+// publish the most recent records, in the order they were created, when an
+// error occurs.
+//
+// Then, each worker thread creates records (as 'ball::Logger' does) and
+// pushes them to the back of the buffer (note that the threads do not contend
+// with each other):
+//..
+    void recordMessages(ball::PerThreadRecordBuffer *buffer, int id)
+    {
+        bslma::Allocator *allocator = bslma::Default::defaultAllocator();
+
+        for (int i = 0; i < 100; ++i) {
+            bsl::shared_ptr<ball::Record> handle;
+            handle.createInplace(allocator, allocator);
+
+            bsl::ostringstream message;
+            message << "thread " << id << " message " << i;
+            handle->fixedFields().setMessage(message.str().c_str());
+            handle->fixedFields().setTimestamp(bdlt::CurrentTime::utc());
+
+            buffer->pushBack(handle);
+        }
+    }
+//..
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator         da("default", veryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+// First, we create a record buffer with a budget of 1M bytes, and a ring
+// buffer capacity of 256 records per thread:
+//..
+    bslma::Allocator *allocator = bslma::Default::defaultAllocator();
+
+    ball::PerThreadRecordBuffer recordBuffer(1024 * 1024, 256, allocator);
+//..
+// Next, we run four workers:
+//..
+    bslmt::ThreadGroup threads;
+    for (int id = 0; id < 4; ++id) {
+        threads.addThread(bdlf::BindUtil::bind(&recordMessages,
+                                               &recordBuffer,
+                                               id));
+    }
+    threads.joinAll();
+//..
+// Finally, when an error occurs we publish the buffer, in the same way as
+// 'ball::Logger' does when a trigger fires.  The records of the four threads
+// are merged in timestamp order:
+//..
+    recordBuffer.beginSequence();
+
+    ASSERT(400 == recordBuffer.length());
+
+    bdlt::Datetime previous = recordBuffer.front()->fixedFields().timestamp();
+    while (recordBuffer.length()) {
+        const ball::Record& record = *recordBuffer.front();
+
+        ASSERT(previous <= record.fixedFields().timestamp());
+        previous = record.fixedFields().timestamp();
+
+        recordBuffer.popFront();
+    }
+
+    recordBuffer.endSequence();
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONCERN: A HEAVILY RECORDING THREAD EVICTS ITS OWN RECORDS
+        //
+        // Concerns:
+        //: 1 When the budget is exceeded, a thread holding more than its fair
+        //:   share of the budget discards its own oldest records, and not
+        //:   those of a thread holding less than its fair share.
+        //:
+        //: 2 The budget is met after the ring buffers are merged.
+        //
+        // Plan:
+        //: 1 Push a few records on one thread, then many records (enough to
+        //:   exceed the budget several times over) on a second thread.  Merge,
+        //:   and verify that the records of the first thread are all present,
+        //:   that the most recent records of the second thread are present,
+        //:   and that the budget is met.  (C-1..2)
+        //
+        // Testing:
+        //   CONCERN: a heavily recording thread evicts its own records
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: A HEAVILY RECORDING THREAD EVICTS ITS "
+                          << "OWN RECORDS" << endl
+                          << "==============================================="
+                          << "===========" << endl;
+
+        bslma::TestAllocator oa("object", veryVerbose);
+        bslma::TestAllocator ra("records", veryVerbose);
+
+        const Int64 SIZE = recordSize(makeRecord(0, "0 0", &ra));
+
+        const int QUIET_RECORDS = 5;
+        const int BUSY_RECORDS  = 10000;
+
+        Obj mX(static_cast<int>(40 * SIZE), &oa);  const Obj& X = mX;
+
+        bslmt::Barrier barrier(1);
+
+        bslmt::ThreadGroup threads;
+        threads.addThread(bdlf::BindUtil::bind(&recordNumberedMessages,
+                                               &mX,
+                                               0,
+                                               QUIET_RECORDS,
+                                               &barrier,
+                                               &ra));
+        threads.joinAll();
+
+        threads.addThread(bdlf::BindUtil::bind(&recordNumberedMessages,
+                                               &mX,
+                                               1,
+                                               BUSY_RECORDS,
+                                               &barrier,
+                                               &ra));
+        threads.joinAll();
+
+        mX.beginSequence();
+
+        ASSERTV(X.totalSize(), X.maxTotalSize(),
+                X.totalSize() <= X.maxTotalSize());
+
+        int numQuiet = 0;
+        int lastBusy = -1;
+        while (X.length()) {
+            bsl::istringstream message(X.front()->fixedFields().message());
+            int                id;
+            int                index;
+            message >> id >> index;
+            if (0 == id) {
+                ++numQuiet;
+            }
+            else {
+                lastBusy = index;
+            }
+            mX.popFront();
+        }
+        ASSERTV(numQuiet, QUIET_RECORDS == numQuiet);
+        ASSERTV(lastBusy, BUSY_RECORDS - 1 == lastBusy);
+
+        mX.endSequence();
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCERN: RECORDS OF CONCURRENT THREADS ARE MERGED IN ORDER
+        //
+        // Concerns:
+        //: 1 The records pushed concurrently by several threads are all held
+        //:   (when the budget and capacity are not exceeded), and are merged
+        //:   in timestamp order, the records of each thread remaining in the
+        //:   order in which they were pushed.
+        //:
+        //: 2 One ring buffer is created for each recording thread, and the
+        //:   ring buffers of threads that have exited are reused.
+        //:
+        //: 3 Records pushed by other threads between 'beginSequence' and
+        //:   'endSequence' are not visible until the next sequence.
+        //
+        // Plan:
+        //: 1 Push records from several threads, started together by a
+        //:   barrier.  Merge, and verify the number and order of the records.
+        //:   (C-1)
+        //:
+        //: 2 Verify that 'numRingBuffers' equals the number of threads, then
+        //:   repeat with new threads and verify that it does not grow.  (C-2)
+        //:
+        //: 3 Begin a sequence, push records from another thread, and verify
+        //:   that 'length' is unchanged until the next sequence.  (C-3)
+        //
+        // Testing:
+        //   int numRingBuffers() const;
+        //   CONCERN: records of concurrent threads are merged in order
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: RECORDS OF CONCURRENT THREADS ARE "
+                          << "MERGED IN ORDER" << endl
+                          << "==========================================="
+                          << "===============" << endl;
+
+        bslma::TestAllocator oa("object", veryVerbose);
+        bslma::TestAllocator ra("records", veryVerbose);
+
+        const int NUM_THREADS = 8;
+        const int NUM_RECORDS = 500;
+
+        Obj mX(1 << 30, NUM_RECORDS, &oa);  const Obj& X = mX;
+
+        for (int round = 0; round < 2; ++round) {
+            if (veryVerbose) { T_ P(round) }
+
+            bslmt::Barrier     barrier(NUM_THREADS);
+            bslmt::ThreadGroup threads;
+            for (int id = 0; id < NUM_THREADS; ++id) {
+                threads.addThread(bdlf::BindUtil::bind(&recordNumberedMessages,
+                                                       &mX,
+                                                       id,
+                                                       NUM_RECORDS,
+                                                       &barrier,
+                                                       &ra));
+            }
+            threads.joinAll();
+
+            ASSERTV(round, X.numRingBuffers(),
+                    NUM_THREADS == X.numRingBuffers());
+
+            mX.beginSequence();
+
+            ASSERTV(round, X.length(),
+                    NUM_THREADS * NUM_RECORDS == X.length());
+
+            bsl::vector<int> nextIndex(NUM_THREADS, 0);
+            bdlt::Datetime   previous = X.front()->fixedFields().timestamp();
+
+            while (X.length()) {
+                const ball::Record& record = *X.front();
+
+                ASSERTV(round, previous <= record.fixedFields().timestamp());
+                previous = record.fixedFields().timestamp();
+
+                bsl::istringstream message(record.fixedFields().message());
+                int                id;
+                int                index;
+                message >> id >> index;
+
+                ASSERTV(round, id, 0 <= id && id < NUM_THREADS);
+                if (0 <= id && id < NUM_THREADS) {
+                    ASSERTV(round, id, index, nextIndex[id],
+                            nextIndex[id] == index);
+                    nextIndex[id] = index + 1;
+                }
+                mX.popFront();
+            }
+            mX.endSequence();
+
+            ASSERTV(round, X.totalSize(), 0 == X.totalSize());
+        }
+
+        if (verbose) cout << "\nRecords pushed during a sequence." << endl;
+        {
+            bslmt::Barrier barrier(1);
+
+            mX.beginSequence();
+            ASSERTV(X.length(), 0 == X.length());
+
+            bslmt::ThreadGroup threads;
+            threads.addThread(bdlf::BindUtil::bind(&recordNumberedMessages,
+                                                   &mX,
+                                                   0,
+                                                   10,
+                                                   &barrier,
+                                                   &ra));
+            threads.joinAll();
+
+            ASSERTV(X.length(), 0 == X.length());
+            mX.endSequence();
+
+            ASSERTV(X.length(), 10 == X.length());
+            ASSERTV(X.numRingBuffers(), NUM_THREADS == X.numRingBuffers());
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCERN: THE MEMORY BUDGET AND RING CAPACITY ARE ENFORCED
+        //
+        // Concerns:
+        //: 1 A record whose size exceeds the budget is rejected by 'pushBack'
+        //:   and 'pushFront', and is not held.
+        //:
+        //: 2 When the ring buffer of the calling thread is full, 'pushBack'
+        //:   discards its oldest record.
+        //:
+        //: 3 When the budget is exceeded, 'pushBack' discards the oldest
+        //:   records of the calling thread, and 'pushFront' discards records
+        //:   from the back.
+        //:
+        //: 4 'totalSize' is the sum of the sizes of the held records, and
+        //:   returns to 0 when all records are removed.
+        //
+        // Plan:
+        //: 1 Push records of known size, exceeding first the capacity and then
+        //:   the budget, and verify 'length', 'totalSize', and which records
+        //:   are held.  (C-1..4)
+        //
+        // Testing:
+        //   bsls::Types::Int64 totalSize() const;
+        //   CONCERN: the memory budget and ring capacity are enforced
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: THE MEMORY BUDGET AND RING CAPACITY "
+                          << "ARE ENFORCED" << endl
+                          << "============================================="
+                          << "============" << endl;
+
+        bslma::TestAllocator oa("object", veryVerbose);
+        bslma::TestAllocator ra("records", veryVerbose);
+
+        const Int64 SIZE = recordSize(makeRecord(0, "message", &ra));
+
+        if (verbose) cout << "\nRecords larger than the budget." << endl;
+        {
+            Obj mX(static_cast<int>(SIZE - 1), &oa);  const Obj& X = mX;
+
+            ASSERT(0 != mX.pushBack(makeRecord(0, "message", &ra)));
+            ASSERT(0 != mX.pushFront(makeRecord(0, "message", &ra)));
+            ASSERT(0 == X.length());
+            ASSERT(0 == X.totalSize());
+        }
+
+        if (verbose) cout << "\nRing capacity." << endl;
+        {
+            Obj mX(1 << 30, 4, &oa);  const Obj& X = mX;
+
+            for (int i = 0; i < 10; ++i) {
+                ASSERTV(i, 0 == mX.pushBack(makeRecord(i, "message", &ra)));
+                ASSERTV(i, X.totalSize(),
+                        (i < 4 ? i + 1 : 4) * SIZE == X.totalSize());
+            }
+
+            mX.beginSequence();
+            ASSERTV(X.length(), 4 == X.length());
+            ASSERTV(timestampOf(X.front()), 6 == timestampOf(X.front()));
+            ASSERTV(timestampOf(X.back()),  9 == timestampOf(X.back()));
+            mX.endSequence();
+        }
+
+        if (verbose) cout << "\nBudget." << endl;
+        {
+            Obj mX(static_cast<int>(3 * SIZE), &oa);  const Obj& X = mX;
+
+            for (int i = 0; i < 10; ++i) {
+                ASSERTV(i, 0 == mX.pushBack(makeRecord(i, "message", &ra)));
+                ASSERTV(i, X.totalSize(), X.totalSize() <= 3 * SIZE);
+            }
+
+            mX.beginSequence();
+            ASSERTV(X.length(), 3 == X.length());
+            ASSERTV(timestampOf(X.front()), 7 == timestampOf(X.front()));
+            ASSERTV(timestampOf(X.back()),  9 == timestampOf(X.back()));
+
+            ASSERT(0 == mX.pushFront(makeRecord(100, "message", &ra)));
+            ASSERTV(X.length(), 3 == X.length());
+            ASSERTV(timestampOf(X.front()), 100 == timestampOf(X.front()));
+            ASSERTV(timestampOf(X.back()),    8 == timestampOf(X.back()));
+            ASSERTV(X.totalSize(), 3 * SIZE == X.totalSize());
+            mX.endSequence();
+
+            mX.removeAll();
+            ASSERT(0 == X.length());
+            ASSERT(0 == X.totalSize());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'pushFront' AND 'removeAll'
+        //
+        // Concerns:
+        //: 1 'pushFront' inserts a record before all held records, including
+        //:   those not yet merged from ring buffers.
+        //:
+        //: 2 'removeAll' removes the merged records and the records held in
+        //:   ring buffers, and releases them.
+        //
+        // Plan:
+        //: 1 Push records to the back and to the front, and verify the order
+        //:   in which they are popped.  (C-1)
+        //:
+        //: 2 Push records, call 'removeAll', and verify that the buffer is
+        //:   empty and that the records are destroyed.  (C-2)
+        //
+        // Testing:
+        //   int pushFront(const bsl::shared_ptr<ball::Record>& handle);
+        //   void removeAll();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'pushFront' AND 'removeAll'" << endl
+                          << "===================================" << endl;
+
+        bslma::TestAllocator oa("object", veryVerbose);
+        bslma::TestAllocator ra("records", veryVerbose);
+
+        {
+            Obj mX(1 << 20, &oa);  const Obj& X = mX;
+
+            ASSERT(0 == mX.pushBack(makeRecord(2, "b", &ra)));
+            ASSERT(0 == mX.pushBack(makeRecord(3, "c", &ra)));
+            ASSERT(0 == mX.pushFront(makeRecord(9, "a", &ra)));
+            ASSERT(0 == mX.pushBack(makeRecord(4, "d", &ra)));
+
+            mX.beginSequence();
+            ASSERTV(X.length(), 4 == X.length());
+
+            const char *EXPECTED[] = { "a", "b", "c", "d" };
+            for (int i = 0; i < 4; ++i) {
+                ASSERTV(i, X.front()->fixedFields().message(),
+                        bsl::string(EXPECTED[i]) ==
+                                          X.front()->fixedFields().message());
+                mX.popFront();
+            }
+            mX.endSequence();
+        }
+
+        {
+            Obj mX(1 << 20, &oa);  const Obj& X = mX;
+
+            for (int i = 0; i < 10; ++i) {
+                mX.pushBack(makeRecord(i, "message", &ra));
+            }
+            mX.beginSequence();
+            mX.endSequence();
+            for (int i = 0; i < 10; ++i) {
+                mX.pushBack(makeRecord(i, "message", &ra));
+            }
+            ASSERT(0 < ra.numBlocksInUse());
+
+            mX.removeAll();
+
+            ASSERT(0 == X.length());
+            ASSERT(0 == X.totalSize());
+            ASSERTV(ra.numBlocksInUse(), 0 == ra.numBlocksInUse());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING PRIMARY MANIPULATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 The constructors set the budget and the ring buffer capacity, and
+        //:   the buffer is initially empty.
+        //:
+        //: 2 Records pushed to the back are merged in timestamp order (records
+        //:   having equal timestamps remaining in the order in which they
+        //:   were pushed), whether or not they were pushed in that order.
+        //:
+        //: 3 'front', 'back', 'popFront', and 'popBack' access and remove the
+        //:   oldest and newest records, and 'length' is the number of held
+        //:   records, both inside and outside a sequence.
+        //:
+        //: 4 Records held when a sequence ends precede those merged by a later
+        //:   sequence.
+        //:
+        //: 5 All memory is supplied by the specified allocator, and is
+        //:   released on destruction, with the held records.
+        //
+        // Plan:
+        //: 1 Create objects with each constructor and verify the accessors.
+        //:   (C-1)
+        //:
+        //: 2 Push records with out-of-order and equal timestamps, and verify
+        //:   the order in which they are popped from either end.  (C-2..4)
+        //:
+        //: 3 Use test allocators to verify memory use.  (C-5)
+        //
+        // Testing:
+        //   PerThreadRecordBuffer(int maxTotalSize, Allocator *a = 0);
+        //   PerThreadRecordBuffer(int maxTotalSize, int maxPerThread, *a = 0);
+        //   ~PerThreadRecordBuffer();
+        //   void beginSequence();
+        //   void endSequence();
+        //   void popBack();
+        //   void popFront();
+        //   int pushBack(const bsl::shared_ptr<ball::Record>& handle);
+        //   const bsl::shared_ptr<ball::Record>& back() const;
+        //   const bsl::shared_ptr<ball::Record>& front() const;
+        //   int length() const;
+        //   int maxRecordsPerThread() const;
+        //   bsls::Types::Int64 maxTotalSize() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING PRIMARY MANIPULATORS AND BASIC ACCESSORS"
+                          << endl
+                          << "================================================"
+                          << endl;
+
+        bslma::TestAllocator oa("object", veryVerbose);
+        bslma::TestAllocator ra("records", veryVerbose);
+
+        if (verbose) cout << "\nConstructors." << endl;
+        {
+            Obj mX(1000, &oa);  const Obj& X = mX;
+
+            ASSERT(1000 == X.maxTotalSize());
+            ASSERT(Obj::k_DEFAULT_MAX_RECORDS_PER_THREAD ==
+                                                     X.maxRecordsPerThread());
+            ASSERT(0    == X.length());
+            ASSERT(0    == X.totalSize());
+            ASSERT(0    == X.numRingBuffers());
+
+            Obj mY(2000, 7, &oa);  const Obj& Y = mY;
+
+            ASSERT(2000 == Y.maxTotalSize());
+            ASSERT(7    == Y.maxRecordsPerThread());
+            ASSERT(0    == Y.length());
+        }
+        ASSERTV(da.numBlocksInUse(), 0 == da.numBlocksInUse());
+
+        if (verbose) cout << "\nOrdering." << endl;
+        {
+            Obj mX(1 << 20, &oa);  const Obj& X = mX;
+
+            const struct {
+                int         d_timestamp;
+                const char *d_message;
+            } DATA[] = {
+                { 5, "e" }, { 1, "a" }, { 3, "c1" }, { 2, "b" }, { 3, "c2" },
+                { 4, "d" },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int i = 0; i < NUM_DATA; ++i) {
+                ASSERTV(i, 0 == mX.pushBack(makeRecord(DATA[i].d_timestamp,
+                                                       DATA[i].d_message,
+                                                       &ra)));
+            }
+            ASSERTV(X.length(), NUM_DATA == X.length());
+            ASSERTV(X.numRingBuffers(), 1 == X.numRingBuffers());
+
+            mX.beginSequence();
+
+            ASSERTV(X.length(), NUM_DATA == X.length());
+            ASSERT(bsl::string("a") == X.front()->fixedFields().message());
+            ASSERT(bsl::string("e") == X.back()->fixedFields().message());
+
+            mX.popFront();
+            mX.popBack();
+            ASSERTV(X.length(), NUM_DATA - 2 == X.length());
+
+            ASSERT(bsl::string("b") == X.front()->fixedFields().message());
+            mX.popFront();
+            ASSERT(bsl::string("c1") == X.front()->fixedFields().message());
+            mX.popFront();
+            ASSERT(bsl::string("c2") == X.front()->fixedFields().message());
+
+            mX.endSequence();
+
+            // 'c2' and 'd' remain; records merged later follow them, whatever
+            // their timestamps.
+
+            ASSERT(0 == mX.pushBack(makeRecord(0, "z", &ra)));
+            ASSERT(0 == mX.pushBack(makeRecord(9, "y", &ra)));
+
+            ASSERTV(X.length(), 4 == X.length());
+
+            mX.beginSequence();
+
+            const char *EXPECTED[] = { "c2", "d", "z", "y" };
+            for (int i = 0; i < 4; ++i) {
+                ASSERTV(i, X.front()->fixedFields().message(),
+                        bsl::string(EXPECTED[i]) ==
+                                          X.front()->fixedFields().message());
+                mX.popFront();
+            }
+            ASSERT(0 == X.length());
+            ASSERT(0 == X.totalSize());
+
+            mX.endSequence();
+
+            mX.pushBack(makeRecord(0, "held", &ra));
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        ASSERTV(ra.numBlocksInUse(), 0 == ra.numBlocksInUse());
+        ASSERTV(da.numBlocksInUse(), 0 == da.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Push a few records, publish them in a sequence as 'ball::Logger'
+        //:   does, and verify the order.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("test", veryVerbose);
+
+        Obj mX(1 << 20, &ta);  const Obj& X = mX;
+
+        mX.pushBack(makeRecord(2, "second", &ta));
+        mX.pushBack(makeRecord(1, "first", &ta));
+        mX.pushBack(makeRecord(3, "third", &ta));
+
+        mX.beginSequence();
+        ASSERT(3 == X.length());
+        ASSERT(bsl::string("first") == X.front()->fixedFields().message());
+        mX.popFront();
+        ASSERT(bsl::string("third") == X.back()->fixedFields().message());
+        mX.popBack();
+        ASSERT(bsl::string("second") == X.front()->fixedFields().message());
+        mX.popFront();
+        ASSERT(0 == X.length());
+        mX.endSequence();
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 Concurrent 'pushBack' calls are cheaper than those of
+        //:   'ball::FixedSizeRecordBuffer', increasingly so as the number of
+        //:   threads grows.
+        //
+        // Plan:
+        //: 1 For 1, 2, 4, and 8 threads, push the same record repeatedly to
+        //:   a 'ball::PerThreadRecordBuffer' and to a
+        //:   'ball::FixedSizeRecordBuffer', and report the time per push.  The
+        //:   number of pushes per thread may be supplied as the second
+        //:   argument (default 1000000).
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        const int NUM_PUSHES = argc > 2 && 0 < bsl::atoi(argv[2])
+                             ? bsl::atoi(argv[2])
+                             : 1000000;
+
+        bslma::Allocator *allocator = bslma::Default::globalAllocator();
+
+        const Handle handle = makeRecord(0, "a typical trace message",
+                                         allocator);
+
+        for (int numThreads = 1; numThreads <= 8; numThreads *= 2) {
+            double perThreadTime;
+            double fixedSizeTime;
+            {
+                ball::PerThreadRecordBuffer buffer(1 << 20, allocator);
+                bslmt::Barrier              barrier(numThreads + 1);
+                bslmt::ThreadGroup          threads;
+
+                threads.addThreads(
+                      bdlf::BindUtil::bind(
+                                 &pushRecords<ball::PerThreadRecordBuffer>,
+                                 &buffer,
+                                 handle,
+                                 NUM_PUSHES,
+                                 &barrier),
+                      numThreads);
+
+                bsls::Stopwatch timer;
+                barrier.wait();
+                timer.start();
+                threads.joinAll();
+                timer.stop();
+                perThreadTime = timer.elapsedTime();
+            }
+            {
+                ball::FixedSizeRecordBuffer buffer(1 << 20, allocator);
+                bslmt::Barrier              barrier(numThreads + 1);
+                bslmt::ThreadGroup          threads;
+
+                threads.addThreads(
+                      bdlf::BindUtil::bind(
+                                 &pushRecords<ball::FixedSizeRecordBuffer>,
+                                 &buffer,
+                                 handle,
+                                 NUM_PUSHES,
+                                 &barrier),
+                      numThreads);
+
+                bsls::Stopwatch timer;
+                barrier.wait();
+                timer.start();
+                threads.joinAll();
+                timer.stop();
+                fixedSizeTime = timer.elapsedTime();
+            }
+
+            const double numPushes = static_cast<double>(NUM_PUSHES)
+                                   * numThreads;
+            cout << numThreads << " thread(s): "
+                 << "PerThreadRecordBuffer "
+                 << perThreadTime / numPushes * 1e9 << " ns/push, "
+                 << "FixedSizeRecordBuffer "
+                 << fixedSizeTime / numPushes * 1e9 << " ns/push" << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -15,6 +15,9 @@ BSLS_IDENT_RCSID(ball_recordattributes_cpp,"$Id$ $CSID$")
 #include <bdlb_print.h>
 
 #include <bslma_default.h>
+
+#include <bslmt_threadutil.h>
+
 #include <bsls_assert.h>
 
 #include <bsl_cstring.h>
@@ -37,6 +40,7 @@ RecordAttributes::RecordAttributes(bslma::Allocator *basicAllocator)
 , d_category(basicAllocator)
 , d_severity(0)
 , d_messageStreamBuf(basicAllocator)
+, d_deferred_p(0)
 {
 }
 
@@ -57,6 +61,7 @@ RecordAttributes::RecordAttributes(const bdlt::Datetime&  timestamp,
 , d_category(category, basicAllocator)
 , d_severity(severity)
 , d_messageStreamBuf(basicAllocator)
+, d_deferred_p(0)
 {
     setMessage(message);
 }
@@ -71,15 +76,37 @@ RecordAttributes::RecordAttributes(const RecordAttributes&  original,
 , d_category(original.d_category, basicAllocator)
 , d_severity(original.d_severity)
 , d_messageStreamBuf(basicAllocator)
+, d_deferred_p(0)
 {
+    original.formatDeferredMessage();
+
     d_messageStreamBuf.pubseekpos(0);
     d_messageStreamBuf.sputn(original.d_messageStreamBuf.data(),
                              original.d_messageStreamBuf.length());
 }
 
+RecordAttributes::~RecordAttributes()
+{
+    if (d_deferred_p) {
+        d_category.get_allocator().mechanism()->deleteObject(d_deferred_p);
+    }
+}
+
+// PRIVATE MANIPULATORS
+RecordAttributes::DeferredRep *RecordAttributes::deferredRep()
+{
+    if (!d_deferred_p) {
+        d_deferred_p = new (*d_category.get_allocator().mechanism())
+                                                                 DeferredRep();
+    }
+    return d_deferred_p;
+}
+
 // MANIPULATORS
 void RecordAttributes::setMessage(const char *message)
 {
+    clearMessage();
+
     d_messageStreamBuf.pubseekpos(0);
     while (*message) {
         d_messageStreamBuf.sputc(*message);
@@ -90,6 +117,9 @@ void RecordAttributes::setMessage(const char *message)
 RecordAttributes& RecordAttributes::operator=(const RecordAttributes& rhs)
 {
     if (this != &rhs) {
+        rhs.formatDeferredMessage();
+        clearMessage();
+
         d_timestamp  = rhs.d_timestamp;
         d_processID  = rhs.d_processID;
         d_threadID   = rhs.d_threadID;
@@ -104,9 +134,36 @@ RecordAttributes& RecordAttributes::operator=(const RecordAttributes& rhs)
     return *this;
 }
 
+// PRIVATE ACCESSORS
+void RecordAttributes::formatPendingMessage() const
+{
+    BSLS_ASSERT(d_deferred_p);
+
+    if (e_DEFERRED_PENDING == d_deferred_p->d_state.testAndSwap(
+                                                    e_DEFERRED_PENDING,
+                                                    e_DEFERRED_FORMATTING)) {
+        bdlsb::MemOutStreamBuf& streamBuf =
+            const_cast<RecordAttributes *>(this)->d_messageStreamBuf;
+
+        streamBuf.pubseekpos(0);
+        d_deferred_p->d_message.formatMessage(&streamBuf);
+
+        d_deferred_p->d_state.storeRelease(e_NO_DEFERRED_MESSAGE);
+        return;                                                       // RETURN
+    }
+
+    // Another thread is formatting the message: wait until it is done.
+
+    while (e_NO_DEFERRED_MESSAGE != d_deferred_p->d_state.loadAcquire()) {
+        bslmt::ThreadUtil::yield();
+    }
+}
+
 // ACCESSORS
 const char *RecordAttributes::message() const
 {
+    formatDeferredMessage();
+
     const bsl::size_t length = d_messageStreamBuf.length();
     if (0 == length || '\0' != *(d_messageStreamBuf.data() + length - 1)) {
         // Null terminate the string.
@@ -122,6 +179,8 @@ const char *RecordAttributes::message() const
 
 bslstl::StringRef RecordAttributes::messageRef() const
 {
+    formatDeferredMessage();
+
     const bsl::size_t length = d_messageStreamBuf.length();
     const char *str = d_messageStreamBuf.data();
 #if defined(BSLS_PLATFORM_OS_SOLARIS) || defined(BSLS_PLATFORM_OS_SUNOS)
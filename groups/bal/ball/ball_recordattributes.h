@@ -54,6 +54,19 @@ BSLS_IDENT("$Id: $")
 // the values given to the respective attributes by the default constructor of
 // 'ball::RecordAttributes'.
 //
+///Deferred Messages
+///-----------------
+// The message attribute may also be set to a *deferred* message (see
+// 'ball_deferredmessage'): a 'printf'-style format string and captured
+// arguments, whose formatting is postponed until the message attribute is
+// first read (by 'message', 'messageRef', or either 'messageStreamBuf'
+// method), or until 'formatDeferredMessage' is called.  This allows the
+// thread creating a record to leave the cost of formatting its message to
+// the thread that publishes it (e.g., the publication thread of a
+// 'ball::AsyncFileObserver').  A deferred message is formatted exactly once,
+// even if the message attribute is first read concurrently by several
+// threads, each of which observes the formatted message.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -171,6 +184,8 @@ BSLS_IDENT("$Id: $")
 
 #include <balscm_version.h>
 
+#include <ball_deferredmessage.h>
+
 #include <bdlsb_memoutstreambuf.h>
 
 #include <bdlt_datetime.h>
@@ -180,6 +195,8 @@ BSLS_IDENT("$Id: $")
 
 #include <bslmf_nestedtraitdeclaration.h>
 
+#include <bsls_atomic.h>
+#include <bsls_compilerfeatures.h>
 #include <bsls_performancehint.h>
 #include <bsls_platform.h>
 #include <bsls_types.h>
@@ -227,6 +244,24 @@ class RecordAttributes {
                                                // (and not rewound)
     };
 
+    enum DeferredState {
+        // This enumeration defines the states of the deferred message.
+
+        e_NO_DEFERRED_MESSAGE = 0,  // no deferred message, or formatted
+        e_DEFERRED_PENDING    = 1,  // deferred message not yet formatted
+        e_DEFERRED_FORMATTING = 2   // deferred message being formatted
+    };
+
+    struct DeferredRep {
+        // This 'struct' holds a deferred message and the state of its
+        // formatting.  It is allocated the first time a deferred message is
+        // set, so that the attributes of a record that never has one do not
+        // pay for its storage.
+
+        DeferredMessage d_message;  // deferred message, if any
+        bsls::AtomicInt d_state;    // 'DeferredState' value
+    };
+
     // DATA
     bdlt::Datetime   d_timestamp;    // creation date and time
     int              d_processID;    // process id of creator
@@ -239,6 +274,21 @@ class RecordAttributes {
     bdlsb::MemOutStreamBuf d_messageStreamBuf;  // stream buffer associated
                                                 // with the message attribute
 
+    DeferredRep     *d_deferred_p;              // deferred message, or 0 if
+                                                // none was ever set (owned)
+
+    // PRIVATE MANIPULATORS
+    DeferredRep *deferredRep();
+        // Return the address of the deferred message representation of this
+        // object, allocating it if necessary.
+
+    // PRIVATE ACCESSORS
+    void formatPendingMessage() const;
+        // Format the deferred message of this object into the message
+        // attribute if no other thread is doing so, and wait until it is
+        // formatted otherwise.  The behavior is undefined unless this object
+        // has (or, concurrently, had) a deferred message.
+
     // FRIENDS
     friend bool operator==(const RecordAttributes&, const RecordAttributes&);
 
@@ -277,7 +327,7 @@ class RecordAttributes {
         // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
         // the currently installed default allocator is used.
 
-    //! ~RecordAttributes() = default;
+    ~RecordAttributes();
         // Destroy this record attributes object.
 
     // MANIPULATORS
@@ -291,7 +341,9 @@ class RecordAttributes {
 
     bdlsb::MemOutStreamBuf& messageStreamBuf();
         // Return a reference to the modifiable stream buffer associated with
-        // the message attribute of this record attributes object.
+        // the message attribute of this record attributes object.  If this
+        // object has a deferred message, it is first formatted into the
+        // message attribute.
 
     void setCategory(const char *category);
         // Set the category attribute of this record attributes object to the
@@ -305,6 +357,31 @@ class RecordAttributes {
         // Set the line number attribute of this record attributes object to
         // the specified 'lineNumber'.
 
+    void setDeferredMessage(const DeferredMessage& message);
+        // Set the message attribute of this record attributes object to the
+        // specified deferred 'message', to be formatted when the message
+        // attribute is first read (see {Deferred Messages}).  Note that, if
+        // 'message' is not self-contained (see 'ball_deferredmessage'), it
+        // must be formatted before the arguments it holds by address are
+        // modified or destroyed.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+    template <class... ARGS>
+    int setDeferredMessage(const char *format, const ARGS&... arguments);
+        // Set the message attribute of this record attributes object to the
+        // deferred message having the specified 'printf'-style 'format' and
+        // 'arguments', to be formatted when the message attribute is first
+        // read (see {Deferred Messages}).  'format' is held by address, and
+        // must remain valid until the message is formatted (see
+        // 'ball_deferredmessage').  Return 0 on success, and a non-zero value
+        // if a string argument is too long to be copied into the deferred
+        // message, which then holds it by address, in which case the message
+        // must be formatted (e.g., by 'formatDeferredMessage') before that
+        // argument is modified or destroyed.  This method fails to compile
+        // unless each argument has a type supported by
+        // 'ball::DeferredMessage'.
+#endif
+
     void setMessage(const char *message);
         // Set the message attribute of this record attributes object to the
         // specified (non-null) 'message'.
@@ -332,6 +409,17 @@ class RecordAttributes {
     const char *fileName() const;
         // Return the filename attribute of this record attributes object.
 
+    void formatDeferredMessage() const;
+        // Format the deferred message of this record attributes object, if
+        // any, into its message attribute (see {Deferred Messages}).  Note
+        // that the accessors of the message attribute call this method, so
+        // that calling it explicitly is needed only to control the thread on
+        // which a deferred message is formatted.
+
+    bool hasDeferredMessage() const;
+        // Return 'true' if this record attributes object has a deferred
+        // message that has not yet been formatted, and 'false' otherwise.
+
     int lineNumber() const;
         // Return the line number attribute of this record attributes object.
 
@@ -358,7 +446,9 @@ class RecordAttributes {
 
     const bdlsb::MemOutStreamBuf& messageStreamBuf() const;
         // Return a reference to the non-modifiable stream buffer associated
-        // with the message attribute of this record attributes object.
+        // with the message attribute of this record attributes object.  If
+        // this object has a deferred message, it is first formatted into the
+        // message attribute.
 
     bsl::ostream& print(bsl::ostream& stream,
                         int           level = 0,
@@ -407,6 +497,10 @@ bsl::ostream& operator<<(bsl::ostream& stream, const RecordAttributes& object);
 inline
 void RecordAttributes::clearMessage()
 {
+    if (d_deferred_p) {
+        d_deferred_p->d_state.storeRelaxed(e_NO_DEFERRED_MESSAGE);
+    }
+
     // Note that the stream buffer holding the message attribute has initial
     // capacity of 256 bytes (by implementation).  Reset those stream buffers
     // that are bigger than the default and "rewind" those that are smaller or
@@ -424,9 +518,36 @@ void RecordAttributes::clearMessage()
 inline
 bdlsb::MemOutStreamBuf& RecordAttributes::messageStreamBuf()
 {
+    formatDeferredMessage();
     return d_messageStreamBuf;
 }
 
+inline
+void RecordAttributes::setDeferredMessage(const DeferredMessage& message)
+{
+    clearMessage();
+
+    DeferredRep *rep = deferredRep();
+    rep->d_message = message;
+    rep->d_state.storeRelease(e_DEFERRED_PENDING);
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+template <class... ARGS>
+inline
+int RecordAttributes::setDeferredMessage(const char     *format,
+                                         const ARGS&...  arguments)
+{
+    clearMessage();
+
+    DeferredRep *rep = deferredRep();
+    const int    rc  = rep->d_message.capture(format, arguments...);
+    rep->d_state.storeRelease(e_DEFERRED_PENDING);
+
+    return rc;
+}
+#endif
+
 inline
 void RecordAttributes::setCategory(const char *category)
 {
@@ -482,6 +603,22 @@ const char *RecordAttributes::fileName() const
     return d_fileName.c_str();
 }
 
+inline
+void RecordAttributes::formatDeferredMessage() const
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(hasDeferredMessage())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        formatPendingMessage();
+    }
+}
+
+inline
+bool RecordAttributes::hasDeferredMessage() const
+{
+    return d_deferred_p
+        && e_NO_DEFERRED_MESSAGE != d_deferred_p->d_state.loadAcquire();
+}
+
 inline
 int RecordAttributes::lineNumber() const
 {
@@ -509,6 +646,7 @@ bsls::Types::Uint64 RecordAttributes::threadID() const
 inline
 const bdlsb::MemOutStreamBuf& RecordAttributes::messageStreamBuf() const
 {
+    formatDeferredMessage();
     return d_messageStreamBuf;
 }
 
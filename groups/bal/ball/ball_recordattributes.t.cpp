@@ -19,10 +19,13 @@
 #include <bslma_testallocator.h>
 #include <bslma_testallocatorexception.h>
 
+#include <bslmt_threadutil.h>
+
 #include <bslmf_assert.h>
 
 #include <bsls_assert.h>
 #include <bsls_asserttest.h>
+#include <bsls_compilerfeatures.h>
 #include <bsls_platform.h>
 #include <bsls_types.h>
 
@@ -90,6 +93,10 @@ using namespace bsl;
 // [ 2] const bdlt::Datetime& timestamp() const;
 // [ 2] void clearMessage();
 // [ 2] bdlsb::MemOutStreamBuf& messageStreamBuf();
+// [ 6] void setDeferredMessage(const DeferredMessage& message);
+// [ 6] int setDeferredMessage(const char *format, const ARGS&... args);
+// [ 6] void formatDeferredMessage() const;
+// [ 6] bool hasDeferredMessage() const;
 // [ 3] ostream& print(ostream& os, int level = 0, int spl = 4) const;
 //
 // [ 2] bool operator==(const Obj& lhs, const Obj& rhs);
@@ -99,6 +106,7 @@ using namespace bsl;
 // [ 1] BREATHING TEST
 // [ 5] USAGE EXAMPLE 1
 // [ 6] USAGE EXAMPLE 2
+// [ 6] CONCERN: a deferred message is formatted once by concurrent reads
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -310,6 +318,15 @@ void initRecordAttributes(ball::RecordAttributes&    lhs,
     ASSERT(OBJ.threadID()   == ORA.threadID);                       \
     ASSERT(OBJ.timestamp()  == ORA.timestamp);
 
+extern "C" void *readDeferredMessage(void *arg)
+    // Read the message attribute of the 'ball::RecordAttributes' object at
+    // the specified 'arg', and return the address of the message.
+{
+    const ball::RecordAttributes *attributes =
+                              static_cast<const ball::RecordAttributes *>(arg);
+    return const_cast<char *>(attributes->message());
+}
+
 //=============================================================================
 //                              MAIN PROGRAM
 //-----------------------------------------------------------------------------
@@ -326,6 +343,210 @@ int main(int argc, char *argv[])
     bslma::TestAllocator testAllocator(veryVeryVerbose);
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING DEFERRED MESSAGES
+        //
+        // Concerns:
+        //   1. A deferred message is not formatted by 'setDeferredMessage',
+        //      and is formatted by the first call to any accessor of the
+        //      message attribute, or to 'formatDeferredMessage'.
+        //   2. 'setMessage' and 'clearMessage' discard a deferred message.
+        //   3. Copies and comparisons observe the formatted message.
+        //   4. A deferred message read concurrently by several threads is
+        //      formatted exactly once, and every reader observes the complete
+        //      message.
+        //   5. The storage of a deferred message is allocated from the object
+        //      allocator when the first deferred message is set, and not
+        //      before.
+        //   6. 'setDeferredMessage' reports a string argument that is too
+        //      long to be copied, and the message is formatted in full.
+        //
+        // Plan:
+        //   Set deferred messages, and verify 'hasDeferredMessage' and the
+        //   message attribute after each operation.  Read the message of an
+        //   object from several threads at once, and verify the message
+        //   read by each thread.  Monitor the object allocator while
+        //   messages are set.  Set a deferred message having a string
+        //   argument longer than 'ball::DeferredMessage::k_STRING_CAPACITY',
+        //   and verify the returned status and the formatted message.
+        //
+        // Testing:
+        //   void setDeferredMessage(const DeferredMessage& message);
+        //   int setDeferredMessage(const char *format, const ARGS&... args);
+        //   void formatDeferredMessage() const;
+        //   bool hasDeferredMessage() const;
+        //   CONCERN: a deferred message is formatted once by concurrent reads
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "Testing Deferred Messages" << endl
+                                  << "=========================" << endl;
+
+        ball::DeferredMessage message;
+        message.reset("%s=%d");
+        message.appendArgument("x");
+        message.appendArgument(1);
+
+        if (veryVerbose) cout << "\tFormatting by each accessor." << endl;
+        {
+            Obj mX(&testAllocator);  const Obj& X = mX;
+            ASSERT(false == X.hasDeferredMessage());
+
+            mX.setDeferredMessage(message);
+            ASSERT(true  == X.hasDeferredMessage());
+            ASSERT(0     == strcmp("x=1", X.message()));
+            ASSERT(false == X.hasDeferredMessage());
+            ASSERT(0     == strcmp("x=1", X.message()));
+
+            mX.setDeferredMessage(message);
+            ASSERT("x=1" == X.messageRef());
+            ASSERT(false == X.hasDeferredMessage());
+
+            mX.setDeferredMessage(message);
+            ASSERT(3     == X.messageStreamBuf().length());
+            ASSERT(false == X.hasDeferredMessage());
+
+            mX.setDeferredMessage(message);
+            ASSERT(3     == mX.messageStreamBuf().length());
+            ASSERT(false == X.hasDeferredMessage());
+
+            mX.setDeferredMessage(message);
+            X.formatDeferredMessage();
+            ASSERT(false == X.hasDeferredMessage());
+            ASSERT(0     == strcmp("x=1", X.message()));
+        }
+
+        if (veryVerbose) cout << "\tAllocating on demand." << endl;
+        {
+            bslma::TestAllocator oa("object", veryVeryVerbose);
+
+            Obj mX(&oa);  const Obj& X = mX;
+            mX.setMessage("plain");
+            ASSERT("plain" == X.messageRef());
+
+            const bsls::Types::Int64 NUM_BLOCKS = oa.numBlocksTotal();
+
+            mX.setDeferredMessage(message);
+            ASSERT(NUM_BLOCKS + 1 == oa.numBlocksTotal());
+            ASSERT("x=1" == X.messageRef());
+
+            mX.setDeferredMessage(message);
+            ASSERT(NUM_BLOCKS + 1 == oa.numBlocksTotal());
+            ASSERT("x=1" == X.messageRef());
+
+            // A copy does not allocate storage for a deferred message.
+
+            bslma::TestAllocator plainAllocator("plain", veryVeryVerbose);
+            bslma::TestAllocator copyAllocator("copy", veryVeryVerbose);
+
+            Obj mW(&oa);  const Obj& W = mW;
+            mW.setMessage("x=1");
+            Obj mV(W, &plainAllocator);
+
+            mX.setDeferredMessage(message);
+            Obj mY(X, &copyAllocator);  const Obj& Y = mY;
+            ASSERT("x=1" == Y.messageRef());
+            ASSERT(plainAllocator.numBlocksTotal() ==
+                                             copyAllocator.numBlocksTotal());
+        }
+
+        if (veryVerbose) cout << "\tDiscarding." << endl;
+        {
+            Obj mX(&testAllocator);  const Obj& X = mX;
+
+            mX.setDeferredMessage(message);
+            mX.setMessage("plain");
+            ASSERT(false == X.hasDeferredMessage());
+            ASSERT(0     == strcmp("plain", X.message()));
+
+            mX.setDeferredMessage(message);
+            mX.clearMessage();
+            ASSERT(false == X.hasDeferredMessage());
+            ASSERT(0     == strcmp("", X.message()));
+        }
+
+        if (veryVerbose) cout << "\tCopying and comparing." << endl;
+        {
+            Obj mX(&testAllocator);  const Obj& X = mX;
+            Obj mZ(&testAllocator);  const Obj& Z = mZ;
+            mZ.setMessage("x=1");
+
+            mX.setDeferredMessage(message);
+            ASSERT(Z == X);
+            ASSERT(false == X.hasDeferredMessage());
+
+            mX.setDeferredMessage(message);
+            Obj mY(X, &testAllocator);  const Obj& Y = mY;
+            ASSERT(false == Y.hasDeferredMessage());
+            ASSERT(Z == Y);
+
+            mX.setDeferredMessage(message);
+            mY.setDeferredMessage(message);
+            mY = X;
+            ASSERT(false == Y.hasDeferredMessage());
+            ASSERT(Z == Y);
+        }
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+        if (veryVerbose) cout << "\tCapturing arguments." << endl;
+        {
+            Obj mX(&testAllocator);  const Obj& X = mX;
+
+            char buffer[8] = "abc";
+            mX.setDeferredMessage("%s %d %.1f", buffer, 2, 3.0);
+            buffer[0] = 'X';
+            ASSERT(true == X.hasDeferredMessage());
+            ASSERT(0    == strcmp("abc 2 3.0", X.message()));
+        }
+
+        if (veryVerbose) cout << "\tCapturing a long string." << endl;
+        {
+            Obj mX(&testAllocator);  const Obj& X = mX;
+
+            const bsl::string LONG(ball::DeferredMessage::k_STRING_CAPACITY,
+                                   'a');
+
+            ASSERT(0 == mX.setDeferredMessage("%s|%d", "short", 1));
+            ASSERT("short|1" == X.messageRef());
+
+            ASSERT(0 != mX.setDeferredMessage("%s|%d", LONG.c_str(), 2));
+            ASSERT(true == X.hasDeferredMessage());
+            X.formatDeferredMessage();
+            ASSERT(LONG + "|2" == X.messageRef());
+        }
+#endif
+
+        if (veryVerbose) cout << "\tConcurrent readers." << endl;
+        {
+            enum { k_NUM_THREADS = 8, k_NUM_ITERATIONS = 200 };
+
+            ball::DeferredMessage longMessage;
+            longMessage.reset("%300s|%d");
+            longMessage.appendArgument("end");
+            longMessage.appendArgument(42);
+
+            const bsl::string EXPECTED = bsl::string(297, ' ') + "end|42";
+
+            for (int i = 0; i < k_NUM_ITERATIONS; ++i) {
+                Obj mX(&testAllocator);  const Obj& X = mX;
+                mX.setDeferredMessage(longMessage);
+
+                bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+                for (int j = 0; j < k_NUM_THREADS; ++j) {
+                    ASSERT(0 == bslmt::ThreadUtil::create(
+                                        &handles[j],
+                                        readDeferredMessage,
+                                        const_cast<Obj *>(&X)));
+                }
+                for (int j = 0; j < k_NUM_THREADS; ++j) {
+                    void *result;
+                    ASSERT(0 == bslmt::ThreadUtil::join(handles[j], &result));
+                    ASSERTV(i, j, EXPECTED == static_cast<char *>(result));
+                }
+                ASSERT(EXPECTED == X.message());
+            }
+        }
+      } break;
       case 5: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE 2
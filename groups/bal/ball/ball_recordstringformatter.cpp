@@ -13,6 +13,14 @@
 // significant performance overhead.  For this reason, the 'operator()' method
 // is implemented by writing the formatted string to a buffer before inserting
 // to a stream.
+//
+// The ISO 8601 timestamps ('%i', '%I', and '%O') are generated at microsecond
+// precision by a 'bdlt::CachingDatetimeFormatter', which regenerates only the
+// fractional second of timestamps falling in the same second as the previous
+// one, and are truncated as needed.  As 'operator()' may be called
+// concurrently, the formatter is used only if its mutex is acquired by
+// 'tryLock', and the timestamp is generated by 'bdlt::Iso8601Util' otherwise,
+// so that threads never wait for one another.
 
 #include <ball_recordstringformatter.h>
 
@@ -29,6 +37,7 @@ BSLS_IDENT_RCSID(ball_recordstringformatter_cpp,"$Id$ $CSID$")
 
 #include <bdlma_bufferedsequentialallocator.h>
 
+#include <bdlt_cachingdatetimeformatter.h>
 #include <bdlt_datetime.h>
 #include <bdlt_currenttime.h>
 #include <bdlt_localtimeoffset.h>
@@ -116,6 +125,17 @@ static void appendToStringAsHex(bsl::string *result, bsls::Types::Uint64 value)
     *result += buffer;
 }
 
+static bdlt::Iso8601UtilConfiguration
+iso8601TimestampConfiguration()
+    // Return the configuration of the ISO 8601 timestamps generated before
+    // being truncated to the precision of a '%i', '%I', or '%O' conversion.
+{
+    bdlt::Iso8601UtilConfiguration config;
+    config.setFractionalSecondPrecision(6);
+    config.setUseZAbbreviationForUtc(true);
+    return config;
+}
+
 namespace ball {
 
                         // ---------------------------
@@ -134,6 +154,7 @@ const int RecordStringFormatter::k_DISABLE_PUBLISH_IN_LOCALTIME = INT_MIN;
 RecordStringFormatter::RecordStringFormatter(bslma::Allocator *basicAllocator)
 : d_formatSpec(DEFAULT_FORMAT_SPEC, basicAllocator)
 , d_timestampOffset(0)
+, d_iso8601Formatter(iso8601TimestampConfiguration())
 {
 }
 
@@ -141,6 +162,7 @@ RecordStringFormatter::RecordStringFormatter(const char       *format,
                                              bslma::Allocator *basicAllocator)
 : d_formatSpec(format, basicAllocator)
 , d_timestampOffset(0)
+, d_iso8601Formatter(iso8601TimestampConfiguration())
 {
 }
 
@@ -149,6 +171,7 @@ RecordStringFormatter::RecordStringFormatter(
                                  bslma::Allocator              *basicAllocator)
 : d_formatSpec(DEFAULT_FORMAT_SPEC, basicAllocator)
 , d_timestampOffset(offset)
+, d_iso8601Formatter(iso8601TimestampConfiguration())
 {
 }
 
@@ -163,6 +186,7 @@ RecordStringFormatter::RecordStringFormatter(
                     publishInLocalTime
                     ?  k_ENABLE_PUBLISH_IN_LOCALTIME
                     : k_DISABLE_PUBLISH_IN_LOCALTIME)
+, d_iso8601Formatter(iso8601TimestampConfiguration())
 {
 }
 
@@ -172,6 +196,7 @@ RecordStringFormatter::RecordStringFormatter(
                                  bslma::Allocator              *basicAllocator)
 : d_formatSpec(format, basicAllocator)
 , d_timestampOffset(offset)
+, d_iso8601Formatter(iso8601TimestampConfiguration())
 {
 }
 
@@ -187,6 +212,7 @@ RecordStringFormatter::RecordStringFormatter(
                     publishInLocalTime
                     ?  k_ENABLE_PUBLISH_IN_LOCALTIME
                     : k_DISABLE_PUBLISH_IN_LOCALTIME)
+, d_iso8601Formatter(iso8601TimestampConfiguration())
 {
 }
 
@@ -195,6 +221,7 @@ RecordStringFormatter::RecordStringFormatter(
                                   bslma::Allocator             *basicAllocator)
 : d_formatSpec(original.d_formatSpec, basicAllocator)
 , d_timestampOffset(original.d_timestampOffset)
+, d_iso8601Formatter(iso8601TimestampConfiguration())
 {
 }
 
@@ -276,35 +303,34 @@ void RecordStringFormatter::operator()(bsl::ostream& stream,
               case 'I': BSLS_ANNOTATION_FALLTHROUGH;
               case 'O': BSLS_ANNOTATION_FALLTHROUGH;
               case 'i': {
-                // Use ISO8601 "extended" format.
-
-                const int fractionalSecondPrecision = 'O' == *iter ? 6 : 3;
-
-                bdlt::Iso8601UtilConfiguration config;
-                config.setFractionalSecondPrecision(fractionalSecondPrecision);
-                config.setUseZAbbreviationForUtc(true);
+                // Use ISO8601 "extended" format, generated with microseconds
+                // and truncated to the precision of the conversion.
 
-                char buffer[bdlt::Iso8601Util::k_DATETIMETZ_STRLEN + 1];
+                enum { k_DECIMAL_SIGN_OFFSET = 19,
+                       k_TZINFO_OFFSET       = k_DECIMAL_SIGN_OFFSET + 7 };
 
-                int outputLength = bdlt::Iso8601Util::generateRaw(buffer,
-                                                                  timestamp,
-                                                                  config);
+                char buffer[bdlt::Iso8601Util::k_DATETIMETZ_STRLEN];
+                int  outputLength;
 
-                if ('i' == *iter) {
-                    // Remove milliseconds part.
-
-                    enum { k_DECIMAL_SIGN_OFFSET = 19,
-                           k_TZINFO_OFFSET       = k_DECIMAL_SIGN_OFFSET + 4 };
-                    bslstl::StringRef head(buffer, k_DECIMAL_SIGN_OFFSET);
-
-                    bslstl::StringRef tail(buffer + k_TZINFO_OFFSET,
-                                           outputLength - k_TZINFO_OFFSET);
-
-                    output += head + tail;
+                if (0 == d_iso8601FormatterMutex.tryLock()) {
+                    outputLength = d_iso8601Formatter.generateRaw(buffer,
+                                                                  timestamp);
+                    d_iso8601FormatterMutex.unlock();
                 }
                 else {
-                    output.append(buffer, outputLength);
+                    outputLength = bdlt::Iso8601Util::generateRaw(
+                                             buffer,
+                                             timestamp,
+                                             iso8601TimestampConfiguration());
                 }
+
+                const int headLength = k_DECIMAL_SIGN_OFFSET
+                                     + ('O' == *iter ? 7
+                                                     : 'I' == *iter ? 4 : 0);
+
+                output.append(buffer, headLength);
+                output.append(buffer + k_TZINFO_OFFSET,
+                              outputLength - k_TZINFO_OFFSET);
               } break;
               case 'p': {
                 appendToString(&output, fixedFields.processID());
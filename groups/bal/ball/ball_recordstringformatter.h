@@ -129,6 +129,7 @@ BSLS_IDENT("$Id: $")
 
 #include <balscm_version.h>
 
+#include <bdlt_cachingdatetimeformatter.h>
 #include <bdlt_datetimeinterval.h>
 
 #include <bslma_allocator.h>
@@ -136,6 +137,8 @@ BSLS_IDENT("$Id: $")
 
 #include <bslmf_nestedtraitdeclaration.h>
 
+#include <bslmt_mutex.h>
+
 #include <bsl_iosfwd.h>
 #include <bsl_string.h>
 
@@ -181,6 +184,16 @@ class RecordStringFormatter {
     bsl::string            d_formatSpec;       // 'printf'-style format spec.
     bdlt::DatetimeInterval d_timestampOffset;  // offset added to timestamps
 
+    mutable bdlt::CachingDatetimeFormatter
+                           d_iso8601Formatter; // ISO 8601 timestamp formatter
+                                               // (microseconds, with 'Z')
+                                               // shared by '%i', '%I', and
+                                               // '%O'; not part of the value
+
+    mutable bslmt::Mutex   d_iso8601FormatterMutex;
+                                               // serializes the use of
+                                               // 'd_iso8601Formatter'
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(RecordStringFormatter,
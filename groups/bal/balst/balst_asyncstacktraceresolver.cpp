@@ -0,0 +1,306 @@
+// balst_asyncstacktraceresolver.cpp                                  -*-C++-*-
+#include <balst_asyncstacktraceresolver.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(balst_asyncstacktraceresolver_cpp,"$Id$ $CSID$")
+
+#include <balst_cachedstacktraceutil.h>
+
+#include <bdlf_memfn.h>
+
+#include <bslma_default.h>
+
+#include <bslmt_lockguard.h>
+#include <bslmt_threadattributes.h>
+
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+#include <bsls_stackaddressutil.h>
+
+#if defined(BSLS_PLATFORM_OS_WINDOWS) && defined(BDE_BUILD_TARGET_OPT)
+// 'getStackAddresses' will not be able to trace through our stack frames if
+// we're optimized on Windows
+
+#pragma optimize("", off)
+#endif
+
+namespace BloombergLP {
+namespace balst {
+
+                  // --------------------------------------
+                  // struct AsyncStackTraceResolver::Request
+                  // --------------------------------------
+
+// CREATORS
+AsyncStackTraceResolver::Request::Request(bslma::Allocator *basicAllocator)
+: d_addresses(basicAllocator)
+, d_callback(bsl::allocator_arg_t(),
+             bsl::allocator<Callback>(basicAllocator))
+{
+}
+
+AsyncStackTraceResolver::Request::Request(const Request&    original,
+                                          bslma::Allocator *basicAllocator)
+: d_addresses(original.d_addresses, basicAllocator)
+, d_callback(bsl::allocator_arg_t(),
+             bsl::allocator<Callback>(basicAllocator),
+             original.d_callback)
+{
+}
+
+                       // -----------------------------
+                       // class AsyncStackTraceResolver
+                       // -----------------------------
+
+// PRIVATE MANIPULATORS
+void AsyncStackTraceResolver::enqueue(Request *request)
+{
+    BSLS_ASSERT(request);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    d_requests.emplace_back();
+    d_requests.back().d_addresses.swap(request->d_addresses);
+    d_requests.back().d_callback.swap(request->d_callback);
+
+    d_requestCondition.signal();
+}
+
+void AsyncStackTraceResolver::resolutionThreadEntryPoint()
+{
+    Request    request(d_allocator_p);
+    StackTrace stackTrace(d_allocator_p);
+
+    while (true) {
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+            while (d_requests.empty() && !d_stopping) {
+                d_requestCondition.wait(&d_mutex);
+            }
+
+            if (d_requests.empty()) {
+                // 'stop' was called, and all requests are resolved.
+
+                return;                                               // RETURN
+            }
+
+            request.d_addresses.swap(d_requests.front().d_addresses);
+            request.d_callback.swap(d_requests.front().d_callback);
+            d_requests.pop_front();
+            d_numBusy = 1;
+        }
+
+        const int rc = CachedStackTraceUtil::loadStackTraceFromAddressArray(
+                                  &stackTrace,
+                                  request.d_addresses.data(),
+                                  static_cast<int>(request.d_addresses.size()),
+                                  d_demanglingPreferredFlag);
+
+        request.d_callback(stackTrace, rc);
+
+        request.d_addresses.clear();
+        request.d_callback = Callback();
+        stackTrace.removeAll();
+
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+            d_numBusy = 0;
+            if (d_requests.empty()) {
+                d_idleCondition.broadcast();
+            }
+        }
+    }
+}
+
+// CREATORS
+AsyncStackTraceResolver::AsyncStackTraceResolver(
+                                              bslma::Allocator *basicAllocator)
+: d_requests(basicAllocator)
+, d_numBusy(0)
+, d_stopping(false)
+, d_threadHandle(bslmt::ThreadUtil::invalidHandle())
+, d_mutex()
+, d_requestCondition()
+, d_idleCondition()
+, d_demanglingPreferredFlag(true)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+AsyncStackTraceResolver::AsyncStackTraceResolver(
+                                     bool              demanglingPreferredFlag,
+                                     bslma::Allocator *basicAllocator)
+: d_requests(basicAllocator)
+, d_numBusy(0)
+, d_stopping(false)
+, d_threadHandle(bslmt::ThreadUtil::invalidHandle())
+, d_mutex()
+, d_requestCondition()
+, d_idleCondition()
+, d_demanglingPreferredFlag(demanglingPreferredFlag)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+AsyncStackTraceResolver::~AsyncStackTraceResolver()
+{
+    stop();
+}
+
+// MANIPULATORS
+int AsyncStackTraceResolver::captureStackTrace(const Callback& callback,
+                                               int             maxFrames)
+{
+    enum {
+        k_DEFAULT_MAX_FRAMES = 1024,
+        k_IGNORE_FRAMES      = bsls::StackAddressUtil::k_IGNORE_FRAMES + 1
+    };
+
+    if (maxFrames < 0) {
+        maxFrames = k_DEFAULT_MAX_FRAMES;
+    }
+
+    // The value 'k_IGNORE_FRAMES' indicates the number of additional frames
+    // to be ignored because they contained function calls within the stack
+    // trace facility.
+
+    maxFrames += k_IGNORE_FRAMES;
+
+    Request request(d_allocator_p);
+    request.d_addresses.resize(maxFrames);
+
+#if !defined(BSLS_PLATFORM_OS_CYGWIN)
+    const int numAddresses = bsls::StackAddressUtil::getStackAddresses(
+                                                    request.d_addresses.data(),
+                                                    maxFrames);
+#else
+    const int numAddresses = 0;
+#endif
+    if (numAddresses <= 0 || numAddresses > maxFrames) {
+        return -1;                                                    // RETURN
+    }
+
+    const int numIgnored = numAddresses < k_IGNORE_FRAMES
+                         ? numAddresses
+                         : k_IGNORE_FRAMES;
+
+    request.d_addresses.resize(numAddresses);
+    request.d_addresses.erase(request.d_addresses.begin(),
+                              request.d_addresses.begin() + numIgnored);
+    request.d_callback = callback;
+
+    enqueue(&request);
+    return 0;
+}
+
+void AsyncStackTraceResolver::resolve(const void * const addresses[],
+                                      int                numAddresses,
+                                      const Callback&    callback)
+{
+    BSLS_ASSERT(0 <= numAddresses);
+    BSLS_ASSERT(0 == numAddresses || 0 != addresses);
+
+    Request request(d_allocator_p);
+    request.d_addresses.reserve(numAddresses);
+    for (int i = 0; i < numAddresses; ++i) {
+        request.d_addresses.push_back(const_cast<void *>(addresses[i]));
+    }
+    request.d_callback = callback;
+
+    enqueue(&request);
+}
+
+int AsyncStackTraceResolver::start()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    while (d_stopping) {
+        d_idleCondition.wait(&d_mutex);
+    }
+
+    if (bslmt::ThreadUtil::invalidHandle() != d_threadHandle) {
+        return 0;                                                     // RETURN
+    }
+
+    bslmt::ThreadAttributes attributes;
+    return bslmt::ThreadUtil::create(
+               &d_threadHandle,
+               attributes,
+               bdlf::MemFnUtil::memFn(
+                          &AsyncStackTraceResolver::resolutionThreadEntryPoint,
+                          this));
+}
+
+void AsyncStackTraceResolver::stop()
+{
+    bslmt::ThreadUtil::Handle handle;
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        while (d_stopping) {
+            d_idleCondition.wait(&d_mutex);
+        }
+
+        if (bslmt::ThreadUtil::invalidHandle() == d_threadHandle) {
+            return;                                                   // RETURN
+        }
+
+        handle     = d_threadHandle;
+        d_stopping = true;
+        d_requestCondition.signal();
+    }
+
+    bslmt::ThreadUtil::join(handle);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    d_threadHandle = bslmt::ThreadUtil::invalidHandle();
+    d_stopping     = false;
+    d_idleCondition.broadcast();
+}
+
+void AsyncStackTraceResolver::waitUntilIdle()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    while (bslmt::ThreadUtil::invalidHandle() != d_threadHandle
+        && (!d_requests.empty() || 0 != d_numBusy)) {
+        d_idleCondition.wait(&d_mutex);
+    }
+}
+
+// ACCESSORS
+bool AsyncStackTraceResolver::isRunning() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return bslmt::ThreadUtil::invalidHandle() != d_threadHandle;
+}
+
+int AsyncStackTraceResolver::numPendingRequests() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return static_cast<int>(d_requests.size()) + d_numBusy;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,300 @@
+// balst_asyncstacktraceresolver.h                                    -*-C++-*-
+#ifndef INCLUDED_BALST_ASYNCSTACKTRACERESOLVER
+#define INCLUDED_BALST_ASYNCSTACKTRACERESOLVER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a mechanism resolving captured stack traces in a thread.
+//
+//@CLASSES:
+//   balst::AsyncStackTraceResolver: resolves stack addresses asynchronously
+//
+//@SEE_ALSO: balst_cachedstacktraceutil, bsls_stackaddressutil
+//
+//@DESCRIPTION: This component provides a mechanism,
+// 'balst::AsyncStackTraceResolver', that captures the return addresses of the
+// stack of the calling thread (which is fast, and involves no file access),
+// and resolves them into a 'balst::StackTrace' later, in a resolution thread
+// owned by the resolver, passing the resolved stack trace to a callback
+// supplied with the addresses.
+//
+// A thread that needs a stack trace, but cannot afford the time taken to
+// resolve one (which can be tens of milliseconds, see
+// 'balst_cachedstacktraceutil'), calls 'captureStackTrace' (or 'resolve',
+// supplying addresses it obtained from
+// 'bsls::StackAddressUtil::getStackAddresses'), which copies the addresses
+// into a queue and returns immediately.  The resolution thread removes the
+// requests from the queue in the order in which they were enqueued, resolves
+// their addresses by 'balst::CachedStackTraceUtil' (so that the addresses
+// shared by many stack traces are resolved only once), and invokes the
+// callback of each request with the resolved stack trace and the status of
+// the resolution.
+//
+///Resolution Thread
+///-----------------
+// The resolution thread is started by 'start' and stopped by 'stop' (or by the
+// destructor).  Requests may be enqueued while the thread is not running; they
+// are resolved once the thread is started.  'stop' resolves all the pending
+// requests before stopping the thread, and 'waitUntilIdle' blocks until all
+// the pending requests have been resolved and their callbacks have returned.
+//
+// The callbacks are invoked in the resolution thread, one at a time.  A
+// callback must not call 'stop' or 'waitUntilIdle' on the resolver invoking
+// it.
+//
+///Thread Safety
+///-------------
+// 'balst::AsyncStackTraceResolver' is fully thread-safe, meaning that all
+// non-creator operations on an object can be safely invoked simultaneously
+// from multiple threads.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Reporting Stack Traces Without Delaying the Reporting Thread
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a latency-critical service needs to report the stack trace of
+// the calling code whenever a deprecated function is called, without spending
+// the time needed to resolve the stack trace in the calling thread.
+//
+// First, we define a callback that prints a resolved stack trace, and counts
+// the stack traces it printed:
+//..
+//  bsls::AtomicInt numReports(0);
+//
+//  void reportStackTrace(const balst::StackTrace& stackTrace, int status)
+//      // Print the specified 'stackTrace', resolved with the specified
+//      // 'status', to 'bsl::cout'.
+//  {
+//      if (0 == status) {
+//          balst::StackTraceUtil::printFormatted(bsl::cout, stackTrace);
+//      }
+//      ++numReports;
+//  }
+//..
+// Then, we define the deprecated function, which captures the stack trace of
+// its caller by the resolver it is supplied:
+//..
+//  void deprecatedFunction(balst::AsyncStackTraceResolver *resolver)
+//      // Report the stack trace of this call using the specified 'resolver'.
+//  {
+//      resolver->captureStackTrace(&reportStackTrace);
+//  }
+//..
+// Next, we create a resolver, and start its resolution thread:
+//..
+//  balst::AsyncStackTraceResolver resolver;
+//
+//  int rc = resolver.start();
+//  assert(0 == rc);
+//..
+// Now, we call the deprecated function a few times.  Each call returns as soon
+// as the stack addresses are captured:
+//..
+//  for (int i = 0; i < 3; ++i) {
+//      deprecatedFunction(&resolver);
+//  }
+//..
+// Finally, we wait for the stack traces to be reported, and stop the
+// resolution thread:
+//..
+//  resolver.waitUntilIdle();
+//  assert(3 == numReports);
+//
+//  resolver.stop();
+//..
+
+#include <balscm_version.h>
+
+#include <balst_stacktrace.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_condition.h>
+#include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
+
+#include <bsl_deque.h>
+#include <bsl_functional.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace balst {
+
+                       // =============================
+                       // class AsyncStackTraceResolver
+                       // =============================
+
+class AsyncStackTraceResolver {
+    // This class provides a mechanism that resolves captured stack addresses
+    // into stack traces in a resolution thread, and passes the stack traces
+    // to callbacks.  See the component documentation for details.
+
+  public:
+    // TYPES
+    typedef bsl::function<void(const StackTrace&, int)> Callback;
+        // 'Callback' is an alias for a function invoked with a resolved stack
+        // trace, and the status (0 on success) of its resolution.
+
+  private:
+    // PRIVATE TYPES
+    struct Request {
+        // This 'struct' holds the addresses of a stack trace to be resolved,
+        // and the callback to which to pass it.
+
+        // DATA
+        bsl::vector<void *> d_addresses;  // addresses to resolve
+        Callback            d_callback;   // receives the stack trace
+
+        // TRAITS
+        BSLMF_NESTED_TRAIT_DECLARATION(Request, bslma::UsesBslmaAllocator);
+
+        // CREATORS
+        explicit Request(bslma::Allocator *basicAllocator = 0);
+            // Create a request having no addresses and an empty callback.
+            // Optionally specify a 'basicAllocator' used to supply memory.
+
+        Request(const Request& original, bslma::Allocator *basicAllocator = 0);
+            // Create a request having the value of the specified 'original'
+            // request.  Optionally specify a 'basicAllocator' used to supply
+            // memory.
+    };
+
+    // DATA
+    bsl::deque<Request>        d_requests;           // pending requests
+
+    int                        d_numBusy;            // number (0 or 1) of
+                                                     // requests being resolved
+
+    bool                       d_stopping;           // 'true' if 'stop' was
+                                                     // called and the thread
+                                                     // has not yet exited
+
+    bslmt::ThreadUtil::Handle  d_threadHandle;       // resolution thread, or
+                                                     // 'invalidHandle()'
+
+    mutable bslmt::Mutex       d_mutex;              // protects all of the
+                                                     // above
+
+    bslmt::Condition           d_requestCondition;   // signaled when a request
+                                                     // is enqueued, or the
+                                                     // thread must stop
+
+    bslmt::Condition           d_idleCondition;      // signaled when the
+                                                     // queue is drained
+
+    const bool                 d_demanglingPreferredFlag;
+                                                     // whether to demangle
+
+    bslma::Allocator          *d_allocator_p;        // memory allocator (held,
+                                                     // not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    AsyncStackTraceResolver(const AsyncStackTraceResolver&);
+    AsyncStackTraceResolver& operator=(const AsyncStackTraceResolver&);
+
+    // PRIVATE MANIPULATORS
+    void enqueue(Request *request);
+        // Append the specified 'request' to the queue (leaving '*request' in
+        // an unspecified state), and signal the resolution thread.
+
+    void resolutionThreadEntryPoint();
+        // Resolve the enqueued requests until 'stop' is called and the queue
+        // is empty.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(AsyncStackTraceResolver,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit AsyncStackTraceResolver(bslma::Allocator *basicAllocator = 0);
+    explicit AsyncStackTraceResolver(
+                                   bool              demanglingPreferredFlag,
+                                   bslma::Allocator *basicAllocator = 0);
+        // Create a resolver whose resolution thread is not running.
+        // Optionally specify 'demanglingPreferredFlag' to indicate whether or
+        // not to attempt to demangle the symbols of the resolved stack traces
+        // (see 'balst::StackTraceUtil'); if 'demanglingPreferredFlag' is not
+        // specified, demangling is attempted.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    ~AsyncStackTraceResolver();
+        // Stop the resolution thread, if running, after resolving the pending
+        // requests (see 'stop'), and destroy this object.
+
+    // MANIPULATORS
+    int captureStackTrace(const Callback& callback, int maxFrames = -1);
+        // Capture the return addresses of the stack of the calling thread,
+        // from the caller of this method down, and enqueue them to be
+        // resolved and passed to the specified 'callback' in the resolution
+        // thread.  Optionally specify 'maxFrames' to indicate the maximum
+        // number of frames to capture; if 'maxFrames' is not specified, or is
+        // negative, at least 1024 frames are captured.  Return 0 on success,
+        // and a non-zero value (without enqueuing a request) if the stack
+        // addresses could not be obtained.
+
+    void resolve(const void * const addresses[],
+                 int                numAddresses,
+                 const Callback&    callback);
+        // Enqueue the specified array of 'addresses' of length
+        // 'numAddresses' to be resolved and passed to the specified 'callback'
+        // in the resolution thread.  The behavior is undefined unless
+        // '0 <= numAddresses' and 'addresses' contains at least
+        // 'numAddresses' addresses.
+
+    int start();
+        // Start the resolution thread if it is not running.  Return 0 on
+        // success (including if the thread was already running), and a
+        // non-zero value otherwise.
+
+    void stop();
+        // Resolve the pending requests, and stop the resolution thread.  If
+        // the thread is not running, return immediately.  Requests enqueued
+        // concurrently with this call are either resolved, or remain pending
+        // until 'start' is called again.  The behavior is undefined if this
+        // method is called from a callback invoked by this resolver.
+
+    void waitUntilIdle();
+        // Block until all the enqueued requests have been resolved and their
+        // callbacks have returned.  If the resolution thread is not running,
+        // return immediately.  The behavior is undefined if this method is
+        // called from a callback invoked by this resolver.
+
+    // ACCESSORS
+    bool isRunning() const;
+        // Return 'true' if the resolution thread is running, and 'false'
+        // otherwise.
+
+    int numPendingRequests() const;
+        // Return the number of requests that have been enqueued and whose
+        // callbacks have not returned.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
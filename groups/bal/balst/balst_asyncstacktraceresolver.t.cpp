@@ -0,0 +1,871 @@
+// balst_asyncstacktraceresolver.t.cpp                                -*-C++-*-
+#include <balst_asyncstacktraceresolver.h>
+
+#include <balst_cachedstacktraceutil.h>
+#include <balst_stacktrace.h>
+#include <balst_stacktraceutil.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_atomic.h>
+#include <bsls_platform.h>
+#include <bsls_stackaddressutil.h>
+#include <bsls_stopwatch.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a mechanism that resolves stack addresses in a
+// thread it owns, and passes the resolved stack traces to callbacks.  We
+// verify that each request is resolved exactly once, in the order in which
+// the requests were enqueued, into the stack trace 'balst::StackTraceUtil'
+// resolves for the same addresses, and that the resolution thread is started,
+// drained, and stopped as documented.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] AsyncStackTraceResolver(bslma::Allocator *basicAllocator = 0);
+// [ 2] AsyncStackTraceResolver(bool demangle, bslma::Allocator * = 0);
+// [ 2] ~AsyncStackTraceResolver();
+//
+// MANIPULATORS
+// [ 4] int captureStackTrace(const Callback& callback, int maxFrames);
+// [ 3] void resolve(addresses, numAddresses, callback);
+// [ 2] int start();
+// [ 2] void stop();
+// [ 2] void waitUntilIdle();
+//
+// ACCESSORS
+// [ 2] bool isRunning() const;
+// [ 2] int numPendingRequests() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] CONCERN: requests enqueued concurrently by several threads
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                     NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+#define ASSERT_PASS_RAW(EXPR)  BSLS_ASSERTTEST_ASSERT_PASS_RAW(EXPR)
+#define ASSERT_FAIL_RAW(EXPR)  BSLS_ASSERTTEST_ASSERT_FAIL_RAW(EXPR)
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef balst::AsyncStackTraceResolver Obj;
+
+enum { k_MAX_FRAMES = 64 };
+
+#if defined(BSLS_PLATFORM_OS_CYGWIN)
+    enum { k_STACK_ADDRESSES_SUPPORTED = 0 };
+#else
+    enum { k_STACK_ADDRESSES_SUPPORTED = 1 };
+#endif
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static int captureAddresses(void **addresses, int recursion)
+    // Recurse the specified 'recursion' times, then load the return addresses
+    // of the stack into the specified 'addresses', which must have room for
+    // 'k_MAX_FRAMES' addresses, and return the number of addresses loaded.
+{
+    if (0 < recursion) {
+        const int rc = captureAddresses(addresses, recursion - 1);
+        return rc + (recursion & 0);  // prevent tail recursion
+    }
+    return bsls::StackAddressUtil::getStackAddresses(addresses, k_MAX_FRAMES);
+}
+
+class Recorder {
+    // This mechanism records the stack traces, and the identifiers of the
+    // requests, passed to the callbacks it provides.
+
+    // DATA
+    bsl::vector<int>               d_ids;          // request identifiers
+    bsl::vector<int>               d_statuses;     // resolution statuses
+    bsl::vector<balst::StackTrace> d_stackTraces;  // resolved stack traces
+    bsls::AtomicInt                d_numCalls;     // number of callbacks
+    mutable bslmt::Mutex           d_mutex;        // protects the vectors
+
+  public:
+    // TYPES
+    struct Callback {
+        // This 'struct' is a functor recording its invocations by a
+        // 'Recorder'.
+
+        // DATA
+        Recorder *d_recorder_p;  // recorder (held, not owned)
+        int       d_id;          // request identifier
+
+        void operator()(const balst::StackTrace& stackTrace, int status) const
+            // Record the specified 'stackTrace', resolved with the specified
+            // 'status', for the request of this object.
+        {
+            d_recorder_p->record(d_id, stackTrace, status);
+        }
+    };
+
+    // CREATORS
+    Recorder()
+        // Create a recorder having recorded no invocations.
+    : d_ids(bslma::Default::globalAllocator())
+    , d_statuses(bslma::Default::globalAllocator())
+    , d_stackTraces(bslma::Default::globalAllocator())
+    , d_numCalls(0)
+    {
+    }
+
+    // MANIPULATORS
+    Callback callback(int id)
+        // Return a callback recording its invocations for the specified 'id'.
+    {
+        Callback result = { this, id };
+        return result;
+    }
+
+    void record(int id, const balst::StackTrace& stackTrace, int status)
+        // Record the specified 'stackTrace', resolved with the specified
+        // 'status', for the request having the specified 'id'.
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        d_ids.push_back(id);
+        d_statuses.push_back(status);
+        d_stackTraces.push_back(stackTrace);
+        ++d_numCalls;
+    }
+
+    // ACCESSORS
+    int id(int index) const
+        // Return the identifier of the request of the specified 'index'th
+        // invocation.
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        return d_ids[index];
+    }
+
+    int numCalls() const
+        // Return the number of recorded invocations.
+    {
+        return d_numCalls;
+    }
+
+    balst::StackTrace stackTrace(int index) const
+        // Return the stack trace passed to the specified 'index'th
+        // invocation.
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        return d_stackTraces[index];
+    }
+
+    int status(int index) const
+        // Return the status passed to the specified 'index'th invocation.
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        return d_statuses[index];
+    }
+};
+
+struct ConcurrentResolve {
+    // This 'struct' is a functor enqueuing requests to a resolver.
+
+    // DATA
+    Obj          *d_resolver_p;   // resolver (held, not owned)
+    Recorder     *d_recorder_p;   // recorder (held, not owned)
+    void * const *d_addresses_p;  // addresses to resolve
+    int           d_numAddresses; // number of addresses
+    int           d_firstId;      // identifier of the first request
+    int           d_numRequests;  // number of requests to enqueue
+
+    void operator()() const
+        // Enqueue the requests of this object.
+    {
+        for (int i = 0; i < d_numRequests; ++i) {
+            d_resolver_p->resolve(d_addresses_p,
+                                  d_numAddresses,
+                                  d_recorder_p->callback(d_firstId + i));
+        }
+    }
+};
+
+// ============================================================================
+//                              USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace usage {
+
+bool verbose = false;  // print the reported stack traces if 'true'
+
+///Example 1: Reporting Stack Traces Without Delaying the Reporting Thread
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a latency-critical service needs to report the stack trace of
+// the calling code whenever a deprecated function is called, without spending
+// the time needed to resolve the stack trace in the calling thread.
+//
+// First, we define a callback that prints a resolved stack trace, and counts
+// the stack traces it printed:
+//..
+    bsls::AtomicInt numReports(0);
+
+    void reportStackTrace(const balst::StackTrace& stackTrace, int status)
+        // Print the specified 'stackTrace', resolved with the specified
+        // 'status', to 'bsl::cout'.
+    {
+        if (0 == status) {
+            if (verbose) {
+            balst::StackTraceUtil::printFormatted(bsl::cout, stackTrace);
+            }
+        }
+        ++numReports;
+    }
+//..
+// Then, we define the deprecated function, which captures the stack trace of
+// its caller by the resolver it is supplied:
+//..
+    void deprecatedFunction(balst::AsyncStackTraceResolver *resolver)
+        // Report the stack trace of this call using the specified 'resolver'.
+    {
+        resolver->captureStackTrace(&reportStackTrace);
+    }
+//..
+
+}  // close namespace usage
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator         da("default", veryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        if (!k_STACK_ADDRESSES_SUPPORTED) {
+            break;
+        }
+
+        usage::verbose = veryVerbose;
+
+        using namespace usage;
+
+// Next, we create a resolver, and start its resolution thread:
+//..
+    balst::AsyncStackTraceResolver resolver;
+
+    int rc = resolver.start();
+    ASSERT(0 == rc);
+//..
+// Now, we call the deprecated function a few times.  Each call returns as soon
+// as the stack addresses are captured:
+//..
+    for (int i = 0; i < 3; ++i) {
+        deprecatedFunction(&resolver);
+    }
+//..
+// Finally, we wait for the stack traces to be reported, and stop the
+// resolution thread:
+//..
+    resolver.waitUntilIdle();
+    ASSERT(3 == numReports);
+
+    resolver.stop();
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCERN: CONCURRENT REQUESTS
+        //
+        // Concerns:
+        //: 1 Requests enqueued concurrently by several threads are each
+        //:   resolved exactly once.
+        //:
+        //: 2 The requests enqueued by one thread are resolved in the order in
+        //:   which they were enqueued.
+        //
+        // Plan:
+        //: 1 Enqueue requests from several threads while the resolution
+        //:   thread runs, wait until the resolver is idle, and verify the
+        //:   recorded invocations.  (C-1..2)
+        //
+        // Testing:
+        //   CONCERN: requests enqueued concurrently by several threads
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: CONCURRENT REQUESTS" << endl
+                          << "============================" << endl;
+
+        if (!k_STACK_ADDRESSES_SUPPORTED) {
+            break;
+        }
+
+        enum { k_NUM_THREADS = 4, k_NUM_REQUESTS = 25 };
+
+        void      *addresses[k_MAX_FRAMES];
+        const int  numAddresses = captureAddresses(addresses, 2);
+
+        Recorder recorder;
+        Obj      mX;
+
+        ASSERT(0 == mX.start());
+
+        bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            ConcurrentResolve resolve = { &mX,
+                                          &recorder,
+                                          addresses,
+                                          numAddresses,
+                                          i * k_NUM_REQUESTS,
+                                          k_NUM_REQUESTS };
+            ASSERT(0 == bslmt::ThreadUtil::create(&handles[i], resolve));
+        }
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+        }
+
+        mX.waitUntilIdle();
+        ASSERT(0 == mX.numPendingRequests());
+        ASSERTV(recorder.numCalls(),
+                k_NUM_THREADS * k_NUM_REQUESTS == recorder.numCalls());
+
+        bsl::vector<int> lastIds(k_NUM_THREADS, -1);
+        for (int i = 0; i < recorder.numCalls(); ++i) {
+            const int ID     = recorder.id(i);
+            const int THREAD = ID / k_NUM_REQUESTS;
+
+            ASSERTV(i, 0 == recorder.status(i));
+            ASSERTV(i, numAddresses == recorder.stackTrace(i).length());
+            ASSERTV(i, ID, lastIds[THREAD], lastIds[THREAD] < ID);
+            lastIds[THREAD] = ID;
+        }
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            ASSERTV(i, lastIds[i], (i + 1) * k_NUM_REQUESTS - 1 == lastIds[i]);
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'captureStackTrace'
+        //
+        // Concerns:
+        //: 1 The stack trace passed to the callback is that of the caller of
+        //:   'captureStackTrace'.
+        //:
+        //: 2 At most 'maxFrames' frames are captured.
+        //
+        // Plan:
+        //: 1 Capture a stack trace, and the stack addresses of the same
+        //:   function, and compare the addresses of the frames of their
+        //:   callers.  (C-1)
+        //:
+        //: 2 Capture a stack trace with a small 'maxFrames', and verify its
+        //:   length.  (C-2)
+        //
+        // Testing:
+        //   int captureStackTrace(const Callback& callback, int maxFrames);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'captureStackTrace'" << endl
+                          << "===========================" << endl;
+
+        if (!k_STACK_ADDRESSES_SUPPORTED) {
+            break;
+        }
+
+        Recorder recorder;
+        Obj      mX;
+
+        ASSERT(0 == mX.captureStackTrace(recorder.callback(0)));
+        ASSERT(0 == mX.captureStackTrace(recorder.callback(1), 2));
+        ASSERT(2 == mX.numPendingRequests());
+
+        void      *addresses[k_MAX_FRAMES];
+        const int  numAddresses = bsls::StackAddressUtil::getStackAddresses(
+                                                                 addresses,
+                                                                 k_MAX_FRAMES);
+        ASSERT(1 < numAddresses);
+
+        ASSERT(0 == mX.start());
+        mX.waitUntilIdle();
+        ASSERT(2 == recorder.numCalls());
+
+        const balst::StackTrace X = recorder.stackTrace(0);
+        const balst::StackTrace Y = recorder.stackTrace(1);
+
+        ASSERT(0 == recorder.status(0));
+        ASSERT(0 == recorder.status(1));
+
+        // The first frames are those of distinct calls in this function, but
+        // their callers are the same.
+
+        const int IGNORED = bsls::StackAddressUtil::k_IGNORE_FRAMES;
+
+        ASSERTV(X.length(), numAddresses - IGNORED == X.length());
+        ASSERT(X.length() < 2
+            || X[1].address() == addresses[IGNORED + 1]);
+
+        ASSERTV(Y.length(), 2 == Y.length());
+        ASSERT(Y[1].address() == X[1].address());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'resolve'
+        //
+        // Concerns:
+        //: 1 Each request is passed to its callback resolved into the stack
+        //:   trace that 'balst::StackTraceUtil' resolves for its addresses,
+        //:   with the demangling preference of the resolver, and a 0 status.
+        //:
+        //: 2 The requests are resolved in the order in which they were
+        //:   enqueued.
+        //:
+        //: 3 The addresses are copied by 'resolve'.
+        //:
+        //: 4 A request having no addresses is resolved into an empty stack
+        //:   trace.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For each demangling preference, clear the cache of
+        //:   'balst::CachedStackTraceUtil', enqueue requests for two stack
+        //:   traces and an empty one, overwriting the addresses after each
+        //:   call, and compare the stack traces recorded by the callbacks
+        //:   with those resolved by 'balst::StackTraceUtil'.  (C-1..4)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   void resolve(addresses, numAddresses, callback);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'resolve'" << endl
+                          << "=================" << endl;
+
+        if (!k_STACK_ADDRESSES_SUPPORTED) {
+            break;
+        }
+
+        void      *shallow[k_MAX_FRAMES];
+        const int  numShallow = captureAddresses(shallow, 1);
+        void      *deep[k_MAX_FRAMES];
+        const int  numDeep = captureAddresses(deep, 3);
+        ASSERT(0 < numShallow);
+        ASSERT(numShallow < numDeep);
+
+        for (int demangle = 0; demangle < 2; ++demangle) {
+            const bool DEMANGLE = demangle;
+
+            if (veryVerbose) { T_ P(DEMANGLE) }
+
+            balst::CachedStackTraceUtil::clearCache();
+
+            balst::StackTrace expectedShallow;
+            balst::StackTrace expectedDeep;
+            ASSERT(0 == balst::StackTraceUtil::loadStackTraceFromAddressArray(
+                                                              &expectedShallow,
+                                                              shallow,
+                                                              numShallow,
+                                                              DEMANGLE));
+            ASSERT(0 == balst::StackTraceUtil::loadStackTraceFromAddressArray(
+                                                              &expectedDeep,
+                                                              deep,
+                                                              numDeep,
+                                                              DEMANGLE));
+
+            Recorder recorder;
+            Obj      mX(DEMANGLE);
+
+            void *copy[k_MAX_FRAMES];
+
+            bsl::copy(shallow, shallow + numShallow, copy);
+            mX.resolve(copy, numShallow, recorder.callback(0));
+            bsl::fill(copy, copy + k_MAX_FRAMES, static_cast<void *>(0));
+
+            bsl::copy(deep, deep + numDeep, copy);
+            mX.resolve(copy, numDeep, recorder.callback(1));
+            bsl::fill(copy, copy + k_MAX_FRAMES, static_cast<void *>(0));
+
+            mX.resolve(0, 0, recorder.callback(2));
+
+            ASSERT(0 == mX.start());
+            mX.waitUntilIdle();
+
+            ASSERTV(recorder.numCalls(), 3 == recorder.numCalls());
+            for (int i = 0; i < 3; ++i) {
+                ASSERTV(i, i == recorder.id(i));
+                ASSERTV(i, 0 == recorder.status(i));
+            }
+            ASSERT(expectedShallow == recorder.stackTrace(0));
+            ASSERT(expectedDeep    == recorder.stackTrace(1));
+            ASSERT(0 == recorder.stackTrace(2).length());
+        }
+
+        if (verbose) cout << "\tNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Recorder recorder;
+            Obj      mX;
+
+            ASSERT_FAIL(mX.resolve(0, -1, recorder.callback(0)));
+            ASSERT_FAIL(mX.resolve(0,  1, recorder.callback(0)));
+            ASSERT_PASS(mX.resolve(0,  0, recorder.callback(0)));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING THE RESOLUTION THREAD
+        //
+        // Concerns:
+        //: 1 A resolver is created with its resolution thread not running,
+        //:   and requests enqueued before 'start' remain pending.
+        //:
+        //: 2 'start' starts the thread, which resolves the pending requests;
+        //:   calling 'start' on a running resolver has no effect.
+        //:
+        //: 3 'waitUntilIdle' returns once all requests have been resolved, or
+        //:   immediately if the thread is not running.
+        //:
+        //: 4 'stop' resolves the pending requests, then stops the thread;
+        //:   calling 'stop' on a stopped resolver has no effect.  The thread
+        //:   can be restarted.
+        //:
+        //: 5 The destructor resolves the pending requests of a running
+        //:   resolver.
+        //:
+        //: 6 The memory of the requests is supplied by the allocator of the
+        //:   resolver.
+        //
+        // Plan:
+        //: 1 Create resolvers with each constructor, enqueue requests, and
+        //:   verify 'isRunning', 'numPendingRequests', and the number of
+        //:   callbacks invoked, after each call to 'start', 'stop',
+        //:   'waitUntilIdle', and the destructor.  (C-1..5)
+        //:
+        //: 2 Supply a test allocator to a resolver, and verify that it
+        //:   supplied memory for the enqueued requests.  (C-6)
+        //
+        // Testing:
+        //   AsyncStackTraceResolver(bslma::Allocator *basicAllocator = 0);
+        //   AsyncStackTraceResolver(bool demangle, bslma::Allocator * = 0);
+        //   ~AsyncStackTraceResolver();
+        //   int start();
+        //   void stop();
+        //   void waitUntilIdle();
+        //   bool isRunning() const;
+        //   int numPendingRequests() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING THE RESOLUTION THREAD" << endl
+                          << "=============================" << endl;
+
+        if (!k_STACK_ADDRESSES_SUPPORTED) {
+            break;
+        }
+
+        void      *addresses[k_MAX_FRAMES];
+        const int  numAddresses = captureAddresses(addresses, 1);
+
+        for (char cfg = 'a'; cfg <= 'b'; ++cfg) {
+            const char CONFIG = cfg;
+
+            if (veryVerbose) { T_ P(CONFIG) }
+
+            bslma::TestAllocator ta("object", veryVerbose);
+            Recorder             recorder;
+
+            {
+                Obj *objPtr = 'a' == CONFIG
+                            ? new (ta) Obj(&ta)
+                            : new (ta) Obj(false, &ta);
+                Obj& mX = *objPtr;  const Obj& X = mX;
+
+                ASSERT(false == X.isRunning());
+                ASSERT(0     == X.numPendingRequests());
+
+                mX.waitUntilIdle();
+                mX.stop();
+                ASSERT(false == X.isRunning());
+
+                const bsls::Types::Int64 NUM_BLOCKS = ta.numBlocksTotal();
+
+                mX.resolve(addresses, numAddresses, recorder.callback(0));
+                mX.resolve(addresses, numAddresses, recorder.callback(1));
+                ASSERT(2 == X.numPendingRequests());
+                ASSERT(NUM_BLOCKS < ta.numBlocksTotal());
+
+                // The thread is not running: the requests remain pending.
+
+                mX.waitUntilIdle();
+                ASSERT(2 == X.numPendingRequests());
+                ASSERT(0 == recorder.numCalls());
+
+                ASSERT(0 == mX.start());
+                ASSERT(true == X.isRunning());
+                ASSERT(0 == mX.start());
+                ASSERT(true == X.isRunning());
+
+                mX.waitUntilIdle();
+                ASSERT(0 == X.numPendingRequests());
+                ASSERT(2 == recorder.numCalls());
+
+                mX.resolve(addresses, numAddresses, recorder.callback(2));
+                mX.stop();
+                ASSERT(false == X.isRunning());
+                ASSERT(0 == X.numPendingRequests());
+                ASSERT(3 == recorder.numCalls());
+
+                mX.stop();
+                ASSERT(false == X.isRunning());
+
+                // Restart, and destroy the running resolver.
+
+                ASSERT(0 == mX.start());
+                ASSERT(true == X.isRunning());
+
+                mX.resolve(addresses, numAddresses, recorder.callback(3));
+
+                ta.deleteObject(objPtr);
+            }
+
+            ASSERTV(recorder.numCalls(), 4 == recorder.numCalls());
+            for (int i = 0; i < recorder.numCalls(); ++i) {
+                ASSERTV(CONFIG, i, i == recorder.id(i));
+                ASSERTV(CONFIG, i, 0 == recorder.status(i));
+                ASSERTV(CONFIG, i,
+                        numAddresses == recorder.stackTrace(i).length());
+            }
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Start a resolver, enqueue a request, wait until it is resolved,
+        //:   and verify the stack trace passed to the callback.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        if (!k_STACK_ADDRESSES_SUPPORTED) {
+            break;
+        }
+
+        void      *addresses[k_MAX_FRAMES];
+        const int  numAddresses = captureAddresses(addresses, 2);
+
+        Recorder recorder;
+        Obj      mX;
+
+        ASSERT(0 == mX.start());
+        mX.resolve(addresses, numAddresses, recorder.callback(0));
+        mX.waitUntilIdle();
+        mX.stop();
+
+        ASSERT(1 == recorder.numCalls());
+        ASSERT(0 == recorder.status(0));
+        ASSERT(numAddresses == recorder.stackTrace(0).length());
+
+        if (veryVerbose) {
+            balst::StackTraceUtil::printFormatted(cout,
+                                                  recorder.stackTrace(0));
+        }
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 Capturing a stack trace by 'captureStackTrace' takes much less
+        //:   time than resolving it.
+        //
+        // Plan:
+        //: 1 Capture stack traces repeatedly by 'captureStackTrace', and
+        //:   report the time per call in the calling thread, and the time
+        //:   taken to resolve them all.  The number of iterations may be
+        //:   supplied as the second argument (default 1000).
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        const int NUM_ITERATIONS = argc > 2 && 0 < bsl::atoi(argv[2])
+                                 ? bsl::atoi(argv[2])
+                                 : 1000;
+
+        Recorder        recorder;
+        Obj             mX;
+        bsls::Stopwatch timer;
+
+        ASSERT(0 == mX.start());
+
+        timer.start();
+        for (int i = 0; i < NUM_ITERATIONS; ++i) {
+            mX.captureStackTrace(recorder.callback(i));
+        }
+        timer.stop();
+        const double captureTime = timer.elapsedTime() / NUM_ITERATIONS;
+
+        timer.reset();
+        timer.start();
+        mX.waitUntilIdle();
+        timer.stop();
+
+        ASSERT(NUM_ITERATIONS == recorder.numCalls());
+
+        cout << "captureStackTrace " << captureTime * 1e6
+             << " us per call, all resolved after "
+             << timer.elapsedTime() * 1e3 << " ms" << endl;
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,263 @@
+// balst_cachedstacktraceutil.cpp                                     -*-C++-*-
+#include <balst_cachedstacktraceutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(balst_cachedstacktraceutil_cpp,"$Id$ $CSID$")
+
+#include <balst_stacktraceframe.h>
+#include <balst_stacktraceutil.h>
+
+#include <bdlma_heapbypassallocator.h>
+
+#include <bslma_allocator.h>
+#include <bslma_deallocatorguard.h>
+
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_once.h>
+
+#include <bsls_assert.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_platform.h>
+#include <bsls_stackaddressutil.h>
+
+#include <bsl_map.h>
+#include <bsl_new.h>
+#include <bsl_vector.h>
+
+#if defined(BSLS_PLATFORM_OS_WINDOWS) && defined(BDE_BUILD_TARGET_OPT)
+// 'getStackAddresses' will not be able to trace through our stack frames if
+// we're optimized on Windows
+
+#pragma optimize("", off)
+#endif
+
+///Implementation Notes
+///--------------------
+// The cache is a pair of maps (one for frames resolved with demangling, and
+// one for frames resolved without it) from return address to resolved frame.
+// The maps, and the heap bypass allocator supplying their memory, are held in
+// a 'Cache' object that is constructed (with the mutex protecting it) on
+// first use, and is never destroyed, so that stack traces can be loaded
+// during the destruction of static objects.  'clearCache' destroys and
+// re-creates the 'Cache' object, releasing all of its memory at once (a heap
+// bypass allocator does not release individual deallocations).
+
+namespace BloombergLP {
+namespace balst {
+namespace {
+namespace u {
+
+typedef bsl::map<const void *, StackTraceFrame> FrameMap;
+
+struct Cache {
+    // This 'struct' holds the resolved frames of the cache, and the allocator
+    // supplying their memory.
+
+    // DATA
+    bdlma::HeapBypassAllocator d_allocator;        // supplies all memory
+
+    FrameMap                   d_mangledFrames;    // frames resolved without
+                                                   // demangling
+
+    FrameMap                   d_demangledFrames;  // frames resolved with
+                                                   // demangling
+
+  private:
+    // NOT IMPLEMENTED
+    Cache(const Cache&);
+    Cache& operator=(const Cache&);
+
+  public:
+    // CREATORS
+    Cache()
+        // Create an empty cache.
+    : d_allocator()
+    , d_mangledFrames(&d_allocator)
+    , d_demangledFrames(&d_allocator)
+    {
+    }
+
+    // MANIPULATORS
+    FrameMap& frames(bool demanglingPreferredFlag)
+        // Return a reference providing modifiable access to the map of frames
+        // resolved with the specified 'demanglingPreferredFlag'.
+    {
+        return demanglingPreferredFlag ? d_demangledFrames : d_mangledFrames;
+    }
+};
+
+bsls::ObjectBuffer<bslmt::Mutex> s_mutex;
+bsls::ObjectBuffer<Cache>        s_cache;
+
+void initialize()
+    // Create the mutex and the cache if they have not been created.
+{
+    BSLMT_ONCE_DO {
+        // The mutex and the cache must remain valid for the lifetime of the
+        // task, and are intentionally never destroyed.
+
+        new (s_mutex.buffer()) bslmt::Mutex();
+        new (s_cache.buffer()) Cache();
+    }
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+                        // ---------------------------
+                        // struct CachedStackTraceUtil
+                        // ---------------------------
+
+// CLASS METHODS
+void CachedStackTraceUtil::clearCache()
+{
+    u::initialize();
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&u::s_mutex.object());
+
+    u::s_cache.object().~Cache();
+    new (u::s_cache.buffer()) u::Cache();
+}
+
+int CachedStackTraceUtil::loadStackTraceFromAddressArray(
+                                   StackTrace         *result,
+                                   const void * const  addresses[],
+                                   int                 numAddresses,
+                                   bool                demanglingPreferredFlag)
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(0 <= numAddresses);
+    BSLS_ASSERT(0 == numAddresses || 0 != addresses);
+
+    u::initialize();
+
+    result->removeAll();
+    result->resize(numAddresses);
+
+    // Copy the cached frames, and note the indices of the other addresses.
+
+    bsl::vector<int> missingIndices(result->allocator());
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&u::s_mutex.object());
+
+        const u::FrameMap& frames =
+                           u::s_cache.object().frames(demanglingPreferredFlag);
+
+        for (int i = 0; i < numAddresses; ++i) {
+            u::FrameMap::const_iterator it = frames.find(addresses[i]);
+            if (frames.end() == it) {
+                missingIndices.push_back(i);
+            }
+            else {
+                (*result)[i] = it->second;
+            }
+        }
+    }
+
+    if (missingIndices.empty()) {
+        return 0;                                                     // RETURN
+    }
+
+    // Resolve all of the addresses, without holding the lock.  Resolving the
+    // cached addresses again costs little (the cost of a resolution depends
+    // mostly on the object files read, not on the number of addresses), and
+    // ensures that 'result' has the frames 'StackTraceUtil' would load: the
+    // frame resolved for an address can depend on the other addresses
+    // resolved with it (e.g., the source file name of a global symbol is
+    // found only if the debug information of its compilation unit is read for
+    // some other address).
+
+    const int rc = StackTraceUtil::loadStackTraceFromAddressArray(
+                                                      result,
+                                                      addresses,
+                                                      numAddresses,
+                                                      demanglingPreferredFlag);
+    if (0 != rc || numAddresses != result->length()) {
+        return 0 == rc ? -1 : rc;                                     // RETURN
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&u::s_mutex.object());
+
+    u::FrameMap& frames = u::s_cache.object().frames(demanglingPreferredFlag);
+
+    for (bsl::size_t i = 0; i < missingIndices.size(); ++i) {
+        const int index = missingIndices[i];
+        frames.emplace(addresses[index], (*result)[index]);
+    }
+
+    return 0;
+}
+
+int CachedStackTraceUtil::loadStackTraceFromStack(
+                                           StackTrace *result,
+                                           int         maxFrames,
+                                           bool        demanglingPreferredFlag)
+{
+    BSLS_ASSERT(result);
+
+    enum {
+        k_DEFAULT_MAX_FRAMES = 1024,
+        k_IGNORE_FRAMES      = bsls::StackAddressUtil::k_IGNORE_FRAMES + 1
+    };
+
+    if (maxFrames < 0) {
+        maxFrames = k_DEFAULT_MAX_FRAMES;
+    }
+
+    // The value 'k_IGNORE_FRAMES' indicates the number of additional frames
+    // to be ignored because they contained function calls within the stack
+    // trace facility.
+
+    maxFrames += k_IGNORE_FRAMES;
+
+    void **addresses = static_cast<void **>(
+                    result->allocator()->allocate(maxFrames * sizeof(void *)));
+    bslma::DeallocatorGuard<bslma::Allocator> guard(addresses,
+                                                   result->allocator());
+
+#if !defined(BSLS_PLATFORM_OS_CYGWIN)
+    const int numAddresses = bsls::StackAddressUtil::getStackAddresses(
+                                                                    addresses,
+                                                                    maxFrames);
+#else
+    const int numAddresses = 0;
+#endif
+    if (numAddresses <= 0 || numAddresses > maxFrames) {
+        return -1;                                                    // RETURN
+    }
+
+    return loadStackTraceFromAddressArray(result,
+                                          addresses    + k_IGNORE_FRAMES,
+                                          numAddresses - k_IGNORE_FRAMES,
+                                          demanglingPreferredFlag);
+}
+
+bsl::size_t CachedStackTraceUtil::numCachedFrames()
+{
+    u::initialize();
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&u::s_mutex.object());
+
+    return u::s_cache.object().d_mangledFrames.size()
+         + u::s_cache.object().d_demangledFrames.size();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
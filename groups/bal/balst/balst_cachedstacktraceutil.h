@@ -0,0 +1,194 @@
+// balst_cachedstacktraceutil.h                                       -*-C++-*-
+#ifndef INCLUDED_BALST_CACHEDSTACKTRACEUTIL
+#define INCLUDED_BALST_CACHEDSTACKTRACEUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide stack-trace resolution backed by a process-wide cache.
+//
+//@CLASSES:
+//   balst::CachedStackTraceUtil: resolve stack traces using a symbol cache
+//
+//@SEE_ALSO: balst_stacktraceutil, balst_asyncstacktraceresolver
+//
+//@DESCRIPTION: This component provides a namespace,
+// 'balst::CachedStackTraceUtil', for functions that load a 'balst::StackTrace'
+// from an array of return addresses, or from the stack of the current thread,
+// like the identically named functions of 'balst::StackTraceUtil', but that
+// consult a process-wide cache of resolved stack-trace frames before
+// resolving any address.
+//
+// Resolving an address (by 'balst::StackTraceUtil') reads and parses the
+// symbol tables and (on some platforms) the debug information of every object
+// file containing an address being resolved, and typically takes hundreds of
+// microseconds to tens of milliseconds, depending mostly on the number and
+// size of the object files read rather than on the number of addresses.  The
+// functions of this component load the frames of cached addresses from the
+// cache, and call 'balst::StackTraceUtil::loadStackTraceFromAddressArray' only
+// if some address is not cached, adding the frames of the addresses that were
+// not cached to the cache.  Since the stack traces of a program typically
+// share most of their return addresses, the cost of loading a stack trace
+// quickly drops to that of copying the cached frames: a stack trace whose
+// addresses are all cached is loaded without any file access.
+//
+///Cache Contents
+///--------------
+// The cache maps each return address to the stack-trace frame resolved for it
+// (separately for frames resolved with and without demangling), and is kept
+// sorted by address.  Its memory is supplied by a heap bypass allocator (see
+// 'bdlma_heapbypassallocator'), so that neither the default allocator nor the
+// global allocator are used to maintain it, and it is never destroyed.  A
+// frame is added to the cache only if the resolution of its address
+// succeeded.
+//
+// A cached frame describes the object file that was mapped at its address
+// when the frame was resolved.  A program that unloads a shared library (e.g.,
+// by 'dlclose') and then loads another at an overlapping address must call
+// 'clearCache' between the two.
+//
+///Thread Safety
+///-------------
+// The functions of this component are thread-safe.  The cache is locked only
+// while it is searched or updated; addresses missing from the cache are
+// resolved without holding the lock, so that a thread reading cached frames
+// is not blocked by a thread resolving new addresses.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Reporting Many Stack Traces
+/// - - - - - - - - - - - - - - - - - - -
+// Suppose that a program records the return addresses of the call stack
+// whenever it detects a suspicious condition, and reports all of the recorded
+// stack traces at shutdown.  Since the stack traces were recorded from a few
+// call sites, they share most of their addresses.
+//
+// First, we record the stack addresses of the current thread twice, as if
+// from two suspicious conditions:
+//..
+//  enum { k_MAX_FRAMES = 64 };
+//
+//  void *addresses[2][k_MAX_FRAMES];
+//  int   numAddresses[2];
+//
+//  for (int i = 0; i < 2; ++i) {
+//      numAddresses[i] = bsls::StackAddressUtil::getStackAddresses(
+//                                                             addresses[i],
+//                                                             k_MAX_FRAMES);
+//  }
+//..
+// Then, we resolve the first stack trace.  Its addresses are not yet cached,
+// so they are resolved by 'balst::StackTraceUtil', and added to the cache:
+//..
+//  balst::StackTrace stackTrace;
+//
+//  int rc = balst::CachedStackTraceUtil::loadStackTraceFromAddressArray(
+//                                                         &stackTrace,
+//                                                         addresses[0],
+//                                                         numAddresses[0]);
+//  assert(0 == rc);
+//  assert(numAddresses[0] == stackTrace.length());
+//
+//  balst::StackTraceUtil::printFormatted(bsl::cout, stackTrace);
+//..
+// Now, we resolve the second stack trace.  It was recorded from the same call
+// site, so all of its addresses are in the cache, and it is loaded without any
+// file access:
+//..
+//  rc = balst::CachedStackTraceUtil::loadStackTraceFromAddressArray(
+//                                                         &stackTrace,
+//                                                         addresses[1],
+//                                                         numAddresses[1]);
+//  assert(0 == rc);
+//  assert(numAddresses[1] == stackTrace.length());
+//..
+// Finally, we observe that the cache holds (at least) the frames of these
+// stack traces:
+//..
+//  const bsl::size_t numFrames = numAddresses[0];
+//  assert(numFrames <= balst::CachedStackTraceUtil::numCachedFrames());
+//..
+
+#include <balscm_version.h>
+
+#include <balst_stacktrace.h>
+
+#include <bsl_cstddef.h>
+
+namespace BloombergLP {
+namespace balst {
+
+                          // ===========================
+                          // struct CachedStackTraceUtil
+                          // ===========================
+
+struct CachedStackTraceUtil {
+    // This 'struct' provides a namespace for functions that load stack traces
+    // using a process-wide cache of resolved stack-trace frames.
+
+    // CLASS METHODS
+    static void clearCache();
+        // Remove all frames from the cache of resolved frames.  Note that the
+        // cache must be cleared after a shared library is unloaded if another
+        // object file can later be loaded at an overlapping address.
+
+    static int loadStackTraceFromAddressArray(
+                           StackTrace         *result,
+                           const void * const  addresses[],
+                           int                 numAddresses,
+                           bool                demanglingPreferredFlag = true);
+        // Populate the specified 'result' with the stack-trace frames for the
+        // specified array of 'addresses' of length 'numAddresses': if all of
+        // the addresses are cached, copy their frames from the cache of
+        // resolved frames; otherwise, resolve all of them by
+        // 'StackTraceUtil::loadStackTraceFromAddressArray', and add the frames
+        // of the addresses that were not cached to the cache.  Optionally
+        // specify 'demanglingPreferredFlag' to indicate whether or not to
+        // attempt to perform demangling (see 'StackTraceUtil').  Return 0 on
+        // success, and a non-zero value otherwise.  Any frames previously
+        // contained in 'result' are discarded.  If the resolution fails, no
+        // frame is cached.  The behavior is undefined unless 'addresses'
+        // contains at least 'numAddresses' addresses.
+
+    static int loadStackTraceFromStack(StackTrace *result,
+                                       int         maxFrames = -1,
+                                       bool        demanglingPreferredFlag =
+                                                                         true);
+        // Populate the specified 'result' object with information about the
+        // current thread's program stack, using the cache of resolved frames
+        // as described for 'loadStackTraceFromAddressArray'.  Optionally
+        // specify 'maxFrames' to indicate the maximum number of frames to take
+        // from the top of the stack.  If 'maxFrames' is not specified, the
+        // default limit is at least 1024.  Optionally specify
+        // 'demanglingPreferredFlag' to indicate whether to attempt to perform
+        // demangling (see 'StackTraceUtil').  Any frames previously contained
+        // in 'result' are discarded.  Return 0 on success, and a non-zero
+        // value otherwise.  The behavior is undefined unless 'maxFrames' (if
+        // specified) is greater than 0.
+
+    static bsl::size_t numCachedFrames();
+        // Return the number of frames in the cache of resolved frames.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,700 @@
+// balst_cachedstacktraceutil.t.cpp                                   -*-C++-*-
+#include <balst_cachedstacktraceutil.h>
+
+#include <balst_stacktrace.h>
+#include <balst_stacktraceframe.h>
+#include <balst_stacktraceutil.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_threadutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_platform.h>
+#include <bsls_stackaddressutil.h>
+#include <bsls_stopwatch.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides functions that resolve stack traces
+// through a process-wide cache.  We verify that the stack traces they load are
+// the same as those loaded by 'balst::StackTraceUtil' for the same addresses,
+// whether or not the addresses are cached, and that the cache holds one frame
+// per distinct address (and demangling preference) resolved.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] void clearCache();
+// [ 2] int loadStackTraceFromAddressArray(result, addrs, num, demangle);
+// [ 3] int loadStackTraceFromStack(result, maxFrames, demangle);
+// [ 2] bsl::size_t numCachedFrames();
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CONCERN: concurrent loads of the same addresses
+// [ 5] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                     NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+#define ASSERT_PASS_RAW(EXPR)  BSLS_ASSERTTEST_ASSERT_PASS_RAW(EXPR)
+#define ASSERT_FAIL_RAW(EXPR)  BSLS_ASSERTTEST_ASSERT_FAIL_RAW(EXPR)
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef balst::CachedStackTraceUtil Util;
+
+enum { k_MAX_FRAMES = 64 };
+
+#if defined(BSLS_PLATFORM_OS_CYGWIN)
+    enum { k_STACK_ADDRESSES_SUPPORTED = 0 };
+#else
+    enum { k_STACK_ADDRESSES_SUPPORTED = 1 };
+#endif
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static int captureAddresses(void **addresses, int recursion)
+    // Recurse the specified 'recursion' times, then load the return addresses
+    // of the stack into the specified 'addresses', which must have room for
+    // 'k_MAX_FRAMES' addresses, and return the number of addresses loaded.
+{
+    if (0 < recursion) {
+        const int rc = captureAddresses(addresses, recursion - 1);
+        return rc + (recursion & 0);  // prevent tail recursion
+    }
+    return bsls::StackAddressUtil::getStackAddresses(addresses, k_MAX_FRAMES);
+}
+
+struct ConcurrentLoad {
+    // This 'struct' is a functor loading a stack trace through the cache, and
+    // verifying it against an expected stack trace.
+
+    // DATA
+    void * const            *d_addresses_p;
+    int                      d_numAddresses;
+    const balst::StackTrace *d_expected_p;
+
+    void operator()() const
+        // Load the stack trace of the addresses of this object through the
+        // cache several times, and verify it each time.
+    {
+        for (int i = 0; i < 5; ++i) {
+            balst::StackTrace stackTrace(bslma::Default::globalAllocator());
+            ASSERT(0 == Util::loadStackTraceFromAddressArray(&stackTrace,
+                                                             d_addresses_p,
+                                                             d_numAddresses));
+            ASSERT(*d_expected_p == stackTrace);
+        }
+    }
+};
+
+// ============================================================================
+//                              USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+static void usageExample(bool verbose)
+    // Run the usage example of the component, printing the stack trace if the
+    // specified 'verbose' is 'true'.
+{
+///Example 1: Reporting Many Stack Traces
+/// - - - - - - - - - - - - - - - - - - -
+// Suppose that a program records the return addresses of the call stack
+// whenever it detects a suspicious condition, and reports all of the recorded
+// stack traces at shutdown.  Since the stack traces were recorded from a few
+// call sites, they share most of their addresses.
+//
+// First, we record the stack addresses of the current thread twice, as if
+// from two suspicious conditions:
+//..
+    enum { k_MAX_FRAMES = 64 };
+
+    void *addresses[2][k_MAX_FRAMES];
+    int   numAddresses[2];
+
+    for (int i = 0; i < 2; ++i) {
+        numAddresses[i] = bsls::StackAddressUtil::getStackAddresses(
+                                                               addresses[i],
+                                                               k_MAX_FRAMES);
+    }
+//..
+// Then, we resolve the first stack trace.  Its addresses are not yet cached,
+// so they are resolved by 'balst::StackTraceUtil', and added to the cache:
+//..
+    balst::StackTrace stackTrace;
+
+    int rc = balst::CachedStackTraceUtil::loadStackTraceFromAddressArray(
+                                                           &stackTrace,
+                                                           addresses[0],
+                                                           numAddresses[0]);
+    ASSERT(0 == rc);
+    ASSERT(numAddresses[0] == stackTrace.length());
+
+    if (verbose) {
+    balst::StackTraceUtil::printFormatted(bsl::cout, stackTrace);
+    }
+//..
+// Now, we resolve the second stack trace.  It was recorded from the same call
+// site, so all of its addresses are in the cache, and it is loaded without any
+// file access:
+//..
+    rc = balst::CachedStackTraceUtil::loadStackTraceFromAddressArray(
+                                                           &stackTrace,
+                                                           addresses[1],
+                                                           numAddresses[1]);
+    ASSERT(0 == rc);
+    ASSERT(numAddresses[1] == stackTrace.length());
+//..
+// Finally, we observe that the cache holds (at least) the frames of these
+// stack traces:
+//..
+    const bsl::size_t numFrames = numAddresses[0];
+    ASSERT(numFrames <= balst::CachedStackTraceUtil::numCachedFrames());
+//..
+}
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator         da("default", veryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        if (!k_STACK_ADDRESSES_SUPPORTED) {
+            break;
+        }
+
+        usageExample(verbose);
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCERN: CONCURRENT LOADS OF THE SAME ADDRESSES
+        //
+        // Concerns:
+        //: 1 Threads loading stack traces of the same (initially uncached)
+        //:   addresses concurrently all load the correct stack trace.
+        //:
+        //: 2 Each address is cached once.
+        //
+        // Plan:
+        //: 1 Resolve a stack trace by 'balst::StackTraceUtil'.  Clear the
+        //:   cache, and load the stack trace of the same addresses from
+        //:   several threads at once through the cache.  Verify the stack
+        //:   traces and the number of cached frames.  (C-1..2)
+        //
+        // Testing:
+        //   CONCERN: concurrent loads of the same addresses
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: CONCURRENT LOADS OF THE SAME ADDRESSES"
+                          << endl
+                          << "==============================================="
+                          << endl;
+
+        if (!k_STACK_ADDRESSES_SUPPORTED) {
+            break;
+        }
+
+        enum { k_NUM_THREADS = 4 };
+
+        void      *addresses[k_MAX_FRAMES];
+        const int  numAddresses = captureAddresses(addresses, 3);
+        ASSERT(0 < numAddresses);
+
+        balst::StackTrace expected(bslma::Default::globalAllocator());
+        ASSERT(0 == balst::StackTraceUtil::loadStackTraceFromAddressArray(
+                                                               &expected,
+                                                               addresses,
+                                                               numAddresses));
+
+        Util::clearCache();
+
+        ConcurrentLoad load = { addresses, numAddresses, &expected };
+
+        bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            ASSERT(0 == bslmt::ThreadUtil::create(&handles[i], load));
+        }
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+        }
+
+        bsl::vector<void *> distinct(addresses, addresses + numAddresses);
+        bsl::sort(distinct.begin(), distinct.end());
+        distinct.erase(bsl::unique(distinct.begin(), distinct.end()),
+                       distinct.end());
+
+        ASSERTV(Util::numCachedFrames(), distinct.size(),
+                distinct.size() == Util::numCachedFrames());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'loadStackTraceFromStack'
+        //
+        // Concerns:
+        //: 1 The stack trace loaded is that of the caller, and has the frames
+        //:   'balst::StackTraceUtil' resolves for the same addresses.
+        //:
+        //: 2 At most 'maxFrames' frames are loaded.
+        //:
+        //: 3 The frames loaded are cached.
+        //
+        // Plan:
+        //: 1 Load the stack trace of the stack, and compare it with the stack
+        //:   trace resolved by 'balst::StackTraceUtil' for its addresses.
+        //:   (C-1)
+        //:
+        //: 2 Load the stack trace with a small 'maxFrames', and verify its
+        //:   length.  (C-2)
+        //:
+        //: 3 Verify the number of cached frames.  (C-3)
+        //
+        // Testing:
+        //   int loadStackTraceFromStack(result, maxFrames, demangle);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'loadStackTraceFromStack'" << endl
+                          << "=================================" << endl;
+
+        if (!k_STACK_ADDRESSES_SUPPORTED) {
+            break;
+        }
+
+        Util::clearCache();
+
+        balst::StackTrace mX;  const balst::StackTrace& X = mX;
+        ASSERT(0 == Util::loadStackTraceFromStack(&mX));
+        ASSERT(0 <  X.length());
+        ASSERT(static_cast<bsl::size_t>(X.length()) >= Util::numCachedFrames()
+            && 0 < Util::numCachedFrames());
+
+        bsl::vector<const void *> addresses;
+        for (int i = 0; i < X.length(); ++i) {
+            addresses.push_back(X[i].address());
+        }
+
+        const int NUM_ADDRESSES = static_cast<int>(addresses.size());
+
+        balst::StackTrace expected;
+        ASSERT(0 == balst::StackTraceUtil::loadStackTraceFromAddressArray(
+                                                             &expected,
+                                                             addresses.data(),
+                                                             NUM_ADDRESSES));
+        ASSERT(expected == X);
+
+        balst::StackTrace mY;  const balst::StackTrace& Y = mY;
+        ASSERT(0 == Util::loadStackTraceFromStack(&mY, 2, false));
+        ASSERTV(Y.length(), 2 == Y.length());
+
+        // The first frames are those of distinct calls in this function, but
+        // their callers are the same.
+
+        ASSERT(X.length() < 2 || X[1].address() == Y[1].address());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'loadStackTraceFromAddressArray'
+        //
+        // Concerns:
+        //: 1 The stack trace loaded has the frames 'balst::StackTraceUtil'
+        //:   resolves for the same addresses, with and without demangling,
+        //:   whether or not the addresses are cached.
+        //:
+        //: 2 One frame is cached per distinct address and demangling
+        //:   preference, including for addresses repeated in one call.
+        //:
+        //: 3 Frames previously held by the result are discarded.
+        //:
+        //: 4 'clearCache' empties the cache.
+        //:
+        //: 5 The frames loaded are supplied by the allocator of the result,
+        //:   and loading cached frames does not use the default allocator.
+        //
+        // Plan:
+        //: 1 Capture stack addresses from two call depths.  Load each stack
+        //:   trace twice through the cache (with each demangling preference),
+        //:   and compare with the stack traces resolved by
+        //:   'balst::StackTraceUtil'.  Verify the number of cached frames
+        //:   after each load.  (C-1..3)
+        //:
+        //: 2 Load a stack trace with repeated addresses.  (C-2)
+        //:
+        //: 3 Clear the cache, and verify the number of cached frames.  (C-4)
+        //:
+        //: 4 Use a test allocator for the results, and verify that the
+        //:   default allocator is not used by a load of cached frames.  (C-5)
+        //
+        // Testing:
+        //   void clearCache();
+        //   int loadStackTraceFromAddressArray(result, addrs, num, demangle);
+        //   bsl::size_t numCachedFrames();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'loadStackTraceFromAddressArray'"
+                          << endl
+                          << "========================================"
+                          << endl;
+
+        if (!k_STACK_ADDRESSES_SUPPORTED) {
+            break;
+        }
+
+        bslma::TestAllocator ta("test", veryVerbose);
+
+        void      *shallow[k_MAX_FRAMES];
+        const int  numShallow = captureAddresses(shallow, 1);
+        void      *deep[k_MAX_FRAMES];
+        const int  numDeep = captureAddresses(deep, 4);
+        ASSERT(0 < numShallow);
+        ASSERT(numShallow < numDeep);
+
+        for (int demangle = 0; demangle < 2; ++demangle) {
+            const bool DEMANGLE = demangle;
+
+            if (veryVerbose) { T_ P(DEMANGLE) }
+
+            Util::clearCache();
+            ASSERT(0 == Util::numCachedFrames());
+
+            balst::StackTrace expectedShallow(&ta);
+            balst::StackTrace expectedDeep(&ta);
+            ASSERT(0 == balst::StackTraceUtil::loadStackTraceFromAddressArray(
+                                                              &expectedShallow,
+                                                              shallow,
+                                                              numShallow,
+                                                              DEMANGLE));
+            ASSERT(0 == balst::StackTraceUtil::loadStackTraceFromAddressArray(
+                                                              &expectedDeep,
+                                                              deep,
+                                                              numDeep,
+                                                              DEMANGLE));
+
+            balst::StackTrace mX(&ta);  const balst::StackTrace& X = mX;
+
+            ASSERT(0 == Util::loadStackTraceFromAddressArray(&mX,
+                                                             shallow,
+                                                             numShallow,
+                                                             DEMANGLE));
+            ASSERT(expectedShallow == X);
+            const bsl::size_t NUM_CACHED = Util::numCachedFrames();
+            ASSERT(0 < NUM_CACHED);
+            ASSERT(NUM_CACHED <= static_cast<bsl::size_t>(numShallow));
+
+            // Loading cached frames does not use the default allocator.
+
+            const bsls::Types::Int64 NUM_DEFAULT = da.numAllocations();
+
+            ASSERT(0 == Util::loadStackTraceFromAddressArray(&mX,
+                                                             shallow,
+                                                             numShallow,
+                                                             DEMANGLE));
+            ASSERT(expectedShallow == X);
+            ASSERT(NUM_CACHED == Util::numCachedFrames());
+
+            ASSERTV(da.numAllocations() - NUM_DEFAULT,
+                    NUM_DEFAULT == da.numAllocations());
+
+            ASSERT(0 == Util::loadStackTraceFromAddressArray(&mX,
+                                                             deep,
+                                                             numDeep,
+                                                             DEMANGLE));
+            ASSERT(expectedDeep == X);
+            ASSERT(NUM_CACHED <  Util::numCachedFrames());
+
+            ASSERT(0 == Util::loadStackTraceFromAddressArray(&mX,
+                                                             shallow,
+                                                             numShallow,
+                                                             DEMANGLE));
+            ASSERT(expectedShallow == X);
+
+            // The other demangling preference is cached separately.
+
+            const bsl::size_t NUM_BOTH = Util::numCachedFrames();
+            ASSERT(0 == Util::loadStackTraceFromAddressArray(&mX,
+                                                             shallow,
+                                                             numShallow,
+                                                             !DEMANGLE));
+            ASSERT(NUM_BOTH < Util::numCachedFrames());
+
+            // Repeated addresses.
+
+            Util::clearCache();
+            ASSERT(0 == Util::numCachedFrames());
+
+            const void *REPEATED[] = { shallow[0], shallow[1], shallow[0],
+                                       shallow[1], shallow[0] };
+            const int   NUM_REPEATED = sizeof REPEATED / sizeof *REPEATED;
+
+            ASSERT(0 == Util::loadStackTraceFromAddressArray(&mX,
+                                                             REPEATED,
+                                                             NUM_REPEATED,
+                                                             DEMANGLE));
+            ASSERT(NUM_REPEATED == X.length());
+            for (int i = 0; i < NUM_REPEATED; ++i) {
+                ASSERTV(i, expectedShallow[i % 2 ? 1 : 0] == X[i]);
+            }
+            ASSERT(2 == Util::numCachedFrames());
+
+            // No addresses.
+
+            ASSERT(0 == Util::loadStackTraceFromAddressArray(&mX,
+                                                             0,
+                                                             0,
+                                                             DEMANGLE));
+            ASSERT(0 == X.length());
+        }
+
+        if (verbose) cout << "\tNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            balst::StackTrace mX;
+            ASSERT_FAIL(Util::loadStackTraceFromAddressArray(0, 0, 0));
+            ASSERT_FAIL(Util::loadStackTraceFromAddressArray(&mX, 0, -1));
+            ASSERT_FAIL(Util::loadStackTraceFromAddressArray(&mX, 0, 1));
+            ASSERT_PASS(Util::loadStackTraceFromAddressArray(&mX, 0, 0));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Load a stack trace twice, and verify that the stack traces are
+        //:   the same, and that the cache is not empty.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        if (!k_STACK_ADDRESSES_SUPPORTED) {
+            break;
+        }
+
+        void      *addresses[k_MAX_FRAMES];
+        const int  numAddresses = captureAddresses(addresses, 2);
+
+        balst::StackTrace mX;  const balst::StackTrace& X = mX;
+        balst::StackTrace mY;  const balst::StackTrace& Y = mY;
+
+        ASSERT(0 == Util::loadStackTraceFromAddressArray(&mX,
+                                                         addresses,
+                                                         numAddresses));
+        ASSERT(0 <  Util::numCachedFrames());
+        ASSERT(0 == Util::loadStackTraceFromAddressArray(&mY,
+                                                         addresses,
+                                                         numAddresses));
+        ASSERT(numAddresses == X.length());
+        ASSERT(X == Y);
+
+        if (veryVerbose) {
+            balst::StackTraceUtil::printFormatted(cout, X);
+        }
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 Loading a stack trace whose addresses are cached is much faster
+        //:   than resolving it.
+        //
+        // Plan:
+        //: 1 Load the same stack trace repeatedly by 'balst::StackTraceUtil'
+        //:   and through the cache, and report the time per load.  The number
+        //:   of iterations may be supplied as the second argument (default
+        //:   20).
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        const int NUM_ITERATIONS = argc > 2 && 0 < bsl::atoi(argv[2])
+                                 ? bsl::atoi(argv[2])
+                                 : 20;
+
+        void      *addresses[k_MAX_FRAMES];
+        const int  numAddresses = captureAddresses(addresses, 5);
+
+        balst::StackTrace stackTrace(bslma::Default::globalAllocator());
+        bsls::Stopwatch   timer;
+
+        timer.start();
+        for (int i = 0; i < NUM_ITERATIONS; ++i) {
+            balst::StackTraceUtil::loadStackTraceFromAddressArray(
+                                                                 &stackTrace,
+                                                                 addresses,
+                                                                 numAddresses);
+        }
+        timer.stop();
+        const double uncachedTime = timer.elapsedTime() / NUM_ITERATIONS;
+
+        Util::clearCache();
+
+        timer.reset();
+        timer.start();
+        Util::loadStackTraceFromAddressArray(&stackTrace,
+                                             addresses,
+                                             numAddresses);
+        timer.stop();
+        const double firstTime = timer.elapsedTime();
+
+        timer.reset();
+        timer.start();
+        for (int i = 0; i < NUM_ITERATIONS; ++i) {
+            Util::loadStackTraceFromAddressArray(&stackTrace,
+                                                 addresses,
+                                                 numAddresses);
+        }
+        timer.stop();
+        const double cachedTime = timer.elapsedTime() / NUM_ITERATIONS;
+
+        cout << numAddresses << " frames: StackTraceUtil "
+             << uncachedTime * 1e6 << " us, first cached load "
+             << firstTime * 1e6 << " us, cached load "
+             << cachedTime * 1e6 << " us" << endl;
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,419 @@
+// balst_heapprofileallocator.cpp                                     -*-C++-*-
+#include <balst_heapprofileallocator.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(balst_heapprofileallocator_cpp,"$Id$ $CSID$")
+
+#include <bslma_mallocfreeallocator.h>
+
+#include <bslmt_lockguard.h>
+#include <bslmt_once.h>
+#include <bslmt_threadlocalvariable.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_performancehint.h>
+#include <bsls_platform.h>
+#include <bsls_stackaddressutil.h>
+#include <bsls_timeutil.h>
+
+#include <bsl_cmath.h>
+#include <bsl_fstream.h>
+#include <bsl_iomanip.h>
+#include <bsl_limits.h>
+#include <bsl_ostream.h>
+
+///Implementation Notes
+///--------------------
+// The sampling process is tracked per thread in units of sampling intervals:
+// each thread holds the (exponentially distributed, with mean 1) distance to
+// its next sampled byte, and an allocation of 'size' bytes from an allocator
+// having a sampling interval 'I' consumes 'size / I' of that distance.
+// Because the exponential distribution is memoryless, the allocations of each
+// allocator are sampled as in a Poisson process of rate '1 / I' over its
+// bytes, even though the threads share their state among all the allocators
+// of the process.  The state of each thread is held in thread-local
+// variables, or, on platforms not supporting 'BSLMT_THREAD_LOCAL_VARIABLE', in
+// thread-specific storage supplied by the 'bslma::MallocFreeAllocator'
+// singleton.
+//
+// Every block is preceded by a maximally-aligned 'BlockHeader' holding the
+// address of the profile entry of its call stack and its requested size if
+// it was sampled, or a null entry address otherwise.
+
+namespace BloombergLP {
+namespace balst {
+namespace {
+namespace u {
+
+typedef bsls::Types::Uint64 Uint64;
+
+union BlockHeader {
+    // This 'union' describes the header preceding each block.
+
+    struct {
+        void        *d_entry_p;  // profile entry of the call stack of a
+                                 // sampled block, or 0
+
+        bsl::size_t  d_size;     // requested size of a sampled block
+    }                                   d_sample;
+
+    bsls::AlignmentUtil::MaxAlignedType d_alignment;  // force alignment
+};
+
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+BSLMT_THREAD_LOCAL_VARIABLE(double, t_distance, 0);
+BSLMT_THREAD_LOCAL_VARIABLE(Uint64, t_random, 0);
+#else
+struct ThreadState {
+    // This 'struct' holds the sampling state of a thread.
+
+    double d_distance;  // distance, in sampling intervals, to the next
+                        // sampled byte
+
+    Uint64 d_random;    // state of the random number generator, or 0 if not
+                        // yet seeded
+};
+
+bslmt::ThreadUtil::Key s_stateKey;
+
+extern "C" void deleteThreadState(void *state)
+    // Deallocate the specified 'state' of an exiting thread.
+{
+    bslma::MallocFreeAllocator::singleton().deallocate(state);
+}
+#endif
+
+Uint64 seed()
+    // Return a non-zero seed for the random number generator of the calling
+    // thread.
+{
+    Uint64 result = static_cast<Uint64>(bsls::TimeUtil::getTimer())
+                  ^ (bslmt::ThreadUtil::selfIdAsUint64()
+                                                     * 0x9E3779B97F4A7C15ULL);
+    return result ? result : 1;
+}
+
+double exponential(Uint64 *random)
+    // Return a random number exponentially distributed with mean 1, drawn
+    // using (and updating) the specified 'random' state of an 'xorshift64*'
+    // generator.
+{
+    Uint64 x = *random;
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    *random = x;
+
+    // Take the high 53 bits of the output as a number in '(0, 1]'.
+
+    const double uniform = static_cast<double>(
+                                     ((x * 2685821657736338717ULL) >> 11) + 1)
+                         * (1.0 / 9007199254740992.0);
+    return -bsl::log(uniform);
+}
+
+bool isSampled(double *distance, Uint64 *random, double consumed)
+    // Subtract the specified 'consumed' from the specified 'distance' to the
+    // next sampled byte of a thread whose random number generator has the
+    // specified 'random' state, and return 'true' if the next sampled byte is
+    // reached (drawing the distance to the one after it), and 'false'
+    // otherwise.
+{
+    *distance -= consumed;
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(0 < *distance)) {
+        return false;                                                 // RETURN
+    }
+    BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+    if (0 == *random) {
+        // First allocation of this thread: draw its first distance.
+
+        *random   = seed();
+        *distance = exponential(random) - consumed;
+        if (0 < *distance) {
+            return false;                                             // RETURN
+        }
+    }
+
+    *distance = exponential(random);
+    return true;
+}
+
+bool isSampled(double consumed)
+    // Consume the specified 'consumed' sampling intervals of the distance of
+    // the calling thread to its next sampled byte, and return 'true' if the
+    // next sampled byte is reached, and 'false' otherwise.
+{
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+    return isSampled(&t_distance, &t_random, consumed);
+#else
+    BSLMT_ONCE_DO {
+        bslmt::ThreadUtil::createKey(&s_stateKey, &deleteThreadState);
+    }
+
+    ThreadState *state = static_cast<ThreadState *>(
+                                   bslmt::ThreadUtil::getSpecific(s_stateKey));
+    if (!state) {
+        state = static_cast<ThreadState *>(
+                       bslma::MallocFreeAllocator::singleton().allocate(
+                                                         sizeof(ThreadState)));
+        state->d_distance = 0;
+        state->d_random   = 0;
+        bslmt::ThreadUtil::setSpecific(s_stateKey, state);
+    }
+    return isSampled(&state->d_distance, &state->d_random, consumed);
+#endif
+}
+
+void writeCounts(bsl::ostream&      stream,
+                 bsls::Types::Int64 numLive,
+                 bsls::Types::Int64 liveBytes,
+                 bsls::Types::Int64 numSamples,
+                 bsls::Types::Int64 sampledBytes)
+    // Write to the specified 'stream' the specified 'numLive', 'liveBytes',
+    // 'numSamples', and 'sampledBytes' in the format of the counts of a
+    // 'heap_v2' profile.
+{
+    stream << bsl::setw(6) << numLive    << ": "
+           << bsl::setw(8) << liveBytes  << " ["
+           << bsl::setw(6) << numSamples << ": "
+           << bsl::setw(8) << sampledBytes << "] @";
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+                         // --------------------------
+                         // class HeapProfileAllocator
+                         // --------------------------
+
+// CREATORS
+HeapProfileAllocator::HeapProfileAllocator(bslma::Allocator *basicAllocator)
+: d_samplingInterval(k_DEFAULT_SAMPLING_INTERVAL)
+, d_samplingRate(1.0 / k_DEFAULT_SAMPLING_INTERVAL)
+, d_maxRecordedFrames(k_DEFAULT_MAX_FRAMES)
+, d_profile(basicAllocator ? basicAllocator
+                           : &bslma::MallocFreeAllocator::singleton())
+, d_numLiveSamples(0)
+, d_numSamples(0)
+, d_allocator_p(basicAllocator ? basicAllocator
+                               : &bslma::MallocFreeAllocator::singleton())
+{
+}
+
+HeapProfileAllocator::HeapProfileAllocator(
+                                       bsls::Types::Int64  samplingInterval,
+                                       bslma::Allocator   *basicAllocator)
+: d_samplingInterval(samplingInterval)
+, d_samplingRate(0 < samplingInterval
+                 ? 1.0 / static_cast<double>(samplingInterval)
+                 : bsl::numeric_limits<double>::infinity())
+, d_maxRecordedFrames(k_DEFAULT_MAX_FRAMES)
+, d_profile(basicAllocator ? basicAllocator
+                           : &bslma::MallocFreeAllocator::singleton())
+, d_numLiveSamples(0)
+, d_numSamples(0)
+, d_allocator_p(basicAllocator ? basicAllocator
+                               : &bslma::MallocFreeAllocator::singleton())
+{
+    BSLS_ASSERT(0 <= samplingInterval);
+}
+
+HeapProfileAllocator::HeapProfileAllocator(
+                                       bsls::Types::Int64  samplingInterval,
+                                       int                 maxRecordedFrames,
+                                       bslma::Allocator   *basicAllocator)
+: d_samplingInterval(samplingInterval)
+, d_samplingRate(0 < samplingInterval
+                 ? 1.0 / static_cast<double>(samplingInterval)
+                 : bsl::numeric_limits<double>::infinity())
+, d_maxRecordedFrames(maxRecordedFrames)
+, d_profile(basicAllocator ? basicAllocator
+                           : &bslma::MallocFreeAllocator::singleton())
+, d_numLiveSamples(0)
+, d_numSamples(0)
+, d_allocator_p(basicAllocator ? basicAllocator
+                               : &bslma::MallocFreeAllocator::singleton())
+{
+    BSLS_ASSERT(0 <= samplingInterval);
+    BSLS_ASSERT(0 <  maxRecordedFrames);
+}
+
+HeapProfileAllocator::~HeapProfileAllocator()
+{
+    BSLS_ASSERT(0 == d_numLiveSamples);
+}
+
+// MANIPULATORS
+void *HeapProfileAllocator::allocate(size_type size)
+{
+    if (0 == size) {
+        return 0;                                                     // RETURN
+    }
+
+    u::BlockHeader *header = static_cast<u::BlockHeader *>(
+                       d_allocator_p->allocate(sizeof(u::BlockHeader) + size));
+
+    // Note that 'd_samplingRate' is infinite if every allocation is sampled.
+
+    const double consumed =
+                static_cast<double>(static_cast<bsls::Types::Int64>(size))
+              * d_samplingRate;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(!u::isSampled(consumed))) {
+        header->d_sample.d_entry_p = 0;
+        return header + 1;                                            // RETURN
+    }
+    BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+    // The value 'k_IGNORE_FRAMES' indicates the number of frames to be ignored
+    // because they are within the stack trace facility, or this function.
+
+    enum { k_IGNORE_FRAMES = bsls::StackAddressUtil::k_IGNORE_FRAMES + 1 };
+
+    bsl::vector<void *> stack(d_allocator_p);
+    stack.resize(d_maxRecordedFrames + k_IGNORE_FRAMES);
+
+#if !defined(BSLS_PLATFORM_OS_CYGWIN)
+    int numAddresses = bsls::StackAddressUtil::getStackAddresses(
+                                               stack.data(),
+                                               static_cast<int>(stack.size()));
+#else
+    int numAddresses = 0;
+#endif
+    if (numAddresses < k_IGNORE_FRAMES) {
+        numAddresses = k_IGNORE_FRAMES;
+    }
+    stack.resize(numAddresses);
+    stack.erase(stack.begin(), stack.begin() + k_IGNORE_FRAMES);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    ProfileEntry& entry = d_profile[stack];  // zero-initialized if new
+    ++entry.d_numLive;
+    entry.d_liveBytes += size;
+    ++entry.d_numSamples;
+    entry.d_sampledBytes += size;
+
+    ++d_numLiveSamples;
+    ++d_numSamples;
+
+    header->d_sample.d_entry_p = &entry;
+    header->d_sample.d_size    = size;
+    return header + 1;
+}
+
+void HeapProfileAllocator::deallocate(void *address)
+{
+    if (0 == address) {
+        return;                                                       // RETURN
+    }
+
+    u::BlockHeader *header = static_cast<u::BlockHeader *>(address) - 1;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                                          0 != header->d_sample.d_entry_p)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        ProfileEntry *entry = static_cast<ProfileEntry *>(
+                                                   header->d_sample.d_entry_p);
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        --entry->d_numLive;
+        entry->d_liveBytes -= header->d_sample.d_size;
+        --d_numLiveSamples;
+    }
+
+    d_allocator_p->deallocate(header);
+}
+
+// ACCESSORS
+bsls::Types::Int64 HeapProfileAllocator::numLiveSamples() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return d_numLiveSamples;
+}
+
+bsls::Types::Int64 HeapProfileAllocator::numSamples() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return d_numSamples;
+}
+
+bsl::ostream& HeapProfileAllocator::writeProfile(bsl::ostream& stream) const
+{
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        bsls::Types::Int64 liveBytes    = 0;
+        bsls::Types::Int64 sampledBytes = 0;
+        for (Profile::const_iterator it = d_profile.begin();
+             d_profile.end() != it;
+             ++it) {
+            liveBytes    += it->second.d_liveBytes;
+            sampledBytes += it->second.d_sampledBytes;
+        }
+
+        stream << "heap profile: ";
+        u::writeCounts(stream,
+                       d_numLiveSamples,
+                       liveBytes,
+                       d_numSamples,
+                       sampledBytes);
+        stream << " heap_v2/" << d_samplingInterval << '\n';
+
+        for (Profile::const_iterator it = d_profile.begin();
+             d_profile.end() != it;
+             ++it) {
+            const ProfileEntry& entry = it->second;
+
+            u::writeCounts(stream,
+                           entry.d_numLive,
+                           entry.d_liveBytes,
+                           entry.d_numSamples,
+                           entry.d_sampledBytes);
+
+            const bsl::vector<void *>& stack = it->first;
+            for (bsl::size_t i = 0; i < stack.size(); ++i) {
+                stream << ' ' << stack[i];
+            }
+            stream << '\n';
+        }
+    }
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    // Append the memory map of the process, from which 'pprof' finds the
+    // object file mapped at each address.
+
+    bsl::ifstream maps("/proc/self/maps");
+    if (maps) {
+        stream << "\nMAPPED_LIBRARIES:\n" << maps.rdbuf();
+    }
+#endif
+
+    return stream;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,323 @@
+// balst_heapprofileallocator.h                                       -*-C++-*-
+#ifndef INCLUDED_BALST_HEAPPROFILEALLOCATOR
+#define INCLUDED_BALST_HEAPPROFILEALLOCATOR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an allocator that samples allocations into a heap profile.
+//
+//@CLASSES:
+//  balst::HeapProfileAllocator: allocator recording a sampled heap profile
+//
+//@SEE_ALSO: balst_stacktracetestallocator, bsls_stackaddressutil
+//
+//@DESCRIPTION: This component provides an allocator,
+// 'balst::HeapProfileAllocator', implementing the 'bslma::Allocator'
+// protocol, that forwards allocations to an underlying allocator, and records
+// the call stacks of a random sample of the allocations in a heap profile that
+// can be written in the legacy text format understood by the 'pprof' tool.
+//
+// Unlike 'balst::StackTraceTestAllocator', which records the call stack of
+// every allocation and is intended for tests, this allocator is intended to
+// be installed (e.g., as the global or default allocator) in production
+// processes, to find the call sites responsible for most of the memory
+// allocated, or in use.
+//
+///Sampling
+///--------
+// Allocations are sampled as in a Poisson process over the allocated bytes:
+// every allocated byte has the same probability, '1 / samplingInterval', of
+// being sampled, and an allocation is sampled if any of its bytes is sampled.
+// The mean distance, in bytes, between two sampled bytes is therefore the
+// sampling interval supplied at construction (512 KiB by default), and an
+// allocation of 'size' bytes is sampled with probability
+// '1 - exp(-size / samplingInterval)': large allocations are almost always
+// sampled, and small allocations rarely are.  A sampling interval of 0 samples
+// every allocation.
+//
+// The distance to the next sampled byte is tracked per thread, so that an
+// allocation that is not sampled involves neither a lock nor an atomic
+// operation.  The call stack of a sampled allocation is obtained by
+// 'bsls::StackAddressUtil::getStackAddresses' (without resolving any symbol),
+// and is recorded under a lock.
+//
+///Heap Profile
+///------------
+// The allocator keeps, for every distinct call stack of a sampled allocation,
+// the number and total size (as requested) of the sampled allocations:
+//
+//: o that are live, i.e., have not been deallocated (the *in-use* profile),
+//:   and
+//:
+//: o that were made since this allocator was created (the *cumulative*
+//:   profile).
+//
+// 'writeProfile' writes both profiles to a stream in the legacy 'heap_v2' text
+// format of 'pprof' (as produced by the heap profiler of 'gperftools'), that
+// records the raw return addresses of each call stack, followed (on Linux) by
+// the memory map of the process, so that 'pprof' resolves the symbols itself.
+// 'pprof' scales the sampled counts by the sampling interval written in the
+// profile to estimate the actual number and size of the allocations.  For
+// example, a profile written to 'heap.prof' is viewed by:
+//..
+//  pprof --inuse_space program heap.prof   # live bytes per call site
+//  pprof --alloc_space program heap.prof   # cumulative bytes per call site
+//..
+//
+///Overhead
+///--------
+// Every block is allocated from the underlying allocator with a header of
+// 'bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT' bytes that records whether the
+// block was sampled.  An allocation that is not sampled adds to the cost of
+// the underlying allocation only the update of a thread-local counter, and a
+// deallocation of a block that was not sampled only the test of its header.
+// With the default sampling interval, the cost of the sampled allocations
+// (which capture the stack, and update the profile) is amortized over hundreds
+// of kilobytes of allocations.
+//
+// Note that, like 'balst::StackTraceTestAllocator', this allocator does not
+// use the currently installed default allocator, but (by default) the
+// 'bslma::MallocFreeAllocator' singleton, both for the blocks it supplies, and
+// for the profile, so that it can be installed as the default or global
+// allocator.
+//
+///Thread Safety
+///-------------
+// 'balst::HeapProfileAllocator' is fully thread-safe, meaning that all
+// non-creator operations on an object can be safely invoked simultaneously
+// from multiple threads.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Profiling the Allocations of a Computation
+///- - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we want to know which functions allocate the memory in use by
+// a computation.  First, we define the functions of the computation, which
+// allocate memory from the default allocator:
+//..
+//  void buildTable(bsl::vector<bsl::string> *table, int size)
+//      // Append the specified 'size' strings to the specified 'table'.
+//  {
+//      for (int i = 0; i < size; ++i) {
+//          table->push_back(bsl::string(1000, 'x'));
+//      }
+//  }
+//..
+// Then, we create a heap profile allocator sampling on average one allocation
+// every 64 KiB, and install it as the default allocator:
+//..
+//  balst::HeapProfileAllocator  profiler(64 * 1024);
+//  bslma::DefaultAllocatorGuard guard(&profiler);
+//..
+// Next, we run the computation:
+//..
+//  bsl::vector<bsl::string> table;
+//  buildTable(&table, 1000);
+//..
+// Now, we observe that some of the allocations were sampled, and that some of
+// the sampled allocations (e.g., those of the strings) are still live:
+//..
+//  assert(0 < profiler.numSamples());
+//  assert(0 < profiler.numLiveSamples());
+//  assert(profiler.numLiveSamples() <= profiler.numSamples());
+//..
+// Finally, we write the heap profile (to a file that would be given to
+// 'pprof' along with the program), and verify that it starts with the header
+// of a 'heap_v2' profile:
+//..
+//  bsl::ostringstream profile;
+//  profiler.writeProfile(profile);
+//
+//  assert(0 == profile.str().find("heap profile: "));
+//  assert(bsl::string::npos != profile.str().find("@ heap_v2/65536\n"));
+//..
+
+#include <balscm_version.h>
+
+#include <bslma_allocator.h>
+
+#include <bslmt_mutex.h>
+
+#include <bsls_keyword.h>
+#include <bsls_types.h>
+
+#include <bsl_iosfwd.h>
+#include <bsl_map.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace balst {
+
+                         // ==========================
+                         // class HeapProfileAllocator
+                         // ==========================
+
+class HeapProfileAllocator : public bslma::Allocator {
+    // This class provides an allocator that forwards allocations to an
+    // underlying allocator, and records the call stacks of a random sample of
+    // the allocations in a heap profile.  See the component documentation for
+    // details.
+
+  public:
+    // PUBLIC CONSTANTS
+    enum {
+        k_DEFAULT_SAMPLING_INTERVAL = 512 * 1024,  // mean distance, in bytes,
+                                                   // between sampled bytes
+
+        k_DEFAULT_MAX_FRAMES        = 64           // maximum number of frames
+                                                   // recorded per sample
+    };
+
+  private:
+    // PRIVATE TYPES
+    struct ProfileEntry {
+        // This 'struct' holds the sampled allocations of one call stack.
+
+        bsls::Types::Int64 d_numLive;       // number of live samples
+        bsls::Types::Int64 d_liveBytes;     // size of live samples
+        bsls::Types::Int64 d_numSamples;    // number of samples
+        bsls::Types::Int64 d_sampledBytes;  // size of samples
+    };
+
+    typedef bsl::map<bsl::vector<void *>, ProfileEntry> Profile;
+        // 'Profile' is an alias for a map from call stack to the sampled
+        // allocations made from it.
+
+    // DATA
+    bsls::Types::Int64  d_samplingInterval;   // mean bytes between samples,
+                                              // or 0 to sample all
+
+    double              d_samplingRate;       // '1 / d_samplingInterval', or
+                                              // infinity to sample all
+
+    int                 d_maxRecordedFrames;  // frames recorded per sample
+
+    Profile             d_profile;            // sampled allocations per call
+                                              // stack
+
+    bsls::Types::Int64  d_numLiveSamples;     // number of live samples
+
+    bsls::Types::Int64  d_numSamples;         // number of samples
+
+    mutable bslmt::Mutex
+                        d_mutex;              // protects the profile, and the
+                                              // sample counts
+
+    bslma::Allocator   *d_allocator_p;        // underlying allocator (held,
+                                              // not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    HeapProfileAllocator(const HeapProfileAllocator&);
+    HeapProfileAllocator& operator=(const HeapProfileAllocator&);
+
+  public:
+    // CREATORS
+    explicit
+    HeapProfileAllocator(bslma::Allocator *basicAllocator = 0);
+    explicit
+    HeapProfileAllocator(bsls::Types::Int64  samplingInterval,
+                         bslma::Allocator   *basicAllocator = 0);
+    HeapProfileAllocator(bsls::Types::Int64  samplingInterval,
+                         int                 maxRecordedFrames,
+                         bslma::Allocator   *basicAllocator = 0);
+        // Create a heap profile allocator having an empty profile.  Optionally
+        // specify 'samplingInterval', the mean distance, in bytes, between two
+        // sampled bytes; if 'samplingInterval' is 0, every allocation is
+        // sampled; if 'samplingInterval' is not specified,
+        // 'k_DEFAULT_SAMPLING_INTERVAL' is used.  Optionally specify
+        // 'maxRecordedFrames', the maximum number of frames recorded for the
+        // call stack of a sampled allocation; if 'maxRecordedFrames' is not
+        // specified, 'k_DEFAULT_MAX_FRAMES' is used.  Optionally specify a
+        // 'basicAllocator' from which the blocks, and the memory of the
+        // profile, are supplied.  If 'basicAllocator' is 0, the
+        // 'bslma::MallocFreeAllocator' singleton is used.  The behavior is
+        // undefined unless '0 <= samplingInterval' and
+        // '0 < maxRecordedFrames'.
+
+    virtual ~HeapProfileAllocator();
+        // Destroy this allocator.  The behavior is undefined unless all of the
+        // blocks allocated from this object have been deallocated.
+
+    // MANIPULATORS
+    virtual void *allocate(size_type size) BSLS_KEYWORD_OVERRIDE;
+        // Return a newly allocated block of memory of (at least) the specified
+        // positive 'size' (in bytes), supplied by the underlying allocator.
+        // If 'size' is 0, a null pointer is returned with no other effect.  If
+        // the allocation is sampled, record its call stack in the profile.
+        // The returned block is maximally aligned.
+
+    virtual void deallocate(void *address) BSLS_KEYWORD_OVERRIDE;
+        // Return the memory block at the specified 'address' back to the
+        // underlying allocator.  If 'address' is 0, this function has no
+        // effect.  If the block was sampled, remove it from the in-use
+        // profile.  The behavior is undefined unless 'address' was allocated
+        // from this object, and has not already been deallocated.
+
+    // ACCESSORS
+    int maxRecordedFrames() const;
+        // Return the maximum number of frames recorded for the call stack of
+        // a sampled allocation.
+
+    bsls::Types::Int64 numLiveSamples() const;
+        // Return the number of sampled allocations that have not been
+        // deallocated.
+
+    bsls::Types::Int64 numSamples() const;
+        // Return the number of allocations sampled since this object was
+        // created.
+
+    bsls::Types::Int64 samplingInterval() const;
+        // Return the mean distance, in bytes, between two sampled bytes, or 0
+        // if every allocation is sampled.
+
+    bsl::ostream& writeProfile(bsl::ostream& stream) const;
+        // Write the in-use and cumulative heap profiles of this allocator to
+        // the specified 'stream' in the 'heap_v2' text format of 'pprof' (see
+        // {Heap Profile}), and return a reference to 'stream'.
+};
+
+// ============================================================================
+//                           INLINE DEFINITIONS
+// ============================================================================
+
+                         // --------------------------
+                         // class HeapProfileAllocator
+                         // --------------------------
+
+// ACCESSORS
+inline
+int HeapProfileAllocator::maxRecordedFrames() const
+{
+    return d_maxRecordedFrames;
+}
+
+inline
+bsls::Types::Int64 HeapProfileAllocator::samplingInterval() const
+{
+    return d_samplingInterval;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,904 @@
+// balst_heapprofileallocator.t.cpp                                   -*-C++-*-
+#include <balst_heapprofileallocator.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_mallocfreeallocator.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_threadutil.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_asserttest.h>
+#include <bsls_platform.h>
+#include <bsls_stackaddressutil.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_map.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is an allocator that forwards allocations to an
+// underlying allocator, and records the call stacks of a random sample of
+// them.  We verify the forwarding with a test allocator as the underlying
+// allocator, the bookkeeping of the profile with a sampling interval of 0
+// (which samples every allocation), the statistics of the sampling with a
+// positive sampling interval, and the format of the profile written.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] HeapProfileAllocator(bslma::Allocator *basicAllocator = 0);
+// [ 2] HeapProfileAllocator(Int64 interval, bslma::Allocator * = 0);
+// [ 2] HeapProfileAllocator(Int64 interval, int maxFrames, Alloc * = 0);
+// [ 2] ~HeapProfileAllocator();
+//
+// MANIPULATORS
+// [ 3] void *allocate(size_type size);
+// [ 3] void deallocate(void *address);
+//
+// ACCESSORS
+// [ 2] int maxRecordedFrames() const;
+// [ 3] bsls::Types::Int64 numLiveSamples() const;
+// [ 3] bsls::Types::Int64 numSamples() const;
+// [ 2] bsls::Types::Int64 samplingInterval() const;
+// [ 4] bsl::ostream& writeProfile(bsl::ostream& stream) const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] CONCERN: allocations are sampled at the documented rate
+// [ 6] CONCERN: concurrent allocations and deallocations
+// [ 7] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                     NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+#define ASSERT_PASS_RAW(EXPR)  BSLS_ASSERTTEST_ASSERT_PASS_RAW(EXPR)
+#define ASSERT_FAIL_RAW(EXPR)  BSLS_ASSERTTEST_ASSERT_FAIL_RAW(EXPR)
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef balst::HeapProfileAllocator Obj;
+typedef bsls::Types::Int64          Int64;
+
+#if defined(BSLS_PLATFORM_OS_CYGWIN)
+    enum { k_STACK_ADDRESSES_SUPPORTED = 0 };
+#else
+    enum { k_STACK_ADDRESSES_SUPPORTED = 1 };
+#endif
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static void *allocateAndCapture(Obj        *allocator,
+                                int         size,
+                                void      **callerAddress)
+    // Allocate a block of the specified 'size' from the specified
+    // 'allocator', load into the specified 'callerAddress' the return address
+    // of this call, and return the address of the block.
+{
+    void *block = allocator->allocate(size);
+
+    enum { k_IGNORE_FRAMES = bsls::StackAddressUtil::k_IGNORE_FRAMES };
+
+    void      *addresses[k_IGNORE_FRAMES + 2];
+    const int  numAddresses = bsls::StackAddressUtil::getStackAddresses(
+                                                         addresses,
+                                                         k_IGNORE_FRAMES + 2);
+    *callerAddress = numAddresses == k_IGNORE_FRAMES + 2
+                   ? addresses[k_IGNORE_FRAMES + 1]
+                   : 0;
+    return block;
+}
+
+static bsl::vector<bsl::string> profileLines(const bsl::string& profile)
+    // Return the lines of the specified 'profile' preceding its memory map.
+{
+    bsl::vector<bsl::string> result;
+    bsl::istringstream       stream(profile);
+    bsl::string              line;
+    while (bsl::getline(stream, line) && !line.empty()) {
+        result.push_back(line);
+    }
+    return result;
+}
+
+struct ConcurrentAllocate {
+    // This 'struct' is a functor allocating and deallocating blocks.
+
+    // DATA
+    Obj *d_allocator_p;  // allocator (held, not owned)
+    int  d_numBlocks;    // number of blocks to allocate
+
+    void operator()() const
+        // Allocate the blocks of this object, deallocating every other block
+        // at once, and the others at the end.
+    {
+        bsl::vector<void *> blocks(bslma::Default::globalAllocator());
+        for (int i = 0; i < d_numBlocks; ++i) {
+            void *block = d_allocator_p->allocate(1 + i % 100);
+            if (i % 2) {
+                d_allocator_p->deallocate(block);
+            }
+            else {
+                blocks.push_back(block);
+            }
+        }
+        for (bsl::size_t i = 0; i < blocks.size(); ++i) {
+            d_allocator_p->deallocate(blocks[i]);
+        }
+    }
+};
+
+// ============================================================================
+//                              USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Example 1: Profiling the Allocations of a Computation
+///- - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we want to know which functions allocate the memory in use by
+// a computation.  First, we define the functions of the computation, which
+// allocate memory from the default allocator:
+//..
+    void buildTable(bsl::vector<bsl::string> *table, int size)
+        // Append the specified 'size' strings to the specified 'table'.
+    {
+        for (int i = 0; i < size; ++i) {
+            table->push_back(bsl::string(1000, 'x'));
+        }
+    }
+//..
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator         da("default", veryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+// Then, we create a heap profile allocator sampling on average one allocation
+// every 64 KiB, and install it as the default allocator:
+//..
+    balst::HeapProfileAllocator  profiler(64 * 1024);
+    bslma::DefaultAllocatorGuard guard(&profiler);
+//..
+// Next, we run the computation:
+//..
+    bsl::vector<bsl::string> table;
+    buildTable(&table, 1000);
+//..
+// Now, we observe that some of the allocations were sampled, and that some of
+// the sampled allocations (e.g., those of the strings) are still live:
+//..
+    ASSERT(0 < profiler.numSamples());
+    ASSERT(0 < profiler.numLiveSamples());
+    ASSERT(profiler.numLiveSamples() <= profiler.numSamples());
+//..
+// Finally, we write the heap profile (to a file that would be given to
+// 'pprof' along with the program), and verify that it starts with the header
+// of a 'heap_v2' profile:
+//..
+    bsl::ostringstream profile;
+    profiler.writeProfile(profile);
+
+    ASSERT(0 == profile.str().find("heap profile: "));
+    ASSERT(bsl::string::npos != profile.str().find("@ heap_v2/65536\n"));
+//..
+
+        if (veryVerbose) {
+            cout << profile.str();
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONCERN: CONCURRENT ALLOCATIONS AND DEALLOCATIONS
+        //
+        // Concerns:
+        //: 1 Allocations and deallocations made concurrently by several
+        //:   threads are all recorded, and all memory is returned to the
+        //:   underlying allocator.
+        //
+        // Plan:
+        //: 1 Allocate and deallocate blocks from several threads, with a
+        //:   sampling interval of 0 and a positive one, and verify the sample
+        //:   counts and the memory in use of the underlying allocator.  (C-1)
+        //
+        // Testing:
+        //   CONCERN: concurrent allocations and deallocations
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                       << "CONCERN: CONCURRENT ALLOCATIONS AND DEALLOCATIONS"
+                       << endl
+                       << "================================================="
+                       << endl;
+
+        enum { k_NUM_THREADS = 4, k_NUM_BLOCKS = 2000 };
+
+        const Int64 INTERVALS[] = { 0, 64 };
+
+        for (int ti = 0; ti < 2; ++ti) {
+            const Int64 INTERVAL = INTERVALS[ti];
+
+            if (veryVerbose) { T_ P(INTERVAL) }
+
+            bslma::TestAllocator ta("underlying", veryVerbose);
+            Obj                  mX(INTERVAL, &ta);  const Obj& X = mX;
+
+            bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ConcurrentAllocate allocate = { &mX, k_NUM_BLOCKS };
+                ASSERT(0 == bslmt::ThreadUtil::create(&handles[i],
+                                                      allocate));
+            }
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+            }
+
+            ASSERTV(INTERVAL, X.numLiveSamples(), 0 == X.numLiveSamples());
+            if (0 == INTERVAL) {
+                ASSERTV(X.numSamples(),
+                        k_NUM_THREADS * k_NUM_BLOCKS == X.numSamples());
+            }
+            else {
+                ASSERTV(X.numSamples(), 0 < X.numSamples());
+                ASSERTV(X.numSamples(),
+                        k_NUM_THREADS * k_NUM_BLOCKS > X.numSamples());
+            }
+
+            // Only the profile remains allocated.
+
+            const Int64 NUM_PROFILE_BLOCKS = ta.numBlocksInUse();
+            ASSERTV(NUM_PROFILE_BLOCKS,
+                    NUM_PROFILE_BLOCKS <= 2 * X.numSamples());
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCERN: ALLOCATIONS ARE SAMPLED AT THE DOCUMENTED RATE
+        //
+        // Concerns:
+        //: 1 An allocation of 'size' bytes is sampled with probability
+        //:   '1 - exp(-size / samplingInterval)'.
+        //:
+        //: 2 An allocation much larger than the sampling interval is always
+        //:   sampled.
+        //
+        // Plan:
+        //: 1 Make many small allocations, and verify that the number of
+        //:   samples is within 5 standard deviations of the expected number.
+        //:   (C-1)
+        //:
+        //: 2 Make allocations of 100 sampling intervals, and verify that they
+        //:   are all sampled.  (C-2)
+        //
+        // Testing:
+        //   CONCERN: allocations are sampled at the documented rate
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                   << "CONCERN: ALLOCATIONS ARE SAMPLED AT THE DOCUMENTED RATE"
+                   << endl
+                   << "======================================================="
+                   << endl;
+
+        enum { k_INTERVAL = 4096, k_SIZE = 256, k_NUM_ALLOCATIONS = 20000 };
+
+        bslma::TestAllocator ta("underlying", veryVerbose);
+        Obj                  mX(k_INTERVAL, &ta);  const Obj& X = mX;
+
+        for (int i = 0; i < k_NUM_ALLOCATIONS; ++i) {
+            mX.deallocate(mX.allocate(k_SIZE));
+        }
+
+        // Expected: 20000 * (1 - exp(-1/16)) = 1211.8; standard deviation:
+        // sqrt(1211.8 * (1 - 0.0606)) = 33.7.
+
+        const Int64 NUM_SAMPLES = X.numSamples();
+        if (veryVerbose) { T_ P(NUM_SAMPLES) }
+        ASSERTV(NUM_SAMPLES, 1043 < NUM_SAMPLES && NUM_SAMPLES < 1381);
+        ASSERT(0 == X.numLiveSamples());
+
+        for (int i = 0; i < 100; ++i) {
+            mX.deallocate(mX.allocate(100 * k_INTERVAL));
+        }
+        ASSERTV(X.numSamples() - NUM_SAMPLES,
+                NUM_SAMPLES + 100 == X.numSamples());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'writeProfile'
+        //
+        // Concerns:
+        //: 1 The profile starts with a 'heap_v2' header holding the in-use and
+        //:   cumulative totals, and the sampling interval.
+        //:
+        //: 2 The profile has one line per distinct call stack, holding its
+        //:   in-use and cumulative counts, and its return addresses, starting
+        //:   from the caller of 'allocate'.
+        //:
+        //: 3 At most 'maxRecordedFrames' addresses are recorded per call
+        //:   stack.
+        //:
+        //: 4 On Linux, the memory map of the process follows the samples.
+        //
+        // Plan:
+        //: 1 Using a sampling interval of 0, allocate blocks from two call
+        //:   sites, deallocate some of them, and verify each line of the
+        //:   profile written.  (C-1..2, 4)
+        //:
+        //: 2 Repeat with a 'maxRecordedFrames' of 1, and verify that the two
+        //:   call sites, which share their first frame, are recorded as one
+        //:   call stack.  (C-3)
+        //
+        // Testing:
+        //   bsl::ostream& writeProfile(bsl::ostream& stream) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'writeProfile'" << endl
+                          << "======================" << endl;
+
+        if (!k_STACK_ADDRESSES_SUPPORTED) {
+            break;
+        }
+
+        for (int maxFrames = 1; maxFrames <= 64; maxFrames += 63) {
+            const int MAX_FRAMES = maxFrames;
+
+            if (veryVerbose) { T_ P(MAX_FRAMES) }
+
+            bslma::TestAllocator ta("underlying", veryVerbose);
+            Obj                  mX(0, MAX_FRAMES, &ta);  const Obj& X = mX;
+
+            void *blocks[3];
+            void *callers[3];
+
+            // Two blocks from one call site, and one from another.  (The
+            // number of iterations is 'volatile' so that the loop is not
+            // unrolled into two call sites.)
+
+            volatile int numSite1Blocks = 2;
+            for (int i = 0; i < numSite1Blocks; ++i) {
+                blocks[i] = allocateAndCapture(&mX, 100, &callers[i]);
+            }
+            blocks[2] = allocateAndCapture(&mX, 10, &callers[2]);
+
+            mX.deallocate(blocks[0]);
+
+            bsl::ostringstream out;
+            ASSERT(&out == &X.writeProfile(out));
+
+            const bsl::string              PROFILE = out.str();
+            const bsl::vector<bsl::string> LINES   = profileLines(PROFILE);
+
+            if (veryVerbose) { cout << PROFILE; }
+
+            // With one recorded frame, the two call sites (which share their
+            // first frame, in 'allocateAndCapture') have the same call stack.
+
+            const bsl::size_t NUM_STACKS = 1 == MAX_FRAMES ? 1 : 2;
+
+            ASSERTV(LINES.size(), NUM_STACKS + 1 == LINES.size());
+            ASSERTV(LINES[0], "heap profile: "
+                              "     2:      110 [     3:      210] @ heap_v2/0"
+                              == LINES[0]);
+
+            // The return addresses in this function of the two call sites
+            // (the second recorded address of each call stack).
+
+            bsl::ostringstream site1;
+            bsl::ostringstream site2;
+            site1 << ' ' << callers[0];
+            site2 << ' ' << callers[2];
+            ASSERT(callers[0] != callers[2]);
+
+            const bsl::string SITE1_COUNTS =
+                                      "     1:      100 [     2:      200] @";
+            const bsl::string SITE2_COUNTS =
+                                      "     1:       10 [     1:       10] @";
+            const bsl::string MERGED_COUNTS =
+                                      "     2:      110 [     3:      210] @";
+
+            int numSite1  = 0;
+            int numSite2  = 0;
+            int numMerged = 0;
+            for (bsl::size_t i = 1; i < LINES.size(); ++i) {
+                const bsl::string& LINE = LINES[i];
+
+                bsl::istringstream fields(LINE.substr(LINE.find('@') + 1));
+                bsl::string        address;
+                int                numAddresses = 0;
+                bsl::string        second;
+                while (fields >> address) {
+                    ASSERTV(LINE, 0 == address.find("0x"));
+                    if (1 == numAddresses) {
+                        second = ' ' + address;
+                    }
+                    ++numAddresses;
+                }
+                ASSERTV(LINE, 0 < numAddresses);
+                ASSERTV(LINE, numAddresses <= MAX_FRAMES);
+
+                if (0 == LINE.find(SITE1_COUNTS)) {
+                    ++numSite1;
+                    ASSERTV(LINE, second == site1.str());
+                }
+                else if (0 == LINE.find(SITE2_COUNTS)) {
+                    ++numSite2;
+                    ASSERTV(LINE, second == site2.str());
+                }
+                else if (0 == LINE.find(MERGED_COUNTS)) {
+                    ++numMerged;
+                }
+                else {
+                    ASSERTV(LINE, !"unexpected counts");
+                }
+            }
+            ASSERTV(numSite1,  (1 == NUM_STACKS ? 0 : 1) == numSite1);
+            ASSERTV(numSite2,  (1 == NUM_STACKS ? 0 : 1) == numSite2);
+            ASSERTV(numMerged, (1 == NUM_STACKS ? 1 : 0) == numMerged);
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+            ASSERT(bsl::string::npos !=
+                                      PROFILE.find("\nMAPPED_LIBRARIES:\n"));
+#endif
+
+            mX.deallocate(blocks[1]);
+            mX.deallocate(blocks[2]);
+
+            out.str("");
+            X.writeProfile(out);
+            ASSERTV(out.str(),
+                    0 == out.str().find("heap profile: "
+                                        "     0:        0 [     3:      210]"
+                                        " @ heap_v2/0"));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'allocate' AND 'deallocate'
+        //
+        // Concerns:
+        //: 1 'allocate' returns a maximally-aligned block of the requested
+        //:   size, supplied by the underlying allocator, and 'deallocate'
+        //:   returns it to the underlying allocator.
+        //:
+        //: 2 'allocate(0)' returns 0, and 'deallocate(0)' has no effect.
+        //:
+        //: 3 With a sampling interval of 0, every allocation is sampled, and
+        //:   'numSamples' and 'numLiveSamples' count the sampled allocations,
+        //:   and the live ones.
+        //:
+        //: 4 Neither the default nor the global allocator is used.
+        //
+        // Plan:
+        //: 1 Using a test allocator as the underlying allocator, allocate and
+        //:   deallocate blocks of various sizes, write to all of their bytes,
+        //:   and verify their alignment, the memory in use of the test
+        //:   allocator, and the sample counts.  (C-1..4)
+        //
+        // Testing:
+        //   void *allocate(size_type size);
+        //   void deallocate(void *address);
+        //   bsls::Types::Int64 numLiveSamples() const;
+        //   bsls::Types::Int64 numSamples() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'allocate' AND 'deallocate'" << endl
+                          << "===================================" << endl;
+
+        bslma::TestAllocator  ga("global", veryVerbose);
+        bslma::Allocator     *previousGlobal =
+                                       bslma::Default::setGlobalAllocator(&ga);
+
+        const int SIZES[]   = { 1, 2, 7, 8, 15, 16, 17, 100, 1000, 65536 };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        for (int ti = 0; ti < 2; ++ti) {
+            const Int64 INTERVAL = ti ? 1024 * 1024 : 0;
+
+            if (veryVerbose) { T_ P(INTERVAL) }
+
+            bslma::TestAllocator ta("underlying", veryVerbose);
+            Obj                  mX(INTERVAL, &ta);  const Obj& X = mX;
+
+            ASSERT(0 == mX.allocate(0));
+            mX.deallocate(0);
+            ASSERT(0 == ta.numBlocksInUse());
+
+            void *blocks[NUM_SIZES];
+            for (int i = 0; i < NUM_SIZES; ++i) {
+                const int SIZE = SIZES[i];
+
+                void *block = mX.allocate(SIZE);
+                ASSERTV(SIZE, block);
+                ASSERTV(SIZE, 0 == reinterpret_cast<bsls::Types::UintPtr>(
+                                                                      block)
+                               % bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT);
+                bsl::memset(block, 0xA5, SIZE);
+                blocks[i] = block;
+
+                ASSERTV(SIZE, i + 1 <= ta.numBlocksInUse());
+                ASSERTV(SIZE, static_cast<bsls::Types::size_type>(SIZE)
+                                             < ta.lastAllocatedNumBytes()
+                           || 0 == INTERVAL);
+            }
+
+            const Int64 BYTES_IN_USE = ta.numBytesInUse();
+
+            if (0 == INTERVAL) {
+                ASSERT(NUM_SIZES == X.numSamples());
+                ASSERT(NUM_SIZES == X.numLiveSamples());
+            }
+            else {
+                // Only the largest blocks are likely to be sampled.
+
+                ASSERT(X.numSamples() == X.numLiveSamples());
+                ASSERT(X.numSamples() <= NUM_SIZES);
+            }
+
+            const Int64 NUM_SAMPLES = X.numSamples();
+
+            for (int i = 0; i < NUM_SIZES; ++i) {
+                mX.deallocate(blocks[i]);
+                ASSERTV(i, NUM_SAMPLES == X.numSamples());
+            }
+            ASSERT(0 == X.numLiveSamples());
+            ASSERT(BYTES_IN_USE > ta.numBytesInUse());
+        }
+
+        ASSERT(0 == da.numBlocksTotal());
+        ASSERT(0 == ga.numBlocksTotal());
+
+        bslma::Default::setGlobalAllocator(previousGlobal);
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING CREATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 Each constructor creates an allocator having the specified (or
+        //:   default) sampling interval and maximum number of recorded frames,
+        //:   and an empty profile.
+        //:
+        //: 2 The blocks are supplied by the specified allocator, or by the
+        //:   'bslma::MallocFreeAllocator' singleton.
+        //:
+        //: 3 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create allocators with each constructor, and verify their
+        //:   attributes and sample counts, and where their blocks come from.
+        //:   (C-1..2)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-3)
+        //
+        // Testing:
+        //   HeapProfileAllocator(bslma::Allocator *basicAllocator = 0);
+        //   HeapProfileAllocator(Int64 interval, bslma::Allocator * = 0);
+        //   HeapProfileAllocator(Int64 interval, int maxFrames, Alloc * = 0);
+        //   ~HeapProfileAllocator();
+        //   int maxRecordedFrames() const;
+        //   bsls::Types::Int64 samplingInterval() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING CREATORS AND BASIC ACCESSORS" << endl
+                          << "====================================" << endl;
+
+        bslma::TestAllocator ta("underlying", veryVerbose);
+
+        {
+            Obj mX;  const Obj& X = mX;
+            ASSERT(Obj::k_DEFAULT_SAMPLING_INTERVAL == X.samplingInterval());
+            ASSERT(Obj::k_DEFAULT_MAX_FRAMES        == X.maxRecordedFrames());
+            ASSERT(0 == X.numSamples());
+            ASSERT(0 == X.numLiveSamples());
+
+            mX.deallocate(mX.allocate(10));
+        }
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+            ASSERT(Obj::k_DEFAULT_SAMPLING_INTERVAL == X.samplingInterval());
+            ASSERT(Obj::k_DEFAULT_MAX_FRAMES        == X.maxRecordedFrames());
+
+            void *block = mX.allocate(10);
+            ASSERT(1 == ta.numBlocksInUse());
+            mX.deallocate(block);
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+        {
+            Obj mX(1000);  const Obj& X = mX;
+            ASSERT(1000 == X.samplingInterval());
+            ASSERT(Obj::k_DEFAULT_MAX_FRAMES == X.maxRecordedFrames());
+        }
+        {
+            Obj mX(0, &ta);  const Obj& X = mX;
+            ASSERT(0 == X.samplingInterval());
+            ASSERT(Obj::k_DEFAULT_MAX_FRAMES == X.maxRecordedFrames());
+        }
+        {
+            Obj mX(1000, 5);  const Obj& X = mX;
+            ASSERT(1000 == X.samplingInterval());
+            ASSERT(5    == X.maxRecordedFrames());
+        }
+        {
+            Obj mX(0, 1, &ta);  const Obj& X = mX;
+            ASSERT(0 == X.samplingInterval());
+            ASSERT(1 == X.maxRecordedFrames());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == da.numBlocksTotal());
+
+        if (verbose) cout << "\tNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_FAIL(Obj(-1));
+            ASSERT_PASS(Obj(Int64(0)));
+            ASSERT_FAIL(Obj(-1, 1));
+            ASSERT_FAIL(Obj(0, 0));
+            ASSERT_PASS(Obj(0, 1));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Allocate and deallocate blocks through an allocator sampling
+        //:   every allocation, and verify the sample counts and the profile.
+        //:   (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("underlying", veryVerbose);
+        Obj                  mX(0, &ta);  const Obj& X = mX;
+
+        void *block1 = mX.allocate(100);
+        void *block2 = mX.allocate(200);
+        ASSERT(2 == X.numSamples());
+        ASSERT(2 == X.numLiveSamples());
+
+        mX.deallocate(block1);
+        ASSERT(2 == X.numSamples());
+        ASSERT(1 == X.numLiveSamples());
+
+        bsl::ostringstream out;
+        X.writeProfile(out);
+        ASSERT(0 == out.str().find("heap profile: "));
+
+        if (veryVerbose) { cout << out.str(); }
+
+        mX.deallocate(block2);
+        ASSERT(0 == X.numLiveSamples());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 With the default sampling interval, the overhead of the
+        //:   allocator is small.
+        //
+        // Plan:
+        //: 1 Time two workloads using, as the default allocator, the
+        //:   'bslma::MallocFreeAllocator' singleton, and a heap profile
+        //:   allocator forwarding to it, and report the overhead of the
+        //:   latter.  The first workload only allocates and deallocates small
+        //:   blocks (an upper bound of the overhead); the second builds and
+        //:   searches maps of strings.  The number of iterations may be
+        //:   supplied as the second argument (default 5).
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        const int NUM_ITERATIONS = argc > 2 && 0 < bsl::atoi(argv[2])
+                                 ? bsl::atoi(argv[2])
+                                 : 5;
+
+        enum { k_NUM_BLOCKS = 2000000, k_NUM_LIVE = 64, k_MAP_SIZE = 100000 };
+
+        bslma::Allocator *mallocFree =
+                                    &bslma::MallocFreeAllocator::singleton();
+        Obj               profiler;
+
+        bslma::Allocator *ALLOCATORS[] = { mallocFree, &profiler };
+        double            blockTimes[2] = { 0, 0 };
+        double            mapTimes[2]   = { 0, 0 };
+        Int64             checksum      = 0;
+
+        // Alternate the allocators, so that they are equally affected by any
+        // drift of the speed of the machine.
+
+        for (int iteration = 0; iteration < NUM_ITERATIONS; ++iteration) {
+            for (int ai = 0; ai < 2; ++ai) {
+                bslma::Allocator             *allocator = ALLOCATORS[ai];
+                bslma::DefaultAllocatorGuard  guard(allocator);
+                bsls::Stopwatch               timer;
+
+                void *blocks[k_NUM_LIVE] = { 0 };
+
+                timer.start();
+                for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+                    void *&block = blocks[i % k_NUM_LIVE];
+                    allocator->deallocate(block);
+                    block = allocator->allocate(16 + (i * 7) % 240);
+                }
+                for (int i = 0; i < k_NUM_LIVE; ++i) {
+                    allocator->deallocate(blocks[i]);
+                }
+                timer.stop();
+                blockTimes[ai] += timer.elapsedTime();
+
+                timer.reset();
+                timer.start();
+                {
+                    bsl::map<int, bsl::string> map;
+                    for (int i = 0; i < k_MAP_SIZE; ++i) {
+                        map[(i * 7919) % k_MAP_SIZE].assign(40 + i % 20, 'x');
+                    }
+                    for (int i = 0; i < k_MAP_SIZE; ++i) {
+                        checksum += map.find(i)->second.size();
+                    }
+                }
+                timer.stop();
+                mapTimes[ai] += timer.elapsedTime();
+            }
+        }
+
+        cout << "blocks: malloc/free " << blockTimes[0]
+             << " s, profiled " << blockTimes[1] << " s (overhead "
+             << (blockTimes[1] - blockTimes[0]) * 100 / blockTimes[0]
+             << "%)" << endl
+             << "maps:   malloc/free " << mapTimes[0]
+             << " s, profiled " << mapTimes[1] << " s (overhead "
+             << (mapTimes[1] - mapTimes[0]) * 100 / mapTimes[0]
+             << "%)" << endl
+             << profiler.numSamples() << " samples (checksum " << checksum
+             << ")" << endl;
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
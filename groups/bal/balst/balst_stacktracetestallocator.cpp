@@ -12,6 +12,7 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(balst_stacktracetestallocator_cpp,"$Id$ $CSID$")
 
+#include <balst_cachedstacktraceutil.h>
 #include <balst_stacktrace.h>
 #include <balst_stacktraceutil.h>
 
@@ -592,7 +593,7 @@ void StackTraceTestAllocator::reportBlocksInUse(bsl::ostream *ostream) const
                  << it->second << " block(s) in use.\n"
                  << "Stack trace at allocation time:\n";
 
-        int rc = StackTraceUtil::loadStackTraceFromAddressArray(
+        int rc = CachedStackTraceUtil::loadStackTraceFromAddressArray(
                                                        &st,
                                                        it->first.begin(),
                                                        (int) it->first.size(),
@@ -65,7 +65,10 @@ BSLS_IDENT("$Id: $")
 // and quick to obtain.  Actual resolving of the stack pointer to subroutine
 // names and, on some platforms, source file names and line numbers, is
 // expensive but doesn't happen during allocation or deallocation and is put
-// off until a memory leak report is being generated.
+// off until a memory leak report is being generated.  The report resolves the
+// stack pointers through 'balst::CachedStackTraceUtil', so that each stack
+// pointer shared by several reported call-stacks (or by reports from several
+// allocators) is resolved only once in the lifetime of the process.
 //
 // Note that the overhead increases and efficiency decreases as the
 // 'numRecordedFrames' argument to the constructor is increased.
@@ -198,6 +198,7 @@ Decoder::Decoder(const DecoderOptions *options,
 , d_numUnknownElementsSkipped(0)
 , d_fatalError(false)
 , d_remainingDepth(1)
+, d_topElementDepth(0)
 {
     BSLS_ASSERT(d_options != 0);
     BSLS_ASSERT(d_reader != 0);
@@ -222,6 +223,7 @@ Decoder::Decoder(const DecoderOptions *options,
 , d_numUnknownElementsSkipped(0)
 , d_fatalError(false)
 , d_remainingDepth(1)
+, d_topElementDepth(0)
 {
     BSLS_ASSERT(d_options != 0);
     BSLS_ASSERT(d_reader != 0);
@@ -328,6 +330,7 @@ Decoder::readTopElement()
 
     } while (d_reader->nodeType() != Reader::e_NODE_TYPE_ELEMENT);
 
+    d_topElementDepth = d_reader->nodeDepth();
     return 0;
 }
 
@@ -520,6 +523,75 @@ Decoder::parse(Decoder_ElementContext *context)
     return ret;
 }
 
+int
+Decoder::advanceToNextElement()
+{
+    if (d_fatalError) {
+        return -1;                                                    // RETURN
+    }
+
+    const int nodeType = d_reader->nodeType();
+    const int depth    = d_reader->nodeDepth();
+
+    if (Reader::e_NODE_TYPE_ELEMENT == nodeType) {
+        if (depth == d_topElementDepth && d_reader->isEmptyElement()) {
+            return 1;                                                 // RETURN
+        }
+
+        if (depth != d_topElementDepth && !d_reader->isEmptyElement()) {
+            // The current child element was not decoded: skip its content.
+
+            do {
+                int rc1 = d_reader->advanceToNextNode();
+                int rc2 = checkForReaderErrors();
+
+                if (rc1 != 0 || rc2 < 0) {
+                    d_fatalError = true;
+                    BALXML_DECODER_LOG_ERROR(this)
+                        << "End of stream reached before element was done."
+                        << BALXML_DECODER_LOG_END;
+
+                    return -1;                                        // RETURN
+                }
+            } while (d_reader->nodeType() != Reader::e_NODE_TYPE_END_ELEMENT
+                  || d_reader->nodeDepth() != depth);
+        }
+    }
+    else if (Reader::e_NODE_TYPE_END_ELEMENT == nodeType
+          && depth == d_topElementDepth) {
+        return 1;                                                     // RETURN
+    }
+
+    // Elements nested in the child elements of the root element have been
+    // consumed, so the next (start or end) element node is either a child
+    // element, or the end of the root element.
+
+    while (1) {
+        int rc1 = d_reader->advanceToNextNode();
+        int rc2 = checkForReaderErrors();
+
+        if (rc1 != 0 || rc2 < 0) {
+            d_fatalError = true;
+            BALXML_DECODER_LOG_ERROR(this)
+                << "End of stream reached before root element was done."
+                << BALXML_DECODER_LOG_END;
+
+            return -1;                                                // RETURN
+        }
+
+        switch (d_reader->nodeType()) {
+          case Reader::e_NODE_TYPE_ELEMENT: {
+            return 0;                                                 // RETURN
+          }
+          case Reader::e_NODE_TYPE_END_ELEMENT: {
+            return 1;                                                 // RETURN
+          }
+          default: {
+          } break;
+        }
+    }
+}
+
 bsl::ostream& Decoder::logStream()
 {
     if (0 == d_logStream) {
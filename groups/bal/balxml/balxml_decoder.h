@@ -253,6 +253,76 @@ BSLS_IDENT("$Id: $")
 //      return 0;
 //  }
 //..
+//
+///Example 3: Decoding the Elements of a Large Document One at a Time
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we receive a (potentially very large) document whose root
+// element, 'Employees', holds a sequence of 'Employee' elements, and that we
+// want to process each 'Employee' without materializing the whole document
+// in memory.  Using the same 'test_employee' component as in the previous
+// usage examples, we first open the document, which positions the reader on
+// the root element:
+//..
+//  int main()
+//  {
+//      const char INPUT[] =
+//          "<?xml version='1.0' encoding='UTF-8' ?>\n"
+//          "<Employees>\n"
+//          "    <Employee>\n"
+//          "        <name>Bob</name>\n"
+//          "        <homeAddress>\n"
+//          "            <street>Some Street</street>\n"
+//          "            <city>Some City</city>\n"
+//          "            <state>Some State</state>\n"
+//          "        </homeAddress>\n"
+//          "        <age>21</age>\n"
+//          "    </Employee>\n"
+//          "    <Employee>\n"
+//          "        <name>Jim</name>\n"
+//          "        <homeAddress>\n"
+//          "            <street>Another Street</street>\n"
+//          "            <city>Another City</city>\n"
+//          "            <state>Another State</state>\n"
+//          "        </homeAddress>\n"
+//          "        <age>42</age>\n"
+//          "    </Employee>\n"
+//          "</Employees>\n";
+//
+//      balxml::MiniReader     reader;
+//      balxml::DecoderOptions options;
+//      balxml::Decoder        decoder(&options, &reader);
+//
+//      bdlsb::FixedMemInStreamBuf streamBuf(INPUT, sizeof(INPUT) - 1);
+//
+//      int rc = decoder.open(&streamBuf);
+//      assert(0 == rc);
+//..
+// Then, we decode the 'Employee' elements one at a time, reusing the same
+// 'test::Employee' object, so that memory use does not depend on the number of
+// elements in the document:
+//..
+//      test::Employee employee;
+//      int            numEmployees = 0;
+//      int            totalAge     = 0;
+//
+//      while (0 == (rc = decoder.decodeNextElement(&employee))) {
+//          ++numEmployees;
+//          totalAge += employee.age();
+//      }
+//..
+// Finally, we verify that every element was decoded, and close the decoder:
+//..
+//      assert(1  == rc);
+//      assert(2  == numEmployees);
+//      assert(63 == totalAge);
+//
+//      decoder.close();
+//      return 0;
+//  }
+//..
+// Note that 'advanceToNextElement' may be used instead of 'decodeNextElement'
+// to examine the name of each element (e.g., to choose the type of the object
+// to decode, or to skip the element) before calling 'decode'.
 
 #include <balscm_version.h>
 
@@ -423,6 +493,10 @@ class Decoder {
     int                              d_remainingDepth;
         // remaining number of nesting levels allowed
 
+    int                              d_topElementDepth;
+        // depth (as reported by the reader) of the root element of the open
+        // document
+
     // NOT IMPLEMENTED
     Decoder(const Decoder&);
     Decoder operator=(const Decoder&);
@@ -560,6 +634,33 @@ class Decoder {
         // behavior is undefined unless this call was preceded by a prior
         // successful call to 'open'
 
+    int advanceToNextElement();
+        // Advance the associated reader, positioned by a prior successful call
+        // to 'open' on the root element of a document, to the next child
+        // element of the root element, skipping the remainder of the current
+        // child element if it has not been decoded.  Return 0 if the reader
+        // is positioned on a child element, whose name is then available from
+        // 'reader()->nodeLocalName()' and which may be decoded by calling
+        // 'decode(TYPE *)', 1 if the root element has no more child elements,
+        // and a negative value if an error occurred.  Note that, in
+        // conjunction with 'decode(TYPE *)', this method allows a document
+        // consisting of an arbitrary number of repeated elements to be decoded
+        // one element at a time, in bounded memory (see {Example 3: Decoding
+        // the Elements of a Large Document One at a Time}).
+
+    template <class TYPE>
+    int decodeNextElement(TYPE *object);
+        // Decode into the specified 'object' of parameterized 'TYPE' the next
+        // child element of the root element of the document opened by a prior
+        // successful call to 'open' (see 'advanceToNextElement').  Return 0
+        // on success, 1 if the root element has no more child elements (in
+        // which case 'object' is unchanged), and a negative value if an error
+        // occurred (in which case 'object' is left in a valid, but
+        // unspecified, state, and the document should not be decoded
+        // further).  Note that the capacity of the strings and arrays held by
+        // 'object' is retained, so that reusing the same 'object' for each
+        // element avoids most memory allocation.
+
     void setNumUnknownElementsSkipped(int value);
         // Set the number of unknown elements skipped by the decoder during
         // the current decoding operation to the specified 'value'.  The
@@ -2052,6 +2153,20 @@ int Decoder::decode(TYPE *object)
     return this->errorCount();
 }
 
+template <class TYPE>
+int Decoder::decodeNextElement(TYPE *object)
+{
+    const int rc = advanceToNextElement();
+    if (0 != rc) {
+        return rc;                                                    // RETURN
+    }
+
+    const int errorCount = d_errorCount;
+    this->decode(object);
+
+    return d_errorCount == errorCount && !d_fatalError ? 0 : -1;
+}
+
 template <class TYPE>
 inline
 int Decoder::decodeImp(TYPE *object, bdlat_TypeCategory::DynamicType)
@@ -152,6 +152,8 @@ namespace test = s_baltst;
 // [10] baexml_Decoder_VectorContext<TYPE>
 // [ 7] baexml_Decoder_PrepareSubContext
 // ----------------------------------------------------------------------------
+// [22] int advanceToNextElement();
+// [22] int decodeNextElement(TYPE *object);
 // [ 1] BREATHING TEST
 // [16] USAGE EXAMPLES
 // ----------------------------------------------------------------------------
@@ -8230,6 +8232,76 @@ extern const char selection1Name[] = "selection1";
         return 0;
     }
 //..
+//
+///Example 3: Decoding the Elements of a Large Document One at a Time
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we receive a (potentially very large) document whose root
+// element, 'Employees', holds a sequence of 'Employee' elements, and that we
+// want to process each 'Employee' without materializing the whole document
+// in memory.  Using the same 'test_employee' component as in the previous
+// usage examples, we first open the document, which positions the reader on
+// the root element:
+//..
+    int usageExample4()
+    {
+        const char INPUT[] =
+            "<?xml version='1.0' encoding='UTF-8' ?>\n"
+            "<Employees>\n"
+            "    <Employee>\n"
+            "        <name>Bob</name>\n"
+            "        <homeAddress>\n"
+            "            <street>Some Street</street>\n"
+            "            <city>Some City</city>\n"
+            "            <state>Some State</state>\n"
+            "        </homeAddress>\n"
+            "        <age>21</age>\n"
+            "    </Employee>\n"
+            "    <Employee>\n"
+            "        <name>Jim</name>\n"
+            "        <homeAddress>\n"
+            "            <street>Another Street</street>\n"
+            "            <city>Another City</city>\n"
+            "            <state>Another State</state>\n"
+            "        </homeAddress>\n"
+            "        <age>42</age>\n"
+            "    </Employee>\n"
+            "</Employees>\n";
+
+        balxml::MiniReader     reader;
+        balxml::DecoderOptions options;
+        balxml::Decoder        decoder(&options, &reader);
+
+        bdlsb::FixedMemInStreamBuf streamBuf(INPUT, sizeof(INPUT) - 1);
+
+        int rc = decoder.open(&streamBuf);
+        ASSERT(0 == rc);
+//..
+// Then, we decode the 'Employee' elements one at a time, reusing the same
+// 'test::Employee' object, so that memory use does not depend on the number of
+// elements in the document:
+//..
+        test::Employee employee;
+        int            numEmployees = 0;
+        int            totalAge     = 0;
+
+        while (0 == (rc = decoder.decodeNextElement(&employee))) {
+            ++numEmployees;
+            totalAge += employee.age();
+        }
+//..
+// Finally, we verify that every element was decoded, and close the decoder:
+//..
+        ASSERT(1  == rc);
+        ASSERT(2  == numEmployees);
+        ASSERT(63 == totalAge);
+
+        decoder.close();
+        return 0;
+    }
+//..
+// Note that 'advanceToNextElement' may be used instead of 'decodeNextElement'
+// to examine the name of each element (e.g., to choose the type of the object
+// to decode, or to skip the element) before calling 'decode'.
 
 // ============================================================================
 //                               MAIN PROGRAM
@@ -8249,6 +8321,242 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 22: {
+        // --------------------------------------------------------------------
+        // TESTING ELEMENT-AT-A-TIME DECODING
+        //
+        // Concerns:
+        //: 1 'advanceToNextElement' positions the reader on each child
+        //:   element of the root element in turn, ignoring whitespace and
+        //:   comments, and returns 1 (repeatedly) once the root element has
+        //:   no more children.
+        //:
+        //: 2 A child element that was not decoded (including one having
+        //:   nested or empty elements) is skipped by the next call to
+        //:   'advanceToNextElement'.
+        //:
+        //: 3 An empty root element has no children.
+        //:
+        //: 4 'decodeNextElement' decodes each child element in turn into the
+        //:   supplied object, which may be reused, and leaves the object
+        //:   unchanged when there are no more elements.
+        //:
+        //: 5 A truncated document, or a child element that fails to decode,
+        //:   results in a negative return value, and all subsequent calls
+        //:   fail.
+        //:
+        //: 6 The methods work for documents read from a stream buffer.
+        //
+        // Plan:
+        //: 1 Open a number of documents having various arrangements of child
+        //:   elements, and verify the sequence of element names and return
+        //:   values from 'advanceToNextElement'.  (C-1..3)
+        //:
+        //: 2 Decode a sequence of 'test::Address' elements into a single
+        //:   object, with and without a stream buffer, and verify each
+        //:   decoded value.  (C-4, 6)
+        //:
+        //: 3 Decode truncated and invalid documents and verify the return
+        //:   values.  (C-5)
+        //
+        // Testing:
+        //   int advanceToNextElement();
+        //   int decodeNextElement(TYPE *object);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING ELEMENT-AT-A-TIME DECODING"
+                          << "\n==================================" << endl;
+
+        if (verbose) cout << "\nTesting 'advanceToNextElement'." << endl;
+        {
+            static const struct {
+                int         d_line;      // source line number
+                const char *d_input;     // XML document
+                const char *d_expected;  // names of child elements, each
+                                         // followed by ';'
+            } DATA[] = {
+                //LINE  INPUT                           EXPECTED
+                //----  ------------------------------  --------------------
+                { L_,   "<R/>",                         ""                   },
+                { L_,   "<R></R>",                      ""                   },
+                { L_,   "<R> \n </R>",                  ""                   },
+                { L_,   "<R><!-- c --></R>",            ""                   },
+                { L_,   "<R><A/></R>",                  "A;"                 },
+                { L_,   "<R><A></A></R>",               "A;"                 },
+                { L_,   "<R><A>x</A></R>",              "A;"                 },
+                { L_,   "<R><A/><B/><C/></R>",          "A;B;C;"             },
+                { L_,   "<R>\n <A>1</A>\n <!-- c -->\n"
+                        " <B>2</B>\n</R>\n",            "A;B;"               },
+                { L_,   "<R><A><B><C/></B><B/></A>"
+                        "<D>t<E/>t</D></R>",            "A;D;"               },
+                { L_,   "<R><A><A><A/></A></A><A/></R>", "A;A;"              },
+                { L_,   "<?xml version='1.0' ?>\n"
+                        "<R a='1'><A b='2'/></R>",      "A;"                 },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE     = DATA[ti].d_line;
+                const char *const INPUT    = DATA[ti].d_input;
+                const char *const EXPECTED = DATA[ti].d_expected;
+
+                if (veryVerbose) { T_ P_(LINE) P(INPUT) }
+
+                balxml::MiniReader     reader;
+                balxml::DecoderOptions options;
+                balxml::Decoder        decoder(&options, &reader);
+
+                int rc = decoder.open(INPUT, bsl::strlen(INPUT));
+                LOOP2_ASSERT(LINE, rc, 0 == rc);
+
+                bsl::string names;
+                while (0 == (rc = decoder.advanceToNextElement())) {
+                    names += reader.nodeLocalName();
+                    names += ';';
+                }
+                LOOP3_ASSERT(LINE, EXPECTED, names, EXPECTED == names);
+                LOOP2_ASSERT(LINE, rc, 1 == rc);
+
+                rc = decoder.advanceToNextElement();
+                LOOP2_ASSERT(LINE, rc, 1 == rc);
+
+                test::Address address;
+                rc = decoder.decodeNextElement(&address);
+                LOOP2_ASSERT(LINE, rc, 1 == rc);
+
+                decoder.close();
+            }
+        }
+
+        if (verbose) cout << "\nTesting 'decodeNextElement'." << endl;
+        {
+            const char INPUT[] =
+                "<?xml version='1.0' encoding='UTF-8' ?>\n"
+                "<Addresses>\n"
+                "  <Address>\n"
+                "    <street>S0</street><city>C0</city><state>T0</state>\n"
+                "  </Address>\n"
+                "  <!-- comment -->\n"
+                "  <Address>\n"
+                "    <street>S1</street><city>C1</city>\n"
+                "  </Address>\n"
+                "  <Address>\n"
+                "    <street>S2</street><city>C2</city><state>T2</state>\n"
+                "  </Address>\n"
+                "</Addresses>\n";
+
+            const char *const STREET[] = { "S0", "S1", "S2" };
+            const char *const CITY[]   = { "C0", "C1", "C2" };
+            const char *const STATE[]  = { "T0", "",   "T2" };
+            const int         NUM_ADDRESSES = 3;
+
+            for (int useStreamBuf = 0; useStreamBuf < 2; ++useStreamBuf) {
+                if (veryVerbose) { T_ P(useStreamBuf) }
+
+                balxml::MiniReader     reader;
+                balxml::DecoderOptions options;
+                balxml::Decoder        decoder(&options, &reader);
+
+                bdlsb::FixedMemInStreamBuf streamBuf(INPUT,
+                                                     sizeof(INPUT) - 1);
+
+                int rc = useStreamBuf
+                       ? decoder.open(&streamBuf)
+                       : decoder.open(INPUT, sizeof(INPUT) - 1);
+                ASSERTV(rc, 0 == rc);
+
+                test::Address address;
+                int           i = 0;
+                while (0 == (rc = decoder.decodeNextElement(&address))) {
+                    ASSERTV(i, i < NUM_ADDRESSES);
+                    if (i >= NUM_ADDRESSES) {
+                        break;
+                    }
+                    ASSERTV(i, address.street(),
+                            STREET[i] == address.street());
+                    ASSERTV(i, address.city(),  CITY[i]  == address.city());
+                    ASSERTV(i, address.state(), STATE[i] == address.state());
+                    ++i;
+                }
+                ASSERTV(rc, 1 == rc);
+                ASSERTV(i,  NUM_ADDRESSES == i);
+
+                // The object is left unchanged when there are no more
+                // elements.
+
+                ASSERTV(address.street(), "S2" == address.street());
+
+                rc = decoder.decodeNextElement(&address);
+                ASSERTV(rc, 1 == rc);
+
+                decoder.close();
+            }
+        }
+
+        if (verbose) cout << "\nTesting truncated and invalid input." << endl;
+        {
+            static const struct {
+                int         d_line;       // source line number
+                const char *d_input;      // XML document
+                int         d_numValid;   // number of elements decoded
+                                          // before the failure
+            } DATA[] = {
+                //LINE  INPUT                                      NUM_VALID
+                //----  -----------------------------------------  ---------
+                { L_,   "<R><Address><street>S</street>",          0         },
+                { L_,   "<R><Address><street>S</street></Address>",
+                                                                   1         },
+                { L_,   "<R><Address/></S>",                       1         },
+                { L_,   "<R><Address/><Address/>",                 2         },
+                { L_,   "<R><Address><street>S</city>"
+                        "</Address><Address/></R>",                0         },
+                { L_,   "<R><Address/><Address><city>C</state>"
+                        "</Address><Address/></R>",                1         },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE      = DATA[ti].d_line;
+                const char *const INPUT     = DATA[ti].d_input;
+                const int         NUM_VALID = DATA[ti].d_numValid;
+
+                if (veryVerbose) { T_ P_(LINE) P(INPUT) }
+
+                bsl::stringstream      errorStream;
+                balxml::MiniReader     reader;
+                balxml::DecoderOptions options;
+                balxml::Decoder        decoder(&options,
+                                               &reader,
+                                               0,
+                                               &errorStream,
+                                               &errorStream);
+
+                int rc = decoder.open(INPUT, bsl::strlen(INPUT));
+                LOOP2_ASSERT(LINE, rc, 0 == rc);
+
+                test::Address address;
+                int           numValid = 0;
+                while (0 == (rc = decoder.decodeNextElement(&address))) {
+                    ++numValid;
+                }
+                LOOP2_ASSERT(LINE, rc,       0 > rc);
+                LOOP2_ASSERT(LINE, numValid, NUM_VALID == numValid);
+
+                if (veryVerbose) { T_ T_ P(errorStream.str()) }
+
+                rc = decoder.advanceToNextElement();
+                LOOP2_ASSERT(LINE, rc, 0 > rc);
+
+                rc = decoder.decodeNextElement(&address);
+                LOOP2_ASSERT(LINE, rc, 0 > rc);
+
+                decoder.close();
+            }
+        }
+
+        if (verbose) cout << "\nEnd of Test." << endl;
+
+      } break;
       case 21: {
         // --------------------------------------------------------------------
         // Testing Decimal64
@@ -9360,6 +9668,8 @@ R(L_,  s(na0,na1,n(i0),n(i1))   , t, t, x(S,x(A0,V0   ),x(A1,V1   )) )  // *
         LOOP_ASSERT(errorStream.str(), errorStream.str().empty());
         if (verbose) bsl::cout << outStream.str() << bsl::endl;
 
+        usageExample4();
+
       } break;
       case 16: {
         // --------------------------------------------------------------------
@@ -58,6 +58,8 @@ const int balxml::EncoderOptions::DEFAULT_INITIALIZER_DATETIME_FRACTIONAL_SECOND
 
 const bool balxml::EncoderOptions::DEFAULT_INITIALIZER_USE_Z_ABBREVIATION_FOR_UTC = false;
 
+const bool balxml::EncoderOptions::DEFAULT_INITIALIZER_USE_FIXED_FLOATING_POINT_PRECISION = false;
+
 const bdlat_AttributeInfo balxml::EncoderOptions::ATTRIBUTE_INFO_ARRAY[] = {
     {
         e_ATTRIBUTE_ID_OBJECT_NAMESPACE,
@@ -170,6 +172,13 @@ const bdlat_AttributeInfo balxml::EncoderOptions::ATTRIBUTE_INFO_ARRAY[] = {
         sizeof("UseZAbbreviationForUtc") - 1,
         "",
         bdlat_FormattingMode::e_TEXT
+    },
+    {
+        e_ATTRIBUTE_ID_USE_FIXED_FLOATING_POINT_PRECISION,
+        "UseFixedFloatingPointPrecision",
+        sizeof("UseFixedFloatingPointPrecision") - 1,
+        "",
+        bdlat_FormattingMode::e_TEXT
     }
 };
 
@@ -519,6 +528,42 @@ const bdlat_AttributeInfo *EncoderOptions::lookupAttributeInfo(
                                                                       // RETURN
             }
         } break;
+        case 30: {
+            if (name[0]=='U'
+             && name[1]=='s'
+             && name[2]=='e'
+             && name[3]=='F'
+             && name[4]=='i'
+             && name[5]=='x'
+             && name[6]=='e'
+             && name[7]=='d'
+             && name[8]=='F'
+             && name[9]=='l'
+             && name[10]=='o'
+             && name[11]=='a'
+             && name[12]=='t'
+             && name[13]=='i'
+             && name[14]=='n'
+             && name[15]=='g'
+             && name[16]=='P'
+             && name[17]=='o'
+             && name[18]=='i'
+             && name[19]=='n'
+             && name[20]=='t'
+             && name[21]=='P'
+             && name[22]=='r'
+             && name[23]=='e'
+             && name[24]=='c'
+             && name[25]=='i'
+             && name[26]=='s'
+             && name[27]=='i'
+             && name[28]=='o'
+             && name[29]=='n')
+            {
+                return &ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_USE_FIXED_FLOATING_POINT_PRECISION];
+                                                                      // RETURN
+            }
+        } break;
         case 33: {
             if (name[0]=='D'
              && name[1]=='a'
@@ -597,6 +642,8 @@ const bdlat_AttributeInfo *EncoderOptions::lookupAttributeInfo(int id)
         return &ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_DATETIME_FRACTIONAL_SECOND_PRECISION];
       case e_ATTRIBUTE_ID_USE_Z_ABBREVIATION_FOR_UTC:
         return &ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_USE_Z_ABBREVIATION_FOR_UTC];
+      case e_ATTRIBUTE_ID_USE_FIXED_FLOATING_POINT_PRECISION:
+        return &ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_USE_FIXED_FLOATING_POINT_PRECISION];
       default:
         return 0;
     }
@@ -621,6 +668,7 @@ EncoderOptions::EncoderOptions(bslma::Allocator *basicAllocator)
 , d_outputXMLHeader(DEFAULT_INITIALIZER_OUTPUT_X_M_L_HEADER)
 , d_outputXSIAlias(DEFAULT_INITIALIZER_OUTPUT_X_S_I_ALIAS)
 , d_useZAbbreviationForUtc(DEFAULT_INITIALIZER_USE_Z_ABBREVIATION_FOR_UTC)
+, d_useFixedFloatingPointPrecision(DEFAULT_INITIALIZER_USE_FIXED_FLOATING_POINT_PRECISION)
 {
 }
 
@@ -643,6 +691,7 @@ EncoderOptions::EncoderOptions(
 , d_outputXMLHeader(original.d_outputXMLHeader)
 , d_outputXSIAlias(original.d_outputXSIAlias)
 , d_useZAbbreviationForUtc(original.d_useZAbbreviationForUtc)
+, d_useFixedFloatingPointPrecision(original.d_useFixedFloatingPointPrecision)
 {
 }
 
@@ -672,6 +721,7 @@ EncoderOptions::operator=(const EncoderOptions& rhs)
         d_outputXSIAlias = rhs.d_outputXSIAlias;
         d_datetimeFractionalSecondPrecision = rhs.d_datetimeFractionalSecondPrecision;
         d_useZAbbreviationForUtc = rhs.d_useZAbbreviationForUtc;
+        d_useFixedFloatingPointPrecision = rhs.d_useFixedFloatingPointPrecision;
     }
     return *this;
 }
@@ -694,6 +744,7 @@ void EncoderOptions::reset()
     d_outputXSIAlias = DEFAULT_INITIALIZER_OUTPUT_X_S_I_ALIAS;
     d_datetimeFractionalSecondPrecision = DEFAULT_INITIALIZER_DATETIME_FRACTIONAL_SECOND_PRECISION;
     d_useZAbbreviationForUtc = DEFAULT_INITIALIZER_USE_Z_ABBREVIATION_FOR_UTC;
+    d_useFixedFloatingPointPrecision = DEFAULT_INITIALIZER_USE_FIXED_FLOATING_POINT_PRECISION;
 }
 
 // ACCESSORS
@@ -797,6 +848,11 @@ bsl::ostream& EncoderOptions::print(
         bdlb::PrintMethods::print(stream, d_useZAbbreviationForUtc,
                                  -levelPlus1, spacesPerLevel);
 
+        bdlb::Print::indent(stream, levelPlus1, spacesPerLevel);
+        stream << "UseFixedFloatingPointPrecision = ";
+        bdlb::PrintMethods::print(stream, d_useFixedFloatingPointPrecision,
+                                 -levelPlus1, spacesPerLevel);
+
         bdlb::Print::indent(stream, level, spacesPerLevel);
         stream << "]\n";
     }
@@ -885,6 +941,11 @@ bsl::ostream& EncoderOptions::print(
         bdlb::PrintMethods::print(stream, d_useZAbbreviationForUtc,
                                  -levelPlus1, spacesPerLevel);
 
+        stream << ' ';
+        stream << "UseFixedFloatingPointPrecision = ";
+        bdlb::PrintMethods::print(stream, d_useFixedFloatingPointPrecision,
+                                 -levelPlus1, spacesPerLevel);
+
         stream << " ]";
     }
 
@@ -104,6 +104,11 @@ class EncoderOptions {
         // This option control whether 'Z' should be used for the zone
         // designator of 'DateTz', 'TimeTz', and 'DatetimeTz' instead of
         // '+00:00' (specific to UTC).
+    bool                             d_useFixedFloatingPointPrecision;
+        // This option controls whether 'float' and 'double' values are
+        // encoded with a fixed number of significant digits ('FLT_DIG + 1'
+        // and 'DBL_DIG + 1', respectively) instead of the fewest digits that
+        // round-trip.
 
   public:
     // TYPES
@@ -124,6 +129,7 @@ class EncoderOptions {
       , e_ATTRIBUTE_ID_OUTPUT_X_S_I_ALIAS                   = 13
       , e_ATTRIBUTE_ID_DATETIME_FRACTIONAL_SECOND_PRECISION = 14
       , e_ATTRIBUTE_ID_USE_Z_ABBREVIATION_FOR_UTC           = 15
+      , e_ATTRIBUTE_ID_USE_FIXED_FLOATING_POINT_PRECISION   = 16
 #ifndef BDE_OMIT_INTERNAL_DEPRECATED
       , ATTRIBUTE_ID_OBJECT_NAMESPACE = e_ATTRIBUTE_ID_OBJECT_NAMESPACE
       , ATTRIBUTE_ID_SCHEMA_LOCATION = e_ATTRIBUTE_ID_SCHEMA_LOCATION
@@ -141,11 +147,12 @@ class EncoderOptions {
       , ATTRIBUTE_ID_OUTPUT_X_S_I_ALIAS = e_ATTRIBUTE_ID_OUTPUT_X_S_I_ALIAS
       , ATTRIBUTE_ID_DATETIME_FRACTIONAL_SECOND_PRECISION = e_ATTRIBUTE_ID_DATETIME_FRACTIONAL_SECOND_PRECISION
       , ATTRIBUTE_ID_USE_Z_ABBREVIATION_FOR_UTC = e_ATTRIBUTE_ID_USE_Z_ABBREVIATION_FOR_UTC
+      , ATTRIBUTE_ID_USE_FIXED_FLOATING_POINT_PRECISION = e_ATTRIBUTE_ID_USE_FIXED_FLOATING_POINT_PRECISION
 #endif  // BDE_OMIT_INTERNAL_DEPRECATED
     };
 
     enum {
-        k_NUM_ATTRIBUTES = 16
+        k_NUM_ATTRIBUTES = 17
 #ifndef BDE_OMIT_INTERNAL_DEPRECATED
       , NUM_ATTRIBUTES = k_NUM_ATTRIBUTES
 #endif  // BDE_OMIT_INTERNAL_DEPRECATED
@@ -168,6 +175,7 @@ class EncoderOptions {
       , e_ATTRIBUTE_INDEX_OUTPUT_X_S_I_ALIAS                   = 13
       , e_ATTRIBUTE_INDEX_DATETIME_FRACTIONAL_SECOND_PRECISION = 14
       , e_ATTRIBUTE_INDEX_USE_Z_ABBREVIATION_FOR_UTC           = 15
+      , e_ATTRIBUTE_INDEX_USE_FIXED_FLOATING_POINT_PRECISION   = 16
 #ifndef BDE_OMIT_INTERNAL_DEPRECATED
       , ATTRIBUTE_INDEX_OBJECT_NAMESPACE = e_ATTRIBUTE_INDEX_OBJECT_NAMESPACE
       , ATTRIBUTE_INDEX_SCHEMA_LOCATION = e_ATTRIBUTE_INDEX_SCHEMA_LOCATION
@@ -185,6 +193,7 @@ class EncoderOptions {
       , ATTRIBUTE_INDEX_OUTPUT_X_S_I_ALIAS = e_ATTRIBUTE_INDEX_OUTPUT_X_S_I_ALIAS
       , ATTRIBUTE_INDEX_DATETIME_FRACTIONAL_SECOND_PRECISION = e_ATTRIBUTE_INDEX_DATETIME_FRACTIONAL_SECOND_PRECISION
       , ATTRIBUTE_INDEX_USE_Z_ABBREVIATION_FOR_UTC = e_ATTRIBUTE_INDEX_USE_Z_ABBREVIATION_FOR_UTC
+      , ATTRIBUTE_INDEX_USE_FIXED_FLOATING_POINT_PRECISION = e_ATTRIBUTE_INDEX_USE_FIXED_FLOATING_POINT_PRECISION
 #endif  // BDE_OMIT_INTERNAL_DEPRECATED
     };
 
@@ -211,6 +220,8 @@ class EncoderOptions {
 
     static const bool DEFAULT_INITIALIZER_USE_Z_ABBREVIATION_FOR_UTC;
 
+    static const bool DEFAULT_INITIALIZER_USE_FIXED_FLOATING_POINT_PRECISION;
+
     static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
 
   public:
@@ -343,6 +354,10 @@ class EncoderOptions {
         // Set the "UseZAbbreviationForUtc" attribute of this object to the
         // specified 'value'.
 
+    void setUseFixedFloatingPointPrecision(bool value);
+        // Set the "UseFixedFloatingPointPrecision" attribute of this object
+        // to the specified 'value'.
+
     // ACCESSORS
     bsl::ostream& print(bsl::ostream& stream,
                         int           level = 0,
@@ -450,6 +465,10 @@ class EncoderOptions {
     bool useZAbbreviationForUtc() const;
         // Return a reference to the non-modifiable "UseZAbbreviationForUtc"
         // attribute of this object.
+
+    bool useFixedFloatingPointPrecision() const;
+        // Return a reference to the non-modifiable
+        // "UseFixedFloatingPointPrecision" attribute of this object.
 };
 
 // FREE OPERATORS
@@ -575,6 +594,11 @@ int EncoderOptions::manipulateAttributes(MANIPULATOR& manipulator)
         return ret;
     }
 
+    ret = manipulator(&d_useFixedFloatingPointPrecision, ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_USE_FIXED_FLOATING_POINT_PRECISION]);
+    if (ret) {
+        return ret;
+    }
+
     return ret;
 }
 
@@ -646,6 +670,11 @@ int EncoderOptions::manipulateAttribute(MANIPULATOR& manipulator, int id)
       } break;
       case e_ATTRIBUTE_ID_USE_Z_ABBREVIATION_FOR_UTC: {
         return manipulator(&d_useZAbbreviationForUtc, ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_USE_Z_ABBREVIATION_FOR_UTC]);
+                                                                      // RETURN
+      } break;
+      case e_ATTRIBUTE_ID_USE_FIXED_FLOATING_POINT_PRECISION: {
+        return manipulator(&d_useFixedFloatingPointPrecision, ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_USE_FIXED_FLOATING_POINT_PRECISION]);
+                                                                      // RETURN
       } break;
 
       default:
@@ -766,6 +795,12 @@ void EncoderOptions::setUseZAbbreviationForUtc(bool value)
     d_useZAbbreviationForUtc = value;
 }
 
+inline
+void EncoderOptions::setUseFixedFloatingPointPrecision(bool value)
+{
+    d_useFixedFloatingPointPrecision = value;
+}
+
 // ACCESSORS
 template <class ACCESSOR>
 int EncoderOptions::accessAttributes(ACCESSOR& accessor) const
@@ -852,6 +887,11 @@ int EncoderOptions::accessAttributes(ACCESSOR& accessor) const
         return ret;
     }
 
+    ret = accessor(d_useFixedFloatingPointPrecision, ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_USE_FIXED_FLOATING_POINT_PRECISION]);
+    if (ret) {
+        return ret;
+    }
+
     return ret;
 }
 
@@ -923,6 +963,11 @@ int EncoderOptions::accessAttribute(ACCESSOR& accessor, int id) const
       } break;
       case e_ATTRIBUTE_ID_USE_Z_ABBREVIATION_FOR_UTC: {
         return accessor(d_useZAbbreviationForUtc, ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_USE_Z_ABBREVIATION_FOR_UTC]);
+                                                                      // RETURN
+      } break;
+      case e_ATTRIBUTE_ID_USE_FIXED_FLOATING_POINT_PRECISION: {
+        return accessor(d_useFixedFloatingPointPrecision, ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_USE_FIXED_FLOATING_POINT_PRECISION]);
+                                                                      // RETURN
       } break;
       default:
         return k_NOT_FOUND;                                           // RETURN
@@ -1041,6 +1086,12 @@ bool EncoderOptions::useZAbbreviationForUtc() const
 {
     return d_useZAbbreviationForUtc;
 }
+
+inline
+bool EncoderOptions::useFixedFloatingPointPrecision() const
+{
+    return d_useFixedFloatingPointPrecision;
+}
 }  // close package namespace
 
 // FREE FUNCTIONS
@@ -1065,7 +1116,8 @@ bool balxml::operator==(
          && lhs.outputXMLHeader() == rhs.outputXMLHeader()
          && lhs.outputXSIAlias() == rhs.outputXSIAlias()
          && lhs.datetimeFractionalSecondPrecision() == rhs.datetimeFractionalSecondPrecision()
-         && lhs.useZAbbreviationForUtc() == rhs.useZAbbreviationForUtc();
+         && lhs.useZAbbreviationForUtc() == rhs.useZAbbreviationForUtc()
+         && lhs.useFixedFloatingPointPrecision() == rhs.useFixedFloatingPointPrecision();
 }
 
 inline
@@ -1088,7 +1140,8 @@ bool balxml::operator!=(
          || lhs.outputXMLHeader() != rhs.outputXMLHeader()
          || lhs.outputXSIAlias() != rhs.outputXSIAlias()
          || lhs.datetimeFractionalSecondPrecision() != rhs.datetimeFractionalSecondPrecision()
-         || lhs.useZAbbreviationForUtc() != rhs.useZAbbreviationForUtc();
+         || lhs.useZAbbreviationForUtc() != rhs.useZAbbreviationForUtc()
+         || lhs.useFixedFloatingPointPrecision() != rhs.useFixedFloatingPointPrecision();
 }
 
 inline
@@ -15,12 +15,22 @@ BSLS_IDENT_RCSID(balxml_minireader_cpp,"$Id$ $CSID$")
 #include <balxml_errorinfo.h>
 
 #include <bsls_assert.h>
+#include <bsls_atomicoperations.h>
+#include <bsls_platform.h>
 
 #include <bsl_algorithm.h>  // for 'swap'
 #include <bsl_cctype.h>
 #include <bsl_climits.h>
 #include <bsl_cstring.h>    // for 'strlen', 'strcspn', 'memcmp'
 
+#if defined(BSLS_PLATFORM_CPU_X86_64)                                         \
+ && (defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG))
+# define BALXML_MINIREADER_SIMD 1
+# define BALXML_MINIREADER_TARGET_SSE42 __attribute__((target("sse4.2")))
+# include <cpuid.h>
+# include <immintrin.h>
+#endif
+
 // IMPLEMENTATION NOTES
 // --------------------
 
@@ -106,9 +116,162 @@ BSLS_IDENT_RCSID(balxml_minireader_cpp,"$Id$ $CSID$")
 //     v
 //    END
 //..
+//
+// Delimiters are searched (in 'skipSpaces', 'scanForSymbol', and
+// 'scanForSymbolOrSpace') 16 characters at a time using the SSE4.2
+// 'pcmpistri' instruction, if the processor supports it (as determined once,
+// by the 'CPUID' instruction).  The set of delimiters (at most 15 characters)
+// is held in one register, and the null terminator of the parse buffer (and
+// any null character in the input) ends the search exactly as it ends the
+// 'strcspn' and 'strspn' functions used otherwise.  A 16-byte block is loaded
+// only if it lies entirely within the parse buffer, the terminating null
+// character included; the remaining (at most 15) characters are searched by
+// 'strcspn' (or 'strspn').
 
 namespace {
 
+enum {
+    k_SET_SIZE = 16  // size of a delimiter set, null terminator included
+};
+
+#if defined(BALXML_MINIREADER_SIMD)
+BALXML_MINIREADER_TARGET_SSE42
+const char *findFirstOfSse42(const char *begin,
+                             const char *end,
+                             const char *set)
+    // Return the address of the first character of the null-terminated
+    // string at the specified 'begin' address that is in the specified
+    // null-terminated 'set', or the address of the null terminator of the
+    // string if there is no such character.  The behavior is undefined unless
+    // the processor supports SSE4.2, 'set' refers to an array of 'k_SET_SIZE'
+    // characters, and the characters in the range '[begin .. end]' (note that
+    // 'end' is included) are readable, '*end' being the null character.
+{
+    enum {
+        k_MODE = _SIDD_UBYTE_OPS | _SIDD_CMP_EQUAL_ANY
+                                 | _SIDD_LEAST_SIGNIFICANT
+    };
+
+    const __m128i delimiters = _mm_loadu_si128(
+                                       reinterpret_cast<const __m128i *>(set));
+
+    for (; end - begin >= 15; begin += 16) {
+        const __m128i block = _mm_loadu_si128(
+                                     reinterpret_cast<const __m128i *>(begin));
+
+        const int index = _mm_cmpistri(delimiters, block, k_MODE);
+        if (index < 16) {
+            return begin + index;                                     // RETURN
+        }
+        if (_mm_cmpistrz(delimiters, block, k_MODE)) {
+            return begin + bsl::strlen(begin);                        // RETURN
+        }
+    }
+    return begin + bsl::strcspn(begin, set);
+}
+
+BALXML_MINIREADER_TARGET_SSE42
+const char *findFirstNotOfSse42(const char *begin,
+                                const char *end,
+                                const char *set)
+    // Return the address of the first character of the null-terminated
+    // string at the specified 'begin' address that is not in the specified
+    // null-terminated 'set', the null terminator of the string included.  The
+    // behavior is undefined unless the processor supports SSE4.2, 'set' refers
+    // to an array of 'k_SET_SIZE' characters, and the characters in the range
+    // '[begin .. end]' (note that 'end' is included) are readable, '*end'
+    // being the null character.
+{
+    // With negative polarity, the positions at and after the null terminator
+    // of 'block' compare as "not in 'set'", so that 'index' is less than 16
+    // if 'block' holds the null terminator.
+
+    enum {
+        k_MODE = _SIDD_UBYTE_OPS | _SIDD_CMP_EQUAL_ANY
+                                 | _SIDD_NEGATIVE_POLARITY
+                                 | _SIDD_LEAST_SIGNIFICANT
+    };
+
+    const __m128i delimiters = _mm_loadu_si128(
+                                       reinterpret_cast<const __m128i *>(set));
+
+    for (; end - begin >= 15; begin += 16) {
+        const __m128i block = _mm_loadu_si128(
+                                     reinterpret_cast<const __m128i *>(begin));
+
+        const int index = _mm_cmpistri(delimiters, block, k_MODE);
+        if (index < 16) {
+            return begin + index;                                     // RETURN
+        }
+    }
+    return begin + bsl::strspn(begin, set);
+}
+
+bool detectSse42()
+    // Return 'true' if the processor supports SSE4.2, and 'false' otherwise.
+{
+    unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+    return __get_cpuid(1, &eax, &ebx, &ecx, &edx)
+        && (ecx & (1u << 20));                   // 'CPUID.01H:ECX.SSE4_2[20]'
+}
+
+bool hasSse42()
+    // Return 'true' if the processor supports SSE4.2, and 'false' otherwise,
+    // detecting it on first use.
+{
+    typedef BloombergLP::bsls::AtomicOperations AtomicOps;
+
+    static AtomicOps::AtomicTypes::Int cached = { -1 };
+
+    int result = AtomicOps::getIntRelaxed(&cached);
+    if (result < 0) {
+        result = detectSse42();
+        AtomicOps::setIntRelaxed(&cached, result);
+    }
+
+    return result;
+}
+#endif
+
+inline
+const char *findFirstOf(const char *begin, const char *end, const char *set)
+    // Return the address of the first character of the null-terminated
+    // string at the specified 'begin' address that is in the specified
+    // null-terminated 'set', or the address of the null terminator of the
+    // string if there is no such character.  The behavior is undefined unless
+    // 'set' refers to an array of 'k_SET_SIZE' characters, and the characters
+    // in the range '[begin .. end]' (note that 'end' is included) are
+    // readable, '*end' being the null character.
+{
+#if defined(BALXML_MINIREADER_SIMD)
+    if (hasSse42()) {
+        return findFirstOfSse42(begin, end, set);                     // RETURN
+    }
+#else
+    (void)end;
+#endif
+    return begin + bsl::strcspn(begin, set);
+}
+
+inline
+const char *findFirstNotOf(const char *begin, const char *end, const char *set)
+    // Return the address of the first character of the null-terminated
+    // string at the specified 'begin' address that is not in the specified
+    // null-terminated 'set', the null terminator of the string included.  The
+    // behavior is undefined unless 'set' refers to an array of 'k_SET_SIZE'
+    // characters, and the characters in the range '[begin .. end]' (note that
+    // 'end' is included) are readable, '*end' being the null character.
+{
+#if defined(BALXML_MINIREADER_SIMD)
+    if (hasSse42()) {
+        return findFirstNotOfSse42(begin, end, set);                  // RETURN
+    }
+#else
+    (void)end;
+#endif
+    return begin + bsl::strspn(begin, set);
+}
+
 inline
 const char* nonNullStr(const char *s)
     // Return the specified 's' if 's' != 0, or "" otherwise.  Never returns a
@@ -1230,11 +1393,13 @@ MiniReader::advanceToNextNode()
 int
 MiniReader::skipSpaces()
 {
+    static const char strSet[k_SET_SIZE] = { '\r', '\t', ' ' };
+
     while (1) {
 
         // skip SPACE, TAB, CR chars
-        size_t len = bsl::strspn(d_scanPtr, "\r\t ");
-        d_scanPtr +=len;
+        d_scanPtr = const_cast<char *>(
+                                 findFirstNotOf(d_scanPtr, d_endPtr, strSet));
 
         if (checkForNewLine()) {
             ++d_scanPtr;          //skip NL
@@ -1255,12 +1420,12 @@ MiniReader::skipSpaces()
 int
 MiniReader::scanForSymbol(char symbol)
 {
-    char strSet [] = { symbol, '\n', '\0' };
+    const char strSet[k_SET_SIZE] = { symbol, '\n' };
 
     while (1) {
         // find 'symbol' or NL
-        size_t len = bsl::strcspn(d_scanPtr, strSet);
-        d_scanPtr +=len;
+        d_scanPtr = const_cast<char *>(
+                                    findFirstOf(d_scanPtr, d_endPtr, strSet));
 
         if (symbol == *d_scanPtr) {
             return symbol;                                            // RETURN
@@ -1286,12 +1451,12 @@ MiniReader::scanForSymbol(char symbol)
 int
 MiniReader::scanForSymbolOrSpace(char symbol)
 {
-    char strSet[] = { symbol, '\n', '\r', '\t', ' ', '\0' };
+    const char strSet[k_SET_SIZE] = { symbol, '\n', '\r', '\t', ' ' };
 
     while (1) {
         // find 'symbol' or space
-        size_t len = bsl::strcspn(d_scanPtr, strSet);
-        d_scanPtr +=len;
+        d_scanPtr = const_cast<char *>(
+                                    findFirstOf(d_scanPtr, d_endPtr, strSet));
 
         if (d_scanPtr < d_endPtr) {
             break;
@@ -1307,14 +1472,14 @@ MiniReader::scanForSymbolOrSpace(char symbol)
 int
 MiniReader::scanForSymbolOrSpace(char symbol1, char symbol2)
 {
-    char strSet [] = {
-        symbol1, symbol2,  '\n', '\r', '\t', ' ', '\0'
+    const char strSet[k_SET_SIZE] = {
+        symbol1, symbol2,  '\n', '\r', '\t', ' '
     };
 
     while (1) {
         // find 'symbol1' or 'symbol2' or space
-        size_t len = bsl::strcspn(d_scanPtr, strSet);
-        d_scanPtr +=len;
+        d_scanPtr = const_cast<char *>(
+                                    findFirstOf(d_scanPtr, d_endPtr, strSet));
 
         if (d_scanPtr < d_endPtr) {
             break;
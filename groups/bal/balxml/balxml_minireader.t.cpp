@@ -16,8 +16,10 @@
 #include <bslma_testallocator.h>
 #include <bslma_testallocatorexception.h>
 
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
+#include <bsl_algorithm.h>   // replace()
 #include <bsl_cstring.h>     // strlen()
 #include <bsl_cstdlib.h>     // atoi()
 #include <bsl_iostream.h>
@@ -97,9 +99,11 @@ using namespace bsl;
 // [15] lookupAttribute(ElemAtt a, char *localname, int nsId)
 //-----------------------------------------------------------------------------
 // [-1] INTERACTIVE TEST
+// [-2] PERFORMANCE
 // [ 1] BREATHING TEST
 // [15] FUZZ TEST
 // [16] USAGE EXAMPLE
+// [17] CONCERN: delimiters are found at any position.
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -813,6 +817,182 @@ int main(int argc, char *argv[])
     bsl::cout << "TEST " << __FILE__ << " CASE " << test << bsl::endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 17: {
+        // --------------------------------------------------------------------
+        // DELIMITER SEARCH
+        //
+        // Concerns:
+        //: 1 Names, attribute values, text, and whitespace of any length are
+        //:   delimited correctly, wherever they lie relative to the 16-byte
+        //:   blocks searched at a time and to the end of the parse buffer.
+        //:
+        //: 2 New lines within whitespace, text, and attribute values are
+        //:   counted.
+        //:
+        //: 3 A null character in the input ends the search, as it does for
+        //:   'strcspn', resulting in a parse error.
+        //:
+        //: 4 The results are the same whether the document is read from a
+        //:   memory buffer or from a stream buffer.
+        //
+        // Plan:
+        //: 1 For every length, 'N', from 1 to 40, and every offset, 'P', from
+        //:   0 to 16, generate a document (longer than the minimum read size)
+        //:   holding a sequence of elements having names, attribute values,
+        //:   text, and surrounding whitespace of lengths derived from 'N',
+        //:   the first element being preceded by a comment of length 'P'.
+        //:   Parse the document from a memory buffer, and from a stream
+        //:   buffer, and verify each node and the final line number.
+        //:   (C-1..2, 4)
+        //:
+        //: 2 Parse documents having a null character in whitespace, text, a
+        //:   name, and an attribute value, and verify that parsing fails.
+        //:   (C-3)
+        //
+        // Testing:
+        //   CONCERN: delimiters are found at any position.
+        // --------------------------------------------------------------------
+
+        if (verbose) bsl::cout << "\nDELIMITER SEARCH"
+                               << "\n================" << bsl::endl;
+
+        if (verbose) bsl::cout << "\nTesting well-formed documents."
+                               << bsl::endl;
+
+        for (int n = 1; n <= 40; ++n) {
+            for (int p = 0; p <= 16; ++p) {
+                const bsl::string NAME(n, 'n');
+                const bsl::string VALUE(n - 1, 'v');
+                const bsl::string TEXT(n, 't');
+                const bsl::string SPACE(n % 20, ' ');
+
+                const int NUM_ELEMENTS = 2048 / (4 * n + 40) + 2;
+
+                bsl::string doc("<R><!--");
+                doc.append(p, '-');
+                doc.append("-->");
+                for (int i = 0; i < NUM_ELEMENTS; ++i) {
+                    doc.append("\n");
+                    doc.append(SPACE);
+                    doc.append("<" + NAME + " a" + SPACE + "='" + VALUE +
+                               "\n'" + SPACE + ">");
+                    doc.append(TEXT + "\n" + TEXT);
+                    doc.append("</" + NAME + SPACE + ">");
+                }
+                doc.append("\n</R>");
+
+                if (veryVeryVerbose) { P(doc) }
+
+                for (int useStreamBuf = 0; useStreamBuf < 2; ++useStreamBuf) {
+                    if (veryVerbose) { T_ P_(n) P_(p) P(useStreamBuf) }
+
+                    bsl::stringbuf streamBuf(doc);
+
+                    Obj reader;
+                    int rc = useStreamBuf
+                           ? reader.open(&streamBuf, "test.xml")
+                           : reader.open(doc.data(), doc.size(), "test.xml");
+                    ASSERTV(n, p, rc, 0 == rc);
+
+                    rc = reader.advanceToNextNode();            // <R>
+                    ASSERTV(n, p, rc, 0 == rc);
+                    rc = reader.advanceToNextNode();            // <!-- -->
+                    ASSERTV(n, p, rc, 0 == rc);
+                    ASSERTV(n, p, reader.nodeType(),
+                            Obj::e_NODE_TYPE_COMMENT == reader.nodeType());
+                    ASSERTV(n, p, bsl::string(p, '-') == reader.nodeValue());
+
+                    for (int i = 0; i < NUM_ELEMENTS; ++i) {
+                        rc = reader.advanceToNextNode();
+                        ASSERTV(n, p, i, rc, 0 == rc);
+                        ASSERTV(n, p, i, reader.nodeType(),
+                               Obj::e_NODE_TYPE_WHITESPACE ==
+                                                           reader.nodeType());
+                        ASSERTV(n, p, i, "\n" + SPACE == reader.nodeValue());
+
+                        rc = reader.advanceToNextNode();
+                        ASSERTV(n, p, i, rc, 0 == rc);
+                        ASSERTV(n, p, i, reader.nodeType(),
+                                Obj::e_NODE_TYPE_ELEMENT == reader.nodeType());
+                        ASSERTV(n, p, i, NAME == reader.nodeName());
+                        ASSERTV(n, p, i, 1 == reader.numAttributes());
+
+                        ElementAttribute attribute;
+                        rc = reader.lookupAttribute(&attribute, 0);
+                        ASSERTV(n, p, i, rc, 0 == rc);
+                        ASSERTV(n, p, i,
+                                !bsl::strcmp("a", attribute.qualifiedName()));
+                        ASSERTV(n, p, i, VALUE + "\n" == attribute.value());
+
+                        rc = reader.advanceToNextNode();
+                        ASSERTV(n, p, i, rc, 0 == rc);
+                        ASSERTV(n, p, i, reader.nodeType(),
+                                Obj::e_NODE_TYPE_TEXT == reader.nodeType());
+                        ASSERTV(n, p, i, TEXT + "\n" + TEXT ==
+                                                           reader.nodeValue());
+
+                        rc = reader.advanceToNextNode();
+                        ASSERTV(n, p, i, rc, 0 == rc);
+                        ASSERTV(n, p, i, reader.nodeType(),
+                               Obj::e_NODE_TYPE_END_ELEMENT ==
+                                                           reader.nodeType());
+                        ASSERTV(n, p, i, NAME == reader.nodeName());
+                    }
+
+                    rc = reader.advanceToNextNode();            // whitespace
+                    ASSERTV(n, p, rc, 0 == rc);
+                    rc = reader.advanceToNextNode();            // </R>
+                    ASSERTV(n, p, rc, 0 == rc);
+                    ASSERTV(n, p, reader.nodeType(),
+                            Obj::e_NODE_TYPE_END_ELEMENT == reader.nodeType());
+
+                    const int LINE_NUMBER = 3 * NUM_ELEMENTS + 2;
+                    ASSERTV(n, p, reader.getLineNumber(),
+                            LINE_NUMBER == reader.getLineNumber());
+
+                    rc = reader.advanceToNextNode();
+                    ASSERTV(n, p, rc, 1 == rc);
+
+                    reader.close();
+                }
+            }
+        }
+
+        if (verbose) bsl::cout << "\nTesting null characters." << bsl::endl;
+        {
+            static const struct {
+                int         d_line;   // source line number
+                const char *d_input;  // document ('@' is replaced by '\0')
+            } DATA[] = {
+                //LINE  INPUT
+                //----  ---------------------------------------------------
+                { L_,   "<R>  @  <A/></R>"                                  },
+                { L_,   "<R>abcdefghijklmnopqrstuvwxyz@abc<A/></R>"         },
+                { L_,   "<R><ABCDEFGHIJKLMNOPQR@STUVWXYZ/></R>"             },
+                { L_,   "<R><A b='abcdefghijklmnopqrstuvwxyz@ABC'/></R>"    },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int LINE = DATA[ti].d_line;
+
+                bsl::string input(DATA[ti].d_input);
+                bsl::replace(input.begin(), input.end(), '@', '\0');
+
+                if (veryVerbose) { T_ P_(LINE) P(DATA[ti].d_input) }
+
+                Obj reader;
+                int rc = reader.open(input.data(), input.size());
+                ASSERTV(LINE, rc, 0 == rc);
+
+                while (0 == (rc = reader.advanceToNextNode())) {
+                }
+                ASSERTV(LINE, rc, 0 > rc);
+
+                reader.close();
+            }
+        }
+      } break;
       case 16: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
@@ -4158,6 +4338,85 @@ int main(int argc, char *argv[])
         reader.close();
 
       } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 The throughput of the parser, for a document read from a memory
+        //:   buffer and from a stream buffer, is measurable.
+        //
+        // Plan:
+        //: 1 Generate a document of markup-dense elements, and a document of
+        //:   text-heavy elements, and report the time taken to read every
+        //:   node of each.  The number of elements may be supplied as the
+        //:   second argument (default 200000).
+        //
+        // Testing:
+        //   PERFORMANCE
+        // --------------------------------------------------------------------
+
+        if (verbose) bsl::cout << "\nPERFORMANCE TEST"
+                               << "\n================" << bsl::endl;
+
+        const int NUM_ELEMENTS = argc > 2 && 0 < bsl::atoi(argv[2])
+                               ? bsl::atoi(argv[2])
+                               : 200000;
+
+        const bsl::string NOTES(
+                        "Lorem ipsum dolor sit amet, consectetur adipiscing "
+                        "elit, sed do eiusmod tempor incididunt ut labore et "
+                        "dolore magna aliqua.");
+
+        for (int heavy = 0; heavy < 2; ++heavy) {
+            bsl::ostringstream oss;
+            oss << "<?xml version='1.0'?>\n<Root>\n";
+            for (int i = 0; i < NUM_ELEMENTS; ++i) {
+                if (heavy) {
+                    oss << "<e a='" << i << "'>" << NOTES << ' ' << NOTES
+                        << ' ' << NOTES << "</e>\n";
+                    continue;
+                }
+                oss << "  <Employee id='" << i << "' dept=\"R &amp; D\">\n"
+                    << "    <name>Employee " << i << "</name>\n"
+                    << "    <!-- a comment -->\n"
+                    << "    <address street='Some Street' city='City'/>\n"
+                    << "    <notes>" << NOTES << "</notes>\n"
+                    << "  </Employee>\n";
+            }
+            oss << "</Root>\n";
+            const bsl::string doc = oss.str();
+
+            for (int useStreamBuf = 0; useStreamBuf < 2; ++useStreamBuf) {
+                bsl::stringbuf streamBuf(doc);
+
+                bsls::Stopwatch timer;
+                timer.start();
+
+                Obj reader;
+                int rc = useStreamBuf
+                       ? reader.open(&streamBuf)
+                       : reader.open(doc.data(), doc.size());
+                ASSERT(0 == rc);
+
+                int numNodes = 0;
+                while (0 == (rc = reader.advanceToNextNode())) {
+                    ++numNodes;
+                }
+                ASSERT(1 == rc);
+                timer.stop();
+
+                const double seconds = timer.elapsedTime();
+                bsl::cout << (heavy ? "text-heavy " : "markup     ")
+                          << (useStreamBuf ? "streambuf: " : "memory:    ")
+                          << doc.size() / 1e6 << " MB, "
+                          << numNodes << " nodes, "
+                          << seconds << "s, "
+                          << doc.size() / 1e6 / seconds << " MB/s"
+                          << bsl::endl;
+            }
+        }
+      } break;
       default: {
         bsl::cerr << "WARNING: CASE `" << test << "' NOT FOUND." << bsl::endl;
         testStatus = -1;
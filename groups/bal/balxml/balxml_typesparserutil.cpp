@@ -14,9 +14,10 @@ BSLS_IDENT_RCSID(balxml_typesparserutil_cpp,"$Id$ $CSID$")
 
 #include <balxml_typesprintutil.h>  // for testing only
 
-#include <balxml_base64parser.h>
 #include <balxml_hexparser.h>
 
+#include <bdlde_base64util.h>
+
 #include <bdlsb_fixedmeminstreambuf.h>
 
 #include <bdldfp_decimalutil.h>
@@ -351,19 +352,23 @@ int TypesParserUtil_Imp::parseBase64(bsl::string                *result,
                                      int                         inputLength,
                                      bdlat_TypeCategory::Simple)
 {
-    enum { BAEXML_FAILURE = -1 };
+    enum { BAEXML_SUCCESS = 0, BAEXML_FAILURE = -1 };
 
-    Base64Parser<bsl::string> base64Parser;
+    // The input is contiguous: decode it at once, instead of pushing it
+    // through a 'Base64Parser' one character at a time.
 
-    if (0 != base64Parser.beginParse(result)) {
-        return BAEXML_FAILURE;                                        // RETURN
-    }
+    result->resize(bdlde::Base64Util::maxDecodedLength(inputLength));
 
-    if (0 != base64Parser.pushCharacters(input, input + inputLength)) {
+    bsl::size_t numOut = 0;
+    if (0 != bdlde::Base64Util::decode(result->data(),
+                                       &numOut,
+                                       input,
+                                       inputLength)) {
         return BAEXML_FAILURE;                                        // RETURN
     }
 
-    return base64Parser.endParse();
+    result->resize(numOut);
+    return BAEXML_SUCCESS;
 }
 
 int TypesParserUtil_Imp::parseBase64(bsl::vector<char>         *result,
@@ -371,19 +376,20 @@ int TypesParserUtil_Imp::parseBase64(bsl::vector<char>         *result,
                                      int                        inputLength,
                                      bdlat_TypeCategory::Array)
 {
-    enum { BAEXML_FAILURE = -1 };
-
-    Base64Parser<bsl::vector<char> > base64Parser;
+    enum { BAEXML_SUCCESS = 0, BAEXML_FAILURE = -1 };
 
-    if (0 != base64Parser.beginParse(result)) {
-        return BAEXML_FAILURE;                                        // RETURN
-    }
+    result->resize(bdlde::Base64Util::maxDecodedLength(inputLength));
 
-    if (0 != base64Parser.pushCharacters(input, input + inputLength)) {
+    bsl::size_t numOut = 0;
+    if (0 != bdlde::Base64Util::decode(result->data(),
+                                       &numOut,
+                                       input,
+                                       inputLength)) {
         return BAEXML_FAILURE;                                        // RETURN
     }
 
-    return base64Parser.endParse();
+    result->resize(numOut);
+    return BAEXML_SUCCESS;
 }
 
 // DECIMAL FUNCTIONS
@@ -12,8 +12,9 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(balxml_typesprintutil_cpp,"$Id$ $CSID$")
 
+#include <bdlb_floatformatutil.h>
 #include <bdlb_print.h>
-#include <bdlde_base64encoder.h>
+#include <bdlde_base64util.h>
 #include <bdldfp_decimalutil.h>
 
 #include <bsla_fallthrough.h>
@@ -33,30 +34,37 @@ namespace u {
 
 // HELPER FUNCTIONS
 
-template <class INPUT_ITERATOR>
 bsl::ostream& encodeBase64(bsl::ostream&  stream,
-                           INPUT_ITERATOR begin,
-                           INPUT_ITERATOR end)
-    // Write the base64 encoding of the character sequence defined by the
-    // specified 'begin' and 'end' iterators into the specified 'stream' and
-    // return 'stream'.  Each instantiation of this private function is called
-    // only once (by the functions below) and can thus be inlined without
-    // causing code bloat.
+                           const char    *data,
+                           bsl::size_t    length)
+    // Write the base64 encoding of the specified 'data' of the specified
+    // 'length' into the specified 'stream' and return 'stream'.  The encoding
+    // is performed in chunks of a multiple of 3 bytes, each of which is
+    // encoded into a local buffer, and written to 'stream' at once.
 {
-    bdlde::Base64Encoder base64Encoder(0);  // 0 means do not insert CRLF
+    // Encode 'k_CHUNK_LENGTH' bytes (a multiple of 3) at once, into
+    // 'k_ENCODED_LENGTH' characters.
 
-    {
-        bsl::ostreambuf_iterator<char> outputIterator(stream);
+    const bsl::size_t k_CHUNK_LENGTH   = 768;
+    const bsl::size_t k_ENCODED_LENGTH = k_CHUNK_LENGTH / 3 * 4;
 
-        int status = base64Encoder.convert(outputIterator, begin, end);
-        (void)status; BSLS_ASSERT(0 == status);  // nothing should be retained
-    }
+    char buffer[k_ENCODED_LENGTH];
 
-    {
-        bsl::ostreambuf_iterator<char> outputIterator(stream);
+    while (0 < length) {
+        const bsl::size_t chunkLength = length < k_CHUNK_LENGTH
+                                      ? length
+                                      : k_CHUNK_LENGTH;
 
-        int status = base64Encoder.endConvert(outputIterator);
-        (void)status; BSLS_ASSERT(0 == status);  // nothing should be retained
+        // 0 means do not insert CRLF
+
+        const bsl::size_t numOut = bdlde::Base64Util::encode(buffer,
+                                                             data,
+                                                             chunkLength,
+                                                             0);
+        stream.write(buffer, numOut);
+
+        data   += chunkLength;
+        length -= chunkLength;
     }
 
     return stream;
@@ -797,7 +805,7 @@ TypesPrintUtil_Imp::printBase64(bsl::ostream&               stream,
                                 bdlat_TypeCategory::Simple)
 {
     // Calls a function in the unnamed namespace.  Cannot be inlined.
-    return u::encodeBase64(stream, object.begin(), object.end());
+    return u::encodeBase64(stream, object.data(), object.size());
 }
 
 bsl::ostream&
@@ -807,7 +815,7 @@ TypesPrintUtil_Imp::printBase64(bsl::ostream&               stream,
                                 bdlat_TypeCategory::Simple)
 {
     // Calls a function in the unnamed namespace.  Cannot be inlined.
-    return u::encodeBase64(stream, object.begin(), object.end());
+    return u::encodeBase64(stream, object.data(), object.size());
 }
 
 bsl::ostream&
@@ -817,7 +825,7 @@ TypesPrintUtil_Imp::printBase64(bsl::ostream&              stream,
                                 bdlat_TypeCategory::Array)
 {
     // Calls a function in the unnamed namespace.  Cannot be inlined.
-    return u::encodeBase64(stream, object.begin(), object.end());
+    return u::encodeBase64(stream, object.data(), object.size());
 }
 
 // HEX FUNCTIONS
@@ -966,11 +974,11 @@ TypesPrintUtil_Imp::printDecimal(bsl::ostream&               stream,
     return stream;
 }
 
-bsl::ostream& TypesPrintUtil_Imp::printDefault(
-                                            bsl::ostream&               stream,
-                                            const float&                object,
-                                            const EncoderOptions       *,
-                                            bdlat_TypeCategory::Simple)
+bsl::ostream&
+TypesPrintUtil_Imp::printDefault(bsl::ostream&               stream,
+                                 const float&                object,
+                                 const EncoderOptions       *encoderOptions,
+                                 bdlat_TypeCategory::Simple)
 {
     switch (bdlb::Float::classifyFine(object)) {
       case bdlb::Float::k_POSITIVE_INFINITY: {
@@ -986,37 +994,48 @@ bsl::ostream& TypesPrintUtil_Imp::printDefault(
       default: {
         // not a NaN and not +/- INFINITY
 
-        // On Sun, formatting a 'double' using 'ostream' is 60% slower than
-        // 'sprintf', even though the former calls the latter.  Also, note that
-        // 'snprintf' is 15% slower than 'sprintf' on Sun.
+        // Unless a fixed precision is requested, write the fewest digits that
+        // round-trip, which is both faster than formatting with 'sprintf'
+        // and, unlike a fixed precision, neither lossy nor padded with noise
+        // digits.
 
-        char buffer[FLT_DIG + 20];  // buffer with headroom
+        if (encoderOptions
+         && encoderOptions->useFixedFloatingPointPrecision()) {
+            char buffer[FLT_DIG + 20];  // buffer with headroom
 
 #if defined(BSLS_PLATFORM_CMP_MSVC)
 #pragma warning(push)
 #pragma warning(disable:4996)     // suppress 'sprintf' deprecation warning
 #endif
 
-        const int len =
+            const int len =
                     bsl::sprintf(buffer, "%.*g", FLT_DIG + 1, (double) object);
-        BSLS_ASSERT(len < (int) sizeof buffer);
+            BSLS_ASSERT(len < (int) sizeof buffer);
 
 #if defined(BSLS_PLATFORM_CMP_MSVC)
 #pragma warning(pop)
 #endif
 
-        stream.write(buffer, len);
+            stream.write(buffer, len);
+        }
+        else {
+            char buffer[bdlb::FloatFormatUtil::k_MAX_FLOAT_LENGTH];
+
+            const int len = bdlb::FloatFormatUtil::formatShortest(buffer,
+                                                                  object);
+            stream.write(buffer, len);
+        }
       } break;
     }
 
     return stream;
 }
 
-bsl::ostream& TypesPrintUtil_Imp::printDefault(
-                                            bsl::ostream&               stream,
-                                            const double&               object,
-                                            const EncoderOptions       *,
-                                            bdlat_TypeCategory::Simple)
+bsl::ostream&
+TypesPrintUtil_Imp::printDefault(bsl::ostream&               stream,
+                                 const double&               object,
+                                 const EncoderOptions       *encoderOptions,
+                                 bdlat_TypeCategory::Simple)
 {
     switch (bdlb::Float::classifyFine(object)) {
       case bdlb::Float::k_POSITIVE_INFINITY: {
@@ -1032,25 +1051,31 @@ bsl::ostream& TypesPrintUtil_Imp::printDefault(
       default: {
         // not a NaN and not +/- INFINITY
 
-        // On Sun, formatting a 'double' using 'ostream' is 60% slower than
-        // 'sprintf', even though the former calls the latter.  Also, note that
-        // 'snprintf' is 15% slower than 'sprintf' on Sun.
-
-        char buffer[DBL_DIG + 20];  // buffer with headroom
+        if (encoderOptions
+         && encoderOptions->useFixedFloatingPointPrecision()) {
+            char buffer[DBL_DIG + 20];  // buffer with headroom
 
 #if defined(BSLS_PLATFORM_CMP_MSVC)
 #pragma warning(push)
 #pragma warning(disable:4996)     // suppress 'sprintf' deprecation warning
 #endif
 
-        const int len = bsl::sprintf(buffer, "%.*g", DBL_DIG + 1, object);
-        BSLS_ASSERT(len < (int) sizeof buffer);
+            const int len = bsl::sprintf(buffer, "%.*g", DBL_DIG + 1, object);
+            BSLS_ASSERT(len < (int) sizeof buffer);
 
 #if defined(BSLS_PLATFORM_CMP_MSVC)
 #pragma warning(pop)
 #endif
 
-        stream.write(buffer, len);
+            stream.write(buffer, len);
+        }
+        else {
+            char buffer[bdlb::FloatFormatUtil::k_MAX_DOUBLE_LENGTH];
+
+            const int len = bdlb::FloatFormatUtil::formatShortest(buffer,
+                                                                  object);
+            stream.write(buffer, len);
+        }
       } break;
     }
 
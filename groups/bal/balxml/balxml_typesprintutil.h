@@ -104,6 +104,13 @@ BSLS_IDENT("$Id: $")
 //      ---------------------               -----------------------
 //      Enumeration                         TEXT
 //..
+// Note that 'float' and 'double' values printed in the DEFAULT formatting mode
+// are written in the 'xs:float' and 'xs:double' lexical forms with the fewest
+// significant digits that, when parsed, yield the original value (see
+// 'bdlb_floatformatutil'), unless the 'useFixedFloatingPointPrecision'
+// attribute of the supplied 'balxml::EncoderOptions' is 'true', in which case
+// they are written with 'FLT_DIG + 1' and 'DBL_DIG + 1' significant digits,
+// respectively.
 //
 ///Behavior of 'printText' on Non-Valid Strings
 ///--------------------------------------------
@@ -91,16 +91,6 @@ void aSsErT(bool condition, const char *message, int line)
 #define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
 #define L_           BSLIM_TESTUTIL_L_  // current Line number
 
-// ============================================================================
-//                   MACROS FOR TESTING WORKAROUNDS
-// ----------------------------------------------------------------------------
-
-#if defined(BSLS_PLATFORM_CMP_MSVC) && BSLS_PLATFORM_CMP_VERSION < 1900
-    // 'snprintf' on older Windows libraries outputs an additional '0' in the
-    // exponent for scientific notation.
-# define BALXML_TYPESPRINTUTIL_EXTRA_ZERO_PADDING_FOR_EXPONENTS 1
-#endif
-
 // ============================================================================
 //                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
 // ----------------------------------------------------------------------------
@@ -1179,12 +1169,6 @@ int main(int argc, char *argv[])
         {
             typedef float Type;
 
-#if defined(BALXML_TYPESPRINTUTIL_EXTRA_ZERO_PADDING_FOR_EXPONENTS)
-#define ZERO   "0"
-#else
-#define ZERO
-#endif
-
             static const struct {
                 int         d_lineNum;
                 Type        d_input;
@@ -1195,12 +1179,14 @@ int main(int argc, char *argv[])
                 { L_,     -1.0f,          "-1"                            },
                 { L_,     -0.1f,          "-0.1"                          },
                 { L_,     -0.1234567f,    "-0.1234567"                    },
-                { L_,     -1.234567e-35f, "-1.234567e-" ZERO "35"         },
+                { L_,     -1.234567e-35f, "-1.234567e-35"                 },
                 { L_,     0.0f,           "0"                             },
                 { L_,     0.1f,           "0.1"                           },
                 { L_,     1.0f,           "1"                             },
                 { L_,     1234567.0f,     "1234567"                       },
-                { L_,     1.234567e35f,   "1.234567e+" ZERO "35"          },
+                { L_,     1.234567e35f,   "1.234567e+35"                  },
+                { L_,     0.123456789f,   "0.12345679"                    },
+                { L_,     1.0e9f,         "1e+09"                         },
                 { L_,     bsl::numeric_limits<float>::infinity(),
                                           "+INF"                          },
                 { L_,    -bsl::numeric_limits<float>::infinity(),
@@ -1208,7 +1194,6 @@ int main(int argc, char *argv[])
                 { L_,     bsl::numeric_limits<float>::signaling_NaN(),
                                           "NaN"                           },
             };
-#undef ZERO
             const int NUM_DATA = sizeof DATA / sizeof *DATA;
 
             for (int i = 0; i < NUM_DATA; ++i) {
@@ -1244,6 +1229,11 @@ int main(int argc, char *argv[])
                 { L_,     1.0,        "1"              },
                 { L_,123456789012345.0, "123456789012345"},
                 { L_,1.23456789012345e105,"1.23456789012345e+105"  },
+                { L_,     0.1 + 0.2,  "0.30000000000000004"    },
+                { L_,     1.0 / 3,    "0.3333333333333333"     },
+                { L_,     1e16,       "10000000000000000"      },
+                { L_,     1e17,       "1e+17"                  },
+                { L_,     DBL_MAX,    "1.7976931348623157e+308"},
                 { L_,  bsl::numeric_limits<double>::infinity(), "+INF"},
                 { L_, -bsl::numeric_limits<double>::infinity(), "-INF"},
                 { L_,  bsl::numeric_limits<double>::signaling_NaN(), "NaN"},
@@ -1263,6 +1253,62 @@ int main(int argc, char *argv[])
             }
         }
 
+        if (verbose) cout << "\nUsing 'float' and 'double' with "
+                             "'UseFixedFloatingPointPrecision'." << endl;
+        {
+            static const struct {
+                int         d_lineNum;
+                double      d_input;
+                bool        d_isFloat;
+                const char *d_shortest;
+                const char *d_fixed;
+            } DATA[] = {
+                //line input         float shortest            fixed
+                //---- -----         ----- --------            -----
+                { L_,  0.1,          true, "0.1",              "0.1"       },
+                { L_,  0.123456789,  true, "0.12345679",       "0.1234568" },
+                { L_,  1.0e9,        true, "1e+09",            "1e+09"     },
+                { L_,  0.1,         false, "0.1",              "0.1"       },
+                { L_,  0.1 + 0.2,   false, "0.30000000000000004",
+                                                               "0.3"       },
+                { L_,  1e16,        false, "10000000000000000",
+                                                               "1e+16"     },
+                { L_,  DBL_MAX,     false, "1.7976931348623157e+308",
+                                                  "1.797693134862316e+308" },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int i = 0; i < NUM_DATA; ++i) {
+                const int         LINE     = DATA[i].d_lineNum;
+                const double      INPUT    = DATA[i].d_input;
+                const bool        IS_FLOAT = DATA[i].d_isFloat;
+                const bsl::string SHORTEST = DATA[i].d_shortest;
+                const bsl::string FIXED    = DATA[i].d_fixed;
+
+                balxml::EncoderOptions options;
+                ASSERT(false == options.useFixedFloatingPointPrecision());
+
+                for (int fixed = 0; fixed < 2; ++fixed) {
+                    options.setUseFixedFloatingPointPrecision(fixed);
+
+                    const bsl::string& EXP = fixed ? FIXED : SHORTEST;
+
+                    bsl::stringstream ss;
+
+                    if (IS_FLOAT) {
+                        Util::printDefault(ss,
+                                           static_cast<float>(INPUT),
+                                           &options);
+                    }
+                    else {
+                        Util::printDefault(ss, INPUT, &options);
+                    }
+
+                    ASSERTV(LINE, fixed, ss.str(), EXP, EXP == ss.str());
+                }
+            }
+        }
+
         if (verbose) cout << "\nUsing 'Decimal64'." << endl;
         {
             typedef bdldfp::Decimal64         Type;
@@ -0,0 +1,154 @@
+// bdlb_floatformatutil.h                                             -*-C++-*-
+#ifndef INCLUDED_BDLB_FLOATFORMATUTIL
+#define INCLUDED_BDLB_FLOATFORMATUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide shortest round-trip text formatting of floating point.
+//
+//@CLASSES:
+//  bdlb::FloatFormatUtil: namespace for floating point formatting functions
+//
+//@SEE_ALSO: bdlb_numericparseutil, bdlb_float
+//
+//@DESCRIPTION: This component provides a namespace, 'bdlb::FloatFormatUtil',
+// containing functions that write the text representation of a 'double' or
+// 'float' value having the fewest significant digits that, when parsed back
+// (e.g., by 'strtod', 'strtof', or 'bdlb::NumericParseUtil::parseDouble'),
+// yields exactly the original value.
+//
+// Formatting a value with a fixed number of significant digits (e.g., by
+// 'sprintf' with the "%.15g" format) either loses information (when the
+// precision is too low to distinguish the value from its neighbors) or writes
+// noise digits (when it is not, e.g., "0.10000000000000001" for 0.1).  The
+// shortest round-trip representation has neither defect: 0.1 is written as
+// "0.1", and 'DBL_MAX' is written as "1.7976931348623157e+308".
+//
+///Output Format
+///-------------
+// The text written is the same as that written by 'sprintf' with the "%.17g"
+// format (for a 'double') or the "%.9g" format (for a 'float') -- the
+// precisions that suffice to represent any value of the respective type --
+// except that only the shortest round-trip sequence of significant digits is
+// written:
+//
+//: o If the decimal exponent of the value (i.e., the power of ten of its most
+//:   significant digit) is less than -4, or is greater than or equal to 17 for
+//:   a 'double' (9 for a 'float'), the value is written in scientific
+//:   notation: one digit, then (if there are more significant digits) a
+//:   decimal point followed by the remaining digits, then 'e', the sign of
+//:   the exponent, and at least two exponent digits (e.g., "1e+20",
+//:   "1.25e-05").
+//:
+//: o Otherwise the value is written in fixed notation, without an exponent,
+//:   and without a decimal point if the value is an integer (e.g., "100",
+//:   "0.001", "123.5").
+//
+// A negative value (including negative zero) is preceded by '-'.  Infinite
+// values are written as "inf" and "-inf", and NaN values as "nan" (or
+// "-nan" if the sign bit is set).  The text is always in the "C" locale, and
+// is a valid JSON number and a valid 'xs:double' lexical value (unless the
+// value is infinite or NaN).
+//
+// The text is not null-terminated; its length is returned, and never exceeds
+// 'k_MAX_DOUBLE_LENGTH' (for a 'double') or 'k_MAX_FLOAT_LENGTH' (for a
+// 'float') characters.
+//
+///Implementation
+///--------------
+// The shortest digits are computed by the Ryu algorithm (see Ulf Adams,
+// "Ryu: Fast Float-to-String Conversion", PLDI 2018), which uses only 64-bit
+// integer arithmetic and a table of (128-bit) powers of five, and is
+// substantially faster than formatting by 'sprintf' with a fixed precision.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Writing Prices
+///- - - - - - - - - - - - -
+// Suppose we need to write a sequence of prices, represented as 'double'
+// values, to a text feed that will be parsed by another process, and that the
+// values parsed by that process must be exactly the values we hold.
+//
+// First, we define the prices:
+//..
+//  const double prices[] = { 100.25, 0.1, 1.0 / 3, 1e-7, 2.5e21 };
+//  const int    numPrices = sizeof prices / sizeof *prices;
+//..
+// Then, we format each price into a buffer of sufficient size, and append it
+// to the feed:
+//..
+//  bsl::string feed;
+//  for (int i = 0; i < numPrices; ++i) {
+//      char      buffer[bdlb::FloatFormatUtil::k_MAX_DOUBLE_LENGTH];
+//      const int length = bdlb::FloatFormatUtil::formatShortest(buffer,
+//                                                               prices[i]);
+//      feed.append(buffer, length);
+//      feed.push_back(' ');
+//  }
+//..
+// Finally, we observe that each value is written with no more digits than
+// needed to identify it:
+//..
+//  assert("100.25 0.1 0.3333333333333333 1e-07 2.5e+21 " == feed);
+//..
+
+#include <bdlscm_version.h>
+
+namespace BloombergLP {
+namespace bdlb {
+
+                           // ======================
+                           // struct FloatFormatUtil
+                           // ======================
+
+struct FloatFormatUtil {
+    // This 'struct' provides a namespace for functions that write the
+    // shortest round-trip text representation of floating point values.
+
+    // TYPES
+    enum {
+        k_MAX_DOUBLE_LENGTH = 24,  // maximum length of a formatted 'double'
+        k_MAX_FLOAT_LENGTH  = 15   // maximum length of a formatted 'float'
+    };
+
+    // CLASS METHODS
+    static int formatShortest(char *buffer, double value);
+        // Write the shortest round-trip text representation of the specified
+        // 'value' (see {Output Format}) to the specified 'buffer', and return
+        // the number of characters written.  The text is not null-terminated.
+        // The behavior is undefined unless 'buffer' has room for at least
+        // 'k_MAX_DOUBLE_LENGTH' characters.
+
+    static int formatShortest(char *buffer, float value);
+        // Write the shortest round-trip text representation of the specified
+        // 'value' (see {Output Format}) to the specified 'buffer', and return
+        // the number of characters written.  The text is not null-terminated.
+        // The behavior is undefined unless 'buffer' has room for at least
+        // 'k_MAX_FLOAT_LENGTH' characters.  Note that the representation is
+        // the shortest that round-trips to the 'float' 'value', which is
+        // generally shorter than that of the 'double' converted from 'value'.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,673 @@
+// bdlb_floatformatutil.t.cpp                                         -*-C++-*-
+#include <bdlb_floatformatutil.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cfloat.h>
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_limits.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides functions that format floating point
+// values.  We verify the format (notation, sign, exponent, and special values)
+// with tables of values and their expected text, and verify the two defining
+// properties of the digits -- that they round-trip, and that no shorter
+// sequence of digits does -- against the C library ('strtod', 'strtof', and
+// 'sprintf') for a large number of pseudo-random bit patterns.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] int formatShortest(char *buffer, double value);
+// [ 3] int formatShortest(char *buffer, float value);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CONCERN: the digits are the shortest that round-trip
+// [ 5] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                     NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+#define ASSERT_PASS_RAW(EXPR)  BSLS_ASSERTTEST_ASSERT_PASS_RAW(EXPR)
+#define ASSERT_FAIL_RAW(EXPR)  BSLS_ASSERTTEST_ASSERT_FAIL_RAW(EXPR)
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlb::FloatFormatUtil Util;
+typedef bsls::Types::Uint64   Uint64;
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static bsl::string formatDouble(double value)
+    // Return the text written by 'Util::formatShortest' for the specified
+    // 'value'.
+{
+    char      buffer[Util::k_MAX_DOUBLE_LENGTH + 1];
+    bsl::memset(buffer, 'X', sizeof buffer);
+
+    const int length = Util::formatShortest(buffer, value);
+    ASSERTV(value, length, 0 < length && length <= Util::k_MAX_DOUBLE_LENGTH);
+    ASSERTV(value, 'X' == buffer[Util::k_MAX_DOUBLE_LENGTH]);
+    return bsl::string(buffer, length);
+}
+
+static bsl::string formatFloat(float value)
+    // Return the text written by 'Util::formatShortest' for the specified
+    // 'value'.
+{
+    char      buffer[Util::k_MAX_FLOAT_LENGTH + 1];
+    bsl::memset(buffer, 'X', sizeof buffer);
+
+    const int length = Util::formatShortest(buffer, value);
+    ASSERTV(value, length, 0 < length && length <= Util::k_MAX_FLOAT_LENGTH);
+    ASSERTV(value, 'X' == buffer[Util::k_MAX_FLOAT_LENGTH]);
+    return bsl::string(buffer, length);
+}
+
+static int numSignificantDigits(const bsl::string& text)
+    // Return the number of significant digits in the specified 'text',
+    // representing a finite floating point value, ignoring leading and
+    // trailing zeros (and returning 1 for zero).
+{
+    bsl::string digits;
+    for (bsl::size_t i = 0; i < text.size() && 'e' != text[i]; ++i) {
+        if ('0' <= text[i] && text[i] <= '9') {
+            digits.push_back(text[i]);
+        }
+    }
+
+    const bsl::size_t first = digits.find_first_not_of('0');
+    if (bsl::string::npos == first) {
+        return 1;                                                     // RETURN
+    }
+    const bsl::size_t last = digits.find_last_not_of('0');
+    return static_cast<int>(last - first + 1);
+}
+
+static Uint64 nextRandom(Uint64 *state)
+    // Return the next value of the pseudo-random sequence whose state is at
+    // the specified 'state' address.
+{
+    *state = *state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return *state ^ (*state >> 29);
+}
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator         da("default", veryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Writing Prices
+///- - - - - - - - - - - - -
+// Suppose we need to write a sequence of prices, represented as 'double'
+// values, to a text feed that will be parsed by another process, and that the
+// values parsed by that process must be exactly the values we hold.
+//
+// First, we define the prices:
+//..
+    const double prices[] = { 100.25, 0.1, 1.0 / 3, 1e-7, 2.5e21 };
+    const int    numPrices = sizeof prices / sizeof *prices;
+//..
+// Then, we format each price into a buffer of sufficient size, and append it
+// to the feed:
+//..
+    bsl::string feed;
+    for (int i = 0; i < numPrices; ++i) {
+        char      buffer[bdlb::FloatFormatUtil::k_MAX_DOUBLE_LENGTH];
+        const int length = bdlb::FloatFormatUtil::formatShortest(buffer,
+                                                                 prices[i]);
+        feed.append(buffer, length);
+        feed.push_back(' ');
+    }
+//..
+// Finally, we observe that each value is written with no more digits than
+// needed to identify it:
+//..
+    ASSERT("100.25 0.1 0.3333333333333333 1e-07 2.5e+21 " == feed);
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCERN: THE DIGITS ARE THE SHORTEST THAT ROUND-TRIP
+        //
+        // Concerns:
+        //: 1 The text written for any finite 'double' or 'float' value parses
+        //:   back (by 'strtod' or 'strtof') to exactly that value.
+        //:
+        //: 2 No representation having fewer significant digits round-trips.
+        //:
+        //: 3 The length of the text does not exceed 'k_MAX_DOUBLE_LENGTH'
+        //:   (or 'k_MAX_FLOAT_LENGTH').
+        //
+        // Plan:
+        //: 1 For a large number of pseudo-random bit patterns, and of values
+        //:   having few decimal digits (e.g., prices), format the value,
+        //:   verify that 'strtod' (or 'strtof') of the text yields the value,
+        //:   and that the text written by 'sprintf' with the "%.*g" format
+        //:   and a precision one less than the number of significant digits
+        //:   of the text does not.  (C-1..3)
+        //
+        // Testing:
+        //   CONCERN: the digits are the shortest that round-trip
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: THE DIGITS ARE THE SHORTEST THAT "
+                          << "ROUND-TRIP" << endl
+                          << "=========================================="
+                          << "==========" << endl;
+
+        const int NUM_VALUES = 200000;
+
+        Uint64 state = 12345;
+
+        if (verbose) cout << "\nTesting 'double'." << endl;
+
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            const Uint64 bits = nextRandom(&state);
+
+            double value;
+            if (i % 2) {
+                bsl::memcpy(&value, &bits, sizeof value);
+            }
+            else {
+                value = static_cast<double>(bits % 100000000) / 100;
+            }
+            if (value != value || value - value != 0) {
+                continue;                                           // CONTINUE
+            }
+
+            const bsl::string TEXT = formatDouble(value);
+            if (veryVerbose) { T_ P_(value) P(TEXT) }
+
+            const double parsed = bsl::strtod(TEXT.c_str(), 0);
+            ASSERTV(TEXT, value == parsed);
+
+            const int numDigits = numSignificantDigits(TEXT);
+            if (1 < numDigits) {
+                char shorter[512];
+                bsl::sprintf(shorter, "%.*g", numDigits - 1, value);
+                ASSERTV(TEXT, shorter,
+                        value != bsl::strtod(shorter, 0));
+            }
+        }
+
+        if (verbose) cout << "\nTesting 'float'." << endl;
+
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            const unsigned int bits =
+                                static_cast<unsigned int>(nextRandom(&state));
+
+            float value;
+            if (i % 2) {
+                bsl::memcpy(&value, &bits, sizeof value);
+            }
+            else {
+                value = static_cast<float>(bits % 1000000) / 100;
+            }
+            if (value != value || value - value != 0) {
+                continue;                                           // CONTINUE
+            }
+
+            const bsl::string TEXT = formatFloat(value);
+            if (veryVerbose) { T_ P_(value) P(TEXT) }
+
+            const float parsed = bsl::strtof(TEXT.c_str(), 0);
+            ASSERTV(TEXT, value == parsed);
+
+            const int numDigits = numSignificantDigits(TEXT);
+            if (1 < numDigits) {
+                char shorter[512];
+                bsl::sprintf(shorter,
+                             "%.*g",
+                             numDigits - 1,
+                             static_cast<double>(value));
+                ASSERTV(TEXT, shorter,
+                        value != bsl::strtof(shorter, 0));
+            }
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // FORMATTING 'float'
+        //
+        // Concerns:
+        //: 1 Values are written in the notation, and with the sign and
+        //:   exponent, documented in {Output Format}, the boundary between
+        //:   the fixed and scientific notations being at the decimal exponents
+        //:   -4 and 9.
+        //:
+        //: 2 Zero, negative zero, subnormal values, the extreme finite values,
+        //:   infinities, and NaN are written as documented.
+        //:
+        //: 3 The shortest representation of the 'float' value is written,
+        //:   not that of the 'double' value converted from it.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, format a set of values and
+        //:   verify the text.  (C-1..3)
+        //
+        // Testing:
+        //   int formatShortest(char *buffer, float value);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "FORMATTING 'float'" << endl
+                          << "==================" << endl;
+
+        static const struct {
+            int         d_line;      // source line number
+            float       d_value;     // value to format
+            const char *d_expected;  // expected text
+        } DATA[] = {
+            //LINE  VALUE               EXPECTED
+            //----  ------------------  ------------------
+            { L_,   0.0f,               "0"                },
+            { L_,   -0.0f,              "-0"               },
+            { L_,   1.0f,               "1"                },
+            { L_,   -1.5f,              "-1.5"             },
+            { L_,   0.1f,               "0.1"              },
+            { L_,   0.3f,               "0.3"              },
+            { L_,   1.0f / 3,           "0.33333334"       },
+            { L_,   100.25f,            "100.25"           },
+            { L_,   16777216.0f,        "16777216"         },
+            { L_,   123456789.0f,       "123456790"        },
+            { L_,   1e9f,               "1e+09"            },
+            { L_,   1.5e10f,            "1.5e+10"          },
+            { L_,   0.0001f,            "0.0001"           },
+            { L_,   0.00012f,           "0.00012"          },
+            { L_,   0.00001f,           "1e-05"            },
+            { L_,   FLT_MAX,            "3.4028235e+38"    },
+            { L_,   -FLT_MAX,           "-3.4028235e+38"   },
+            { L_,   FLT_MIN,            "1.1754944e-38"    },
+            { L_,   1.4e-45f,           "1e-45"            },
+            { L_,   -1.4e-45f,          "-1e-45"           },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE     = DATA[ti].d_line;
+            const float       VALUE    = DATA[ti].d_value;
+            const bsl::string EXPECTED = DATA[ti].d_expected;
+
+            const bsl::string TEXT = formatFloat(VALUE);
+            if (veryVerbose) { T_ P_(LINE) P_(EXPECTED) P(TEXT) }
+
+            ASSERTV(LINE, EXPECTED, TEXT, EXPECTED == TEXT);
+        }
+
+        if (verbose) cout << "\nTesting special values." << endl;
+        {
+            typedef bsl::numeric_limits<float> Limits;
+
+            ASSERTV(formatFloat( Limits::infinity()),
+                    "inf"  == formatFloat( Limits::infinity()));
+            ASSERTV(formatFloat(-Limits::infinity()),
+                    "-inf" == formatFloat(-Limits::infinity()));
+
+            const bsl::string NAN_TEXT = formatFloat(Limits::quiet_NaN());
+            ASSERTV(NAN_TEXT, "nan" == NAN_TEXT || "-nan" == NAN_TEXT);
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // FORMATTING 'double'
+        //
+        // Concerns:
+        //: 1 Values are written in the notation, and with the sign and
+        //:   exponent, documented in {Output Format}, the boundary between
+        //:   the fixed and scientific notations being at the decimal exponents
+        //:   -4 and 17.
+        //:
+        //: 2 Exponents of one, two, and three digits are written with at
+        //:   least two digits.
+        //:
+        //: 3 Zero, negative zero, subnormal values, the extreme finite values,
+        //:   infinities, and NaN are written as documented.
+        //:
+        //: 4 Values whose shortest representation requires 17 significant
+        //:   digits are written with 17 digits, and values exactly halfway
+        //:   between two shortest candidates are written correctly.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, format a set of values and
+        //:   verify the text.  (C-1..4)
+        //
+        // Testing:
+        //   int formatShortest(char *buffer, double value);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "FORMATTING 'double'" << endl
+                          << "===================" << endl;
+
+        static const struct {
+            int         d_line;      // source line number
+            double      d_value;     // value to format
+            const char *d_expected;  // expected text
+        } DATA[] = {
+            //LINE  VALUE                     EXPECTED
+            //----  ------------------------  -------------------------
+            { L_,   0.0,                      "0"                       },
+            { L_,   -0.0,                     "-0"                      },
+            { L_,   1.0,                      "1"                       },
+            { L_,   -1.0,                     "-1"                      },
+            { L_,   10.0,                     "10"                      },
+            { L_,   100.0,                    "100"                     },
+            { L_,   0.5,                      "0.5"                     },
+            { L_,   0.1,                      "0.1"                     },
+            { L_,   0.2,                      "0.2"                     },
+            { L_,   0.3,                      "0.3"                     },
+            { L_,   0.1 + 0.2,                "0.30000000000000004"     },
+            { L_,   1.0 / 3,                  "0.3333333333333333"      },
+            { L_,   2.0 / 3,                  "0.6666666666666666"      },
+            { L_,   100.25,                   "100.25"                  },
+            { L_,   -123.456,                 "-123.456"                },
+            { L_,   1234567.125,              "1234567.125"             },
+            { L_,   9007199254740992.0,       "9007199254740992"        },
+            { L_,   9007199254740994.0,       "9007199254740994"        },
+            { L_,   1e16,                     "10000000000000000"       },
+            { L_,   12345678901234567.0,      "12345678901234568"       },
+            { L_,   1e17,                     "1e+17"                   },
+            { L_,   1.5e17,                   "1.5e+17"                 },
+            { L_,   2.5e21,                   "2.5e+21"                 },
+            { L_,   1e100,                    "1e+100"                  },
+            { L_,   -1e-100,                  "-1e-100"                 },
+            { L_,   0.001,                    "0.001"                   },
+            { L_,   0.0001,                   "0.0001"                  },
+            { L_,   0.000123,                 "0.000123"                },
+            { L_,   0.00001,                  "1e-05"                   },
+            { L_,   1.25e-5,                  "1.25e-05"                },
+            { L_,   1e-7,                     "1e-07"                   },
+            { L_,   5e-324,                   "5e-324"                  },
+            { L_,   -5e-324,                  "-5e-324"                 },
+            { L_,   2.2250738585072009e-308,  "2.225073858507201e-308"  },
+            { L_,   DBL_MIN,                  "2.2250738585072014e-308" },
+            { L_,   DBL_MAX,                  "1.7976931348623157e+308" },
+            { L_,   -DBL_MAX,                 "-1.7976931348623157e+308"},
+            { L_,   1.7976931348623155e+308,  "1.7976931348623155e+308" },
+            { L_,   4.9406564584124654e-322,  "4.94e-322"               },
+            { L_,   9.0071992547409920e+15,   "9007199254740992"        },
+            { L_,   1.0000000000000002,       "1.0000000000000002"      },
+            { L_,   0.9999999999999999,       "0.9999999999999999"      },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE     = DATA[ti].d_line;
+            const double      VALUE    = DATA[ti].d_value;
+            const bsl::string EXPECTED = DATA[ti].d_expected;
+
+            const bsl::string TEXT = formatDouble(VALUE);
+            if (veryVerbose) { T_ P_(LINE) P_(EXPECTED) P(TEXT) }
+
+            ASSERTV(LINE, EXPECTED, TEXT, EXPECTED == TEXT);
+        }
+
+        if (verbose) cout << "\nTesting special values." << endl;
+        {
+            typedef bsl::numeric_limits<double> Limits;
+
+            ASSERTV(formatDouble( Limits::infinity()),
+                    "inf"  == formatDouble( Limits::infinity()));
+            ASSERTV(formatDouble(-Limits::infinity()),
+                    "-inf" == formatDouble(-Limits::infinity()));
+
+            const bsl::string NAN_TEXT = formatDouble(Limits::quiet_NaN());
+            ASSERTV(NAN_TEXT, "nan" == NAN_TEXT || "-nan" == NAN_TEXT);
+
+            const bsl::string NEG_NAN_TEXT =
+                                        formatDouble(-Limits::quiet_NaN());
+            ASSERTV(NEG_NAN_TEXT, "nan" == NEG_NAN_TEXT
+                               || "-nan" == NEG_NAN_TEXT);
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            char buffer[Util::k_MAX_DOUBLE_LENGTH];
+            ASSERT_PASS(Util::formatShortest(buffer, 1.0));
+            ASSERT_FAIL(Util::formatShortest(0,      1.0));
+            ASSERT_PASS(Util::formatShortest(buffer, 1.0f));
+            ASSERT_FAIL(Util::formatShortest(0,      1.0f));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Format a few values and verify the text.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        ASSERT("0.1"   == formatDouble(0.1));
+        ASSERT("-2.5"  == formatDouble(-2.5));
+        ASSERT("1e+20" == formatDouble(1e20));
+        ASSERT("0.1"   == formatFloat(0.1f));
+        ASSERT("1e+10" == formatFloat(1e10f));
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 Formatting is faster than formatting by 'sprintf' with the
+        //:   "%.17g" format.
+        //
+        // Plan:
+        //: 1 Format an array of prices (values with two decimal places) and
+        //:   an array of arbitrary values, by 'formatShortest' and by
+        //:   'sprintf', and report the times taken.  The number of values
+        //:   may be supplied as the second argument (default 1000000).
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        const int NUM_VALUES = argc > 2 && 0 < bsl::atoi(argv[2])
+                             ? bsl::atoi(argv[2])
+                             : 1000000;
+
+        bsl::vector<double> prices(NUM_VALUES);
+        bsl::vector<double> values(NUM_VALUES);
+
+        Uint64 state = 12345;
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            prices[i] = static_cast<double>(nextRandom(&state) % 1000000)
+                      / 100;
+            values[i] = static_cast<double>(nextRandom(&state))
+                      / static_cast<double>(nextRandom(&state) | 1);
+        }
+
+        for (int set = 0; set < 2; ++set) {
+            const bsl::vector<double>& DATA = set ? values : prices;
+
+            char        buffer[64];
+            bsls::Types::Int64 total = 0;
+
+            bsls::Stopwatch timer;
+            timer.start();
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                total += Util::formatShortest(buffer, DATA[i]);
+            }
+            timer.stop();
+            const double shortestTime = timer.elapsedTime();
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                total += bsl::sprintf(buffer, "%.17g", DATA[i]);
+            }
+            timer.stop();
+            const double sprintfTime = timer.elapsedTime();
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                total += bsl::sprintf(buffer, "%.15g", DATA[i]);
+            }
+            timer.stop();
+            const double sprintf15Time = timer.elapsedTime();
+
+            cout << (set ? "arbitrary values: " : "prices:           ")
+                 << "formatShortest " << shortestTime << "s, "
+                 << "sprintf(%.17g) " << sprintfTime << "s, "
+                 << "sprintf(%.15g) " << sprintf15Time << "s"
+                 << " (" << total << " characters)" << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -28,6 +28,10 @@ BSLS_IDENT("$Id: $")
 // value, if the queue is full.  The 'tryPopFront' method fails immediately,
 // returning a non-zero value, if the queue is empty.
 //
+// The range methods 'pushBackRange', 'tryPushBackRange', 'popFrontRange', and
+// 'tryPopFrontRange' transfer a sequence of elements at once (see
+// {Range Operations}).
+//
 // The queue may be placed into a "enqueue disabled" state using the
 // 'disablePushBack' method.  When disabled, 'pushBack' and 'tryPushBack' fail
 // immediately and return an error code.  Any threads blocked in 'pushBack'
@@ -42,6 +46,35 @@ BSLS_IDENT("$Id: $")
 // 'popFront' immediately and return an error code.  The queue may be restored
 // to normal operation with the 'enablePopFront' method.
 //
+///Range Operations
+///----------------
+// The cost of a 'pushBack' or 'popFront' is dominated by the atomic operations
+// reserving a slot of the queue, publishing the element to the other side of
+// the queue, and, if needed, waking a blocked thread.  When elements are
+// produced or consumed in bulk, the range methods amortize this cost: each
+// chunk of a range is reserved from the queue's semaphore with a single atomic
+// operation, published with a single atomic operation, and wakes the threads
+// blocked on the other side of the queue once.
+//
+// 'pushBackRange' appends all of the supplied elements, blocking while the
+// queue is full; the elements are appended in chunks of up to the available
+// capacity, so elements pushed concurrently by other threads may be
+// interleaved between chunks.  'tryPushBackRange' appends as many of the
+// supplied elements as the queue can accept without blocking.  'popFrontRange'
+// blocks until the queue is not empty, then removes up to the requested number
+// of elements; 'tryPopFrontRange' does the same without blocking.  Every
+// element is pushed (or popped) at most once, and the range methods may be
+// used concurrently with any other method.
+//
+///Wait Strategy
+///-------------
+// By default, a thread calling 'pushBack' on a full queue, or 'popFront' on an
+// empty queue, blocks immediately.  A 'bslmt::WaitStrategy' may be supplied at
+// construction to have such a thread first spin, and then yield, while waiting
+// for the queue to change state, trading CPU time for a lower hand-off latency
+// (see 'bslmt_waitstrategy').  The strategy applies to both the producers and
+// the consumers of the queue.
+//
 ///Template Requirements
 ///---------------------
 // 'bdlcc::BoundedQueue' is a template that is parameterized on the type of
@@ -192,12 +225,15 @@ BSLS_IDENT("$Id: $")
 #include <bslmt_fastpostsemaphore.h>
 #include <bslmt_lockguard.h>
 #include <bslmt_mutex.h>
+#include <bslmt_waitstrategy.h>
 
 #include <bsls_assert.h>
 #include <bsls_atomicoperations.h>
 #include <bsls_objectbuffer.h>
 #include <bsls_types.h>
 
+#include <bsl_climits.h>
+#include <bsl_cstddef.h>
 #include <bsl_cstdint.h>
 
 namespace BloombergLP {
@@ -272,6 +308,101 @@ class BoundedQueue_PushExceptionCompleteProctor {
         // If no queue is currently managed, this method has no effect.
 };
 
+                 // ========================================
+                 // class BoundedQueue_PopRangeCompleteGuard
+                 // ========================================
+
+template <class TYPE>
+class BoundedQueue_PopRangeCompleteGuard {
+    // This class implements a guard that invokes 'TYPE::popRangeComplete',
+    // upon destruction, on the reserved nodes of a "pop range" operation that
+    // have not yet been processed.
+
+    // PRIVATE TYPES
+    typedef bsls::Types::Uint64 Uint64;
+
+    // DATA
+    TYPE   *d_queue_p;       // managed queue owning the managed nodes
+    Uint64  d_index;         // index of the next node to process
+    Uint64  d_endIndex;      // index following the last reserved node
+    Uint64  d_numNodes;      // number of reserved nodes
+    Uint64  d_numReclaimed;  // number of skipped nodes marked for reclamation
+    bool    d_isEmpty;       // if true, the empty condition will be signalled
+
+    // NOT IMPLEMENTED
+    BoundedQueue_PopRangeCompleteGuard();
+    BoundedQueue_PopRangeCompleteGuard(
+                                    const BoundedQueue_PopRangeCompleteGuard&);
+    BoundedQueue_PopRangeCompleteGuard& operator=(
+                                    const BoundedQueue_PopRangeCompleteGuard&);
+
+  public:
+    // CREATORS
+    BoundedQueue_PopRangeCompleteGuard(TYPE   *queue,
+                                       Uint64  index,
+                                       Uint64  numNodes,
+                                       bool    isEmpty);
+        // Create a 'popRangeComplete' guard managing the specified 'queue'
+        // and the specified 'numNodes' nodes starting at the specified
+        // 'index', that will cause the empty condition to be signalled if the
+        // specified 'isEmpty' is 'true'.
+
+    ~BoundedQueue_PopRangeCompleteGuard();
+        // Destroy this object and invoke the 'TYPE::popRangeComplete' method
+        // with the managed nodes that have not been processed.
+
+    // MANIPULATORS
+    void advance(bool isReclaimed);
+        // Mark the next managed node as processed; the node is counted as
+        // skipped if the specified 'isReclaimed' is 'true'.
+
+    // ACCESSORS
+    Uint64 endIndex() const;
+        // Return the index following the last managed node.
+
+    Uint64 index() const;
+        // Return the index of the next managed node to process.
+};
+
+                 // =========================================
+                 // class BoundedQueue_PushRangeCompleteGuard
+                 // =========================================
+
+template <class TYPE>
+class BoundedQueue_PushRangeCompleteGuard {
+    // This class implements a guard that invokes 'TYPE::pushRangeComplete'
+    // upon destruction, reporting the reserved nodes into which a value has
+    // been written as pushed, and the other reserved nodes as abandoned.
+
+    // PRIVATE TYPES
+    typedef bsls::Types::Uint64 Uint64;
+
+    // DATA
+    TYPE   *d_queue_p;      // managed queue
+    Uint64  d_numNodes;     // number of reserved nodes
+    Uint64  d_numWritten;   // number of nodes written
+
+    // NOT IMPLEMENTED
+    BoundedQueue_PushRangeCompleteGuard();
+    BoundedQueue_PushRangeCompleteGuard(
+                                   const BoundedQueue_PushRangeCompleteGuard&);
+    BoundedQueue_PushRangeCompleteGuard& operator=(
+                                   const BoundedQueue_PushRangeCompleteGuard&);
+
+  public:
+    // CREATORS
+    BoundedQueue_PushRangeCompleteGuard(TYPE *queue, Uint64 numNodes);
+        // Create a 'pushRangeComplete' guard managing the specified 'numNodes'
+        // reserved nodes of the specified 'queue'.
+
+    ~BoundedQueue_PushRangeCompleteGuard();
+        // Destroy this object and invoke the 'TYPE::pushRangeComplete' method.
+
+    // MANIPULATORS
+    void advance();
+        // Mark the next managed node as written.
+};
+
                          // ========================
                          // struct BoundedQueue_Node
                          // ========================
@@ -404,12 +535,35 @@ class BoundedQueue {
     friend class BoundedQueue_PushExceptionCompleteProctor<
                                                           BoundedQueue<TYPE> >;
 
+    friend class BoundedQueue_PopRangeCompleteGuard<BoundedQueue<TYPE> >;
+
+    friend class BoundedQueue_PushRangeCompleteGuard<BoundedQueue<TYPE> >;
+
     // PRIVATE CLASS METHODS
     static bool isQuiescentState(bsls::Types::Uint64 count);
         // Return 'true' if the specified 'count' implies a quiescent state
         // (see *Implementation* *Note*), and 'false' otherwise.
 
+    static int takeRange(int                      *numTaken,
+                         bslmt::FastPostSemaphore *semaphore,
+                         bsl::size_t               maxNumToTake,
+                         bool                      isTry);
+        // Reduce the count of the specified 'semaphore' by at least one and at
+        // most the specified 'maxNumToTake', and load the magnitude of the
+        // change into the specified 'numTaken'.  If the specified 'isTry' is
+        // 'false' and the count of 'semaphore' is not positive, block until it
+        // is.  Return 0 on success, and the non-zero value returned by
+        // 'semaphore' otherwise (specifically,
+        // 'bslmt::FastPostSemaphore::e_WOULD_BLOCK' if 'isTry' is 'true' and
+        // the count was not positive).  The behavior is undefined unless
+        // '0 < maxNumToTake'.
+
     // PRIVATE MANIPULATORS
+    void initialize();
+        // Initialize the counters of this queue, allocate and mark writable
+        // its 'd_capacity' nodes, and 'post' them to 'd_pushSemaphore'.  This
+        // method is invoked by the constructors.
+
     void popComplete(Node *node, bool isEmpty);
         // Destruct the value stored in the specified 'node', mark the 'node'
         // writable, and if the specified 'isEmpty' is 'true' then signal the
@@ -422,6 +576,38 @@ class BoundedQueue {
         // element into the specified 'value'.  This method is invoked by
         // 'popFront' and 'tryPopFront' once an element is available.
 
+    int popFrontRangeImp(bsl::size_t *numPopped,
+                         TYPE        *values,
+                         bsl::size_t  maxNumValues,
+                         bool         isTry);
+        // Implement 'popFrontRange' if the specified 'isTry' is 'false', and
+        // 'tryPopFrontRange' otherwise, with the specified 'numPopped',
+        // 'values', and 'maxNumValues'.
+
+    bsl::size_t popFrontRangeHelper(TYPE *values, bsl::size_t numValues);
+        // Remove up to the specified 'numValues' elements, already reserved
+        // from 'd_popSemaphore', from the front of this queue and load them,
+        // in order, into the array at the specified 'values'.  Return the
+        // number of elements removed.  Note that fewer than 'numValues'
+        // elements are removed, and the remainder of the reservation is
+        // returned to 'd_popSemaphore', only if nodes marked for reclamation
+        // are encountered.
+
+    void popRangeComplete(Uint64 index,
+                          Uint64 endIndex,
+                          Uint64 numNodes,
+                          Uint64 numReclaimed,
+                          bool   isEmpty);
+        // Destruct the values stored in the nodes from the specified 'index'
+        // to the specified 'endIndex' (excluded) that are not marked for
+        // reclamation, mark the specified 'numNodes' nodes of a "pop range"
+        // operation writable, return to 'd_popSemaphore' the reservations of
+        // the skipped nodes marked for reclamation, the number of which is the
+        // specified 'numReclaimed' plus the number found in the range, and, if
+        // no node was skipped and the specified 'isEmpty' is 'true', signal
+        // the queue empty condition.  This method is used by a guard within
+        // 'popFrontRangeHelper'.
+
     void pushComplete();
         // Mark a "push" operation as complete, and 'post' to the
         // 'd_popSemaphore' if appropriate.
@@ -432,6 +618,26 @@ class BoundedQueue {
         // 'pushFront' by a proctor to complete the marking of a node to
         // reclaim in the presence of an exception.
 
+    int pushBackRangeImp(bsl::size_t *numPushed,
+                         const TYPE  *values,
+                         bsl::size_t  numValues,
+                         bool         isTry);
+        // Implement 'pushBackRange' if the specified 'isTry' is 'false', and
+        // 'tryPushBackRange' otherwise, with the specified 'numPushed',
+        // 'values', and 'numValues'.
+
+    void pushBackRangeHelper(const TYPE *values, bsl::size_t numValues);
+        // Append the specified 'numValues' elements of the array at the
+        // specified 'values' to the back of this queue, in order, into nodes
+        // already reserved from 'd_pushSemaphore'.
+
+    void pushRangeComplete(Uint64 numPushed, Uint64 numAbandoned);
+        // Mark the specified 'numPushed' nodes of a "push range" operation as
+        // complete, remove the indicators for the specified 'numAbandoned'
+        // nodes that were reserved but not written, and 'post' to the
+        // 'd_popSemaphore' if appropriate.  This method is used by a guard
+        // within 'pushBackRangeHelper'.
+
     // NOT IMPLEMENTED
     BoundedQueue(const BoundedQueue&);
     BoundedQueue& operator=(const BoundedQueue&);
@@ -460,6 +666,15 @@ class BoundedQueue {
         // memory.  If 'basicAllocator' is 0, the currently installed default
         // allocator is used.
 
+    BoundedQueue(bsl::size_t                 capacity,
+                 const bslmt::WaitStrategy&  waitStrategy,
+                 bslma::Allocator           *basicAllocator = 0);
+        // Create a thread-aware queue with, at least, the specified 'capacity'
+        // whose threads wait, when the queue is full or empty, according to
+        // the specified 'waitStrategy' before blocking.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
     ~BoundedQueue();
         // Destroy this object.
 
@@ -492,6 +707,38 @@ class BoundedQueue {
         // due to the queue being full will return 'e_DISABLED' if
         // 'disablePushBack' is invoked.
 
+    int popFrontRange(bsl::size_t *numPopped,
+                      TYPE        *values,
+                      bsl::size_t  maxNumValues);
+        // Remove up to the specified 'maxNumValues' elements from the front of
+        // this queue, load them, in order, into the array at the specified
+        // 'values', and load the number of elements removed into the specified
+        // 'numPopped'.  If the queue is empty, block until it is not empty.
+        // Return 0 on success, and a non-zero value otherwise.  Specifically,
+        // return 'e_SUCCESS' on success (in which case '0 < *numPopped'),
+        // 'e_DISABLED' if 'isPopFrontDisabled()' and 'e_FAILED' if an error
+        // occurs.  On failure, '*numPopped' is 0 and 'values' is not changed.
+        // Threads blocked due to the queue being empty will return
+        // 'e_DISABLED' if 'disablePopFront' is invoked.  The behavior is
+        // undefined unless 'values' refers to an array of at least
+        // 'maxNumValues' elements and '0 < maxNumValues'.  See
+        // {Range Operations}.
+
+    int pushBackRange(bsl::size_t *numPushed,
+                      const TYPE  *values,
+                      bsl::size_t  numValues);
+        // Append the specified 'numValues' elements of the array at the
+        // specified 'values', in order, to the back of this queue, and load
+        // the number of elements appended into the specified 'numPushed'.  If
+        // the queue is full, block until it is not full.  Return 0 on success
+        // (in which case '*numPushed == numValues'), and a non-zero value
+        // otherwise.  Specifically, return 'e_SUCCESS' on success,
+        // 'e_DISABLED' if 'isPushBackDisabled()' and 'e_FAILED' if an error
+        // occurs.  On failure, the first '*numPushed' elements of 'values'
+        // have been appended.  Threads blocked due to the queue being full
+        // will return 'e_DISABLED' if 'disablePushBack' is invoked.  See
+        // {Range Operations}.
+
     void removeAll();
         // Remove all items currently in this queue.  Note that this operation
         // is not atomic; if other threads are concurrently pushing items into
@@ -507,6 +754,21 @@ class BoundedQueue {
         // '!isPopFrontDisabled()' and the queue was empty, and 'e_FAILED' if
         // an error occurs.  On failure, 'value' is not changed.
 
+    int tryPopFrontRange(bsl::size_t *numPopped,
+                         TYPE        *values,
+                         bsl::size_t  maxNumValues);
+        // Attempt to remove up to the specified 'maxNumValues' elements from
+        // the front of this queue without blocking, load them, in order, into
+        // the array at the specified 'values', and load the number of elements
+        // removed into the specified 'numPopped'.  Return 0 on success, and a
+        // non-zero value otherwise.  Specifically, return 'e_SUCCESS' on
+        // success (in which case '0 < *numPopped'), 'e_DISABLED' if
+        // 'isPopFrontDisabled()', 'e_EMPTY' if '!isPopFrontDisabled()' and the
+        // queue was empty, and 'e_FAILED' if an error occurs.  On failure,
+        // '*numPopped' is 0 and 'values' is not changed.  The behavior is
+        // undefined unless 'values' refers to an array of at least
+        // 'maxNumValues' elements and '0 < maxNumValues'.
+
     int tryPushBack(const TYPE& value);
         // Append the specified 'value' to the back of this queue.  Return 0 on
         // success, and a non-zero value otherwise.  Specifically, return
@@ -522,6 +784,19 @@ class BoundedQueue {
         // 'e_FULL' if '!isPushBackDisabled()' and the queue was full, and
         // 'e_FAILED' if an error occurs.  On failure, 'value' is not changed.
 
+    int tryPushBackRange(bsl::size_t *numPushed,
+                         const TYPE  *values,
+                         bsl::size_t  numValues);
+        // Append, without blocking, as many of the specified 'numValues'
+        // elements of the array at the specified 'values' as this queue can
+        // accept, in order, to the back of this queue, and load the number of
+        // elements appended into the specified 'numPushed'.  Return 0 on
+        // success, and a non-zero value otherwise.  Specifically, return
+        // 'e_SUCCESS' on success (in which case '0 < *numPushed' unless
+        // '0 == numValues'), 'e_DISABLED' if 'isPushBackDisabled()', 'e_FULL'
+        // if '!isPushBackDisabled()' and the queue was full, and 'e_FAILED' if
+        // an error occurs.  On failure, '*numPushed' is 0.
+
                        // Enqueue/Dequeue State
 
     void disablePopFront();
@@ -576,6 +851,9 @@ class BoundedQueue {
         // the queue to empty will return 'e_DISABLED' if 'disablePopFront' is
         // invoked.
 
+    const bslmt::WaitStrategy& waitStrategy() const;
+        // Return a 'const' reference to the wait strategy of this queue.
+
                                   // Aspects
 
     bslma::Allocator *allocator() const;
@@ -641,6 +919,96 @@ void BoundedQueue_PushExceptionCompleteProctor<TYPE>::release()
     d_queue_p = 0;
 }
 
+                 // ----------------------------------------
+                 // class BoundedQueue_PopRangeCompleteGuard
+                 // ----------------------------------------
+
+// CREATORS
+template <class TYPE>
+inline
+BoundedQueue_PopRangeCompleteGuard<TYPE>::BoundedQueue_PopRangeCompleteGuard(
+                                                           TYPE   *queue,
+                                                           Uint64  index,
+                                                           Uint64  numNodes,
+                                                           bool    isEmpty)
+: d_queue_p(queue)
+, d_index(index)
+, d_endIndex(index + numNodes)
+, d_numNodes(numNodes)
+, d_numReclaimed(0)
+, d_isEmpty(isEmpty)
+{
+}
+
+template <class TYPE>
+inline
+BoundedQueue_PopRangeCompleteGuard<TYPE>::~BoundedQueue_PopRangeCompleteGuard()
+{
+    d_queue_p->popRangeComplete(d_index,
+                                d_endIndex,
+                                d_numNodes,
+                                d_numReclaimed,
+                                d_isEmpty);
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+void BoundedQueue_PopRangeCompleteGuard<TYPE>::advance(bool isReclaimed)
+{
+    ++d_index;
+    if (isReclaimed) {
+        ++d_numReclaimed;
+    }
+}
+
+// ACCESSORS
+template <class TYPE>
+inline
+bsls::Types::Uint64 BoundedQueue_PopRangeCompleteGuard<TYPE>::endIndex() const
+{
+    return d_endIndex;
+}
+
+template <class TYPE>
+inline
+bsls::Types::Uint64 BoundedQueue_PopRangeCompleteGuard<TYPE>::index() const
+{
+    return d_index;
+}
+
+                 // -----------------------------------------
+                 // class BoundedQueue_PushRangeCompleteGuard
+                 // -----------------------------------------
+
+// CREATORS
+template <class TYPE>
+inline
+BoundedQueue_PushRangeCompleteGuard<TYPE>::BoundedQueue_PushRangeCompleteGuard(
+                                                             TYPE   *queue,
+                                                             Uint64  numNodes)
+: d_queue_p(queue)
+, d_numNodes(numNodes)
+, d_numWritten(0)
+{
+}
+
+template <class TYPE>
+inline
+BoundedQueue_PushRangeCompleteGuard<TYPE>::
+                                         ~BoundedQueue_PushRangeCompleteGuard()
+{
+    d_queue_p->pushRangeComplete(d_numWritten, d_numNodes - d_numWritten);
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+void BoundedQueue_PushRangeCompleteGuard<TYPE>::advance()
+{
+    ++d_numWritten;
+}
+
                          // ------------------------
                          // struct BoundedQueue_Node
                          // ------------------------
@@ -685,7 +1053,66 @@ bool BoundedQueue<TYPE>::isQuiescentState(bsls::Types::Uint64 count)
     return (count >> k_FINISHED_SHIFT) == (count & k_STARTED_MASK);
 }
 
+template <class TYPE>
+int BoundedQueue<TYPE>::takeRange(int                      *numTaken,
+                                  bslmt::FastPostSemaphore *semaphore,
+                                  bsl::size_t               maxNumToTake,
+                                  bool                      isTry)
+{
+    BSLS_ASSERT(0 < maxNumToTake);
+
+    const int maximum = maxNumToTake < static_cast<bsl::size_t>(INT_MAX)
+                        ? static_cast<int>(maxNumToTake)
+                        : INT_MAX;
+
+    // Note that 'take' ignores the disabled state of the semaphore, which is
+    // therefore checked first.
+
+    if (semaphore->isDisabled()) {
+        return bslmt::FastPostSemaphore::e_DISABLED;                  // RETURN
+    }
+
+    int count = semaphore->take(maximum);
+    if (0 == count) {
+        int rv = isTry ? bslmt::FastPostSemaphore::e_WOULD_BLOCK
+                       : semaphore->wait();
+        if (rv) {
+            return rv;                                                // RETURN
+        }
+
+        count = 1;
+        if (1 < maximum) {
+            count += semaphore->take(maximum - 1);
+        }
+    }
+
+    *numTaken = count;
+
+    return 0;
+}
+
 // PRIVATE MANIPULATORS
+template <class TYPE>
+void BoundedQueue<TYPE>::initialize()
+{
+    AtomicOp::initUint64(&d_pushCount, 0);
+    AtomicOp::initUint64(&d_pushIndex, 0);
+    AtomicOp::initUint64(&d_popCount,  0);
+    AtomicOp::initUint64(&d_popIndex,  0);
+
+    AtomicOp::initUint(&d_emptyCount,      0);
+    AtomicOp::initUint(&d_emptyGeneration, 0);
+
+    d_element_p = static_cast<Node *>(
+                           d_allocator_p->allocate(d_capacity * sizeof(Node)));
+
+    for (bsl::size_t i = 0; i < d_capacity; ++i) {
+        d_element_p[i].assignReclaim(false);
+    }
+
+    d_pushSemaphore.post(static_cast<int>(d_capacity));
+}
+
 template <class TYPE>
 void BoundedQueue<TYPE>::popComplete(Node *node, bool isEmpty)
 {
@@ -753,6 +1180,135 @@ void BoundedQueue<TYPE>::popFrontHelper(TYPE *value)
 #endif
 }
 
+template <class TYPE>
+int BoundedQueue<TYPE>::popFrontRangeImp(bsl::size_t *numPopped,
+                                         TYPE        *values,
+                                         bsl::size_t  maxNumValues,
+                                         bool         isTry)
+{
+    BSLS_ASSERT(numPopped);
+    BSLS_ASSERT(values);
+    BSLS_ASSERT(0 < maxNumValues);
+
+    *numPopped = 0;
+
+    do {
+        int count;
+        int rv = takeRange(&count, &d_popSemaphore, maxNumValues, isTry);
+        if (rv) {
+            if (bslmt::FastPostSemaphore::e_DISABLED == rv) {
+                return e_DISABLED;                                    // RETURN
+            }
+            if (bslmt::FastPostSemaphore::e_WOULD_BLOCK == rv) {
+                return e_EMPTY;                                       // RETURN
+            }
+            return e_FAILED;                                          // RETURN
+        }
+
+        // Note that no element is removed only if all the reserved nodes were
+        // marked for reclamation, in which case the reservation was returned.
+
+        *numPopped = popFrontRangeHelper(values, count);
+    } while (0 == *numPopped);
+
+    return e_SUCCESS;
+}
+
+template <class TYPE>
+bsl::size_t BoundedQueue<TYPE>::popFrontRangeHelper(TYPE        *values,
+                                                    bsl::size_t  numValues)
+{
+    bool empty = isEmpty();
+
+    AtomicOp::addUint64AcqRel(&d_popCount, k_STARTED_INC * numValues);
+
+    // 'd_popIndex' stores the next location to use (want the original value)
+
+    Uint64 index = AtomicOp::addUint64NvAcqRel(&d_popIndex, numValues)
+                                                                   - numValues;
+
+    // Nodes marked for reclamation are not counted in 'd_popSemaphore' and are
+    // skipped; instead of reserving further nodes in their place (as done by
+    // 'popFrontHelper'), the guard returns their reservation to
+    // 'd_popSemaphore'.
+
+    BoundedQueue_PopRangeCompleteGuard<BoundedQueue<TYPE> > guard(this,
+                                                                  index,
+                                                                  numValues,
+                                                                  empty);
+
+    bsl::size_t numPopped = 0;
+
+    while (guard.index() != guard.endIndex()) {
+        Node& node = d_element_p[guard.index() % d_capacity];
+
+        if (node.reclaim()) {
+            guard.advance(true);
+            continue;                                               // CONTINUE
+        }
+
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+        values[numPopped] = bslmf::MovableRefUtil::move(node.d_value.object());
+#else
+        values[numPopped] = node.d_value.object();
+#endif
+        ++numPopped;
+
+        node.d_value.object().~TYPE();
+        guard.advance(false);
+    }
+
+    return numPopped;
+}
+
+template <class TYPE>
+void BoundedQueue<TYPE>::popRangeComplete(Uint64 index,
+                                          Uint64 endIndex,
+                                          Uint64 numNodes,
+                                          Uint64 numReclaimed,
+                                          bool   isEmpty)
+{
+    // Values not yet moved (due to an exception) are discarded.
+
+    for (; index != endIndex; ++index) {
+        Node& node = d_element_p[index % d_capacity];
+        if (node.reclaim()) {
+            ++numReclaimed;
+        }
+        else {
+            node.d_value.object().~TYPE();
+        }
+    }
+
+    Uint64 count = AtomicOp::addUint64NvAcqRel(&d_popCount,
+                                               k_FINISHED_INC * numNodes);
+    if (isQuiescentState(count)) {
+
+        // The total number of popped elements is 'count & k_STARTED_MASK'.
+        // Attempt, once, to zero the count and, if successful, post to the
+        // push semaphore.
+
+        if (AtomicOp::testAndSwapUint64AcqRel(&d_popCount,
+                                              count,
+                                              0) == count) {
+            d_pushSemaphore.post(static_cast<int>(count & k_STARTED_MASK));
+        }
+    }
+
+    if (numReclaimed) {
+        d_popSemaphore.post(static_cast<int>(numReclaimed));
+    }
+    else if (isEmpty) {
+        AtomicOp::addUintAcqRel(&d_emptyGeneration, 1);
+        if (0 < AtomicOp::getUintAcquire(&d_emptyCount)) {
+            {
+                bslmt::LockGuard<bslmt::Mutex> guard(&d_emptyMutex);
+            }
+            d_emptyCondition.broadcast();
+        }
+    }
+}
+
 template <class TYPE>
 void BoundedQueue<TYPE>::pushComplete()
 {
@@ -792,6 +1348,103 @@ void BoundedQueue<TYPE>::pushExceptionComplete()
     }
 }
 
+template <class TYPE>
+int BoundedQueue<TYPE>::pushBackRangeImp(bsl::size_t *numPushed,
+                                         const TYPE  *values,
+                                         bsl::size_t  numValues,
+                                         bool         isTry)
+{
+    BSLS_ASSERT(numPushed);
+    BSLS_ASSERT(values || 0 == numValues);
+
+    *numPushed = 0;
+
+    while (*numPushed < numValues) {
+        int count;
+        int rv = takeRange(&count,
+                           &d_pushSemaphore,
+                           numValues - *numPushed,
+                           isTry);
+        if (rv) {
+            if (isTry && 0 < *numPushed) {
+                break;
+            }
+            if (bslmt::FastPostSemaphore::e_DISABLED == rv) {
+                return e_DISABLED;                                    // RETURN
+            }
+            if (bslmt::FastPostSemaphore::e_WOULD_BLOCK == rv) {
+                return e_FULL;                                        // RETURN
+            }
+            return e_FAILED;                                          // RETURN
+        }
+
+        pushBackRangeHelper(values + *numPushed, count);
+
+        *numPushed += count;
+    }
+
+    return e_SUCCESS;
+}
+
+template <class TYPE>
+void BoundedQueue<TYPE>::pushBackRangeHelper(const TYPE  *values,
+                                             bsl::size_t  numValues)
+{
+    AtomicOp::addUint64AcqRel(&d_pushCount, k_STARTED_INC * numValues);
+
+    // 'd_pushIndex' stores the next location to use (want the original value)
+
+    const Uint64 index = AtomicOp::addUint64NvAcqRel(&d_pushIndex, numValues)
+                                                                   - numValues;
+
+    // All the reserved nodes are marked for reclamation until written, so
+    // that the nodes remaining after an exception are skipped by "pop"
+    // operations.
+
+    for (bsl::size_t i = 0; i < numValues; ++i) {
+        d_element_p[(index + i) % d_capacity].assignReclaim(true);
+    }
+
+    BoundedQueue_PushRangeCompleteGuard<BoundedQueue<TYPE> > guard(this,
+                                                                   numValues);
+
+    for (bsl::size_t i = 0; i < numValues; ++i) {
+        Node& node = d_element_p[(index + i) % d_capacity];
+
+        bslalg::ScalarPrimitives::copyConstruct(node.d_value.address(),
+                                                values[i],
+                                                d_allocator_p);
+
+        node.assignReclaim(false);
+        guard.advance();
+    }
+}
+
+template <class TYPE>
+void BoundedQueue<TYPE>::pushRangeComplete(Uint64 numPushed,
+                                           Uint64 numAbandoned)
+{
+    Uint64 count = AtomicOp::addUint64NvAcqRel(
+                                               &d_pushCount,
+                                                 k_FINISHED_INC * numPushed
+                                               - k_STARTED_INC * numAbandoned);
+
+    int numToPost = static_cast<int>(count & k_STARTED_MASK);
+
+    if (0 != numToPost && isQuiescentState(count)) {
+
+        // The total number of pushed elements is 'count & k_STARTED_MASK'.
+        // Attempt, once, to zero the count and, if successful, post to the pop
+        // semaphore.
+
+        if (AtomicOp::testAndSwapUint64AcqRel(&d_pushCount,
+                                               count,
+                                               0) == count) {
+            d_popSemaphore.post(numToPost);
+        }
+    }
+}
+
 // CREATORS
 template <class TYPE>
 BoundedQueue<TYPE>::BoundedQueue(bsl::size_t       capacity,
@@ -804,22 +1457,22 @@ BoundedQueue<TYPE>::BoundedQueue(bsl::size_t       capacity,
 , d_emptyCondition()
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
-    AtomicOp::initUint64(&d_pushCount, 0);
-    AtomicOp::initUint64(&d_pushIndex, 0);
-    AtomicOp::initUint64(&d_popCount,  0);
-    AtomicOp::initUint64(&d_popIndex,  0);
-
-    AtomicOp::initUint(&d_emptyCount,      0);
-    AtomicOp::initUint(&d_emptyGeneration, 0);
-
-    d_element_p = static_cast<Node *>(
-                           d_allocator_p->allocate(d_capacity * sizeof(Node)));
-
-    for (bsl::size_t i = 0; i < d_capacity; ++i) {
-        d_element_p[i].assignReclaim(false);
-    }
+    initialize();
+}
 
-    d_pushSemaphore.post(static_cast<int>(d_capacity));
+template <class TYPE>
+BoundedQueue<TYPE>::BoundedQueue(bsl::size_t                 capacity,
+                                 const bslmt::WaitStrategy&  waitStrategy,
+                                 bslma::Allocator           *basicAllocator)
+: d_pushSemaphore(waitStrategy)
+, d_popSemaphore(waitStrategy)
+, d_element_p(0)
+, d_capacity(capacity > 2 ? capacity : 2)
+, d_emptyMutex()
+, d_emptyCondition()
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    initialize();
 }
 
 template <class TYPE>
@@ -922,6 +1575,24 @@ int BoundedQueue<TYPE>::pushBack(bslmf::MovableRef<TYPE> value)
     return e_SUCCESS;
 }
 
+template <class TYPE>
+inline
+int BoundedQueue<TYPE>::popFrontRange(bsl::size_t *numPopped,
+                                      TYPE        *values,
+                                      bsl::size_t  maxNumValues)
+{
+    return popFrontRangeImp(numPopped, values, maxNumValues, false);
+}
+
+template <class TYPE>
+inline
+int BoundedQueue<TYPE>::pushBackRange(bsl::size_t *numPushed,
+                                      const TYPE  *values,
+                                      bsl::size_t  numValues)
+{
+    return pushBackRangeImp(numPushed, values, numValues, false);
+}
+
 template <class TYPE>
 void BoundedQueue<TYPE>::removeAll()
 {
@@ -980,6 +1651,15 @@ int BoundedQueue<TYPE>::tryPopFront(TYPE *value)
     return e_SUCCESS;
 }
 
+template <class TYPE>
+inline
+int BoundedQueue<TYPE>::tryPopFrontRange(bsl::size_t *numPopped,
+                                         TYPE        *values,
+                                         bsl::size_t  maxNumValues)
+{
+    return popFrontRangeImp(numPopped, values, maxNumValues, true);
+}
+
 template <class TYPE>
 int BoundedQueue<TYPE>::tryPushBack(const TYPE& value)
 {
@@ -1059,6 +1739,15 @@ int BoundedQueue<TYPE>::tryPushBack(bslmf::MovableRef<TYPE> value)
     return e_SUCCESS;
 }
 
+template <class TYPE>
+inline
+int BoundedQueue<TYPE>::tryPushBackRange(bsl::size_t *numPushed,
+                                         const TYPE  *values,
+                                         bsl::size_t  numValues)
+{
+    return pushBackRangeImp(numPushed, values, numValues, true);
+}
+
                        // Enqueue/Dequeue State
 
 template <class TYPE>
@@ -1164,6 +1853,12 @@ int BoundedQueue<TYPE>::waitUntilEmpty() const
     return e_SUCCESS;
 }
 
+template <class TYPE>
+const bslmt::WaitStrategy& BoundedQueue<TYPE>::waitStrategy() const
+{
+    return d_popSemaphore.waitStrategy();
+}
+
                                   // Aspects
 
 template <class TYPE>
@@ -17,18 +17,22 @@
 #include <bslmt_mutex.h>
 #include <bslmt_threadgroup.h>
 #include <bslmt_threadutil.h>
+#include <bslmt_waitstrategy.h>
 
 #include <bsls_assert.h>
 #include <bsls_asserttest.h>
 #include <bsls_atomic.h>
 #include <bsls_atomicoperations.h>
+#include <bsls_stopwatch.h>
 #include <bsls_systemtime.h>
 #include <bsls_timeinterval.h>
+#include <bsls_timeutil.h>
 #include <bsls_types.h>
 
 #include <bsltf_moveonlyalloctesttype.h>
 #include <bsltf_movablealloctesttype.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_cstring.h>
 #include <bsl_cstdlib.h>
 #include <bsl_iostream.h>
@@ -77,14 +81,19 @@ using namespace bsl;
 //: o ACCESSOR methods are 'const' thread-safe.
 // ----------------------------------------------------------------------------
 // [ 2] BoundedQueue(bsl::size_t capacity, bslma::Allocator bA = 0);
+// [14] BoundedQueue(size_t capacity, const WaitStrategy&, Allocator *bA);
 // [ 2] ~BoundedQueue();
 // [ 2] int popFront(TYPE *value);
+// [13] int popFrontRange(size_t *num, TYPE *values, size_t max);
 // [ 2] int pushBack(const TYPE& value);
 // [ 9] int pushBack(bslmf::MovableRef<TYPE> value);
+// [13] int pushBackRange(size_t *num, const TYPE *values, size_t n);
 // [ 2] void removeAll();
 // [ 7] int tryPopFront(TYPE *value);
+// [13] int tryPopFrontRange(size_t *num, TYPE *values, size_t max);
 // [ 6] int tryPushBack(const TYPE& value);
 // [ 9] int tryPushBack(bslmf::MovableRef<TYPE> value);
+// [13] int tryPushBackRange(size_t *num, const TYPE *values, size_t n);
 // [ 5] void disablePopFront();
 // [ 5] void disablePushBack();
 // [ 5] void enablePopFront();
@@ -95,10 +104,13 @@ using namespace bsl;
 // [ 5] bool isPushBackDisabled() const;
 // [ 4] bsl::size_t numElements() const;
 // [ 8] int waitUntilEmpty() const;
+// [14] const bslmt::WaitStrategy& waitStrategy() const;
 // [ 4] bslma::Allocator *allocator() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [13] USAGE EXAMPLE
+// [15] USAGE EXAMPLE
+// [-1] PERFORMANCE: RANGE OPERATIONS
+// [-2] PERFORMANCE: WAIT STRATEGY LATENCY
 // [ 3] Obj& gg(Obj *object, const char *spec);
 // [ 3] int ggg(Obj *object, const char *spec);
 // [ 2] CONCERN: 0 == e_SUCCESS
@@ -751,6 +763,189 @@ extern "C" void *pushWaitDisable(void *arg)
     return 0;
 }
 
+                         // =====================
+                         // RANGE OPERATION TESTS
+                         // =====================
+
+namespace RANGE_TEST {
+
+struct RangeProducer {
+    // This 'struct' defines a functor that pushes the integers
+    // '[d_first .. d_first + d_numValues)' onto a queue, in ranges of
+    // 'd_rangeSize' elements.
+
+    // DATA
+    Obj *d_obj_p;
+    int  d_first;
+    int  d_numValues;
+    int  d_rangeSize;
+
+    // ACCESSORS
+    void operator()() const
+        // Push the values.
+    {
+        bsl::vector<int> values(d_rangeSize);
+
+        for (int i = 0; i < d_numValues; i += d_rangeSize) {
+            const int count = bsl::min(d_rangeSize, d_numValues - i);
+            for (int j = 0; j < count; ++j) {
+                values[j] = d_first + i + j;
+            }
+
+            bsl::size_t numPushed = 0;
+            ASSERT(0 == d_obj_p->pushBackRange(&numPushed,
+                                               values.data(),
+                                               count));
+            ASSERT(static_cast<bsl::size_t>(count) == numPushed);
+        }
+    }
+};
+
+struct RangeConsumer {
+    // This 'struct' defines a functor that pops values from a queue, in
+    // ranges of up to 'd_rangeSize' elements, and appends them to
+    // '*d_result_p', until the queue is disabled for popping.
+
+    // DATA
+    Obj              *d_obj_p;
+    int               d_rangeSize;
+    bsl::vector<int> *d_result_p;
+
+    // ACCESSORS
+    void operator()() const
+        // Pop the values.
+    {
+        bsl::vector<int> values(d_rangeSize);
+
+        bsl::size_t numPopped = 0;
+        while (0 == d_obj_p->popFrontRange(&numPopped,
+                                           values.data(),
+                                           d_rangeSize)) {
+            ASSERT(0 < numPopped);
+            ASSERT(numPopped <= static_cast<bsl::size_t>(d_rangeSize));
+
+            d_result_p->insert(d_result_p->end(),
+                               values.begin(),
+                               values.begin() + numPopped);
+        }
+    }
+};
+
+struct PerElementProducer {
+    // This 'struct' defines a functor that pushes 'd_numValues' integers onto
+    // a queue, one at a time.
+
+    // DATA
+    Obj *d_obj_p;
+    int  d_numValues;
+
+    // CREATORS
+    PerElementProducer(Obj *obj, int numValues)
+        // Create a producer pushing the specified 'numValues' onto the
+        // specified 'obj'.
+    : d_obj_p(obj)
+    , d_numValues(numValues)
+    {
+    }
+
+    // ACCESSORS
+    void operator()() const
+        // Push the values.
+    {
+        for (int i = 0; i < d_numValues; ++i) {
+            d_obj_p->pushBack(i);
+        }
+    }
+};
+
+}  // close namespace RANGE_TEST
+
+                          // ===================
+                          // WAIT STRATEGY TESTS
+                          // ===================
+
+namespace WAIT_STRATEGY_TEST {
+
+struct Echo {
+    // This 'struct' defines a functor that pops 'd_numRoundTrips' values from
+    // '*d_ping_p' and pushes each of them back onto '*d_pong_p'.
+
+    // DATA
+    Obj *d_ping_p;
+    Obj *d_pong_p;
+    int  d_numRoundTrips;
+
+    // ACCESSORS
+    void operator()() const
+        // Echo the values.
+    {
+        for (int i = 0; i < d_numRoundTrips; ++i) {
+            int value = -1;
+            ASSERT(0 == d_ping_p->popFront(&value));
+            ASSERT(0 == d_pong_p->pushBack(value));
+        }
+    }
+};
+
+void pingPong(bsl::vector<bsls::Types::Int64> *latencies,
+              Obj                             *ping,
+              Obj                             *pong,
+              int                              numRoundTrips)
+    // Push 'numRoundTrips' values onto the specified 'ping' queue, one at a
+    // time, each time waiting for the value to be echoed on the specified
+    // 'pong' queue by an 'Echo' functor running in another thread, and verify
+    // the echoed value.  If the specified 'latencies' is not 0, append to it
+    // the duration, in nanoseconds, of each round trip.
+{
+    for (int i = 0; i < numRoundTrips; ++i) {
+        const bsls::Types::Int64 start = bsls::TimeUtil::getTimer();
+
+        int value = -1;
+        ASSERT(0 == ping->pushBack(i));
+        ASSERT(0 == pong->popFront(&value));
+
+        if (latencies) {
+            latencies->push_back(bsls::TimeUtil::getTimer() - start);
+        }
+
+        ASSERTV(i, value, i == value);
+    }
+}
+
+void printPercentiles(const char                      *label,
+                      bsl::vector<bsls::Types::Int64> *latencies)
+    // Print, on a line beginning with the specified 'label', the 50th, 90th,
+    // 99th, and 99.9th percentiles of the specified 'latencies'.  Note that
+    // 'latencies' is sorted.
+{
+    ASSERT(!latencies->empty());
+
+    bsl::sort(latencies->begin(), latencies->end());
+
+    const bsl::size_t n = latencies->size();
+
+    cout << label
+         << "\tp50 "   << (*latencies)[n *  50 / 100]
+         << "\tp90 "   << (*latencies)[n *  90 / 100]
+         << "\tp99 "   << (*latencies)[n *  99 / 100]
+         << "\tp99.9 " << (*latencies)[n * 999 / 1000]
+         << " ns" << endl;
+}
+
+extern "C" void *popExpectDisabled(void *arg)
+    // Pop from the queue addressed by the specified 'arg', which is empty, and
+    // verify that the pop fails because the queue is dequeue disabled.
+{
+    Obj& mX = *static_cast<Obj *>(arg);
+
+    int value = 0;
+    ASSERT(Obj::e_DISABLED == mX.popFront(&value));
+
+    return 0;
+}
+
+}  // close namespace WAIT_STRATEGY_TEST
+
 // ============================================================================
 //               GENERATOR FUNCTIONS 'gg' AND 'ggg' FOR TESTING
 // ----------------------------------------------------------------------------
@@ -971,7 +1166,7 @@ int main(int argc, char *argv[])
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 13: {
+      case 15: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -1009,6 +1204,405 @@ int main(int argc, char *argv[])
 
         bslmt::ThreadUtil::join(watchdogHandle);
       } break;
+      case 14: {
+        // --------------------------------------------------------------------
+        // TESTING WAIT STRATEGY
+        //
+        // Concerns:
+        //: 1 The constructor taking a wait strategy creates an empty queue,
+        //:   having at least the specified capacity, using the specified
+        //:   allocator, and 'waitStrategy' returns the strategy supplied at
+        //:   construction.
+        //:
+        //: 2 A queue created without a wait strategy parks immediately.
+        //:
+        //: 3 Values are transferred correctly between a producer and a
+        //:   consumer whichever the strategy.
+        //:
+        //: 4 A thread spinning in 'popFront' returns 'e_DISABLED' when the
+        //:   queue is dequeue disabled.
+        //
+        // Plan:
+        //: 1 Create queues with and without a strategy, and verify the
+        //:   accessors.  (C-1..2)
+        //:
+        //: 2 For a set of strategies, bounce values between two threads
+        //:   through two queues and verify the values.  (C-3)
+        //:
+        //: 3 Have a thread pop from an empty queue whose strategy spins
+        //:   (practically) forever, disable the queue, and verify the pop
+        //:   fails.  (C-4)
+        //
+        // Testing:
+        //   BoundedQueue(size_t capacity, const WaitStrategy&, Allocator *bA);
+        //   const bslmt::WaitStrategy& waitStrategy() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING WAIT STRATEGY" << endl
+                          << "=====================" << endl;
+
+        using namespace WAIT_STRATEGY_TEST;
+
+        typedef bslmt::WaitStrategy WS;
+
+        if (verbose) cout << "\nTesting the creators and accessor." << endl;
+        {
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            Obj mX(4, &sa);  const Obj& X = mX;
+
+            ASSERT(WS() == X.waitStrategy());
+
+            const WS STRATEGY(100, 2, true);
+
+            Obj mY(4, STRATEGY, &sa);  const Obj& Y = mY;
+
+            ASSERT(STRATEGY == Y.waitStrategy());
+            ASSERT(&sa      == Y.allocator());
+            ASSERT(Y.isEmpty());
+            ASSERT(0        <  sa.numBlocksInUse());
+
+            for (int i = 0; i < 4; ++i) {
+                ASSERT(0 == mY.tryPushBack(i));
+            }
+            ASSERT(Y.isFull());
+
+            int value = -1;
+            ASSERT(0 == mY.popFront(&value));
+            ASSERT(0 == value);
+        }
+
+        if (verbose) cout << "\nTesting transfers between threads." << endl;
+        {
+            // Note that the spin counts are kept small, as the test may run
+            // on a single CPU, on which a spinning thread merely delays the
+            // thread it waits for.
+
+            const WS STRATEGIES[] = { WS(),
+                                      WS(1000, 0),
+                                      WS(0, 4),
+                                      WS(1000, 4, true),
+                                      WS(4000, 0, true) };
+            const int NUM_STRATEGIES = static_cast<int>(
+                                   sizeof STRATEGIES / sizeof *STRATEGIES);
+
+            enum { k_NUM_ROUND_TRIPS = 500 };
+
+            for (int ti = 0; ti < NUM_STRATEGIES; ++ti) {
+                const WS& STRATEGY = STRATEGIES[ti];
+
+                if (veryVerbose) {
+                    T_ P_(STRATEGY.spinCount()) P_(STRATEGY.yieldCount())
+                                                    P(STRATEGY.isAdaptive())
+                }
+
+                Obj ping(2, STRATEGY);
+                Obj pong(2, STRATEGY);
+
+                bslmt::ThreadGroup threads;
+                Echo echo = { &ping, &pong, k_NUM_ROUND_TRIPS };
+                threads.addThread(echo);
+
+                pingPong(0, &ping, &pong, k_NUM_ROUND_TRIPS);
+
+                threads.joinAll();
+
+                ASSERTV(ti, ping.isEmpty());
+                ASSERTV(ti, pong.isEmpty());
+            }
+        }
+
+        if (verbose) cout << "\nTesting disabling while spinning." << endl;
+        {
+            Obj mX(2, WS(1 << 30, 0));
+
+            bslmt::ThreadUtil::Handle handle;
+            bslmt::ThreadUtil::create(&handle, popExpectDisabled, &mX);
+
+            bslmt::ThreadUtil::microSleep(10000);
+
+            mX.disablePopFront();
+
+            bslmt::ThreadUtil::join(handle);
+        }
+      } break;
+      case 13: {
+        // --------------------------------------------------------------------
+        // TESTING RANGE OPERATIONS
+        //
+        // Concerns:
+        //: 1 'pushBackRange' appends all the values, in order.
+        //:
+        //: 2 'tryPushBackRange' appends as many values as fit, and returns
+        //:   'e_FULL' if none fits.
+        //:
+        //: 3 'popFrontRange' and 'tryPopFrontRange' remove up to the
+        //:   requested number of values, in order, and 'tryPopFrontRange'
+        //:   returns 'e_EMPTY' if the queue is empty.
+        //:
+        //: 4 The range methods return 'e_DISABLED' when the queue is
+        //:   disabled, and a blocked 'popFrontRange' returns when the queue
+        //:   is disabled.
+        //:
+        //: 5 An exception thrown while copying a value into the queue leaves
+        //:   the queue consistent: no value is lost or duplicated among
+        //:   those reported as pushed, and nodes left unwritten are skipped.
+        //:
+        //: 6 Concurrent range operations deliver each value exactly once.
+        //
+        // Plan:
+        //: 1 Exercise the range methods on a queue of 'int' in a single
+        //:   thread, verifying return values, counts, and values.  (C-1..4)
+        //:
+        //: 2 Using a queue of 'bsl::string' supplied with a test allocator,
+        //:   push a range of values within the
+        //:   'BSLMA_TESTALLOCATOR_EXCEPTION_TEST_*' macros, and verify that
+        //:   the values then popped with 'tryPopFrontRange' end with the
+        //:   complete range, and are otherwise prefixes of it.  (C-5)
+        //:
+        //: 3 Create several threads pushing disjoint sequences of values with
+        //:   'pushBackRange', and several threads popping with
+        //:   'popFrontRange'; verify that the union of the popped values is
+        //:   the union of the pushed values.  (C-6)
+        //
+        // Testing:
+        //   int popFrontRange(size_t *num, TYPE *values, size_t max);
+        //   int pushBackRange(size_t *num, const TYPE *values, size_t n);
+        //   int tryPopFrontRange(size_t *num, TYPE *values, size_t max);
+        //   int tryPushBackRange(size_t *num, const TYPE *values, size_t n);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING RANGE OPERATIONS" << endl
+                          << "========================" << endl;
+
+        if (verbose) cout << "\nSingle-threaded operations." << endl;
+        {
+            Obj mX(8);  const Obj& X = mX;
+
+            const int VALUES[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 };
+
+            bsl::size_t numPushed = 99;
+            ASSERT(e_SUCCESS == mX.pushBackRange(&numPushed, VALUES, 0));
+            ASSERT(0         == numPushed);
+
+            ASSERT(e_SUCCESS == mX.pushBackRange(&numPushed, VALUES, 5));
+            ASSERT(5         == numPushed);
+            ASSERT(5         == X.numElements());
+
+            ASSERT(e_SUCCESS == mX.tryPushBackRange(&numPushed,
+                                                    VALUES + 5,
+                                                    7));
+            ASSERT(3         == numPushed);
+            ASSERT(8         == X.numElements());
+            ASSERT(X.isFull());
+
+            ASSERT(e_FULL    == mX.tryPushBackRange(&numPushed,
+                                                    VALUES + 8,
+                                                    4));
+            ASSERT(0         == numPushed);
+
+            int         values[16];
+            bsl::size_t numPopped = 99;
+
+            ASSERT(e_SUCCESS == mX.popFrontRange(&numPopped, values, 3));
+            ASSERT(3         == numPopped);
+            for (int i = 0; i < 3; ++i) {
+                ASSERTV(i, values[i], i == values[i]);
+            }
+
+            ASSERT(e_SUCCESS == mX.tryPopFrontRange(&numPopped, values, 16));
+            ASSERT(5         == numPopped);
+            for (int i = 0; i < 5; ++i) {
+                ASSERTV(i, values[i], i + 3 == values[i]);
+            }
+            ASSERT(X.isEmpty());
+
+            ASSERT(e_EMPTY   == mX.tryPopFrontRange(&numPopped, values, 16));
+            ASSERT(0         == numPopped);
+
+            // A range larger than the capacity is pushed in several chunks.
+
+            bslmt::ThreadGroup consumer;
+            bsl::vector<int>   result;
+            RANGE_TEST::RangeConsumer consumerFunctor = { &mX, 5, &result };
+            consumer.addThread(consumerFunctor);
+
+            ASSERT(e_SUCCESS == mX.pushBackRange(&numPushed, VALUES, 12));
+            ASSERT(12        == numPushed);
+
+            ASSERT(e_SUCCESS == X.waitUntilEmpty());
+
+            mX.disablePopFront();
+            consumer.joinAll();
+
+            ASSERT(12 == result.size());
+            for (int i = 0; i < static_cast<int>(result.size()); ++i) {
+                ASSERTV(i, result[i], i == result[i]);
+            }
+
+            ASSERT(e_DISABLED == mX.popFrontRange(&numPopped, values, 16));
+            ASSERT(0          == numPopped);
+            ASSERT(e_DISABLED == mX.tryPopFrontRange(&numPopped, values, 16));
+            ASSERT(0          == numPopped);
+
+            mX.disablePushBack();
+
+            ASSERT(e_DISABLED == mX.pushBackRange(&numPushed, VALUES, 3));
+            ASSERT(0          == numPushed);
+            ASSERT(e_DISABLED == mX.tryPushBackRange(&numPushed, VALUES, 3));
+            ASSERT(0          == numPushed);
+        }
+
+        if (verbose) cout << "\nException safety." << endl;
+        {
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            // Note that the nodes reserved by a failed attempt are reclaimed
+            // only when skipped by a "pop" operation, so the capacity
+            // accommodates all the attempts.
+
+            AllocObj mX(64, &sa);
+
+            const char *DATA[] = {
+                "a string long enough to allocate memory: 0",
+                "a string long enough to allocate memory: 1",
+                "a string long enough to allocate memory: 2",
+                "a string long enough to allocate memory: 3",
+                "a string long enough to allocate memory: 4"
+            };
+            enum { k_NUM_DATA = sizeof DATA / sizeof *DATA };
+
+            bsl::vector<bsl::string> values(&sa);
+            for (int i = 0; i < k_NUM_DATA; ++i) {
+                values.push_back(DATA[i]);
+            }
+
+            int numAttempts = 0;
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(sa) {
+                ++numAttempts;
+
+                bsl::size_t numPushed = 0;
+                ASSERT(0 == mX.pushBackRange(&numPushed,
+                                             values.data(),
+                                             k_NUM_DATA));
+                ASSERT(k_NUM_DATA == numPushed);
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            if (veryVerbose) { T_ P(numAttempts) }
+
+            ASSERTV(numAttempts, numAttempts * k_NUM_DATA <= 64);
+
+            bsl::vector<bsl::string> result(&sa);
+            {
+                bsl::string buffer[3] = { bsl::string(&sa),
+                                          bsl::string(&sa),
+                                          bsl::string(&sa) };
+                bsl::size_t numPopped;
+                while (0 == mX.tryPopFrontRange(&numPopped, buffer, 3)) {
+                    result.insert(result.end(), buffer, buffer + numPopped);
+                }
+            }
+
+            ASSERTV(result.size(), k_NUM_DATA <= result.size());
+
+            const bsl::size_t OFFSET = result.size() - k_NUM_DATA;
+            for (bsl::size_t i = 0; i < k_NUM_DATA; ++i) {
+                ASSERTV(i,
+                        result[OFFSET + i],
+                        values[i] == result[OFFSET + i]);
+            }
+
+            // The values of the failed attempts are prefixes of 'values'.
+
+            bsl::size_t expected = 0;
+            for (bsl::size_t i = 0; i < OFFSET; ++i) {
+                if (values[0] == result[i]) {
+                    expected = 0;
+                }
+                ASSERTV(i, expected < k_NUM_DATA);
+                if (expected < k_NUM_DATA) {
+                    ASSERTV(i, result[i], values[expected] == result[i]);
+                }
+                ++expected;
+            }
+
+            ASSERT(mX.isEmpty());
+        }
+
+        if (verbose) cout << "\nConcurrent operations." << endl;
+        {
+            enum {
+                k_NUM_PRODUCERS = 4,
+                k_NUM_CONSUMERS = 4,
+                k_NUM_VALUES    = 10000  // per producer
+            };
+
+            static const int RANGE_SIZES[] = { 1, 7, 64 };
+
+            for (int ri = 0; ri < 3; ++ri) {
+                const int RANGE_SIZE = RANGE_SIZES[ri];
+
+                if (veryVerbose) { T_ P(RANGE_SIZE) }
+
+                Obj mX(32);  const Obj& X = mX;
+
+                bsl::vector<bsl::vector<int> > results(k_NUM_CONSUMERS);
+
+                bslmt::ThreadGroup consumers;
+                for (int i = 0; i < k_NUM_CONSUMERS; ++i) {
+                    RANGE_TEST::RangeConsumer consumer = { &mX,
+                                                           RANGE_SIZE,
+                                                           &results[i] };
+                    consumers.addThread(consumer);
+                }
+
+                bslmt::ThreadGroup producers;
+                for (int i = 0; i < k_NUM_PRODUCERS; ++i) {
+                    RANGE_TEST::RangeProducer producer = { &mX,
+                                                           i * k_NUM_VALUES,
+                                                           k_NUM_VALUES,
+                                                           RANGE_SIZE };
+                    producers.addThread(producer);
+                }
+
+                producers.joinAll();
+                ASSERT(0 == X.waitUntilEmpty());
+
+                mX.disablePopFront();
+                consumers.joinAll();
+
+                bsl::vector<int> all;
+                for (int i = 0; i < k_NUM_CONSUMERS; ++i) {
+                    // Values from one producer are popped in order.
+
+                    bsl::vector<int> last(k_NUM_PRODUCERS, -1);
+                    for (bsl::size_t j = 0; j < results[i].size(); ++j) {
+                        const int value    = results[i][j];
+                        const int producer = value / k_NUM_VALUES;
+                        ASSERTV(RANGE_SIZE, value, last[producer] < value);
+                        last[producer] = value;
+                    }
+                    all.insert(all.end(),
+                               results[i].begin(),
+                               results[i].end());
+                }
+
+                bsl::sort(all.begin(), all.end());
+                ASSERTV(RANGE_SIZE,
+                        all.size(),
+                        k_NUM_PRODUCERS * k_NUM_VALUES == all.size());
+                for (int i = 0; i < static_cast<int>(all.size()); ++i) {
+                    if (i != all[i]) {
+                        ASSERTV(RANGE_SIZE, i, all[i], i == all[i]);
+                        break;
+                    }
+                }
+            }
+        }
+      } break;
       case 12: {
         // --------------------------------------------------------------------
         // DRQS 153332608: 'waitUntilEmpty' RACE WITH 'popFront'
@@ -2900,6 +3494,147 @@ int main(int argc, char *argv[])
         ASSERT(3 == v);
         ASSERT(0 == X.numElements());
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: RANGE OPERATIONS
+        //
+        // Concerns:
+        //: 1 Transferring values in ranges reduces the cost per value of the
+        //:   synchronization between a producer and a consumer.
+        //
+        // Plan:
+        //: 1 For ranges of 1, 16, and 256 elements, transfer a large number
+        //:   of values from one producer thread to one consumer thread using
+        //:   'pushBackRange' and 'popFrontRange', and report the throughput.
+        //:   Also report the throughput of 'pushBack' and 'popFront' for
+        //:   reference.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: RANGE OPERATIONS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: RANGE OPERATIONS" << endl
+                          << "=============================" << endl;
+
+        const int k_NUM_VALUES = argc > 2 ? atoi(argv[2]) : 1 << 22;
+
+        static const int RANGE_SIZES[] = { 1, 16, 256 };
+
+        {
+            Obj mX(1024);
+
+            bsls::Stopwatch timer;
+            timer.start();
+
+            bslmt::ThreadGroup threads;
+            RANGE_TEST::PerElementProducer producer(&mX, k_NUM_VALUES);
+            threads.addThread(producer);
+
+            int value;
+            for (int i = 0; i < k_NUM_VALUES; ++i) {
+                mX.popFront(&value);
+            }
+            threads.joinAll();
+
+            timer.stop();
+
+            cout << "pushBack/popFront:\t"
+                 << static_cast<bsls::Types::Int64>(
+                                         k_NUM_VALUES / timer.elapsedTime())
+                 << " values/s" << endl;
+        }
+
+        for (int ri = 0; ri < 3; ++ri) {
+            const int RANGE_SIZE = RANGE_SIZES[ri];
+
+            Obj mX(1024);
+
+            bsl::vector<int> result;
+            result.reserve(k_NUM_VALUES);
+
+            bsls::Stopwatch timer;
+            timer.start();
+
+            bslmt::ThreadGroup threads;
+            RANGE_TEST::RangeConsumer consumer = { &mX, RANGE_SIZE, &result };
+            threads.addThread(consumer);
+            RANGE_TEST::RangeProducer producer = { &mX,
+                                                   0,
+                                                   k_NUM_VALUES,
+                                                   RANGE_SIZE };
+            producer();
+
+            mX.waitUntilEmpty();
+            mX.disablePopFront();
+            threads.joinAll();
+
+            timer.stop();
+
+            ASSERT(static_cast<bsl::size_t>(k_NUM_VALUES) == result.size());
+
+            cout << "range of " << RANGE_SIZE << ":\t"
+                 << static_cast<bsls::Types::Int64>(
+                                         k_NUM_VALUES / timer.elapsedTime())
+                 << " values/s" << endl;
+        }
+      } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: WAIT STRATEGY LATENCY
+        //
+        // Concerns:
+        //: 1 Spinning before parking reduces the latency of a hand-off
+        //:   between threads running on different CPUs.
+        //
+        // Plan:
+        //: 1 For a parking, a spinning, and an adaptive strategy, bounce
+        //:   values between two threads through two queues, and report the
+        //:   distribution of the round-trip latency.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: WAIT STRATEGY LATENCY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: WAIT STRATEGY LATENCY" << endl
+                          << "==================================" << endl;
+
+        using namespace WAIT_STRATEGY_TEST;
+
+        typedef bslmt::WaitStrategy WS;
+
+        const int k_NUM_ROUND_TRIPS = argc > 2 ? atoi(argv[2]) : 100000;
+
+        const struct {
+            const char *d_label_p;
+            WS          d_strategy;
+        } DATA[] = {
+            { "park",     WS()                    },
+            { "spin",     WS(100000, 0)           },
+            { "adaptive", WS(100000, 0, true)     },
+            { "yield",    WS(100, 16, true)       }
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            Obj ping(2, DATA[ti].d_strategy);
+            Obj pong(2, DATA[ti].d_strategy);
+
+            bsl::vector<bsls::Types::Int64> latencies;
+            latencies.reserve(k_NUM_ROUND_TRIPS);
+
+            bslmt::ThreadGroup threads;
+            Echo echo = { &ping, &pong, k_NUM_ROUND_TRIPS };
+            threads.addThread(echo);
+
+            pingPong(&latencies, &ping, &pong, k_NUM_ROUND_TRIPS);
+
+            threads.joinAll();
+
+            printPercentiles(DATA[ti].d_label_p, &latencies);
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -42,6 +42,18 @@ BSLS_IDENT("$Id: $")
 // These limitations are a trade-off for significant gain in performance
 // compared to 'bdlcc::Queue'.
 //
+///Wait Strategy
+///-------------
+// By default, a thread calling 'pushBack' on a full queue, or 'popFront' on an
+// empty queue, blocks immediately on a semaphore.  A 'bslmt::WaitStrategy' may
+// be supplied at construction to have such a thread first spin, and then
+// yield, while the queue remains full (respectively, empty), before blocking
+// (see 'bslmt_waitstrategy').  If the strategy is adaptive, the number of
+// spins is tuned at run-time from the number of spins after which space (or
+// data) appeared in the queue in the previous waits.  Spinning reduces the
+// hand-off latency between threads running on different CPUs at the cost of
+// CPU time.
+//
 ///Template Requirements
 ///---------------------
 // 'bdlcc::FixedQueue' is a template that is parameterized on the type of
@@ -187,6 +199,7 @@ BSLS_IDENT("$Id: $")
 
 #include <bslmt_semaphore.h>
 #include <bslmt_threadutil.h>
+#include <bslmt_waitstrategy.h>
 
 #include <bsls_atomic.h>
 
@@ -261,6 +274,13 @@ class FixedQueue {
     const char        d_pushControlSemaPad[k_SEMA_PADDING];
                                            // padding to prevent false sharing
 
+    bslmt::WaitStrategy
+                      d_waitStrategy;      // how a thread waits for space or
+                                           // data before blocking
+
+    bsls::AtomicInt   d_spinEstimate;      // estimate of the number of spins
+                                           // needed (see 'bslmt_waitstrategy')
+
     bslma::Allocator *d_allocator_p;       // allocator, held not owned
 
   private:
@@ -272,6 +292,20 @@ class FixedQueue {
     template <class VAL> friend class FixedQueue_PushProctor;
     template <class VAL> friend class FixedQueue_PopGuard;
 
+    // PRIVATE MANIPULATORS
+    bool spinWait(bool isPush);
+        // Spin, and then yield, according to the wait strategy of this queue
+        // while a thread pushing (if the specified 'isPush' is 'true') or
+        // popping (otherwise) an element would have to wait.  Return 'true'
+        // if the thread still has to wait, and 'false' otherwise.
+
+    // PRIVATE ACCESSORS
+    bool mustWait(bool isPush) const;
+        // Return 'true' if a thread pushing (if the specified 'isPush' is
+        // 'true') or popping (otherwise) an element must wait, that is if this
+        // queue is full and enabled (respectively, empty), and 'false'
+        // otherwise.
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(FixedQueue, bslma::UsesBslmaAllocator);
@@ -284,6 +318,17 @@ class FixedQueue {
         // allocator is used.  The behavior is undefined unless '0 < capacity'
         // and 'capacity <= bdlcc::FixedQueueIndexManager::k_MAX_CAPACITY'.
 
+    FixedQueue(bsl::size_t                 capacity,
+               const bslmt::WaitStrategy&  waitStrategy,
+               bslma::Allocator           *basicAllocator = 0);
+        // Create a thread-enabled lock-free queue having the specified
+        // 'capacity' whose threads wait, when the queue is full or empty,
+        // according to the specified 'waitStrategy' before blocking.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless '0 < capacity' and
+        // 'capacity <= bdlcc::FixedQueueIndexManager::k_MAX_CAPACITY'.
+
     ~FixedQueue();
         // Destroy this object.
 
@@ -363,6 +408,9 @@ class FixedQueue {
     int numElements() const;
         // Returns the number of elements currently in this queue.
 
+    const bslmt::WaitStrategy& waitStrategy() const;
+        // Return a 'const' reference to the wait strategy of this queue.
+
     int length() const;
         // [!DEPRECATED!] Invoke 'numElements'.
 
@@ -480,6 +528,48 @@ class FixedQueue_PushProctor {
                            // ---------------------
                            // class FixedQueue
                            // ---------------------
+// PRIVATE MANIPULATORS
+template <class TYPE>
+bool FixedQueue<TYPE>::spinWait(bool isPush)
+{
+    const int spinEstimate = d_spinEstimate.loadRelaxed();
+    const int spinLimit    = d_waitStrategy.spinLimit(spinEstimate);
+
+    bool result   = mustWait(isPush);
+    int  numSpins = 0;
+
+    while (result && numSpins < spinLimit) {
+        bslmt::WaitStrategy::pause();
+        ++numSpins;
+        result = mustWait(isPush);
+    }
+
+    if (d_waitStrategy.isAdaptive()) {
+        // Concurrent updates of the estimate may be lost, which merely delays
+        // its convergence.
+
+        typedef bslmt::WaitStrategy Strategy;
+
+        d_spinEstimate.storeRelaxed(
+                       Strategy::updateSpinEstimate(spinEstimate, numSpins));
+    }
+
+    for (int i = 0; result && i < d_waitStrategy.yieldCount(); ++i) {
+        bslmt::ThreadUtil::yield();
+        result = mustWait(isPush);
+    }
+
+    return result;
+}
+
+// PRIVATE ACCESSORS
+template <class TYPE>
+inline
+bool FixedQueue<TYPE>::mustWait(bool isPush) const
+{
+    return isPush ? isFull() && isEnabled() : isEmpty();
+}
+
 // CREATORS
 template <class TYPE>
 FixedQueue<TYPE>::FixedQueue(bsl::size_t       capacity,
@@ -493,6 +583,29 @@ FixedQueue<TYPE>::FixedQueue(bsl::size_t       capacity,
 , d_numWaitingPushers(0)
 , d_pushControlSema(0)
 , d_pushControlSemaPad()
+, d_waitStrategy()
+, d_spinEstimate(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    d_elements = static_cast<TYPE *>(
+                            d_allocator_p->allocate(capacity * sizeof(TYPE)));
+}
+
+template <class TYPE>
+FixedQueue<TYPE>::FixedQueue(bsl::size_t                 capacity,
+                             const bslmt::WaitStrategy&  waitStrategy,
+                             bslma::Allocator           *basicAllocator)
+: d_elements()
+, d_elementsPad()
+, d_impl(capacity, basicAllocator)
+, d_numWaitingPoppers(0)
+, d_popControlSema(0)
+, d_popControlSemaPad()
+, d_numWaitingPushers(0)
+, d_pushControlSema(0)
+, d_pushControlSemaPad()
+, d_waitStrategy(waitStrategy)
+, d_spinEstimate(0)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     d_elements = static_cast<TYPE *>(
@@ -636,6 +749,10 @@ int FixedQueue<TYPE>::pushBack(const TYPE& value)
             return retval;                                            // RETURN
         }
 
+        if (!d_waitStrategy.isParkOnly() && !spinWait(true)) {
+            continue;                                               // CONTINUE
+        }
+
         d_numWaitingPushers.addRelaxed(1);
 
         // SYNCHRONIZATION POINT 1-Prime
@@ -667,6 +784,10 @@ int FixedQueue<TYPE>::pushBack(bslmf::MovableRef<TYPE> value)
             return retval;                                            // RETURN
         }
 
+        if (!d_waitStrategy.isParkOnly() && !spinWait(true)) {
+            continue;                                               // CONTINUE
+        }
+
         d_numWaitingPushers.addRelaxed(1);
 
         // SYNCHRONIZATION POINT 1-Prime
@@ -691,6 +812,10 @@ template <class TYPE>
 void FixedQueue<TYPE>::popFront(TYPE *value)
 {
     while (0 != tryPopFront(value)) {
+        if (!d_waitStrategy.isParkOnly() && !spinWait(false)) {
+            continue;                                               // CONTINUE
+        }
+
         d_numWaitingPoppers.addRelaxed(1);
 
         // SYNCHRONIZATION POINT 2-Prime
@@ -716,6 +841,10 @@ TYPE FixedQueue<TYPE>::popFront()
     unsigned int index;
 
     while (0 != d_impl.reservePopIndex(&generation, &index)) {
+        if (!d_waitStrategy.isParkOnly() && !spinWait(false)) {
+            continue;                                               // CONTINUE
+        }
+
         d_numWaitingPoppers.addRelaxed(1);
 
         if (isEmpty()) {
@@ -829,6 +958,13 @@ int FixedQueue<TYPE>::numElements() const
     return static_cast<int>(d_impl.length());
 }
 
+template <class TYPE>
+inline
+const bslmt::WaitStrategy& FixedQueue<TYPE>::waitStrategy() const
+{
+    return d_waitStrategy;
+}
+
 template <class TYPE>
 inline
 int FixedQueue<TYPE>::size() const
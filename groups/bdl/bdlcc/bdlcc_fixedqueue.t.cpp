@@ -27,6 +27,7 @@
 #include <bslmt_threadgroup.h>
 #include <bslmt_threadutil.h>
 #include <bslmt_turnstile.h>
+#include <bslmt_waitstrategy.h>
 
 #include <bdlf_bind.h>
 #include <bdlt_currenttime.h>
@@ -50,6 +51,7 @@
 #include <bsl_functional.h>
 #include <bsl_iostream.h>
 #include <bsl_memory.h>
+#include <bsl_vector.h>
 
 #include <bsl_c_stdlib.h>            // 'atoi'
 
@@ -1189,6 +1191,63 @@ int IncorrectlyMatchingMoveConstructorTestType::data() const
 
 }  // close namespace case18
 
+namespace case19 {
+
+typedef bdlcc::FixedQueue<int> IntQueue;
+
+struct Echo {
+    // This 'struct' defines a functor that pops 'd_numRoundTrips' values from
+    // '*d_ping_p' and pushes each of them back onto '*d_pong_p'.
+
+    // DATA
+    IntQueue *d_ping_p;
+    IntQueue *d_pong_p;
+    int       d_numRoundTrips;
+
+    // ACCESSORS
+    void operator()() const
+        // Echo the values.
+    {
+        for (int i = 0; i < d_numRoundTrips; ++i) {
+            ASSERTT(0 == d_pong_p->pushBack(d_ping_p->popFront()));
+        }
+    }
+};
+
+void pingPong(bsl::vector<bsls::Types::Int64> *latencies,
+              IntQueue                        *ping,
+              IntQueue                        *pong,
+              int                              numRoundTrips)
+    // Push 'numRoundTrips' values onto the specified 'ping' queue, one at a
+    // time, each time waiting for the value to be echoed on the specified
+    // 'pong' queue by an 'Echo' functor running in another thread, and verify
+    // the echoed value.  If the specified 'latencies' is not 0, append to it
+    // the duration, in nanoseconds, of each round trip.
+{
+    for (int i = 0; i < numRoundTrips; ++i) {
+        const bsls::Types::Int64 start = bsls::TimeUtil::getTimer();
+
+        int value = -1;
+        ASSERT(0 == ping->pushBack(i));
+        pong->popFront(&value);
+
+        if (latencies) {
+            latencies->push_back(bsls::TimeUtil::getTimer() - start);
+        }
+
+        LOOP2_ASSERT(i, value, i == value);
+    }
+}
+
+void pushExpectDisabled(IntQueue *queue)
+    // Push a value onto the specified 'queue', which is full, and verify that
+    // the push fails because the queue is disabled.
+{
+    ASSERTT(0 != queue->pushBack(1));
+}
+
+}  // close namespace case19
+
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -1305,7 +1364,7 @@ int main(int argc, char *argv[])
                     bslmt::Configuration::recommendedDefaultThreadStackSize());
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 19: {
+      case 20: {
         // ---------------------------------------------------------
         // Usage example test
         //
@@ -1321,6 +1380,94 @@ int main(int argc, char *argv[])
         break;
       }
 
+      case 19: {
+        // ---------------------------------------------------------
+        // Wait strategy test
+        //
+        // Test that a queue created with a wait strategy reports it, that a
+        // queue created without one parks immediately, that values are
+        // transferred correctly between threads whichever the strategy, and
+        // that a thread spinning in 'pushBack' on a full queue fails when
+        // the queue is disabled.  Note that the spin counts are kept small,
+        // as the test may run on a single CPU.
+        // ---------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "Wait strategy test" << endl
+                          << "==================" << endl;
+
+        using namespace case19;
+
+        typedef bslmt::WaitStrategy WS;
+
+        {
+            bslma::TestAllocator ta(veryVeryVerbose);
+
+            IntQueue mX(4, &ta);
+            ASSERT(WS() == mX.waitStrategy());
+
+            const WS STRATEGY(100, 2, true);
+
+            IntQueue mY(4, STRATEGY, &ta);
+            ASSERT(STRATEGY == mY.waitStrategy());
+            ASSERT(mY.isEmpty());
+            ASSERT(mY.isEnabled());
+            ASSERT(4 == mY.capacity());
+
+            for (int i = 0; i < 4; ++i) {
+                ASSERT(0 == mY.pushBack(i));
+            }
+            ASSERT(mY.isFull());
+            ASSERT(0 == mY.popFront());
+        }
+
+        {
+            const WS STRATEGIES[] = { WS(),
+                                      WS(1000, 0),
+                                      WS(0, 4),
+                                      WS(1000, 4, true),
+                                      WS(4000, 0, true) };
+            const int NUM_STRATEGIES = static_cast<int>(
+                                   sizeof STRATEGIES / sizeof *STRATEGIES);
+
+            enum { k_NUM_ROUND_TRIPS = 500 };
+
+            for (int ti = 0; ti < NUM_STRATEGIES; ++ti) {
+                IntQueue ping(1, STRATEGIES[ti]);
+                IntQueue pong(1, STRATEGIES[ti]);
+
+                bslmt::ThreadGroup threads;
+                Echo echo = { &ping, &pong, k_NUM_ROUND_TRIPS };
+                threads.addThread(echo);
+
+                pingPong(0, &ping, &pong, k_NUM_ROUND_TRIPS);
+
+                threads.joinAll();
+
+                LOOP_ASSERT(ti, ping.isEmpty());
+                LOOP_ASSERT(ti, pong.isEmpty());
+            }
+        }
+
+        {
+            IntQueue mX(1, WS(1 << 30, 0));
+            ASSERT(0 == mX.pushBack(0));
+
+            bslmt::ThreadGroup threads;
+            threads.addThread(bdlf::BindUtil::bind(&pushExpectDisabled,
+                                                   &mX));
+
+            bslmt::ThreadUtil::microSleep(10000);
+
+            mX.disable();
+
+            threads.joinAll();
+
+            ASSERT(1 == mX.numElements());
+            ASSERT(0 == mX.popFront());
+        }
+      } break;
+
       case 18: {
           // ---------------------------------------------------------
           // Moving tests
@@ -3114,6 +3261,64 @@ int main(int argc, char *argv[])
         bsl::cout << "Done.  testStatus = " << testStatus << bsl::endl;
       } break;
 
+      case -10: {
+        // --------------------------------------------------------------------
+        // WAIT STRATEGY LATENCY BENCHMARK
+        //
+        // Bounce values between two threads through two queues of capacity 1
+        // for a parking, a spinning, and an adaptive wait strategy, and
+        // report the distribution of the round-trip latency.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "Wait strategy latency benchmark" << endl
+                          << "===============================" << endl;
+
+        using namespace case19;
+
+        typedef bslmt::WaitStrategy WS;
+
+        const int k_NUM_ROUND_TRIPS = argc > 2 ? atoi(argv[2]) : 100000;
+
+        const struct {
+            const char *d_label_p;
+            WS          d_strategy;
+        } DATA[] = {
+            { "park",     WS()                },
+            { "spin",     WS(100000, 0)       },
+            { "adaptive", WS(100000, 0, true) },
+            { "yield",    WS(100, 16, true)   }
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            IntQueue ping(1, DATA[ti].d_strategy);
+            IntQueue pong(1, DATA[ti].d_strategy);
+
+            bsl::vector<bsls::Types::Int64> latencies;
+            latencies.reserve(k_NUM_ROUND_TRIPS);
+
+            bslmt::ThreadGroup threads;
+            Echo echo = { &ping, &pong, k_NUM_ROUND_TRIPS };
+            threads.addThread(echo);
+
+            pingPong(&latencies, &ping, &pong, k_NUM_ROUND_TRIPS);
+
+            threads.joinAll();
+
+            bsl::sort(latencies.begin(), latencies.end());
+
+            const bsl::size_t n = latencies.size();
+
+            cout << DATA[ti].d_label_p
+                 << "\tp50 "   << latencies[n *  50 / 100]
+                 << "\tp90 "   << latencies[n *  90 / 100]
+                 << "\tp99 "   << latencies[n *  99 / 100]
+                 << "\tp99.9 " << latencies[n * 999 / 1000]
+                 << " ns" << endl;
+        }
+      } break;
+
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -29,6 +29,13 @@ BSLS_IDENT("$Id: $")
 // provided.  The 'tryPopFront' method fails immediately, returning a non-zero
 // value, if the queue is empty.
 //
+// The methods 'pushBackRange' and 'popFrontRange' (and their "try" variants)
+// transfer a sequence of elements at once, which reduces the synchronization
+// cost per element: when enough nodes are available, the nodes for a pushed
+// sequence are reserved with a single atomic operation and a blocked consumer
+// is woken at most once for the sequence, and the nodes of a popped sequence
+// are returned to the producers with a single atomic operation.
+//
 // The queue may be placed into a "enqueue disabled" state using the
 // 'disablePushBack' method.  When disabled, 'pushBack' and 'tryPushBack' fail
 // immediately and return an error code.  The queue may be restored to normal
@@ -242,6 +249,32 @@ class SingleConsumerQueue {
         // 'e_DISABLED' if 'isPushBackDisabled()'.  On failure, 'value' is not
         // changed.
 
+    int popFrontRange(bsl::size_t *numPopped,
+                      TYPE        *values,
+                      bsl::size_t  maxNumValues);
+        // Remove up to the specified 'maxNumValues' elements from the front of
+        // this queue, assign them, in order, to the array starting at the
+        // specified 'values', and load into the specified 'numPopped' the
+        // number of removed elements.  If the queue is empty, block until it
+        // is not empty.  Return 0 on success, and a non-zero value otherwise.
+        // Specifically, return 'e_DISABLED' if 'isPopFrontDisabled()'.  On
+        // failure, '0 == *numPopped'.  Threads blocked due to the queue being
+        // empty will return 'e_DISABLED' if 'disablePopFront' is invoked.  The
+        // behavior is undefined unless '0 < maxNumValues', 'values' refers to
+        // an array of at least 'maxNumValues' elements, and the invoker of
+        // this method is the single consumer.
+
+    int pushBackRange(bsl::size_t *numPushed,
+                      const TYPE  *values,
+                      bsl::size_t  numValues);
+        // Append the specified 'numValues' elements of the array starting at
+        // the specified 'values', in order, to the back of this queue, and
+        // load into the specified 'numPushed' the number of appended elements.
+        // Return 0 on success, and a non-zero value otherwise.  Specifically,
+        // return 'e_DISABLED' if 'isPushBackDisabled()'.  Note that, if the
+        // queue is enqueue disabled concurrently, only part of the elements
+        // may be appended.
+
     void removeAll();
         // Remove all items currently in this queue.  Note that this operation
         // is not atomic; if other threads are concurrently pushing items into
@@ -259,6 +292,21 @@ class SingleConsumerQueue {
         // behavior is undefined unless the invoker of this method is the
         // single consumer.
 
+    int tryPopFrontRange(bsl::size_t *numPopped,
+                         TYPE        *values,
+                         bsl::size_t  maxNumValues);
+        // Attempt to remove up to the specified 'maxNumValues' elements from
+        // the front of this queue without blocking, assign them, in order, to
+        // the array starting at the specified 'values', and load into the
+        // specified 'numPopped' the number of removed elements.  Return 0 on
+        // success, and a non-zero value otherwise.  Specifically, return
+        // 'e_DISABLED' if 'isPopFrontDisabled()', and 'e_EMPTY' if
+        // '!isPopFrontDisabled()' and the queue was empty.  On failure,
+        // '0 == *numPopped'.  The behavior is undefined unless
+        // '0 < maxNumValues', 'values' refers to an array of at least
+        // 'maxNumValues' elements, and the invoker of this method is the
+        // single consumer.
+
     int tryPushBack(const TYPE& value);
         // Append the specified 'value' to the back of this queue.  Return 0 on
         // success, and a non-zero value otherwise.  Specifically, return
@@ -271,6 +319,15 @@ class SingleConsumerQueue {
         // 'e_DISABLED' if 'isPushBackDisabled()'.  On failure, 'value' is not
         // changed.
 
+    int tryPushBackRange(bsl::size_t *numPushed,
+                         const TYPE  *values,
+                         bsl::size_t  numValues);
+        // Append the specified 'numValues' elements of the array starting at
+        // the specified 'values', in order, to the back of this queue, and
+        // load into the specified 'numPushed' the number of appended elements.
+        // Return 0 on success, and a non-zero value otherwise.  Specifically,
+        // return 'e_DISABLED' if 'isPushBackDisabled()'.
+
                        // Enqueue/Dequeue State
 
     void disablePopFront();
@@ -373,6 +430,22 @@ int SingleConsumerQueue<TYPE>::pushBack(bslmf::MovableRef<TYPE> value)
     return d_impl.pushBack(bslmf::MovableRefUtil::move(value));
 }
 
+template <class TYPE>
+int SingleConsumerQueue<TYPE>::popFrontRange(bsl::size_t *numPopped,
+                                             TYPE        *values,
+                                             bsl::size_t  maxNumValues)
+{
+    return d_impl.popFrontRange(numPopped, values, maxNumValues);
+}
+
+template <class TYPE>
+int SingleConsumerQueue<TYPE>::pushBackRange(bsl::size_t *numPushed,
+                                             const TYPE  *values,
+                                             bsl::size_t  numValues)
+{
+    return d_impl.pushBackRange(numPushed, values, numValues);
+}
+
 template <class TYPE>
 void SingleConsumerQueue<TYPE>::removeAll()
 {
@@ -385,6 +458,14 @@ int SingleConsumerQueue<TYPE>::tryPopFront(TYPE *value)
     return d_impl.tryPopFront(value);
 }
 
+template <class TYPE>
+int SingleConsumerQueue<TYPE>::tryPopFrontRange(bsl::size_t *numPopped,
+                                                TYPE        *values,
+                                                bsl::size_t  maxNumValues)
+{
+    return d_impl.tryPopFrontRange(numPopped, values, maxNumValues);
+}
+
 template <class TYPE>
 int SingleConsumerQueue<TYPE>::tryPushBack(const TYPE& value)
 {
@@ -397,6 +478,14 @@ int SingleConsumerQueue<TYPE>::tryPushBack(bslmf::MovableRef<TYPE> value)
     return d_impl.tryPushBack(bslmf::MovableRefUtil::move(value));
 }
 
+template <class TYPE>
+int SingleConsumerQueue<TYPE>::tryPushBackRange(bsl::size_t *numPushed,
+                                                const TYPE  *values,
+                                                bsl::size_t  numValues)
+{
+    return d_impl.tryPushBackRange(numPushed, values, numValues);
+}
+
                        // Enqueue/Dequeue State
 
 template <class TYPE>
@@ -22,6 +22,7 @@
 #include <bsls_asserttest.h>
 #include <bsls_atomic.h>
 #include <bsls_atomicoperations.h>
+#include <bsls_stopwatch.h>
 #include <bsls_systemtime.h>
 #include <bsls_timeinterval.h>
 #include <bsls_types.h>
@@ -81,10 +82,14 @@ using namespace bsl;
 // [ 2] int popFront(TYPE *value);
 // [ 2] int pushBack(const TYPE& value);
 // [10] int pushBack(bslmf::MovableRef<TYPE> value);
+// [13] int popFrontRange(size_t *num, TYPE *values, size_t max);
+// [13] int pushBackRange(size_t *num, const TYPE *values, size_t n);
 // [ 2] void removeAll();
 // [ 8] int tryPopFront(TYPE *value);
+// [13] int tryPopFrontRange(size_t *num, TYPE *values, size_t max);
 // [ 7] int tryPushBack(const TYPE& value);
 // [10] int tryPushBack(bslmf::MovableRef<TYPE> value);
+// [13] int tryPushBackRange(size_t *num, const TYPE *values, size_t n);
 // [ 6] void disablePopFront();
 // [ 6] void disablePushBack();
 // [ 6] void enablePopFront();
@@ -98,7 +103,8 @@ using namespace bsl;
 // [ 4] bslma::Allocator *allocator() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [13] USAGE EXAMPLE
+// [14] USAGE EXAMPLE
+// [-1] PERFORMANCE: RANGE OPERATIONS
 // [ 3] Obj& gg(Obj *object, const char *spec);
 // [ 3] int ggg(Obj *object, const char *spec);
 // [ 2] CONCERN: 0 == e_SUCCESS
@@ -584,6 +590,43 @@ extern "C" void *orderingState(void *arg)
     return 0;
 }
 
+struct RangePushData {
+    // Data for a thread pushing 'd_numValues' integers in ranges of
+    // 'd_rangeSize' elements (or individually if 'd_rangeSize' is 0).
+
+    Obj *d_obj_p;
+    int  d_numValues;
+    int  d_rangeSize;
+};
+
+extern "C" void *rangePush(void *arg)
+{
+    RangePushData& data = *static_cast<RangePushData *>(arg);
+
+    if (0 == data.d_rangeSize) {
+        for (int i = 0; i < data.d_numValues; ++i) {
+            data.d_obj_p->pushBack(i);
+        }
+        return 0;                                                     // RETURN
+    }
+
+    bsl::vector<int> values(data.d_rangeSize);
+
+    for (int i = 0; i < data.d_numValues; i += data.d_rangeSize) {
+        const int count = data.d_numValues - i < data.d_rangeSize
+                        ? data.d_numValues - i
+                        : data.d_rangeSize;
+        for (int j = 0; j < count; ++j) {
+            values[j] = i + j;
+        }
+
+        bsl::size_t numPushed;
+        data.d_obj_p->pushBackRange(&numPushed, values.data(), count);
+    }
+
+    return 0;
+}
+
 static char s_watchdogText[128];
 
 void setWatchdogText(const char *value)
@@ -872,7 +915,7 @@ int main(int argc, char *argv[])
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 13: {
+      case 14: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -910,6 +953,63 @@ int main(int argc, char *argv[])
 
         bslmt::ThreadUtil::join(watchdogHandle);
       } break;
+      case 13: {
+        // --------------------------------------------------------------------
+        // TESTING RANGE OPERATIONS
+        //   Note that the range operations are tested thoroughly in
+        //   'bdlcc_singleconsumerqueueimpl'.
+        //
+        // Concerns:
+        //: 1 The range methods forward to the implementation.
+        //
+        // Plan:
+        //: 1 Push and pop ranges of values, and verify the return values,
+        //:   counts, and values.  (C-1)
+        //
+        // Testing:
+        //   int popFrontRange(size_t *num, TYPE *values, size_t max);
+        //   int pushBackRange(size_t *num, const TYPE *values, size_t n);
+        //   int tryPopFrontRange(size_t *num, TYPE *values, size_t max);
+        //   int tryPushBackRange(size_t *num, const TYPE *values, size_t n);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING RANGE OPERATIONS" << endl
+                          << "========================" << endl;
+
+        Obj mX(4);  const Obj& X = mX;
+
+        const int VALUES[] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+
+        int         values[8];
+        bsl::size_t numPushed = 99;
+        bsl::size_t numPopped = 99;
+
+        ASSERT(e_SUCCESS == mX.pushBackRange(&numPushed, VALUES, 3));
+        ASSERT(3         == numPushed);
+        ASSERT(e_SUCCESS == mX.tryPushBackRange(&numPushed, VALUES + 3, 5));
+        ASSERT(5         == numPushed);
+        ASSERT(8         == X.numElements());
+
+        ASSERT(e_SUCCESS == mX.popFrontRange(&numPopped, values, 6));
+        ASSERT(6         == numPopped);
+        ASSERT(e_SUCCESS == mX.tryPopFrontRange(&numPopped, values + 6, 6));
+        ASSERT(2         == numPopped);
+        for (int i = 0; i < 8; ++i) {
+            ASSERTV(i, values[i], i == values[i]);
+        }
+
+        ASSERT(e_EMPTY   == mX.tryPopFrontRange(&numPopped, values, 8));
+        ASSERT(0         == numPopped);
+
+        mX.disablePushBack();
+        mX.disablePopFront();
+
+        ASSERT(e_DISABLED == mX.pushBackRange(&numPushed, VALUES, 3));
+        ASSERT(e_DISABLED == mX.tryPushBackRange(&numPushed, VALUES, 3));
+        ASSERT(e_DISABLED == mX.popFrontRange(&numPopped, values, 3));
+        ASSERT(e_DISABLED == mX.tryPopFrontRange(&numPopped, values, 3));
+      } break;
       case 12: {
         // ---------------------------------------------------------
         // Ordering Guarantee Test
@@ -2599,6 +2699,86 @@ int main(int argc, char *argv[])
         ASSERT(3 == v);
         ASSERT(0 == X.numElements());
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: RANGE OPERATIONS
+        //
+        // Concerns:
+        //: 1 Transferring values in ranges reduces the cost per value of the
+        //:   synchronization between producers and the consumer.
+        //
+        // Plan:
+        //: 1 For ranges of 1, 16, and 256 elements, and for individual
+        //:   elements, transfer a large number of values from one and from
+        //:   four producer threads to the consumer, and report the
+        //:   throughput.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: RANGE OPERATIONS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: RANGE OPERATIONS" << endl
+                          << "=============================" << endl;
+
+        const int k_NUM_VALUES = argc > 2 ? atoi(argv[2]) : 1 << 22;
+
+        static const int RANGE_SIZES[] = { 0, 1, 16, 256 };
+
+        for (int numThreads = 1; numThreads <= 4; numThreads += 3) {
+            for (int ri = 0; ri < 4; ++ri) {
+                const int RANGE_SIZE = RANGE_SIZES[ri];
+
+                Obj mX;
+
+                bsl::vector<bslmt::ThreadUtil::Handle> handles(numThreads);
+                RangePushData data = { &mX,
+                                       k_NUM_VALUES / numThreads,
+                                       RANGE_SIZE };
+
+                const int total = data.d_numValues * numThreads;
+
+                bsl::vector<int> values(RANGE_SIZE ? RANGE_SIZE : 1);
+
+                bsls::Stopwatch timer;
+                timer.start();
+
+                for (int i = 0; i < numThreads; ++i) {
+                    bslmt::ThreadUtil::create(&handles[i], rangePush, &data);
+                }
+
+                int numPopped = 0;
+                while (numPopped < total) {
+                    if (0 == RANGE_SIZE) {
+                        mX.popFront(&values[0]);
+                        ++numPopped;
+                    }
+                    else {
+                        bsl::size_t count;
+                        mX.popFrontRange(&count, values.data(), RANGE_SIZE);
+                        numPopped += static_cast<int>(count);
+                    }
+                }
+
+                timer.stop();
+
+                for (int i = 0; i < numThreads; ++i) {
+                    bslmt::ThreadUtil::join(handles[i]);
+                }
+
+                cout << numThreads << " producer(s), ";
+                if (0 == RANGE_SIZE) {
+                    cout << "pushBack/popFront:\t";
+                }
+                else {
+                    cout << "range of " << RANGE_SIZE << ":\t";
+                }
+                cout << static_cast<bsls::Types::Int64>(
+                                                total / timer.elapsedTime())
+                     << " values/s" << endl;
+            }
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -29,6 +29,15 @@ BSLS_IDENT("$Id: $")
 // provided.  The 'tryPopFront' method fails immediately, returning a non-zero
 // value, if the queue is empty.
 //
+// The methods 'pushBackRange' and 'popFrontRange' (and their "try" variants)
+// transfer a sequence of elements at once.  'pushBackRange' reserves, when
+// enough nodes are available, the nodes for the whole sequence with a single
+// atomic operation, and wakes a blocked consumer at most once for the
+// sequence; otherwise, the elements are pushed individually, allocating nodes
+// as needed.  'popFrontRange' removes as many elements as are readable (up to
+// a specified maximum) and makes their nodes available to the producers with
+// a single atomic operation.
+//
 // The queue may be placed into a "enqueue disabled" state using the
 // 'disablePushBack' method.  When disabled, 'pushBack' and 'tryPushBack' fail
 // immediately and return an error code.  The queue may be restored to normal
@@ -209,6 +218,94 @@ class SingleConsumerQueueImpl_PopCompleteGuard {
         // managed queue.
 };
 
+           // ===================================================
+           // class SingleConsumerQueueImpl_PopRangeCompleteGuard
+           // ===================================================
+
+template <class TYPE, class NODE>
+class SingleConsumerQueueImpl_PopRangeCompleteGuard {
+    // This class implements a guard that counts the nodes consumed by a "pop
+    // range" operation and automatically invokes 'popRangeComplete' on the
+    // managed queue upon destruction.
+
+    // DATA
+    TYPE               *d_queue_p;       // managed queue
+    NODE               *d_nextRead_p;    // next node to read
+    bsls::Types::Int64  d_numNodes;      // number of consumed nodes
+    bsls::Types::Int64  d_numReclaimed;  // number of consumed nodes that were
+                                         // marked for reclamation
+
+    // NOT IMPLEMENTED
+    SingleConsumerQueueImpl_PopRangeCompleteGuard();
+    SingleConsumerQueueImpl_PopRangeCompleteGuard(
+                         const SingleConsumerQueueImpl_PopRangeCompleteGuard&);
+    SingleConsumerQueueImpl_PopRangeCompleteGuard& operator=(
+                         const SingleConsumerQueueImpl_PopRangeCompleteGuard&);
+
+  public:
+    // CREATORS
+    SingleConsumerQueueImpl_PopRangeCompleteGuard(TYPE *queue, NODE *nextRead);
+        // Create a 'popRangeComplete' guard managing the specified 'queue',
+        // whose next node to read is the specified 'nextRead'.
+
+    ~SingleConsumerQueueImpl_PopRangeCompleteGuard();
+        // Destroy this object and invoke the 'popRangeComplete' method on the
+        // managed queue with the next node to read and the number of consumed
+        // nodes.
+
+    // MANIPULATORS
+    void advance(NODE *nextRead, bool isReclaimed);
+        // Count the current node as consumed, and as having been marked for
+        // reclamation if the specified 'isReclaimed' is 'true', and set the
+        // next node to read to the specified 'nextRead'.
+
+    // ACCESSORS
+    NODE *nextRead() const;
+        // Return the next node to read.
+};
+
+           // ====================================================
+           // class SingleConsumerQueueImpl_PushRangeCompleteGuard
+           // ====================================================
+
+template <class TYPE, class NODE>
+class SingleConsumerQueueImpl_PushRangeCompleteGuard {
+    // This class implements a guard that counts the nodes written by a "push
+    // range" operation and automatically invokes 'pushRangeComplete' on the
+    // managed queue upon destruction.
+
+    // DATA
+    TYPE        *d_queue_p;     // managed queue
+    NODE        *d_first_p;     // first reserved node
+    bsl::size_t  d_numWritten;  // number of written nodes
+    bsl::size_t  d_numNodes;    // number of reserved nodes
+
+    // NOT IMPLEMENTED
+    SingleConsumerQueueImpl_PushRangeCompleteGuard();
+    SingleConsumerQueueImpl_PushRangeCompleteGuard(
+                        const SingleConsumerQueueImpl_PushRangeCompleteGuard&);
+    SingleConsumerQueueImpl_PushRangeCompleteGuard& operator=(
+                        const SingleConsumerQueueImpl_PushRangeCompleteGuard&);
+
+  public:
+    // CREATORS
+    SingleConsumerQueueImpl_PushRangeCompleteGuard(TYPE        *queue,
+                                                   NODE        *first,
+                                                   bsl::size_t  numNodes);
+        // Create a 'pushRangeComplete' guard managing the specified
+        // 'numNodes' consecutive nodes, starting at the specified 'first', of
+        // the specified 'queue'.
+
+    ~SingleConsumerQueueImpl_PushRangeCompleteGuard();
+        // Destroy this object and invoke the 'pushRangeComplete' method on the
+        // managed queue with the managed nodes and the number of written
+        // nodes.
+
+    // MANIPULATORS
+    void advance();
+        // Count the next managed node as written.
+};
+
                       // =============================
                       // class SingleConsumerQueueImpl
                       // =============================
@@ -257,6 +354,9 @@ class SingleConsumerQueueImpl {
     static const bsls::Types::Int64 k_AVAILABLE_INC     = 0x0000000010000000LL;
     static const int                k_AVAILABLE_SHIFT   = 28;
 
+    static const bsl::size_t        k_MAX_RANGE_SIZE    = 1 << 16;
+        // maximum number of nodes reserved at once by 'pushBackRange'
+
     // PRIVATE TYPES
     typedef typename ATOMIC_OP::AtomicTypes::Int     AtomicInt;
     typedef typename ATOMIC_OP::AtomicTypes::Int64   AtomicInt64;
@@ -334,6 +434,26 @@ class SingleConsumerQueueImpl {
                                                                   MUTEX,
                                                                   CONDITION> >;
 
+    friend class SingleConsumerQueueImpl_PopRangeCompleteGuard<
+                           SingleConsumerQueueImpl<TYPE,
+                                                   ATOMIC_OP,
+                                                   MUTEX,
+                                                   CONDITION>,
+                           typename SingleConsumerQueueImpl<TYPE,
+                                                            ATOMIC_OP,
+                                                            MUTEX,
+                                                            CONDITION>::Node >;
+
+    friend class SingleConsumerQueueImpl_PushRangeCompleteGuard<
+                           SingleConsumerQueueImpl<TYPE,
+                                                   ATOMIC_OP,
+                                                   MUTEX,
+                                                   CONDITION>,
+                           typename SingleConsumerQueueImpl<TYPE,
+                                                            ATOMIC_OP,
+                                                            MUTEX,
+                                                            CONDITION>::Node >;
+
     // PRIVATE CLASS METHODS
     static bsls::Types::Int64 available(bsls::Types::Int64 state);
         // Return the available attribute from the specified 'state'.
@@ -348,10 +468,41 @@ class SingleConsumerQueueImpl {
         // then signal the queue empty condition.  This method is used to
         // complete the reclamation of a node in the presence of an exception.
 
+    int popFrontRangeImp(bsl::size_t *numPopped,
+                         TYPE        *values,
+                         bsl::size_t  maxNumValues,
+                         bool         isTry);
+        // Implement 'popFrontRange' if the specified 'isTry' is 'false', and
+        // 'tryPopFrontRange' otherwise, with the specified 'numPopped',
+        // 'values', and 'maxNumValues'.
+
+    void popRangeComplete(Node               *nextRead,
+                          bsls::Types::Int64  numNodes,
+                          bsls::Types::Int64  numReclaimed);
+        // Set the next node to read to the specified 'nextRead', make the
+        // specified 'numNodes' consumed nodes, of which the specified
+        // 'numReclaimed' were marked for reclamation, available for pushing,
+        // and, if the queue is empty, signal the queue empty condition.
+
     Node *pushBackHelper();
         // Return a pointer to the node to assign the value being pushed into
         // this queue, or 0 if 'isPushBackDisabled()'.
 
+    Node *pushBackRangeHelper(bsl::size_t numNodes);
+        // Return a pointer to the first of the specified 'numNodes'
+        // consecutive nodes reserved for the values being pushed into this
+        // queue, or 0 if fewer than 'numNodes' nodes are available or another
+        // thread is allocating a node.  The behavior is undefined unless
+        // '0 < numNodes <= k_MAX_RANGE_SIZE'.
+
+    void pushRangeComplete(Node        *first,
+                           bsl::size_t  numWritten,
+                           bsl::size_t  numNodes);
+        // Make readable the first specified 'numWritten' of the specified
+        // 'numNodes' consecutive nodes starting at the specified 'first',
+        // mark the remaining nodes for reclamation, and, if the consumer is
+        // blocked on one of these nodes, signal it (once).
+
     void incrementUntil(AtomicUint *value, unsigned int bitValue);
         // If the specified 'value' does not have its lowest-order bit set to
         // the value of the specified 'bitValue', increment 'value' until it
@@ -425,6 +576,33 @@ class SingleConsumerQueueImpl {
         // 'e_DISABLED' if 'isPushBackDisabled()'.  On failure, 'value' is not
         // changed.
 
+    int popFrontRange(bsl::size_t *numPopped,
+                      TYPE        *values,
+                      bsl::size_t  maxNumValues);
+        // Remove up to the specified 'maxNumValues' elements from the front of
+        // this queue, assign them, in order, to the array starting at the
+        // specified 'values', and load into the specified 'numPopped' the
+        // number of removed elements.  If the queue is empty, block until it
+        // is not empty.  Return 0 on success, and a non-zero value otherwise.
+        // Specifically, return 'e_DISABLED' if 'isPopFrontDisabled()'.  On
+        // failure, '0 == *numPopped'.  Threads blocked due to the queue being
+        // empty will return 'e_DISABLED' if 'disablePopFront' is invoked.  The
+        // behavior is undefined unless '0 < maxNumValues', 'values' refers to
+        // an array of at least 'maxNumValues' elements, and the invoker of
+        // this method is the single consumer.
+
+    int pushBackRange(bsl::size_t *numPushed,
+                      const TYPE  *values,
+                      bsl::size_t  numValues);
+        // Append the specified 'numValues' elements of the array starting at
+        // the specified 'values', in order, to the back of this queue, and
+        // load into the specified 'numPushed' the number of appended elements.
+        // Return 0 on success, and a non-zero value otherwise.  Specifically,
+        // return 'e_DISABLED' if 'isPushBackDisabled()'.  Note that the
+        // elements are appended contiguously (with respect to other producers)
+        // if enough nodes are available, and that, if the queue is enqueue
+        // disabled concurrently, only part of the elements may be appended.
+
     void removeAll();
         // Remove all items currently in this queue.  Note that this operation
         // is not atomic; if other threads are concurrently pushing items into
@@ -442,6 +620,21 @@ class SingleConsumerQueueImpl {
         // behavior is undefined unless the invoker of this method is the
         // single consumer.
 
+    int tryPopFrontRange(bsl::size_t *numPopped,
+                         TYPE        *values,
+                         bsl::size_t  maxNumValues);
+        // Attempt to remove up to the specified 'maxNumValues' elements from
+        // the front of this queue without blocking, assign them, in order, to
+        // the array starting at the specified 'values', and load into the
+        // specified 'numPopped' the number of removed elements.  Return 0 on
+        // success, and a non-zero value otherwise.  Specifically, return
+        // 'e_DISABLED' if 'isPopFrontDisabled()', and 'e_EMPTY' if
+        // '!isPopFrontDisabled()' and the queue was empty.  On failure,
+        // '0 == *numPopped'.  The behavior is undefined unless
+        // '0 < maxNumValues', 'values' refers to an array of at least
+        // 'maxNumValues' elements, and the invoker of this method is the
+        // single consumer.
+
     int tryPushBack(const TYPE& value);
         // Append the specified 'value' to the back of this queue.  Return 0 on
         // success, and a non-zero value otherwise.  Specifically, retun
@@ -454,6 +647,15 @@ class SingleConsumerQueueImpl {
         // 'e_DISABLED' if 'isPushBackDisabled()'.  On failure, 'value' is not
         // changed.
 
+    int tryPushBackRange(bsl::size_t *numPushed,
+                         const TYPE  *values,
+                         bsl::size_t  numValues);
+        // Append the specified 'numValues' elements of the array starting at
+        // the specified 'values', in order, to the back of this queue, and
+        // load into the specified 'numPushed' the number of appended elements.
+        // Return 0 on success, and a non-zero value otherwise.  Specifically,
+        // return 'e_DISABLED' if 'isPushBackDisabled()'.
+
                        // Enqueue/Dequeue State
 
     void disablePopFront();
@@ -593,6 +795,84 @@ SingleConsumerQueueImpl_PopCompleteGuard<TYPE>::
     d_queue_p->popComplete(true);
 }
 
+           // ---------------------------------------------------
+           // class SingleConsumerQueueImpl_PopRangeCompleteGuard
+           // ---------------------------------------------------
+
+// CREATORS
+template <class TYPE, class NODE>
+SingleConsumerQueueImpl_PopRangeCompleteGuard<TYPE, NODE>::
+     SingleConsumerQueueImpl_PopRangeCompleteGuard(TYPE *queue, NODE *nextRead)
+: d_queue_p(queue)
+, d_nextRead_p(nextRead)
+, d_numNodes(0)
+, d_numReclaimed(0)
+{
+}
+
+template <class TYPE, class NODE>
+SingleConsumerQueueImpl_PopRangeCompleteGuard<TYPE, NODE>::
+                               ~SingleConsumerQueueImpl_PopRangeCompleteGuard()
+{
+    d_queue_p->popRangeComplete(d_nextRead_p, d_numNodes, d_numReclaimed);
+}
+
+// MANIPULATORS
+template <class TYPE, class NODE>
+inline
+void SingleConsumerQueueImpl_PopRangeCompleteGuard<TYPE, NODE>::advance(
+                                                          NODE *nextRead,
+                                                          bool  isReclaimed)
+{
+    d_nextRead_p = nextRead;
+    ++d_numNodes;
+    if (isReclaimed) {
+        ++d_numReclaimed;
+    }
+}
+
+// ACCESSORS
+template <class TYPE, class NODE>
+inline
+NODE *SingleConsumerQueueImpl_PopRangeCompleteGuard<TYPE, NODE>::nextRead()
+                                                                          const
+{
+    return d_nextRead_p;
+}
+
+           // ----------------------------------------------------
+           // class SingleConsumerQueueImpl_PushRangeCompleteGuard
+           // ----------------------------------------------------
+
+// CREATORS
+template <class TYPE, class NODE>
+SingleConsumerQueueImpl_PushRangeCompleteGuard<TYPE, NODE>::
+                                SingleConsumerQueueImpl_PushRangeCompleteGuard(
+                                                         TYPE        *queue,
+                                                         NODE        *first,
+                                                         bsl::size_t  numNodes)
+: d_queue_p(queue)
+, d_first_p(first)
+, d_numWritten(0)
+, d_numNodes(numNodes)
+{
+}
+
+template <class TYPE, class NODE>
+SingleConsumerQueueImpl_PushRangeCompleteGuard<TYPE, NODE>::
+                              ~SingleConsumerQueueImpl_PushRangeCompleteGuard()
+{
+    d_queue_p->pushRangeComplete(d_first_p, d_numWritten, d_numNodes);
+}
+
+// MANIPULATORS
+template <class TYPE, class NODE>
+inline
+void SingleConsumerQueueImpl_PushRangeCompleteGuard<TYPE, NODE>::advance()
+{
+    ++d_numWritten;
+}
+
                       // -----------------------------
                       // class SingleConsumerQueueImpl
                       // -----------------------------
@@ -653,6 +933,116 @@ void SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
     }
 }
 
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
+                                  ::popFrontRangeImp(bsl::size_t *numPopped,
+                                                     TYPE        *values,
+                                                     bsl::size_t  maxNumValues,
+                                                     bool         isTry)
+{
+    BSLS_ASSERT(numPopped);
+    BSLS_ASSERT(values);
+    BSLS_ASSERT(0 < maxNumValues);
+
+    *numPopped = 0;
+
+    unsigned int generation = ATOMIC_OP::getUintAcquire(&d_popFrontDisabled);
+    if (1 == (generation & 1)) {
+        return e_DISABLED;                                            // RETURN
+    }
+
+    SingleConsumerQueueImpl_PopRangeCompleteGuard<
+                                            SingleConsumerQueueImpl<TYPE,
+                                                                    ATOMIC_OP,
+                                                                    MUTEX,
+                                                                    CONDITION>,
+                                            Node>
+           guard(this,
+                 static_cast<Node *>(ATOMIC_OP::getPtrAcquire(&d_nextRead)));
+
+    while (*numPopped < maxNumValues) {
+        Node *nextRead  = guard.nextRead();
+        int   nodeState = ATOMIC_OP::getIntAcquire(&nextRead->d_state);
+
+        if (e_WRITABLE == nodeState) {
+            if (isTry || 0 < *numPopped) {
+                break;
+            }
+
+            // Block until the first element is available, as in 'popFront'.
+
+            bslmt::ThreadUtil::yield();
+            nodeState = ATOMIC_OP::getIntAcquire(&nextRead->d_state);
+            if (e_WRITABLE == nodeState) {
+                bslmt::LockGuard<MUTEX> lock(&d_readMutex);
+                nodeState = ATOMIC_OP::swapIntAcqRel(&nextRead->d_state,
+                                                     e_WRITABLE_AND_BLOCKED);
+                while (e_READABLE != nodeState && e_RECLAIM != nodeState) {
+                    if (generation !=
+                              ATOMIC_OP::getUintAcquire(&d_popFrontDisabled)) {
+                        return e_DISABLED;                            // RETURN
+                    }
+                    d_readCondition.wait(&d_readMutex);
+                    nodeState = ATOMIC_OP::getIntAcquire(&nextRead->d_state);
+                }
+            }
+        }
+
+        Node *next = static_cast<Node *>(
+                                 ATOMIC_OP::getPtrAcquire(&nextRead->d_next));
+
+        if (e_RECLAIM == nodeState) {
+            ATOMIC_OP::setIntRelease(&nextRead->d_state, e_WRITABLE);
+            guard.advance(next, true);
+            continue;                                               // CONTINUE
+        }
+
+        // Note that, should the assignment throw, the node remains readable.
+
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+        values[*numPopped] = bslmf::MovableRefUtil::move(
+                                                  nextRead->d_value.object());
+#else
+        values[*numPopped] = nextRead->d_value.object();
+#endif
+        ++*numPopped;
+
+        nextRead->d_value.object().~TYPE();
+        ATOMIC_OP::setIntRelease(&nextRead->d_state, e_WRITABLE);
+        guard.advance(next, false);
+    }
+
+    return 0 < *numPopped ? 0 : e_EMPTY;
+}
+
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+void SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
+                          ::popRangeComplete(Node               *nextRead,
+                                             bsls::Types::Int64  numNodes,
+                                             bsls::Types::Int64  numReclaimed)
+{
+    if (0 == numNodes) {
+        return;                                                       // RETURN
+    }
+
+    ATOMIC_OP::setPtrRelease(&d_nextRead, nextRead);
+
+    if (numReclaimed) {
+        ATOMIC_OP::addInt64AcqRel(&d_capacity, numReclaimed);
+    }
+
+    bsls::Types::Int64 state = ATOMIC_OP::addInt64NvAcqRel(
+                                                   &d_state,
+                                                   k_AVAILABLE_INC * numNodes);
+
+    if (ATOMIC_OP::getInt64Acquire(&d_capacity) == available(state)) {
+        {
+            bslmt::LockGuard<MUTEX> guard(&d_emptyMutex);
+        }
+        d_emptyCondition.broadcast();
+    }
+}
+
 template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
 typename SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::Node *
                      SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
@@ -754,6 +1144,114 @@ typename SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::Node *
     return nextWrite;
 }
 
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+typename SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::Node *
+                     SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
+                                    ::pushBackRangeHelper(bsl::size_t numNodes)
+{
+    BSLS_ASSERT(0 < numNodes);
+    BSLS_ASSERT(numNodes <= k_MAX_RANGE_SIZE);
+
+    const bsls::Types::Int64 reserve =
+                   k_AVAILABLE_INC * static_cast<bsls::Types::Int64>(numNodes);
+
+    // Reserve all the nodes with one atomic operation, as done for one node
+    // by the fast path of 'pushBackHelper'.
+
+    bsls::Types::Int64 state = ATOMIC_OP::addInt64NvAcqRel(
+                                                          &d_state,
+                                                          k_USE_INC - reserve);
+
+    if (0 > state || 0 < (state & k_ALLOCATE_MASK)) {
+
+        // Too few nodes are available, or nodes are being allocated; undo the
+        // reservation entirely (the caller pushes the values individually).
+
+        state = ATOMIC_OP::addInt64NvAcqRel(&d_state, reserve - k_USE_INC);
+
+        // The reservation may have hidden the queue becoming empty from a
+        // concurrent 'popComplete'.
+
+        if (ATOMIC_OP::getInt64Acquire(&d_capacity) == available(state)) {
+            {
+                bslmt::LockGuard<MUTEX> guard(&d_emptyMutex);
+            }
+            d_emptyCondition.broadcast();
+        }
+
+        return 0;                                                     // RETURN
+    }
+
+    // Note that there are no threads attempting to allocate new nodes, so the
+    // links between the available nodes do not change.
+
+    Node *nextWrite = static_cast<Node *>(
+                                       ATOMIC_OP::getPtrAcquire(&d_nextWrite));
+    Node *expNextWrite;
+    do {
+        expNextWrite = nextWrite;
+
+        Node *next = nextWrite;
+        for (bsl::size_t i = 0; i < numNodes; ++i) {
+            next = static_cast<Node *>(
+                                     ATOMIC_OP::getPtrAcquire(&next->d_next));
+        }
+
+        nextWrite = static_cast<Node *>(ATOMIC_OP::testAndSwapPtrAcqRel(
+                                                                  &d_nextWrite,
+                                                                  nextWrite,
+                                                                  next));
+    } while (nextWrite != expNextWrite);
+
+    ATOMIC_OP::addInt64AcqRel(&d_state, -k_USE_INC);
+
+    return nextWrite;
+}
+
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+void SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
+                                   ::pushRangeComplete(Node        *first,
+                                                       bsl::size_t  numWritten,
+                                                       bsl::size_t  numNodes)
+{
+    // Nodes not written (due to an exception) are marked for reclamation, as
+    // done by 'markReclaim'.
+
+    if (numWritten < numNodes) {
+        ATOMIC_OP::addInt64AcqRel(
+                  &d_capacity,
+                  -static_cast<bsls::Types::Int64>(numNodes - numWritten));
+    }
+
+    bool isBlocked = false;
+
+    Node *node = first;
+    for (bsl::size_t i = 0; i < numNodes; ++i) {
+
+        // Note that the link to the next node must be read before the node is
+        // made readable, after which the node may be reused.
+
+        Node *next = static_cast<Node *>(ATOMIC_OP::getPtrAcquire(
+                                                              &node->d_next));
+
+        int nodeState = ATOMIC_OP::swapIntAcqRel(
+                                      &node->d_state,
+                                      i < numWritten ? e_READABLE : e_RECLAIM);
+        if (e_WRITABLE_AND_BLOCKED == nodeState) {
+            isBlocked = true;
+        }
+
+        node = next;
+    }
+
+    if (isBlocked) {
+        {
+            bslmt::LockGuard<MUTEX> guard(&d_readMutex);
+        }
+        d_readCondition.signal();
+    }
+}
+
 template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
 void SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
                      ::incrementUntil(AtomicUint *value, unsigned int bitValue)
@@ -1019,6 +1517,81 @@ int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::pushBack(
     return 0;
 }
 
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+inline
+int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::popFrontRange(
+                                                  bsl::size_t *numPopped,
+                                                  TYPE        *values,
+                                                  bsl::size_t  maxNumValues)
+{
+    return popFrontRangeImp(numPopped, values, maxNumValues, false);
+}
+
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::pushBackRange(
+                                                     bsl::size_t *numPushed,
+                                                     const TYPE  *values,
+                                                     bsl::size_t  numValues)
+{
+    BSLS_ASSERT(numPushed);
+    BSLS_ASSERT(values || 0 == numValues);
+
+    *numPushed = 0;
+
+    if (1 == (ATOMIC_OP::getUintAcquire(&d_pushBackDisabled) & 1)) {
+        return e_DISABLED;                                            // RETURN
+    }
+
+    while (*numPushed < numValues) {
+        if (1 == (ATOMIC_OP::getUintAcquire(&d_pushBackDisabled) & 1)) {
+            return e_DISABLED;                                        // RETURN
+        }
+
+        const bsl::size_t  count = numValues - *numPushed < k_MAX_RANGE_SIZE
+                                 ? numValues - *numPushed
+                                 : k_MAX_RANGE_SIZE;
+        const TYPE        *range = values + *numPushed;
+
+        Node *node = pushBackRangeHelper(count);
+
+        if (0 == node) {
+            for (bsl::size_t i = 0; i < count; ++i) {
+                int rv = pushBack(range[i]);
+                if (rv) {
+                    return rv;                                        // RETURN
+                }
+                ++*numPushed;
+            }
+            continue;                                               // CONTINUE
+        }
+
+        SingleConsumerQueueImpl_PushRangeCompleteGuard<
+                                            SingleConsumerQueueImpl<TYPE,
+                                                                    ATOMIC_OP,
+                                                                    MUTEX,
+                                                                    CONDITION>,
+                                            Node> guard(this, node, count);
+
+        for (bsl::size_t i = 0; i < count; ++i) {
+
+            // Note that the reserved nodes are not yet readable, so their
+            // links are stable.
+
+            bslalg::ScalarPrimitives::copyConstruct(node->d_value.address(),
+                                                    range[i],
+                                                    d_allocator_p);
+            guard.advance();
+
+            node = static_cast<Node *>(
+                                     ATOMIC_OP::getPtrAcquire(&node->d_next));
+        }
+
+        *numPushed += count;
+    }
+
+    return e_SUCCESS;
+}
+
 template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
 void SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::removeAll()
 {
@@ -1092,6 +1665,16 @@ int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::tryPopFront(
     return 0;
 }
 
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+inline
+int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
+                                  ::tryPopFrontRange(bsl::size_t *numPopped,
+                                                     TYPE        *values,
+                                                     bsl::size_t  maxNumValues)
+{
+    return popFrontRangeImp(numPopped, values, maxNumValues, true);
+}
+
 template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
 int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::tryPushBack(
                                                              const TYPE& value)
@@ -1106,6 +1689,16 @@ int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::tryPushBack(
     return pushBack(bslmf::MovableRefUtil::move(value));
 }
 
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+inline
+int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
+                                    ::tryPushBackRange(bsl::size_t *numPushed,
+                                                       const TYPE  *values,
+                                                       bsl::size_t  numValues)
+{
+    return pushBackRange(numPushed, values, numValues);
+}
+
                        // Enqueue/Dequeue State
 
 template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
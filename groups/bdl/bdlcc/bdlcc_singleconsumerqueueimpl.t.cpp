@@ -26,6 +26,7 @@
 #include <bsltf_moveonlyalloctesttype.h>
 #include <bsltf_movablealloctesttype.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_cstring.h>
 #include <bsl_cstdlib.h>
 #include <bsl_iostream.h>
@@ -79,10 +80,14 @@ using namespace bsl;
 // [ 2] int popFront(TYPE *value);
 // [ 2] int pushBack(const TYPE& value);
 // [10] int pushBack(bslmf::MovableRef<TYPE> value);
+// [13] int popFrontRange(size_t *num, TYPE *values, size_t max);
+// [13] int pushBackRange(size_t *num, const TYPE *values, size_t n);
 // [ 2] void removeAll();
 // [ 8] int tryPopFront(TYPE *value);
+// [13] int tryPopFrontRange(size_t *num, TYPE *values, size_t max);
 // [ 7] int tryPushBack(const TYPE& value);
 // [10] int tryPushBack(bslmf::MovableRef<TYPE> value);
+// [13] int tryPushBackRange(size_t *num, const TYPE *values, size_t n);
 // [ 6] void disablePopFront();
 // [ 6] void disablePushBack();
 // [ 6] void enablePopFront();
@@ -617,6 +622,39 @@ extern "C" void *watchdog(void *)
     return 0;
 }
 
+struct RangePushData {
+    // Data for a thread pushing the integers
+    // '[d_first .. d_first + d_numValues)' in ranges of 'd_rangeSize'
+    // elements.
+
+    Obj *d_obj_p;
+    int  d_first;
+    int  d_numValues;
+    int  d_rangeSize;
+};
+
+extern "C" void *rangePush(void *arg)
+{
+    RangePushData& data = *static_cast<RangePushData *>(arg);
+
+    bsl::vector<int> values(data.d_rangeSize);
+
+    for (int i = 0; i < data.d_numValues; i += data.d_rangeSize) {
+        const int count = bsl::min(data.d_rangeSize, data.d_numValues - i);
+        for (int j = 0; j < count; ++j) {
+            values[j] = data.d_first + i + j;
+        }
+
+        bsl::size_t numPushed = 0;
+        ASSERT(0 == data.d_obj_p->pushBackRange(&numPushed,
+                                                values.data(),
+                                                count));
+        ASSERT(static_cast<bsl::size_t>(count) == numPushed);
+    }
+
+    return 0;
+}
+
 void orderingGuaranteeTest(const int numPushThread, const int numPopThread)
 {
     bslmt::ThreadUtil::Handle              watchdogHandle;
@@ -805,6 +843,275 @@ int main(int argc, char *argv[])
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 13: {
+        // --------------------------------------------------------------------
+        // TESTING RANGE OPERATIONS
+        //
+        // Concerns:
+        //: 1 'pushBackRange' and 'tryPushBackRange' append all the values, in
+        //:   order, whether or not enough nodes are available to reserve the
+        //:   range at once, and do not allocate memory if enough nodes are
+        //:   available.
+        //:
+        //: 2 'popFrontRange' and 'tryPopFrontRange' remove up to the
+        //:   requested number of values, in order, and 'tryPopFrontRange'
+        //:   returns 'e_EMPTY' if the queue is empty.
+        //:
+        //: 3 The range methods return 'e_DISABLED' when the queue is
+        //:   disabled.
+        //:
+        //: 4 An exception thrown while copying a value into the queue leaves
+        //:   the queue consistent: the values reported as pushed are popped,
+        //:   and nodes left unwritten are skipped and reclaimed.
+        //:
+        //: 5 Concurrent range operations deliver each value exactly once, and
+        //:   values from one producer in order, and a consumer blocked in
+        //:   'popFrontRange' is woken.
+        //
+        // Plan:
+        //: 1 Exercise the range methods on a queue of 'int' in a single
+        //:   thread, verifying return values, counts, values, and memory
+        //:   allocation.  (C-1..3)
+        //:
+        //: 2 Using a queue of 'bsl::string' supplied with a test allocator,
+        //:   push a range of values within the
+        //:   'BSLMA_TESTALLOCATOR_EXCEPTION_TEST_*' macros, and verify that
+        //:   the values then popped with 'tryPopFrontRange' are a sequence of
+        //:   prefixes of the range ending with the complete range.  (C-4)
+        //:
+        //: 3 Create several threads pushing disjoint sequences of values with
+        //:   'pushBackRange', and pop all the values with 'popFrontRange';
+        //:   verify the popped values.  (C-5)
+        //
+        // Testing:
+        //   int popFrontRange(size_t *num, TYPE *values, size_t max);
+        //   int pushBackRange(size_t *num, const TYPE *values, size_t n);
+        //   int tryPopFrontRange(size_t *num, TYPE *values, size_t max);
+        //   int tryPushBackRange(size_t *num, const TYPE *values, size_t n);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING RANGE OPERATIONS" << endl
+                          << "========================" << endl;
+
+        if (verbose) cout << "\nSingle-threaded operations." << endl;
+        {
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            Obj mX(&sa);  const Obj& X = mX;
+
+            const int VALUES[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 };
+
+            int         values[16];
+            bsl::size_t numPushed = 99;
+            bsl::size_t numPopped = 99;
+
+            ASSERT(e_SUCCESS == mX.pushBackRange(&numPushed, VALUES, 0));
+            ASSERT(0         == numPushed);
+
+            // No node is available: the values are pushed individually.
+
+            ASSERT(e_SUCCESS == mX.pushBackRange(&numPushed, VALUES, 5));
+            ASSERT(5         == numPushed);
+            ASSERT(5         == X.numElements());
+
+            ASSERT(e_SUCCESS == mX.popFrontRange(&numPopped, values, 3));
+            ASSERT(3         == numPopped);
+            for (int i = 0; i < 3; ++i) {
+                ASSERTV(i, values[i], i == values[i]);
+            }
+
+            ASSERT(e_SUCCESS == mX.tryPopFrontRange(&numPopped, values, 16));
+            ASSERT(2         == numPopped);
+            ASSERT(3         == values[0]);
+            ASSERT(4         == values[1]);
+            ASSERT(X.isEmpty());
+
+            ASSERT(e_EMPTY   == mX.tryPopFrontRange(&numPopped, values, 16));
+            ASSERT(0         == numPopped);
+
+            // Enough nodes are available: the range is reserved at once.
+
+            bsls::Types::Int64 allocations = sa.numAllocations();
+
+            ASSERT(e_SUCCESS == mX.tryPushBackRange(&numPushed, VALUES, 5));
+            ASSERT(5         == numPushed);
+            ASSERT(5         == X.numElements());
+            ASSERT(allocations == sa.numAllocations());
+
+            ASSERT(e_SUCCESS == mX.popFrontRange(&numPopped, values, 16));
+            ASSERT(5         == numPopped);
+            for (int i = 0; i < 5; ++i) {
+                ASSERTV(i, values[i], i == values[i]);
+            }
+            ASSERT(X.isEmpty());
+
+            // Too few nodes are available.
+
+            ASSERT(e_SUCCESS == mX.pushBackRange(&numPushed, VALUES, 12));
+            ASSERT(12        == numPushed);
+            ASSERT(12        == X.numElements());
+            ASSERT(allocations < sa.numAllocations());
+
+            ASSERT(e_SUCCESS == mX.popFrontRange(&numPopped, values, 16));
+            ASSERT(12        == numPopped);
+            for (int i = 0; i < 12; ++i) {
+                ASSERTV(i, values[i], i == values[i]);
+            }
+            ASSERT(X.isEmpty());
+            ASSERT(e_SUCCESS == X.waitUntilEmpty());
+
+            mX.disablePushBack();
+
+            ASSERT(e_DISABLED == mX.pushBackRange(&numPushed, VALUES, 3));
+            ASSERT(0          == numPushed);
+            ASSERT(e_DISABLED == mX.tryPushBackRange(&numPushed, VALUES, 3));
+            ASSERT(0          == numPushed);
+
+            mX.enablePushBack();
+            mX.pushBack(0);
+            mX.disablePopFront();
+
+            ASSERT(e_DISABLED == mX.popFrontRange(&numPopped, values, 16));
+            ASSERT(0          == numPopped);
+            ASSERT(e_DISABLED == mX.tryPopFrontRange(&numPopped, values, 16));
+            ASSERT(0          == numPopped);
+        }
+
+        if (verbose) cout << "\nException safety." << endl;
+        {
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            AllocObj mX(16, &sa);  const AllocObj& X = mX;
+
+            const char *DATA[] = {
+                "a string long enough to allocate memory: 0",
+                "a string long enough to allocate memory: 1",
+                "a string long enough to allocate memory: 2",
+                "a string long enough to allocate memory: 3",
+                "a string long enough to allocate memory: 4"
+            };
+            const bsl::size_t NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            bsl::vector<bsl::string> values(&sa);
+            for (bsl::size_t i = 0; i < NUM_DATA; ++i) {
+                values.push_back(DATA[i]);
+            }
+
+            // Note that, once the nodes reserved by the failed attempts
+            // exhaust the available nodes, the values are pushed
+            // individually.
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(sa) {
+                bsl::size_t numPushed = 0;
+                ASSERT(0 == mX.pushBackRange(&numPushed,
+                                             values.data(),
+                                             NUM_DATA));
+                ASSERT(NUM_DATA == numPushed);
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            bsl::vector<bsl::string> result(&sa);
+            {
+                bsl::string buffer[3] = { bsl::string(&sa),
+                                          bsl::string(&sa),
+                                          bsl::string(&sa) };
+                bsl::size_t numPopped;
+                while (0 == mX.tryPopFrontRange(&numPopped, buffer, 3)) {
+                    result.insert(result.end(), buffer, buffer + numPopped);
+                }
+            }
+
+            ASSERT(X.isEmpty());
+            ASSERT(0 == X.numElements());
+
+            ASSERTV(result.size(), NUM_DATA <= result.size());
+
+            bsl::size_t expected = 0;
+            for (bsl::size_t i = 0; i < result.size(); ++i) {
+                if (values[0] == result[i]) {
+                    expected = 0;
+                }
+                ASSERTV(i, expected < NUM_DATA);
+                if (expected < NUM_DATA) {
+                    ASSERTV(i, result[i], values[expected] == result[i]);
+                }
+                ++expected;
+            }
+            ASSERTV(expected, NUM_DATA == expected);
+        }
+
+        if (verbose) cout << "\nConcurrent operations." << endl;
+        {
+            enum {
+                k_NUM_THREADS = 4,
+                k_NUM_VALUES  = 10000  // per thread
+            };
+
+            static const int RANGE_SIZES[] = { 1, 7, 64 };
+
+            bslmt::ThreadUtil::Handle watchdogHandle;
+
+            s_continue = 1;
+
+            setWatchdogText("range operations");
+            bslmt::ThreadUtil::create(&watchdogHandle, watchdog, 0);
+
+            for (int ri = 0; ri < 3; ++ri) {
+                const int RANGE_SIZE = RANGE_SIZES[ri];
+
+                if (veryVerbose) { T_ P(RANGE_SIZE) }
+
+                Obj mX;  const Obj& X = mX;
+
+                bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+                RangePushData             data[k_NUM_THREADS];
+
+                for (int i = 0; i < k_NUM_THREADS; ++i) {
+                    data[i].d_obj_p     = &mX;
+                    data[i].d_first     = i * k_NUM_VALUES;
+                    data[i].d_numValues = k_NUM_VALUES;
+                    data[i].d_rangeSize = RANGE_SIZE;
+
+                    bslmt::ThreadUtil::create(&handles[i],
+                                              rangePush,
+                                              &data[i]);
+                }
+
+                bsl::vector<int> last(k_NUM_THREADS, -1);
+                bsl::vector<int> values(RANGE_SIZE);
+
+                int numPopped = 0;
+                while (numPopped < k_NUM_THREADS * k_NUM_VALUES) {
+                    bsl::size_t count = 0;
+                    ASSERT(0 == mX.popFrontRange(&count,
+                                                 values.data(),
+                                                 RANGE_SIZE));
+                    ASSERT(0 < count);
+
+                    for (bsl::size_t i = 0; i < count; ++i) {
+                        const int value  = values[i];
+                        const int thread = value / k_NUM_VALUES;
+                        ASSERTV(RANGE_SIZE, value, last[thread] + 1 == value
+                                   || (-1 == last[thread]
+                                       && thread * k_NUM_VALUES == value));
+                        last[thread] = value;
+                    }
+                    numPopped += static_cast<int>(count);
+                }
+
+                for (int i = 0; i < k_NUM_THREADS; ++i) {
+                    bslmt::ThreadUtil::join(handles[i]);
+                    ASSERTV(i, last[i], (i + 1) * k_NUM_VALUES - 1 == last[i]);
+                }
+
+                ASSERT(X.isEmpty());
+            }
+
+            s_continue = 0;
+
+            bslmt::ThreadUtil::join(watchdogHandle);
+        }
+      } break;
       case 12: {
         // ---------------------------------------------------------
         // Ordering Guarantee Test
@@ -32,6 +32,12 @@ BSLS_IDENT("$Id: $")
 // value, if the queue is full.  The 'tryPopFront' method fails immediately,
 // returning a non-zero value, if the queue is empty.
 //
+// The methods 'pushBackRange' and 'popFrontRange' (and their "try" variants)
+// transfer a sequence of elements at once.  The elements are written to (or
+// read from) consecutive nodes and the nodes are then published together: the
+// index shared with the other thread is updated, and the other thread is
+// woken if blocked, once per sequence rather than once per element.
+//
 // The queue may be placed into a "enqueue disabled" state using the
 // 'disablePushBack' method.  When disabled, 'pushBack' and 'tryPushBack' fail
 // immediately and return an error code.  Any threads blocked in 'pushBack'
@@ -60,7 +66,10 @@ BSLS_IDENT("$Id: $")
 ///----------------
 // A 'bdlcc::SingleProducerSingleConsumerBoundedQueue' is exception neutral,
 // and all of the methods of 'bdlcc::SingleProducerSingleConsumerBoundedQueue'
-// provide the strong exception safety guarantee (see 'bsldoc_glossary').
+// provide the strong exception safety guarantee (see 'bsldoc_glossary'),
+// except for the range methods, which provide the basic guarantee: if an
+// exception is thrown while copying (or assigning) an element, the elements
+// transferred before it remain transferred.
 //
 ///Move Semantics in C++03
 ///-----------------------
@@ -210,7 +219,7 @@ class SingleProducerSingleConsumerBoundedQueue_PopCompleteGuard {
     // 'NODE' upon destruction.
 
     // PRIVATE TYPES
-    typedef typename bsls::Types::Uint64 Uint64;
+    typedef bsls::Types::Uint64 Uint64;
 
     // DATA
     TYPE   *d_queue_p;  // managed queue owning the managed node
@@ -236,6 +245,54 @@ class SingleProducerSingleConsumerBoundedQueue_PopCompleteGuard {
         // Destroy this object and invoke the 'TYPE::popComplete'.
 };
 
+   // ====================================================================
+   // class SingleProducerSingleConsumerBoundedQueue_RangeCompleteGuard
+   // ====================================================================
+
+template <class TYPE>
+class SingleProducerSingleConsumerBoundedQueue_RangeCompleteGuard {
+    // This class implements a guard that counts the nodes transferred by a
+    // "range" operation and, upon destruction, invokes
+    // 'TYPE::popRangeComplete' or 'TYPE::pushRangeComplete' (as indicated at
+    // construction) with the number of transferred nodes.
+
+    // PRIVATE TYPES
+    typedef bsls::Types::Uint64 Uint64;
+
+    // DATA
+    TYPE   *d_queue_p;   // managed queue
+    Uint64  d_index;     // index of the first transferred node
+    Uint64  d_numNodes;  // number of transferred nodes
+    bool    d_isPop;     // 'true' for a "pop" operation
+
+    // NOT IMPLEMENTED
+    SingleProducerSingleConsumerBoundedQueue_RangeCompleteGuard();
+    SingleProducerSingleConsumerBoundedQueue_RangeCompleteGuard(
+           const SingleProducerSingleConsumerBoundedQueue_RangeCompleteGuard&);
+    SingleProducerSingleConsumerBoundedQueue_RangeCompleteGuard& operator=(
+           const SingleProducerSingleConsumerBoundedQueue_RangeCompleteGuard&);
+
+  public:
+    // CREATORS
+    SingleProducerSingleConsumerBoundedQueue_RangeCompleteGuard(
+                                                          TYPE   *queue,
+                                                          Uint64  index,
+                                                          bool    isPop);
+        // Create a guard managing the specified 'queue' for a "range"
+        // operation starting at the node having the specified 'index', that
+        // is a "pop" operation if the specified 'isPop' is 'true', and a
+        // "push" operation otherwise.
+
+    ~SingleProducerSingleConsumerBoundedQueue_RangeCompleteGuard();
+        // Destroy this object and invoke 'TYPE::popRangeComplete' or
+        // 'TYPE::pushRangeComplete' with the index of the first node and the
+        // number of transferred nodes.
+
+    // MANIPULATORS
+    void advance();
+        // Count the next node as transferred.
+};
+
               // ==============================================
               // class SingleProducerSingleConsumerBoundedQueue
               // ==============================================
@@ -372,6 +429,9 @@ class SingleProducerSingleConsumerBoundedQueue {
                 SingleProducerSingleConsumerBoundedQueue<TYPE>,
                 typename SingleProducerSingleConsumerBoundedQueue<TYPE>::Node>;
 
+    friend class SingleProducerSingleConsumerBoundedQueue_RangeCompleteGuard<
+                              SingleProducerSingleConsumerBoundedQueue<TYPE> >;
+
     // PRIVATE CLASS METHODS
     static void incrementUntil(AtomicUint *value, unsigned int bitValue);
         // If the specified 'value' does not have its lowest-order bit set to
@@ -388,6 +448,27 @@ class SingleProducerSingleConsumerBoundedQueue {
         // used within 'popFrontImp' by a guard to complete the reclamation of
         // a node in the presence of an exception.
 
+    int popFrontRangeImp(bsl::size_t *numPopped,
+                         TYPE        *values,
+                         bsl::size_t  maxNumValues,
+                         bool         isTry);
+        // Implement 'popFrontRange' if the specified 'isTry' is 'false', and
+        // 'tryPopFrontRange' otherwise, with the specified 'numPopped',
+        // 'values', and 'maxNumValues'.
+
+    bsl::size_t popFrontRangeHelper(TYPE *values, bsl::size_t maxNumValues);
+        // Remove the elements of the readable nodes at the front of this
+        // queue, up to the specified 'maxNumValues' elements, assign them, in
+        // order, to the array starting at the specified 'values', and return
+        // the number of removed elements.  This method does not block.
+
+    void popRangeComplete(Uint64 index, Uint64 numNodes);
+        // Mark the specified 'numNodes' consecutive nodes starting at the
+        // specified 'index', whose values were destroyed, writable, update
+        // 'd_popIndex', unblock the blocked "push" thread, if any, and if the
+        // queue is empty update the empty generation and signal the queue
+        // empty condition.
+
     int popFrontImp(TYPE *value, bool isTry);
         // If the specified 'isTry' is 'false', remove the element from the
         // front of this queue and load that element into the specified
@@ -432,6 +513,26 @@ class SingleProducerSingleConsumerBoundedQueue {
         // location to be used after specified 'index' location.  This method
         // is invoked from 'pushBackImp'.
 
+    int pushBackRangeImp(bsl::size_t *numPushed,
+                         const TYPE  *values,
+                         bsl::size_t  numValues,
+                         bool         isTry);
+        // Implement 'pushBackRange' if the specified 'isTry' is 'false', and
+        // 'tryPushBackRange' otherwise, with the specified 'numPushed',
+        // 'values', and 'numValues'.
+
+    bsl::size_t pushBackRangeHelper(const TYPE  *values,
+                                    bsl::size_t  numValues);
+        // Append, to the writable nodes at the back of this queue, up to the
+        // specified 'numValues' elements of the array starting at the
+        // specified 'values', in order, and return the number of appended
+        // elements.  This method does not block.
+
+    void pushRangeComplete(Uint64 index, Uint64 numNodes);
+        // Mark the specified 'numNodes' consecutive nodes starting at the
+        // specified 'index', whose values were written, readable, signal
+        // 'd_popCondition' (once) if necessary, and update 'd_pushIndex'.
+
     // NOT IMPLEMENTED
     SingleProducerSingleConsumerBoundedQueue(
                               const SingleProducerSingleConsumerBoundedQueue&);
@@ -500,6 +601,38 @@ class SingleProducerSingleConsumerBoundedQueue {
         // behavior is undefined unless the invoker of this method is the
         // single producer.
 
+    int popFrontRange(bsl::size_t *numPopped,
+                      TYPE        *values,
+                      bsl::size_t  maxNumValues);
+        // Remove up to the specified 'maxNumValues' elements from the front of
+        // this queue, assign them, in order, to the array starting at the
+        // specified 'values', and load into the specified 'numPopped' the
+        // number of removed elements.  If the queue is empty, block until it
+        // is not empty.  Return 0 on success, and a non-zero value otherwise.
+        // Specifically, return 'e_SUCCESS' on success, 'e_DISABLED' if
+        // 'isPopFrontDisabled()' and 'e_FAILED' if an underlying mechanism
+        // returns an error.  On failure, '0 == *numPopped'.  Threads blocked
+        // due to the queue being empty will return 'e_DISABLED' if
+        // 'disablePopFront' is invoked.  The behavior is undefined unless
+        // '0 < maxNumValues', 'values' refers to an array of at least
+        // 'maxNumValues' elements, and the invoker of this method is the
+        // single consumer.
+
+    int pushBackRange(bsl::size_t *numPushed,
+                      const TYPE  *values,
+                      bsl::size_t  numValues);
+        // Append the specified 'numValues' elements of the array starting at
+        // the specified 'values', in order, to the back of this queue, and
+        // load into the specified 'numPushed' the number of appended elements.
+        // Block while the queue is full.  Return 0 on success, and a non-zero
+        // value otherwise.  Specifically, return 'e_SUCCESS' on success,
+        // 'e_DISABLED' if 'isPushBackDisabled()' and 'e_FAILED' if an
+        // underlying mechanism returns an error.  On failure, only the first
+        // '*numPushed' elements were appended.  Threads blocked due to the
+        // queue being full will return 'e_DISABLED' if 'disablePushFront' is
+        // invoked.  The behavior is undefined unless the invoker of this
+        // method is the single producer.
+
     void removeAll();
         // Remove all items currently in this queue.  Note that this operation
         // is not atomic; if other threads are concurrently pushing items into
@@ -517,6 +650,21 @@ class SingleProducerSingleConsumerBoundedQueue {
         // 'value' is not changed.  The behavior is undefined unless the
         // invoker of this method is the single consumer.
 
+    int tryPopFrontRange(bsl::size_t *numPopped,
+                         TYPE        *values,
+                         bsl::size_t  maxNumValues);
+        // Attempt to remove up to the specified 'maxNumValues' elements from
+        // the front of this queue without blocking, assign them, in order, to
+        // the array starting at the specified 'values', and load into the
+        // specified 'numPopped' the number of removed elements.  Return 0 on
+        // success, and a non-zero value otherwise.  Specifically, return
+        // 'e_SUCCESS' on success, 'e_DISABLED' if 'isPopFrontDisabled()', and
+        // 'e_EMPTY' if '!isPopFrontDisabled()' and the queue was empty.  On
+        // failure, '0 == *numPopped'.  The behavior is undefined unless
+        // '0 < maxNumValues', 'values' refers to an array of at least
+        // 'maxNumValues' elements, and the invoker of this method is the
+        // single consumer.
+
     int tryPushBack(const TYPE& value);
         // Append the specified 'value' to the back of this queue.  Return 0 on
         // success, and a non-zero value otherwise.  Specifically, return
@@ -534,6 +682,20 @@ class SingleProducerSingleConsumerBoundedQueue {
         // failure, 'value' is not changed.  The behavior is undefined unless
         // the invoker of this method is the single producer.
 
+    int tryPushBackRange(bsl::size_t *numPushed,
+                         const TYPE  *values,
+                         bsl::size_t  numValues);
+        // Attempt to append the specified 'numValues' elements of the array
+        // starting at the specified 'values', in order, to the back of this
+        // queue without blocking, and load into the specified 'numPushed' the
+        // number of appended elements, which is less than 'numValues' if the
+        // queue becomes full.  Return 0 on success, and a non-zero value
+        // otherwise.  Specifically, return 'e_SUCCESS' on success (including
+        // if only part of the elements were appended), 'e_DISABLED' if
+        // 'isPushBackDisabled()', and 'e_FULL' if '!isPushBackDisabled()',
+        // '0 < numValues', and the queue was full.  The behavior is undefined
+        // unless the invoker of this method is the single producer.
+
                        // Enqueue/Dequeue State
 
     void disablePopFront();
@@ -625,6 +787,47 @@ SingleProducerSingleConsumerBoundedQueue_PopCompleteGuard<TYPE, NODE>
     d_queue_p->popComplete(d_node_p, d_index);
 }
 
+   // --------------------------------------------------------------------
+   // class SingleProducerSingleConsumerBoundedQueue_RangeCompleteGuard
+   // --------------------------------------------------------------------
+
+// CREATORS
+template <class TYPE>
+inline
+SingleProducerSingleConsumerBoundedQueue_RangeCompleteGuard<TYPE>
+                 ::SingleProducerSingleConsumerBoundedQueue_RangeCompleteGuard(
+                                                                 TYPE   *queue,
+                                                                 Uint64  index,
+                                                                 bool    isPop)
+: d_queue_p(queue)
+, d_index(index)
+, d_numNodes(0)
+, d_isPop(isPop)
+{
+}
+
+template <class TYPE>
+inline
+SingleProducerSingleConsumerBoundedQueue_RangeCompleteGuard<TYPE>
+               ::~SingleProducerSingleConsumerBoundedQueue_RangeCompleteGuard()
+{
+    if (d_isPop) {
+        d_queue_p->popRangeComplete(d_index, d_numNodes);
+    }
+    else {
+        d_queue_p->pushRangeComplete(d_index, d_numNodes);
+    }
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+void SingleProducerSingleConsumerBoundedQueue_RangeCompleteGuard<TYPE>
+                                                                   ::advance()
+{
+    ++d_numNodes;
+}
+
               // ----------------------------------------------
               // class SingleProducerSingleConsumerBoundedQueue
               // ----------------------------------------------
@@ -680,6 +883,141 @@ void SingleProducerSingleConsumerBoundedQueue<TYPE>::popComplete(Node   *node,
     }
 }
 
+template <class TYPE>
+int SingleProducerSingleConsumerBoundedQueue<TYPE>::popFrontRangeImp(
+                                                    bsl::size_t *numPopped,
+                                                    TYPE        *values,
+                                                    bsl::size_t  maxNumValues,
+                                                    bool         isTry)
+{
+    BSLS_ASSERT(numPopped);
+    BSLS_ASSERT(values);
+    BSLS_ASSERT(0 < maxNumValues);
+
+    *numPopped = 0;
+
+    if (1 == (AtomicOp::getUintAcquire(&d_popDisabledGeneration) & 1)) {
+        return e_DISABLED;                                            // RETURN
+    }
+
+    bsl::size_t count = popFrontRangeHelper(values, maxNumValues);
+
+    if (0 == count) {
+        if (isTry) {
+            return e_EMPTY;                                           // RETURN
+        }
+
+        // Block until an element is available, then remove the elements
+        // that became readable meanwhile.
+
+        int rv = popFrontImp(values, false);
+        if (rv) {
+            return rv;                                                // RETURN
+        }
+
+        count = 1;
+        if (1 < maxNumValues) {
+            count += popFrontRangeHelper(values + 1, maxNumValues - 1);
+        }
+    }
+
+    *numPopped = count;
+
+    return e_SUCCESS;
+}
+
+template <class TYPE>
+bsl::size_t SingleProducerSingleConsumerBoundedQueue<TYPE>
+                             ::popFrontRangeHelper(TYPE        *values,
+                                                   bsl::size_t  maxNumValues)
+{
+    Uint64 index = AtomicOp::getUint64Acquire(&d_popIndex);
+
+    SingleProducerSingleConsumerBoundedQueue_RangeCompleteGuard<
+               SingleProducerSingleConsumerBoundedQueue<TYPE> > guard(this,
+                                                                      index,
+                                                                      true);
+
+    // Note that the consumed nodes remain readable until 'popRangeComplete',
+    // so at most 'd_popCapacity' nodes are consumed.
+
+    bsl::size_t count = 0;
+    while (count < maxNumValues && count < d_popCapacity) {
+        Node& node = d_popElement_p[index];
+
+        // Note that 'e_WRITABLE_AND_BLOCKED' is not possible since this is the
+        // one consumer.
+
+        if (e_WRITABLE == AtomicOp::getUintAcquire(&node.d_state)) {
+            break;
+        }
+
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+        values[count] = bslmf::MovableRefUtil::move(node.d_value.object());
+#else
+        values[count] = node.d_value.object();
+#endif
+        ++count;
+
+        node.d_value.object().~TYPE();
+        guard.advance();
+
+        ++index;
+        if (index == d_popCapacity) {
+            index = 0;
+        }
+    }
+
+    return count;
+}
+
+template <class TYPE>
+void SingleProducerSingleConsumerBoundedQueue<TYPE>::popRangeComplete(
+                                                             Uint64 index,
+                                                             Uint64 numNodes)
+{
+    if (0 == numNodes) {
+        return;                                                       // RETURN
+    }
+
+    Uint64 endIndex = (index + numNodes) % d_popCapacity;
+
+    AtomicOp::setUint64Release(&d_popIndex, endIndex);
+
+    bool isBlocked = false;
+    for (Uint64 i = 0; i < numNodes; ++i) {
+        Uint nodeState = AtomicOp::swapUintAcqRel(
+                                               &d_popElement_p[index].d_state,
+                                               e_WRITABLE);
+        if (e_READABLE_AND_BLOCKED == nodeState) {
+            isBlocked = true;
+        }
+
+        ++index;
+        if (index == d_popCapacity) {
+            index = 0;
+        }
+    }
+
+    if (isBlocked) {
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_pushMutex);
+        }
+        d_pushCondition.signal();
+    }
+
+    if (e_WRITABLE ==
+                 AtomicOp::getUintAcquire(&d_popElement_p[endIndex].d_state)) {
+        AtomicOp::addUintAcqRel(&d_emptyGeneration, 1);
+        if (0 < AtomicOp::getUintAcquire(&d_emptyCount)) {
+            {
+                bslmt::LockGuard<bslmt::Mutex> guard(&d_emptyMutex);
+            }
+            d_emptyCondition.broadcast();
+        }
+    }
+}
+
 template <class TYPE>
 int SingleProducerSingleConsumerBoundedQueue<TYPE>::popFrontImp(TYPE *value,
                                                                 bool  isTry)
@@ -918,6 +1256,120 @@ void SingleProducerSingleConsumerBoundedQueue<TYPE>::pushComplete(
     AtomicOp::setUint64Release(&d_pushIndex, index);
 }
 
+template <class TYPE>
+int SingleProducerSingleConsumerBoundedQueue<TYPE>::pushBackRangeImp(
+                                                     bsl::size_t *numPushed,
+                                                     const TYPE  *values,
+                                                     bsl::size_t  numValues,
+                                                     bool         isTry)
+{
+    BSLS_ASSERT(numPushed);
+    BSLS_ASSERT(values || 0 == numValues);
+
+    *numPushed = 0;
+
+    if (1 == (AtomicOp::getUintAcquire(&d_pushDisabledGeneration) & 1)) {
+        return e_DISABLED;                                            // RETURN
+    }
+
+    while (*numPushed < numValues) {
+        bsl::size_t count = pushBackRangeHelper(values + *numPushed,
+                                                numValues - *numPushed);
+        *numPushed += count;
+
+        if (0 == count) {
+            if (isTry) {
+                return 0 < *numPushed ? e_SUCCESS : e_FULL;           // RETURN
+            }
+
+            // Block until a node is available.
+
+            int rv = pushBackImp(values[*numPushed], false);
+            if (rv) {
+                return rv;                                            // RETURN
+            }
+            ++*numPushed;
+        }
+    }
+
+    return e_SUCCESS;
+}
+
+template <class TYPE>
+bsl::size_t SingleProducerSingleConsumerBoundedQueue<TYPE>
+                             ::pushBackRangeHelper(const TYPE  *values,
+                                                   bsl::size_t  numValues)
+{
+    Uint64 index = AtomicOp::getUint64Acquire(&d_pushIndex);
+
+    SingleProducerSingleConsumerBoundedQueue_RangeCompleteGuard<
+               SingleProducerSingleConsumerBoundedQueue<TYPE> > guard(this,
+                                                                      index,
+                                                                      false);
+
+    // Note that the written nodes remain writable until 'pushRangeComplete',
+    // so at most 'd_pushCapacity' nodes are written.
+
+    bsl::size_t count = 0;
+    while (count < numValues && count < d_pushCapacity) {
+        Node& node = d_pushElement_p[index];
+
+        // Note that 'e_READABLE_AND_BLOCKED' is not possible since this is the
+        // one producer.
+
+        if (e_READABLE == AtomicOp::getUintAcquire(&node.d_state)) {
+            break;
+        }
+
+        bslalg::ScalarPrimitives::copyConstruct(node.d_value.address(),
+                                                values[count],
+                                                d_allocator_p);
+        ++count;
+        guard.advance();
+
+        ++index;
+        if (index == d_pushCapacity) {
+            index = 0;
+        }
+    }
+
+    return count;
+}
+
+template <class TYPE>
+void SingleProducerSingleConsumerBoundedQueue<TYPE>::pushRangeComplete(
+                                                             Uint64 index,
+                                                             Uint64 numNodes)
+{
+    if (0 == numNodes) {
+        return;                                                       // RETURN
+    }
+
+    bool isBlocked = false;
+    for (Uint64 i = 0; i < numNodes; ++i) {
+        Uint nodeState = AtomicOp::swapUintAcqRel(
+                                              &d_pushElement_p[index].d_state,
+                                              e_READABLE);
+        if (e_WRITABLE_AND_BLOCKED == nodeState) {
+            isBlocked = true;
+        }
+
+        ++index;
+        if (index == d_pushCapacity) {
+            index = 0;
+        }
+    }
+
+    if (isBlocked) {
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_popMutex);
+        }
+        d_popCondition.signal();
+    }
+
+    AtomicOp::setUint64Release(&d_pushIndex, index);
+}
+
 // CREATORS
 template <class TYPE>
 SingleProducerSingleConsumerBoundedQueue<TYPE>::
@@ -987,6 +1439,26 @@ int SingleProducerSingleConsumerBoundedQueue<TYPE>::pushBack(
     return pushBackImp(bslmf::MovableRefUtil::move(value), false);
 }
 
+template <class TYPE>
+inline
+int SingleProducerSingleConsumerBoundedQueue<TYPE>::popFrontRange(
+                                                    bsl::size_t *numPopped,
+                                                    TYPE        *values,
+                                                    bsl::size_t  maxNumValues)
+{
+    return popFrontRangeImp(numPopped, values, maxNumValues, false);
+}
+
+template <class TYPE>
+inline
+int SingleProducerSingleConsumerBoundedQueue<TYPE>::pushBackRange(
+                                                     bsl::size_t *numPushed,
+                                                     const TYPE  *values,
+                                                     bsl::size_t  numValues)
+{
+    return pushBackRangeImp(numPushed, values, numValues, false);
+}
+
 template <class TYPE>
 void SingleProducerSingleConsumerBoundedQueue<TYPE>::removeAll()
 {
@@ -1030,6 +1502,16 @@ int SingleProducerSingleConsumerBoundedQueue<TYPE>::tryPopFront(TYPE *value)
     return popFrontImp(value, true);
 }
 
+template <class TYPE>
+inline
+int SingleProducerSingleConsumerBoundedQueue<TYPE>::tryPopFrontRange(
+                                                    bsl::size_t *numPopped,
+                                                    TYPE        *values,
+                                                    bsl::size_t  maxNumValues)
+{
+    return popFrontRangeImp(numPopped, values, maxNumValues, true);
+}
+
 template <class TYPE>
 inline
 int SingleProducerSingleConsumerBoundedQueue<TYPE>::tryPushBack(
@@ -1046,6 +1528,16 @@ int SingleProducerSingleConsumerBoundedQueue<TYPE>::tryPushBack(
     return pushBackImp(bslmf::MovableRefUtil::move(value), true);
 }
 
+template <class TYPE>
+inline
+int SingleProducerSingleConsumerBoundedQueue<TYPE>::tryPushBackRange(
+                                                     bsl::size_t *numPushed,
+                                                     const TYPE  *values,
+                                                     bsl::size_t  numValues)
+{
+    return pushBackRangeImp(numPushed, values, numValues, true);
+}
+
                        // Enqueue/Dequeue State
 
 template <class TYPE>
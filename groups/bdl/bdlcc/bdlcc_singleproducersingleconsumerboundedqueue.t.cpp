@@ -25,6 +25,7 @@
 #include <bsls_asserttest.h>
 #include <bsls_atomic.h>
 #include <bsls_atomicoperations.h>
+#include <bsls_stopwatch.h>
 #include <bsls_systemtime.h>
 #include <bsls_timeinterval.h>
 #include <bsls_types.h>
@@ -85,10 +86,14 @@ using namespace bsl;
 // [ 2] int popFront(TYPE *value);
 // [ 2] int pushBack(const TYPE& value);
 // [ 9] int pushBack(bslmf::MovableRef<TYPE> value);
+// [12] int popFrontRange(size_t *num, TYPE *values, size_t max);
+// [12] int pushBackRange(size_t *num, const TYPE *values, size_t n);
 // [ 2] void removeAll();
 // [ 7] int tryPopFront(TYPE *value);
+// [12] int tryPopFrontRange(size_t *num, TYPE *values, size_t max);
 // [ 6] int tryPushBack(const TYPE& value);
 // [ 9] int tryPushBack(bslmf::MovableRef<TYPE> value);
+// [12] int tryPushBackRange(size_t *num, const TYPE *values, size_t n);
 // [ 5] void disablePopFront();
 // [ 5] void disablePushBack();
 // [ 5] void enablePopFront();
@@ -102,7 +107,7 @@ using namespace bsl;
 // [ 4] bslma::Allocator *allocator() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [12] USAGE EXAMPLE
+// [13] USAGE EXAMPLE
 // [ 3] Obj& gg(Obj *object, const char *spec);
 // [ 3] int ggg(Obj *object, const char *spec);
 // [ 2] CONCERN: 0 == e_SUCCESS
@@ -110,6 +115,7 @@ using namespace bsl;
 // [ 9] CONCERN: 'popFront' and 'tryPopFront' honor move-semantics
 // [10] CONCERN: template requirements
 // [11] CONCERN: ordering guarantee
+// [-1] PERFORMANCE: RANGE OPERATIONS
 // ----------------------------------------------------------------------------
 
 // ============================================================================
@@ -740,6 +746,85 @@ void orderingGuaranteeTest(const int numPushThread, const int numPopThread)
     bslmt::ThreadUtil::join(watchdogHandle);
 }
 
+struct RangeData {
+    Obj         *d_obj_p;      // queue under test
+    int          d_numValues;  // number of values to transfer
+    bsl::size_t  d_rangeSize;  // elements per range; 0 for per-element
+};
+
+extern "C" void *rangePush(void *arg)
+    // Push, onto the queue of the 'RangeData' at the specified 'arg', the
+    // values '0' to 'd_numValues - 1', in ranges of 'd_rangeSize' elements
+    // ('pushBack' if 'd_rangeSize' is 0).
+{
+    const RangeData& data = *static_cast<RangeData *>(arg);
+
+    if (0 == data.d_rangeSize) {
+        for (int i = 0; i < data.d_numValues; ++i) {
+            data.d_obj_p->pushBack(i);
+        }
+        return 0;                                                     // RETURN
+    }
+
+    bsl::vector<int> values(data.d_rangeSize);
+
+    int next = 0;
+    while (next < data.d_numValues) {
+        bsl::size_t n = 0;
+        while (n < data.d_rangeSize && next < data.d_numValues) {
+            values[n++] = next++;
+        }
+
+        bsl::size_t numPushed;
+        int         rv = data.d_obj_p->pushBackRange(&numPushed,
+                                                     values.data(),
+                                                     n);
+
+        ASSERTV(rv, 0 == rv);
+        ASSERTV(n, numPushed, n == numPushed);
+    }
+
+    return 0;
+}
+
+int rangePop(const RangeData& data)
+    // Pop, from the queue of the specified 'data', 'data.d_numValues' values,
+    // in ranges of up to 'data.d_rangeSize' elements ('popFront' if
+    // 'data.d_rangeSize' is 0), and return the number of values that were not
+    // received in increasing order starting from 0.
+{
+    int numErrors = 0;
+    int expected  = 0;
+
+    if (0 == data.d_rangeSize) {
+        while (expected < data.d_numValues) {
+            int value;
+            data.d_obj_p->popFront(&value);
+            numErrors += expected++ != value;
+        }
+        return numErrors;                                             // RETURN
+    }
+
+    bsl::vector<int> values(data.d_rangeSize);
+
+    while (expected < data.d_numValues) {
+        bsl::size_t numPopped;
+        int         rv = data.d_obj_p->popFrontRange(&numPopped,
+                                                     values.data(),
+                                                     data.d_rangeSize);
+
+        ASSERTV(rv, 0 == rv);
+        ASSERT(0 < numPopped);
+        ASSERT(numPopped <= data.d_rangeSize);
+
+        for (bsl::size_t i = 0; i < numPopped; ++i) {
+            numErrors += expected++ != values[i];
+        }
+    }
+
+    return numErrors;
+}
+
 // ============================================================================
 //               GENERATOR FUNCTIONS 'gg' AND 'ggg' FOR TESTING
 // ----------------------------------------------------------------------------
@@ -954,7 +1039,7 @@ int main(int argc, char *argv[])
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 12: {
+      case 13: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -1026,6 +1111,204 @@ int main(int argc, char *argv[])
 
         orderingGuaranteeTest(1, 1);  // single producer, single consumer
       } break;
+      case 12: {
+        // --------------------------------------------------------------------
+        // RANGE OPERATIONS
+        //
+        // Concerns:
+        //: 1 'pushBackRange' appends the elements, in order, and blocks while
+        //:   the queue is full; 'tryPushBackRange' appends as many elements as
+        //:   fit and fails with 'e_FULL' only if none fits.
+        //:
+        //: 2 'popFrontRange' removes up to the requested number of elements,
+        //:   in order, and blocks while the queue is empty; 'tryPopFrontRange'
+        //:   fails with 'e_EMPTY' if the queue is empty.
+        //:
+        //: 3 The range methods fail with 'e_DISABLED' when the respective
+        //:   operation is disabled.
+        //:
+        //: 4 The ranges wrap around the end of the ring buffer, and the
+        //:   'isEmpty', 'isFull' and 'numElements' accessors agree with the
+        //:   transferred elements.
+        //:
+        //: 5 Concurrent range and per-element operations of one producer and
+        //:   one consumer transfer all elements in order.
+        //:
+        //: 6 Elements are transferred with the allocator of the queue.
+        //
+        // Plan:
+        //: 1 On a queue of capacity 4, push and pop ranges of various sizes
+        //:   from various starting positions, verifying the transferred
+        //:   elements and the accessors.  (C-1..2, 4)
+        //:
+        //: 2 Disable each operation and verify the return values.  (C-3)
+        //:
+        //: 3 Using 'AllocObj', verify the allocator of the elements in the
+        //:   queue.  (C-6)
+        //:
+        //: 4 Run a producer and a consumer thread using every combination of
+        //:   range sizes (0 designating the per-element methods) and verify
+        //:   the received sequence.  (C-5)
+        //
+        // Testing:
+        //   int popFrontRange(size_t *num, TYPE *values, size_t max);
+        //   int pushBackRange(size_t *num, const TYPE *values, size_t n);
+        //   int tryPopFrontRange(size_t *num, TYPE *values, size_t max);
+        //   int tryPushBackRange(size_t *num, const TYPE *values, size_t n);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "RANGE OPERATIONS" << endl
+                          << "================" << endl;
+
+        if (verbose) cout << "\nTesting single-threaded operations." << endl;
+        {
+            const int   VALUES[] = { 1, 2, 3, 4, 5, 6 };
+            int         result[6];
+            bsl::size_t n;
+
+            for (int start = 0; start < 4; ++start) {
+                Obj mX(4);  const Obj& X = mX;
+
+                // Advance the position of the front and back of the queue.
+
+                for (int i = 0; i < start; ++i) {
+                    int value;
+                    mX.pushBack(0);
+                    mX.popFront(&value);
+                }
+
+                ASSERTV(start, Obj::e_EMPTY ==
+                                   mX.tryPopFrontRange(&n, result, 6));
+                ASSERTV(start, 0 == n);
+
+                ASSERTV(start, 0 == mX.tryPushBackRange(&n, VALUES, 0));
+                ASSERTV(start, 0 == n);
+
+                ASSERTV(start, 0 == mX.tryPushBackRange(&n, VALUES, 3));
+                ASSERTV(start, 3 == n);
+                ASSERTV(start, 3 == X.numElements());
+
+                ASSERTV(start, 0 == mX.tryPushBackRange(&n, VALUES + 3, 3));
+                ASSERTV(start, 1 == n);
+                ASSERTV(start, X.isFull());
+
+                ASSERTV(start, Obj::e_FULL ==
+                                   mX.tryPushBackRange(&n, VALUES + 4, 2));
+                ASSERTV(start, 0 == n);
+
+                ASSERTV(start, 0 == mX.popFrontRange(&n, result, 2));
+                ASSERTV(start, 2 == n);
+                ASSERTV(start, 1 == result[0] && 2 == result[1]);
+                ASSERTV(start, 2 == X.numElements());
+
+                ASSERTV(start, 0 == mX.pushBackRange(&n, VALUES + 4, 2));
+                ASSERTV(start, 2 == n);
+                ASSERTV(start, X.isFull());
+
+                ASSERTV(start, 0 == mX.tryPopFrontRange(&n, result, 6));
+                ASSERTV(start, 4 == n);
+                ASSERTV(start, 3 == result[0] && 4 == result[1]);
+                ASSERTV(start, 5 == result[2] && 6 == result[3]);
+                ASSERTV(start, X.isEmpty());
+                ASSERTV(start, 0 == X.numElements());
+            }
+        }
+
+        if (verbose) cout << "\nTesting disabled operations." << endl;
+        {
+            const int   VALUES[] = { 1, 2 };
+            int         result[2];
+            bsl::size_t n = 99;
+
+            Obj mX(4);
+
+            mX.disablePushBack();
+            ASSERT(Obj::e_DISABLED == mX.pushBackRange(&n, VALUES, 2));
+            ASSERT(0 == n);
+            ASSERT(Obj::e_DISABLED == mX.tryPushBackRange(&n, VALUES, 2));
+            ASSERT(0 == n);
+            mX.enablePushBack();
+
+            ASSERT(0 == mX.pushBackRange(&n, VALUES, 2));
+
+            mX.disablePopFront();
+            ASSERT(Obj::e_DISABLED == mX.popFrontRange(&n, result, 2));
+            ASSERT(0 == n);
+            ASSERT(Obj::e_DISABLED == mX.tryPopFrontRange(&n, result, 2));
+            ASSERT(0 == n);
+            mX.enablePopFront();
+
+            ASSERT(0 == mX.popFrontRange(&n, result, 2));
+            ASSERT(2 == n);
+        }
+
+        if (verbose) cout << "\nTesting allocator propagation." << endl;
+        {
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            const bsl::string VALUES[] = {
+                "a string long enough to allocate memory: 0",
+                "a string long enough to allocate memory: 1",
+                "a string long enough to allocate memory: 2"
+            };
+
+            AllocObj mX(4, &sa);
+
+            bsls::Types::Int64 numBlocks = sa.numBlocksInUse();
+
+            bsl::size_t n;
+            ASSERT(0 == mX.pushBackRange(&n, VALUES, 3));
+            ASSERT(3 == n);
+            ASSERT(numBlocks + 3 == sa.numBlocksInUse());
+
+            bsl::string result[3];
+            ASSERT(0 == mX.popFrontRange(&n, result, 3));
+            ASSERT(3 == n);
+            ASSERT(numBlocks == sa.numBlocksInUse());
+
+            for (int i = 0; i < 3; ++i) {
+                ASSERTV(i, VALUES[i] == result[i]);
+            }
+        }
+
+        if (verbose) cout << "\nTesting concurrent operations." << endl;
+        {
+            const bsl::size_t SIZES[]   = { 0, 1, 7, 64 };
+            const int         NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+            setWatchdogText("range operations");
+
+            for (int i = 0; i < NUM_SIZES; ++i) {
+                for (int j = 0; j < NUM_SIZES; ++j) {
+                    Obj mX(16);
+
+                    RangeData pushData = { &mX, 100000, SIZES[i] };
+                    RangeData popData  = { &mX, 100000, SIZES[j] };
+
+                    bslmt::ThreadUtil::Handle watchdogHandle;
+
+                    s_continue = 1;
+
+                    bslmt::ThreadUtil::create(&watchdogHandle, watchdog, 0);
+
+                    bslmt::ThreadUtil::Handle handle;
+                    bslmt::ThreadUtil::create(&handle, rangePush, &pushData);
+
+                    int numErrors = rangePop(popData);
+
+                    bslmt::ThreadUtil::join(handle);
+
+                    s_continue = 0;
+
+                    bslmt::ThreadUtil::join(watchdogHandle);
+
+                    ASSERTV(SIZES[i], SIZES[j], 0 == numErrors);
+                    ASSERTV(SIZES[i], SIZES[j], mX.isEmpty());
+                }
+            }
+        }
+      } break;
       case 10: {
         // ---------------------------------------------------------
         // TEMPLATE REQUIREMENTS TEST
@@ -2863,6 +3146,62 @@ int main(int argc, char *argv[])
         ASSERT(3 == v);
         ASSERT(0 == X.numElements());
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: RANGE OPERATIONS
+        //   Compare the throughput of the per-element and range methods.
+        //
+        // Concerns:
+        //: 1 Transferring elements in ranges is faster than transferring them
+        //:   one at a time.
+        //
+        // Plan:
+        //: 1 Transfer 'k_NUM_VALUES' elements (optionally specified on the
+        //:   command line) from a producer thread to the main thread, for
+        //:   every combination of range sizes, and report the elapsed time.
+        //:   (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: RANGE OPERATIONS
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE: RANGE OPERATIONS" << endl
+             << "=============================" << endl;
+
+        const int k_NUM_VALUES = argc > 2 ? atoi(argv[2]) : 1 << 22;
+
+        const bsl::size_t SIZES[]   = { 0, 1, 16, 256 };
+        const int         NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        cout << "push\tpop\tseconds" << endl;
+
+        for (int i = 0; i < NUM_SIZES; ++i) {
+            for (int j = 0; j < NUM_SIZES; ++j) {
+                Obj mX(1024);
+
+                RangeData pushData = { &mX, k_NUM_VALUES, SIZES[i] };
+                RangeData popData  = { &mX, k_NUM_VALUES, SIZES[j] };
+
+                bsls::Stopwatch timer;
+                timer.start();
+
+                bslmt::ThreadUtil::Handle handle;
+                bslmt::ThreadUtil::create(&handle, rangePush, &pushData);
+
+                int numErrors = rangePop(popData);
+
+                bslmt::ThreadUtil::join(handle);
+
+                timer.stop();
+
+                ASSERTV(SIZES[i], SIZES[j], 0 == numErrors);
+
+                cout << SIZES[i] << '\t' << SIZES[j] << '\t'
+                     << timer.elapsedTime() << endl;
+            }
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
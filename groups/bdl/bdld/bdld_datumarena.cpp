@@ -0,0 +1,79 @@
+// bdld_datumarena.cpp                                                -*-C++-*-
+#include <bdld_datumarena.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdld_datumarena_cpp,"$Id$ $CSID$")
+
+#include <bsls_assert.h>
+
+#include <bsl_cstring.h>
+
+namespace BloombergLP {
+namespace bdld {
+
+                              // ----------------
+                              // class DatumArena
+                              // ----------------
+
+// CREATORS
+DatumArena::DatumArena(bslma::Allocator *basicAllocator)
+: d_allocator(basicAllocator)
+, d_keys(basicAllocator)
+{
+}
+
+DatumArena::DatumArena(bsls::Types::size_type  initialSize,
+                       bslma::Allocator       *basicAllocator)
+: d_allocator(initialSize, basicAllocator)
+, d_keys(basicAllocator)
+{
+    BSLS_ASSERT(0 < initialSize);
+}
+
+DatumArena::~DatumArena()
+{
+}
+
+// MANIPULATORS
+bslstl::StringRef DatumArena::internKey(const bslstl::StringRef& key)
+{
+    KeySet::const_iterator it = d_keys.find(key);
+    if (it != d_keys.end()) {
+        return *it;                                                   // RETURN
+    }
+
+    char *copy = 0;
+    if (0 != key.length()) {
+        copy = static_cast<char *>(d_allocator.allocate(key.length()));
+        bsl::memcpy(copy, key.data(), key.length());
+    }
+
+    const bslstl::StringRef interned(copy ? copy : "", key.length());
+    d_keys.insert(interned);
+    return interned;
+}
+
+void DatumArena::release()
+{
+    d_keys.clear();
+    d_allocator.release();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
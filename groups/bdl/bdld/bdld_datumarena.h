@@ -0,0 +1,223 @@
+// bdld_datumarena.h                                                  -*-C++-*-
+#ifndef INCLUDED_BDLD_DATUMARENA
+#define INCLUDED_BDLD_DATUMARENA
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+//@PURPOSE: Provide an arena in which 'Datum' objects are built and released.
+//
+//@CLASSES:
+//  bdld::DatumArena: sequential memory pool and map-key pool for 'Datum's
+//
+//@SEE_ALSO: bdld_datum, bdld_datummapbuilder, bdlma_sequentialallocator
+//
+//@DESCRIPTION: This component provides a mechanism, 'bdld::DatumArena', that
+// supplies the memory of 'Datum' objects (and of the strings, arrays, and maps
+// they refer to) from a 'bdlma::SequentialAllocator', and that interns the
+// keys of 'Datum' maps.
+//
+// Building a tree of 'Datum' objects (e.g., the result of decoding a JSON
+// document) with a general-purpose allocator performs one allocation per
+// string, array, and map in the tree, and releasing the tree requires a
+// recursive traversal by 'Datum::destroy', which performs one deallocation per
+// allocation.  When a 'Datum' is built using the 'allocator' of an arena,
+// allocations are (typically) a pointer increment, and the whole tree is
+// released in constant time (with respect to the number of nodes in the tree)
+// by calling 'release' on the arena, *without* calling 'Datum::destroy'.
+//
+// Documents usually repeat the same few map keys many times (e.g., the field
+// names of the elements of an array of objects).  'internKey' returns a
+// reference to a single copy, owned by the arena, of each distinct key,
+// suitable to be supplied to a 'bdld::DatumMapBuilder' (which does not own the
+// keys of the map it builds).  The memory used by an arena therefore grows
+// with the number of distinct keys rather than with the number of keys.
+//
+///Object Lifetime
+///---------------
+// A 'Datum' built using the allocator of an arena (and any key interned by
+// the arena) is valid until 'release' is called on the arena, or the arena is
+// destroyed.  Such a 'Datum' must not be supplied to 'Datum::destroy', nor
+// be referred to after it has been released.
+//
+///Thread Safety
+///-------------
+// 'bdld::DatumArena' is *not* thread-safe: 'internKey', 'release', and the
+// allocator returned by 'allocator' all modify the arena.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Building and Releasing a Sequence of Maps
+/// - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we receive a batch of quotes, each having the same fields,
+// which we want to represent as an array of 'Datum' maps, and that are
+// discarded once the batch has been processed.
+//
+// First, we create an arena:
+//..
+//  bdld::DatumArena arena;
+//..
+// Then, we build an array of maps using the allocator of the arena, and the
+// keys interned by the arena:
+//..
+//  const char *SYMBOLS[] = { "IBM", "MSFT", "AAPL" };
+//  const int   NUM_SYMBOLS = sizeof SYMBOLS / sizeof *SYMBOLS;
+//
+//  bdld::DatumArrayBuilder quotes(arena.allocator());
+//  for (int i = 0; i < NUM_SYMBOLS; ++i) {
+//      bdld::DatumMapBuilder quote(arena.allocator());
+//      quote.pushBack(arena.internKey("symbol"),
+//                     bdld::Datum::copyString(SYMBOLS[i], arena.allocator()));
+//      quote.pushBack(arena.internKey("price"),
+//                     bdld::Datum::createDouble(100.0 + i));
+//      quotes.pushBack(quote.commit());
+//  }
+//
+//  bdld::Datum batch = quotes.commit();
+//..
+// Next, we observe that the arena holds a single copy of each key:
+//..
+//  assert(2 == arena.numInternedKeys());
+//
+//  assert(batch.theArray()[0].theMap()[0].key().data() ==
+//         batch.theArray()[2].theMap()[0].key().data());
+//..
+// Finally, once the batch has been processed, we release all of the memory
+// used by 'batch' at once, without calling 'bdld::Datum::destroy':
+//..
+//  arena.release();
+//
+//  assert(0 == arena.numInternedKeys());
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlma_sequentialallocator.h>
+
+#include <bslh_hash.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_unordered_set.h>
+
+#include <bslstl_stringref.h>
+
+namespace BloombergLP {
+namespace bdld {
+
+                              // ================
+                              // class DatumArena
+                              // ================
+
+class DatumArena {
+    // This mechanism supplies the memory of 'Datum' objects from a sequential
+    // memory pool, which is released at once, and interns the keys of 'Datum'
+    // maps.  See the component-level documentation for details.
+
+    // PRIVATE TYPES
+    typedef bsl::unordered_set<bslstl::StringRef, bslh::Hash<> > KeySet;
+
+    // DATA
+    bdlma::SequentialAllocator d_allocator;  // memory of the 'Datum' objects
+                                             // and of the interned keys
+
+    KeySet                     d_keys;       // interned keys, referring to
+                                             // memory from 'd_allocator'
+
+  private:
+    // NOT IMPLEMENTED
+    DatumArena(const DatumArena&);
+    DatumArena& operator=(const DatumArena&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(DatumArena, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit DatumArena(bslma::Allocator *basicAllocator = 0);
+    explicit DatumArena(bsls::Types::size_type  initialSize,
+                        bslma::Allocator       *basicAllocator = 0);
+        // Create an empty arena.  Optionally specify an 'initialSize' (in
+        // bytes) of the first block of memory of the arena.  Optionally
+        // specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless '0 < initialSize'.
+
+    ~DatumArena();
+        // Destroy this arena, releasing all of the memory it supplied.
+
+    // MANIPULATORS
+    bslma::Allocator *allocator();
+        // Return the address of the allocator supplying memory from this arena
+        // (e.g., to be supplied to 'Datum::copyString', or to the constructor
+        // of a 'DatumArrayBuilder').  Note that deallocating memory supplied
+        // by the returned allocator has no effect.
+
+    bslstl::StringRef internKey(const bslstl::StringRef& key);
+        // Return a reference to the copy, held by this arena, of the specified
+        // 'key', copying 'key' into this arena if it is not already interned.
+        // The returned reference remains valid until 'release' is called or
+        // this arena is destroyed.
+
+    void release();
+        // Release all of the memory supplied by this arena, and discard the
+        // interned keys.  The behavior is undefined if any 'Datum' object
+        // built using memory from this arena is subsequently used.  Note that
+        // the capacity of the table of interned keys is retained, for reuse
+        // by subsequent calls to 'internKey'.
+
+    // ACCESSORS
+    bsl::size_t numInternedKeys() const;
+        // Return the number of distinct keys interned by this arena.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                              // ----------------
+                              // class DatumArena
+                              // ----------------
+
+// MANIPULATORS
+inline
+bslma::Allocator *DatumArena::allocator()
+{
+    return &d_allocator;
+}
+
+// ACCESSORS
+inline
+bsl::size_t DatumArena::numInternedKeys() const
+{
+    return d_keys.size();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,678 @@
+// bdld_datumarena.t.cpp                                              -*-C++-*-
+#include <bdld_datumarena.h>
+
+#include <bdld_datum.h>
+#include <bdld_datumarraybuilder.h>
+#include <bdld_datummapbuilder.h>
+#include <bdld_datummapowningkeysbuilder.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                              TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a mechanism supplying memory from a sequential
+// pool and interning strings.  We verify that the memory supplied by the
+// arena, and the interned keys, are obtained from the allocator supplied at
+// construction and are released (at once) by 'release' and by the destructor,
+// that interning a key copies it exactly once, and that 'Datum' objects built
+// in the arena have the expected value.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] DatumArena(bslma::Allocator *basicAllocator = 0);
+// [ 2] DatumArena(size_type initialSize, bslma::Allocator *ba = 0);
+// [ 2] ~DatumArena();
+//
+// MANIPULATORS
+// [ 2] bslma::Allocator *allocator();
+// [ 3] bslstl::StringRef internKey(const bslstl::StringRef& key);
+// [ 4] void release();
+//
+// ACCESSORS
+// [ 3] bsl::size_t numInternedKeys() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+// [-1] PERFORMANCE: BUILDING AND RELEASING MAPS
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                     NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+#define ASSERT_PASS_RAW(EXPR)  BSLS_ASSERTTEST_ASSERT_PASS_RAW(EXPR)
+#define ASSERT_FAIL_RAW(EXPR)  BSLS_ASSERTTEST_ASSERT_FAIL_RAW(EXPR)
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdld::DatumArena Obj;
+
+const char *const FIELDS[] = { "id", "symbol", "price", "quantity", "side" };
+const int         NUM_FIELDS = sizeof FIELDS / sizeof *FIELDS;
+
+const char *const VALUES[] = { "value of the id field",
+                               "value of the symbol field",
+                               "value of the price field",
+                               "value of the quantity field",
+                               "value of the side field" };
+    // values of the 'FIELDS', long enough not to be stored in a 'Datum'
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+bdld::Datum buildWithArena(Obj *arena, int numRecords)
+    // Return an array of the specified 'numRecords' maps, each having the
+    // 'FIELDS' as keys, built using the specified 'arena'.
+{
+    bdld::DatumArrayBuilder records(numRecords, arena->allocator());
+    for (int i = 0; i < numRecords; ++i) {
+        bdld::DatumMapBuilder record(NUM_FIELDS, arena->allocator());
+        for (int j = 0; j < NUM_FIELDS; ++j) {
+            record.pushBack(arena->internKey(FIELDS[j]),
+                            bdld::Datum::copyString(VALUES[j],
+                                                    arena->allocator()));
+        }
+        records.pushBack(record.commit());
+    }
+    return records.commit();
+}
+
+bdld::Datum buildWithAllocator(bslma::Allocator *allocator, int numRecords)
+    // Return an array of the specified 'numRecords' maps, each having (copies
+    // of) the 'FIELDS' as keys, built using the specified 'allocator'.
+{
+    bdld::DatumArrayBuilder records(numRecords, allocator);
+    for (int i = 0; i < numRecords; ++i) {
+        bdld::DatumMapOwningKeysBuilder record(allocator);
+        for (int j = 0; j < NUM_FIELDS; ++j) {
+            record.pushBack(FIELDS[j],
+                            bdld::Datum::copyString(VALUES[j], allocator));
+        }
+        records.pushBack(record.commit());
+    }
+    return records.commit();
+}
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator         da("default", veryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Building and Releasing a Sequence of Maps
+/// - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we receive a batch of quotes, each having the same fields,
+// which we want to represent as an array of 'Datum' maps, and that are
+// discarded once the batch has been processed.
+//
+// First, we create an arena:
+//..
+    bdld::DatumArena arena;
+//..
+// Then, we build an array of maps using the allocator of the arena, and the
+// keys interned by the arena:
+//..
+    const char *SYMBOLS[] = { "IBM", "MSFT", "AAPL" };
+    const int   NUM_SYMBOLS = sizeof SYMBOLS / sizeof *SYMBOLS;
+
+    bdld::DatumArrayBuilder quotes(arena.allocator());
+    for (int i = 0; i < NUM_SYMBOLS; ++i) {
+        bdld::DatumMapBuilder quote(arena.allocator());
+        quote.pushBack(arena.internKey("symbol"),
+                       bdld::Datum::copyString(SYMBOLS[i], arena.allocator()));
+        quote.pushBack(arena.internKey("price"),
+                       bdld::Datum::createDouble(100.0 + i));
+        quotes.pushBack(quote.commit());
+    }
+
+    bdld::Datum batch = quotes.commit();
+//..
+// Next, we observe that the arena holds a single copy of each key:
+//..
+    ASSERT(2 == arena.numInternedKeys());
+
+    ASSERT(batch.theArray()[0].theMap()[0].key().data() ==
+           batch.theArray()[2].theMap()[0].key().data());
+//..
+// Finally, once the batch has been processed, we release all of the memory
+// used by 'batch' at once, without calling 'bdld::Datum::destroy':
+//..
+    arena.release();
+
+    ASSERT(0 == arena.numInternedKeys());
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'release'
+        //
+        // Concerns:
+        //: 1 'release' returns to the allocator supplied at construction all
+        //:   of the memory obtained by the arena for 'Datum' objects and
+        //:   interned keys, other than the (bounded) storage of the table of
+        //:   interned keys.
+        //:
+        //: 2 'release' discards the interned keys.
+        //:
+        //: 3 The arena can be reused after 'release', without growing the
+        //:   memory retained by the arena.
+        //
+        // Plan:
+        //: 1 Build an array of maps in an arena, release the arena, and verify
+        //:   that the memory from the supplied allocator remaining in use is
+        //:   less than before 'release', and that no key is interned.
+        //:   (C-1..2)
+        //:
+        //: 2 Build the same array again, verify its value, and verify that
+        //:   the memory in use after 'release' is the same as after the first
+        //:   'release'.  (C-3)
+        //
+        // Testing:
+        //   void release();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'release'" << endl
+                          << "=========" << endl;
+
+        bslma::TestAllocator oa("object", veryVerbose);
+        {
+            Obj mX(&oa);
+
+            bsls::Types::Int64 retainedBytes = -1;
+
+            for (int iteration = 0; iteration < 3; ++iteration) {
+                bdld::Datum value = buildWithArena(&mX, 100);
+
+                ASSERTV(iteration, value.isArray());
+                ASSERTV(iteration, 100 == value.theArray().length());
+                ASSERTV(iteration, NUM_FIELDS == (int)mX.numInternedKeys());
+                ASSERTV(iteration,
+                        VALUES[4] ==
+                              value.theArray()[99].theMap()[4].value()
+                                                              .theString());
+
+                const bsls::Types::Int64 BYTES = oa.numBytesInUse();
+
+                mX.release();
+
+                ASSERTV(iteration, 0 == mX.numInternedKeys());
+                ASSERTV(iteration, BYTES, oa.numBytesInUse(),
+                        oa.numBytesInUse() < BYTES / 2);
+
+                if (0 == iteration) {
+                    retainedBytes = oa.numBytesInUse();
+                }
+                ASSERTV(iteration, retainedBytes == oa.numBytesInUse());
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == da.numBlocksTotal());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'internKey'
+        //
+        // Concerns:
+        //: 1 'internKey' returns a string equal to its argument.
+        //:
+        //: 2 'internKey' returns the same reference for equal keys, and
+        //:   different references for different keys.
+        //:
+        //: 3 The returned reference does not refer to the argument.
+        //:
+        //: 4 'numInternedKeys' returns the number of distinct keys.
+        //:
+        //: 5 The empty key, and keys having embedded null characters, are
+        //:   supported.
+        //
+        // Plan:
+        //: 1 Intern each key of a table, having duplicates, from a modifiable
+        //:   buffer, and verify the value and address of the result, and the
+        //:   number of interned keys.  Overwrite the buffer, and verify that
+        //:   the interned keys are unaffected.  (C-1..5)
+        //
+        // Testing:
+        //   bslstl::StringRef internKey(const bslstl::StringRef& key);
+        //   bsl::size_t numInternedKeys() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'internKey'" << endl
+                          << "===========" << endl;
+
+        static const struct {
+            int         d_line;
+            const char *d_key;
+            int         d_length;
+            int         d_index;    // index of the first equal key
+        } DATA[] = {
+            //LINE  KEY         LEN  INDEX
+            //----  ---------   ---  -----
+            { L_,   "a",          1,     0 },
+            { L_,   "b",          1,     1 },
+            { L_,   "a",          1,     0 },
+            { L_,   "",           0,     3 },
+            { L_,   "ab",         2,     4 },
+            { L_,   "a\0b",       3,     5 },
+            { L_,   "a\0c",       3,     6 },
+            { L_,   "",           0,     3 },
+            { L_,   "a\0b",       3,     5 },
+            { L_,   "ab",         2,     4 },
+            { L_,   "b",          1,     1 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        bslma::TestAllocator oa("object", veryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+
+        bslstl::StringRef results[NUM_DATA];
+        bsl::size_t       expectedNumKeys = 0;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int               LINE  = DATA[ti].d_line;
+            const bslstl::StringRef KEY(DATA[ti].d_key, DATA[ti].d_length);
+            const int               INDEX = DATA[ti].d_index;
+
+            char buffer[8];
+            bsl::memcpy(buffer, KEY.data(), KEY.length());
+
+            results[ti] = mX.internKey(bslstl::StringRef(buffer,
+                                                         KEY.length()));
+            bsl::memset(buffer, 'x', sizeof buffer);
+
+            if (ti == INDEX) {
+                ++expectedNumKeys;
+            }
+
+            ASSERTV(LINE, KEY == results[ti]);
+            ASSERTV(LINE, expectedNumKeys == X.numInternedKeys());
+            ASSERTV(LINE, results[INDEX].data() == results[ti].data());
+
+            for (int tj = 0; tj < ti; ++tj) {
+                if (DATA[tj].d_index != INDEX && 0 != KEY.length()) {
+                    ASSERTV(LINE, DATA[tj].d_line,
+                            results[tj].data() != results[ti].data());
+                }
+            }
+        }
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int               LINE = DATA[ti].d_line;
+            const bslstl::StringRef KEY(DATA[ti].d_key, DATA[ti].d_length);
+
+            ASSERTV(LINE, KEY == results[ti]);
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND 'allocator'
+        //
+        // Concerns:
+        //: 1 The arena obtains its memory from the allocator supplied at
+        //:   construction, or from the default allocator if none is supplied.
+        //:
+        //: 2 The memory obtained by the arena is released on destruction.
+        //:
+        //: 3 Memory allocated from 'allocator' is suitably aligned, and
+        //:   deallocating it has no effect.
+        //:
+        //: 4 The initial size, if supplied, is the size of the first block of
+        //:   memory obtained by the arena.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create arenas with and without an allocator and an initial size,
+        //:   allocate memory from them, and verify the use of the test
+        //:   allocators.  (C-1..4)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   DatumArena(bslma::Allocator *basicAllocator = 0);
+        //   DatumArena(size_type initialSize, bslma::Allocator *ba = 0);
+        //   ~DatumArena();
+        //   bslma::Allocator *allocator();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS AND 'allocator'" << endl
+                          << "========================" << endl;
+
+        for (char cfg = 'a'; cfg <= 'd'; ++cfg) {
+            const char CONFIG = cfg;
+
+            bslma::TestAllocator  fa("footprint", veryVerbose);
+            bslma::TestAllocator  sa("supplied",  veryVerbose);
+
+            Obj *objPtr = 0;
+            switch (CONFIG) {
+              case 'a': {
+                objPtr = new (fa) Obj();
+              } break;
+              case 'b': {
+                objPtr = new (fa) Obj(&sa);
+              } break;
+              case 'c': {
+                objPtr = new (fa) Obj(1024);
+              } break;
+              case 'd': {
+                objPtr = new (fa) Obj(1024, &sa);
+              } break;
+            }
+
+            Obj&                  mX = *objPtr;
+            bslma::TestAllocator& oa = 'a' == CONFIG || 'c' == CONFIG
+                                     ? da
+                                     : sa;
+            bslma::TestAllocator& noa = &oa == &da ? sa : da;
+
+            const bool HAS_INITIAL_SIZE = 'c' == CONFIG || 'd' == CONFIG;
+
+            ASSERTV(CONFIG, (HAS_INITIAL_SIZE ? 1 : 0) == oa.numBlocksInUse());
+            if (HAS_INITIAL_SIZE) {
+                ASSERTV(CONFIG, 1024 <= oa.lastAllocatedNumBytes());
+            }
+
+            bslma::Allocator *allocator = mX.allocator();
+            ASSERTV(CONFIG, allocator == mX.allocator());
+
+            void *p = allocator->allocate(3);
+            void *q = allocator->allocate(sizeof(double));
+
+            ASSERTV(CONFIG, p && q && p != q);
+            ASSERTV(CONFIG, 0 == reinterpret_cast<bsls::Types::UintPtr>(q)
+                                                             % sizeof(double));
+            ASSERTV(CONFIG, 1 == oa.numBlocksInUse());
+
+            allocator->deallocate(q);
+            ASSERTV(CONFIG, 1 == oa.numBlocksInUse());
+
+            ASSERTV(CONFIG, 0 == noa.numBlocksInUse());
+
+            fa.deleteObject(objPtr);
+
+            ASSERTV(CONFIG, 0 == oa.numBlocksInUse());
+            ASSERTV(CONFIG, 0 == fa.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const bsls::Types::size_type ZERO = 0;
+
+            ASSERT_PASS_RAW(Obj(ZERO + 1, &da));
+            ASSERT_FAIL_RAW(Obj(ZERO,     &da));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Build a map in an arena, intern keys, and release the arena.
+        //:   (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator oa("object", veryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+
+        ASSERT(0 == X.numInternedKeys());
+
+        const bslstl::StringRef KEY = mX.internKey("key");
+        ASSERT("key" == KEY);
+        ASSERT(1     == X.numInternedKeys());
+        ASSERT(KEY.data() == mX.internKey("key").data());
+
+        bdld::DatumMapBuilder builder(mX.allocator());
+        builder.pushBack(KEY,
+                         bdld::Datum::copyString("a long string value",
+                                                 mX.allocator()));
+        bdld::Datum map = builder.commit();
+
+        ASSERT(map.isMap());
+        ASSERT("a long string value" == map.theMap().find("key")->theString());
+
+        const bsls::Types::Int64 BYTES = oa.numBytesInUse();
+
+        mX.release();
+
+        ASSERT(0 == X.numInternedKeys());
+        ASSERT(BYTES > oa.numBytesInUse());
+        ASSERT(0 == da.numBlocksTotal());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: BUILDING AND RELEASING MAPS
+        //
+        // Concerns:
+        //: 1 Building 'Datum' objects in an arena performs fewer allocations,
+        //:   and takes less time (to build and to release), than building
+        //:   them with a general-purpose allocator.
+        //
+        // Plan:
+        //: 1 Build arrays of maps having the same keys, once using an arena
+        //:   and once using 'DatumMapOwningKeysBuilder' with the default
+        //:   allocator, and report the number of allocations and the time
+        //:   taken to build and to release (or destroy) the arrays.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: BUILDING AND RELEASING MAPS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: BUILDING AND RELEASING MAPS" << endl
+                          << "========================================"
+                          << endl;
+
+        const int NUM_RECORDS    = argc > 2 ? bsl::atoi(argv[2]) : 10000;
+        const int NUM_ITERATIONS = 20;
+
+        bslma::TestAllocator ta("counting", veryVerbose);
+        bslma::Allocator    *ma = &bslma::NewDeleteAllocator::singleton();
+
+        {
+            bsls::Types::Int64 numAllocations = ta.numAllocations();
+            bdld::Datum        value = buildWithAllocator(&ta, NUM_RECORDS);
+            cout << "allocations (allocator): "
+                 << ta.numAllocations() - numAllocations << endl;
+            bdld::Datum::destroy(value, &ta);
+
+            Obj mX(&ta);
+            numAllocations = ta.numAllocations();
+            buildWithArena(&mX, NUM_RECORDS);
+            cout << "allocations (arena):     "
+                 << ta.numAllocations() - numAllocations << endl;
+        }
+
+        bsls::Stopwatch build;
+        bsls::Stopwatch teardown;
+        for (int i = 0; i < NUM_ITERATIONS; ++i) {
+            build.start();
+            bdld::Datum value = buildWithAllocator(ma, NUM_RECORDS);
+            build.stop();
+
+            teardown.start();
+            bdld::Datum::destroy(value, ma);
+            teardown.stop();
+        }
+        cout << "allocator: build "
+             << build.elapsedTime() / NUM_ITERATIONS * 1000 << " ms"
+             << ", destroy "
+             << teardown.elapsedTime() / NUM_ITERATIONS * 1000 << " ms"
+             << endl;
+
+        build.reset();
+        teardown.reset();
+        {
+            Obj mX(ma);
+            for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                build.start();
+                buildWithArena(&mX, NUM_RECORDS);
+                build.stop();
+
+                teardown.start();
+                mX.release();
+                teardown.stop();
+            }
+        }
+        cout << "arena:     build "
+             << build.elapsedTime() / NUM_ITERATIONS * 1000 << " ms"
+             << ", release "
+             << teardown.elapsedTime() / NUM_ITERATIONS * 1000 << " ms"
+             << endl;
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,744 @@
+// bdlde_base64util.cpp                                               -*-C++-*-
+#include <bdlde_base64util.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlde_base64util_cpp,"$Id$ $CSID$")
+
+#include <bdlde_base64encoder.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomicoperations.h>
+#include <bsls_platform.h>
+
+#if defined(BSLS_PLATFORM_CPU_X86_64)                                         \
+ && (defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG))
+# define BDLDE_BASE64UTIL_SIMD 1
+# define BDLDE_BASE64UTIL_TARGET_SSSE3 __attribute__((target("ssse3")))
+# define BDLDE_BASE64UTIL_TARGET_AVX2  __attribute__((target("avx2")))
+# include <cpuid.h>
+# include <immintrin.h>
+#endif
+
+///Implementation Notes
+///--------------------
+// The vector kernels are those described by Wojciech Mula and Daniel Lemire in
+// "Faster Base64 Encoding and Decoding Using AVX2 Instructions" (ACM
+// Transactions on the Web, 2018):
+//
+//: o Encoding: each group of 3 input bytes is spread over a 32-bit lane by
+//:   'pshufb', the four 6-bit indices are moved to the low bits of the four
+//:   bytes of the lane by two multiplications, and each index is translated to
+//:   its character by adding an offset looked up (by 'pshufb') from the range
+//:   of the index.
+//:
+//: o Decoding: the character class of each input byte is looked up from its
+//:   low and high nibbles, any byte that is not a Base64 character (including
+//:   '=' and whitespace) rejecting the whole block; the 6-bit values are then
+//:   obtained by adding an offset looked up from the high nibble, and packed
+//:   by two multiply-add instructions and a final 'pshufb'.
+//
+// A block rejected by the vector decoder is processed by the scalar state
+// machine, which reproduces exactly the states of 'bdlde::Base64Decoder', and
+// which resumes the vector decoding at the next boundary of a group of 4
+// Base64 characters.  The instruction set supported by the processor is
+// determined once, by the 'CPUID' instruction.
+//
+// The vector decoders write 16 (or 32) bytes for each block, of which only 12
+// (or 24) are decoded bytes; they are used only if at least 24 (or 44) input
+// characters remain, which guarantees that the output buffer, whose capacity
+// is 'maxDecodedLength(inputLength)', has room for the additional bytes.
+
+namespace BloombergLP {
+namespace bdlde {
+namespace {
+namespace u {
+
+enum InstructionSet {
+    // Enumerate the instruction sets used by the kernels, in increasing order
+    // of capability.
+
+    e_PORTABLE = 0,
+    e_SSSE3    = 1,
+    e_AVX2     = 2
+};
+
+enum {
+    k_SIZEOF_CRLF = 2  // number of characters of a line break
+};
+
+const bsl::size_t k_CHUNK_LENGTH = 1 << 24;
+    // number of bytes supplied at once to a 'Base64Encoder', whose counts are
+    // 'int'
+
+const char k_ENCODING[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+                          "abcdefghijklmnopqrstuvwxyz"
+                          "0123456789+/";
+    // Map from 6-bit values to Base64 characters.
+
+const unsigned char ff = 0xff;
+const unsigned char k_DECODING[256] = {
+    // Map from Base64 characters to their 6-bit values, and from any other
+    // character to 'ff'.
+
+    //  0   1   2   3   4   5   6   7   8   9   A   B   C   D   E   F
+    // --  --  --  --  --  --  --  --  --  --  --  --  --  --  --  --
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // 00
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // 10
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, 62, ff, ff, ff, 63,  // 20
+       52, 53, 54, 55, 56, 57, 58, 59, 60, 61, ff, ff, ff, ff, ff, ff,  // 30
+       ff,  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14,  // 40
+       15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, ff, ff, ff, ff, ff,  // 50
+       ff, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,  // 60
+       41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, ff, ff, ff, ff, ff,  // 70
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // 80
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // 90
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // A0
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // B0
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // C0
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // D0
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // E0
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // F0
+};
+
+inline
+bool isWhitespace(unsigned char byte)
+    // Return 'true' if the specified 'byte' is a whitespace character (i.e.,
+    // one of " \t\n\v\f\r"), and 'false' otherwise.
+{
+    return ' ' == byte || ('\t' <= byte && byte <= '\r');
+}
+
+inline
+bool isIgnorable(unsigned char byte, bool unrecognizedIsErrorFlag)
+    // Return 'true' if the specified 'byte' is ignored by a decoder for which
+    // unrecognized characters are errors if the specified
+    // 'unrecognizedIsErrorFlag' is 'true', and 'false' otherwise.
+{
+    return unrecognizedIsErrorFlag
+         ? isWhitespace(byte)
+         : '=' != byte && 64 <= k_DECODING[byte];
+}
+
+                        // *** scalar kernels ***
+
+bsl::size_t encodeGroupsPortable(char                *output,
+                                 const unsigned char *input,
+                                 bsl::size_t          numGroups)
+    // Write to the specified 'output' the encoding of the specified
+    // 'numGroups' groups of 3 bytes at the specified 'input', and return the
+    // number of characters written (i.e., '4 * numGroups').
+{
+    for (bsl::size_t i = 0; i < numGroups; ++i, input += 3, output += 4) {
+        const unsigned int value = (input[0] << 16) | (input[1] << 8)
+                                                    |  input[2];
+        output[0] = k_ENCODING[ value >> 18        ];
+        output[1] = k_ENCODING[(value >> 12) & 0x3f];
+        output[2] = k_ENCODING[(value >>  6) & 0x3f];
+        output[3] = k_ENCODING[ value        & 0x3f];
+    }
+    return 4 * numGroups;
+}
+
+#if defined(BDLDE_BASE64UTIL_SIMD)
+                        // *** vector kernels ***
+
+int detectInstructionSet()
+    // Return the most capable 'InstructionSet' supported by the processor and
+    // the operating system.
+{
+    unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)
+     || !(ecx & (1u << 9))) {                     // 'CPUID.01H:ECX.SSSE3[9]'
+        return e_PORTABLE;                                            // RETURN
+    }
+
+    // AVX2 requires the operating system to save the 'ymm' registers, as
+    // reported by 'XGETBV' if 'CPUID.01H:ECX.OSXSAVE[27]' is set.
+
+    const unsigned int k_OSXSAVE_AVX = (1u << 27) | (1u << 28);
+    if ((ecx & k_OSXSAVE_AVX) != k_OSXSAVE_AVX) {
+        return e_SSSE3;                                               // RETURN
+    }
+
+    unsigned int xcr0Low = 0, xcr0High = 0;
+    __asm__ __volatile__("xgetbv" : "=a"(xcr0Low), "=d"(xcr0High) : "c"(0));
+    if (6 != (xcr0Low & 6) || __get_cpuid_max(0, 0) < 7) {
+        return e_SSSE3;                                               // RETURN
+    }
+
+    __cpuid_count(7, 0, eax, ebx, ecx, edx);
+    return ebx & (1u << 5) ? e_AVX2 : e_SSSE3;    // 'CPUID.07H:EBX.AVX2[5]'
+}
+
+int instructionSet()
+    // Return the most capable 'InstructionSet' supported by the processor and
+    // the operating system, detecting it on first use.
+{
+    static bsls::AtomicOperations::AtomicTypes::Int cached = { -1 };
+
+    int result = bsls::AtomicOperations::getIntRelaxed(&cached);
+    if (result < 0) {
+        result = detectInstructionSet();
+        bsls::AtomicOperations::setIntRelaxed(&cached, result);
+    }
+
+    return result;
+}
+
+BDLDE_BASE64UTIL_TARGET_SSSE3
+inline
+__m128i encodeVectorSsse3(__m128i input)
+    // Return the 16 characters encoding the 12 bytes of the specified 'input'
+    // (the 4 high bytes of which are ignored).
+{
+    input = _mm_shuffle_epi8(input, _mm_set_epi8(10, 11,  9, 10,
+                                                  7,  8,  6,  7,
+                                                  4,  5,  3,  4,
+                                                  1,  2,  0,  1));
+
+    const __m128i t0 = _mm_and_si128(input, _mm_set1_epi32(0x0fc0fc00));
+    const __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+    const __m128i t2 = _mm_and_si128(input, _mm_set1_epi32(0x003f03f0));
+    const __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+    const __m128i indices = _mm_or_si128(t1, t3);
+
+    __m128i offsets = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+    const __m128i less = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+    offsets = _mm_or_si128(offsets,
+                           _mm_and_si128(less, _mm_set1_epi8(13)));
+
+    const __m128i k_SHIFT = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52,
+                                          '0' - 52, '0' - 52, '0' - 52,
+                                          '0' - 52, '0' - 52, '0' - 52,
+                                          '0' - 52, '0' - 52, '+' - 62,
+                                          '/' - 63, 'A', 0, 0);
+
+    return _mm_add_epi8(_mm_shuffle_epi8(k_SHIFT, offsets), indices);
+}
+
+BDLDE_BASE64UTIL_TARGET_AVX2
+inline
+__m256i encodeVectorAvx2(__m256i input)
+    // Return the 32 characters encoding the 12 low bytes of each 16-byte lane
+    // of the specified 'input'.
+{
+    input = _mm256_shuffle_epi8(input, _mm256_set_epi8(10, 11,  9, 10,
+                                                        7,  8,  6,  7,
+                                                        4,  5,  3,  4,
+                                                        1,  2,  0,  1,
+                                                       10, 11,  9, 10,
+                                                        7,  8,  6,  7,
+                                                        4,  5,  3,  4,
+                                                        1,  2,  0,  1));
+
+    const __m256i t0 = _mm256_and_si256(input, _mm256_set1_epi32(0x0fc0fc00));
+    const __m256i t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+    const __m256i t2 = _mm256_and_si256(input, _mm256_set1_epi32(0x003f03f0));
+    const __m256i t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+    const __m256i indices = _mm256_or_si256(t1, t3);
+
+    __m256i offsets = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+    const __m256i less = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices);
+    offsets = _mm256_or_si256(offsets,
+                              _mm256_and_si256(less, _mm256_set1_epi8(13)));
+
+    const __m256i k_SHIFT = _mm256_setr_epi8('a' - 26, '0' - 52, '0' - 52,
+                                             '0' - 52, '0' - 52, '0' - 52,
+                                             '0' - 52, '0' - 52, '0' - 52,
+                                             '0' - 52, '0' - 52, '+' - 62,
+                                             '/' - 63, 'A', 0, 0,
+                                             'a' - 26, '0' - 52, '0' - 52,
+                                             '0' - 52, '0' - 52, '0' - 52,
+                                             '0' - 52, '0' - 52, '0' - 52,
+                                             '0' - 52, '0' - 52, '+' - 62,
+                                             '/' - 63, 'A', 0, 0);
+
+    return _mm256_add_epi8(_mm256_shuffle_epi8(k_SHIFT, offsets), indices);
+}
+
+BDLDE_BASE64UTIL_TARGET_SSSE3
+bsl::size_t encodeBlocksSsse3(char        *output,
+                              const char  *input,
+                              bsl::size_t  inputLength)
+    // Write to the specified 'output' the encoding of blocks of 12 bytes of
+    // the specified 'input' of the specified 'inputLength' bytes, for as long
+    // as at least 16 bytes remain, and return the number of bytes encoded.
+    // The behavior is undefined unless the processor supports SSSE3.
+{
+    bsl::size_t offset = 0;
+    for (; offset + 16 <= inputLength; offset += 12, output += 16) {
+        const __m128i block = _mm_loadu_si128(
+                            reinterpret_cast<const __m128i *>(input + offset));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(output),
+                         encodeVectorSsse3(block));
+    }
+    return offset;
+}
+
+BDLDE_BASE64UTIL_TARGET_AVX2
+bsl::size_t encodeBlocksAvx2(char        *output,
+                             const char  *input,
+                             bsl::size_t  inputLength)
+    // Write to the specified 'output' the encoding of blocks of 24 bytes of
+    // the specified 'input' of the specified 'inputLength' bytes, for as long
+    // as at least 32 bytes remain, and return the number of bytes encoded.
+    // The behavior is undefined unless the processor supports AVX2.
+{
+    bsl::size_t offset = 0;
+    for (; offset + 32 <= inputLength; offset += 24, output += 32) {
+        const __m128i low  = _mm_loadu_si128(
+                            reinterpret_cast<const __m128i *>(input + offset));
+        const __m128i high = _mm_loadu_si128(
+                       reinterpret_cast<const __m128i *>(input + offset + 12));
+        const __m256i block = _mm256_inserti128_si256(
+                                         _mm256_castsi128_si256(low), high, 1);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(output),
+                            encodeVectorAvx2(block));
+    }
+    return offset;
+}
+
+BDLDE_BASE64UTIL_TARGET_SSSE3
+bsl::size_t decodeBlocksSsse3(char        *output,
+                              const char  *input,
+                              bsl::size_t  inputLength)
+    // Write to the specified 'output' the decoding of blocks of 16 Base64
+    // characters of the specified 'input' of the specified 'inputLength'
+    // characters, for as long as at least 24 characters remain and the block
+    // contains only Base64 characters, and return the number of characters
+    // decoded.  The behavior is undefined unless the processor supports SSSE3,
+    // and 'output' has room for 4 bytes beyond the decoded bytes.
+{
+    const __m128i k_LOW  = _mm_setr_epi8(0x15, 0x11, 0x11, 0x11,
+                                         0x11, 0x11, 0x11, 0x11,
+                                         0x11, 0x11, 0x13, 0x1a,
+                                         0x1b, 0x1b, 0x1b, 0x1a);
+    const __m128i k_HIGH = _mm_setr_epi8(0x10, 0x10, 0x01, 0x02,
+                                         0x04, 0x08, 0x04, 0x08,
+                                         0x10, 0x10, 0x10, 0x10,
+                                         0x10, 0x10, 0x10, 0x10);
+    const __m128i k_ROLL = _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71,
+                                         0,  0,  0, 0,   0,   0,   0,   0);
+    const __m128i k_PACK = _mm_setr_epi8( 2,  1,  0,  6,  5,  4, 10,  9,
+                                          8, 14, 13, 12, -1, -1, -1, -1);
+    const __m128i k_NIBBLE = _mm_set1_epi8(0x0f);
+
+    bsl::size_t offset = 0;
+    for (; offset + 24 <= inputLength; offset += 16, output += 12) {
+        const __m128i block = _mm_loadu_si128(
+                            reinterpret_cast<const __m128i *>(input + offset));
+
+        const __m128i high = _mm_and_si128(_mm_srli_epi32(block, 4),
+                                           k_NIBBLE);
+        const __m128i low  = _mm_and_si128(block, k_NIBBLE);
+        const __m128i invalid = _mm_and_si128(_mm_shuffle_epi8(k_LOW, low),
+                                              _mm_shuffle_epi8(k_HIGH, high));
+        if (_mm_movemask_epi8(_mm_cmpgt_epi8(invalid,
+                                             _mm_setzero_si128()))) {
+            break;
+        }
+
+        const __m128i slash = _mm_cmpeq_epi8(block, _mm_set1_epi8('/'));
+        const __m128i roll  = _mm_shuffle_epi8(k_ROLL,
+                                               _mm_add_epi8(slash, high));
+        const __m128i values = _mm_add_epi8(block, roll);
+
+        const __m128i pairs = _mm_maddubs_epi16(values,
+                                                _mm_set1_epi32(0x01400140));
+        const __m128i words = _mm_madd_epi16(pairs,
+                                             _mm_set1_epi32(0x00011000));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(output),
+                         _mm_shuffle_epi8(words, k_PACK));
+    }
+    return offset;
+}
+
+BDLDE_BASE64UTIL_TARGET_AVX2
+bsl::size_t decodeBlocksAvx2(char        *output,
+                             const char  *input,
+                             bsl::size_t  inputLength)
+    // Write to the specified 'output' the decoding of blocks of 32 Base64
+    // characters of the specified 'input' of the specified 'inputLength'
+    // characters, for as long as at least 44 characters remain and the block
+    // contains only Base64 characters, and return the number of characters
+    // decoded.  The behavior is undefined unless the processor supports AVX2,
+    // and 'output' has room for 8 bytes beyond the decoded bytes.
+{
+    const __m256i k_LOW  = _mm256_setr_epi8(0x15, 0x11, 0x11, 0x11,
+                                            0x11, 0x11, 0x11, 0x11,
+                                            0x11, 0x11, 0x13, 0x1a,
+                                            0x1b, 0x1b, 0x1b, 0x1a,
+                                            0x15, 0x11, 0x11, 0x11,
+                                            0x11, 0x11, 0x11, 0x11,
+                                            0x11, 0x11, 0x13, 0x1a,
+                                            0x1b, 0x1b, 0x1b, 0x1a);
+    const __m256i k_HIGH = _mm256_setr_epi8(0x10, 0x10, 0x01, 0x02,
+                                            0x04, 0x08, 0x04, 0x08,
+                                            0x10, 0x10, 0x10, 0x10,
+                                            0x10, 0x10, 0x10, 0x10,
+                                            0x10, 0x10, 0x01, 0x02,
+                                            0x04, 0x08, 0x04, 0x08,
+                                            0x10, 0x10, 0x10, 0x10,
+                                            0x10, 0x10, 0x10, 0x10);
+    const __m256i k_ROLL = _mm256_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71,
+                                            0,  0,  0, 0,   0,   0,   0,   0,
+                                            0, 16, 19, 4, -65, -65, -71, -71,
+                                            0,  0,  0, 0,   0,   0,   0,   0);
+    const __m256i k_PACK = _mm256_setr_epi8( 2,  1,  0,  6,  5,  4, 10,  9,
+                                             8, 14, 13, 12, -1, -1, -1, -1,
+                                             2,  1,  0,  6,  5,  4, 10,  9,
+                                             8, 14, 13, 12, -1, -1, -1, -1);
+    const __m256i k_NIBBLE = _mm256_set1_epi8(0x0f);
+
+    bsl::size_t offset = 0;
+    for (; offset + 44 <= inputLength; offset += 32, output += 24) {
+        const __m256i block = _mm256_loadu_si256(
+                            reinterpret_cast<const __m256i *>(input + offset));
+
+        const __m256i high = _mm256_and_si256(_mm256_srli_epi32(block, 4),
+                                              k_NIBBLE);
+        const __m256i low  = _mm256_and_si256(block, k_NIBBLE);
+        const __m256i invalid = _mm256_and_si256(
+                                          _mm256_shuffle_epi8(k_LOW, low),
+                                          _mm256_shuffle_epi8(k_HIGH, high));
+        if (_mm256_movemask_epi8(_mm256_cmpgt_epi8(invalid,
+                                                   _mm256_setzero_si256()))) {
+            break;
+        }
+
+        const __m256i slash = _mm256_cmpeq_epi8(block, _mm256_set1_epi8('/'));
+        const __m256i roll  = _mm256_shuffle_epi8(
+                                                 k_ROLL,
+                                                 _mm256_add_epi8(slash, high));
+        const __m256i values = _mm256_add_epi8(block, roll);
+
+        const __m256i pairs = _mm256_maddubs_epi16(
+                                                values,
+                                                _mm256_set1_epi32(0x01400140));
+        const __m256i words = _mm256_madd_epi16(pairs,
+                                                _mm256_set1_epi32(0x00011000));
+        const __m256i packed = _mm256_shuffle_epi8(words, k_PACK);
+
+        // Move the 12 decoded bytes of the high lane next to those of the low
+        // lane.
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(output),
+                            _mm256_permutevar8x32_epi32(
+                                packed,
+                                _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7)));
+    }
+    return offset;
+}
+#endif
+
+                        // *** dispatch ***
+
+bsl::size_t encodeLine(char        *output,
+                       const char  *input,
+                       bsl::size_t  inputLength)
+    // Write to the specified 'output' the encoding, without line breaks, of
+    // the specified 'input' of the specified 'inputLength' bytes, and return
+    // the number of characters written.
+{
+    const char *const outputBegin = output;
+
+#if defined(BDLDE_BASE64UTIL_SIMD)
+    if (16 <= inputLength) {
+        const int set = instructionSet();
+
+        bsl::size_t numEncoded = 0;
+        if (e_AVX2 == set) {
+            numEncoded = encodeBlocksAvx2(output, input, inputLength);
+            input       += numEncoded;
+            inputLength -= numEncoded;
+            output      += numEncoded / 3 * 4;
+        }
+        if (e_PORTABLE != set) {
+            numEncoded = encodeBlocksSsse3(output, input, inputLength);
+            input       += numEncoded;
+            inputLength -= numEncoded;
+            output      += numEncoded / 3 * 4;
+        }
+    }
+#endif
+
+    const bsl::size_t numGroups = inputLength / 3;
+    output += encodeGroupsPortable(
+                               output,
+                               reinterpret_cast<const unsigned char *>(input),
+                               numGroups);
+    input       += 3 * numGroups;
+    inputLength -= 3 * numGroups;
+
+    if (inputLength) {
+        const unsigned char *bytes =
+                               reinterpret_cast<const unsigned char *>(input);
+        const unsigned int   value = (bytes[0] << 16)
+                                   | (2 == inputLength ? bytes[1] << 8 : 0);
+
+        output[0] = k_ENCODING[ value >> 18        ];
+        output[1] = k_ENCODING[(value >> 12) & 0x3f];
+        output[2] = 2 == inputLength ? k_ENCODING[(value >> 6) & 0x3f] : '=';
+        output[3] = '=';
+        output += 4;
+    }
+
+    return output - outputBegin;
+}
+
+bsl::size_t decodeBlocks(char        *output,
+                         const char  *input,
+                         bsl::size_t  inputLength)
+    // Write to the specified 'output' the decoding of the longest prefix of
+    // the specified 'input' of the specified 'inputLength' characters that
+    // consists of groups of 4 Base64 characters, possibly stopping earlier,
+    // and return the number of characters decoded.  The behavior is undefined
+    // unless 'output' has room for 'maxDecodedLength(inputLength)' bytes.
+{
+    bsl::size_t offset = 0;
+
+#if defined(BDLDE_BASE64UTIL_SIMD)
+    if (24 <= inputLength) {
+        const int set = instructionSet();
+
+        if (e_AVX2 == set) {
+            offset = decodeBlocksAvx2(output, input, inputLength);
+        }
+        if (e_PORTABLE != set) {
+            offset += decodeBlocksSsse3(output + offset / 4 * 3,
+                                        input + offset,
+                                        inputLength - offset);
+        }
+    }
+#endif
+
+    const unsigned char *bytes =
+                                reinterpret_cast<const unsigned char *>(input);
+    output += offset / 4 * 3;
+
+    for (; offset + 4 <= inputLength; offset += 4, output += 3) {
+        const unsigned int v0 = k_DECODING[bytes[offset]];
+        const unsigned int v1 = k_DECODING[bytes[offset + 1]];
+        const unsigned int v2 = k_DECODING[bytes[offset + 2]];
+        const unsigned int v3 = k_DECODING[bytes[offset + 3]];
+
+        if ((v0 | v1 | v2 | v3) & 0xc0) {
+            break;
+        }
+
+        const unsigned int value = (v0 << 18) | (v1 << 12) | (v2 << 6) | v3;
+        output[0] = static_cast<char>(value >> 16);
+        output[1] = static_cast<char>(value >>  8);
+        output[2] = static_cast<char>(value);
+    }
+
+    return offset;
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+                              // -----------------
+                              // struct Base64Util
+                              // -----------------
+
+// CLASS METHODS
+bsl::size_t Base64Util::encodedLength(bsl::size_t inputLength,
+                                      int         maxLineLength)
+{
+    BSLS_ASSERT(0 <= maxLineLength);
+
+    const bsl::size_t numChars = (inputLength + 2) / 3 * 4;
+    if (0 == maxLineLength || 0 == numChars) {
+        return numChars;                                              // RETURN
+    }
+    return numChars + (numChars - 1) / maxLineLength * u::k_SIZEOF_CRLF;
+}
+
+bsl::size_t Base64Util::encode(char        *output,
+                               const char  *input,
+                               bsl::size_t  inputLength,
+                               int          maxLineLength)
+{
+    BSLS_ASSERT(output || 0 == inputLength);
+    BSLS_ASSERT(input || 0 == inputLength);
+    BSLS_ASSERT(0 <= maxLineLength);
+
+    if (0 == maxLineLength) {
+        return u::encodeLine(output, input, inputLength);             // RETURN
+    }
+
+    if (0 != maxLineLength % 4) {
+        // Lines do not end on a group of 3 bytes: defer to the incremental
+        // encoder.
+
+        Base64Encoder     encoder(maxLineLength);
+        const char *const outputBegin = output;
+
+        while (inputLength) {
+            const bsl::size_t chunkLength = inputLength < u::k_CHUNK_LENGTH
+                                          ? inputLength
+                                          : u::k_CHUNK_LENGTH;
+            int numOut, numIn;
+            encoder.convert(output,
+                            &numOut,
+                            &numIn,
+                            input,
+                            input + chunkLength);
+            output      += numOut;
+            input       += chunkLength;
+            inputLength -= chunkLength;
+        }
+
+        int numOut;
+        encoder.endConvert(output, &numOut);
+        output += numOut;
+
+        return output - outputBegin;                                  // RETURN
+    }
+
+    const bsl::size_t bytesPerLine = maxLineLength / 4 * 3;
+    const char *const outputBegin  = output;
+
+    while (inputLength > bytesPerLine) {
+        output += u::encodeLine(output, input, bytesPerLine);
+        *output++ = '\r';
+        *output++ = '\n';
+        input       += bytesPerLine;
+        inputLength -= bytesPerLine;
+    }
+    output += u::encodeLine(output, input, inputLength);
+
+    return output - outputBegin;
+}
+
+int Base64Util::decode(char        *output,
+                       bsl::size_t *numOut,
+                       const char  *input,
+                       bsl::size_t  inputLength,
+                       bool         unrecognizedIsErrorFlag)
+{
+    BSLS_ASSERT(output || 0 == inputLength);
+    BSLS_ASSERT(numOut);
+    BSLS_ASSERT(input || 0 == inputLength);
+
+    enum State {
+        // States of the decoding, those of 'bdlde::Base64Decoder'.
+
+        e_INPUT_STATE,       // general input state
+        e_NEED_EQUAL_STATE,  // need an '='
+        e_SOFT_DONE_STATE    // only ignorable input allowed
+    };
+
+    const unsigned char *bytes =
+                                reinterpret_cast<const unsigned char *>(input);
+    const unsigned char *end   = bytes + inputLength;
+
+    char         *out   = output;
+    unsigned int  stack = 0;
+    int           bits  = 0;   // number of bits in 'stack'
+    State         state = e_INPUT_STATE;
+
+    while (bytes != end) {
+        if (0 == bits) {
+            // Decode as many groups of 4 Base64 characters as possible.
+
+            const bsl::size_t numDecoded = u::decodeBlocks(
+                                         out,
+                                         reinterpret_cast<const char *>(bytes),
+                                         end - bytes);
+            bytes += numDecoded;
+            out   += numDecoded / 4 * 3;
+
+            if (bytes == end) {
+                break;
+            }
+        }
+
+        const unsigned char byte  = *bytes++;
+        const unsigned int  value = u::k_DECODING[byte];
+
+        if (value < 64) {
+            stack = (stack << 6) | value;
+            bits += 6;
+            if (8 <= bits) {
+                bits -= 8;
+                *out++ = static_cast<char>((stack >> bits) & 0xff);
+            }
+        }
+        else if (!u::isIgnorable(byte, unrecognizedIsErrorFlag)) {
+            if ('=' != byte) {
+                return -1;                                            // RETURN
+            }
+
+            const int residualBits = (((out - output) % 3) * 8 + bits) % 24;
+            if (12 == residualBits && 0 == (stack & 0xf)) {
+                bits  = 0;
+                state = e_NEED_EQUAL_STATE;
+            }
+            else if (18 == residualBits && 0 == (stack & 0x3)) {
+                bits  = 0;
+                state = e_SOFT_DONE_STATE;
+            }
+            else {
+                return -1;                                            // RETURN
+            }
+            break;
+        }
+    }
+
+    if (e_NEED_EQUAL_STATE == state) {
+        while (bytes != end) {
+            const unsigned char byte = *bytes++;
+
+            if (!u::isIgnorable(byte, unrecognizedIsErrorFlag)) {
+                if ('=' != byte) {
+                    return -1;                                        // RETURN
+                }
+                state = e_SOFT_DONE_STATE;
+                break;
+            }
+        }
+    }
+
+    if (e_SOFT_DONE_STATE == state) {
+        while (bytes != end) {
+            if (!u::isIgnorable(*bytes++, unrecognizedIsErrorFlag)) {
+                return -1;                                            // RETURN
+            }
+        }
+    }
+
+    if (e_NEED_EQUAL_STATE == state || (e_INPUT_STATE == state && bits)) {
+        return -1;                                                    // RETURN
+    }
+
+    *numOut = out - output;
+    return 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#if defined(BDLDE_BASE64UTIL_SIMD)
+# undef BDLDE_BASE64UTIL_SIMD
+# undef BDLDE_BASE64UTIL_TARGET_SSSE3
+# undef BDLDE_BASE64UTIL_TARGET_AVX2
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,707 @@
+// bdlde_base64util.t.cpp                                             -*-C++-*-
+#include <bdlde_base64util.h>
+
+#include <bdlde_base64decoder.h>
+#include <bdlde_base64encoder.h>
+
+#include <bslim_testutil.h>
+
+#include <bsls_asserttest.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                              TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides one-shot Base64 encoding and decoding
+// functions whose results are specified to be those of the incremental
+// 'bdlde::Base64Encoder' and 'bdlde::Base64Decoder'.  We therefore use these
+// mechanisms as oracles, on inputs of all lengths up to several times the size
+// of the blocks processed by the vector kernels, at various alignments, and
+// for various maximum line lengths and error-reporting modes.  Since the
+// vector decoders classify input bytes by table lookups, every byte value is
+// also tested at every position of a block.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] bsl::size_t encodedLength(bsl::size_t inputLength, int maxLine);
+// [ 2] bsl::size_t maxDecodedLength(bsl::size_t inputLength);
+// [ 3] bsl::size_t encode(char *, const char *, bsl::size_t, int);
+// [ 4] int decode(char *, size_t *, const char *, size_t, bool);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                     NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlde::Base64Util Util;
+
+enum {
+    k_MAX_LENGTH = 200  // maximum length of the generated inputs; more than
+                        // 4 blocks of the widest vector kernel
+};
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static unsigned int nextRandom(unsigned int *state)
+    // Return the next value of the linear congruential generator having the
+    // specified 'state', and update 'state'.
+{
+    *state = *state * 1103515245u + 12345u;
+    return *state >> 8;
+}
+
+static bsl::string referenceEncode(const char  *input,
+                                   bsl::size_t  inputLength,
+                                   int          maxLineLength)
+    // Return the encoding of the specified 'input' of the specified
+    // 'inputLength' bytes produced by a 'bdlde::Base64Encoder' having the
+    // specified 'maxLineLength'.
+{
+    bdlde::Base64Encoder encoder(maxLineLength);
+    bsl::string          result;
+
+    encoder.convert(bsl::back_inserter(result), input, input + inputLength);
+    encoder.endConvert(bsl::back_inserter(result));
+
+    return result;
+}
+
+static int referenceDecode(bsl::string *result,
+                           const char  *input,
+                           bsl::size_t  inputLength,
+                           bool         unrecognizedIsErrorFlag)
+    // Load into the specified 'result' the decoding of the specified 'input'
+    // of the specified 'inputLength' characters produced by a
+    // 'bdlde::Base64Decoder' having the specified 'unrecognizedIsErrorFlag'.
+    // Return 0 if the decoder reports success, and a non-zero value otherwise.
+{
+    bdlde::Base64Decoder decoder(unrecognizedIsErrorFlag);
+
+    result->clear();
+    if (0 > decoder.convert(bsl::back_inserter(*result),
+                            input,
+                            input + inputLength)) {
+        return -1;                                                    // RETURN
+    }
+    return 0 > decoder.endConvert(bsl::back_inserter(*result)) ? -1 : 0;
+}
+
+static int testDecode(bsl::string *result,
+                      const char  *input,
+                      bsl::size_t  inputLength,
+                      bool         unrecognizedIsErrorFlag)
+    // Load into the specified 'result' the decoding of the specified 'input'
+    // of the specified 'inputLength' characters produced by
+    // 'bdlde::Base64Util::decode' with the specified
+    // 'unrecognizedIsErrorFlag', verifying that the capacity of the output
+    // buffer is not exceeded.  Return the value returned by 'decode'.
+{
+    const bsl::size_t capacity = Util::maxDecodedLength(inputLength);
+    const char        k_GUARD  = '\x5a';
+
+    bsl::vector<char> buffer(capacity + 64, k_GUARD);
+    bsl::size_t       numOut = 0;
+
+    const int rc = Util::decode(buffer.data(),
+                                &numOut,
+                                input,
+                                inputLength,
+                                unrecognizedIsErrorFlag);
+    for (bsl::size_t i = capacity; i < buffer.size(); ++i) {
+        ASSERTV(inputLength, i, k_GUARD == buffer[i]);
+    }
+    if (0 == rc) {
+        ASSERTV(inputLength, numOut, numOut <= capacity);
+        result->assign(buffer.data(), numOut);
+    }
+    return rc;
+}
+
+static void verifyDecode(const bsl::string& input, int line)
+    // Verify that 'bdlde::Base64Util::decode' and a 'bdlde::Base64Decoder'
+    // agree on the decoding of the specified 'input' (placed at various
+    // alignments) in both error-reporting modes, reporting any failure at
+    // the specified 'line'.
+{
+    static char storage[k_MAX_LENGTH * 4 + 64];
+
+    for (int strict = 0; strict < 2; ++strict) {
+        bsl::string expected;
+        const int   expectedRc = referenceDecode(&expected,
+                                                 input.data(),
+                                                 input.size(),
+                                                 strict);
+
+        for (int align = 0; align < 3; ++align) {
+            ASSERT(input.size() + align <= sizeof storage);
+            if (input.size()) {
+                bsl::memcpy(storage + align, input.data(), input.size());
+            }
+
+            bsl::string result;
+            const int   rc = testDecode(&result,
+                                        storage + align,
+                                        input.size(),
+                                        strict);
+
+            ASSERTV(line, strict, align, input, expectedRc, rc,
+                    (0 == expectedRc) == (0 == rc));
+            if (0 == expectedRc && 0 == rc) {
+                ASSERTV(line, strict, align, input, expected == result);
+            }
+        }
+    }
+}
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Encoding and Decoding a Buffer
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose that we have a binary payload that must be transmitted as text.
+//
+// First, we encode the payload in a buffer of the required size:
+//..
+    const char        payload[] = { 'm', 'a', 'n', 0x01, 0x02 };
+    const bsl::size_t length    = sizeof payload;
+
+    bsl::string encoded(bdlde::Base64Util::encodedLength(length), '\0');
+    bsl::size_t numEncoded = bdlde::Base64Util::encode(&encoded[0],
+                                                       payload,
+                                                       length);
+    ASSERT(encoded.size() == numEncoded);
+    ASSERT("bWFuAQI="     == encoded);
+//..
+// Then, we decode the text back into a buffer large enough for any input of
+// this length:
+//..
+    bsl::vector<char> decoded(
+                         bdlde::Base64Util::maxDecodedLength(encoded.size()));
+    bsl::size_t       numDecoded;
+
+    int rc = bdlde::Base64Util::decode(decoded.data(),
+                                       &numDecoded,
+                                       encoded.data(),
+                                       encoded.size());
+    ASSERT(0 == rc);
+
+    decoded.resize(numDecoded);
+    ASSERT(length == decoded.size());
+    ASSERT(0 == bsl::memcmp(decoded.data(), payload, length));
+//..
+// Finally, we observe that invalid input is rejected, and that whitespace is
+// ignored:
+//..
+    rc = bdlde::Base64Util::decode(decoded.data(), &numDecoded, "bWF*", 4);
+    ASSERT(0 != rc);
+
+    rc = bdlde::Base64Util::decode(decoded.data(), &numDecoded, "bW\r\nFu", 6);
+    ASSERT(0 == rc);
+    ASSERT(3 == numDecoded);
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // DECODE
+        //
+        // Concerns:
+        //: 1 'decode' succeeds if, and only if, a 'bdlde::Base64Decoder' with
+        //:   the same error-reporting mode succeeds on the same input, in
+        //:   which case the outputs are identical.
+        //:
+        //: 2 Whitespace, '=', and unrecognized characters are handled
+        //:   correctly wherever they occur, including within a block
+        //:   processed by a vector kernel.
+        //:
+        //: 3 Every byte value is classified correctly at every position of a
+        //:   block.
+        //:
+        //: 4 'decode' writes no more than 'maxDecodedLength(inputLength)'
+        //:   bytes.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For every input length up to 'k_MAX_LENGTH', encode random data,
+        //:   with and without line breaks, and verify that the encoding, and
+        //:   the encoding truncated by 1 to 3 characters, are decoded as by a
+        //:   'bdlde::Base64Decoder', writing nothing past the capacity of the
+        //:   output.  (C-1, 4)
+        //:
+        //: 2 Insert each of a set of special characters at random positions of
+        //:   the encodings, and repeat P-1.  (C-1..2, 4)
+        //:
+        //: 3 For every byte value, and every position in a valid encoding of
+        //:   96 characters, replace the character at this position by the
+        //:   byte, and repeat P-1.  (C-1, 3..4)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for null pointer arguments.  (C-5)
+        //
+        // Testing:
+        //   int decode(char *, size_t *, const char *, size_t, bool);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "DECODE" << endl
+                          << "======" << endl;
+
+        unsigned int seed = 12345;
+        char         input[k_MAX_LENGTH];
+
+        if (verbose) cout << "\tEncodings, complete and truncated." << endl;
+
+        for (int length = 0; length <= k_MAX_LENGTH; ++length) {
+            for (int i = 0; i < length; ++i) {
+                input[i] = static_cast<char>(nextRandom(&seed));
+            }
+
+            const bsl::string ENCODED = referenceEncode(input, length, 0);
+            const bsl::string LINES   = referenceEncode(input, length, 76);
+
+            verifyDecode(ENCODED, L_);
+            verifyDecode(LINES, L_);
+            for (bsl::size_t cut = 1; cut <= 3 && cut <= ENCODED.size();
+                                                                       ++cut) {
+                verifyDecode(ENCODED.substr(0, ENCODED.size() - cut), L_);
+            }
+        }
+
+        if (verbose) cout << "\tInsertion of special characters." << endl;
+
+        static const char SPECIAL[] = { ' ', '\t', '\n', '\r', '\v', '\f',
+                                        '=', '*', '-', '_', '\0', '\x7f',
+                                        '\x80', '\xff', 'A' };
+
+        for (int length = 0; length <= k_MAX_LENGTH; ++length) {
+            for (int i = 0; i < length; ++i) {
+                input[i] = static_cast<char>(nextRandom(&seed));
+            }
+
+            const bsl::string ENCODED = referenceEncode(input, length, 0);
+
+            for (bsl::size_t ti = 0; ti < sizeof SPECIAL; ++ti) {
+                for (int numInserted = 1; numInserted <= 3; ++numInserted) {
+                    bsl::string text(ENCODED);
+                    for (int k = 0; k < numInserted; ++k) {
+                        const bsl::size_t position =
+                                       nextRandom(&seed) % (text.size() + 1);
+                        text.insert(position, 1, SPECIAL[ti]);
+                    }
+                    if (veryVerbose) { T_ P(text) }
+                    verifyDecode(text, L_);
+                }
+            }
+        }
+
+        if (verbose) cout << "\tEvery byte at every position." << endl;
+        {
+            for (int i = 0; i < 72; ++i) {
+                input[i] = static_cast<char>(nextRandom(&seed));
+            }
+            const bsl::string ENCODED = referenceEncode(input, 72, 0);
+            ASSERT(96 == ENCODED.size());
+
+            for (int byte = 0; byte < 256; ++byte) {
+                for (bsl::size_t position = 0; position < ENCODED.size();
+                                                                  ++position) {
+                    bsl::string text(ENCODED);
+                    text[position] = static_cast<char>(byte);
+                    verifyDecode(text, L_);
+                }
+            }
+        }
+
+        if (verbose) cout << "\tNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            char        output[8];
+            bsl::size_t numOut;
+
+            ASSERT_PASS(Util::decode(output, &numOut, "QQ==", 4));
+            ASSERT_FAIL(Util::decode(0,      &numOut, "QQ==", 4));
+            ASSERT_FAIL(Util::decode(output, 0,       "QQ==", 4));
+            ASSERT_FAIL(Util::decode(output, &numOut, 0,      4));
+            ASSERT_PASS(Util::decode(output, &numOut, 0,      0));
+            ASSERT_PASS(Util::decode(0,      &numOut, 0,      0));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // ENCODE
+        //
+        // Concerns:
+        //: 1 The output of 'encode' is identical to that of a
+        //:   'bdlde::Base64Encoder' having the same maximum line length.
+        //:
+        //: 2 'encode' returns the number of characters written, which is
+        //:   'encodedLength(inputLength, maxLineLength)', and writes nothing
+        //:   past that number of characters.
+        //:
+        //: 3 The alignment of the input and output does not affect the
+        //:   result.
+        //:
+        //: 4 Every byte value is encoded correctly at every position of a
+        //:   block.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For every input length up to 'k_MAX_LENGTH', a set of maximum
+        //:   line lengths (multiples of 4 or not), and several alignments,
+        //:   encode random data, and compare the result with that of a
+        //:   'bdlde::Base64Encoder', verifying that guard bytes past the
+        //:   output are not modified.  (C-1..3)
+        //:
+        //: 2 Encode, for every byte value, inputs of 48 copies of the byte,
+        //:   and compare the result with that of a 'bdlde::Base64Encoder'.
+        //:   (C-4)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   bsl::size_t encode(char *, const char *, bsl::size_t, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ENCODE" << endl
+                          << "======" << endl;
+
+        static const int LINE_LENGTHS[] = { 0, 1, 2, 3, 4, 5, 7, 8, 12, 16,
+                                            19, 32, 64, 76, 77, 80 };
+        const int NUM_LINE_LENGTHS = sizeof LINE_LENGTHS
+                                                      / sizeof *LINE_LENGTHS;
+
+        const char   k_GUARD = '\x5a';
+        unsigned int seed    = 54321;
+        char         storage[k_MAX_LENGTH + 32];
+
+        for (int length = 0; length <= k_MAX_LENGTH; ++length) {
+            for (int ti = 0; ti < NUM_LINE_LENGTHS; ++ti) {
+                const int LINE = LINE_LENGTHS[ti];
+
+                for (int align = 0; align < 4; ++align) {
+                    char *const input = storage + align;
+                    for (int i = 0; i < length; ++i) {
+                        input[i] = static_cast<char>(nextRandom(&seed));
+                    }
+
+                    const bsl::string EXPECTED = referenceEncode(input,
+                                                                 length,
+                                                                 LINE);
+                    const bsl::size_t SIZE = Util::encodedLength(length, LINE);
+                    ASSERTV(length, LINE, EXPECTED.size() == SIZE);
+
+                    bsl::vector<char> output(SIZE + align + 64, k_GUARD);
+
+                    const bsl::size_t numOut = Util::encode(
+                                                       output.data() + align,
+                                                       input,
+                                                       length,
+                                                       LINE);
+                    ASSERTV(length, LINE, align, numOut, SIZE == numOut);
+                    ASSERTV(length, LINE, align,
+                            EXPECTED == bsl::string(output.data() + align,
+                                                    SIZE));
+
+                    for (bsl::size_t i = 0; i < static_cast<bsl::size_t>(
+                                                                align); ++i) {
+                        ASSERTV(length, LINE, align, i,
+                                k_GUARD == output[i]);
+                    }
+                    for (bsl::size_t i = SIZE + align; i < output.size();
+                                                                         ++i) {
+                        ASSERTV(length, LINE, align, i,
+                                k_GUARD == output[i]);
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "\tEvery byte value." << endl;
+
+        for (int byte = 0; byte < 256; ++byte) {
+            for (int phase = 0; phase < 3; ++phase) {
+                char input[48];
+                bsl::memset(input, byte, sizeof input);
+                input[phase] = static_cast<char>(byte ^ 0x5a);
+
+                const bsl::string EXPECTED = referenceEncode(input,
+                                                             sizeof input,
+                                                             0);
+                char              output[64];
+
+                ASSERTV(byte, 64 == Util::encode(output, input, sizeof input));
+                ASSERTV(byte, phase,
+                        EXPECTED == bsl::string(output, sizeof output));
+            }
+        }
+
+        if (verbose) cout << "\tNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            char output[8];
+
+            ASSERT_PASS(Util::encode(output, "a", 1));
+            ASSERT_FAIL(Util::encode(0,      "a", 1));
+            ASSERT_FAIL(Util::encode(output, 0,   1));
+            ASSERT_PASS(Util::encode(output, 0,   0));
+            ASSERT_PASS(Util::encode(0,      0,   0));
+            ASSERT_FAIL(Util::encode(output, "a", 1, -1));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // LENGTH FUNCTIONS
+        //
+        // Concerns:
+        //: 1 'encodedLength' returns the length of the output of a
+        //:   'bdlde::Base64Encoder' having the same maximum line length.
+        //:
+        //: 2 'maxDecodedLength' is an upper bound of the length of the
+        //:   decoding of any input of that length, and is reached.
+        //:
+        //: 3 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Compare 'encodedLength' with
+        //:   'bdlde::Base64Encoder::encodedLength' for a range of input and
+        //:   line lengths.  (C-1)
+        //:
+        //: 2 Verify 'maxDecodedLength' for a range of lengths against
+        //:   '3 * ceil(n / 4)', the length of the decoding of 'n' Base64
+        //:   characters (and a partial trailing group being an error).  (C-2)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for negative line lengths.  (C-3)
+        //
+        // Testing:
+        //   bsl::size_t encodedLength(bsl::size_t inputLength, int maxLine);
+        //   bsl::size_t maxDecodedLength(bsl::size_t inputLength);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "LENGTH FUNCTIONS" << endl
+                          << "================" << endl;
+
+        for (int length = 0; length <= 1000; ++length) {
+            ASSERTV(length,
+                    static_cast<bsl::size_t>(
+                              bdlde::Base64Encoder::encodedLength(length, 0))
+                                            == Util::encodedLength(length));
+
+            for (int line = 1; line <= 100; ++line) {
+                ASSERTV(length, line,
+                        static_cast<bsl::size_t>(
+                            bdlde::Base64Encoder::encodedLength(length, line))
+                                      == Util::encodedLength(length, line));
+            }
+
+            ASSERTV(length, (length + 3) / 4 * 3 ==
+                         static_cast<int>(Util::maxDecodedLength(length)));
+        }
+
+        if (verbose) cout << "\tNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(Util::encodedLength(1, 0));
+            ASSERT_FAIL(Util::encodedLength(1, -1));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Encode and decode the test vectors of RFC 4648.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        static const struct {
+            int         d_line;
+            const char *d_input_p;
+            const char *d_expected_p;
+        } DATA[] = {
+            //LINE  INPUT     EXPECTED
+            //----  --------  ----------
+            { L_,   "",       ""         },
+            { L_,   "f",      "Zg=="     },
+            { L_,   "fo",     "Zm8="     },
+            { L_,   "foo",    "Zm9v"     },
+            { L_,   "foob",   "Zm9vYg==" },
+            { L_,   "fooba",  "Zm9vYmE=" },
+            { L_,   "foobar", "Zm9vYmFy" },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int          LINE     = DATA[ti].d_line;
+            const char *const  INPUT    = DATA[ti].d_input_p;
+            const char *const  EXPECTED = DATA[ti].d_expected_p;
+            const bsl::size_t  LENGTH   = bsl::strlen(INPUT);
+
+            char        encoded[16];
+            const bsl::size_t numEncoded = Util::encode(encoded,
+                                                        INPUT,
+                                                        LENGTH);
+            ASSERTV(LINE, EXPECTED == bsl::string(encoded, numEncoded));
+
+            char        decoded[16];
+            bsl::size_t numDecoded;
+            ASSERTV(LINE, 0 == Util::decode(decoded,
+                                            &numDecoded,
+                                            encoded,
+                                            numEncoded));
+            ASSERTV(LINE, bsl::string(INPUT) == bsl::string(decoded,
+                                                            numDecoded));
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,194 @@
+// bdlma_numalocalallocator.cpp                                       -*-C++-*-
+#include <bdlma_numalocalallocator.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlma_numalocalallocator_cpp,"$Id$ $CSID$")
+
+#include <bslma_default.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_bslexceptionutil.h>
+#include <bsls_platform.h>
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+# include <sys/mman.h>
+# include <sys/syscall.h>
+# include <unistd.h>
+#endif
+
+///Implementation Notes
+///--------------------
+// On Linux, each block obtained by the chunk allocator is a separate
+// anonymous mapping, prefixed by a header recording the length of the mapping
+// so that 'deallocate' can unmap it.  The mapping is bound to the node with
+// the 'mbind' system call (invoked directly, so as not to depend on
+// 'libnuma') using the 'MPOL_PREFERRED' policy.  Since the kernel allocates
+// the physical pages on first access, the binding applies to every page of
+// the mapping, whichever thread touches it first.  A failure to bind is
+// ignored: the memory is then placed according to the default (first touch)
+// policy of the task.
+
+namespace BloombergLP {
+namespace bdlma {
+namespace {
+namespace u {
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+const int k_MPOL_PREFERRED = 1;     // 'MPOL_PREFERRED' (see 'mbind(2)')
+
+const int k_MAX_NODES      = 1024;  // maximum number of nodes supported
+
+const int k_HEADER_SIZE    = bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT;
+    // size of the header preceding each block, preserving the alignment of
+    // the mapping
+
+bsls::Types::size_type pageSize()
+    // Return the size of a page of virtual memory.
+{
+    static const bsls::Types::size_type size = sysconf(_SC_PAGESIZE);
+    return size;
+}
+
+void bindToNode(void *address, bsls::Types::size_type size, int node)
+    // Request the physical pages of the mapping of the specified 'size' (in
+    // bytes) at the specified 'address' to be placed, preferably, on the
+    // specified 'node'.
+{
+    if (node >= k_MAX_NODES) {
+        return;                                                       // RETURN
+    }
+
+    enum { k_BITS_PER_WORD = 8 * sizeof(unsigned long) };
+
+    unsigned long nodeMask[k_MAX_NODES / k_BITS_PER_WORD] = { 0 };
+    nodeMask[node / k_BITS_PER_WORD] = 1UL << (node % k_BITS_PER_WORD);
+
+    // Note that the kernel interprets 'maxnode' as one more than the number
+    // of bits in 'nodeMask'.
+
+    syscall(SYS_mbind,
+            address,
+            size,
+            k_MPOL_PREFERRED,
+            nodeMask,
+            static_cast<unsigned long>(k_MAX_NODES + 1),
+            0);
+}
+#endif
+
+}  // close namespace u
+}  // close unnamed namespace
+
+                    // --------------------------------------
+                    // class NumaLocalAllocator_ChunkAllocator
+                    // --------------------------------------
+
+// CREATORS
+NumaLocalAllocator_ChunkAllocator::NumaLocalAllocator_ChunkAllocator(
+                                              int               node,
+                                              bslma::Allocator *basicAllocator)
+: d_node(node)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 <= node);
+}
+
+NumaLocalAllocator_ChunkAllocator::~NumaLocalAllocator_ChunkAllocator()
+{
+}
+
+// MANIPULATORS
+void *NumaLocalAllocator_ChunkAllocator::allocate(bsls::Types::size_type size)
+{
+    if (0 == size) {
+        return 0;                                                     // RETURN
+    }
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    const bsls::Types::size_type pageMask = u::pageSize() - 1;
+    const bsls::Types::size_type length   =
+                              (size + u::k_HEADER_SIZE + pageMask) & ~pageMask;
+
+    void *mapping = mmap(0,
+                         length,
+                         PROT_READ | PROT_WRITE,
+                         MAP_ANONYMOUS | MAP_PRIVATE,
+                         -1,
+                         0);
+    if (MAP_FAILED == mapping) {
+        bsls::BslExceptionUtil::throwBadAlloc();
+    }
+
+    u::bindToNode(mapping, length, d_node);
+
+    *static_cast<bsls::Types::size_type *>(mapping) = length;
+    return static_cast<char *>(mapping) + u::k_HEADER_SIZE;
+#else
+    return d_allocator_p->allocate(size);
+#endif
+}
+
+void NumaLocalAllocator_ChunkAllocator::deallocate(void *address)
+{
+    if (0 == address) {
+        return;                                                       // RETURN
+    }
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    void *mapping = static_cast<char *>(address) - u::k_HEADER_SIZE;
+    munmap(mapping, *static_cast<bsls::Types::size_type *>(mapping));
+#else
+    d_allocator_p->deallocate(address);
+#endif
+}
+
+                         // ------------------------
+                         // class NumaLocalAllocator
+                         // ------------------------
+
+// CLASS METHODS
+int NumaLocalAllocator::currentNode()
+{
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    unsigned int cpu  = 0;
+    unsigned int node = 0;
+    if (0 == syscall(SYS_getcpu, &cpu, &node, 0)) {
+        return static_cast<int>(node);                                // RETURN
+    }
+#endif
+    return 0;
+}
+
+// CREATORS
+NumaLocalAllocator::NumaLocalAllocator(int               node,
+                                       bslma::Allocator *basicAllocator)
+: d_chunkAllocator(k_CURRENT_NODE == node ? currentNode() : node,
+                   basicAllocator)
+, d_multipool(&d_chunkAllocator)
+{
+    BSLS_ASSERT(k_CURRENT_NODE == node || 0 <= node);
+}
+
+NumaLocalAllocator::~NumaLocalAllocator()
+{
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
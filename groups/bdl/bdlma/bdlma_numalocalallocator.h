@@ -0,0 +1,285 @@
+// bdlma_numalocalallocator.h                                         -*-C++-*-
+#ifndef INCLUDED_BDLMA_NUMALOCALALLOCATOR
+#define INCLUDED_BDLMA_NUMALOCALALLOCATOR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a thread-safe allocator of memory local to a NUMA node.
+//
+//@CLASSES:
+//  bdlma::NumaLocalAllocator: pooling allocator of node-local memory
+//
+//@SEE_ALSO: bdlma_concurrentmultipoolallocator, bdlma_heapbypassallocator
+//
+//@DESCRIPTION: This component provides a thread-safe allocator,
+// 'bdlma::NumaLocalAllocator', that implements the 'bdlma::ManagedAllocator'
+// protocol and dispenses memory physically located on a specified NUMA node.
+// On hosts having several sockets, each socket accesses its own ("local")
+// memory faster than the memory attached to the other sockets; the threads
+// that run on the CPUs of one node (see 'bslmt::ThreadAttributes::cpuAffinity'
+// and 'bdlmt_threadplacementutil') therefore benefit from allocating the data
+// they work on from an allocator bound to that node.
+//..
+//   ,-------------------------.
+//  ( bdlma::NumaLocalAllocator )
+//   `-------------------------'
+//               |         ctor/dtor
+//               |         node
+//               |         currentNode
+//               V
+//    ,-----------------------.
+//   ( bdlma::ManagedAllocator )
+//    `-----------------------'
+//               |         release
+//               V
+//       ,----------------.
+//      ( bslma::Allocator )
+//       `----------------'
+//                        allocate
+//                        deallocate
+//..
+// Small blocks are pooled by size, as by a
+// 'bdlma::ConcurrentMultipoolAllocator', so that the (comparatively costly)
+// binding of memory to a node is amortized over many allocations; the pools,
+// and the blocks too large to be pooled, obtain their memory from anonymous
+// memory mappings that are bound to the node with a *preferred* policy: the
+// pages are placed on the node when it has free memory, and elsewhere
+// otherwise, so an allocation never fails merely because the node is full.
+// Both 'release' and the destructor release all the memory allocated through
+// the allocator.
+//
+///Platform Support
+///----------------
+// Binding memory to a node is supported on Linux only.  On other platforms,
+// and on kernels or hosts without NUMA support (where the binding request
+// fails), 'bdlma::NumaLocalAllocator' behaves as a
+// 'bdlma::ConcurrentMultipoolAllocator'; 'currentNode' then always returns 0.
+//
+///Thread Safety
+///-------------
+// 'bdlma::NumaLocalAllocator' is *fully thread-safe*, meaning any operation on
+// the same object can be safely invoked from any thread.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Allocating the Data of a Worker from its Node
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a worker thread, bound to the CPUs of a node, builds a large
+// table.  We allocate the table from the node on which the thread runs:
+//..
+//  bdlma::NumaLocalAllocator allocator;  // current node
+//  assert(0 <= allocator.node());
+//
+//  bsl::vector<int> table(&allocator);
+//  for (int i = 0; i < 100000; ++i) {
+//      table.push_back(i);
+//  }
+//  assert(100000 == table.size());
+//..
+// Finally, note that the memory of the table is released to the operating
+// system when 'table', then 'allocator', go out of scope.
+
+#include <bdlscm_version.h>
+
+#include <bdlma_concurrentmultipoolallocator.h>
+#include <bdlma_managedallocator.h>
+
+#include <bslma_allocator.h>
+
+#include <bsls_keyword.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace bdlma {
+
+                    // ======================================
+                    // class NumaLocalAllocator_ChunkAllocator
+                    // ======================================
+
+class NumaLocalAllocator_ChunkAllocator : public bslma::Allocator {
+    // This component-private class implements a thread-safe allocator that
+    // maps each allocated block directly from virtual memory and binds it to
+    // a NUMA node, falling back on an underlying allocator on platforms that
+    // do not support memory mappings.  This class should not be used outside
+    // of this component.
+
+    // DATA
+    int               d_node;         // node to which memory is bound
+
+    bslma::Allocator *d_allocator_p;  // fallback allocator (held, not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    NumaLocalAllocator_ChunkAllocator(
+                                     const NumaLocalAllocator_ChunkAllocator&);
+    NumaLocalAllocator_ChunkAllocator& operator=(
+                                     const NumaLocalAllocator_ChunkAllocator&);
+
+  public:
+    // CREATORS
+    NumaLocalAllocator_ChunkAllocator(int               node,
+                                      bslma::Allocator *basicAllocator);
+        // Create an allocator binding the memory it allocates to the
+        // specified 'node', and using the specified 'basicAllocator' on
+        // platforms that do not support memory mappings.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.
+
+    ~NumaLocalAllocator_ChunkAllocator() BSLS_KEYWORD_OVERRIDE;
+        // Destroy this allocator.  The behavior is undefined unless all the
+        // memory allocated from this allocator has been deallocated.
+
+    // MANIPULATORS
+    void *allocate(bsls::Types::size_type size) BSLS_KEYWORD_OVERRIDE;
+        // Return the address of a newly allocated, maximally aligned block of
+        // at least the specified 'size' (in bytes), or 0 if '0 == size'.
+
+    void deallocate(void *address) BSLS_KEYWORD_OVERRIDE;
+        // Return the memory block at the specified 'address' to the operating
+        // system.  If 'address' is 0, this method has no effect.  The behavior
+        // is undefined unless 'address' was returned by 'allocate' and has not
+        // already been deallocated.
+
+    // ACCESSORS
+    int node() const;
+        // Return the node to which the memory allocated by this allocator is
+        // bound.
+};
+
+                         // ========================
+                         // class NumaLocalAllocator
+                         // ========================
+
+class NumaLocalAllocator : public ManagedAllocator {
+    // This class implements the 'bdlma::ManagedAllocator' protocol to provide
+    // a thread-safe allocator that pools memory bound to a NUMA node.
+
+    // DATA
+    NumaLocalAllocator_ChunkAllocator d_chunkAllocator;  // source of bound
+                                                         // memory
+
+    ConcurrentMultipoolAllocator      d_multipool;       // pools of blocks
+
+  private:
+    // NOT IMPLEMENTED
+    NumaLocalAllocator(const NumaLocalAllocator&);
+    NumaLocalAllocator& operator=(const NumaLocalAllocator&);
+
+  public:
+    // CONSTANTS
+    enum { k_CURRENT_NODE = -1 };  // designates the node of the calling CPU
+
+    // CLASS METHODS
+    static int currentNode();
+        // Return the NUMA node of the CPU on which the calling thread is
+        // running, or 0 if it cannot be determined.  Note that, unless the
+        // thread is confined to the CPUs of one node, the returned value may
+        // be out of date as soon as it is returned.
+
+    // CREATORS
+    explicit NumaLocalAllocator(int               node           =
+                                                                k_CURRENT_NODE,
+                                bslma::Allocator *basicAllocator = 0);
+        // Create an allocator of memory bound to the specified 'node'.  If
+        // 'node' is not specified or is 'k_CURRENT_NODE', the node of the CPU
+        // running the calling thread (see 'currentNode') is used.  Optionally
+        // specify a 'basicAllocator' used to supply memory on platforms that
+        // do not support memory mappings (see {Platform Support}).  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless
+        // 'k_CURRENT_NODE == node || 0 <= node'.
+
+    ~NumaLocalAllocator() BSLS_KEYWORD_OVERRIDE;
+        // Destroy this allocator.  All memory allocated from this allocator is
+        // released.
+
+    // MANIPULATORS
+    void *allocate(bsls::Types::size_type size) BSLS_KEYWORD_OVERRIDE;
+        // Return the address of a contiguous block of maximally aligned memory
+        // of (at least) the specified 'size' (in bytes), located on the node
+        // of this allocator if possible.  If 'size' is 0, no memory is
+        // allocated and 0 is returned.
+
+    void deallocate(void *address) BSLS_KEYWORD_OVERRIDE;
+        // Return the memory block at the specified 'address' back to this
+        // allocator.  If 'address' is 0, this method has no effect.  The
+        // behavior is undefined unless 'address' was allocated by this
+        // allocator, and has not already been deallocated.
+
+    void release() BSLS_KEYWORD_OVERRIDE;
+        // Release all memory currently allocated through this allocator.
+
+    // ACCESSORS
+    int node() const;
+        // Return the NUMA node to which the memory dispensed by this allocator
+        // is bound.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                    // --------------------------------------
+                    // class NumaLocalAllocator_ChunkAllocator
+                    // --------------------------------------
+
+// ACCESSORS
+inline
+int NumaLocalAllocator_ChunkAllocator::node() const
+{
+    return d_node;
+}
+
+                         // ------------------------
+                         // class NumaLocalAllocator
+                         // ------------------------
+
+// MANIPULATORS
+inline
+void *NumaLocalAllocator::allocate(bsls::Types::size_type size)
+{
+    return d_multipool.allocate(size);
+}
+
+inline
+void NumaLocalAllocator::deallocate(void *address)
+{
+    d_multipool.deallocate(address);
+}
+
+inline
+void NumaLocalAllocator::release()
+{
+    d_multipool.release();
+}
+
+// ACCESSORS
+inline
+int NumaLocalAllocator::node() const
+{
+    return d_chunkAllocator.node();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
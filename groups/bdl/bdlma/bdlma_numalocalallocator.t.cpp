@@ -0,0 +1,518 @@
+// bdlma_numalocalallocator.t.cpp                                     -*-C++-*-
+
+#include <bdlma_numalocalallocator.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_threadutil.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>        // 'atoi'
+#include <bsl_cstring.h>        // 'memset'
+#include <bsl_iostream.h>
+#include <bsl_vector.h>
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+# include <sys/syscall.h>
+# include <unistd.h>
+#endif
+
+using namespace BloombergLP;
+
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                                TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// 'bdlma::NumaLocalAllocator' pools memory obtained from a component-private
+// allocator that maps blocks directly from the operating system.  The primary
+// concerns are that the returned memory is usable and maximally aligned, that
+// it is obtained neither from the default nor from the supplied allocator (on
+// Linux), that 'release' and the destructor return it, and that the
+// allocator can be used concurrently.  The placement of the pages on a node
+// is best-effort, and is verified only on Linux hosts where it is observable.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] static int currentNode();
+//
+// CREATORS
+// [ 2] explicit NumaLocalAllocator(int node, bslma::Allocator *ba);
+// [ 2] ~NumaLocalAllocator();
+//
+// MANIPULATORS
+// [ 3] void *allocate(bsls::Types::size_type size);
+// [ 3] void deallocate(void *address);
+// [ 3] void release();
+//
+// ACCESSORS
+// [ 2] int node() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CONCURRENCY TEST
+// [ 5] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlma::NumaLocalAllocator Obj;
+
+const int k_MAX_ALIGN = bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT;
+
+// ============================================================================
+//                   GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+bool isMaxAligned(const void *address)
+    // Return 'true' if the specified 'address' is maximally aligned, and
+    // 'false' otherwise.
+{
+    return 0 == reinterpret_cast<bsls::Types::UintPtr>(address) % k_MAX_ALIGN;
+}
+
+int nodeOfPage(void *address)
+    // Return the NUMA node on which the page at the specified 'address' is
+    // located, or -1 if it cannot be determined.
+{
+#if defined(BSLS_PLATFORM_OS_LINUX) && defined(SYS_move_pages)
+    void *page   = address;
+    int   status = -1;
+    if (0 == syscall(SYS_move_pages, 0, 1UL, &page, 0, &status, 0)) {
+        return status;                                                // RETURN
+    }
+#else
+    (void)address;
+#endif
+    return -1;
+}
+
+}  // close unnamed namespace
+
+                            // ==================
+                            // namespace TEST_4
+                            // ==================
+
+namespace TEST_4 {
+
+enum { k_NUM_THREADS = 4, k_NUM_ITERATIONS = 2000 };
+
+struct Worker {
+    // This 'struct' defines a functor that repeatedly allocates, fills,
+    // verifies, and deallocates blocks of various sizes from a shared
+    // allocator.
+
+    // DATA
+    Obj *d_allocator_p;  // shared allocator
+    int  d_id;           // distinguishes the content written by this worker
+
+    // ACCESSORS
+    void operator()() const
+        // Run the test.
+    {
+        bsl::vector<void *> blocks;
+        for (int i = 0; i < k_NUM_ITERATIONS; ++i) {
+            const int  size  = 1 + (i * 37) % 3000;
+            char      *block = static_cast<char *>(
+                                              d_allocator_p->allocate(size));
+            ASSERT(block);
+            ASSERT(isMaxAligned(block));
+            bsl::memset(block, d_id, size);
+            blocks.push_back(block);
+
+            if (i % 4 == 3) {
+                for (bsl::size_t j = 0; j < blocks.size(); ++j) {
+                    char *b = static_cast<char *>(blocks[j]);
+                    ASSERTV(d_id, b[0], d_id == b[0]);
+                    d_allocator_p->deallocate(b);
+                }
+                blocks.clear();
+            }
+        }
+        for (bsl::size_t j = 0; j < blocks.size(); ++j) {
+            d_allocator_p->deallocate(blocks[j]);
+        }
+    }
+};
+
+}  // close namespace TEST_4
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator         da("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "USAGE EXAMPLE" << endl
+                                  << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Allocating the Data of a Worker from its Node
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a worker thread, bound to the CPUs of a node, builds a large
+// table.  We allocate the table from the node on which the thread runs:
+//..
+    {
+        bdlma::NumaLocalAllocator allocator;  // current node
+        ASSERT(0 <= allocator.node());
+
+        bsl::vector<int> table(&allocator);
+        for (int i = 0; i < 100000; ++i) {
+            table.push_back(i);
+        }
+        ASSERT(100000 == table.size());
+    }
+//..
+// Finally, note that the memory of the table is released to the operating
+// system when 'table', then 'allocator', go out of scope.
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY TEST
+        //
+        // Concerns:
+        //: 1 The allocator can be used concurrently by several threads, and
+        //:   the blocks allocated by one thread are not handed to another
+        //:   before being deallocated.
+        //
+        // Plan:
+        //: 1 Create several threads that repeatedly allocate blocks of
+        //:   various sizes from a shared allocator, fill each block with a
+        //:   value specific to the thread, verify the content of the blocks,
+        //:   and deallocate them.  (C-1)
+        //
+        // Testing:
+        //   CONCURRENCY TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "CONCURRENCY TEST" << endl
+                                  << "================" << endl;
+
+        using namespace TEST_4;
+
+        Obj mX;
+
+        bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            Worker worker = { &mX, i + 1 };
+            ASSERT(0 == bslmt::ThreadUtil::createWithAllocator(
+                                            &handles[i],
+                                            worker,
+                                            bslma::Default::globalAllocator()));
+        }
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+        }
+
+        mX.release();
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // ALLOCATE, DEALLOCATE, AND RELEASE
+        //
+        // Concerns:
+        //: 1 'allocate' returns 0 for a request of 0 bytes.
+        //:
+        //: 2 'allocate' returns maximally aligned, writable blocks of the
+        //:   requested size, both for sizes that are pooled and for sizes that
+        //:   are too large to be pooled.
+        //:
+        //: 3 On Linux, no memory is obtained from the supplied or the default
+        //:   allocator.
+        //:
+        //: 4 'deallocate' accepts 0, and makes the deallocated block available
+        //:   for reuse.
+        //:
+        //: 5 'release' makes the allocator usable again.
+        //:
+        //: 6 On Linux hosts where page placement is observable, the allocated
+        //:   pages are located on the node of the allocator.
+        //
+        // Plan:
+        //: 1 Allocate 0 bytes and verify that 0 is returned.  (C-1)
+        //:
+        //: 2 Allocate blocks of sizes from 1 byte to several megabytes,
+        //:   verify their alignment, and write to all of their bytes.  (C-2)
+        //:
+        //: 3 Verify the number of allocations of the test allocators.  (C-3)
+        //:
+        //: 4 Deallocate the blocks, including a null pointer, then verify that
+        //:   allocating a pooled block of a size just deallocated returns the
+        //:   same address.  (C-4)
+        //:
+        //: 5 Allocate blocks, invoke 'release', and allocate again.  (C-5)
+        //:
+        //: 6 Query the node of a page of a large block with 'move_pages', if
+        //:   supported.  (C-6)
+        //
+        // Testing:
+        //   void *allocate(bsls::Types::size_type size);
+        //   void deallocate(void *address);
+        //   void release();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "ALLOCATE, DEALLOCATE, AND RELEASE"
+                          << endl << "================================="
+                          << endl;
+
+        bslma::TestAllocator sa("supplied", veryVeryVerbose);
+
+        {
+            Obj mX(Obj::k_CURRENT_NODE, &sa);
+
+            ASSERT(0 == mX.allocate(0));
+
+            static const bsls::Types::size_type SIZES[] = {
+                1, 2, 7, 8, 15, 16, 17, 100, 1000, 4095, 4096, 4097, 10000,
+                100000, 1 << 20, 5 << 20
+            };
+            enum { k_NUM_SIZES = sizeof SIZES / sizeof *SIZES };
+
+            void *blocks[k_NUM_SIZES];
+            for (int i = 0; i < k_NUM_SIZES; ++i) {
+                const bsls::Types::size_type SIZE = SIZES[i];
+
+                if (veryVerbose) { T_ P(SIZE) }
+
+                blocks[i] = mX.allocate(SIZE);
+                ASSERTV(SIZE, blocks[i]);
+                ASSERTV(SIZE, isMaxAligned(blocks[i]));
+
+                bsl::memset(blocks[i], 0xA5, SIZE);
+            }
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+            ASSERTV(sa.numAllocations(), 0 == sa.numAllocations());
+#endif
+            ASSERTV(da.numAllocations(), 0 == da.numAllocations());
+
+            const int NODE = nodeOfPage(blocks[k_NUM_SIZES - 1]);
+            if (veryVerbose) { T_ P_(mX.node()) P(NODE) }
+            ASSERTV(mX.node(), NODE, -1 >= NODE || mX.node() == NODE);
+
+            mX.deallocate(0);
+            for (int i = 0; i < k_NUM_SIZES; ++i) {
+                mX.deallocate(blocks[i]);
+            }
+
+            void *p = mX.allocate(100);
+            mX.deallocate(p);
+            ASSERT(p == mX.allocate(100));
+
+            mX.release();
+
+            for (int i = 0; i < k_NUM_SIZES; ++i) {
+                void *q = mX.allocate(SIZES[i]);
+                ASSERTV(SIZES[i], q);
+                bsl::memset(q, 0x5A, SIZES[i]);
+            }
+        }
+        ASSERTV(sa.numBlocksInUse(), 0 == sa.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CONSTRUCTOR AND 'currentNode'
+        //
+        // Concerns:
+        //: 1 'currentNode' returns a non-negative value.
+        //:
+        //: 2 An allocator constructed with 'k_CURRENT_NODE' (or without
+        //:   argument) is bound to the node of the calling thread.
+        //:
+        //: 3 An allocator constructed with an explicit node is bound to that
+        //:   node, even if the host has no such node, and remains usable.
+        //
+        // Plan:
+        //: 1 Call 'currentNode' and verify its result.  (C-1)
+        //:
+        //: 2 Construct allocators with the default arguments and with
+        //:   'k_CURRENT_NODE', and verify 'node'.  (C-2)
+        //:
+        //: 3 Construct allocators with nodes 0, 1, and 1023, verify 'node',
+        //:   and allocate from them.  (C-3)
+        //
+        // Testing:
+        //   static int currentNode();
+        //   explicit NumaLocalAllocator(int node, bslma::Allocator *ba);
+        //   ~NumaLocalAllocator();
+        //   int node() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "CONSTRUCTOR AND 'currentNode'" << endl
+                                  << "=============================" << endl;
+
+        const int CURRENT = Obj::currentNode();
+        if (veryVerbose) { T_ P(CURRENT) }
+        ASSERT(0 <= CURRENT);
+
+        {
+            Obj mX;  const Obj& X = mX;
+            Obj mY(Obj::k_CURRENT_NODE);  const Obj& Y = mY;
+
+            // The thread is not bound to a node, so it may have migrated.
+
+            ASSERT(0 <= X.node());
+            ASSERT(0 <= Y.node());
+        }
+
+        static const int NODES[] = { 0, 1, 1023 };
+        enum { k_NUM_NODES = sizeof NODES / sizeof *NODES };
+
+        for (int i = 0; i < k_NUM_NODES; ++i) {
+            const int NODE = NODES[i];
+
+            Obj mX(NODE);  const Obj& X = mX;
+            ASSERTV(NODE, X.node(), NODE == X.node());
+
+            char *p = static_cast<char *>(mX.allocate(10000));
+            ASSERTV(NODE, p);
+            bsl::memset(p, 0, 10000);
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create an allocator, allocate and deallocate a few blocks, and
+        //:   let the allocator release the remaining ones.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "BREATHING TEST" << endl
+                                  << "==============" << endl;
+
+        Obj mX;
+
+        void *p = mX.allocate(10);
+        void *q = mX.allocate(1000);
+        void *r = mX.allocate(100000);
+
+        ASSERT(p && q && r);
+        ASSERT(p != q && q != r && p != r);
+
+        bsl::memset(p, 1, 10);
+        bsl::memset(q, 2, 1000);
+        bsl::memset(r, 3, 100000);
+
+        mX.deallocate(q);
+        mX.deallocate(r);
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
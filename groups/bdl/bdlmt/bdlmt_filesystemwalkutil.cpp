@@ -0,0 +1,548 @@
+// bdlmt_filesystemwalkutil.cpp                                       -*-C++-*-
+#include <bdlmt_filesystemwalkutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlmt_filesystemwalkutil_cpp,"$Id$ $CSID$")
+
+#include <bdlmt_threadpool.h>
+
+#include <bdls_filesystemutil.h>
+#include <bdls_pathutil.h>
+
+#include <bdlf_bind.h>
+
+#include <bslma_default.h>
+#include <bslma_managedptr.h>
+
+#include <bslmt_condition.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_platform.h>
+
+#include <bsl_deque.h>
+#include <bsl_vector.h>
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <bdlde_charconvertutf16.h>
+
+#include <windows.h>
+#else
+#include <bsl_c_errno.h>
+
+#include <dirent.h>
+#include <fnmatch.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#endif
+
+///Implementation Notes
+///--------------------
+// The directories remaining to be read are held in a queue shared by the
+// calling thread and by "helper" jobs submitted to the thread pool.  Each
+// participant repeatedly takes a directory from the queue, reads it
+// (reporting the matching entries), and appends its subdirectories to the
+// queue, until the queue is empty.  Whenever directories are appended, a
+// helper job is submitted if fewer helpers than the maximum number of threads
+// of the pool are running, so that the number of jobs in the pool is bounded
+// regardless of the shape of the tree.  The number of "outstanding"
+// directories (queued or being read) is maintained so that the calling
+// thread, having emptied the queue, can wait until the directories read by
+// helpers have been read (and their subdirectories, possibly, appended, in
+// which case the calling thread resumes taking part in the walk).  The
+// calling thread returns only when no directory is outstanding and no helper
+// is running, since helpers refer to state on the stack of the calling
+// thread.
+//
+// Subdirectories are appended to the queue once a directory has been read,
+// under a single acquisition of the mutex, so that the mutex is acquired a
+// small, constant number of times per directory, rather than per entry.
+
+namespace BloombergLP {
+namespace bdlmt {
+namespace {
+namespace u {
+
+typedef FilesystemWalkUtil::Visitor   Visitor;
+typedef FilesystemWalkUtil::EntryType EntryType;
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+const char k_SEPARATOR = '\\';
+#else
+const char k_SEPARATOR = '/';
+#endif
+
+                              // ===============
+                              // class WalkState
+                              // ===============
+
+class WalkState {
+    // This class holds the state of one walk, shared by the calling thread
+    // and by the helper jobs submitted to the thread pool.
+
+    // DATA
+    const char              *d_pattern_p;          // leaf-name pattern
+    const Visitor&           d_visitor;            // client visitor
+    ThreadPool              *d_threadPool_p;       // pool, or 0 (held)
+    int                      d_maxHelpers;         // maximum running helpers
+    bslmt::Mutex             d_mutex;              // protects the following
+    bslmt::Condition         d_condition;          // signaled on progress
+    bsl::deque<bsl::string>  d_queue;              // directories to read
+    int                      d_numOutstanding;     // queued or being read
+    int                      d_numHelpers;         // running helper jobs
+    bsls::AtomicBool         d_stopped;            // visitor stopped walk
+    bsls::AtomicInt          d_status;             // first error, or 0
+    bslma::Allocator        *d_allocator_p;        // memory allocator (held)
+
+    // PRIVATE MANIPULATORS
+    void appendDirectories(bsl::vector<bsl::string> *directories);
+        // Append the specified 'directories' to the queue, clear
+        // 'directories', mark as done the directory from which they were
+        // read, and submit a helper job if appropriate.
+
+    bool readDirectory(bsl::string              *directory,
+                       bsl::vector<bsl::string> *subdirectories);
+        // Read the specified 'directory', report its matching entries to the
+        // visitor, and append its subdirectories to the specified
+        // 'subdirectories'.  Return 'false' if the visitor stopped the walk,
+        // and 'true' otherwise.  Note that 'directory' is used as a buffer
+        // and is left unspecified.
+
+  private:
+    // NOT IMPLEMENTED
+    WalkState(const WalkState&);
+    WalkState& operator=(const WalkState&);
+
+  public:
+    // CREATORS
+    WalkState(const char       *pattern,
+              const Visitor&    visitor,
+              ThreadPool       *threadPool,
+              bslma::Allocator *basicAllocator);
+        // Create the state of a walk reporting entries matching the specified
+        // 'pattern' to the specified 'visitor', using the specified
+        // 'threadPool' (if not 0), and using the specified 'basicAllocator'
+        // to supply memory.
+
+    // MANIPULATORS
+    void drain();
+        // Read directories from the queue until it is empty (or the walk is
+        // stopped).
+
+    void helperJob();
+        // Drain the queue from a thread of the pool and then account for the
+        // termination of this helper.
+
+    int run(const bsl::string& root);
+        // Walk the tree rooted at the specified 'root' and return the status
+        // of the walk as specified for 'FilesystemWalkUtil::walkTree'.
+};
+
+                              // ---------------
+                              // class WalkState
+                              // ---------------
+
+// PRIVATE MANIPULATORS
+void WalkState::appendDirectories(bsl::vector<bsl::string> *directories)
+{
+    bool submitHelper = false;
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        for (bsl::size_t i = 0; i < directories->size(); ++i) {
+            d_queue.push_back(bsl::string(d_allocator_p));
+            d_queue.back().swap((*directories)[i]);
+        }
+        d_numOutstanding += static_cast<int>(directories->size()) - 1;
+
+        if (!d_queue.empty() && d_numHelpers < d_maxHelpers) {
+            ++d_numHelpers;
+            submitHelper = true;
+        }
+        if (0 == d_numOutstanding || !d_queue.empty()) {
+            d_condition.broadcast();
+        }
+    }
+    directories->clear();
+
+    if (submitHelper
+     && 0 != d_threadPool_p->enqueueJob(
+                         bdlf::BindUtil::bind(&WalkState::helperJob, this))) {
+        // The pool is not accepting jobs: the directories will be read by the
+        // threads already taking part in the walk.
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        --d_numHelpers;
+        d_maxHelpers = 0;
+        d_condition.broadcast();
+    }
+}
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+bool matchesPattern(const wchar_t *name, const wchar_t *pattern)
+    // Return 'true' if the specified null-terminated 'name' matches the
+    // specified null-terminated 'pattern', in which '*' matches any sequence
+    // of characters and '?' matches any single character, and 'false'
+    // otherwise.
+{
+    const wchar_t *star     = 0;  // position following the last '*'
+    const wchar_t *starName = 0;  // position in 'name' matched by 'star'
+
+    while (*name) {
+        if (L'*' == *pattern) {
+            star     = ++pattern;
+            starName = name;
+        }
+        else if (L'?' == *pattern || *pattern == *name) {
+            ++pattern;
+            ++name;
+        }
+        else if (star) {
+            pattern = star;
+            name    = ++starName;
+        }
+        else {
+            return false;                                             // RETURN
+        }
+    }
+    while (L'*' == *pattern) {
+        ++pattern;
+    }
+    return 0 == *pattern;
+}
+
+void invokeFindClose(void *handle, void *)
+    // Close the specified 'handle', a 'HANDLE' returned by
+    // 'FindFirstFileExW'.
+{
+    FindClose(*static_cast<HANDLE *>(handle));
+}
+
+bool WalkState::readDirectory(bsl::string              *directory,
+                              bsl::vector<bsl::string> *subdirectories)
+{
+    bsl::wstring widePath(d_allocator_p);
+    bsl::wstring widePattern(d_allocator_p);
+    bsl::string  name(d_allocator_p);
+
+    // As in 'bdls::FilesystemUtil', '-' is used as the error character, since
+    // '?' is a wild card.
+
+    (void)bdlde::CharConvertUtf16::utf8ToUtf16(&widePattern,
+                                               d_pattern_p,
+                                               0,
+                                               '-');
+
+    bdls::PathUtil::appendRaw(directory, "*");
+    (void)bdlde::CharConvertUtf16::utf8ToUtf16(&widePath,
+                                               directory->c_str(),
+                                               0,
+                                               '-');
+    bdls::PathUtil::popLeaf(directory);
+
+    WIN32_FIND_DATAW foundData;
+    HANDLE           handle = FindFirstFileExW(widePath.c_str(),
+                                               FindExInfoBasic,
+                                               &foundData,
+                                               FindExSearchNameMatch,
+                                               NULL,
+                                               FIND_FIRST_EX_LARGE_FETCH);
+    if (INVALID_HANDLE_VALUE == handle) {
+        const DWORD error = GetLastError();
+        if (ERROR_ACCESS_DENIED  != error
+         && ERROR_FILE_NOT_FOUND != error
+         && ERROR_PATH_NOT_FOUND != error) {
+            d_status.testAndSwap(0,
+                     FilesystemWalkUtil::k_ERROR_UNREADABLE_DIRECTORY);
+        }
+        return true;                                                  // RETURN
+    }
+    bslma::ManagedPtr<HANDLE> handleGuard(&handle, 0, &invokeFindClose);
+
+    for (bool sts = true; sts; sts = FindNextFileW(handle, &foundData)) {
+        if (d_stopped) {
+            return false;                                             // RETURN
+        }
+
+        const wchar_t *wfn = foundData.cFileName;
+        if (L'.' == *wfn && (!wfn[1] || (L'.' == wfn[1] && !wfn[2]))) {
+            continue;
+        }
+
+        const DWORD attributes = foundData.dwFileAttributes;
+        if (attributes & FILE_ATTRIBUTE_REPARSE_POINT) {
+            continue;
+        }
+        const bool isDirectory = 0 != (attributes & FILE_ATTRIBUTE_DIRECTORY);
+        const bool isMatch     = matchesPattern(wfn, widePattern.c_str());
+
+        if (!isDirectory && !isMatch) {
+            continue;
+        }
+
+        name.clear();
+        (void)bdlde::CharConvertUtf16::utf16ToUtf8(&name, wfn, 0, '-');
+        bdls::PathUtil::appendRaw(directory, name.c_str());
+
+        if (isMatch
+         && !d_visitor(directory->c_str(),
+                       isDirectory ? FilesystemWalkUtil::e_DIRECTORY
+                                   : FilesystemWalkUtil::e_FILE)) {
+            d_stopped = true;
+            return false;                                             // RETURN
+        }
+        if (isDirectory) {
+            subdirectories->push_back(*directory);
+        }
+        bdls::PathUtil::popLeaf(directory);
+    }
+    return true;
+}
+
+#else
+
+void invokeCloseDir(void *dir, void *)
+    // Close the specified 'dir', a 'DIR' returned by 'opendir'.
+{
+    closedir(static_cast<DIR *>(dir));
+}
+
+bool WalkState::readDirectory(bsl::string              *directory,
+                              bsl::vector<bsl::string> *subdirectories)
+{
+    DIR *dir = opendir(directory->c_str());
+    if (0 == dir) {
+        if (EPERM != errno && EACCES != errno && ENOENT != errno) {
+            d_status.testAndSwap(0,
+                     FilesystemWalkUtil::k_ERROR_UNREADABLE_DIRECTORY);
+        }
+        return true;                                                  // RETURN
+    }
+    bslma::ManagedPtr<DIR> dirGuard(dir, 0, &invokeCloseDir);
+
+    // See 'bdls::FilesystemUtil::remove' for the reason for the overflow
+    // space following the 'dirent'.
+
+    enum { k_OVERFLOW_SIZE = 2048 };
+    union {
+        struct dirent d_entry;
+        char          d_overflow[k_OVERFLOW_SIZE];
+    } entryHolder;
+
+    struct dirent& entry = entryHolder.d_entry;
+    struct dirent *entry_p;
+
+    const bsl::size_t directoryLength = directory->length();
+    if (directoryLength && k_SEPARATOR != (*directory)[directoryLength - 1]) {
+        directory->push_back(k_SEPARATOR);
+    }
+    const bsl::size_t prefixLength = directory->length();
+
+    while (true) {
+        if (d_stopped) {
+            return false;                                             // RETURN
+        }
+
+#ifdef BSLS_PLATFORM_HAS_PRAGMA_GCC_DIAGNOSTIC
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif
+        const int rc = readdir_r(dir, &entry, &entry_p);
+#ifdef BSLS_PLATFORM_HAS_PRAGMA_GCC_DIAGNOSTIC
+#pragma GCC diagnostic pop
+#endif
+        if (0 != rc || &entry != entry_p) {
+            break;
+        }
+
+        const char *name = entry.d_name;
+        if ('.' == name[0]
+         && (!name[1] || ('.' == name[1] && !name[2]))) {
+            continue;
+        }
+
+        // Determine the type of the entry from 'd_type' where available,
+        // falling back to 'lstat' where the file system does not report it.
+
+        bool isDirectory;
+        bool isKnownType = false;
+
+#if defined(_DIRENT_HAVE_D_TYPE)                                              \
+ || defined(BSLS_PLATFORM_OS_DARWIN)                                          \
+ || defined(BSLS_PLATFORM_OS_FREEBSD)
+        if (DT_REG == entry.d_type) {
+            isDirectory = false;
+            isKnownType = true;
+        }
+        else if (DT_DIR == entry.d_type) {
+            isDirectory = true;
+            isKnownType = true;
+        }
+        else if (DT_UNKNOWN != entry.d_type) {
+            continue;
+        }
+#endif
+
+        const bool isMatch = 0 == fnmatch(d_pattern_p, name, FNM_PERIOD);
+        if (isKnownType && !isDirectory && !isMatch) {
+            continue;
+        }
+
+        directory->resize(prefixLength);
+        directory->append(name);
+
+        if (!isKnownType) {
+            struct stat status;
+            if (0 != lstat(directory->c_str(), &status)) {
+                continue;
+            }
+            if (S_ISREG(status.st_mode)) {
+                isDirectory = false;
+            }
+            else if (S_ISDIR(status.st_mode)) {
+                isDirectory = true;
+            }
+            else {
+                continue;
+            }
+        }
+
+        if (isMatch
+         && !d_visitor(directory->c_str(),
+                       isDirectory ? FilesystemWalkUtil::e_DIRECTORY
+                                   : FilesystemWalkUtil::e_FILE)) {
+            d_stopped = true;
+            return false;                                             // RETURN
+        }
+        if (isDirectory) {
+            subdirectories->push_back(*directory);
+        }
+    }
+    return true;
+}
+
+#endif
+
+// CREATORS
+WalkState::WalkState(const char       *pattern,
+                     const Visitor&    visitor,
+                     ThreadPool       *threadPool,
+                     bslma::Allocator *basicAllocator)
+: d_pattern_p(pattern)
+, d_visitor(visitor)
+, d_threadPool_p(threadPool)
+, d_maxHelpers(threadPool ? threadPool->maxThreads() : 0)
+, d_queue(basicAllocator)
+, d_numOutstanding(0)
+, d_numHelpers(0)
+, d_stopped(false)
+, d_status(0)
+, d_allocator_p(basicAllocator)
+{
+}
+
+// MANIPULATORS
+void WalkState::drain()
+{
+    bsl::string              directory(d_allocator_p);
+    bsl::vector<bsl::string> subdirectories(d_allocator_p);
+
+    while (true) {
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+            if (d_stopped && !d_queue.empty()) {
+                d_numOutstanding -= static_cast<int>(d_queue.size());
+                d_queue.clear();
+                d_condition.broadcast();
+            }
+            if (d_queue.empty()) {
+                return;                                               // RETURN
+            }
+            directory.swap(d_queue.front());
+            d_queue.pop_front();
+        }
+
+        readDirectory(&directory, &subdirectories);
+        appendDirectories(&subdirectories);
+    }
+}
+
+void WalkState::helperJob()
+{
+    drain();
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+    --d_numHelpers;
+    d_condition.broadcast();
+}
+
+int WalkState::run(const bsl::string& root)
+{
+    d_queue.push_back(root);
+    d_numOutstanding = 1;
+
+    while (true) {
+        drain();
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        while (d_queue.empty() && (d_numOutstanding || d_numHelpers)) {
+            d_condition.wait(&d_mutex);
+        }
+        if (d_queue.empty()) {
+            break;
+        }
+    }
+
+    return d_stopped ? static_cast<int>(FilesystemWalkUtil::k_STOPPED)
+                     : d_status.load();
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+                          // -------------------------
+                          // struct FilesystemWalkUtil
+                          // -------------------------
+
+// CLASS METHODS
+int FilesystemWalkUtil::walkTree(const bsl::string&  root,
+                                 const bsl::string&  pattern,
+                                 const Visitor&      visitor,
+                                 ThreadPool         *threadPool)
+{
+    if (bsl::string::npos != pattern.find(u::k_SEPARATOR)) {
+        return k_ERROR_INVALID_PATTERN;                               // RETURN
+    }
+    if (!bdls::FilesystemUtil::isDirectory(root, true)) {
+        return k_ERROR_ROOT_NOT_A_DIRECTORY;                          // RETURN
+    }
+
+    u::WalkState state(pattern.c_str(),
+                       visitor,
+                       threadPool,
+                       bslma::Default::defaultAllocator());
+    return state.run(root);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
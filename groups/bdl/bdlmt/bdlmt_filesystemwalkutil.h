@@ -0,0 +1,216 @@
+// bdlmt_filesystemwalkutil.h                                         -*-C++-*-
+#ifndef INCLUDED_BDLMT_FILESYSTEMWALKUTIL
+#define INCLUDED_BDLMT_FILESYSTEMWALKUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a parallel, early-terminating directory-tree walk.
+//
+//@CLASSES:
+//  bdlmt::FilesystemWalkUtil: namespace for parallel directory-tree walking
+//
+//@SEE_ALSO: bdls_filesystemutil, bdlmt_threadpool
+//
+//@DESCRIPTION: This component provides a 'struct',
+// 'bdlmt::FilesystemWalkUtil', that is a namespace for a function, 'walkTree',
+// that traverses a directory tree and invokes a client-supplied visitor for
+// each file and directory whose leaf name matches a pattern, in the manner of
+// 'bdls::FilesystemUtil::visitTree'.  Unlike 'visitTree', 'walkTree':
+//
+//: o Determines the type of each directory entry from the result of reading
+//:   the directory (the 'd_type' member of 'dirent' on Unix, the attributes
+//:   returned by 'FindNextFileW' on Windows), so that no 'stat' system call is
+//:   needed per entry on file systems that report entry types.
+//:
+//: o Matches the pattern against entry names while reading each directory,
+//:   rather than globbing each directory a second time.
+//:
+//: o Optionally fans the subdirectories out, as jobs, to a
+//:   'bdlmt::ThreadPool', so that directories are read concurrently.
+//:
+//: o Stops the walk as soon as the visitor returns 'false'.
+//
+// On a tree having many directories, such as a log directory holding the
+// rotated files of many processes, these properties reduce the time of a
+// sweep from being dominated by one system call per file, made serially, to
+// roughly the time needed to read the directories, divided among the threads
+// of the pool.
+//
+///Traversal Order and Concurrency
+///-------------------------------
+// The order in which entries are visited is unspecified, except that a
+// matching directory is visited before any entry within it.  If a thread pool
+// is supplied, the visitor may be invoked concurrently from the calling
+// thread and from threads of the pool, and so must be thread-safe; if no
+// thread pool is supplied, the walk is performed entirely by the calling
+// thread.  In either case, 'walkTree' does not return until no thread is
+// executing the visitor on its behalf.  The calling thread takes part in the
+// walk, so 'walkTree' makes progress even if all of the threads of the pool
+// are busy.
+//
+// Once the visitor returns 'false', no directory not yet being read is read,
+// and each thread stops at the next entry it considers; note that, if a
+// thread pool is supplied, the visitor may still be invoked (concurrently) a
+// small number of times after it first returns 'false'.
+//
+///Patterns and Entry Types
+///------------------------
+// The pattern is matched against the leaf name of each entry.  On Unix, the
+// pattern is interpreted by 'fnmatch' (with the 'FNM_PERIOD' flag, so that a
+// leading '.' must be matched explicitly, as for 'glob'); on Windows, '*'
+// matches any sequence of characters and '?' matches any single character.
+// Regular files and directories are reported; other entries, and in
+// particular symbolic links (and Windows reparse points), are neither
+// reported nor followed.  Directories are traversed whether or not they match
+// the pattern.  Entries named '.' and '..' are ignored, and 'root' itself is
+// never visited.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Finding Old Log Files in Parallel
+/// - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a log directory holds, in a subdirectory per application, a
+// large number of rotated log files, and that we want to collect those that
+// were rotated at a given date.
+//
+// First, we define a thread-safe visitor that collects the matching files,
+// and stops the walk once a maximum number of files have been found:
+//..
+//  struct Collector {
+//      bslmt::Mutex             d_mutex;
+//      bsl::vector<bsl::string> d_paths;
+//      bsl::size_t              d_maxPaths;
+//
+//      bool visit(const char                          *path,
+//                 bdlmt::FilesystemWalkUtil::EntryType type)
+//      {
+//          if (bdlmt::FilesystemWalkUtil::e_FILE != type) {
+//              return true;                                          // RETURN
+//          }
+//          bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+//          d_paths.push_back(path);
+//          return d_paths.size() < d_maxPaths;
+//      }
+//  };
+//..
+// Then, we create and start a thread pool to read the directories:
+//..
+//  bslmt::ThreadAttributes attributes;
+//  bdlmt::ThreadPool       threadPool(attributes, 4, 4, 1000);
+//  threadPool.start();
+//..
+// Now, we walk the tree rooted at the log directory (here, 'logDir') using
+// the thread pool:
+//..
+//  Collector collector;
+//  collector.d_maxPaths = 1000;
+//
+//  using namespace bdlf::PlaceHolders;
+//
+//  int rc = bdlmt::FilesystemWalkUtil::walkTree(
+//                          logDir,
+//                          "*.log.20260101_*",
+//                          bdlf::BindUtil::bind(&Collector::visit,
+//                                               &collector,
+//                                               _1,
+//                                               _2),
+//                          &threadPool);
+//..
+// Finally, we observe that the walk completed (0 == 'rc') unless the maximum
+// number of files was found (1 == 'rc'), and stop the thread pool:
+//..
+//  assert(0 == rc || 1 == rc);
+//  assert(collector.d_paths.size() <= collector.d_maxPaths || 1 == rc);
+//
+//  threadPool.stop();
+//..
+
+#include <bdlscm_version.h>
+
+#include <bsl_functional.h>
+#include <bsl_string.h>
+
+namespace BloombergLP {
+namespace bdlmt {
+
+class ThreadPool;
+
+                          // =========================
+                          // struct FilesystemWalkUtil
+                          // =========================
+
+struct FilesystemWalkUtil {
+    // This 'struct' provides a namespace for a function that walks a
+    // directory tree, optionally in parallel, and reports the entries whose
+    // leaf names match a pattern.
+
+    // TYPES
+    enum EntryType {
+        // Enumerate the types of the entries reported to a visitor.
+
+        e_FILE,        // regular file
+        e_DIRECTORY    // directory
+    };
+
+    typedef bsl::function<bool(const char *path, EntryType type)> Visitor;
+        // 'Visitor' is an alias for a function object that is passed the full
+        // path, starting with the root of the walk, and the type of a
+        // matching entry, and that returns 'true' to continue the walk, and
+        // 'false' to stop it.
+
+    enum {
+        k_STOPPED                = 1,  // the visitor stopped the walk
+
+        k_ERROR_ROOT_NOT_A_DIRECTORY = -1,
+        k_ERROR_INVALID_PATTERN      = -2,
+        k_ERROR_UNREADABLE_DIRECTORY = -3
+    };
+
+    // CLASS METHODS
+    static int walkTree(const bsl::string&  root,
+                        const bsl::string&  pattern,
+                        const Visitor&      visitor,
+                        ThreadPool         *threadPool = 0);
+        // Traverse the directory tree starting at the specified 'root' and
+        // invoke the specified 'visitor' for each regular file and directory
+        // whose leaf name matches the specified 'pattern' (see {Patterns and
+        // Entry Types}), until 'visitor' returns 'false'.  Optionally specify
+        // a 'threadPool' whose threads read subdirectories concurrently with
+        // the calling thread, in which case 'visitor' must be thread-safe
+        // (see {Traversal Order and Concurrency}).  Return 0 if the whole
+        // tree was traversed, 'k_STOPPED' if 'visitor' stopped the walk, and a
+        // negative value otherwise: 'k_ERROR_ROOT_NOT_A_DIRECTORY' if 'root'
+        // does not specify a directory, 'k_ERROR_INVALID_PATTERN' if 'pattern'
+        // contains a path separator, and 'k_ERROR_UNREADABLE_DIRECTORY' if a
+        // directory within the tree could not be read for a reason other than
+        // file permissions, in which case the rest of the tree is still
+        // traversed.  Directories that cannot be read due to file permissions
+        // (or that are removed during the walk) are silently skipped.  If
+        // 'threadPool' does not accept jobs (e.g., it has been stopped), the
+        // walk is performed by the calling thread alone.  The behavior is
+        // undefined if this function is called from a thread of 'threadPool'.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
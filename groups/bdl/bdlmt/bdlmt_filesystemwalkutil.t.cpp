@@ -0,0 +1,1142 @@
+// bdlmt_filesystemwalkutil.t.cpp                                     -*-C++-*-
+#include <bdlmt_filesystemwalkutil.h>
+
+#include <bdlmt_threadpool.h>
+
+#include <bdls_filesystemutil.h>
+#include <bdls_pathutil.h>
+
+#include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_threadattributes.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_atomic.h>
+#include <bsls_platform.h>
+#include <bsls_stopwatch.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstddef.h>
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_functional.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+#ifndef BSLS_PLATFORM_OS_WINDOWS
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <windows.h>
+#endif
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+using bsl::flush;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test is a utility walking a directory tree.  Trees of
+// files, directories, and (on Unix) symbolic links are created in a temporary
+// directory, and the entries reported by 'walkTree', with and without a
+// thread pool, are compared with those reported by
+// 'bdls::FilesystemUtil::visitTree', which serves as the oracle.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] int walkTree(root, pattern, visitor);
+// [ 3] int walkTree(root, pattern, visitor, threadPool);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CONCERN: THE VISITOR CAN STOP THE WALK
+// [ 5] CONCERN: ERRORS ARE REPORTED
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST: DEEP AND WIDE TREES
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                GLOBAL TYPEDEFS/CONSTANTS/VARIABLES FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlmt::FilesystemWalkUtil Util;
+typedef bdls::FilesystemUtil      FUtil;
+typedef bdls::PathUtil            PUtil;
+
+int                 test;
+bool             verbose;
+bool         veryVerbose;
+bool     veryVeryVerbose;
+bool veryVeryVeryVerbose;
+
+// ============================================================================
+//                       GLOBAL HELPER CLASSES FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+class TempDirectoryGuard {
+    // This class implements a scoped temporary directory guard.  The guard
+    // tries to create a temporary directory in the system-wide temp directory
+    // and falls back to the current directory.
+
+    // DATA
+    bsl::string       d_dirName;      // path to the created directory
+    bslma::Allocator *d_allocator_p;  // memory allocator (held, not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    TempDirectoryGuard(const TempDirectoryGuard&);
+    TempDirectoryGuard& operator=(const TempDirectoryGuard&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(TempDirectoryGuard,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit TempDirectoryGuard(bslma::Allocator *basicAllocator = 0)
+        // Create temporary directory in the system-wide temp or current
+        // directory.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.
+    : d_dirName(bslma::Default::allocator(basicAllocator))
+    , d_allocator_p(bslma::Default::allocator(basicAllocator))
+    {
+        bsl::string tmpPath(d_allocator_p);
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+        char tmpPathBuf[MAX_PATH];
+        GetTempPath(MAX_PATH, tmpPathBuf);
+        tmpPath.assign(tmpPathBuf);
+#else
+        const char *envTmpPath = bsl::getenv("TMPDIR");
+        if (envTmpPath) {
+            tmpPath.assign(envTmpPath);
+        }
+#endif
+
+        int res = bdls::PathUtil::appendIfValid(&tmpPath, "bdlmt_");
+        ASSERTV(tmpPath, 0 == res);
+
+        res = bdls::FilesystemUtil::createTemporaryDirectory(&d_dirName,
+                                                             tmpPath);
+        ASSERTV(tmpPath, 0 == res);
+    }
+
+    ~TempDirectoryGuard()
+        // Destroy this object and remove the temporary directory (recursively)
+        // created at construction.
+    {
+        bdls::FilesystemUtil::remove(d_dirName, true);
+    }
+
+    // ACCESSORS
+    const bsl::string& getTempDirName() const
+        // Return a 'const' reference to the name of the created temporary
+        // directory.
+    {
+        return d_dirName;
+    }
+};
+
+namespace u {
+
+void makeFile(const bsl::string& path)
+    // Create an empty file at the specified 'path'.
+{
+    FUtil::FileDescriptor fd = FUtil::open(path,
+                                           FUtil::e_OPEN_OR_CREATE,
+                                           FUtil::e_READ_WRITE);
+    ASSERTV(path, FUtil::k_INVALID_FD != fd);
+    FUtil::close(fd);
+}
+
+void makeTree(const bsl::string& root,
+              int                depth,
+              int                numDirectories,
+              int                numFiles)
+    // Create, under the existing directory at the specified 'root', a tree of
+    // the specified 'depth', each directory of which has the specified
+    // 'numDirectories' subdirectories (except at 'depth') and the specified
+    // 'numFiles' files, named alternately "f<i>.log" and "f<i>.txt".
+{
+    for (int i = 0; i < numFiles; ++i) {
+        bsl::ostringstream name;
+        name << 'f' << i << (i % 2 ? ".txt" : ".log");
+
+        bsl::string path(root);
+        PUtil::appendRaw(&path, name.str().c_str());
+        makeFile(path);
+    }
+    if (0 == depth) {
+        return;                                                       // RETURN
+    }
+    for (int i = 0; i < numDirectories; ++i) {
+        bsl::ostringstream name;
+        name << 'd' << i;
+        bsl::string path(root);
+        PUtil::appendRaw(&path, name.str().c_str());
+        ASSERTV(path, 0 == FUtil::createDirectories(path, true));
+        makeTree(path, depth - 1, numDirectories, numFiles);
+    }
+}
+
+class Recorder {
+    // This class provides a thread-safe visitor recording the reported
+    // entries and, optionally, stopping the walk after a number of entries.
+
+    // DATA
+    bslmt::Mutex             d_mutex;       // protects the following
+    bsl::vector<bsl::string> d_files;       // reported files
+    bsl::vector<bsl::string> d_directories; // reported directories
+    int                      d_maxEntries;  // entries before stopping
+
+  public:
+    // CREATORS
+    explicit Recorder(int maxEntries = -1)
+        // Create a recorder that stops the walk once it has recorded the
+        // optionally specified 'maxEntries' entries, and never stops it if
+        // 'maxEntries' is negative.
+    : d_maxEntries(maxEntries)
+    {
+    }
+
+    // MANIPULATORS
+    bool visit(const char *path, Util::EntryType type)
+        // Record the specified 'path' of the specified 'type', and return
+        // 'false' if the walk should stop, and 'true' otherwise.
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        if (Util::e_FILE == type) {
+            d_files.push_back(path);
+        }
+        else {
+            ASSERTV(path, Util::e_DIRECTORY == type);
+            d_directories.push_back(path);
+        }
+        return d_maxEntries < 0
+            || static_cast<int>(d_files.size() + d_directories.size())
+                                                                < d_maxEntries;
+    }
+
+    Util::Visitor visitor()
+        // Return a visitor invoking 'visit' on this object.
+    {
+        return bdlf::BindUtil::bind(&Recorder::visit,
+                                    this,
+                                    bdlf::PlaceHolders::_1,
+                                    bdlf::PlaceHolders::_2);
+    }
+
+    void sort()
+        // Sort the recorded paths.
+    {
+        bsl::sort(d_files.begin(), d_files.end());
+        bsl::sort(d_directories.begin(), d_directories.end());
+    }
+
+    // ACCESSORS
+    const bsl::vector<bsl::string>& directories() const
+        // Return the recorded directories.
+    {
+        return d_directories;
+    }
+
+    const bsl::vector<bsl::string>& files() const
+        // Return the recorded files.
+    {
+        return d_files;
+    }
+};
+
+void recordPath(bsl::vector<bsl::string> *result, const char *path)
+    // Append the specified 'path' to the specified 'result'.
+{
+    result->push_back(path);
+}
+
+void loadExpected(bsl::vector<bsl::string> *files,
+                  bsl::vector<bsl::string> *directories,
+                  const bsl::string&        root,
+                  const char               *pattern)
+    // Load into the specified 'files' and 'directories' the sorted paths of
+    // the files and directories under the specified 'root' that match the
+    // specified 'pattern', as reported by
+    // 'bdls::FilesystemUtil::visitTree'.
+{
+    bsl::vector<bsl::string> all;
+    int rc = FUtil::visitTree(root,
+                              pattern,
+                              bdlf::BindUtil::bind(&recordPath,
+                                                   &all,
+                                                   bdlf::PlaceHolders::_1));
+    ASSERTV(pattern, rc, 0 == rc);
+
+    files->clear();
+    directories->clear();
+    for (bsl::size_t i = 0; i < all.size(); ++i) {
+        if (FUtil::isDirectory(all[i])) {
+            directories->push_back(all[i]);
+        }
+        else {
+            files->push_back(all[i]);
+        }
+    }
+    bsl::sort(files->begin(), files->end());
+    bsl::sort(directories->begin(), directories->end());
+}
+
+void makeMixedTree(const bsl::string& root)
+    // Create, under the existing directory at the specified 'root', a tree
+    // having files and directories of various names, including hidden ones
+    // and, on Unix, symbolic links to a file and to a directory.
+{
+    makeTree(root, 2, 3, 4);
+
+    const char *const FILES[] = { ".hidden.log", "abc.log", "abd.txt" };
+    for (bsl::size_t i = 0; i < sizeof FILES / sizeof *FILES; ++i) {
+        bsl::string path(root);
+        PUtil::appendRaw(&path, FILES[i]);
+        makeFile(path);
+    }
+
+    const char *const DIRECTORIES[][2] = { { ".hiddendir", "inner.log" },
+                                           { "abc.dir",    "abc.log"   },
+                                           { "empty",      0           } };
+    for (bsl::size_t i = 0; i < sizeof DIRECTORIES / sizeof *DIRECTORIES;
+                                                                        ++i) {
+        bsl::string path(root);
+        PUtil::appendRaw(&path, DIRECTORIES[i][0]);
+        ASSERTV(path, 0 == FUtil::createDirectories(path, true));
+        if (DIRECTORIES[i][1]) {
+            PUtil::appendRaw(&path, DIRECTORIES[i][1]);
+            makeFile(path);
+        }
+    }
+
+#ifndef BSLS_PLATFORM_OS_WINDOWS
+    const char *const LINKS[][2] = { { "abc.log", "link.log" },
+                                     { "abc.dir", "linkdir"  } };
+    for (bsl::size_t i = 0; i < sizeof LINKS / sizeof *LINKS; ++i) {
+        bsl::string target(root);
+        bsl::string link(root);
+        PUtil::appendRaw(&target, LINKS[i][0]);
+        PUtil::appendRaw(&link,   LINKS[i][1]);
+        ASSERTV(link, 0 == ::symlink(target.c_str(), link.c_str()));
+    }
+#endif
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Finding Old Log Files in Parallel
+/// - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a log directory holds, in a subdirectory per application, a
+// large number of rotated log files, and that we want to collect those that
+// were rotated at a given date.
+//
+// First, we define a thread-safe visitor that collects the matching files,
+// and stops the walk once a maximum number of files have been found:
+//..
+    struct Collector {
+        bslmt::Mutex             d_mutex;
+        bsl::vector<bsl::string> d_paths;
+        bsl::size_t              d_maxPaths;
+
+        bool visit(const char                          *path,
+                   bdlmt::FilesystemWalkUtil::EntryType type)
+        {
+            if (bdlmt::FilesystemWalkUtil::e_FILE != type) {
+                return true;                                          // RETURN
+            }
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+            d_paths.push_back(path);
+            return d_paths.size() < d_maxPaths;
+        }
+    };
+//..
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    test                = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    verbose             = argc > 2;
+    veryVerbose         = argc > 3;
+    veryVeryVerbose     = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        TempDirectoryGuard tempDirGuard;
+
+        const bsl::string logDir = tempDirGuard.getTempDirName();
+        for (int i = 0; i < 4; ++i) {
+            bsl::ostringstream app;
+            app << "app" << i;
+
+            bsl::string appDir(logDir);
+            PUtil::appendRaw(&appDir, app.str().c_str());
+            ASSERT(0 == FUtil::createDirectories(appDir, true));
+
+            const char *const NAMES[] = { "app.log.20260101_000000",
+                                          "app.log.20260102_000000" };
+            for (int j = 0; j < 2; ++j) {
+                bsl::string path(appDir);
+                PUtil::appendRaw(&path, NAMES[j]);
+                u::makeFile(path);
+            }
+        }
+
+// Then, we create and start a thread pool to read the directories:
+//..
+    bslmt::ThreadAttributes attributes;
+    bdlmt::ThreadPool       threadPool(attributes, 4, 4, 1000);
+    threadPool.start();
+//..
+// Now, we walk the tree rooted at the log directory (here, 'logDir') using
+// the thread pool:
+//..
+    Collector collector;
+    collector.d_maxPaths = 1000;
+
+    using namespace bdlf::PlaceHolders;
+
+    int rc = bdlmt::FilesystemWalkUtil::walkTree(
+                            logDir,
+                            "*.log.20260101_*",
+                            bdlf::BindUtil::bind(&Collector::visit,
+                                                 &collector,
+                                                 _1,
+                                                 _2),
+                            &threadPool);
+//..
+// Finally, we observe that the walk completed (0 == 'rc') unless the maximum
+// number of files was found (1 == 'rc'), and stop the thread pool:
+//..
+    ASSERT(0 == rc || 1 == rc);
+    ASSERT(collector.d_paths.size() <= collector.d_maxPaths || 1 == rc);
+
+    threadPool.stop();
+//..
+
+        ASSERTV(rc, 0 == rc);
+        ASSERTV(collector.d_paths.size(), 4 == collector.d_paths.size());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING ERRORS
+        //
+        // Concerns:
+        //: 1 'walkTree' fails, without invoking the visitor, if the root is
+        //:   not a directory.
+        //:
+        //: 2 'walkTree' fails, without invoking the visitor, if the pattern
+        //:   contains a path separator.
+        //:
+        //: 3 A directory that cannot be read due to its permissions is
+        //:   skipped, and the walk succeeds.
+        //
+        // Plan:
+        //: 1 Walk from a file and from a non-existent path.  (C-1)
+        //:
+        //: 2 Walk with a pattern containing a separator.  (C-2)
+        //:
+        //: 3 On Unix, remove the permissions of a directory of a tree, and
+        //:   walk the tree with and without a thread pool.  If the directory
+        //:   is still readable (e.g., the process is privileged), only verify
+        //:   that the walk succeeds.  (C-3)
+        //
+        // Testing:
+        //   CONCERN: ERRORS ARE REPORTED
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING ERRORS" << endl
+                          << "==============" << endl;
+
+        TempDirectoryGuard tempDirGuard;
+        const bsl::string& tempDir = tempDirGuard.getTempDirName();
+
+        u::makeTree(tempDir, 1, 2, 2);
+
+        u::Recorder recorder;
+        Util::Visitor visitor = recorder.visitor();
+
+        bsl::string file(tempDir);
+        bsl::string missing(tempDir);
+        PUtil::appendRaw(&file,    "f0.log");
+        PUtil::appendRaw(&missing, "missing");
+
+        ASSERT(Util::k_ERROR_ROOT_NOT_A_DIRECTORY ==
+                                         Util::walkTree(file, "*", visitor));
+        ASSERT(Util::k_ERROR_ROOT_NOT_A_DIRECTORY ==
+                                      Util::walkTree(missing, "*", visitor));
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+        ASSERT(Util::k_ERROR_INVALID_PATTERN ==
+                                 Util::walkTree(tempDir, "d0\\*", visitor));
+#else
+        ASSERT(Util::k_ERROR_INVALID_PATTERN ==
+                                   Util::walkTree(tempDir, "d0/*", visitor));
+#endif
+        ASSERT(recorder.files().empty());
+        ASSERT(recorder.directories().empty());
+
+#ifndef BSLS_PLATFORM_OS_WINDOWS
+        bsl::string locked(tempDir);
+        PUtil::appendRaw(&locked, "d0");
+        ASSERT(0 == ::chmod(locked.c_str(), 0));
+
+        const bool isReadable = 0 == ::access(locked.c_str(), R_OK);
+
+        bslmt::ThreadAttributes attributes;
+        bdlmt::ThreadPool       threadPool(attributes, 2, 2, 1000);
+        ASSERT(0 == threadPool.start());
+
+        for (int pass = 0; pass < 2; ++pass) {
+            u::Recorder recorder;
+            int         rc = Util::walkTree(tempDir,
+                                            "*",
+                                            recorder.visitor(),
+                                            pass ? &threadPool : 0);
+            ASSERTV(pass, rc, 0 == rc);
+            if (!isReadable) {
+                // The files of 'd0' are not reported, but 'd0' is.
+
+                ASSERTV(pass, recorder.files().size(),
+                        4 == recorder.files().size());
+                ASSERTV(pass, recorder.directories().size(),
+                        2 == recorder.directories().size());
+            }
+        }
+        threadPool.stop();
+
+        ASSERT(0 == ::chmod(locked.c_str(), S_IRWXU));
+#endif
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING EARLY TERMINATION
+        //
+        // Concerns:
+        //: 1 If the visitor returns 'false', 'walkTree' returns 'k_STOPPED'.
+        //:
+        //: 2 Without a thread pool, the visitor is not invoked after it
+        //:   returns 'false'.
+        //:
+        //: 3 With a thread pool, the visitor is invoked at most once per
+        //:   thread after it returns 'false', and 'walkTree' returns only
+        //:   once no thread takes part in the walk.
+        //:
+        //: 4 A walk in which the visitor always returns 'true' returns 0.
+        //
+        // Plan:
+        //: 1 Create a tree, and walk it with visitors stopping after N
+        //:   entries, for N ranging from 1 to beyond the number of entries,
+        //:   with and without thread pools of various sizes.  Verify the
+        //:   return value and the number of entries recorded.  (C-1..4)
+        //
+        // Testing:
+        //   CONCERN: THE VISITOR CAN STOP THE WALK
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING EARLY TERMINATION" << endl
+                          << "=========================" << endl;
+
+        TempDirectoryGuard tempDirGuard;
+        const bsl::string& tempDir = tempDirGuard.getTempDirName();
+
+        u::makeTree(tempDir, 3, 3, 3);
+
+        const int NUM_ENTRIES = 39 + 40 * 3;  // directories and files
+
+        const int NUM_THREADS[] = { 0, 1, 2, 4 };
+        const int NUM_NUM_THREADS = sizeof NUM_THREADS / sizeof *NUM_THREADS;
+
+        for (int ti = 0; ti < NUM_NUM_THREADS; ++ti) {
+            const int NT = NUM_THREADS[ti];
+
+            bslmt::ThreadAttributes attributes;
+            bdlmt::ThreadPool       threadPool(attributes, NT, NT, 1000);
+            if (NT) {
+                ASSERT(0 == threadPool.start());
+            }
+
+            for (int maxEntries = 1; maxEntries <= NUM_ENTRIES + 1;
+                                                             maxEntries += 7) {
+                u::Recorder recorder(maxEntries);
+                const int   rc = Util::walkTree(tempDir,
+                                                "*",
+                                                recorder.visitor(),
+                                                NT ? &threadPool : 0);
+                const int   numRecorded = static_cast<int>(
+                          recorder.files().size() +
+                          recorder.directories().size());
+
+                if (veryVerbose) {
+                    T_ P_(NT) P_(maxEntries) P_(rc) P(numRecorded)
+                }
+
+                if (maxEntries <= NUM_ENTRIES) {
+                    ASSERTV(NT, maxEntries, rc, Util::k_STOPPED == rc);
+                    if (NT) {
+                        ASSERTV(NT, maxEntries, numRecorded,
+                                maxEntries <= numRecorded
+                             && numRecorded <= maxEntries + NT);
+                    }
+                    else {
+                        ASSERTV(NT, maxEntries, numRecorded,
+                                maxEntries == numRecorded);
+                    }
+                }
+                else {
+                    ASSERTV(NT, maxEntries, rc, 0 == rc);
+                    ASSERTV(NT, maxEntries, numRecorded,
+                            NUM_ENTRIES == numRecorded);
+                }
+            }
+            if (NT) {
+                threadPool.stop();
+            }
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'walkTree' WITH A THREAD POOL
+        //
+        // Concerns:
+        //: 1 With a thread pool, 'walkTree' reports the same entries as
+        //:   without, each exactly once, whatever the number of threads and
+        //:   the shape of the tree.
+        //:
+        //: 2 A walk completes if the thread pool does not accept jobs.
+        //:
+        //: 3 Consecutive and concurrent walks can share a thread pool.
+        //
+        // Plan:
+        //: 1 Create a wide tree and a deep tree, and, for pools of various
+        //:   sizes, compare the (sorted) entries reported by 'walkTree' with
+        //:   the entries reported by 'visitTree'.  (C-1)
+        //:
+        //: 2 Repeat with a thread pool that has been stopped.  (C-2)
+        //:
+        //: 3 Walk the trees repeatedly, from two threads at once, with the
+        //:   same thread pool.  (C-3)
+        //
+        // Testing:
+        //   int walkTree(root, pattern, visitor, threadPool);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'walkTree' WITH A THREAD POOL" << endl
+                          << "=====================================" << endl;
+
+        TempDirectoryGuard tempDirGuard;
+        const bsl::string& tempDir = tempDirGuard.getTempDirName();
+
+        bsl::string wide(tempDir);
+        bsl::string deep(tempDir);
+        PUtil::appendRaw(&wide, "wide");
+        PUtil::appendRaw(&deep, "deep");
+        ASSERT(0 == FUtil::createDirectories(wide, true));
+        ASSERT(0 == FUtil::createDirectories(deep, true));
+        u::makeTree(wide, 2, 12, 5);
+        u::makeTree(deep, 40, 1, 3);
+        {
+            bsl::string mixed(wide);
+            PUtil::appendRaw(&mixed, "d0");
+            u::makeMixedTree(mixed);
+        }
+
+        const char *const ROOTS[]    = { wide.c_str(), deep.c_str() };
+        const char *const PATTERNS[] = { "*", "*.log", "d1*", "f?.txt" };
+
+        const int NUM_THREADS[] = { 1, 2, 3, 8 };
+        const int NUM_NUM_THREADS = sizeof NUM_THREADS / sizeof *NUM_THREADS;
+
+        for (int ri = 0; ri < 2; ++ri) {
+        for (int pi = 0; pi < 4; ++pi) {
+            const char *const ROOT    = ROOTS[ri];
+            const char *const PATTERN = PATTERNS[pi];
+
+            bsl::vector<bsl::string> expFiles, expDirectories;
+            u::loadExpected(&expFiles, &expDirectories, ROOT, PATTERN);
+
+            for (int ti = 0; ti <= NUM_NUM_THREADS; ++ti) {
+                const int  NT       = ti < NUM_NUM_THREADS
+                                    ? NUM_THREADS[ti]
+                                    : 2;
+                const bool DISABLED = ti == NUM_NUM_THREADS;
+
+                bslmt::ThreadAttributes attributes;
+                bdlmt::ThreadPool       threadPool(attributes, NT, NT, 1000);
+                ASSERT(0 == threadPool.start());
+                if (DISABLED) {
+                    threadPool.stop();
+                }
+
+                u::Recorder recorder;
+                const int   rc = Util::walkTree(ROOT,
+                                                PATTERN,
+                                                recorder.visitor(),
+                                                &threadPool);
+                ASSERTV(ROOT, PATTERN, NT, rc, 0 == rc);
+
+                recorder.sort();
+                ASSERTV(ROOT, PATTERN, NT, DISABLED,
+                        expFiles == recorder.files());
+                ASSERTV(ROOT, PATTERN, NT, DISABLED,
+                        expDirectories == recorder.directories());
+
+                threadPool.stop();
+            }
+        }
+        }
+
+        if (verbose) cout << "\tConcurrent walks sharing a pool." << endl;
+        {
+            bsl::vector<bsl::string> expFiles, expDirectories;
+            u::loadExpected(&expFiles, &expDirectories, wide, "*");
+
+            bslmt::ThreadAttributes attributes;
+            bdlmt::ThreadPool       threadPool(attributes, 4, 4, 1000);
+            ASSERT(0 == threadPool.start());
+
+            bsls::AtomicInt numFailures(0);
+            for (int i = 0; i < 10; ++i) {
+                u::Recorder recorder;
+                bsl::function<void()> walk = bdlf::BindUtil::bind(
+                          &Util::walkTree,
+                          wide,
+                          bsl::string("*"),
+                          recorder.visitor(),
+                          &threadPool);
+                bslmt::ThreadUtil::Handle handle;
+                ASSERT(0 == bslmt::ThreadUtil::create(&handle, walk));
+
+                u::Recorder local;
+                ASSERT(0 == Util::walkTree(wide,
+                                           "*",
+                                           local.visitor(),
+                                           &threadPool));
+                ASSERT(0 == bslmt::ThreadUtil::join(handle));
+
+                recorder.sort();
+                local.sort();
+                ASSERTV(i, expFiles == recorder.files());
+                ASSERTV(i, expFiles == local.files());
+                ASSERTV(i, expDirectories == local.directories());
+            }
+            threadPool.stop();
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'walkTree'
+        //
+        // Concerns:
+        //: 1 Without a thread pool, 'walkTree' reports exactly the files and
+        //:   directories reported by 'visitTree', each once.
+        //:
+        //: 2 The type reported for each entry is correct.
+        //:
+        //: 3 Hidden entries are matched only by patterns starting with '.'.
+        //:
+        //: 4 Symbolic links are neither reported nor followed.
+        //:
+        //: 5 A matching directory is reported before the entries within it.
+        //:
+        //: 6 The root is not reported, and may end with a separator.
+        //
+        // Plan:
+        //: 1 Create a tree of files, directories, hidden entries, and (on
+        //:   Unix) symbolic links, and, for a set of patterns, compare the
+        //:   (sorted) entries reported by 'walkTree' with those reported by
+        //:   'visitTree', which are classified by 'isDirectory'.  (C-1..4)
+        //:
+        //: 2 Walk the tree with "*", recording the order of the directories,
+        //:   and verify that each path is reported after its parent.  (C-5)
+        //:
+        //: 3 Walk the tree from a root ending with a separator.  (C-6)
+        //
+        // Testing:
+        //   int walkTree(root, pattern, visitor);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'walkTree'" << endl
+                          << "==================" << endl;
+
+        TempDirectoryGuard tempDirGuard;
+        const bsl::string& tempDir = tempDirGuard.getTempDirName();
+
+        u::makeMixedTree(tempDir);
+
+        const char *const PATTERNS[] = {
+            "*",
+            "*.log",
+            "*.txt",
+            "abc*",
+            "ab?.*",
+            "d*",
+            ".*",
+            "f[02].log",
+            "empty",
+            "nomatch",
+            "link*",
+        };
+        const int NUM_PATTERNS = sizeof PATTERNS / sizeof *PATTERNS;
+
+        for (int pi = 0; pi < NUM_PATTERNS; ++pi) {
+            const char *const PATTERN = PATTERNS[pi];
+
+            bsl::vector<bsl::string> expFiles, expDirectories;
+            u::loadExpected(&expFiles, &expDirectories, tempDir, PATTERN);
+
+            u::Recorder recorder;
+            const int   rc = Util::walkTree(tempDir,
+                                            PATTERN,
+                                            recorder.visitor());
+            ASSERTV(PATTERN, rc, 0 == rc);
+
+            recorder.sort();
+            if (veryVerbose) {
+                T_ P_(PATTERN) P_(recorder.files().size())
+                                              P(recorder.directories().size())
+            }
+            ASSERTV(PATTERN, expFiles.size(), recorder.files().size(),
+                    expFiles == recorder.files());
+            ASSERTV(PATTERN, expDirectories == recorder.directories());
+        }
+
+        if (verbose) cout << "\tHidden entries and links." << endl;
+        {
+            u::Recorder recorder;
+            ASSERT(0 == Util::walkTree(tempDir, ".*", recorder.visitor()));
+            ASSERTV(recorder.files().size(), 1 == recorder.files().size());
+            ASSERTV(recorder.directories().size(),
+                    1 == recorder.directories().size());
+
+            u::Recorder links;
+            ASSERT(0 == Util::walkTree(tempDir, "link*", links.visitor()));
+            ASSERT(links.files().empty());
+            ASSERT(links.directories().empty());
+        }
+
+        if (verbose) cout << "\tOrder of directories." << endl;
+        {
+            u::Recorder recorder;
+            ASSERT(0 == Util::walkTree(tempDir, "*", recorder.visitor()));
+
+            const bsl::vector<bsl::string>& dirs = recorder.directories();
+            for (bsl::size_t i = 0; i < dirs.size(); ++i) {
+                bsl::string parent(dirs[i]);
+                PUtil::popLeaf(&parent);
+                if (parent == tempDir) {
+                    continue;
+                }
+                const bsl::size_t j = bsl::find(dirs.begin(),
+                                                dirs.end(),
+                                                parent) - dirs.begin();
+                ASSERTV(dirs[i], j < i);
+            }
+        }
+
+        if (verbose) cout << "\tRoot ending with a separator." << endl;
+        {
+            bsl::vector<bsl::string> expFiles, expDirectories;
+            u::loadExpected(&expFiles, &expDirectories, tempDir, "*.log");
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+            const bsl::string root = tempDir + "\\";
+#else
+            const bsl::string root = tempDir + "/";
+#endif
+            u::Recorder recorder;
+            ASSERT(0 == Util::walkTree(root, "*.log", recorder.visitor()));
+            recorder.sort();
+            ASSERT(expFiles == recorder.files());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a small tree and walk it with and without a thread pool,
+        //:   counting the reported entries.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        TempDirectoryGuard tempDirGuard;
+        const bsl::string& tempDir = tempDirGuard.getTempDirName();
+
+        u::makeTree(tempDir, 2, 2, 2);
+
+        u::Recorder recorder;
+        ASSERT(0 == Util::walkTree(tempDir, "*", recorder.visitor()));
+        ASSERTV(recorder.files().size(), 14 == recorder.files().size());
+        ASSERTV(recorder.directories().size(),
+                6 == recorder.directories().size());
+
+        u::Recorder logs;
+        ASSERT(0 == Util::walkTree(tempDir, "*.log", logs.visitor()));
+        ASSERTV(logs.files().size(), 7 == logs.files().size());
+        ASSERT(logs.directories().empty());
+
+        bslmt::ThreadAttributes attributes;
+        bdlmt::ThreadPool       threadPool(attributes, 2, 2, 1000);
+        ASSERT(0 == threadPool.start());
+
+        u::Recorder parallel;
+        ASSERT(0 == Util::walkTree(tempDir,
+                                   "*",
+                                   parallel.visitor(),
+                                   &threadPool));
+        parallel.sort();
+        recorder.sort();
+        ASSERT(recorder.files()       == parallel.files());
+        ASSERT(recorder.directories() == parallel.directories());
+
+        threadPool.stop();
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: DEEP AND WIDE TREES
+        //
+        // Concerns:
+        //: 1 'walkTree' is faster than 'visitTree', and faster with a thread
+        //:   pool than without, on trees whose shape is typical of log
+        //:   directories (wide) and on degenerate (deep) trees.
+        //
+        // Plan:
+        //: 1 Create a wide tree (many directories, each holding many files)
+        //:   and a deep tree (a long chain of directories), and time walks
+        //:   of each tree with 'visitTree', and with 'walkTree' without and
+        //:   with thread pools of 2, 4, and 8 threads.  The sizes of the
+        //:   trees may be specified as the second to fourth arguments:
+        //:   number of directories of the wide tree, files per directory,
+        //:   and depth of the deep tree.
+        //
+        // Testing:
+        //   PERFORMANCE TEST: DEEP AND WIDE TREES
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE TEST: DEEP AND WIDE TREES" << endl
+             << "=====================================" << endl;
+
+        TempDirectoryGuard tempDirGuard;
+        const bsl::string& tempDir = tempDirGuard.getTempDirName();
+
+        const int NUM_DIRS  = argc > 2 ? bsl::atoi(argv[2]) : 200;
+        const int NUM_FILES = argc > 3 ? bsl::atoi(argv[3]) : 500;
+        const int DEPTH     = argc > 4 ? bsl::atoi(argv[4]) : 2000;
+
+        bsl::string wide(tempDir);
+        bsl::string deep(tempDir);
+        PUtil::appendRaw(&wide, "wide");
+        PUtil::appendRaw(&deep, "deep");
+        ASSERT(0 == FUtil::createDirectories(wide, true));
+        ASSERT(0 == FUtil::createDirectories(deep, true));
+        u::makeTree(wide, 1, NUM_DIRS, NUM_FILES);
+        {
+            bsl::string path(deep);
+            for (int i = 0; i < DEPTH; ++i) {
+                PUtil::appendRaw(&path, "d");
+            }
+            ASSERT(0 == FUtil::createDirectories(path, true));
+            u::makeTree(path, 0, 0, NUM_FILES);
+        }
+        P_(NUM_DIRS) P_(NUM_FILES) P(DEPTH)
+
+        const char *const NAMES[] = { "wide", "deep" };
+        const char *const ROOTS[] = { wide.c_str(), deep.c_str() };
+
+        for (int ri = 0; ri < 2; ++ri) {
+            const char *const ROOT = ROOTS[ri];
+
+            bsl::vector<bsl::string> paths;
+            bsls::Stopwatch          timer;
+
+            timer.start(true);
+            FUtil::visitTree(ROOT,
+                             "*.log",
+                             bdlf::BindUtil::bind(&u::recordPath,
+                                                  &paths,
+                                                  bdlf::PlaceHolders::_1));
+            timer.stop();
+            cout << NAMES[ri] << ": visitTree: " << paths.size()
+                 << " paths, wall " << timer.elapsedTime()
+                 << "s, cpu " << timer.accumulatedUserTime() +
+                                 timer.accumulatedSystemTime()
+                 << 's' << endl;
+
+            const int NUM_THREADS[] = { 0, 2, 4, 8 };
+            for (int ti = 0; ti < 4; ++ti) {
+                const int NT = NUM_THREADS[ti];
+
+                bslmt::ThreadAttributes attributes;
+                bdlmt::ThreadPool       threadPool(attributes, NT, NT, 1000);
+                if (NT) {
+                    ASSERT(0 == threadPool.start());
+                }
+
+                u::Recorder recorder;
+                timer.reset();
+                timer.start(true);
+                const int rc = Util::walkTree(ROOT,
+                                              "*.log",
+                                              recorder.visitor(),
+                                              NT ? &threadPool : 0);
+                timer.stop();
+                ASSERTV(rc, 0 == rc);
+                ASSERTV(paths.size(), recorder.files().size(),
+                        paths.size() == recorder.files().size());
+
+                cout << NAMES[ri] << ": walkTree, " << NT << " threads: "
+                     << recorder.files().size()
+                     << " paths, wall " << timer.elapsedTime()
+                     << "s, cpu " << timer.accumulatedUserTime() +
+                                     timer.accumulatedSystemTime()
+                     << 's' << endl;
+
+                if (NT) {
+                    threadPool.stop();
+                }
+            }
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -185,7 +185,17 @@ int FixedThreadPool::startNewThread()
     bsl::function<void()> workerThreadFunc =
                   bdlf::MemFnUtil::memFn(&FixedThreadPool::workerThread, this);
 
-    int rc = d_threadGroup.addThread(workerThreadFunc, d_threadAttributes);
+    int rc;
+    if (ThreadPlacementUtil::e_NONE == threadPlacement()) {
+        rc = d_threadGroup.addThread(workerThreadFunc, d_threadAttributes);
+    }
+    else {
+        bslmt::ThreadAttributes attributes(d_threadAttributes);
+        ThreadPlacementUtil::setCpuAffinity(&attributes,
+                                            threadPlacement(),
+                                            d_threadGroup.numThreads());
+        rc = d_threadGroup.addThread(workerThreadFunc, attributes);
+    }
 
 #if defined(BSLS_PLATFORM_OS_UNIX)
     // Restore the mask.
@@ -210,6 +220,7 @@ FixedThreadPool::FixedThreadPool(
 , d_threadGroup(basicAllocator)
 , d_threadAttributes(threadAttributes, basicAllocator)
 , d_numThreads(numThreads)
+, d_threadPlacement(ThreadPlacementUtil::e_NONE)
 {
     BSLS_ASSERT_OPT(1          <= numThreads);
     BSLS_ASSERT_OPT(1          <= maxNumPendingJobs);
@@ -232,6 +243,7 @@ FixedThreadPool::FixedThreadPool(int               numThreads,
 , d_threadGroup(basicAllocator)
 , d_threadAttributes(basicAllocator)
 , d_numThreads(numThreads)
+, d_threadPlacement(ThreadPlacementUtil::e_NONE)
 {
     BSLS_ASSERT_OPT(0 != d_numThreads);
 
@@ -379,6 +391,13 @@ int FixedThreadPool::start()
     return 0;
 }
 
+void FixedThreadPool::setThreadPlacement(ThreadPlacementUtil::Policy policy)
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_metaMutex);
+
+    d_threadPlacement = policy;
+}
+
 void FixedThreadPool::stop()
 {
     bslmt::LockGuard<bslmt::Mutex> lock(&d_metaMutex);
@@ -56,6 +56,18 @@ BSLS_IDENT("$Id: $")
 // 'bslmt_threadutil' package documentation for a description of
 // 'bslmt::ThreadAttributes'.
 //
+///Thread Placement
+///----------------
+// On hosts having several sockets (or NUMA nodes), the threads of a pool can
+// be bound to particular CPUs to preserve their caches and the locality of
+// the memory they access.  The 'setThreadPlacement' method specifies a
+// placement policy (see 'bdlmt_threadplacementutil') that is applied, in
+// addition to the thread attributes supplied at construction, to each thread
+// subsequently started by 'start': the 'i'th worker thread has its
+// 'cpuAffinity' attribute computed by
+// 'bdlmt::ThreadPlacementUtil::setCpuAffinity' for the index 'i'.  Note that
+// the placement of threads that are already running is not changed.
+//
 // Thread pools are ideal for developing multi-threaded server applications.  A
 // server need only package client requests to execute as jobs, and
 // 'bdlmt::FixedThreadPool' will handle the queue management, thread
@@ -298,6 +310,8 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlcc_fixedqueue.h>
 
+#include <bdlmt_threadplacementutil.h>
+
 #include <bslmf_movableref.h>
 
 #include <bslmt_mutex.h>
@@ -412,6 +426,11 @@ class FixedThreadPool {
     const int               d_numThreads;         // number of configured
                                                   // processing threads.
 
+    bsls::AtomicInt         d_threadPlacement;    // placement policy applied
+                                                  // to the processing threads
+                                                  // (see
+                                                  // 'ThreadPlacementUtil')
+
 #if defined(BSLS_PLATFORM_OS_UNIX)
     sigset_t                d_blockSet;           // set of signals to be
                                                   // blocked in managed threads
@@ -532,6 +551,13 @@ class FixedThreadPool {
         // 'numThreads()' threads were not successfully started, all threads
         // are stopped.
 
+    void setThreadPlacement(ThreadPlacementUtil::Policy policy);
+        // Set the thread placement policy of this thread pool to the
+        // specified 'policy'.  The processing threads subsequently started by
+        // 'start' are bound to the CPUs determined by 'policy' and the index
+        // of each thread in the pool (see {Thread Placement}).  Note that
+        // threads that are already running are unaffected.
+
     void stop();
         // Disable queuing on this thread pool and wait until all pending jobs
         // complete, then shut down all processing threads.
@@ -565,6 +591,9 @@ class FixedThreadPool {
     int queueCapacity() const;
         // Return the capacity of the queue used to enqueue jobs by this thread
         // pool.
+
+    ThreadPlacementUtil::Policy threadPlacement() const;
+        // Return the thread placement policy of this thread pool.
 };
 
 // ============================================================================
@@ -648,6 +677,13 @@ int FixedThreadPool::queueCapacity() const
     return d_queue.size();
 }
 
+inline
+ThreadPlacementUtil::Policy FixedThreadPool::threadPlacement() const
+{
+    return static_cast<ThreadPlacementUtil::Policy>(
+                                              d_threadPlacement.loadRelaxed());
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
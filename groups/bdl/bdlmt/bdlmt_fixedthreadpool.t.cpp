@@ -23,6 +23,7 @@
 #include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_cstddef.h>
 #include <bsl_cstdio.h>             // For FILE in usage example
 #include <bsl_cstdlib.h>            // for atoi
@@ -34,6 +35,11 @@
 
 #include <bsl_c_signal.h>
 
+#if defined(BSLS_PLATFORM_OS_LINUX)
+#        include <pthread.h>
+#        include <sched.h>
+#endif
+
 // for collecting CPU time
 #ifdef BSLS_PLATFORM_OS_WINDOWS
 #        include <windows.h>
@@ -66,6 +72,8 @@ using namespace bsl;  // automatically added by script
 // [ 3] ~bdlmt::FixedThreadPool();
 // [ 3] int enqueueJob(const bsl::function<void()>& );
 // [15] int enqueueJob(bslmf::MovableRef<Job>);
+// [16] void setThreadPlacement(ThreadPlacementUtil::Policy);
+// [16] ThreadPlacementUtil::Policy threadPlacement() const;
 // [ 3] int numThreads() const;
 // [ 4] int enqueueJob(FixedThreadPoolJobFunc, void *);
 // [ 4] void start();
@@ -582,6 +590,44 @@ void CopyCountingFunctor::operator()()
 
 }  // close namespace FIXEDTHREADPOOL_CASE_15
 
+// ============================================================================
+//                         CASE 16 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace FIXEDTHREADPOOL_CASE_16 {
+
+void recordAffinity(bsl::vector<bsl::vector<int> > *result,
+                    bslmt::Mutex                   *mutex,
+                    bslmt::Barrier                 *barrier)
+    // Append to the specified 'result' the CPUs on which the calling thread
+    // may run (an empty list on platforms where this is not available),
+    // synchronizing with the specified 'mutex', then wait on the specified
+    // 'barrier'.
+{
+    bsl::vector<int> cpus;
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (0 == pthread_getaffinity_np(pthread_self(), sizeof set, &set)) {
+        for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+            if (CPU_ISSET(cpu, &set)) {
+                cpus.push_back(cpu);
+            }
+        }
+    }
+#endif
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(mutex);
+        result->push_back(cpus);
+    }
+
+    barrier->wait();
+}
+
+}  // close namespace FIXEDTHREADPOOL_CASE_16
+
 
 // ============================================================================
 //                         CASE 11 RELATED ENTITIES
@@ -752,6 +798,90 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:  // case 0 is always the first case
+      case 16: {
+        // --------------------------------------------------------------------
+        // TESTING THREAD PLACEMENT
+        //
+        // Concerns:
+        //: 1 The initial placement policy is 'e_NONE'.
+        //:
+        //: 2 'setThreadPlacement' sets the policy reported by
+        //:   'threadPlacement'.
+        //:
+        //: 3 The threads started by 'start' run on the CPUs assigned by
+        //:   'bdlmt::ThreadPlacementUtil' to the indices '0' to
+        //:   'numThreads() - 1'.
+        //
+        // Plan:
+        //: 1 Create pools, set each policy, and verify the accessor.  (C-1..2)
+        //:
+        //: 2 Start the pool and have every thread record its affinity
+        //:   (using a barrier so that every thread runs one job).  On Linux,
+        //:   verify that the recorded CPU sets are those expected.  (C-3)
+        //
+        // Testing:
+        //   void setThreadPlacement(ThreadPlacementUtil::Policy);
+        //   ThreadPlacementUtil::Policy threadPlacement() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING THREAD PLACEMENT\n"
+                          << "========================" << endl;
+
+        using namespace FIXEDTHREADPOOL_CASE_16;
+
+        typedef bdlmt::ThreadPlacementUtil Util;
+
+        const Util::Policy POLICIES[] = { Util::e_NONE,
+                                          Util::e_COMPACT,
+                                          Util::e_SCATTER,
+                                          Util::e_NUMA_NODE };
+        const int NUM_POLICIES = sizeof POLICIES / sizeof *POLICIES;
+
+        enum { k_NUM_THREADS = 4 };
+
+        for (int p = 0; p < NUM_POLICIES; ++p) {
+            const Util::Policy POLICY = POLICIES[p];
+
+            Obj mX(k_NUM_THREADS, k_NUM_THREADS, &testAllocator);
+            const Obj& X = mX;
+
+            ASSERTV(p, Util::e_NONE == X.threadPlacement());
+
+            mX.setThreadPlacement(POLICY);
+            ASSERTV(p, POLICY == X.threadPlacement());
+
+            ASSERTV(p, 0 == mX.start());
+
+            bsl::vector<bsl::vector<int> > affinities;
+            bslmt::Mutex                   mutex;
+            bslmt::Barrier                 barrier(k_NUM_THREADS);
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERTV(p, i, 0 == mX.enqueueJob(bdlf::BindUtil::bind(
+                                                           &recordAffinity,
+                                                           &affinities,
+                                                           &mutex,
+                                                           &barrier)));
+            }
+            mX.stop();
+
+            ASSERTV(p, k_NUM_THREADS == static_cast<int>(affinities.size()));
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+            if (Util::e_NONE != POLICY) {
+                bsl::vector<bsl::vector<int> > expected;
+                for (int i = 0; i < k_NUM_THREADS; ++i) {
+                    bsl::vector<int> cpus;
+                    Util::assignCpus(&cpus, POLICY, i);
+                    expected.push_back(cpus);
+                }
+                bsl::sort(expected.begin(), expected.end());
+                bsl::sort(affinities.begin(), affinities.end());
+                ASSERTV(p, expected == affinities);
+            }
+#endif
+        }
+      } break;
       case 15: {
         // --------------------------------------------------------------------
         // TESTING MOVING ENQUEUEJOB
@@ -15,11 +15,14 @@ BSLS_IDENT_RCSID(bdlmt_multiqueuethreadpool_cpp,"$Id$ $CSID$")
 
 #include <bslma_default.h>
 
+#include <bslmf_movableref.h>
+
 #include <bsls_assert.h>
 #include <bsls_log.h>
 #include <bsls_stackaddressutil.h>
 #include <bsls_systemtime.h>
 #include <bsls_timeinterval.h>
+#include <bsls_timeutil.h>
 
 #include <bsl_algorithm.h>
 #include <bsl_memory.h>
@@ -51,6 +54,112 @@ namespace bdlmt {
                      // --------------------------------
 
 // PRIVATE MANIPULATORS
+void MultiQueueThreadPool_Queue::movePendingJobs()
+{
+    BSLMT_MUTEXASSERT_IS_LOCKED(&d_lock);
+
+    PendingJob *head = d_pending.swap(0);
+    if (0 == head) {
+        return;                                                       // RETURN
+    }
+
+    // The list links each node to the node pushed before it; reverse it to
+    // move the jobs in the order they were pushed.
+
+    PendingJob *oldest = 0;
+    int         count  = 0;
+    while (head) {
+        PendingJob *next = head->d_next_p;
+        head->d_next_p = oldest;
+        oldest         = head;
+        head           = next;
+        ++count;
+    }
+
+    while (oldest) {
+        PendingJob *next = oldest->d_next_p;
+        Job&        job  = oldest->d_job.object();
+
+        d_list.emplace_back(bslmf::MovableRefUtil::move(job),
+                            oldest->d_enqueueTime);
+        job.~Job();
+        d_pendingPool.deallocate(oldest);
+
+        oldest = next;
+    }
+
+    d_numPending.addRelaxed(-count);
+}
+
+int MultiQueueThreadPool_Queue::pushBackLockFree(const Job& functor)
+{
+    // Announce the push before checking the enqueue state.  'disable' changes
+    // the state and then waits for 'd_numPushing' to be 0 so that, both
+    // operations being sequentially consistent, either this thread observes
+    // the new state, or 'disable' waits for the job to be pushed.
+
+    ++d_numPushing;
+
+    if (e_ENQUEUING_ENABLED != d_enqueueState) {
+        --d_numPushing;
+        return 1;                                                     // RETURN
+    }
+
+    PendingJob *node = static_cast<PendingJob *>(d_pendingPool.allocate());
+    new (node->d_job.buffer()) Job(bsl::allocator_arg,
+                                   d_list.get_allocator().mechanism(),
+                                   functor);
+    node->d_enqueueTime = bsls::TimeUtil::getTimer();
+
+    // Account for the job before it becomes visible, so that 'length' never
+    // under-reports.
+
+    ++d_numPending;
+    ++d_numEnqueued;
+
+    PendingJob *head = d_pending.loadRelaxed();
+    do {
+        node->d_next_p = head;
+        PendingJob *prev = d_pending.testAndSwap(head, node);
+        if (prev == head) {
+            break;
+        }
+        head = prev;
+    } while (1);
+
+    --d_numPushing;
+
+    if (0 == head) {
+        // This job is the first one of the list: the processing thread may
+        // have observed the list empty and the queue may need scheduling.
+        // Subsequent producers rely on this thread (or on the processing
+        // thread) to move their jobs.
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
+
+        movePendingJobs();
+        schedule();
+    }
+
+    return 0;
+}
+
+void MultiQueueThreadPool_Queue::schedule()
+{
+    BSLMT_MUTEXASSERT_IS_LOCKED(&d_lock);
+
+    if (e_NOT_SCHEDULED == d_runState && !d_list.empty()) {
+        d_runState = e_SCHEDULED;
+
+        ++d_multiQueueThreadPool_p->d_numActiveQueues;
+
+        int status = d_multiQueueThreadPool_p->d_threadPool_p->
+                                                    enqueueJob(d_processingCb);
+
+        BSLS_ASSERT_OPT(0 == status);  (void)status;
+    }
+}
+
 void MultiQueueThreadPool_Queue::setPaused()
 {
     BSLS_ASSERT(e_PAUSING == d_runState);
@@ -65,7 +174,7 @@ void MultiQueueThreadPool_Queue::setPaused()
 
     if (e_DELETING == d_enqueueState) {
         int status = d_multiQueueThreadPool_p->d_threadPool_p->
-                                                    enqueueJob(d_list.front());
+                                              enqueueJob(d_list.front().first);
 
         BSLS_ASSERT_OPT(0 == status);  (void)status;
 
@@ -84,6 +193,11 @@ MultiQueueThreadPool_Queue::MultiQueueThreadPool_Queue(
                                     bslma::Allocator     *basicAllocator)
 : d_multiQueueThreadPool_p(multiQueueThreadPool)
 , d_list(basicAllocator)
+, d_pending(0)
+, d_numPending(0)
+, d_numPushing(0)
+, d_pendingPool(sizeof(PendingJob), basicAllocator)
+, d_lockFree(false)
 , d_enqueueState(e_ENQUEUING_ENABLED)
 , d_runState(e_NOT_SCHEDULED)
 , d_batchSize(1)
@@ -94,11 +208,16 @@ MultiQueueThreadPool_Queue::MultiQueueThreadPool_Queue(
                                      &MultiQueueThreadPool_Queue::executeFront,
                                      this))
 , d_processor(bslmt::ThreadUtil::invalidHandle())
+, d_numEnqueued(0)
+, d_numExecuted(0)
+, d_waitTime(0)
+, d_executionTime(0)
 {
 }
 
 MultiQueueThreadPool_Queue::~MultiQueueThreadPool_Queue()
 {
+    reset();
 }
 
 // MANIPULATORS
@@ -111,6 +230,11 @@ void MultiQueueThreadPool_Queue::setBatchSize(int batchSize)
     d_batchSize = batchSize;
 }
 
+void MultiQueueThreadPool_Queue::setLockFreeEnqueue(bool lockFree)
+{
+    d_lockFree = lockFree;
+}
+
 int MultiQueueThreadPool_Queue::enable()
 {
     bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
@@ -132,6 +256,15 @@ int MultiQueueThreadPool_Queue::disable()
     }
 
     d_enqueueState = e_ENQUEUING_DISABLED;
+
+    // Wait for the threads that observed enqueuing enabled to push their
+    // jobs (see 'pushBackLockFree').  Note that these threads do not acquire
+    // 'd_lock' before decrementing 'd_numPushing'.
+
+    while (d_numPushing) {
+        bslmt::ThreadUtil::yield();
+    }
+
     return 0;
 }
 
@@ -169,11 +302,17 @@ void MultiQueueThreadPool_Queue::drainWaitWhilePausing()
 
 void MultiQueueThreadPool_Queue::executeFront()
 {
-    bsl::vector<Job> functors;
+    bsl::vector<QueuedJob> functors;
+    bool                   isCounted = true;
 
     {
         bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
 
+        // Take, with a single exchange, every job pushed onto the lock-free
+        // list since the previous batch.
+
+        movePendingJobs();
+
         BSLS_ASSERT(!d_list.empty());
 
         if (e_PAUSING == d_runState) {
@@ -193,15 +332,18 @@ void MultiQueueThreadPool_Queue::executeFront()
                              d_list.size());
 
             d_multiQueueThreadPool_p->d_numExecuted += static_cast<int>(count);
+            d_numExecuted += count;
         }
         else {
-            count = 1;
+            count     = 1;
+            isCounted = false;
         }
 
         functors.reserve(count);
 
         for (bsl::size_t i = 0; i < count; ++i) {
-            functors.emplace_back(d_list.front());
+            functors.emplace_back(
+                             bslmf::MovableRefUtil::move(d_list.front()));
             d_list.pop_front();
         }
 
@@ -215,10 +357,21 @@ void MultiQueueThreadPool_Queue::executeFront()
     // creating a new state to reflect this situation while the 'functors' are
     // executing, we leave 'd_runState' as 'e_SCHEDULED'.
 
+    // The start time of each job is the end time of the previous one, so that
+    // the timer is read once per job.
+
+    const bsls::Types::Int64 startTime = bsls::TimeUtil::getTimer();
+    bsls::Types::Int64       jobTime   = startTime;
+    bsls::Types::Int64       waitTime  = 0;
+
     for (bsl::size_t i = 0; i < functors.size(); ++i) {
-        functors[i]();
+        waitTime += jobTime - functors[i].second;
+        functors[i].first();
+        jobTime = bsls::TimeUtil::getTimer();
     }
 
+    const bsls::Types::Int64 elapsed = jobTime - startTime;
+
     // Note that 'pause' might be called while executing the functors since no
     // lock is held.
 
@@ -229,6 +382,14 @@ void MultiQueueThreadPool_Queue::executeFront()
 
         d_processor = bslmt::ThreadUtil::invalidHandle();
 
+        d_executionTime += elapsed;
+
+        if (isCounted) {
+            d_waitTime += waitTime;
+        }
+
+        movePendingJobs();
+
         // As per the above, at this point 'e_SCHEDULED' does not imply there
         // is a job queued in the thread pool.
 
@@ -264,6 +425,8 @@ bool MultiQueueThreadPool_Queue::enqueueDeletion(
 
     d_enqueueState = e_DELETING;
 
+    movePendingJobs();
+
     bool isProcessingThread = bslmt::ThreadUtil::self() == d_processor;
 
     Job job = bdlf::BindUtil::bind(&MultiQueueThreadPool::deleteQueueCb,
@@ -291,7 +454,7 @@ bool MultiQueueThreadPool_Queue::enqueueDeletion(
 
         d_runState = e_PAUSING;
 
-        d_list.push_front(job);
+        d_list.emplace_front(job, 0);
     }
 
     return isProcessingThread;
@@ -321,23 +484,23 @@ int MultiQueueThreadPool_Queue::initiatePause()
 
 int MultiQueueThreadPool_Queue::pushBack(const Job& functor)
 {
+    if (d_lockFree) {
+        return pushBackLockFree(functor);                             // RETURN
+    }
+
     bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
 
     if (e_ENQUEUING_ENABLED == d_enqueueState) {
-        d_list.push_back(functor);
-
-        // Note that the following should match what is in 'pushFront'.
+        // Move the jobs of the lock-free list to 'd_list' first, so that the
+        // jobs enqueued before lock-free enqueuing was disabled precede
+        // 'functor'.
 
-        if (e_NOT_SCHEDULED == d_runState) {
-            d_runState = e_SCHEDULED;
+        movePendingJobs();
 
-            ++d_multiQueueThreadPool_p->d_numActiveQueues;
+        d_list.emplace_back(functor, bsls::TimeUtil::getTimer());
+        ++d_numEnqueued;
 
-            int status = d_multiQueueThreadPool_p->d_threadPool_p->
-                                                    enqueueJob(d_processingCb);
-
-            BSLS_ASSERT_OPT(0 == status);  (void)status;
-        }
+        schedule();
 
         return 0;                                                     // RETURN
     }
@@ -350,21 +513,15 @@ int MultiQueueThreadPool_Queue::pushFront(const Job& functor)
     bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
 
     if (e_ENQUEUING_ENABLED == d_enqueueState) {
-        d_list.push_front(functor);
+        // Move the jobs of the lock-free list to 'd_list' first, so that
+        // 'functor' is placed ahead of them.
 
-        // Note that the following should match what is in 'pushBack'.
+        movePendingJobs();
 
-        if (e_NOT_SCHEDULED == d_runState) {
+        d_list.emplace_front(functor, bsls::TimeUtil::getTimer());
+        ++d_numEnqueued;
 
-            d_runState = e_SCHEDULED;
-
-            ++d_multiQueueThreadPool_p->d_numActiveQueues;
-
-            int status = d_multiQueueThreadPool_p->d_threadPool_p->
-                                                    enqueueJob(d_processingCb);
-
-            BSLS_ASSERT_OPT(0 == status);  (void)status;
-        }
+        schedule();
 
         return 0;                                                     // RETURN
     }
@@ -374,12 +531,25 @@ int MultiQueueThreadPool_Queue::pushFront(const Job& functor)
 
 void MultiQueueThreadPool_Queue::reset()
 {
-    d_list.clear();
-    d_enqueueState = e_ENQUEUING_ENABLED;
-    d_runState     = e_NOT_SCHEDULED;
-    d_pauseCount   = 0;
-    d_processor    = bslmt::ThreadUtil::invalidHandle();
+    PendingJob *head = d_pending.swap(0);
+    while (head) {
+        PendingJob *next = head->d_next_p;
+        head->d_job.object().~Job();
+        d_pendingPool.deallocate(head);
+        head = next;
+    }
 
+    d_list.clear();
+    d_numPending    = 0;
+    d_lockFree      = false;
+    d_enqueueState  = e_ENQUEUING_ENABLED;
+    d_runState      = e_NOT_SCHEDULED;
+    d_pauseCount    = 0;
+    d_processor     = bslmt::ThreadUtil::invalidHandle();
+    d_numEnqueued   = 0;
+    d_numExecuted   = 0;
+    d_waitTime      = 0;
+    d_executionTime = 0;
 }
 
 int MultiQueueThreadPool_Queue::resume()
@@ -406,6 +576,8 @@ int MultiQueueThreadPool_Queue::resume()
         return 1;                                                     // RETURN
     }
 
+    movePendingJobs();
+
     if (!d_list.empty()) {
         int status = d_multiQueueThreadPool_p->d_threadPool_p->
                                                     enqueueJob(d_processingCb);
@@ -70,6 +70,36 @@ BSLS_IDENT("$Id: $")
 // encouraged to use benchmarks to guide their decision when setting this
 // option.
 //
+///Lock-Free Enqueuing
+///-------------------
+// By default, enqueuing a job acquires a mutex owned by the target queue,
+// which is also acquired by the thread processing that queue.  When many
+// threads enqueue jobs onto the same queue, that mutex can become a point of
+// contention.  'setLockFreeEnqueue' configures a queue so that 'enqueueJob'
+// instead pushes jobs onto a lock-free, multi-producer, single-consumer list;
+// only the producer that finds the list empty acquires the mutex (to schedule
+// the queue for processing, if needed).  The thread processing the queue
+// detaches every job pushed onto that list with a single atomic exchange,
+// then executes up to the configured batch size of them (see
+// {'Job Execution Batch Size'}).  The order of the jobs enqueued by any one
+// thread is preserved, including across calls to 'setLockFreeEnqueue'.  A job
+// is enqueued lock-free only if the queue is enabled, and 'disableQueue' (or
+// 'deleteQueue') waits for the lock-free pushes in progress to complete, so
+// that no job is enqueued after 'disableQueue' returns.  Note that
+// 'addJobAtFront' always acquires the mutex.
+//
+///Queue Statistics
+///----------------
+// For each queue, the pool maintains the number of jobs enqueued, the number
+// of jobs executed, the total time those jobs waited in the queue (from being
+// enqueued to the start of their execution), and the total time spent
+// executing them, available through the 'numProcessed' overload taking a
+// queue id.  Together with 'numElements(id)', which reports the depth of a
+// queue, sampling these values periodically gives the enqueue rate, the
+// backlog, the mean processing latency, and the mean job execution time of
+// each queue, identifying the queues that are hot.  Note that maintaining the
+// latency reads the high-resolution timer once for each job enqueued.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -332,6 +362,7 @@ BSLS_IDENT("$Id: $")
 #include <bdlscm_version.h>
 
 #include <bslmt_lockguard.h>
+#include <bdlmt_threadplacementutil.h>
 #include <bdlmt_threadpool.h>
 
 #include <bdlcc_objectpool.h>
@@ -348,12 +379,18 @@ BSLS_IDENT("$Id: $")
 #include <bslmt_readlockguard.h>
 #include <bslmt_writelockguard.h>
 
+#include <bdlma_concurrentpool.h>
+
 #include <bsls_assert.h>
 #include <bsls_atomic.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
 
 #include <bsl_deque.h>
 #include <bsl_functional.h>
 #include <bsl_map.h>
+#include <bsl_utility.h>
 
 namespace BloombergLP {
 namespace bslmt { class Latch; }
@@ -388,15 +425,49 @@ class MultiQueueThreadPool_Queue {
         e_PAUSED               // paused
     };
 
+    typedef bsl::pair<Job, bsls::Types::Int64> QueuedJob;
+        // A job and the value of 'bsls::TimeUtil::getTimer()' when it was
+        // enqueued.
+
+    struct PendingJob {
+        // This 'struct' is a node of the lock-free list of jobs enqueued
+        // while lock-free enqueuing is enabled.
+
+        PendingJob              *d_next_p;       // next (older) node
+        bsls::ObjectBuffer<Job>  d_job;          // enqueued job
+        bsls::Types::Int64       d_enqueueTime;  // timer value at enqueuing
+    };
+
     // DATA
     MultiQueueThreadPool      *d_multiQueueThreadPool_p;
                                                  // the 'MultiQueueThreadPool'
                                                  // that owns this object
 
-    bsl::deque<Job>            d_list;           // queue of jobs to be
-                                                 // executed
+    bsl::deque<QueuedJob>      d_list;           // queue of jobs to be
+                                                 // executed, with their
+                                                 // enqueuing times
+
+    bsls::AtomicPointer<PendingJob>
+                               d_pending;        // most recently pushed node
+                                                 // of the lock-free list of
+                                                 // jobs not yet moved to
+                                                 // 'd_list'
+
+    bsls::AtomicInt            d_numPending;     // number of jobs in the
+                                                 // lock-free list
+
+    bsls::AtomicInt            d_numPushing;     // number of threads in
+                                                 // 'pushBackLockFree' that
+                                                 // may still push a job
+
+    bdlma::ConcurrentPool      d_pendingPool;    // pool of 'PendingJob' nodes
+
+    bsls::AtomicBool           d_lockFree;       // 'true' if 'pushBack' uses
+                                                 // the lock-free list
 
-    EnqueueState               d_enqueueState;   // maintains enqueue state
+    bsls::AtomicInt            d_enqueueState;   // maintains enqueue state
+                                                 // ('EnqueueState'); may be
+                                                 // read without 'd_lock'
 
     RunState                   d_runState;       // maintains run state
 
@@ -417,12 +488,39 @@ class MultiQueueThreadPool_Queue {
     bslmt::ThreadUtil::Handle  d_processor;      // current worker thread, or
                                                  // ThreadUtil::invalidHandle()
 
+    bsls::AtomicInt64          d_numEnqueued;    // number of jobs enqueued
+
+    bsls::Types::Int64         d_numExecuted;    // number of jobs executed
+
+    bsls::Types::Int64         d_waitTime;       // total time, in
+                                                 // nanoseconds, executed jobs
+                                                 // waited to start executing
+
+    bsls::Types::Int64         d_executionTime;  // total time, in
+                                                 // nanoseconds, spent
+                                                 // executing jobs
+
     // NOT IMPLEMENTED
     MultiQueueThreadPool_Queue();
     MultiQueueThreadPool_Queue(const MultiQueueThreadPool_Queue&);
     MultiQueueThreadPool_Queue &operator=(const MultiQueueThreadPool_Queue &);
 
     // PRIVATE MANIPULATORS
+    void movePendingJobs();
+        // Move the jobs of the lock-free list, in the order they were pushed,
+        // to the back of 'd_list'.  The behavior is undefined unless this
+        // queue's lock is in a locked state.
+
+    int pushBackLockFree(const Job& functor);
+        // Push the specified 'functor' onto the lock-free list and, if that
+        // list was empty, schedule this queue for processing if needed.
+        // Return 0 on success, and a non-zero value if enqueuing is disabled.
+
+    void schedule();
+        // Schedule this queue for processing if it is not scheduled, not
+        // paused, and 'd_list' is not empty.  The behavior is undefined unless
+        // this queue's lock is in a locked state.
+
     void setPaused();
         // Mark this queue as paused, notify any threads blocked on
         // 'd_pauseCondition', and schedule the deletion job if this queue is
@@ -456,7 +554,10 @@ class MultiQueueThreadPool_Queue {
     int disable();
         // Disable enqueuing to this queue.  Return 0 on success, and a
         // non-zero value otherwise.  This method will fail (with an error) if
-        // 'prepareForDeletion' has already been called on this object.
+        // 'prepareForDeletion' has already been called on this object.  Note
+        // that this method waits for any job being pushed onto the lock-free
+        // list (see {'Lock-Free Enqueuing'}) to be pushed, so that no job is
+        // enqueued after it returns.
 
     void drainWaitWhilePausing();
         // Block until all threads waiting for this queue to pause are
@@ -496,7 +597,10 @@ class MultiQueueThreadPool_Queue {
 
     int pushBack(const Job& functor);
         // Enqueue the specified 'functor' at the end of this queue.  Return 0
-        // on success, and a non-zero value if enqueuing is disabled.
+        // on success, and a non-zero value if enqueuing is disabled.  Note
+        // that this method does not acquire this queue's lock if lock-free
+        // enqueuing is enabled (see {'Lock-Free Enqueuing'}), unless the
+        // lock-free list is empty.
 
     int pushFront(const Job& functor);
         // Add the specified 'functor' at the front of this queue.  Return 0 on
@@ -523,6 +627,12 @@ class MultiQueueThreadPool_Queue {
         // Note that the initial value for the execution batch size is 1 for
         // all queues.
 
+    void setLockFreeEnqueue(bool lockFree);
+        // Configure 'pushBack' to enqueue jobs onto a lock-free list if the
+        // specified 'lockFree' is 'true', and under this queue's lock
+        // otherwise (see {'Lock-Free Enqueuing'}).  Note that lock-free
+        // enqueuing is initially disabled for all queues.
+
     void waitWhilePausing();
         // Wait until any currently-executing job on the queue completes and
         // the queue is paused.  Note that pausing differs from 'disable' in
@@ -545,11 +655,26 @@ class MultiQueueThreadPool_Queue {
         // Report whether enqueuing to this object is enabled.  This object is
         // constructed with enqueuing enabled.
 
+    bool isLockFreeEnqueue() const;
+        // Report whether lock-free enqueuing is enabled for this queue.
+
     bool isPaused() const;
         // Report whether this object is paused.
 
     int length() const;
         // Return an instantaneous snapshot of the length of this queue.
+
+    void numProcessed(bsls::Types::Int64 *numExecuted,
+                      bsls::Types::Int64 *numEnqueued,
+                      bsls::TimeInterval *executionTime,
+                      bsls::TimeInterval *waitTime) const;
+        // Load into the specified 'numExecuted' and 'numEnqueued' the number
+        // of jobs executed and enqueued (respectively) on this queue, load
+        // into the specified 'executionTime' the total time spent executing
+        // the jobs executed, and load into the specified 'waitTime' the total
+        // time these jobs spent in this queue before starting to execute.
+        // Note that the job executing the deletion of this queue is not
+        // counted.
 };
 
                         // ==========================
@@ -790,6 +915,22 @@ class MultiQueueThreadPool {
         // that the initial value for the execution batch size is 1 for all
         // queues.
 
+    int setLockFreeEnqueue(int id, bool lockFree);
+        // Configure 'enqueueJob' to push jobs onto a lock-free list of the
+        // queue specified by 'id' if the specified 'lockFree' is 'true', and
+        // to acquire the mutex of that queue otherwise (see
+        // {'Lock-Free Enqueuing'}).  Return 0 on success, and a non-zero value
+        // otherwise.  Note that lock-free enqueuing is initially disabled for
+        // all queues.
+
+    int setThreadPlacement(ThreadPlacementUtil::Policy policy);
+        // Set the placement policy of the threads subsequently started by the
+        // thread pool to the specified 'policy' (see
+        // 'bdlmt_threadplacementutil').  Return 0 on success, and a non-zero
+        // value (with no effect) if the thread pool is not owned by this
+        // object.  Note that the placement of a thread pool supplied at
+        // construction is configured on that thread pool directly.
+
     void shutdown();
         // Disable queuing on all queues, and wait until all non-paused queues
         // are empty.  Then, delete all queues, and shut down the thread pool
@@ -831,6 +972,11 @@ class MultiQueueThreadPool {
         // currently enabled, or 'false' otherwise (including if 'id' is not a
         // valid queue id).
 
+    bool isLockFreeEnqueue(int id) const;
+        // Return 'true' if lock-free enqueuing (see {'Lock-Free Enqueuing'})
+        // is enabled for the queue associated with the specified 'id', or
+        // 'false' otherwise (including if 'id' is not a valid queue id).
+
     int numQueues() const;
         // Return an instantaneous snapshot of the number of queues managed by
         // this object.
@@ -853,6 +999,24 @@ class MultiQueueThreadPool {
         // load into the number of items deleted since the last time this value
         // was reset.
 
+    int numProcessed(int                 id,
+                     bsls::Types::Int64 *numExecuted,
+                     bsls::Types::Int64 *numEnqueued,
+                     bsls::TimeInterval *executionTime = 0,
+                     bsls::TimeInterval *waitTime      = 0) const;
+        // Load into the specified 'numExecuted' and 'numEnqueued' the number
+        // of jobs executed and enqueued (respectively) on the queue associated
+        // with the specified 'id' since that queue was created.  Optionally
+        // specify an 'executionTime' used to load the total time spent
+        // executing the jobs executed.  Optionally specify a 'waitTime' used
+        // to load the total time these jobs spent in the queue, from being
+        // enqueued to the start of their execution.  Return 0 on success, and
+        // a non-zero value if 'id' does not specify a valid queue.  Note that
+        // these values are not reset by 'numProcessedReset' and, sampled
+        // periodically together with 'numElements(id)', give the enqueue
+        // rate, the depth, the mean processing latency, and the mean job
+        // execution time of the queue (see {'Queue Statistics'}).
+
     const ThreadPool& threadPool() const;
         // Return a reference to the non-modifiable thread pool owned by this
         // object.
@@ -880,7 +1044,8 @@ bool MultiQueueThreadPool_Queue::isDrained() const
 {
     bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
 
-    return 0 == d_list.size() && (   e_NOT_SCHEDULED == d_runState
+    return 0 == d_list.size() && 0 == d_numPending
+                              && (   e_NOT_SCHEDULED == d_runState
                                   || e_PAUSED        == d_runState);
 }
 
@@ -892,6 +1057,12 @@ bool MultiQueueThreadPool_Queue::isEnabled() const
     return e_ENQUEUING_ENABLED == d_enqueueState;
 }
 
+inline
+bool MultiQueueThreadPool_Queue::isLockFreeEnqueue() const
+{
+    return d_lockFree;
+}
+
 inline
 bool MultiQueueThreadPool_Queue::isPaused() const
 {
@@ -905,7 +1076,29 @@ int MultiQueueThreadPool_Queue::length() const
 {
     bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
 
-    return static_cast<int>(d_list.size());
+    return static_cast<int>(d_list.size()) + d_numPending;
+}
+
+inline
+void MultiQueueThreadPool_Queue::numProcessed(
+                                     bsls::Types::Int64 *numExecuted,
+                                     bsls::Types::Int64 *numEnqueued,
+                                     bsls::TimeInterval *executionTime,
+                                     bsls::TimeInterval *waitTime) const
+{
+    BSLS_ASSERT(numExecuted);
+    BSLS_ASSERT(numEnqueued);
+    BSLS_ASSERT(executionTime);
+    BSLS_ASSERT(waitTime);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
+
+    // Load 'd_numEnqueued' last to ensure 'numExecuted <= numEnqueued'.
+
+    *numExecuted = d_numExecuted;
+    executionTime->setTotalNanoseconds(d_executionTime);
+    waitTime->setTotalNanoseconds(d_waitTime);
+    *numEnqueued = d_numEnqueued;
 }
 
                         // --------------------------
@@ -1009,6 +1202,35 @@ int MultiQueueThreadPool::setBatchSize(int id, int batchSize)
     return 0;
 }
 
+inline
+int MultiQueueThreadPool::setLockFreeEnqueue(int id, bool lockFree)
+{
+    bslmt::ReadLockGuard<bslmt::ReaderWriterMutex> guard(&d_lock);
+
+    MultiQueueThreadPool_Queue *queue;
+
+    if (findIfUsable(id, &queue)) {
+        return 1;                                                     // RETURN
+    }
+
+    queue->setLockFreeEnqueue(lockFree);
+
+    return 0;
+}
+
+inline
+int MultiQueueThreadPool::setThreadPlacement(
+                                            ThreadPlacementUtil::Policy policy)
+{
+    if (!d_threadPoolIsOwned) {
+        return 1;                                                     // RETURN
+    }
+
+    d_threadPool_p->setThreadPlacement(policy);
+
+    return 0;
+}
+
 // ACCESSORS
 inline
 int MultiQueueThreadPool::batchSize(int id) const
@@ -1038,6 +1260,20 @@ bool MultiQueueThreadPool::isEnabled(int id) const
     return false;
 }
 
+inline
+bool MultiQueueThreadPool::isLockFreeEnqueue(int id) const
+{
+    bslmt::ReadLockGuard<bslmt::ReaderWriterMutex> guard(&d_lock);
+
+    QueueRegistry::const_iterator iter = d_queueRegistry.find(id);
+
+    if (d_queueRegistry.end() != iter) {
+        return iter->second->isLockFreeEnqueue();                     // RETURN
+    }
+
+    return false;
+}
+
 inline
 bool MultiQueueThreadPool::isPaused(int id) const
 {
@@ -1089,6 +1325,38 @@ void MultiQueueThreadPool::numProcessed(int *numExecuted,
     *numEnqueued = d_numEnqueued;
 }
 
+inline
+int MultiQueueThreadPool::numProcessed(
+                                     int                 id,
+                                     bsls::Types::Int64 *numExecuted,
+                                     bsls::Types::Int64 *numEnqueued,
+                                     bsls::TimeInterval *executionTime,
+                                     bsls::TimeInterval *waitTime) const
+{
+    BSLS_ASSERT(numExecuted);
+    BSLS_ASSERT(numEnqueued);
+
+    bslmt::ReadLockGuard<bslmt::ReaderWriterMutex> guard(&d_lock);
+
+    QueueRegistry::const_iterator iter = d_queueRegistry.find(id);
+
+    if (d_queueRegistry.end() == iter) {
+        return 1;                                                     // RETURN
+    }
+
+    bsls::TimeInterval time;
+    bsls::TimeInterval wait;
+    iter->second->numProcessed(numExecuted, numEnqueued, &time, &wait);
+    if (executionTime) {
+        *executionTime = time;
+    }
+    if (waitTime) {
+        *waitTime = wait;
+    }
+
+    return 0;
+}
+
 inline
 int MultiQueueThreadPool::numQueues() const
 {
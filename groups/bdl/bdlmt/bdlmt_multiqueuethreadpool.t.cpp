@@ -72,6 +72,7 @@ using namespace BloombergLP;
 //
 // MANIPULATORS
 // [33] void setBatchSize(int id, int batchSize);
+// [34] int setLockFreeEnqueue(int id, bool lockFree);
 // [ 2] int createQueue();
 // [ 2] int deleteQueue(int id, const bsl::function<void()>& cleanupFunc);
 // [ 2] int enqueueJob(int id, const bsl::function<void()>& functor);
@@ -84,7 +85,9 @@ using namespace BloombergLP;
 //
 // ACCESSORS
 // [33] int batchSize(int id) const;
+// [34] bool isLockFreeEnqueue(int id) const;
 // [13] void numProcessed(int *, int *, int * = 0) const;
+// [34] int numProcessed(int, Int64 *, Int64 *, TI * = 0, TI * = 0) const;
 // [ 4] int numQueues() const;
 // [13] int numElements() const;
 // [ 4] int numElements(int id) const;
@@ -112,7 +115,7 @@ using namespace BloombergLP;
 // [30] DRQS 140150365: resume fails immediately after pause
 // [31] DRQS 140403279: pause can deadlock with delete and create
 // [32] DRQS 143578129: 'numElements' stress test
-// [34] USAGE EXAMPLE 1
+// [35] USAGE EXAMPLE 1
 // [-2] PERFORMANCE TEST
 // ----------------------------------------------------------------------------
 
@@ -1462,6 +1465,89 @@ void testDrainQueueAndDrain(bslma::TestAllocator *ta, int concurrency)
 }
 }  // close namespace MULTIQUEUETHREADPOOL_CASE_14
 
+// ============================================================================
+//                         CASE 34 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace MULTIQUEUETHREADPOOL_CASE_34 {
+
+void recordJob(bsl::vector<int> *record, int value)
+    // Append the specified 'value' to the specified 'record'.  Note that this
+    // function is executed by the jobs of a single queue, which are executed
+    // serially.
+{
+    record->push_back(value);
+}
+
+void sleepJob()
+    // Sleep for one millisecond.
+{
+    bslmt::ThreadUtil::microSleep(1000);
+}
+
+void produce(Obj              *pool,
+             int               queueId,
+             bsl::vector<int> *record,
+             int               producer,
+             int               numJobs,
+             bslmt::Barrier   *barrier)
+    // Wait on the specified 'barrier', then enqueue the specified 'numJobs'
+    // jobs onto the queue of the specified 'pool' having the specified
+    // 'queueId', the 'i'th of which records 'producer * numJobs + i' into the
+    // specified 'record'.
+{
+    barrier->wait();
+    for (int i = 0; i < numJobs; ++i) {
+        const int value = producer * numJobs + i;
+        int       rc    = pool->enqueueJob(queueId,
+                                           bdlf::BindUtil::bind(&recordJob,
+                                                                record,
+                                                                value));
+        ASSERT(0 == rc);
+    }
+}
+
+void produceSwitching(Obj              *pool,
+                      int               queueId,
+                      bsl::vector<int> *record,
+                      int               producer,
+                      int               numJobs,
+                      bslmt::Barrier   *barrier)
+    // Wait on the specified 'barrier', then enqueue the specified 'numJobs'
+    // jobs onto the queue of the specified 'pool' having the specified
+    // 'queueId', the 'i'th of which records 'producer * numJobs + i' into the
+    // specified 'record', switching lock-free enqueuing on or off for that
+    // queue before each job.
+{
+    barrier->wait();
+    for (int i = 0; i < numJobs; ++i) {
+        pool->setLockFreeEnqueue(queueId, 0 == (i + producer) % 2);
+
+        const int value = producer * numJobs + i;
+        int       rc    = pool->enqueueJob(queueId,
+                                           bdlf::BindUtil::bind(&recordJob,
+                                                                record,
+                                                                value));
+        ASSERT(0 == rc);
+    }
+}
+
+void produceUntilDisabled(Obj             *pool,
+                          int              queueId,
+                          bsls::AtomicInt *numAccepted,
+                          bslmt::Barrier  *barrier)
+    // Wait on the specified 'barrier', then enqueue jobs onto the queue of the
+    // specified 'pool' having the specified 'queueId' until enqueuing fails,
+    // incrementing the specified 'numAccepted' for each job enqueued.
+{
+    barrier->wait();
+    while (0 == pool->enqueueJob(queueId, noop)) {
+        ++*numAccepted;
+    }
+}
+
+}  // close namespace MULTIQUEUETHREADPOOL_CASE_34
+
 struct DoNothing {
     void operator()() const {}
         // NOP functor for cases 21, 22.
@@ -1481,7 +1567,7 @@ int main(int argc, char *argv[]) {
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:
-      case 34: {
+      case 35: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE 1
         //
@@ -1562,6 +1648,383 @@ int main(int argc, char *argv[]) {
         ASSERT(0 <  ta.numAllocations());
         ASSERT(0 == ta.numBytesInUse());
       }  break;
+      case 34: {
+        // --------------------------------------------------------------------
+        // TESTING LOCK-FREE ENQUEUE AND QUEUE STATISTICS
+        //
+        // Concerns:
+        //: 1 The value returned by 'isLockFreeEnqueue' matches the value
+        //:   assigned by 'setLockFreeEnqueue', which is initially 'false'.
+        //:
+        //: 2 Jobs enqueued concurrently by several threads onto a queue with
+        //:   lock-free enqueuing are all executed, serially, and the jobs of
+        //:   each thread are executed in the order they were enqueued.
+        //:
+        //: 3 Jobs enqueued lock-free onto a paused queue are counted by
+        //:   'numElements', are not executed until the queue is resumed, and
+        //:   execute after a job subsequently added with 'addJobAtFront'.
+        //:
+        //: 4 Jobs enqueued lock-free and not yet executed when the queue is
+        //:   deleted are counted as deleted.
+        //:
+        //: 5 The per-queue statistics report the number of jobs enqueued and
+        //:   executed on the queue, the time they waited to start executing,
+        //:   and the time spent executing them.
+        //:
+        //: 6 The jobs of each thread are executed in the order they were
+        //:   enqueued when lock-free enqueuing is switched on and off.
+        //:
+        //: 7 No job is enqueued after 'disableQueue' returns, even if it is
+        //:   called while threads are enqueuing jobs lock-free.
+        //
+        // Plan:
+        //: 1 Use 'setLockFreeEnqueue' and directly verify the result of
+        //:   'isLockFreeEnqueue', for valid and invalid queue ids.  (C-1)
+        //:
+        //: 2 For several batch sizes, have several threads simultaneously
+        //:   enqueue jobs recording their producer and sequence number, and
+        //:   verify the record after draining the queue.  (C-2)
+        //:
+        //: 3 Pause a queue, enqueue jobs lock-free, add a job at the front,
+        //:   verify 'numElements', resume the queue, and verify the order of
+        //:   execution.  (C-3)
+        //:
+        //: 4 Enqueue jobs lock-free behind a job blocked on a barrier, delete
+        //:   the queue, and verify the pool-wide counts.  (C-4)
+        //:
+        //: 5 Verify the per-queue statistics in P-2 and P-3, the wait time of
+        //:   jobs enqueued on a queue paused for a known duration, and the
+        //:   execution time of jobs sleeping for a known duration.  (C-5)
+        //:
+        //: 6 Repeat P-2 with threads switching lock-free enqueuing on and off
+        //:   while enqueuing.  (C-6)
+        //:
+        //: 7 Repeatedly, have several threads enqueue jobs lock-free until
+        //:   enqueuing fails, disable the queue while they do so, and verify
+        //:   that the number of jobs enqueued on the queue when 'disableQueue'
+        //:   returns is the number of jobs accepted and executed.  (C-7)
+        //
+        // Testing:
+        //   int setLockFreeEnqueue(int id, bool lockFree);
+        //   bool isLockFreeEnqueue(int id) const;
+        //   int numProcessed(int, Int64 *, Int64 *, TI * = 0, TI * = 0) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING LOCK-FREE ENQUEUE AND STATISTICS\n"
+                          << "========================================\n";
+
+        using namespace MULTIQUEUETHREADPOOL_CASE_34;
+
+        typedef bsls::Types::Int64 Int64;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        if (verbose) cout << "\nTesting 'isLockFreeEnqueue'." << endl;
+        {
+            Obj mX(bslmt::ThreadAttributes(), 1, 1, 30, &ta);
+            const Obj& X = mX;
+
+            mX.start();
+
+            ASSERT(false == X.isLockFreeEnqueue(0));
+            ASSERT(0     != mX.setLockFreeEnqueue(0, true));
+
+            int queueId = mX.createQueue();
+
+            ASSERT(false == X.isLockFreeEnqueue(queueId));
+            ASSERT(0     == mX.setLockFreeEnqueue(queueId, true));
+            ASSERT(true  == X.isLockFreeEnqueue(queueId));
+            ASSERT(false == X.isLockFreeEnqueue(queueId + 1));
+            ASSERT(0     == mX.setLockFreeEnqueue(queueId, false));
+            ASSERT(false == X.isLockFreeEnqueue(queueId));
+
+            Int64 numExecuted = -1;
+            Int64 numEnqueued = -1;
+
+            ASSERT(0 != X.numProcessed(queueId + 1,
+                                       &numExecuted,
+                                       &numEnqueued));
+            ASSERT(0 == X.numProcessed(queueId, &numExecuted, &numEnqueued));
+            ASSERT(0 == numExecuted);
+            ASSERT(0 == numEnqueued);
+        }
+
+        if (verbose) cout << "\nTesting concurrent producers." << endl;
+        {
+            const int k_NUM_PRODUCERS = 4;
+            const int k_NUM_JOBS      = 5000;
+
+            for (int batchSize = 1; batchSize <= 64; batchSize *= 4) {
+                if (veryVerbose) { T_ P(batchSize) }
+
+                Obj mX(bslmt::ThreadAttributes(), 2, 2, 30, &ta);
+                const Obj& X = mX;
+
+                mX.start();
+
+                int queueId = mX.createQueue();
+                ASSERT(0 == mX.setLockFreeEnqueue(queueId, true));
+                ASSERT(0 == mX.setBatchSize(queueId, batchSize));
+
+                bsl::vector<int>   record(&ta);
+                bslmt::Barrier     barrier(k_NUM_PRODUCERS);
+                bslmt::ThreadGroup producers(&ta);
+
+                for (int i = 0; i < k_NUM_PRODUCERS; ++i) {
+                    producers.addThread(bdlf::BindUtil::bind(&produce,
+                                                             &mX,
+                                                             queueId,
+                                                             &record,
+                                                             i,
+                                                             k_NUM_JOBS,
+                                                             &barrier));
+                }
+                producers.joinAll();
+
+                ASSERT(0 == mX.drainQueue(queueId));
+
+                ASSERTV(record.size(),
+                        k_NUM_PRODUCERS * k_NUM_JOBS == record.size());
+
+                bsl::vector<int> next(k_NUM_PRODUCERS, 0, &ta);
+                for (bsl::size_t i = 0; i < record.size(); ++i) {
+                    const int producer = record[i] / k_NUM_JOBS;
+                    const int sequence = record[i] % k_NUM_JOBS;
+
+                    ASSERTV(batchSize, i, sequence == next[producer]);
+                    next[producer] = sequence + 1;
+                }
+
+                Int64 numExecuted;
+                Int64 numEnqueued;
+
+                ASSERT(0 == X.numProcessed(queueId,
+                                           &numExecuted,
+                                           &numEnqueued));
+                ASSERT(k_NUM_PRODUCERS * k_NUM_JOBS == numExecuted);
+                ASSERT(k_NUM_PRODUCERS * k_NUM_JOBS == numEnqueued);
+                ASSERT(0 == X.numElements(queueId));
+            }
+        }
+
+        if (verbose) cout << "\nTesting switching enqueuing modes." << endl;
+        {
+            // Reordering needs a job to remain on the lock-free list while
+            // its producer enqueues the next job under the lock, which is
+            // rare, so the test is repeated.
+
+            const int k_NUM_PRODUCERS = 8;
+            const int k_NUM_JOBS      = 2000;
+            const int k_NUM_ROUNDS    = 10;
+
+            for (int round = 0; round < k_NUM_ROUNDS; ++round) {
+                Obj mX(bslmt::ThreadAttributes(), 2, 2, 30, &ta);
+
+                mX.start();
+
+                int queueId = mX.createQueue();
+                ASSERT(0 == mX.setBatchSize(queueId, 16));
+
+                bsl::vector<int>   record(&ta);
+                bslmt::Barrier     barrier(k_NUM_PRODUCERS);
+                bslmt::ThreadGroup producers(&ta);
+
+                for (int i = 0; i < k_NUM_PRODUCERS; ++i) {
+                    producers.addThread(bdlf::BindUtil::bind(
+                                                            &produceSwitching,
+                                                            &mX,
+                                                            queueId,
+                                                            &record,
+                                                            i,
+                                                            k_NUM_JOBS,
+                                                            &barrier));
+                }
+                producers.joinAll();
+
+                ASSERT(0 == mX.drainQueue(queueId));
+
+                ASSERTV(record.size(),
+                        k_NUM_PRODUCERS * k_NUM_JOBS == record.size());
+
+                bsl::vector<int> next(k_NUM_PRODUCERS, 0, &ta);
+                for (bsl::size_t i = 0; i < record.size(); ++i) {
+                    const int producer = record[i] / k_NUM_JOBS;
+                    const int sequence = record[i] % k_NUM_JOBS;
+
+                    ASSERTV(round, i, sequence, next[producer],
+                            sequence == next[producer]);
+                    if (sequence != next[producer]) {
+                        break;
+                    }
+                    next[producer] = sequence + 1;
+                }
+            }
+        }
+
+        if (verbose) cout << "\nTesting disabling while enqueuing." << endl;
+        {
+            const int k_NUM_PRODUCERS  = 4;
+            const int k_NUM_ITERATIONS = 20;
+
+            for (int iteration = 0; iteration < k_NUM_ITERATIONS;
+                                                               ++iteration) {
+                Obj mX(bslmt::ThreadAttributes(), 1, 1, 30, &ta);
+                const Obj& X = mX;
+
+                mX.start();
+
+                int queueId = mX.createQueue();
+                ASSERT(0 == mX.setLockFreeEnqueue(queueId, true));
+
+                bsls::AtomicInt    numAccepted(0);
+                bslmt::Barrier     barrier(k_NUM_PRODUCERS + 1);
+                bslmt::ThreadGroup producers(&ta);
+
+                for (int i = 0; i < k_NUM_PRODUCERS; ++i) {
+                    producers.addThread(bdlf::BindUtil::bind(
+                                                        &produceUntilDisabled,
+                                                        &mX,
+                                                        queueId,
+                                                        &numAccepted,
+                                                        &barrier));
+                }
+                barrier.wait();
+                bslmt::ThreadUtil::microSleep(100 * (iteration % 4));
+
+                ASSERT(0 == mX.disableQueue(queueId));
+
+                Int64 numExecuted;
+                Int64 numEnqueuedWhenDisabled;
+
+                ASSERT(0 == X.numProcessed(queueId,
+                                           &numExecuted,
+                                           &numEnqueuedWhenDisabled));
+
+                producers.joinAll();
+                ASSERT(0 == mX.drainQueue(queueId));
+
+                Int64 numEnqueued;
+
+                ASSERT(0 == X.numProcessed(queueId,
+                                           &numExecuted,
+                                           &numEnqueued));
+                ASSERTV(iteration, numEnqueuedWhenDisabled, numEnqueued,
+                        numEnqueuedWhenDisabled == numEnqueued);
+                ASSERTV(iteration, numAccepted, numEnqueued,
+                        numAccepted == numEnqueued);
+                ASSERTV(iteration, numExecuted, numEnqueued,
+                        numExecuted == numEnqueued);
+            }
+        }
+
+        if (verbose) cout << "\nTesting paused queue." << endl;
+        {
+            Obj mX(bslmt::ThreadAttributes(), 1, 1, 30, &ta);
+            const Obj& X = mX;
+
+            mX.start();
+
+            int queueId = mX.createQueue();
+            ASSERT(0 == mX.setLockFreeEnqueue(queueId, true));
+            ASSERT(0 == mX.pauseQueue(queueId));
+
+            bsl::vector<int> record(&ta);
+
+            for (int i = 1; i <= 3; ++i) {
+                ASSERT(0 == mX.enqueueJob(queueId,
+                                          bdlf::BindUtil::bind(&recordJob,
+                                                               &record,
+                                                               i)));
+            }
+            ASSERT(3 == X.numElements(queueId));
+
+            ASSERT(0 == mX.addJobAtFront(queueId,
+                                         bdlf::BindUtil::bind(&recordJob,
+                                                              &record,
+                                                              0)));
+            ASSERT(4 == X.numElements(queueId));
+
+            bslmt::ThreadUtil::microSleep(10 * 1000);
+            ASSERT(record.empty());
+
+            ASSERT(0 == mX.resumeQueue(queueId));
+            ASSERT(0 == mX.drainQueue(queueId));
+
+            ASSERTV(record.size(), 4 == record.size());
+            for (bsl::size_t i = 0; i < record.size(); ++i) {
+                ASSERTV(i, record[i], static_cast<int>(i) == record[i]);
+            }
+
+            Int64              numExecuted;
+            Int64              numEnqueued;
+            bsls::TimeInterval executionTime;
+            bsls::TimeInterval waitTime;
+
+            // Each of the 4 jobs waited at least for the 10 milliseconds the
+            // queue was paused.
+
+            ASSERT(0 == X.numProcessed(queueId,
+                                       &numExecuted,
+                                       &numEnqueued,
+                                       &executionTime,
+                                       &waitTime));
+            ASSERT(4 == numExecuted);
+            ASSERTV(waitTime,
+                    bsls::TimeInterval(0, 40 * 1000 * 1000) <= waitTime);
+
+            for (int i = 0; i < 5; ++i) {
+                ASSERT(0 == mX.enqueueJob(queueId, &sleepJob));
+            }
+            ASSERT(0 == mX.drainQueue(queueId));
+
+            ASSERT(0 == X.numProcessed(queueId,
+                                       &numExecuted,
+                                       &numEnqueued,
+                                       &executionTime));
+            ASSERT(9 == numExecuted);
+            ASSERT(9 == numEnqueued);
+            ASSERTV(executionTime,
+                    bsls::TimeInterval(0, 5 * 1000 * 1000) <= executionTime);
+        }
+
+        if (verbose) cout << "\nTesting deletion." << endl;
+        {
+            Obj mX(bslmt::ThreadAttributes(), 1, 1, 30, &ta);
+            const Obj& X = mX;
+
+            mX.start();
+
+            int queueId = mX.createQueue();
+            ASSERT(0 == mX.setLockFreeEnqueue(queueId, true));
+
+            bslmt::Barrier barrier(2);
+
+            ASSERT(0 == mX.enqueueJob(queueId,
+                                      bdlf::BindUtil::bind(&waitWait,
+                                                           &barrier)));
+            for (int i = 0; i < 10; ++i) {
+                ASSERT(0 == mX.enqueueJob(queueId, noop));
+            }
+
+            barrier.wait();
+            ASSERT(0 == mX.deleteQueue(queueId, noop));  // must not wait
+            barrier.wait();
+
+            ASSERT(0 != mX.enqueueJob(queueId, noop));
+            mX.drain();
+
+            int doneJobs;
+            int enqueuedJobs;
+            int deletedJobs;
+
+            X.numProcessed(&doneJobs, &enqueuedJobs, &deletedJobs);
+
+            ASSERT(11 == enqueuedJobs);
+            ASSERTV(doneJobs, deletedJobs, 11 == doneJobs + deletedJobs);
+            ASSERTV(deletedJobs, 10 == deletedJobs);
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      }  break;
       case 33: {
         // --------------------------------------------------------------------
         // TESTING BATCH SIZE
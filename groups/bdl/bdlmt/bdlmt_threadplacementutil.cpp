@@ -0,0 +1,313 @@
+// bdlmt_threadplacementutil.cpp                                      -*-C++-*-
+#include <bdlmt_threadplacementutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlmt_threadplacementutil_cpp,"$Id$ $CSID$")
+
+#include <bslma_default.h>
+
+#include <bslmt_once.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_map.h>
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+# include <dirent.h>
+# include <sched.h>
+#endif
+
+///Implementation Notes
+///--------------------
+// The topology is computed once, on first use, into an object allocated from
+// the global allocator, and is never modified afterward, so it can be read
+// without synchronization.  Nodes that have no CPU on which the task may run
+// are omitted, so that every thread placed on a node can actually run there.
+
+namespace BloombergLP {
+namespace bdlmt {
+namespace {
+namespace u {
+
+typedef ThreadPlacementUtil::Topology Topology;
+
+void loadDefaultTopology(Topology *result)
+    // Load into the specified 'result' a topology having a single node that
+    // comprises the CPUs '0' to
+    // 'bslmt::ThreadUtil::hardwareConcurrency() - 1'.
+{
+    int numCpus = static_cast<int>(bslmt::ThreadUtil::hardwareConcurrency());
+    if (numCpus < 1) {
+        numCpus = 1;
+    }
+
+    result->clear();
+    result->resize(1);
+    for (int i = 0; i < numCpus; ++i) {
+        result->front().push_back(i);
+    }
+}
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+void loadLinuxTopology(Topology *result)
+    // Load into the specified 'result' the NUMA nodes described under
+    // '/sys/devices/system/node', restricted to the CPUs on which the task
+    // may run, and omitting the nodes having no such CPU.  'result' is empty
+    // if the topology cannot be read.
+{
+    result->clear();
+
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    const bool hasMask = 0 == sched_getaffinity(0, sizeof allowed, &allowed);
+
+    DIR *dir = opendir("/sys/devices/system/node");
+    if (!dir) {
+        return;                                                       // RETURN
+    }
+
+    bsl::map<int, bsl::vector<int> > nodes(result->get_allocator());
+
+    while (struct dirent *entry = readdir(dir)) {
+        int  node;
+        char trailing;
+        if (1 != bsl::sscanf(entry->d_name, "node%d%c", &node, &trailing)) {
+            continue;                                               // CONTINUE
+        }
+
+        char path[128];
+        bsl::snprintf(path,
+                      sizeof path,
+                      "/sys/devices/system/node/node%d/cpulist",
+                      node);
+
+        bsl::FILE *file = bsl::fopen(path, "r");
+        if (!file) {
+            continue;                                               // CONTINUE
+        }
+
+        char        buffer[4096];
+        const char *line = bsl::fgets(buffer, sizeof buffer, file);
+        bsl::fclose(file);
+
+        if (!line) {
+            continue;                                               // CONTINUE
+        }
+
+        bsl::size_t length = bsl::strlen(buffer);
+        while (length && ('\n' == buffer[length - 1] ||
+                          ' '  == buffer[length - 1])) {
+            --length;
+        }
+
+        bsl::vector<int> cpus(result->get_allocator());
+        if (0 != ThreadPlacementUtil::parseCpuList(
+                                    &cpus,
+                                    bsl::string_view(buffer, length))) {
+            continue;                                               // CONTINUE
+        }
+
+        bsl::vector<int>& nodeCpus = nodes[node];
+        for (bsl::size_t i = 0; i < cpus.size(); ++i) {
+            const int cpu = cpus[i];
+            if (!hasMask || (cpu < CPU_SETSIZE && CPU_ISSET(cpu, &allowed))) {
+                nodeCpus.push_back(cpu);
+            }
+        }
+    }
+    closedir(dir);
+
+    for (bsl::map<int, bsl::vector<int> >::iterator it = nodes.begin();
+         it != nodes.end();
+         ++it) {
+        if (!it->second.empty()) {
+            bsl::sort(it->second.begin(), it->second.end());
+            it->second.erase(bsl::unique(it->second.begin(),
+                                         it->second.end()),
+                             it->second.end());
+            result->push_back(it->second);
+        }
+    }
+}
+#endif
+
+}  // close namespace u
+}  // close unnamed namespace
+
+                        // --------------------------
+                        // struct ThreadPlacementUtil
+                        // --------------------------
+
+// CLASS METHODS
+void ThreadPlacementUtil::assignCpus(bsl::vector<int> *result,
+                                     Policy            policy,
+                                     int               workerIndex)
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(0 <= workerIndex);
+
+    assignCpus(result, policy, workerIndex, systemTopology());
+}
+
+void ThreadPlacementUtil::assignCpus(bsl::vector<int> *result,
+                                     Policy            policy,
+                                     int               workerIndex,
+                                     const Topology&   topology)
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(0 <= workerIndex);
+
+    result->clear();
+
+    if (e_NONE == policy || topology.empty()) {
+        return;                                                       // RETURN
+    }
+
+    const int numNodes = static_cast<int>(topology.size());
+
+    switch (policy) {
+      case e_COMPACT: {
+        int numCpus = 0;
+        for (int i = 0; i < numNodes; ++i) {
+            numCpus += static_cast<int>(topology[i].size());
+        }
+
+        int index = workerIndex % numCpus;
+        for (int i = 0; i < numNodes; ++i) {
+            const int nodeSize = static_cast<int>(topology[i].size());
+            if (index < nodeSize) {
+                result->push_back(topology[i][index]);
+                break;
+            }
+            index -= nodeSize;
+        }
+      } break;
+      case e_SCATTER: {
+        const bsl::vector<int>& node     = topology[workerIndex % numNodes];
+        const int               nodeSize = static_cast<int>(node.size());
+
+        result->push_back(node[(workerIndex / numNodes) % nodeSize]);
+      } break;
+      case e_NUMA_NODE: {
+        *result = topology[workerIndex % numNodes];
+      } break;
+      default: {
+        BSLS_ASSERT(!"Unknown placement policy");
+      }
+    }
+}
+
+int ThreadPlacementUtil::parseCpuList(bsl::vector<int>        *result,
+                                      const bsl::string_view&  cpuList)
+{
+    BSLS_ASSERT(result);
+
+    bsl::vector<int> cpus(result->get_allocator());
+
+    const char *next = cpuList.data();
+    const char *end  = next + cpuList.size();
+
+    while (next < end) {
+        int first = 0;
+        if (*next < '0' || '9' < *next) {
+            return -1;                                                // RETURN
+        }
+        while (next < end && '0' <= *next && *next <= '9') {
+            first = first * 10 + (*next - '0');
+            if (first > 1 << 20) {
+                return -1;                                            // RETURN
+            }
+            ++next;
+        }
+
+        int last = first;
+        if (next < end && '-' == *next) {
+            ++next;
+            if (next == end || *next < '0' || '9' < *next) {
+                return -1;                                            // RETURN
+            }
+            last = 0;
+            while (next < end && '0' <= *next && *next <= '9') {
+                last = last * 10 + (*next - '0');
+                if (last > 1 << 20) {
+                    return -1;                                        // RETURN
+                }
+                ++next;
+            }
+            if (last < first) {
+                return -1;                                            // RETURN
+            }
+        }
+
+        for (int cpu = first; cpu <= last; ++cpu) {
+            cpus.push_back(cpu);
+        }
+
+        if (next < end) {
+            if (',' != *next || next + 1 == end) {
+                return -1;                                            // RETURN
+            }
+            ++next;
+        }
+    }
+
+    result->swap(cpus);
+    return 0;
+}
+
+void ThreadPlacementUtil::setCpuAffinity(bslmt::ThreadAttributes *attributes,
+                                         Policy                   policy,
+                                         int                      workerIndex)
+{
+    BSLS_ASSERT(attributes);
+    BSLS_ASSERT(0 <= workerIndex);
+
+    bsl::vector<int> cpus(attributes->allocator());
+    assignCpus(&cpus, policy, workerIndex);
+    attributes->setCpuAffinity(cpus);
+}
+
+const ThreadPlacementUtil::Topology& ThreadPlacementUtil::systemTopology()
+{
+    static Topology *topology_p = 0;
+
+    BSLMT_ONCE_DO {
+        static Topology topology(bslma::Default::globalAllocator());
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+        u::loadLinuxTopology(&topology);
+#endif
+        if (topology.empty()) {
+            u::loadDefaultTopology(&topology);
+        }
+
+        topology_p = &topology;
+    }
+
+    return *topology_p;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,193 @@
+// bdlmt_threadplacementutil.h                                        -*-C++-*-
+#ifndef INCLUDED_BDLMT_THREADPLACEMENTUTIL
+#define INCLUDED_BDLMT_THREADPLACEMENTUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide utilities to place pool threads on CPUs and NUMA nodes.
+//
+//@CLASSES:
+//  bdlmt::ThreadPlacementUtil: namespace for thread placement utilities
+//
+//@SEE_ALSO: bslmt_threadattributes, bdlmt_fixedthreadpool, bdlmt_threadpool
+//
+//@DESCRIPTION: This component provides a 'struct',
+// 'bdlmt::ThreadPlacementUtil', that is a namespace for utility functions that
+// compute, for the worker threads of a thread pool, the set of CPUs on which
+// each thread should run, according to a placement policy and the CPU
+// topology of the host.  The computed set is expressed as the 'cpuAffinity'
+// attribute of a 'bslmt::ThreadAttributes' object, so it can be applied to any
+// thread created by 'bslmt::ThreadUtil'.  'bdlmt::FixedThreadPool' and
+// 'bdlmt::ThreadPool' use this component to place their threads (see their
+// 'setThreadPlacement' methods).
+//
+///Topology
+///--------
+// The topology of the host is described as a sequence of NUMA nodes, each of
+// which is a sorted sequence of CPU indices (see 'Topology').  On Linux, the
+// topology is read (once) from '/sys/devices/system/node', and only the CPUs
+// on which the task is allowed to run (see 'sched_getaffinity') are retained.
+// On other platforms, or if the topology cannot be read, the host is assumed
+// to have a single node comprising CPUs '0' to
+// 'bslmt::ThreadUtil::hardwareConcurrency() - 1'.
+//
+///Placement Policies
+///------------------
+// The following policies are supported for the worker thread having the
+// (zero-based) index 'i':
+//
+//: 'e_NONE':
+//:   No placement; the thread may run on any CPU.
+//:
+//: 'e_COMPACT':
+//:   The thread is bound to the CPU at index 'i' (modulo the number of CPUs)
+//:   of the sequence of all CPUs ordered by node.  Consecutive workers share a
+//:   node, and its caches, for as long as possible.  This is appropriate for
+//:   a small pool whose jobs share data.
+//:
+//: 'e_SCATTER':
+//:   The thread is bound to a single CPU of node 'i % numNodes', so that
+//:   consecutive workers are spread over the nodes, maximizing the aggregate
+//:   memory bandwidth and cache available to the pool.  This is appropriate
+//:   for a pool whose jobs are independent.
+//:
+//: 'e_NUMA_NODE':
+//:   The thread is confined to (all of the CPUs of) node 'i % numNodes',
+//:   leaving the operating system free to balance the load within the node.
+//:   Combined with node-local memory allocation (see
+//:   'bdlma_numalocalallocator'), this partitions a pool into per-node
+//:   sub-pools whose threads access only local memory.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Confining Threads to NUMA Nodes
+/// - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we want to create four threads, each of which works on data
+// allocated on a particular NUMA node.  First, we obtain the thread
+// attributes used for each thread:
+//..
+//  bslmt::ThreadAttributes attributes;
+//  bslmt::ThreadUtil::Handle handles[4];
+//
+//  for (int i = 0; i < 4; ++i) {
+//      bdlmt::ThreadPlacementUtil::setCpuAffinity(
+//                                 &attributes,
+//                                 bdlmt::ThreadPlacementUtil::e_NUMA_NODE,
+//                                 i);
+//..
+// Then, we verify that each thread is confined to a single node:
+//..
+//      const bdlmt::ThreadPlacementUtil::Topology& topology =
+//                                bdlmt::ThreadPlacementUtil::systemTopology();
+//      assert(topology[i % topology.size()] == attributes.cpuAffinity());
+//..
+// Finally, we create the thread and, when done, join it:
+//..
+//      int rc = bslmt::ThreadUtil::create(&handles[i],
+//                                         attributes,
+//                                         &myThreadFunction,
+//                                         0);
+//      assert(0 == rc);
+//  }
+//
+//  for (int i = 0; i < 4; ++i) {
+//      bslmt::ThreadUtil::join(handles[i]);
+//  }
+//..
+
+#include <bdlscm_version.h>
+
+#include <bslmt_threadattributes.h>
+
+#include <bsl_string_view.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdlmt {
+
+                        // ==========================
+                        // struct ThreadPlacementUtil
+                        // ==========================
+
+struct ThreadPlacementUtil {
+    // This 'struct' provides a namespace for utility functions that compute
+    // the CPUs on which the worker threads of a thread pool should run.
+
+    // TYPES
+    typedef bsl::vector<bsl::vector<int> > Topology;
+        // 'Topology' is an alias for a sequence of NUMA nodes, each of which
+        // is a sorted, non-empty sequence of CPU indices.
+
+    enum Policy {
+        // Enumerate the thread placement policies (see {Placement Policies}).
+
+        e_NONE,       // no placement
+        e_COMPACT,    // one CPU per thread, filling nodes one after another
+        e_SCATTER,    // one CPU per thread, spreading threads over nodes
+        e_NUMA_NODE   // all the CPUs of one node per thread
+    };
+
+    // CLASS METHODS
+    static void assignCpus(bsl::vector<int> *result,
+                           Policy            policy,
+                           int               workerIndex);
+    static void assignCpus(bsl::vector<int> *result,
+                           Policy            policy,
+                           int               workerIndex,
+                           const Topology&   topology);
+        // Load into the specified 'result' the sorted indices of the CPUs on
+        // which the worker thread having the specified 'workerIndex' should
+        // run according to the specified 'policy' and, optionally, the
+        // specified 'topology'.  If 'topology' is not specified, the topology
+        // of the host (see 'systemTopology') is used.  'result' is empty if
+        // 'e_NONE == policy' or 'topology' is empty.  The behavior is
+        // undefined unless '0 <= workerIndex'.
+
+    static int parseCpuList(bsl::vector<int>        *result,
+                            const bsl::string_view&  cpuList);
+        // Load into the specified 'result' the CPU indices in the specified
+        // 'cpuList', a comma-separated list of CPU indices and inclusive
+        // ranges of CPU indices (e.g., "0-3,8,10-11"), in the format used by
+        // the Linux kernel.  Return 0 on success, and a non-zero value (with
+        // no effect on 'result') if 'cpuList' is not well-formed.  Note that
+        // the resulting indices appear in the order of 'cpuList'.
+
+    static void setCpuAffinity(bslmt::ThreadAttributes *attributes,
+                               Policy                   policy,
+                               int                      workerIndex);
+        // Set the 'cpuAffinity' attribute of the specified 'attributes' to the
+        // CPUs on which the worker thread having the specified 'workerIndex'
+        // should run according to the specified 'policy' and the topology of
+        // the host.  The behavior is undefined unless '0 <= workerIndex'.
+
+    static const Topology& systemTopology();
+        // Return a reference providing non-modifiable access to the topology
+        // of the host, restricted to the CPUs on which the task is allowed to
+        // run.  The topology is computed by the first call to this method and
+        // is not updated afterward.  Note that the returned topology has at
+        // least one node.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,576 @@
+// bdlmt_threadplacementutil.t.cpp                                    -*-C++-*-
+#include <bdlmt_threadplacementutil.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_threadattributes.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_platform.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_vector.h>
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+# include <pthread.h>
+# include <sched.h>
+#endif
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+using bsl::flush;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test is a utility computing the CPUs assigned to the
+// worker threads of a pool.  The placement computation is tested against
+// synthetic topologies, so that multi-node hosts are covered on any machine;
+// the topology of the host is only checked for consistency, and, on Linux,
+// for being honored by threads created with the computed attributes.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] void assignCpus(vector<int> *, Policy, int, const Topology&);
+// [ 3] void assignCpus(vector<int> *, Policy, int);
+// [ 1] int parseCpuList(vector<int> *, const string_view&);
+// [ 3] void setCpuAffinity(ThreadAttributes *, Policy, int);
+// [ 3] const Topology& systemTopology();
+// ----------------------------------------------------------------------------
+// [ 3] CONCERN: THREADS RUN ONLY ON THEIR ASSIGNED CPUS
+// [ 4] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                GLOBAL TYPEDEFS/CONSTANTS/VARIABLES FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlmt::ThreadPlacementUtil Util;
+typedef Util::Topology             Topology;
+
+int                 test;
+bool             verbose;
+bool         veryVerbose;
+bool     veryVeryVerbose;
+bool veryVeryVeryVerbose;
+
+namespace {
+namespace u {
+
+void loadTopology(Topology *result, const char *spec)
+    // Load into the specified 'result' the topology described by the
+    // specified 'spec', a sequence of CPU lists (see 'parseCpuList') separated
+    // by ';', one per node.
+{
+    result->clear();
+
+    const char *begin = spec;
+    while (true) {
+        const char *end = bsl::strchr(begin, ';');
+        if (!end) {
+            end = begin + bsl::strlen(begin);
+        }
+
+        bsl::vector<int> cpus;
+        int rc = Util::parseCpuList(&cpus,
+                                    bsl::string_view(begin, end - begin));
+        ASSERTV(spec, 0 == rc);
+        result->push_back(cpus);
+
+        if ('\0' == *end) {
+            break;
+        }
+        begin = end + 1;
+    }
+}
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+struct AffinityRecorder {
+    // This 'struct' records the CPUs on which the thread that invokes it may
+    // run.
+
+    // DATA
+    bsl::vector<int> *d_cpus_p;  // CPUs on which the thread may run (held)
+    int              *d_rc_p;    // status of 'pthread_getaffinity_np' (held)
+
+    // MANIPULATORS
+    void operator()() const
+        // Record the affinity of the calling thread.
+    {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        *d_rc_p = pthread_getaffinity_np(pthread_self(), sizeof set, &set);
+        for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+            if (CPU_ISSET(cpu, &set)) {
+                d_cpus_p->push_back(cpu);
+            }
+        }
+    }
+};
+#endif
+
+}  // close namespace u
+}  // close unnamed namespace
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+extern "C" void *myThreadFunction(void *)
+    // Do nothing.
+{
+    return 0;
+}
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    test                = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    verbose             = argc > 2;
+    veryVerbose         = argc > 3;
+    veryVeryVerbose     = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Confining Threads to NUMA Nodes
+/// - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we want to create four threads, each of which works on data
+// allocated on a particular NUMA node.  First, we obtain the thread
+// attributes used for each thread:
+//..
+    bslmt::ThreadAttributes attributes;
+    bslmt::ThreadUtil::Handle handles[4];
+
+    for (int i = 0; i < 4; ++i) {
+        bdlmt::ThreadPlacementUtil::setCpuAffinity(
+                                   &attributes,
+                                   bdlmt::ThreadPlacementUtil::e_NUMA_NODE,
+                                   i);
+//..
+// Then, we verify that each thread is confined to a single node:
+//..
+        const bdlmt::ThreadPlacementUtil::Topology& topology =
+                                  bdlmt::ThreadPlacementUtil::systemTopology();
+        ASSERT(topology[i % topology.size()] == attributes.cpuAffinity());
+//..
+// Finally, we create the thread and, when done, join it:
+//..
+        int rc = bslmt::ThreadUtil::create(&handles[i],
+                                           attributes,
+                                           &myThreadFunction,
+                                           0);
+        ASSERT(0 == rc);
+    }
+
+    for (int i = 0; i < 4; ++i) {
+        bslmt::ThreadUtil::join(handles[i]);
+    }
+//..
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING SYSTEM TOPOLOGY AND 'setCpuAffinity'
+        //
+        // Concerns:
+        //: 1 'systemTopology' has at least one node, every node is non-empty
+        //:   and sorted, and no CPU appears in two nodes.
+        //:
+        //: 2 'systemTopology' returns the same object on every call.
+        //:
+        //: 3 'setCpuAffinity' sets the 'cpuAffinity' attribute to the result
+        //:   of 'assignCpus' for the system topology, and allocates using
+        //:   the allocator of the attributes object.
+        //:
+        //: 4 On Linux, a thread created with the attributes runs only on the
+        //:   assigned CPUs.
+        //
+        // Plan:
+        //: 1 Check the invariants of the system topology.  (C-1..2)
+        //:
+        //: 2 For each policy and several worker indices, compare the results
+        //:   of 'setCpuAffinity' and 'assignCpus', with a test allocator
+        //:   supplied to the attributes and a default allocator guard
+        //:   installed.  (C-3)
+        //:
+        //: 3 On Linux, create threads with the attributes and have them
+        //:   record their affinity mask.  (C-4)
+        //
+        // Testing:
+        //   void assignCpus(vector<int> *, Policy, int);
+        //   void setCpuAffinity(ThreadAttributes *, Policy, int);
+        //   const Topology& systemTopology();
+        //   CONCERN: THREADS RUN ONLY ON THEIR ASSIGNED CPUS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING SYSTEM TOPOLOGY AND 'setCpuAffinity'"
+                          << endl
+                          << "============================================"
+                          << endl;
+
+        const Topology& TOPOLOGY = Util::systemTopology();
+
+        ASSERT(&TOPOLOGY == &Util::systemTopology());
+        ASSERT(!TOPOLOGY.empty());
+
+        bsl::vector<int> allCpus;
+        for (bsl::size_t i = 0; i < TOPOLOGY.size(); ++i) {
+            if (veryVerbose) {
+                P_(i) P(TOPOLOGY[i].size());
+            }
+            ASSERTV(i, !TOPOLOGY[i].empty());
+            ASSERTV(i, bsl::is_sorted(TOPOLOGY[i].begin(),
+                                      TOPOLOGY[i].end()));
+            allCpus.insert(allCpus.end(),
+                           TOPOLOGY[i].begin(),
+                           TOPOLOGY[i].end());
+        }
+        bsl::sort(allCpus.begin(), allCpus.end());
+        ASSERT(allCpus.end() == bsl::adjacent_find(allCpus.begin(),
+                                                   allCpus.end()));
+
+        const Util::Policy POLICIES[] = { Util::e_NONE,
+                                          Util::e_COMPACT,
+                                          Util::e_SCATTER,
+                                          Util::e_NUMA_NODE };
+        const int NUM_POLICIES = sizeof POLICIES / sizeof *POLICIES;
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator         ta("test",    veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard guard(&da);
+
+        for (int p = 0; p < NUM_POLICIES; ++p) {
+            const Util::Policy POLICY = POLICIES[p];
+
+            for (int w = 0; w < 8; ++w) {
+                bsl::vector<int> expected(&ta);
+                Util::assignCpus(&expected, POLICY, w, TOPOLOGY);
+
+                bsl::vector<int> cpus(&ta);
+                Util::assignCpus(&cpus, POLICY, w);
+                ASSERTV(p, w, expected == cpus);
+
+                bslmt::ThreadAttributes mX(&ta);
+                Util::setCpuAffinity(&mX, POLICY, w);
+                ASSERTV(p, w, expected == mX.cpuAffinity());
+
+                ASSERTV(p, w, 0 == da.numBlocksTotal());
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+                bsl::vector<int>          actual(&ta);
+                int                       status = -1;
+                u::AffinityRecorder       recorder = { &actual, &status };
+                bslmt::ThreadUtil::Handle handle;
+
+                int rc = bslmt::ThreadUtil::createWithAllocator(&handle,
+                                                                mX,
+                                                                recorder,
+                                                                &ta);
+                ASSERTV(p, w, rc, 0 == rc);
+                if (0 == rc) {
+                    bslmt::ThreadUtil::join(handle);
+
+                    ASSERTV(p, w, 0 == status);
+                    if (Util::e_NONE != POLICY) {
+                        ASSERTV(p, w, expected == actual);
+                    }
+                }
+#endif
+            }
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'assignCpus' WITH A SPECIFIED TOPOLOGY
+        //
+        // Concerns:
+        //: 1 'e_NONE' and an empty topology yield an empty result.
+        //:
+        //: 2 'e_COMPACT' assigns consecutive workers to consecutive CPUs,
+        //:   filling the nodes in order, and wraps around.
+        //:
+        //: 3 'e_SCATTER' assigns consecutive workers to consecutive nodes,
+        //:   using the next CPU of a node on each round, and wraps around
+        //:   nodes of different sizes.
+        //:
+        //: 4 'e_NUMA_NODE' assigns all the CPUs of consecutive nodes.
+        //:
+        //: 5 Any previous value of the result is discarded.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, compare the result for several
+        //:   topologies, policies, and worker indices with the expected CPU
+        //:   list.  (C-1..5)
+        //
+        // Testing:
+        //   void assignCpus(vector<int> *, Policy, int, const Topology&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'assignCpus' WITH A SPECIFIED TOPOLOGY"
+                          << endl
+                          << "=============================================="
+                          << endl;
+
+        static const struct {
+            int           d_line;
+            const char   *d_topology;  // nodes separated by ';'
+            Util::Policy  d_policy;
+            int           d_worker;
+            const char   *d_expected;  // CPU list
+        } DATA[] = {
+            //LN  TOPOLOGY        POLICY             WORKER  EXPECTED
+            //--  --------------  -----------------  ------  --------
+            { L_, "0-3",          Util::e_NONE,      0,      ""         },
+            { L_, "0-3;4-7",      Util::e_NONE,      5,      ""         },
+
+            { L_, "0-3",          Util::e_COMPACT,   0,      "0"        },
+            { L_, "0-3",          Util::e_COMPACT,   3,      "3"        },
+            { L_, "0-3",          Util::e_COMPACT,   4,      "0"        },
+            { L_, "0-3;4-7",      Util::e_COMPACT,   1,      "1"        },
+            { L_, "0-3;4-7",      Util::e_COMPACT,   4,      "4"        },
+            { L_, "0-3;4-7",      Util::e_COMPACT,   7,      "7"        },
+            { L_, "0-3;4-7",      Util::e_COMPACT,   9,      "1"        },
+            { L_, "0,2;1,3,5",    Util::e_COMPACT,   2,      "1"        },
+            { L_, "0,2;1,3,5",    Util::e_COMPACT,   4,      "5"        },
+
+            { L_, "0-3",          Util::e_SCATTER,   0,      "0"        },
+            { L_, "0-3",          Util::e_SCATTER,   2,      "2"        },
+            { L_, "0-3;4-7",      Util::e_SCATTER,   0,      "0"        },
+            { L_, "0-3;4-7",      Util::e_SCATTER,   1,      "4"        },
+            { L_, "0-3;4-7",      Util::e_SCATTER,   2,      "1"        },
+            { L_, "0-3;4-7",      Util::e_SCATTER,   3,      "5"        },
+            { L_, "0-3;4-7",      Util::e_SCATTER,   8,      "0"        },
+            { L_, "0;4-7",        Util::e_SCATTER,   2,      "0"        },
+            { L_, "0;4-7",        Util::e_SCATTER,   3,      "5"        },
+            { L_, "0-1;2-3;4-5",  Util::e_SCATTER,   4,      "3"        },
+
+            { L_, "0-3",          Util::e_NUMA_NODE, 0,      "0-3"      },
+            { L_, "0-3",          Util::e_NUMA_NODE, 7,      "0-3"      },
+            { L_, "0-3;4-7",      Util::e_NUMA_NODE, 1,      "4-7"      },
+            { L_, "0-3;4-7",      Util::e_NUMA_NODE, 2,      "0-3"      },
+            { L_, "0-1;2-3;4-5",  Util::e_NUMA_NODE, 5,      "4-5"      },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int           LINE     = DATA[ti].d_line;
+            const char         *TOPOLOGY = DATA[ti].d_topology;
+            const Util::Policy  POLICY   = DATA[ti].d_policy;
+            const int           WORKER   = DATA[ti].d_worker;
+            const char         *EXPECTED = DATA[ti].d_expected;
+
+            if (veryVerbose) {
+                P_(LINE) P_(TOPOLOGY) P_(POLICY) P_(WORKER) P(EXPECTED);
+            }
+
+            Topology topology;
+            u::loadTopology(&topology, TOPOLOGY);
+
+            bsl::vector<int> expected;
+            ASSERTV(LINE, 0 == Util::parseCpuList(&expected, EXPECTED));
+
+            bsl::vector<int> result(3, 42);
+            Util::assignCpus(&result, POLICY, WORKER, topology);
+            ASSERTV(LINE, expected == result);
+        }
+
+        if (verbose) cout << "\nEmpty topology." << endl;
+        {
+            const Topology   EMPTY;
+            bsl::vector<int> result(1, 42);
+
+            Util::assignCpus(&result, Util::e_COMPACT, 0, EMPTY);
+            ASSERT(result.empty());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // TESTING 'parseCpuList'
+        //
+        // Concerns:
+        //: 1 Single CPUs and inclusive ranges, separated by commas, are
+        //:   loaded in order.
+        //:
+        //: 2 An empty list yields an empty result.
+        //:
+        //: 3 Malformed lists are rejected, and leave the result unchanged.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, parse valid and invalid lists
+        //:   and compare with the expected result.  (C-1..3)
+        //
+        // Testing:
+        //   int parseCpuList(vector<int> *, const string_view&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'parseCpuList'" << endl
+                          << "======================" << endl;
+
+        static const struct {
+            int         d_line;
+            const char *d_input;
+            int         d_rc;
+            int         d_numCpus;
+            int         d_cpus[8];
+        } DATA[] = {
+            //LN  INPUT         RC  NUM  CPUS
+            //--  ------------  --  ---  -------------------------
+            { L_, "",            0,  0,  { 0 }                     },
+            { L_, "0",           0,  1,  { 0 }                     },
+            { L_, "17",          0,  1,  { 17 }                    },
+            { L_, "0-3",         0,  4,  { 0, 1, 2, 3 }            },
+            { L_, "2,0",         0,  2,  { 2, 0 }                  },
+            { L_, "0-1,8,10-12", 0,  6,  { 0, 1, 8, 10, 11, 12 }   },
+            { L_, "5-5",         0,  1,  { 5 }                     },
+
+            { L_, ",",          -1,  0,  { 0 }                     },
+            { L_, "0,",         -1,  0,  { 0 }                     },
+            { L_, ",0",         -1,  0,  { 0 }                     },
+            { L_, "-1",         -1,  0,  { 0 }                     },
+            { L_, "1-",         -1,  0,  { 0 }                     },
+            { L_, "3-1",        -1,  0,  { 0 }                     },
+            { L_, "0 ",         -1,  0,  { 0 }                     },
+            { L_, "a",          -1,  0,  { 0 }                     },
+            { L_, "0-2-4",      -1,  0,  { 0 }                     },
+            { L_, "99999999",   -1,  0,  { 0 }                     },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE     = DATA[ti].d_line;
+            const char *INPUT    = DATA[ti].d_input;
+            const int   RC       = DATA[ti].d_rc;
+            const int   NUM_CPUS = DATA[ti].d_numCpus;
+            const int  *CPUS     = DATA[ti].d_cpus;
+
+            if (veryVerbose) {
+                P_(LINE) P_(INPUT) P(RC);
+            }
+
+            bsl::vector<int> result(1, 42);
+            const int        rc = Util::parseCpuList(&result, INPUT);
+
+            ASSERTV(LINE, rc, RC == rc);
+            if (0 == RC) {
+                ASSERTV(LINE, NUM_CPUS == static_cast<int>(result.size()));
+                ASSERTV(LINE, bsl::equal(result.begin(), result.end(), CPUS));
+            }
+            else {
+                ASSERTV(LINE, 1 == result.size() && 42 == result[0]);
+            }
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
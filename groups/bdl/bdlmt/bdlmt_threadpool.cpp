@@ -194,10 +194,23 @@ int ThreadPool::startNewThread()
     pthread_sigmask(SIG_BLOCK, &d_blockSet, &oldset);
 #endif
 
-    int rc = bslmt::ThreadUtil::create(&handle,
+    int rc;
+    if (ThreadPlacementUtil::e_NONE == d_threadPlacement) {
+        rc = bslmt::ThreadUtil::create(&handle,
                                        d_threadAttributes,
                                        ThreadPoolEntry,
                                        this);
+    }
+    else {
+        bslmt::ThreadAttributes attributes(d_threadAttributes);
+        ThreadPlacementUtil::setCpuAffinity(&attributes,
+                                            d_threadPlacement,
+                                            d_threadCount);
+        rc = bslmt::ThreadUtil::create(&handle,
+                                       attributes,
+                                       ThreadPoolEntry,
+                                       this);
+    }
 
 #if defined(BSLS_PLATFORM_OS_UNIX)
     // Restore the mask
@@ -358,6 +371,7 @@ ThreadPool::ThreadPool(const bslmt::ThreadAttributes&  threadAttributes,
 , d_numActiveThreads(0)
 , d_numWaiting(0)
 , d_enabled(0)
+, d_threadPlacement(ThreadPlacementUtil::e_NONE)
 , d_waitHead(0)
 , d_lastResetTime(bsls::TimeUtil::getTimer()) // now
 {
@@ -481,6 +495,12 @@ int ThreadPool::start()
     return 0;
 }
 
+void ThreadPool::setThreadPlacement(ThreadPlacementUtil::Policy policy)
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    d_threadPlacement = policy;
+}
+
 void ThreadPool::stop()
 {
     bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
@@ -528,6 +548,12 @@ double ThreadPool::percentBusy() const
 
     return percentBusy;
 }
+
+ThreadPlacementUtil::Policy ThreadPool::threadPlacement() const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    return d_threadPlacement;
+}
 }  // close package namespace
 
 }  // close enterprise namespace
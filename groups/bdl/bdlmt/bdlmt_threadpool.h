@@ -67,6 +67,18 @@ BSLS_IDENT("$Id: $")
 // management code, an application can easily create a thread pool, enqueue a
 // series of jobs to be executed, and wait until all the jobs have executed.
 //
+///Thread Placement
+///----------------
+// The 'setThreadPlacement' method specifies a placement policy (see
+// 'bdlmt_threadplacementutil') that binds each processing thread subsequently
+// started by the pool to particular CPUs (or to a NUMA node), preserving the
+// caches and the memory locality of the threads on hosts having several
+// sockets.  A new thread is placed according to its index, the number of
+// processing threads running when it is started.  Since threads in excess of
+// 'minThreads()' are started and stopped according to demand, the placement
+// is best-effort: several threads may occasionally share the placement of one
+// index.  Use 'minThreads() == maxThreads()' for a stable placement.
+//
 ///Thread Safety
 ///-------------
 // The 'bdlmt::ThreadPool' class is both *fully thread-safe* (i.e., all
@@ -344,6 +356,8 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlscm_version.h>
 
+#include <bdlmt_threadplacementutil.h>
+
 #include <bslma_usesbslmaallocator.h>
 
 #include <bslmf_nestedtraitdeclaration.h>
@@ -456,6 +470,11 @@ class ThreadPool {
                                            // queue; queuing is disabled when
                                            // 0, enabled otherwise
 
+    ThreadPlacementUtil::Policy
+                         d_threadPlacement;
+                                           // placement policy applied to the
+                                           // processing threads
+
     ThreadPoolWaitNode* volatile
                          d_waitHead;       // pointer to the 'WaitNode' control
                                            // structure of the first thread
@@ -567,6 +586,13 @@ class ThreadPool {
         // concurrently (e.g., the number of threads could be larger than the
         // number of processors).
 
+    void setThreadPlacement(ThreadPlacementUtil::Policy policy);
+        // Set the thread placement policy of this thread pool to the
+        // specified 'policy'.  The processing threads subsequently started by
+        // this thread pool are bound to the CPUs determined by 'policy' (see
+        // {Thread Placement}).  Note that threads that are already running
+        // are unaffected.
+
     void shutdown();
         // Disable queuing on this thread pool, cancel all queued jobs, and
         // shut down all processing threads (after all active jobs complete).
@@ -626,6 +652,9 @@ class ThreadPool {
 
     int threadFailures() const;
         // Return the number of times that thread creation failed.
+
+    ThreadPlacementUtil::Policy threadPlacement() const;
+        // Return the thread placement policy of this thread pool.
 };
 
 // ============================================================================
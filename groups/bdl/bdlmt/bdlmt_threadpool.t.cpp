@@ -32,6 +32,7 @@
 #include <bslmt_lockguard.h>  // For test only
 #include <bslmt_threadattributes.h>     // For test only
 #include <bslmt_threadutil.h>     // For test only
+#include <bsl_algorithm.h>
 #include <bsl_cstddef.h>
 #include <bsl_cstdio.h>           // For FILE in usage example
 #include <bsl_cstdlib.h>          // for atoi
@@ -43,6 +44,11 @@
 
 #include <bsl_c_signal.h>
 
+#if defined(BSLS_PLATFORM_OS_LINUX)
+#        include <pthread.h>
+#        include <sched.h>
+#endif
+
 // for collecting CPU time
 #ifdef BSLS_PLATFORM_OS_WINDOWS
 #        include <windows.h>
@@ -76,6 +82,8 @@ using namespace bsl;  // automatically added by script
 // [3 ] int threadFailures() const;
 // [8 ] double percentBusy() const
 // [8 ] double resetPercentBusy()
+// [15] void setThreadPlacement(ThreadPlacementUtil::Policy);
+// [15] ThreadPlacementUtil::Policy threadPlacement() const;
 // ----------------------------------------------------------------------------
 // [1 ] Breathing test
 // [6 ] Max idle time functionality
@@ -681,6 +689,44 @@ void CopyCountingFunctor::operator()()
 
 }  // close namespace case14
 
+// ============================================================================
+//                         CASE 15 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace case15 {
+
+void recordAffinity(bsl::vector<bsl::vector<int> > *result,
+                    bslmt::Mutex                   *mutex,
+                    bslmt::Barrier                 *barrier)
+    // Append to the specified 'result' the CPUs on which the calling thread
+    // may run (an empty list on platforms where this is not available),
+    // synchronizing with the specified 'mutex', then wait on the specified
+    // 'barrier'.
+{
+    bsl::vector<int> cpus;
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (0 == pthread_getaffinity_np(pthread_self(), sizeof set, &set)) {
+        for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+            if (CPU_ISSET(cpu, &set)) {
+                cpus.push_back(cpu);
+            }
+        }
+    }
+#endif
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(mutex);
+        result->push_back(cpus);
+    }
+
+    barrier->wait();
+}
+
+}  // close namespace case15
+
 // ============================================================================
 //                          CASE 8 RELATED ENTITIES
 // ----------------------------------------------------------------------------
@@ -817,6 +863,95 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0: // 0 is always the first test case
+      case 15: {
+        // --------------------------------------------------------------------
+        // TESTING THREAD PLACEMENT
+        //
+        // Concerns:
+        //: 1 The initial placement policy is 'e_NONE'.
+        //:
+        //: 2 'setThreadPlacement' sets the policy reported by
+        //:   'threadPlacement'.
+        //:
+        //: 3 The 'minThreads()' threads started by 'start' run on the CPUs
+        //:   assigned by 'bdlmt::ThreadPlacementUtil' to the indices '0' to
+        //:   'minThreads() - 1'.
+        //
+        // Plan:
+        //: 1 Create pools, set each policy, and verify the accessor.  (C-1..2)
+        //:
+        //: 2 Start a pool having 'minThreads() == maxThreads()' and have
+        //:   every thread record its affinity (using a barrier so that every
+        //:   thread runs one job).  On Linux, verify that the recorded CPU
+        //:   sets are those expected.  (C-3)
+        //
+        // Testing:
+        //   void setThreadPlacement(ThreadPlacementUtil::Policy);
+        //   ThreadPlacementUtil::Policy threadPlacement() const;
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            cout << "TESTING THREAD PLACEMENT" << endl
+                 << "========================" << endl;
+
+        typedef bdlmt::ThreadPlacementUtil Util;
+
+        const Util::Policy POLICIES[] = { Util::e_NONE,
+                                          Util::e_COMPACT,
+                                          Util::e_SCATTER,
+                                          Util::e_NUMA_NODE };
+        const int NUM_POLICIES = sizeof POLICIES / sizeof *POLICIES;
+
+        enum { k_NUM_THREADS = 4, k_IDLE_TIME = 100 };
+
+        for (int p = 0; p < NUM_POLICIES; ++p) {
+            const Util::Policy POLICY = POLICIES[p];
+
+            bslmt::ThreadAttributes attributes;
+            Obj                     mX(attributes,
+                                       k_NUM_THREADS,
+                                       k_NUM_THREADS,
+                                       k_IDLE_TIME,
+                                       &testAllocator);
+            const Obj&              X = mX;
+
+            ASSERTV(p, Util::e_NONE == X.threadPlacement());
+
+            mX.setThreadPlacement(POLICY);
+            ASSERTV(p, POLICY == X.threadPlacement());
+
+            ASSERTV(p, 0 == mX.start());
+
+            bsl::vector<bsl::vector<int> > affinities;
+            bslmt::Mutex                   mutex;
+            bslmt::Barrier                 barrier(k_NUM_THREADS);
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERTV(p, i, 0 == mX.enqueueJob(bdlf::BindUtil::bind(
+                                                       &case15::recordAffinity,
+                                                       &affinities,
+                                                       &mutex,
+                                                       &barrier)));
+            }
+            mX.stop();
+
+            ASSERTV(p, k_NUM_THREADS == static_cast<int>(affinities.size()));
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+            if (Util::e_NONE != POLICY) {
+                bsl::vector<bsl::vector<int> > expected;
+                for (int i = 0; i < k_NUM_THREADS; ++i) {
+                    bsl::vector<int> cpus;
+                    Util::assignCpus(&cpus, POLICY, i);
+                    expected.push_back(cpus);
+                }
+                bsl::sort(expected.begin(), expected.end());
+                bsl::sort(affinities.begin(), affinities.end());
+                ASSERTV(p, expected == affinities);
+            }
+#endif
+        }
+      } break;
       case 14: {
         // --------------------------------------------------------------------
         // TESTING MOVING ENQUEUEJOB METHOD
@@ -0,0 +1,1187 @@
+// bdlmt_timerwheelscheduler.cpp                                      -*-C++-*-
+#include <bdlmt_timerwheelscheduler.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlmt_timerwheelscheduler_cpp,"$Id$ $CSID$")
+
+#include <bdlb_bitutil.h>
+
+#include <bdlf_bind.h>
+
+#include <bdlt_timeunitratio.h>
+
+#include <bslmt_lockguard.h>
+
+#include <bsls_assert.h>
+#include <bsls_review.h>
+#include <bsls_systemtime.h>
+
+#include <bsl_climits.h>
+#include <bsl_cstdint.h>
+#include <bsl_new.h>
+
+// IMPLEMENTATION NOTES
+// --------------------
+// The wheel follows the classic hashed hierarchical design: level 0 has
+// 'k_LEVEL0_SLOTS' slots of one tick each, and level 'N > 0' has
+// 'k_LEVELN_SLOTS' slots, each spanning '1 << shift(N)' ticks where
+// 'shift(N) == k_LEVEL0_BITS + (N - 1) * k_LEVELN_BITS'.  An event expiring at
+// tick 't' is filed, relative to 'd_nextTick', in the innermost level that
+// can represent 't - d_nextTick', at index '(t >> shift(N)) & mask(N)'.  When
+// 'd_nextTick' reaches a multiple of '1 << shift(N)', the slot of level 'N'
+// whose index is that of 'd_nextTick' is cascaded, i.e., its events are
+// re-filed into lower levels.
+//
+// The slots of all levels are stored contiguously in 'd_slots', so that a
+// single 'k_NUM_SLOTS'-bit occupancy bitmap, 'd_occupied', covers all of them.
+// The occupancy bitmap lets 'nextTickToProcess' find the next tick requiring
+// work without visiting empty slots, which both bounds the work done by
+// 'advance' when time jumps far ahead and lets the dispatcher sleep until that
+// tick.
+
+namespace BloombergLP {
+
+// STATIC FUNCTIONS
+static inline
+void defaultDispatcherFunction(const bsl::function<void()>& callback)
+{
+    callback();
+}
+
+static inline
+bsl::function<bsls::TimeInterval()> createDefaultCurrentTimeFunctor(
+                                        bsls::SystemClockType::Enum clockType)
+{
+    // Must cast the pointer to 'now' to the correct signature so that the
+    // correct now function is passed to the bind template.
+
+    return bdlf::BindUtil::bind(
+              static_cast<bsls::TimeInterval (*)(bsls::SystemClockType::Enum)>(
+                                                      &bsls::SystemTime::now),
+              clockType);
+}
+
+namespace {
+
+inline
+void initializeList(bdlmt::TimerWheelScheduler_Link *sentinel)
+    // Make the specified 'sentinel' denote an empty list.
+{
+    sentinel->d_next_p = sentinel;
+    sentinel->d_prev_p = sentinel;
+}
+
+inline
+bool isEmptyList(const bdlmt::TimerWheelScheduler_Link& sentinel)
+    // Return 'true' if the list denoted by the specified 'sentinel' is empty,
+    // and 'false' otherwise.
+{
+    return sentinel.d_next_p == &sentinel;
+}
+
+inline
+void pushBack(bdlmt::TimerWheelScheduler_Link *sentinel,
+              bdlmt::TimerWheelScheduler_Link *link)
+    // Append the specified 'link' to the list denoted by the specified
+    // 'sentinel'.
+{
+    link->d_next_p               = sentinel;
+    link->d_prev_p               = sentinel->d_prev_p;
+    sentinel->d_prev_p->d_next_p = link;
+    sentinel->d_prev_p           = link;
+}
+
+inline
+void spliceBack(bdlmt::TimerWheelScheduler_Link *sentinel,
+                bdlmt::TimerWheelScheduler_Link *other)
+    // Move all the links of the list denoted by the specified 'other'
+    // sentinel to the end of the list denoted by the specified 'sentinel',
+    // leaving 'other' empty.
+{
+    if (isEmptyList(*other)) {
+        return;                                                       // RETURN
+    }
+    other->d_next_p->d_prev_p    = sentinel->d_prev_p;
+    sentinel->d_prev_p->d_next_p = other->d_next_p;
+    other->d_prev_p->d_next_p    = sentinel;
+    sentinel->d_prev_p           = other->d_prev_p;
+    initializeList(other);
+}
+
+inline
+int shiftOfLevel(int level)
+    // Return the number of low-order bits of a tick that are not used to
+    // index the slots of the specified 'level'.
+{
+    return 0 == level ? 0 : 8 + (level - 1) * 6;
+}
+
+inline
+int firstSlotOfLevel(int level)
+    // Return the index, in the contiguous array of slots, of the first slot
+    // of the specified 'level'.
+{
+    return 0 == level ? 0 : 256 + (level - 1) * 64;
+}
+
+inline
+int findNextSet(bsl::uint64_t word, int start)
+    // Return the index of the first set bit of the specified 'word' found
+    // when visiting bits cyclically from the specified 'start' index, or -1
+    // if 'word' is 0.
+{
+    if (0 == word) {
+        return -1;                                                    // RETURN
+    }
+    const bsl::uint64_t rotated = 0 == start
+                                ? word
+                                : (word >> start) | (word << (64 - start));
+    return (start + bdlb::BitUtil::numTrailingUnsetBits(rotated)) & 63;
+}
+
+}  // close unnamed namespace
+
+namespace bdlmt {
+
+               // =============================================
+               // class TimerWheelSchedulerTestTimeSource_Data
+               // =============================================
+
+class TimerWheelSchedulerTestTimeSource_Data {
+    // This 'class' provides storage for the current time and a mutex to
+    // protect access to the current time.
+
+    // DATA
+    bsls::TimeInterval   d_currentTime;       // the current time
+
+    mutable bslmt::Mutex d_currentTimeMutex;  // mutex used to synchronize
+                                              // 'd_currentTime' access
+
+    // NOT IMPLEMENTED
+    TimerWheelSchedulerTestTimeSource_Data(
+                                const TimerWheelSchedulerTestTimeSource_Data&);
+    TimerWheelSchedulerTestTimeSource_Data& operator=(
+                                const TimerWheelSchedulerTestTimeSource_Data&);
+
+  public:
+    // CREATORS
+    explicit
+    TimerWheelSchedulerTestTimeSource_Data(bsls::TimeInterval currentTime);
+        // Construct a test time-source data object that will store the
+        // "system-time", initialized to the specified 'currentTime'.
+
+    // MANIPULATORS
+    bsls::TimeInterval advanceTime(bsls::TimeInterval amount);
+        // Advance this object's current-time value by the specified 'amount'
+        // of time.  Return the updated current-time value.
+
+    // ACCESSORS
+    bsls::TimeInterval currentTime() const;
+        // Return this object's current-time value.
+};
+
+// CREATORS
+TimerWheelSchedulerTestTimeSource_Data::TimerWheelSchedulerTestTimeSource_Data(
+                                                bsls::TimeInterval currentTime)
+: d_currentTime(currentTime)
+{
+}
+
+// MANIPULATORS
+bsls::TimeInterval TimerWheelSchedulerTestTimeSource_Data::advanceTime(
+                                                     bsls::TimeInterval amount)
+{
+    BSLS_ASSERT(amount > 0);
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_currentTimeMutex);
+    d_currentTime += amount;
+    return d_currentTime;
+}
+
+// ACCESSORS
+bsls::TimeInterval TimerWheelSchedulerTestTimeSource_Data::currentTime() const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_currentTimeMutex);
+    return d_currentTime;
+}
+
+                       // ------------------------------
+                       // struct TimerWheelScheduler_Node
+                       // ------------------------------
+
+// CREATORS
+TimerWheelScheduler_Node::TimerWheelScheduler_Node(
+                                TimerWheelScheduler          *scheduler,
+                                const bsl::function<void()>&  callback,
+                                bsls::Types::Int64            time,
+                                bsls::Types::Int64            interval,
+                                int                           refCount,
+                                bslma::Allocator             *basicAllocator)
+: d_callback(bsl::allocator_arg_t(), basicAllocator, callback)
+, d_scheduler_p(scheduler)
+, d_time(time)
+, d_interval(interval)
+, d_refCount(refCount)
+, d_state(e_DONE)
+, d_slot(-1)
+{
+    d_next_p = 0;
+    d_prev_p = 0;
+}
+
+                         // -------------------------
+                         // class TimerWheelScheduler
+                         // -------------------------
+
+// PUBLIC CONSTANTS
+const bsls::Types::Int64
+                  TimerWheelScheduler::k_DEFAULT_RESOLUTION_MICROSECONDS;
+
+// PRIVATE MANIPULATORS
+void TimerWheelScheduler::advance(bsls::Types::Int64 nowTick)
+{
+    while (d_nextTick <= nowTick) {
+        if (0 == d_numInWheel) {
+            d_nextTick = nowTick + 1;
+            break;
+        }
+
+        const bsls::Types::Int64 tick = nextTickToProcess();
+        if (tick > nowTick) {
+            // No slot needs attention up to and including 'nowTick', so no
+            // cascade is skipped by jumping ahead.
+
+            d_nextTick = nowTick + 1;
+            break;
+        }
+
+        d_nextTick = tick;
+        if (0 == (tick & (k_LEVEL0_SLOTS - 1))) {
+            cascade(tick);
+        }
+
+        const int slot = static_cast<int>(tick & (k_LEVEL0_SLOTS - 1));
+        if (!isEmptyList(d_slots[slot])) {
+            for (Link *link = d_slots[slot].d_next_p;
+                 link != &d_slots[slot];
+                 link = link->d_next_p) {
+                static_cast<Node *>(link)->d_state = Node::e_READY;
+                --d_numInWheel;
+            }
+            spliceBack(&d_ready, &d_slots[slot]);
+            d_occupied[slot >> 6] &= ~(1ULL << (slot & 63));
+        }
+        ++d_nextTick;
+    }
+}
+
+void TimerWheelScheduler::cascade(bsls::Types::Int64 tick)
+{
+    BSLS_ASSERT(0 == (tick & (k_LEVEL0_SLOTS - 1)));
+
+    for (int level = 1; level < k_NUM_LEVELS; ++level) {
+        const int index = static_cast<int>((tick >> shiftOfLevel(level))
+                                                       & (k_LEVELN_SLOTS - 1));
+        const int slot  = firstSlotOfLevel(level) + index;
+
+        if (!isEmptyList(d_slots[slot])) {
+            Link detached;
+            initializeList(&detached);
+            spliceBack(&detached, &d_slots[slot]);
+            d_occupied[slot >> 6] &= ~(1ULL << (slot & 63));
+
+            while (!isEmptyList(detached)) {
+                Node *node = static_cast<Node *>(detached.d_next_p);
+                detached.d_next_p         = node->d_next_p;
+                node->d_next_p->d_prev_p  = &detached;
+                --d_numInWheel;
+                file(node);
+            }
+        }
+
+        if (0 != index) {
+            // The outer levels are cascaded only when this level wraps.
+
+            break;
+        }
+    }
+}
+
+void TimerWheelScheduler::dispatchEvents()
+{
+    while (1) {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        // Get ready for the next iteration.
+
+        if (d_currentEvent_p) {
+            Node *node = d_currentEvent_p;
+            d_currentEvent_p = 0;
+
+            bslmt::LockGuardUnlock<bslmt::Mutex> unlockGuard(&d_mutex);
+            releaseNode(node);
+        }
+
+        if (d_dispatcherAwaited) {
+            d_dispatcherAwaited = false;
+            d_iterationCondition.broadcast();
+        }
+
+        // Now proceed with the next iteration.
+
+        if (!d_running) {
+            return;                                                   // RETURN
+        }
+
+        if (isEmptyList(d_ready)) {
+            initializeTick();
+            advance(d_currentTimeFunctor().totalMicroseconds() / d_resolution);
+        }
+
+        if (isEmptyList(d_ready)) {
+            ++d_waitCount;
+            if (0 == d_numInWheel) {
+                d_wakeTick = LLONG_MAX;
+                d_queueCondition.wait(&d_mutex);
+            }
+            else {
+                d_wakeTick = nextTickToProcess();
+                bsls::TimeInterval w;
+                w.addMicroseconds(d_wakeTick * d_resolution);
+                d_queueCondition.timedWait(&d_mutex, w);
+            }
+            d_wakeTick = LLONG_MIN;
+            continue;
+        }
+
+        // We have an event due for execution.  Note that, as 'd_ready' holds
+        // every event that expired during the last call to 'advance', the
+        // following iterations execute that whole batch before the wheel is
+        // consulted again.
+
+        Node *node = static_cast<Node *>(d_ready.d_next_p);
+        unlink(node);
+
+        if (node->d_interval) {
+            node->d_time += node->d_interval;
+            file(node);
+            ++node->d_refCount;
+        }
+        else {
+            node->d_state = Node::e_DONE;
+            --d_numEvents;
+        }
+
+        // The reference held by the scheduler for the pending event (or the
+        // reference added above, for a recurring event) is now held by
+        // 'd_currentEvent_p'.
+
+        d_currentEvent_p = node;
+
+        lock.release()->unlock();
+        d_dispatcherFunctor(node->d_callback);
+    }
+}
+
+void TimerWheelScheduler::file(Node *node)
+{
+    BSLS_ASSERT(0 <= d_nextTick);
+
+    // Round the expiry time up so that the event is never dispatched early.
+
+    const bsls::Types::Int64 time = node->d_time;
+    bsls::Types::Int64       tick = time / d_resolution;
+    if (tick * d_resolution < time) {
+        ++tick;
+    }
+
+    if (tick < d_nextTick) {
+        node->d_state = Node::e_READY;
+        node->d_slot  = -1;
+        pushBack(&d_ready, node);
+        if (LLONG_MIN != d_wakeTick) {
+            d_queueCondition.signal();
+        }
+        return;                                                       // RETURN
+    }
+
+    bsl::uint64_t delta = tick - d_nextTick;
+
+    int level = 0;
+    if (delta >= k_LEVEL0_SLOTS) {
+        const int k_MAX_SHIFT = k_LEVEL0_BITS
+                              + (k_NUM_LEVELS - 1) * k_LEVELN_BITS;
+
+        if (delta >> k_MAX_SHIFT) {
+            // Beyond the span of the wheel: park the event in the outermost
+            // level, from which it will be re-filed when cascaded.
+
+            delta = (1ULL << k_MAX_SHIFT) - 1;
+            tick  = d_nextTick + delta;
+        }
+        level = 1;
+        while (delta >> shiftOfLevel(level + 1)) {
+            ++level;
+        }
+    }
+
+    const int mask = 0 == level ? k_LEVEL0_SLOTS - 1 : k_LEVELN_SLOTS - 1;
+    const int slot = firstSlotOfLevel(level)
+                   + static_cast<int>((tick >> shiftOfLevel(level)) & mask);
+
+    node->d_state = Node::e_PENDING;
+    node->d_slot  = slot;
+    pushBack(&d_slots[slot], node);
+    d_occupied[slot >> 6] |= 1ULL << (slot & 63);
+    ++d_numInWheel;
+
+    if (tick < d_wakeTick) {
+        d_queueCondition.signal();
+    }
+}
+
+void TimerWheelScheduler::initializeTick()
+{
+    if (0 > d_nextTick) {
+        d_nextTick = d_currentTimeFunctor().totalMicroseconds()
+                                                                / d_resolution;
+    }
+}
+
+void TimerWheelScheduler::releaseNode(Node *node)
+{
+    if (0 == --node->d_refCount) {
+        d_nodePool.deleteObject(node);
+    }
+}
+
+void TimerWheelScheduler::unlink(Node *node)
+{
+    BSLS_ASSERT(Node::e_PENDING == node->d_state ||
+                Node::e_READY   == node->d_state);
+
+    node->d_prev_p->d_next_p = node->d_next_p;
+    node->d_next_p->d_prev_p = node->d_prev_p;
+    node->d_next_p = 0;
+    node->d_prev_p = 0;
+
+    if (Node::e_PENDING == node->d_state) {
+        const int slot = node->d_slot;
+        if (isEmptyList(d_slots[slot])) {
+            d_occupied[slot >> 6] &= ~(1ULL << (slot & 63));
+        }
+        --d_numInWheel;
+    }
+    node->d_state = Node::e_DONE;
+}
+
+// PRIVATE ACCESSORS
+bsls::Types::Int64 TimerWheelScheduler::nextTickToProcess() const
+{
+    BSLS_ASSERT(0 < d_numInWheel);
+
+    const int index = static_cast<int>(d_nextTick & (k_LEVEL0_SLOTS - 1));
+    if (0 == index) {
+        // The outer levels have not yet been cascaded for 'd_nextTick'.
+
+        return d_nextTick;                                            // RETURN
+    }
+
+    bsls::Types::Int64 result = LLONG_MAX;
+
+    // Level 0: the slots are visited cyclically from the current one; slots
+    // preceding it hold ticks of the next revolution.
+
+    const bsls::Types::Int64 base = d_nextTick - index;
+    for (int i = 0; i <= k_LEVEL0_SLOTS / 64; ++i) {
+        const int word  = ((index >> 6) + i) % (k_LEVEL0_SLOTS / 64);
+        const int first = word * 64;
+
+        bsl::uint64_t bits = d_occupied[word];
+        if (0 == i) {
+            bits &= ~0ULL << (index & 63);
+        }
+        else if (k_LEVEL0_SLOTS / 64 == i) {
+            bits &= (index & 63) ? ~(~0ULL << (index & 63)) : 0;
+        }
+        if (bits) {
+            const int slot = first + bdlb::BitUtil::numTrailingUnsetBits(bits);
+            result = base + slot + (slot < index ? k_LEVEL0_SLOTS : 0);
+            break;
+        }
+    }
+
+    // Outer levels: the slot of level 'N' at cyclic distance 'D' (in
+    // '[1 .. k_LEVELN_SLOTS]') from the current index is cascaded when
+    // 'd_nextTick' next reaches a multiple of '1 << shift(N)' 'D' times.
+
+    for (int level = 1; level < k_NUM_LEVELS; ++level) {
+        const int slot0 = firstSlotOfLevel(level);
+        const bsl::uint64_t word = d_occupied[slot0 >> 6];
+        if (0 == word) {
+            continue;
+        }
+        const int shift   = shiftOfLevel(level);
+        const int current = static_cast<int>((d_nextTick >> shift)
+                                                       & (k_LEVELN_SLOTS - 1));
+        const int found   = findNextSet(word, (current + 1) & 63);
+        const int dist    = ((found - current - 1) & 63) + 1;
+
+        const bsls::Types::Int64 levelBase =
+                        d_nextTick & ~((bsls::Types::Int64(1) << shift) - 1);
+        const bsls::Types::Int64 candidate =
+                            levelBase + (bsls::Types::Int64(dist) << shift);
+        if (candidate < result) {
+            result = candidate;
+        }
+    }
+
+    return result;
+}
+
+// CREATORS
+TimerWheelScheduler::TimerWheelScheduler(bslma::Allocator *basicAllocator)
+: d_currentTimeFunctor(bsl::allocator_arg_t(), basicAllocator,
+                       createDefaultCurrentTimeFunctor(
+                                            bsls::SystemClockType::e_REALTIME))
+, d_nodePool(sizeof(Node), basicAllocator)
+, d_resolution(k_DEFAULT_RESOLUTION_MICROSECONDS)
+, d_nextTick(-1)
+, d_wakeTick(LLONG_MIN)
+, d_numInWheel(0)
+, d_numEvents(0)
+, d_numRecurringEvents(0)
+, d_dispatcherFunctor(bsl::allocator_arg_t(), basicAllocator,
+                      &defaultDispatcherFunction)
+, d_dispatcherThread(bslmt::ThreadUtil::invalidHandle())
+, d_running(false)
+, d_dispatcherAwaited(false)
+, d_currentEvent_p(0)
+, d_waitCount(0)
+, d_clockType(bsls::SystemClockType::e_REALTIME)
+{
+    for (int i = 0; i < k_NUM_SLOTS; ++i) {
+        initializeList(&d_slots[i]);
+    }
+    for (int i = 0; i < k_NUM_WORDS; ++i) {
+        d_occupied[i] = 0;
+    }
+    initializeList(&d_ready);
+}
+
+TimerWheelScheduler::TimerWheelScheduler(
+                                  bsls::SystemClockType::Enum  clockType,
+                                bslma::Allocator            *basicAllocator)
+: d_currentTimeFunctor(bsl::allocator_arg_t(), basicAllocator,
+                       createDefaultCurrentTimeFunctor(clockType))
+, d_nodePool(sizeof(Node), basicAllocator)
+, d_resolution(k_DEFAULT_RESOLUTION_MICROSECONDS)
+, d_nextTick(-1)
+, d_wakeTick(LLONG_MIN)
+, d_numInWheel(0)
+, d_numEvents(0)
+, d_numRecurringEvents(0)
+, d_dispatcherFunctor(bsl::allocator_arg_t(), basicAllocator,
+                      &defaultDispatcherFunction)
+, d_dispatcherThread(bslmt::ThreadUtil::invalidHandle())
+, d_queueCondition(clockType)
+, d_running(false)
+, d_dispatcherAwaited(false)
+, d_currentEvent_p(0)
+, d_waitCount(0)
+, d_clockType(clockType)
+{
+    for (int i = 0; i < k_NUM_SLOTS; ++i) {
+        initializeList(&d_slots[i]);
+    }
+    for (int i = 0; i < k_NUM_WORDS; ++i) {
+        d_occupied[i] = 0;
+    }
+    initializeList(&d_ready);
+}
+
+TimerWheelScheduler::TimerWheelScheduler(
+                                  bsls::SystemClockType::Enum  clockType,
+                                const bsls::TimeInterval&    resolution,
+                                bslma::Allocator            *basicAllocator)
+: d_currentTimeFunctor(bsl::allocator_arg_t(), basicAllocator,
+                       createDefaultCurrentTimeFunctor(clockType))
+, d_nodePool(sizeof(Node), basicAllocator)
+, d_resolution(resolution.totalMicroseconds())
+, d_nextTick(-1)
+, d_wakeTick(LLONG_MIN)
+, d_numInWheel(0)
+, d_numEvents(0)
+, d_numRecurringEvents(0)
+, d_dispatcherFunctor(bsl::allocator_arg_t(), basicAllocator,
+                      &defaultDispatcherFunction)
+, d_dispatcherThread(bslmt::ThreadUtil::invalidHandle())
+, d_queueCondition(clockType)
+, d_running(false)
+, d_dispatcherAwaited(false)
+, d_currentEvent_p(0)
+, d_waitCount(0)
+, d_clockType(clockType)
+{
+    BSLS_ASSERT(1 <= d_resolution);
+
+    for (int i = 0; i < k_NUM_SLOTS; ++i) {
+        initializeList(&d_slots[i]);
+    }
+    for (int i = 0; i < k_NUM_WORDS; ++i) {
+        d_occupied[i] = 0;
+    }
+    initializeList(&d_ready);
+}
+
+TimerWheelScheduler::TimerWheelScheduler(
+                                  const Dispatcher&  dispatcherFunctor,
+                                  bslma::Allocator  *basicAllocator)
+: d_currentTimeFunctor(bsl::allocator_arg_t(), basicAllocator,
+                       createDefaultCurrentTimeFunctor(
+                                            bsls::SystemClockType::e_REALTIME))
+, d_nodePool(sizeof(Node), basicAllocator)
+, d_resolution(k_DEFAULT_RESOLUTION_MICROSECONDS)
+, d_nextTick(-1)
+, d_wakeTick(LLONG_MIN)
+, d_numInWheel(0)
+, d_numEvents(0)
+, d_numRecurringEvents(0)
+, d_dispatcherFunctor(bsl::allocator_arg_t(), basicAllocator,
+                      dispatcherFunctor)
+, d_dispatcherThread(bslmt::ThreadUtil::invalidHandle())
+, d_running(false)
+, d_dispatcherAwaited(false)
+, d_currentEvent_p(0)
+, d_waitCount(0)
+, d_clockType(bsls::SystemClockType::e_REALTIME)
+{
+    for (int i = 0; i < k_NUM_SLOTS; ++i) {
+        initializeList(&d_slots[i]);
+    }
+    for (int i = 0; i < k_NUM_WORDS; ++i) {
+        d_occupied[i] = 0;
+    }
+    initializeList(&d_ready);
+}
+
+TimerWheelScheduler::TimerWheelScheduler(
+                                const Dispatcher&            dispatcherFunctor,
+                                bsls::SystemClockType::Enum  clockType,
+                                bslma::Allocator            *basicAllocator)
+: d_currentTimeFunctor(bsl::allocator_arg_t(), basicAllocator,
+                       createDefaultCurrentTimeFunctor(clockType))
+, d_nodePool(sizeof(Node), basicAllocator)
+, d_resolution(k_DEFAULT_RESOLUTION_MICROSECONDS)
+, d_nextTick(-1)
+, d_wakeTick(LLONG_MIN)
+, d_numInWheel(0)
+, d_numEvents(0)
+, d_numRecurringEvents(0)
+, d_dispatcherFunctor(bsl::allocator_arg_t(), basicAllocator,
+                      dispatcherFunctor)
+, d_dispatcherThread(bslmt::ThreadUtil::invalidHandle())
+, d_queueCondition(clockType)
+, d_running(false)
+, d_dispatcherAwaited(false)
+, d_currentEvent_p(0)
+, d_waitCount(0)
+, d_clockType(clockType)
+{
+    for (int i = 0; i < k_NUM_SLOTS; ++i) {
+        initializeList(&d_slots[i]);
+    }
+    for (int i = 0; i < k_NUM_WORDS; ++i) {
+        d_occupied[i] = 0;
+    }
+    initializeList(&d_ready);
+}
+
+TimerWheelScheduler::TimerWheelScheduler(
+                                const Dispatcher&            dispatcherFunctor,
+                                bsls::SystemClockType::Enum  clockType,
+                                const bsls::TimeInterval&    resolution,
+                                bslma::Allocator            *basicAllocator)
+: d_currentTimeFunctor(bsl::allocator_arg_t(), basicAllocator,
+                       createDefaultCurrentTimeFunctor(clockType))
+, d_nodePool(sizeof(Node), basicAllocator)
+, d_resolution(resolution.totalMicroseconds())
+, d_nextTick(-1)
+, d_wakeTick(LLONG_MIN)
+, d_numInWheel(0)
+, d_numEvents(0)
+, d_numRecurringEvents(0)
+, d_dispatcherFunctor(bsl::allocator_arg_t(), basicAllocator,
+                      dispatcherFunctor)
+, d_dispatcherThread(bslmt::ThreadUtil::invalidHandle())
+, d_queueCondition(clockType)
+, d_running(false)
+, d_dispatcherAwaited(false)
+, d_currentEvent_p(0)
+, d_waitCount(0)
+, d_clockType(clockType)
+{
+    BSLS_ASSERT(1 <= d_resolution);
+
+    for (int i = 0; i < k_NUM_SLOTS; ++i) {
+        initializeList(&d_slots[i]);
+    }
+    for (int i = 0; i < k_NUM_WORDS; ++i) {
+        d_occupied[i] = 0;
+    }
+    initializeList(&d_ready);
+}
+
+TimerWheelScheduler::~TimerWheelScheduler()
+{
+    BSLS_ASSERT(bslmt::ThreadUtil::invalidHandle() == d_dispatcherThread);
+
+    cancelAllEvents();
+}
+
+// MANIPULATORS
+void TimerWheelScheduler::cancelAllEvents()
+{
+    Link canceled;
+    initializeList(&canceled);
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        for (int i = 0; i < k_NUM_SLOTS; ++i) {
+            spliceBack(&canceled, &d_slots[i]);
+        }
+        for (int i = 0; i < k_NUM_WORDS; ++i) {
+            d_occupied[i] = 0;
+        }
+        spliceBack(&canceled, &d_ready);
+
+        for (Link *link = canceled.d_next_p;
+             link != &canceled;
+             link = link->d_next_p) {
+            static_cast<Node *>(link)->d_state = Node::e_DONE;
+        }
+
+        d_numInWheel         = 0;
+        d_numEvents          = 0;
+        d_numRecurringEvents = 0;
+    }
+
+    // Release the references held by the scheduler outside of the lock, as
+    // destroying a callback may execute arbitrary code.
+
+    Link *link = canceled.d_next_p;
+    while (link != &canceled) {
+        Node *node = static_cast<Node *>(link);
+        link = link->d_next_p;
+        node->d_next_p = 0;
+        node->d_prev_p = 0;
+        releaseNode(node);
+    }
+}
+
+void TimerWheelScheduler::cancelAllEventsAndWait()
+{
+    BSLS_ASSERT(!bslmt::ThreadUtil::isEqual(bslmt::ThreadUtil::self(),
+                                            d_dispatcherThread));
+
+    cancelAllEvents();
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    while (d_currentEvent_p) {
+        d_dispatcherAwaited = true;
+        d_iterationCondition.wait(&d_mutex);
+    }
+}
+
+int TimerWheelScheduler::cancelEvent(const Event *handle)
+{
+    if (0 == handle) {
+        return e_INVALID;                                             // RETURN
+    }
+
+    Node *node = toNode(handle);
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        if (Node::e_DONE == node->d_state) {
+            return e_NOT_FOUND;                                       // RETURN
+        }
+        unlink(node);
+        --d_numEvents;
+    }
+
+    releaseNode(node);
+    return 0;
+}
+
+int TimerWheelScheduler::cancelEvent(const RecurringEvent *handle)
+{
+    if (0 == handle) {
+        return e_INVALID;                                             // RETURN
+    }
+
+    Node *node = toNode(handle);
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        if (Node::e_DONE == node->d_state) {
+            return e_NOT_FOUND;                                       // RETURN
+        }
+        unlink(node);
+        --d_numRecurringEvents;
+    }
+
+    releaseNode(node);
+    return 0;
+}
+
+int TimerWheelScheduler::cancelEvent(EventHandle *handle)
+{
+    const int ret = cancelEvent(static_cast<const Event *>(*handle));
+    handle->release();
+    return ret;
+}
+
+int TimerWheelScheduler::cancelEvent(RecurringEventHandle *handle)
+{
+    const int ret = cancelEvent(static_cast<const RecurringEvent *>(*handle));
+    handle->release();
+    return ret;
+}
+
+int TimerWheelScheduler::cancelEventAndWait(const Event *handle)
+{
+    BSLS_ASSERT(!bslmt::ThreadUtil::isEqual(bslmt::ThreadUtil::self(),
+                                            d_dispatcherThread));
+
+    const int ret = cancelEvent(handle);
+    if (0 == ret || 0 == handle) {
+        return ret;                                                   // RETURN
+    }
+
+    // The event could not be canceled; wait if it is being executed.
+
+    const Node *node = toNode(handle);
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    while (d_currentEvent_p == node) {
+        d_dispatcherAwaited = true;
+        d_iterationCondition.wait(&d_mutex);
+    }
+    return ret;
+}
+
+int TimerWheelScheduler::cancelEventAndWait(const RecurringEvent *handle)
+{
+    BSLS_ASSERT(!bslmt::ThreadUtil::isEqual(bslmt::ThreadUtil::self(),
+                                            d_dispatcherThread));
+
+    const int ret = cancelEvent(handle);
+    if (e_INVALID == ret) {
+        return ret;                                                   // RETURN
+    }
+
+    // A recurring event may be executing even if it was still pending.
+
+    const Node *node = toNode(handle);
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    while (d_currentEvent_p == node) {
+        d_dispatcherAwaited = true;
+        d_iterationCondition.wait(&d_mutex);
+    }
+    return ret;
+}
+
+int TimerWheelScheduler::cancelEventAndWait(EventHandle *handle)
+{
+    const int ret = cancelEventAndWait(static_cast<const Event *>(*handle));
+    handle->release();
+    return ret;
+}
+
+int TimerWheelScheduler::cancelEventAndWait(RecurringEventHandle *handle)
+{
+    const int ret = cancelEventAndWait(
+                                 static_cast<const RecurringEvent *>(*handle));
+    handle->release();
+    return ret;
+}
+
+int TimerWheelScheduler::rescheduleEvent(
+                                       const Event               *handle,
+                                       const bsls::TimeInterval&  newEpochTime)
+{
+    if (0 == handle) {
+        return e_INVALID;                                             // RETURN
+    }
+
+    Node *node = toNode(handle);
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    if (Node::e_DONE == node->d_state) {
+        return e_NOT_FOUND;                                           // RETURN
+    }
+    unlink(node);
+    node->d_time = newEpochTime.totalMicroseconds();
+    file(node);
+    return 0;
+}
+
+int TimerWheelScheduler::rescheduleEventAndWait(
+                                       const Event               *handle,
+                                       const bsls::TimeInterval&  newEpochTime)
+{
+    BSLS_ASSERT(!bslmt::ThreadUtil::isEqual(bslmt::ThreadUtil::self(),
+                                            d_dispatcherThread));
+
+    const int ret = rescheduleEvent(handle, newEpochTime);
+    if (0 == ret || 0 == handle) {
+        return ret;                                                   // RETURN
+    }
+
+    const Node *node = toNode(handle);
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    while (d_currentEvent_p == node) {
+        d_dispatcherAwaited = true;
+        d_iterationCondition.wait(&d_mutex);
+    }
+    return ret;
+}
+
+void TimerWheelScheduler::scheduleEvent(
+                                       EventHandle                  *event,
+                                       const bsls::TimeInterval&     epochTime,
+                                       const bsl::function<void()>&  callback)
+{
+    BSLS_ASSERT(event);
+
+    event->release();
+    scheduleEventRaw(reinterpret_cast<Event **>(&event->d_node_p),
+                     epochTime,
+                     callback);
+}
+
+void TimerWheelScheduler::scheduleEventRaw(
+                                   Event                        **event,
+                                   const bsls::TimeInterval&      epochTime,
+                                   const bsl::function<void()>&   callback)
+{
+    Node *node = new (d_nodePool) Node(this,
+                                       callback,
+                                       epochTime.totalMicroseconds(),
+                                       0,
+                                       event ? 2 : 1,
+                                       allocator());
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        initializeTick();
+        file(node);
+        ++d_numEvents;
+    }
+
+    if (event) {
+        *event = reinterpret_cast<Event *>(static_cast<void *>(node));
+    }
+}
+
+void TimerWheelScheduler::scheduleRecurringEvent(
+                                  RecurringEventHandle         *event,
+                                  const bsls::TimeInterval&     interval,
+                                  const bsl::function<void()>&  callback,
+                                  const bsls::TimeInterval&     startEpochTime)
+{
+    BSLS_ASSERT(event);
+
+    event->release();
+    scheduleRecurringEventRaw(
+                         reinterpret_cast<RecurringEvent **>(&event->d_node_p),
+                         interval,
+                         callback,
+                         startEpochTime);
+}
+
+void TimerWheelScheduler::scheduleRecurringEventRaw(
+                                 RecurringEvent               **event,
+                                 const bsls::TimeInterval&      interval,
+                                 const bsl::function<void()>&   callback,
+                                 const bsls::TimeInterval&      startEpochTime)
+{
+    BSLS_ASSERT(1 <= interval.totalMicroseconds());
+
+    bsls::Types::Int64 stime(startEpochTime.totalMicroseconds());
+    if (0 == stime) {
+        stime = (d_currentTimeFunctor() + interval).totalMicroseconds();
+    }
+
+    Node *node = new (d_nodePool) Node(this,
+                                       callback,
+                                       stime,
+                                       interval.totalMicroseconds(),
+                                       event ? 2 : 1,
+                                       allocator());
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        initializeTick();
+        file(node);
+        ++d_numRecurringEvents;
+    }
+
+    if (event) {
+        *event = reinterpret_cast<RecurringEvent *>(
+                                                 static_cast<void *>(node));
+    }
+}
+
+int TimerWheelScheduler::start()
+{
+    bslmt::ThreadAttributes attr;
+
+    return start(attr);
+}
+
+int TimerWheelScheduler::start(
+                               const bslmt::ThreadAttributes& threadAttributes)
+{
+    BSLS_ASSERT(!bslmt::ThreadUtil::isEqual(bslmt::ThreadUtil::self(),
+                                            d_dispatcherThread));
+
+    // Implementation note: d_dispatcherMutex is in a lock hierarchy with
+    // d_mutex and must be locked first.
+
+    bslmt::LockGuard<bslmt::Mutex> dispatcherLock(&d_dispatcherMutex);
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    if (d_running ||
+        bslmt::ThreadUtil::invalidHandle() != d_dispatcherThread) {
+        return 0;                                                     // RETURN
+    }
+
+    bslmt::ThreadAttributes modAttr(threadAttributes);
+    modAttr.setDetachedState(bslmt::ThreadAttributes::e_CREATE_JOINABLE);
+
+    if (bslmt::ThreadUtil::createWithAllocator(
+                 &d_dispatcherThread,
+                 modAttr,
+                 bdlf::BindUtil::bind(&TimerWheelScheduler::dispatchEvents,
+                                      this),
+                 allocator())) {
+        return -1;                                                    // RETURN
+    }
+
+    d_running = true;
+    return 0;
+}
+
+void TimerWheelScheduler::stop()
+{
+    BSLS_ASSERT(!bslmt::ThreadUtil::isEqual(bslmt::ThreadUtil::self(),
+                                            d_dispatcherThread));
+
+    // Implementation note: d_dispatcherMutex is in a lock hierarchy with
+    // d_mutex and must be locked first.
+
+    bslmt::LockGuard<bslmt::Mutex> dispatcherLock(&d_dispatcherMutex);
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    if (!d_running) {
+        return;                                                       // RETURN
+    }
+
+    d_running = false;
+    d_queueCondition.signal();
+
+    lock.release()->unlock();
+
+    bslmt::ThreadUtil::join(d_dispatcherThread);
+    d_dispatcherThread = bslmt::ThreadUtil::invalidHandle();
+}
+
+                  // ---------------------------------------
+                  // class TimerWheelSchedulerTestTimeSource
+                  // ---------------------------------------
+
+// CREATORS
+TimerWheelSchedulerTestTimeSource::TimerWheelSchedulerTestTimeSource(
+                                                TimerWheelScheduler *scheduler)
+: d_scheduler_p(scheduler)
+{
+    BSLS_ASSERT(0 != scheduler);
+
+    // As for 'EventSchedulerTestTimeSource', the time source starts 1000 days
+    // in the future so that the system clock, which controls the timed waits
+    // of the dispatcher thread, always lags behind the test time source.
+    //
+    // The default allocator is used, since the lifetime of the data is shared
+    // between this object and the scheduler.
+
+    d_data_p = bsl::make_shared<TimerWheelSchedulerTestTimeSource_Data>(
+                                bsls::SystemTime::now(scheduler->d_clockType)
+                              + 1000 * bdlt::TimeUnitRatio::k_SECONDS_PER_DAY);
+
+    d_scheduler_p->d_currentTimeFunctor = bdlf::BindUtil::bind(
+                          &TimerWheelSchedulerTestTimeSource_Data::currentTime,
+                          d_data_p);
+}
+
+// MANIPULATORS
+bsls::TimeInterval TimerWheelSchedulerTestTimeSource::advanceTime(
+                                                     bsls::TimeInterval amount)
+{
+    BSLS_ASSERT(amount > 0);
+
+    bsls::TimeInterval ret = d_data_p->advanceTime(amount);
+
+    unsigned int waitCount;
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_scheduler_p->d_mutex);
+
+        waitCount = d_scheduler_p->d_waitCount;
+        d_scheduler_p->d_queueCondition.signal();
+    }
+
+    // Yield-spin until the dispatcher thread has processed the events
+    // triggered by this change in time and waits again.
+
+    unsigned int currentWaitCount = waitCount;
+    while (currentWaitCount == waitCount) {
+        bslmt::ThreadUtil::yield();
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_scheduler_p->d_mutex);
+        currentWaitCount = d_scheduler_p->d_waitCount;
+        if (!d_scheduler_p->d_running) {
+            currentWaitCount = ~waitCount;  // exit loop
+        }
+    }
+
+    return ret;
+}
+
+// ACCESSORS
+bsls::TimeInterval TimerWheelSchedulerTestTimeSource::now()
+{
+    return d_data_p->currentTime();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1059 @@
+// bdlmt_timerwheelscheduler.h                                        -*-C++-*-
+#ifndef INCLUDED_BDLMT_TIMERWHEELSCHEDULER
+#define INCLUDED_BDLMT_TIMERWHEELSCHEDULER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an event scheduler with O(1) schedule and cancel.
+//
+//@CLASSES:
+//  bdlmt::TimerWheelScheduler: hierarchical timing-wheel event scheduler
+//  bdlmt::TimerWheelSchedulerEventHandle: handle to a one-time event
+//  bdlmt::TimerWheelSchedulerRecurringEventHandle: handle to recurring event
+//  bdlmt::TimerWheelSchedulerTestTimeSource: test clock for the scheduler
+//
+//@SEE_ALSO: bdlmt_eventscheduler, bdlmt_timereventscheduler
+//
+//@DESCRIPTION: This component provides a thread-safe event scheduler,
+// 'bdlmt::TimerWheelScheduler', that offers the same handle-based interface
+// as 'bdlmt::EventScheduler' but stores pending events in a hierarchical
+// timing wheel rather than in a skip list.  Scheduling, rescheduling, and
+// canceling an event are constant-time operations, which makes this scheduler
+// well suited to workloads having a very large number of outstanding events
+// that are typically canceled before they expire (e.g., session timeouts).
+//
+// All callbacks are processed by a separate thread (called the dispatcher
+// thread), and, as with 'bdlmt::EventScheduler', a dispatcher functor may be
+// supplied at construction to alter how the callbacks are executed (see
+// {'bdlmt_eventscheduler'|The Dispatcher Thread and the Dispatcher Functor}).
+//
+///Comparison to 'bdlmt::EventScheduler'
+///-------------------------------------
+// 'bdlmt::EventScheduler' keeps its events in two 'bdlcc::SkipList' objects,
+// so that scheduling or canceling an event costs 'O(log(N))' where 'N' is the
+// number of pending events.  'bdlmt::TimerWheelScheduler' rounds the expiry
+// time of each event *up* to a multiple of a fixed *resolution* (1
+// millisecond by default, configurable at construction), and files the event
+// in one of the slots of the timing wheel according to how far in the future
+// that rounded time lies.  Each such operation is a constant number of
+// pointer manipulations performed while holding a mutex for a very short
+// time.
+//
+// The trade-off is precision: an event is never dispatched before its
+// scheduled time, but may be dispatched up to one resolution after it.  Events
+// whose rounded expiry times differ are dispatched in time order; events
+// having the same rounded expiry time are dispatched in no particular order.
+//
+///Timing-Wheel Structure
+///----------------------
+// The wheel consists of five levels.  The first level has 256 slots, each
+// covering a single tick (one resolution); each of the four remaining levels
+// has 64 slots, each slot covering all of the slots of the level below.  With
+// the default resolution of 1 millisecond the wheel spans about 49 days;
+// events further in the future are parked in the outermost level and are
+// re-filed as time progresses.  When time crosses the boundary of a slot at
+// level 'N', the events in that slot are redistributed ("cascaded") into the
+// slots of level 'N - 1'.  All of the events expiring at a given tick are
+// moved to a ready list in one splice, from which the dispatcher thread
+// executes them in a batch.
+//
+// Occupancy bitmaps are kept for every level, so the dispatcher thread sleeps
+// until the next tick that actually requires work rather than waking at every
+// tick.
+//
+///Thread Safety and "Raw" Event Pointers
+///--------------------------------------
+// 'bdlmt::TimerWheelScheduler' is thread-safe and thread-enabled, and follows
+// the same rules as 'bdlmt::EventScheduler' regarding "raw" 'Event' and
+// 'RecurringEvent' pointers: every pointer populated by 'scheduleEventRaw' or
+// 'scheduleRecurringEventRaw', or returned by 'addEventRefRaw' or
+// 'addRecurringEventRefRaw', must be released exactly once using
+// 'releaseEventRaw'.  'bdlmt::TimerWheelSchedulerEventHandle' and
+// 'bdlmt::TimerWheelSchedulerRecurringEventHandle' manage such references
+// automatically, and are *const* *thread-safe*.
+//
+///Supported Clock-Types
+///---------------------
+// As with 'bdlmt::EventScheduler', the clock indicated at construction
+// ('bsls::SystemClockType::e_REALTIME' by default) determines the epoch of all
+// the absolute times supplied to, and returned by, the methods of this class.
+//
+///Event Clock Substitution
+///------------------------
+// For testing purposes, a class 'bdlmt::TimerWheelSchedulerTestTimeSource' is
+// provided to allow manual manipulation of the system-time observed by a
+// 'bdlmt::TimerWheelScheduler', exactly as
+// 'bdlmt::EventSchedulerTestTimeSource' does for 'bdlmt::EventScheduler'.  A
+// test time-source *must* be created on a scheduler before any events are
+// scheduled, or the scheduler is started.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Connection Timeouts
+/// - - - - - - - - - - - - - - -
+// Suppose a server maintains a large number of connections, each of which
+// must be closed if no data arrives on it within a timeout.  Data usually
+// arrives in time, so almost every scheduled timeout is canceled (and a new
+// one scheduled) before it expires, which is the workload a timing wheel is
+// designed for.
+//
+// First, we define a connection type that keeps a handle to its pending
+// timeout:
+//..
+//  struct my_Connection {
+//      bdlmt::TimerWheelSchedulerEventHandle d_timeout;   // pending timeout
+//      bool                                  d_isClosed;  // set on timeout
+//  };
+//
+//  void closeConnection(my_Connection *connection)
+//      // Close the specified 'connection'.
+//  {
+//      connection->d_isClosed = true;
+//  }
+//..
+// Next, we create a scheduler using the monotonic clock, and attach a test
+// time-source to it so that the passage of time is under our control:
+//..
+//  bdlmt::TimerWheelScheduler scheduler(bsls::SystemClockType::e_MONOTONIC);
+//  bdlmt::TimerWheelSchedulerTestTimeSource timeSource(&scheduler);
+//
+//  const bsls::TimeInterval timeout(5.0);
+//
+//  my_Connection connection;
+//  connection.d_isClosed = false;
+//
+//  scheduler.scheduleEvent(&connection.d_timeout,
+//                          scheduler.now() + timeout,
+//                          bdlf::BindUtil::bind(&closeConnection,
+//                                               &connection));
+//  scheduler.start();
+//..
+// Then, when data arrives before the timeout expires, we cancel the pending
+// timeout and schedule a new one:
+//..
+//  timeSource.advanceTime(bsls::TimeInterval(4.0));
+//
+//  assert(0 == scheduler.cancelEvent(&connection.d_timeout));
+//  scheduler.scheduleEvent(&connection.d_timeout,
+//                          scheduler.now() + timeout,
+//                          bdlf::BindUtil::bind(&closeConnection,
+//                                               &connection));
+//
+//  timeSource.advanceTime(bsls::TimeInterval(4.0));
+//  assert(!connection.d_isClosed);
+//..
+// Finally, no data arrives, so the timeout fires and the connection is
+// closed:
+//..
+//  timeSource.advanceTime(bsls::TimeInterval(2.0));
+//  assert(connection.d_isClosed);
+//
+//  scheduler.stop();
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlma_concurrentpool.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_condition.h>
+#include <bslmt_mutex.h>
+#include <bslmt_threadattributes.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_atomic.h>
+#include <bsls_systemclocktype.h>
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdint.h>
+#include <bsl_functional.h>
+#include <bsl_memory.h>
+
+namespace BloombergLP {
+namespace bdlmt {
+
+class TimerWheelScheduler;
+class TimerWheelSchedulerEventHandle;
+class TimerWheelSchedulerRecurringEventHandle;
+class TimerWheelSchedulerTestTimeSource_Data;
+
+                       // ==============================
+                       // struct TimerWheelScheduler_Link
+                       // ==============================
+
+struct TimerWheelScheduler_Link {
+    // This component-private 'struct' provides the links of the intrusive,
+    // circular, doubly-linked lists used to hold the events in each slot of
+    // the timing wheel.  An unused 'TimerWheelScheduler_Link' object serves
+    // as the sentinel of such a list.
+
+    // DATA
+    TimerWheelScheduler_Link *d_next_p;  // next link in the list
+    TimerWheelScheduler_Link *d_prev_p;  // previous link in the list
+};
+
+                       // ==============================
+                       // struct TimerWheelScheduler_Node
+                       // ==============================
+
+struct TimerWheelScheduler_Node : TimerWheelScheduler_Link {
+    // This component-private 'struct' holds the state of a single one-time or
+    // recurring event of a 'TimerWheelScheduler'.  The lifetime of a node is
+    // governed by its reference count; the scheduler holds one reference for
+    // as long as the event is pending, and each handle holds one more.
+
+    // PUBLIC TYPES
+    enum State {
+        e_PENDING,  // linked into a slot of the wheel
+        e_READY,    // linked into the list of events due for dispatch
+        e_DONE      // dispatched (one-time events) or canceled
+    };
+
+    // DATA
+    bsl::function<void()>  d_callback;     // callback to dispatch
+
+    TimerWheelScheduler   *d_scheduler_p;  // owning scheduler (held)
+
+    bsls::Types::Int64     d_time;         // expiry time (in microseconds)
+
+    bsls::Types::Int64     d_interval;     // period of a recurring event (in
+                                           // microseconds), or 0 for a
+                                           // one-time event
+
+    bsls::AtomicInt        d_refCount;     // number of references held
+
+    int                    d_state;        // 'State' of this event; guarded
+                                           // by the scheduler's mutex
+
+    int                    d_slot;         // index of the slot holding this
+                                           // event, if 'e_PENDING'
+
+    // CREATORS
+    TimerWheelScheduler_Node(TimerWheelScheduler          *scheduler,
+                             const bsl::function<void()>&  callback,
+                             bsls::Types::Int64            time,
+                             bsls::Types::Int64            interval,
+                             int                           refCount,
+                             bslma::Allocator             *basicAllocator);
+        // Create a node for an event of the specified 'scheduler' that
+        // invokes the specified 'callback' at the specified 'time', and, if
+        // the specified 'interval' is positive, every 'interval' thereafter.
+        // Initialize the reference count to the specified 'refCount'.  Use
+        // the specified 'basicAllocator' to supply memory.
+};
+
+                         // =========================
+                         // class TimerWheelScheduler
+                         // =========================
+
+class TimerWheelScheduler {
+    // This class provides a thread-safe event scheduler, backed by a
+    // hierarchical timing wheel, that executes callbacks in a separate
+    // "dispatcher thread."  'start' must be invoked to start dispatching the
+    // callbacks.  'stop' pauses the dispatching of the callbacks without
+    // removing the pending events.
+
+    // PRIVATE TYPES
+    typedef TimerWheelScheduler_Link           Link;
+    typedef TimerWheelScheduler_Node           Node;
+    typedef bsl::function<bsls::TimeInterval()> CurrentTimeFunctor;
+
+    enum {
+        k_LEVEL0_BITS  = 8,                    // bits indexing the first level
+        k_LEVELN_BITS  = 6,                    // bits indexing other levels
+        k_NUM_LEVELS   = 5,                    // number of levels in wheel
+
+        k_LEVEL0_SLOTS = 1 << k_LEVEL0_BITS,
+        k_LEVELN_SLOTS = 1 << k_LEVELN_BITS,
+        k_NUM_SLOTS    = k_LEVEL0_SLOTS + (k_NUM_LEVELS - 1) * k_LEVELN_SLOTS,
+        k_NUM_WORDS    = k_NUM_SLOTS / 64      // words in occupancy bitmap
+    };
+
+    enum {
+        e_NOT_FOUND = 1,  // event already dispatched or canceled
+        e_INVALID   = 2   // null handle supplied
+    };
+
+    // FRIENDS
+    friend class TimerWheelSchedulerEventHandle;
+    friend class TimerWheelSchedulerRecurringEventHandle;
+    friend class TimerWheelSchedulerTestTimeSource;
+
+  public:
+    // PUBLIC TYPES
+    struct Event {};
+    struct RecurringEvent {};
+        // Pointers to the opaque structures 'Event' and 'RecurringEvent' are
+        // populated by the "Raw" API of 'TimerWheelScheduler'.
+
+    typedef TimerWheelSchedulerEventHandle          EventHandle;
+
+    typedef TimerWheelSchedulerRecurringEventHandle RecurringEventHandle;
+
+    typedef bsl::function<void(const bsl::function<void()>&)> Dispatcher;
+        // Defines a type alias for the dispatcher functor type.
+
+    // PUBLIC CONSTANTS
+    static const bsls::Types::Int64 k_DEFAULT_RESOLUTION_MICROSECONDS = 1000;
+        // Default resolution of the timing wheel.
+
+  private:
+    // DATA
+    CurrentTimeFunctor     d_currentTimeFunctor;  // when called, returns the
+                                                  // current time the
+                                                  // scheduler should use for
+                                                  // the event timeline
+
+    bdlma::ConcurrentPool  d_nodePool;            // pool of 'Node' objects
+
+    Link                   d_slots[k_NUM_SLOTS];  // sentinels of the slot
+                                                  // lists of all levels
+
+    bsl::uint64_t          d_occupied[k_NUM_WORDS];
+                                                  // bit 'i' is set iff
+                                                  // 'd_slots[i]' is not
+                                                  // empty
+
+    Link                   d_ready;               // sentinel of the list of
+                                                  // events due for dispatch
+
+    bsls::Types::Int64     d_resolution;          // tick length (in
+                                                  // microseconds)
+
+    bsls::Types::Int64     d_nextTick;            // first tick not yet moved
+                                                  // to 'd_ready', or
+                                                  // negative if not yet
+                                                  // initialized
+
+    bsls::Types::Int64     d_wakeTick;            // tick at which the waiting
+                                                  // dispatcher will wake up,
+                                                  // or 'LLONG_MIN' if it is
+                                                  // not waiting
+
+    int                    d_numInWheel;          // number of 'e_PENDING'
+                                                  // events
+
+    bsls::AtomicInt        d_numEvents;           // number of pending one-time
+                                                  // events
+
+    bsls::AtomicInt        d_numRecurringEvents;  // number of recurring events
+
+    Dispatcher             d_dispatcherFunctor;   // dispatch events
+
+    bslmt::ThreadUtil::Handle
+                           d_dispatcherThread;    // dispatcher thread handle
+
+    bslmt::Mutex           d_dispatcherMutex;     // serialize starting/
+                                                  // stopping dispatcher thread
+
+    mutable bslmt::Mutex   d_mutex;               // guards the wheel and the
+                                                  // state of the dispatcher
+
+    bslmt::Condition       d_queueCondition;      // signaled when an event is
+                                                  // filed ahead of the tick
+                                                  // the dispatcher waits for
+
+    bslmt::Condition       d_iterationCondition;  // signaled when the
+                                                  // dispatcher is ready to
+                                                  // enter the next iteration
+
+    bool                   d_running;             // controls the looping of
+                                                  // the dispatcher thread
+
+    bool                   d_dispatcherAwaited;   // a thread is waiting for
+                                                  // the dispatcher to
+                                                  // complete an iteration
+
+    Node                  *d_currentEvent_p;      // event being executed
+
+    unsigned int           d_waitCount;           // count of the waits
+                                                  // performed by the
+                                                  // dispatcher, used by the
+                                                  // test time source
+
+    bsls::SystemClockType::Enum
+                           d_clockType;           // clock type used
+
+  private:
+    // NOT IMPLEMENTED
+    TimerWheelScheduler(const TimerWheelScheduler&);
+    TimerWheelScheduler& operator=(const TimerWheelScheduler&);
+
+    // PRIVATE CLASS METHODS
+    static Node *toNode(const void *handle);
+        // Return the node addressed by the specified "raw" 'handle'.
+
+    // PRIVATE MANIPULATORS
+    void advance(bsls::Types::Int64 nowTick);
+        // Move every event expiring at or before the specified 'nowTick' to
+        // the ready list, cascading events down the levels of the wheel as
+        // needed.  The behavior is undefined unless 'd_mutex' is locked.
+
+    void cascade(bsls::Types::Int64 tick);
+        // Redistribute the events held by the slots of the outer levels of
+        // the wheel whose span begins at the specified 'tick' into the lower
+        // levels.  The behavior is undefined unless 'd_mutex' is locked, and
+        // 'tick' is a multiple of the number of slots in the first level.
+
+    void dispatchEvents();
+        // While 'd_running' is true, execute events at their scheduled times.
+        // Note that this method implements the dispatching thread.
+
+    void file(Node *node);
+        // Link the specified 'node' into the slot of the wheel, or into the
+        // ready list, corresponding to its expiry time and signal the
+        // dispatcher if it has to wake up earlier than planned.  The behavior
+        // is undefined unless 'd_mutex' is locked and 'node' is not linked.
+
+    void initializeTick();
+        // Set the current tick from the current time if it has not yet been
+        // set.  The behavior is undefined unless 'd_mutex' is locked.
+
+    void releaseNode(Node *node);
+        // Release a reference to the specified 'node', destroying it if that
+        // was the last reference.
+
+    void unlink(Node *node);
+        // Remove the specified 'node' from the list holding it.  The behavior
+        // is undefined unless 'd_mutex' is locked and 'node' is either
+        // 'e_PENDING' or 'e_READY'.
+
+    // PRIVATE ACCESSORS
+    bsls::Types::Int64 nextTickToProcess() const;
+        // Return the earliest tick, not earlier than 'd_nextTick', at which
+        // either events expire or the events of an outer level have to be
+        // cascaded.  The behavior is undefined unless 'd_mutex' is locked and
+        // at least one event is 'e_PENDING'.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(TimerWheelScheduler,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit TimerWheelScheduler(bslma::Allocator *basicAllocator = 0);
+    explicit TimerWheelScheduler(bsls::SystemClockType::Enum  clockType,
+                                 bslma::Allocator            *basicAllocator
+                                                                        = 0);
+    TimerWheelScheduler(bsls::SystemClockType::Enum  clockType,
+                        const bsls::TimeInterval&    resolution,
+                        bslma::Allocator            *basicAllocator = 0);
+        // Construct a timer-wheel scheduler using the default dispatcher
+        // functor (see {'bdlmt_eventscheduler'|The Dispatcher Thread and the
+        // Dispatcher Functor}).  Optionally specify a 'clockType' indicating
+        // the epoch used for all time intervals; if 'clockType' is not
+        // specified, the realtime clock is used (see {Supported
+        // Clock-Types}).  Optionally specify a 'resolution' of the timing
+        // wheel, truncated to microseconds; if 'resolution' is not specified,
+        // 'k_DEFAULT_RESOLUTION_MICROSECONDS' is used.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The behavior is
+        // undefined unless 'resolution' is at least one microsecond.
+
+    explicit TimerWheelScheduler(const Dispatcher&  dispatcherFunctor,
+                                 bslma::Allocator  *basicAllocator = 0);
+    TimerWheelScheduler(const Dispatcher&            dispatcherFunctor,
+                        bsls::SystemClockType::Enum  clockType,
+                        bslma::Allocator            *basicAllocator = 0);
+    TimerWheelScheduler(const Dispatcher&            dispatcherFunctor,
+                        bsls::SystemClockType::Enum  clockType,
+                        const bsls::TimeInterval&    resolution,
+                        bslma::Allocator            *basicAllocator = 0);
+        // Construct a timer-wheel scheduler using the specified
+        // 'dispatcherFunctor' (see {'bdlmt_eventscheduler'|The Dispatcher
+        // Thread and the Dispatcher Functor}).  Optionally specify a
+        // 'clockType' indicating the epoch used for all time intervals; if
+        // 'clockType' is not specified, the realtime clock is used (see
+        // {Supported Clock-Types}).  Optionally specify a 'resolution' of the
+        // timing wheel, truncated to microseconds; if 'resolution' is not
+        // specified, 'k_DEFAULT_RESOLUTION_MICROSECONDS' is used.  Optionally
+        // specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless 'resolution' is at least one
+        // microsecond.
+
+    ~TimerWheelScheduler();
+        // Discard all unprocessed events and destroy this object.  The
+        // behavior is undefined unless the scheduler is stopped, and no
+        // references to events (raw or through handles) are outstanding.
+
+    // MANIPULATORS
+    void cancelAllEvents();
+        // Cancel all recurring and one-time events scheduled in this
+        // scheduler.
+
+    void cancelAllEventsAndWait();
+        // Cancel all recurring and one-time events scheduled in this
+        // scheduler.  Block until all events have either been canceled or
+        // dispatched before this call returns.  The behavior is undefined if
+        // this method is invoked from the dispatcher thread.
+
+    int cancelEvent(const Event          *handle);
+    int cancelEvent(const RecurringEvent *handle);
+        // Cancel the event having the specified 'handle'.  Return 0 on
+        // successful cancellation, and a non-zero value if the 'handle' is
+        // invalid *or* if the event has already been dispatched or canceled.
+        // Note that due to the implicit conversion from Handle types, these
+        // methods also match the following:
+        //..
+        //  int cancelEvent(const EventHandle&          handle);
+        //  int cancelEvent(const RecurringEventHandle& handle);
+        //..
+
+    int cancelEvent(EventHandle          *handle);
+    int cancelEvent(RecurringEventHandle *handle);
+        // Cancel the event having the specified 'handle' and release the
+        // handle.  Return 0 on successful cancellation, and a non-zero value
+        // if the 'handle' is invalid *or* if the event has already been
+        // dispatched or canceled.  Note that 'handle' is released whether this
+        // call is successful or not.
+
+    int cancelEventAndWait(const Event          *handle);
+    int cancelEventAndWait(const RecurringEvent *handle);
+        // Cancel the event having the specified 'handle'.  Block until the
+        // event having 'handle' (if it is valid) is either successfully
+        // canceled or dispatched before the call returns.  Return 0 on
+        // successful cancellation, and a non-zero value if 'handle' is invalid
+        // *or* if the event has already been dispatched or canceled.  The
+        // behavior is undefined if this method is invoked from the dispatcher
+        // thread.
+
+    int cancelEventAndWait(EventHandle          *handle);
+    int cancelEventAndWait(RecurringEventHandle *handle);
+        // Cancel the event having the specified 'handle' and release
+        // '*handle'.  Block until the event having 'handle' (if it is valid)
+        // is either successfully canceled or dispatched before the call
+        // returns.  Return 0 on successful cancellation, and a non-zero value
+        // if 'handle' is invalid *or* if the event has already been dispatched
+        // or canceled.  The behavior is undefined if this method is invoked
+        // from the dispatcher thread.  Note that '*handle' is released whether
+        // this call is successful or not.
+
+    void releaseEventRaw(Event          *handle);
+    void releaseEventRaw(RecurringEvent *handle);
+        // Release the specified 'handle'.  Every handle reference added by
+        // 'scheduleEventRaw', 'addEventRefRaw', 'scheduleRecurringEventRaw',
+        // or 'addRecurringEventRefRaw' must be released using this method to
+        // avoid leaking resources.  The behavior is undefined if the value of
+        // 'handle' is used for any purpose after being released.
+
+    int rescheduleEvent(const Event               *handle,
+                        const bsls::TimeInterval&  newEpochTime);
+        // Reschedule the event referred to by the specified 'handle' at the
+        // specified 'newEpochTime' truncated to microseconds.  Return 0 on
+        // successful reschedule, and a non-zero value if the 'handle' is
+        // invalid *or* if the event has already been dispatched or canceled.
+
+    int rescheduleEventAndWait(const Event               *handle,
+                               const bsls::TimeInterval&  newEpochTime);
+        // Reschedule the event referred to by the specified 'handle' at the
+        // specified 'newEpochTime' truncated to microseconds.  Block until the
+        // event having 'handle' (if it is valid) is either successfully
+        // rescheduled or dispatched before the call returns.  Return 0 on
+        // successful reschedule, and a non-zero value if 'handle' is invalid
+        // *or* if the event has already been dispatched or canceled.  The
+        // behavior is undefined if this method is invoked from the dispatcher
+        // thread.
+
+    void scheduleEvent(const bsls::TimeInterval&     epochTime,
+                       const bsl::function<void()>&  callback);
+    void scheduleEvent(EventHandle                  *event,
+                       const bsls::TimeInterval&     epochTime,
+                       const bsl::function<void()>&  callback);
+        // Schedule the specified 'callback' to be dispatched at the specified
+        // 'epochTime' truncated to microseconds.  Load into the optionally
+        // specified 'event' a handle that can be used to cancel the event (by
+        // invoking 'cancelEvent').  The 'epochTime' is an absolute time
+        // represented as an interval from the epoch of the clock indicated at
+        // construction.  Note that 'epochTime' may be in the past, in which
+        // case the event will be executed as soon as possible.
+
+    void scheduleEventRaw(Event                        **event,
+                          const bsls::TimeInterval&      epochTime,
+                          const bsl::function<void()>&   callback);
+        // Schedule the specified 'callback' to be dispatched at the specified
+        // 'epochTime' truncated to microseconds.  Load into the specified
+        // 'event' pointer a handle that can be used to cancel the event (by
+        // invoking 'cancelEvent').  The 'event' pointer must be released by
+        // invoking 'releaseEventRaw' when it is no longer needed.
+
+    void scheduleRecurringEvent(const bsls::TimeInterval&     interval,
+                                const bsl::function<void()>&  callback,
+                                const bsls::TimeInterval&     startEpochTime
+                                                      = bsls::TimeInterval(0));
+    void scheduleRecurringEvent(RecurringEventHandle         *event,
+                                const bsls::TimeInterval&     interval,
+                                const bsl::function<void()>&  callback,
+                                const bsls::TimeInterval&     startEpochTime
+                                                      = bsls::TimeInterval(0));
+        // Schedule a recurring event that invokes the specified 'callback' at
+        // every specified 'interval' truncated to microseconds, with the first
+        // event dispatched at the optionally specified 'startEpochTime'
+        // truncated to microseconds.  If 'startEpochTime' is not specified,
+        // the first event is dispatched at one 'interval' from now.  Load into
+        // the optionally specified 'event' a handle that can be used to cancel
+        // the event (by invoking 'cancelEvent').  The behavior is undefined
+        // unless 'interval' is at least one microsecond.
+
+    void scheduleRecurringEventRaw(
+                                  RecurringEvent               **event,
+                                  const bsls::TimeInterval&      interval,
+                                  const bsl::function<void()>&   callback,
+                                  const bsls::TimeInterval&      startEpochTime
+                                                      = bsls::TimeInterval(0));
+        // Schedule a recurring event that invokes the specified 'callback' at
+        // every specified 'interval' truncated to microseconds, with the first
+        // event dispatched at the optionally specified 'startEpochTime'
+        // truncated to microseconds.  If 'startEpochTime' is not specified,
+        // the first event is dispatched at one 'interval' from now.  Load into
+        // the specified 'event' pointer a handle that can be used to cancel
+        // the event (by invoking 'cancelEvent').  The 'event' pointer must be
+        // released by invoking 'releaseEventRaw' when it is no longer needed.
+        // The behavior is undefined unless 'interval' is at least one
+        // microsecond.
+
+    int start();
+    int start(const bslmt::ThreadAttributes& threadAttributes);
+        // Begin dispatching events on this scheduler using the optionally
+        // specified 'threadAttributes' for the dispatcher thread (except that
+        // the DETACHED attribute is ignored).  Return 0 on success, and a
+        // nonzero value otherwise.  If this scheduler has already started then
+        // this invocation has no effect and 0 is returned.  The behavior is
+        // undefined if this method is invoked in the dispatcher thread.  Note
+        // that any event whose time has already passed is pending and will be
+        // dispatched immediately.
+
+    void stop();
+        // End the dispatching of events on this scheduler (but do not remove
+        // any pending events), and wait for any (one) currently executing
+        // event to complete.  If the scheduler is already stopped then this
+        // method has no effect.  The behavior is undefined if this method is
+        // invoked from the dispatcher thread.
+
+    // ACCESSORS
+    Event *addEventRefRaw(Event *handle) const;
+        // Increment the reference count for the event referred to by the
+        // specified 'handle' and return 'handle'.  There must be a
+        // corresponding call to 'releaseEventRaw' when the reference is no
+        // longer needed.
+
+    RecurringEvent *addRecurringEventRefRaw(RecurringEvent *handle) const;
+        // Increment the reference count for the recurring event referred to by
+        // the specified 'handle' and return 'handle'.  There must be a
+        // corresponding call to 'releaseEventRaw' when the reference is no
+        // longer needed.
+
+    bsls::SystemClockType::Enum clockType() const;
+        // Return the value of the clock type that this object was created
+        // with.
+
+    bsls::TimeInterval now() const;
+        // Return the current epoch time, an absolute time represented as an
+        // interval from the epoch of the clock indicated at construction.
+
+    int numEvents() const;
+        // Return the number of pending one-time events in this scheduler.
+
+    int numRecurringEvents() const;
+        // Return the number of recurring events registered with this
+        // scheduler.
+
+    bsls::TimeInterval resolution() const;
+        // Return the resolution of the timing wheel of this scheduler.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this object to supply memory.
+};
+
+                    // ====================================
+                    // class TimerWheelSchedulerEventHandle
+                    // ====================================
+
+class TimerWheelSchedulerEventHandle {
+    // Objects of this type refer to events in the 'TimerWheelScheduler' API.
+    // They are convertible to 'const Event*' references and may be used in
+    // any method that expects them.
+
+    // DATA
+    TimerWheelScheduler_Node *d_node_p;  // referenced event (held), or 0
+
+    // FRIENDS
+    friend class TimerWheelScheduler;
+
+  public:
+    // PUBLIC TYPES
+    typedef TimerWheelScheduler::Event Event;
+
+    // CREATORS
+    TimerWheelSchedulerEventHandle();
+        // Create a new handle object that does not refer to an event.
+
+    TimerWheelSchedulerEventHandle(
+                              const TimerWheelSchedulerEventHandle& original);
+        // Create a new handle object referring to the same event as the
+        // specified 'original' handle.
+
+    ~TimerWheelSchedulerEventHandle();
+        // Destroy this object and release the managed reference, if any.
+
+    // MANIPULATORS
+    TimerWheelSchedulerEventHandle& operator=(
+                                    const TimerWheelSchedulerEventHandle& rhs);
+        // Release this handle's reference, if any; then make this handle refer
+        // to the same event as the specified 'rhs' handle.  Return a
+        // modifiable reference to this handle.
+
+    void release();
+        // Release the reference (if any) held by this object.
+
+    // ACCESSORS
+    operator const Event*() const;
+        // Return a "raw" pointer to the event managed by this handle, or 0 if
+        // this handle does not manage a reference.
+};
+
+               // =============================================
+               // class TimerWheelSchedulerRecurringEventHandle
+               // =============================================
+
+class TimerWheelSchedulerRecurringEventHandle {
+    // Objects of this type refer to recurring events in the
+    // 'TimerWheelScheduler' API.  They are convertible to
+    // 'const RecurringEvent*' references and may be used in any method which
+    // expects these.
+
+    // DATA
+    TimerWheelScheduler_Node *d_node_p;  // referenced event (held), or 0
+
+    // FRIENDS
+    friend class TimerWheelScheduler;
+
+  public:
+    // PUBLIC TYPES
+    typedef TimerWheelScheduler::RecurringEvent RecurringEvent;
+
+    // CREATORS
+    TimerWheelSchedulerRecurringEventHandle();
+        // Create a new handle object that does not refer to an event.
+
+    TimerWheelSchedulerRecurringEventHandle(
+                     const TimerWheelSchedulerRecurringEventHandle& original);
+        // Create a new handle object referring to the same recurring event as
+        // the specified 'original' handle.
+
+    ~TimerWheelSchedulerRecurringEventHandle();
+        // Destroy this object and release the managed reference, if any.
+
+    // MANIPULATORS
+    TimerWheelSchedulerRecurringEventHandle& operator=(
+                           const TimerWheelSchedulerRecurringEventHandle& rhs);
+        // Release the reference managed by this handle, if any; then make this
+        // handle refer to the same recurring event as the specified 'rhs'
+        // handle.  Return a modifiable reference to this handle.
+
+    void release();
+        // Release the reference managed by this handle, if any.
+
+    // ACCESSORS
+    operator const RecurringEvent*() const;
+        // Return a "raw" pointer to the recurring event managed by this
+        // handle, or 0 if this handle does not manage a reference.
+};
+
+                  // =======================================
+                  // class TimerWheelSchedulerTestTimeSource
+                  // =======================================
+
+class TimerWheelSchedulerTestTimeSource {
+    // This class provides a means to change the clock that is used by a given
+    // timer-wheel scheduler to determine when events should be triggered.
+    // After a test time-source is created, the underlying scheduler will run
+    // events according to a discrete timeline, whose successive values are
+    // determined by calls to 'advanceTime' on the test time-source, and can be
+    // retrieved by calling 'now' on that test time-source.
+
+    // DATA
+    bsl::shared_ptr<TimerWheelSchedulerTestTimeSource_Data>
+                         d_data_p;       // shared pointer to the state whose
+                                         // lifetime must be as long as
+                                         // '*this' and '*d_scheduler_p'
+
+    TimerWheelScheduler *d_scheduler_p;  // pointer to the scheduler that we
+                                         // are augmenting
+
+  public:
+    // CREATORS
+    explicit
+    TimerWheelSchedulerTestTimeSource(TimerWheelScheduler *scheduler);
+        // Construct a test time-source object that will control the
+        // "system-time" observed by the specified 'scheduler'.  Initialize
+        // 'now' to be an arbitrary time value.  The behavior is undefined if
+        // any methods have previously been called on 'scheduler'.
+
+    // MANIPULATORS
+    bsls::TimeInterval advanceTime(bsls::TimeInterval amount);
+        // Advance this object's current-time value by the specified 'amount'
+        // of time, notify the scheduler that the time has changed, and wait
+        // for the scheduler to process the events triggered by this change in
+        // time.  Return the updated current-time value.  The behavior is
+        // undefined unless 'amount' is positive, and 'now + amount' is within
+        // the range that can be represented with a 'bsls::TimeInterval'.
+
+    // ACCESSORS
+    bsls::TimeInterval now();
+        // Return this object's current-time value.  Upon construction, this
+        // method will return an arbitrary value.  Subsequent calls to
+        // 'advanceTime' will adjust the arbitrary value forward.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                         // -------------------------
+                         // class TimerWheelScheduler
+                         // -------------------------
+
+// PRIVATE CLASS METHODS
+inline
+TimerWheelScheduler::Node *TimerWheelScheduler::toNode(const void *handle)
+{
+    return static_cast<Node *>(const_cast<void *>(handle));
+}
+
+// MANIPULATORS
+inline
+void TimerWheelScheduler::releaseEventRaw(Event *handle)
+{
+    releaseNode(toNode(handle));
+}
+
+inline
+void TimerWheelScheduler::releaseEventRaw(RecurringEvent *handle)
+{
+    releaseNode(toNode(handle));
+}
+
+inline
+void TimerWheelScheduler::scheduleEvent(const bsls::TimeInterval&    epochTime,
+                                        const bsl::function<void()>& callback)
+{
+    scheduleEventRaw(0, epochTime, callback);
+}
+
+inline
+void TimerWheelScheduler::scheduleRecurringEvent(
+                                   const bsls::TimeInterval&    interval,
+                                   const bsl::function<void()>& callback,
+                                   const bsls::TimeInterval&    startEpochTime)
+{
+    scheduleRecurringEventRaw(0, interval, callback, startEpochTime);
+}
+
+// ACCESSORS
+inline
+TimerWheelScheduler::Event *
+TimerWheelScheduler::addEventRefRaw(Event *handle) const
+{
+    ++toNode(handle)->d_refCount;
+    return handle;
+}
+
+inline
+TimerWheelScheduler::RecurringEvent *
+TimerWheelScheduler::addRecurringEventRefRaw(RecurringEvent *handle) const
+{
+    ++toNode(handle)->d_refCount;
+    return handle;
+}
+
+inline
+bsls::SystemClockType::Enum TimerWheelScheduler::clockType() const
+{
+    return d_clockType;
+}
+
+inline
+bsls::TimeInterval TimerWheelScheduler::now() const
+{
+    return d_currentTimeFunctor();
+}
+
+inline
+int TimerWheelScheduler::numEvents() const
+{
+    return d_numEvents;
+}
+
+inline
+int TimerWheelScheduler::numRecurringEvents() const
+{
+    return d_numRecurringEvents;
+}
+
+inline
+bsls::TimeInterval TimerWheelScheduler::resolution() const
+{
+    bsls::TimeInterval result;
+    result.addMicroseconds(d_resolution);
+    return result;
+}
+
+                                  // Aspects
+
+inline
+bslma::Allocator *TimerWheelScheduler::allocator() const
+{
+    return d_nodePool.allocator();
+}
+
+                    // ------------------------------------
+                    // class TimerWheelSchedulerEventHandle
+                    // ------------------------------------
+
+// CREATORS
+inline
+TimerWheelSchedulerEventHandle::TimerWheelSchedulerEventHandle()
+: d_node_p(0)
+{
+}
+
+inline
+TimerWheelSchedulerEventHandle::TimerWheelSchedulerEventHandle(
+                                const TimerWheelSchedulerEventHandle& original)
+: d_node_p(original.d_node_p)
+{
+    if (d_node_p) {
+        ++d_node_p->d_refCount;
+    }
+}
+
+inline
+TimerWheelSchedulerEventHandle::~TimerWheelSchedulerEventHandle()
+{
+    release();
+}
+
+// MANIPULATORS
+inline
+TimerWheelSchedulerEventHandle&
+TimerWheelSchedulerEventHandle::operator=(
+                                     const TimerWheelSchedulerEventHandle& rhs)
+{
+    if (rhs.d_node_p) {
+        ++rhs.d_node_p->d_refCount;
+    }
+    release();
+    d_node_p = rhs.d_node_p;
+    return *this;
+}
+
+inline
+void TimerWheelSchedulerEventHandle::release()
+{
+    if (d_node_p) {
+        d_node_p->d_scheduler_p->releaseNode(d_node_p);
+        d_node_p = 0;
+    }
+}
+
+// ACCESSORS
+inline
+TimerWheelSchedulerEventHandle::operator const Event*() const
+{
+    return reinterpret_cast<const Event *>(
+                                     static_cast<const void *>(d_node_p));
+}
+
+               // ---------------------------------------------
+               // class TimerWheelSchedulerRecurringEventHandle
+               // ---------------------------------------------
+
+// CREATORS
+inline
+TimerWheelSchedulerRecurringEventHandle::
+                                     TimerWheelSchedulerRecurringEventHandle()
+: d_node_p(0)
+{
+}
+
+inline
+TimerWheelSchedulerRecurringEventHandle::
+TimerWheelSchedulerRecurringEventHandle(
+                       const TimerWheelSchedulerRecurringEventHandle& original)
+: d_node_p(original.d_node_p)
+{
+    if (d_node_p) {
+        ++d_node_p->d_refCount;
+    }
+}
+
+inline
+TimerWheelSchedulerRecurringEventHandle::
+                                    ~TimerWheelSchedulerRecurringEventHandle()
+{
+    release();
+}
+
+// MANIPULATORS
+inline
+TimerWheelSchedulerRecurringEventHandle&
+TimerWheelSchedulerRecurringEventHandle::operator=(
+                            const TimerWheelSchedulerRecurringEventHandle& rhs)
+{
+    if (rhs.d_node_p) {
+        ++rhs.d_node_p->d_refCount;
+    }
+    release();
+    d_node_p = rhs.d_node_p;
+    return *this;
+}
+
+inline
+void TimerWheelSchedulerRecurringEventHandle::release()
+{
+    if (d_node_p) {
+        d_node_p->d_scheduler_p->releaseNode(d_node_p);
+        d_node_p = 0;
+    }
+}
+
+// ACCESSORS
+inline
+TimerWheelSchedulerRecurringEventHandle::
+                                      operator const RecurringEvent*() const
+{
+    return reinterpret_cast<const RecurringEvent *>(
+                                     static_cast<const void *>(d_node_p));
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1214 @@
+// bdlmt_timerwheelscheduler.t.cpp                                    -*-C++-*-
+#include <bdlmt_timerwheelscheduler.h>
+
+#include <bdlmt_eventscheduler.h>
+
+#include <bdlf_bind.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_atomic.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_stopwatch.h>
+#include <bsls_systemtime.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_new.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+using bsl::flush;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test is a thread-safe event scheduler whose pending
+// events are kept in a hierarchical timing wheel.  Most test cases attach a
+// 'bdlmt::TimerWheelSchedulerTestTimeSource' to the scheduler so that the
+// passage of time is deterministic, and verify that events are dispatched
+// neither before their scheduled time nor later than one resolution after it,
+// across all the levels of the wheel.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 1] TimerWheelScheduler(Allocator *);
+// [ 7] TimerWheelScheduler(SystemClockType::Enum, Allocator *);
+// [ 3] TimerWheelScheduler(ClockType, const TimeInterval&, Allocator *);
+// [ 7] TimerWheelScheduler(const Dispatcher&, Allocator *);
+// [ 7] TimerWheelScheduler(const Dispatcher&, ClockType, Allocator *);
+// [ 7] TimerWheelScheduler(const Dispatcher&, ClockType, TI, Allocator *);
+// [ 2] ~TimerWheelScheduler();
+//
+// MANIPULATORS
+// [ 6] void cancelAllEvents();
+// [ 6] void cancelAllEventsAndWait();
+// [ 2] int cancelEvent(const Event *);
+// [ 4] int cancelEvent(const RecurringEvent *);
+// [ 2] int cancelEvent(EventHandle *);
+// [ 4] int cancelEvent(RecurringEventHandle *);
+// [ 4] int cancelEventAndWait(const Event *);
+// [ 4] int cancelEventAndWait(const RecurringEvent *);
+// [ 4] int cancelEventAndWait(EventHandle *);
+// [ 4] int cancelEventAndWait(RecurringEventHandle *);
+// [ 2] void releaseEventRaw(Event *);
+// [ 4] void releaseEventRaw(RecurringEvent *);
+// [ 5] int rescheduleEvent(const Event *, const TimeInterval&);
+// [ 5] int rescheduleEventAndWait(const Event *, const TimeInterval&);
+// [ 2] void scheduleEvent(const TimeInterval&, const function&);
+// [ 2] void scheduleEvent(EventHandle *, const TimeInterval&, function);
+// [ 2] void scheduleEventRaw(Event **, const TimeInterval&, function);
+// [ 4] void scheduleRecurringEvent(const TI&, const function&, const TI&);
+// [ 4] void scheduleRecurringEvent(RecurringEventHandle *, TI, function, TI);
+// [ 4] void scheduleRecurringEventRaw(RecurringEvent **, TI, function, TI);
+// [ 1] int start();
+// [ 1] void stop();
+//
+// ACCESSORS
+// [ 2] Event *addEventRefRaw(Event *) const;
+// [ 4] RecurringEvent *addRecurringEventRefRaw(RecurringEvent *) const;
+// [ 7] bsls::SystemClockType::Enum clockType() const;
+// [ 1] bsls::TimeInterval now() const;
+// [ 2] int numEvents() const;
+// [ 4] int numRecurringEvents() const;
+// [ 3] bsls::TimeInterval resolution() const;
+// [ 1] bslma::Allocator *allocator() const;
+//
+// TimerWheelSchedulerTestTimeSource
+// [ 1] TimerWheelSchedulerTestTimeSource(TimerWheelScheduler *);
+// [ 1] bsls::TimeInterval advanceTime(bsls::TimeInterval);
+// [ 1] bsls::TimeInterval now();
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] CONCERN: EVENTS ARE CASCADED THROUGH ALL LEVELS OF THE WHEEL
+// [ 6] CONCERN: LARGE NUMBERS OF EVENTS
+// [ 8] USAGE EXAMPLE
+// [-1] PERFORMANCE: SCHEDULE/CANCEL THROUGHPUT VS. 'bdlmt::EventScheduler'
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                GLOBAL TYPEDEFS/CONSTANTS/VARIABLES FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlmt::TimerWheelScheduler                     Obj;
+typedef bdlmt::TimerWheelSchedulerTestTimeSource       TestTimeSource;
+typedef bdlmt::TimerWheelSchedulerEventHandle          EventHandle;
+typedef bdlmt::TimerWheelSchedulerRecurringEventHandle RecurringEventHandle;
+typedef Obj::Event                                     Event;
+typedef Obj::RecurringEvent                            RecurringEvent;
+typedef bsls::TimeInterval                             TimeInterval;
+typedef bsls::Types::Int64                             Int64;
+
+int                 test;
+bool             verbose;
+bool         veryVerbose;
+bool     veryVeryVerbose;
+bool veryVeryVeryVerbose;
+
+namespace {
+namespace u {
+
+                              // ==============
+                              // struct Recorder
+                              // ==============
+
+struct Recorder {
+    // This 'struct' records the times, as observed by a scheduler, at which
+    // tagged callbacks are invoked.
+
+    // DATA
+    bslmt::Mutex       d_mutex;
+    bsl::vector<int>   d_tags;
+    bsl::vector<Int64> d_times;
+    Obj               *d_scheduler_p;
+
+    // CREATORS
+    explicit Recorder(Obj *scheduler, bslma::Allocator *basicAllocator)
+    : d_tags(basicAllocator)
+    , d_times(basicAllocator)
+    , d_scheduler_p(scheduler)
+    {
+    }
+
+    // MANIPULATORS
+    void record(int tag)
+        // Record the specified 'tag' along with the current time of the
+        // scheduler.
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+        d_tags.push_back(tag);
+        d_times.push_back(d_scheduler_p->now().totalMicroseconds());
+    }
+
+    int count()
+        // Return the number of recorded callbacks.
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+        return static_cast<int>(d_tags.size());
+    }
+};
+
+void increment(bsls::AtomicInt *counter)
+    // Increment the specified 'counter'.
+{
+    ++*counter;
+}
+
+void sleepAndIncrement(bsls::AtomicInt *counter, int microseconds)
+    // Sleep for the specified 'microseconds', then increment the specified
+    // 'counter'.
+{
+    bslmt::ThreadUtil::microSleep(microseconds);
+    ++*counter;
+}
+
+void noop()
+    // Do nothing.
+{
+}
+
+void alignOnTick(TestTimeSource *timeSource, const Obj& scheduler)
+    // Advance the specified 'timeSource' to the next multiple of the
+    // resolution of the specified 'scheduler', unless the current time of
+    // 'scheduler' already is such a multiple.
+{
+    const Int64 res  = scheduler.resolution().totalMicroseconds();
+    const Int64 frac = scheduler.now().totalMicroseconds() % res;
+    if (frac) {
+        TimeInterval amount;
+        amount.addMicroseconds(res - frac);
+        timeSource->advanceTime(amount);
+    }
+}
+
+void countingDispatcher(bsls::AtomicInt              *counter,
+                        const bsl::function<void()>&  callback)
+    // Increment the specified 'counter' and invoke the specified 'callback'.
+{
+    ++*counter;
+    callback();
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace {
+namespace Case_Usage {
+
+struct my_Connection {
+    bdlmt::TimerWheelSchedulerEventHandle d_timeout;   // pending timeout
+    bool                                  d_isClosed;  // set on timeout
+};
+
+void closeConnection(my_Connection *connection)
+    // Close the specified 'connection'.
+{
+    connection->d_isClosed = true;
+}
+
+}  // close namespace Case_Usage
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    test                = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    verbose             = argc > 2;
+    veryVerbose         = argc > 3;
+    veryVeryVerbose     = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
+
+    bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+    switch (test) { case 0:
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "USAGE EXAMPLE\n"
+                             "=============\n";
+
+        using namespace Case_Usage;
+
+        // The test time source uses the default allocator.
+
+        bslma::DefaultAllocatorGuard guard(&ta);
+
+        bdlmt::TimerWheelScheduler scheduler(
+                                           bsls::SystemClockType::e_MONOTONIC,
+                                           &ta);
+        bdlmt::TimerWheelSchedulerTestTimeSource timeSource(&scheduler);
+
+        const bsls::TimeInterval timeout(5.0);
+
+        my_Connection connection;
+        connection.d_isClosed = false;
+
+        scheduler.scheduleEvent(&connection.d_timeout,
+                                scheduler.now() + timeout,
+                                bdlf::BindUtil::bind(&closeConnection,
+                                                     &connection));
+        scheduler.start();
+
+        timeSource.advanceTime(bsls::TimeInterval(4.0));
+
+        ASSERT(0 == scheduler.cancelEvent(&connection.d_timeout));
+        scheduler.scheduleEvent(&connection.d_timeout,
+                                scheduler.now() + timeout,
+                                bdlf::BindUtil::bind(&closeConnection,
+                                                     &connection));
+
+        timeSource.advanceTime(bsls::TimeInterval(4.0));
+        ASSERT(!connection.d_isClosed);
+
+        timeSource.advanceTime(bsls::TimeInterval(2.0));
+        ASSERT(connection.d_isClosed);
+
+        scheduler.stop();
+        connection.d_timeout.release();
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // SYSTEM CLOCK AND DISPATCHER FUNCTOR
+        //
+        // Concerns:
+        //: 1 Without a test time source, events are dispatched according to
+        //:   the system clock indicated at construction, never before their
+        //:   scheduled time.
+        //:
+        //: 2 A user-supplied dispatcher functor is invoked for every event.
+        //:
+        //: 3 'clockType' returns the clock type supplied at construction.
+        //
+        // Plan:
+        //: 1 For each constructor, schedule a few events a few milliseconds
+        //:   in the future, start the scheduler and wait for them to be
+        //:   dispatched.  Verify the observed dispatch times and dispatch
+        //:   count.  (C-1..3)
+        //
+        // Testing:
+        //   TimerWheelScheduler(SystemClockType::Enum, Allocator *);
+        //   TimerWheelScheduler(const Dispatcher&, Allocator *);
+        //   TimerWheelScheduler(const Dispatcher&, ClockType, Allocator *);
+        //   TimerWheelScheduler(const Dispatcher&, ClockType, TI, Alloc *);
+        //   bsls::SystemClockType::Enum clockType() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "SYSTEM CLOCK AND DISPATCHER FUNCTOR\n"
+                             "===================================\n";
+
+        const bsls::SystemClockType::Enum MONO =
+                                            bsls::SystemClockType::e_MONOTONIC;
+        const bsls::SystemClockType::Enum REAL =
+                                             bsls::SystemClockType::e_REALTIME;
+
+        for (int ti = 0; ti < 4; ++ti) {
+            bsls::AtomicInt numDispatched(0);
+
+            Obj::Dispatcher dispatcher(
+                             bdlf::BindUtil::bind(&u::countingDispatcher,
+                                                  &numDispatched,
+                                                  bdlf::PlaceHolders::_1));
+
+            bsls::ObjectBuffer<Obj> buffer;
+            bsls::SystemClockType::Enum expClock = REAL;
+            switch (ti) {
+              case 0: {
+                new (buffer.buffer()) Obj(MONO, &ta);
+                expClock = MONO;
+              } break;
+              case 1: {
+                new (buffer.buffer()) Obj(dispatcher, &ta);
+              } break;
+              case 2: {
+                new (buffer.buffer()) Obj(dispatcher, MONO, &ta);
+                expClock = MONO;
+              } break;
+              case 3: {
+                new (buffer.buffer()) Obj(dispatcher,
+                                          REAL,
+                                          TimeInterval(0, 100 * 1000),
+                                          &ta);
+              } break;
+            }
+            Obj& mX = buffer.object();
+            ASSERTV(ti, expClock == mX.clockType());
+
+            u::Recorder recorder(&mX, &ta);
+
+            const TimeInterval T = mX.now();
+            for (int i = 0; i < 4; ++i) {
+                mX.scheduleEvent(T + TimeInterval(0, (i + 1) * 5000 * 1000),
+                                 bdlf::BindUtil::bind(&u::Recorder::record,
+                                                      &recorder,
+                                                      i));
+            }
+            ASSERT(0 == mX.start());
+
+            bsls::Stopwatch sw;
+            sw.start();
+            while (4 != recorder.count() && sw.accumulatedWallTime() < 5.0) {
+                bslmt::ThreadUtil::microSleep(1000);
+            }
+            mX.stop();
+
+            ASSERTV(ti, recorder.count(), 4 == recorder.count());
+            for (int i = 0; i < recorder.count(); ++i) {
+                const Int64 expT = T.totalMicroseconds()
+                                             + (recorder.d_tags[i] + 1) * 5000;
+                ASSERTV(ti, i, expT <= recorder.d_times[i]);
+            }
+            if (0 != ti) {
+                ASSERTV(ti, numDispatched, 4 == numDispatched);
+            }
+            mX.~Obj();
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // LARGE NUMBERS OF EVENTS AND CANCEL ALL
+        //
+        // Concerns:
+        //: 1 A large number of events, most of which are canceled before they
+        //:   expire, can be managed, and exactly the events that were not
+        //:   canceled are dispatched.
+        //:
+        //: 2 'cancelAllEvents' and 'cancelAllEventsAndWait' cancel all pending
+        //:   one-time and recurring events.
+        //:
+        //: 3 No memory is leaked.
+        //
+        // Plan:
+        //: 1 Schedule 100,000 events spread over 10 minutes, cancel every
+        //:   event whose index is not a multiple of 10, and advance time past
+        //:   all events.  Verify the dispatch count.  (C-1)
+        //:
+        //: 2 Schedule one-time and recurring events, cancel them all and
+        //:   verify that the counts are 0 and nothing is dispatched.  (C-2)
+        //:
+        //: 3 Use a test allocator.  (C-3)
+        //
+        // Testing:
+        //   void cancelAllEvents();
+        //   void cancelAllEventsAndWait();
+        //   CONCERN: LARGE NUMBERS OF EVENTS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "LARGE NUMBERS OF EVENTS AND CANCEL ALL\n"
+                             "======================================\n";
+
+        bslma::DefaultAllocatorGuard guard(&ta);
+
+        {
+            const int NUM_EVENTS = 100 * 1000;
+
+            Obj            mX(&ta);
+            TestTimeSource timeSource(&mX);
+            bsls::AtomicInt numDispatched(0);
+
+            const TimeInterval T = mX.now();
+
+            bsl::vector<EventHandle> handles(NUM_EVENTS, &ta);
+            for (int i = 0; i < NUM_EVENTS; ++i) {
+                mX.scheduleEvent(&handles[i],
+                                 T + TimeInterval(0, (i % 600000) * 6000),
+                                 bdlf::BindUtil::bind(&u::increment,
+                                                      &numDispatched));
+            }
+            ASSERT(NUM_EVENTS == mX.numEvents());
+
+            for (int i = 0; i < NUM_EVENTS; ++i) {
+                if (i % 10) {
+                    ASSERTV(i, 0 == mX.cancelEvent(&handles[i]));
+                }
+            }
+            ASSERT(NUM_EVENTS / 10 == mX.numEvents());
+
+            mX.start();
+            for (int i = 0; i < 11; ++i) {
+                timeSource.advanceTime(TimeInterval(60.0));
+            }
+            mX.stop();
+
+            ASSERTV(numDispatched, NUM_EVENTS / 10 == numDispatched);
+            ASSERT(0 == mX.numEvents());
+        }
+
+        {
+            Obj             mX(&ta);
+            TestTimeSource  timeSource(&mX);
+            bsls::AtomicInt numDispatched(0);
+
+            const TimeInterval T = mX.now();
+
+            EventHandle          h1;
+            RecurringEventHandle h2;
+            for (int i = 0; i < 100; ++i) {
+                mX.scheduleEvent(T + TimeInterval(i),
+                                 bdlf::BindUtil::bind(&u::increment,
+                                                      &numDispatched));
+                mX.scheduleRecurringEvent(TimeInterval(i + 1),
+                                          bdlf::BindUtil::bind(
+                                                             &u::increment,
+                                                             &numDispatched));
+            }
+            mX.scheduleEvent(&h1, T + TimeInterval(1.0), &u::noop);
+            mX.scheduleRecurringEvent(&h2, TimeInterval(1.0), &u::noop);
+            ASSERT(101 == mX.numEvents());
+            ASSERT(101 == mX.numRecurringEvents());
+
+            mX.cancelAllEvents();
+            ASSERT(0 == mX.numEvents());
+            ASSERT(0 == mX.numRecurringEvents());
+            ASSERT(0 != mX.cancelEvent(h1));
+            ASSERT(0 != mX.cancelEvent(h2));
+
+            mX.start();
+            timeSource.advanceTime(TimeInterval(200.0));
+
+            ASSERT(0 == numDispatched);
+
+            mX.scheduleRecurringEvent(TimeInterval(0, 1000 * 1000),
+                                      bdlf::BindUtil::bind(&u::increment,
+                                                           &numDispatched));
+            timeSource.advanceTime(TimeInterval(0, 5000 * 1000));
+            mX.cancelAllEventsAndWait();
+            const int numAfterCancel = numDispatched;
+            ASSERTV(numAfterCancel, 0 < numAfterCancel);
+            timeSource.advanceTime(TimeInterval(1.0));
+            ASSERT(numAfterCancel == numDispatched);
+            mX.stop();
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // RESCHEDULE
+        //
+        // Concerns:
+        //: 1 A pending event can be rescheduled earlier or later, in any
+        //:   level of the wheel, and is then dispatched at its new time only.
+        //:
+        //: 2 Rescheduling a dispatched or canceled event fails.
+        //
+        // Plan:
+        //: 1 Using a test time source, schedule events, reschedule them, and
+        //:   verify the dispatch times.  (C-1..2)
+        //
+        // Testing:
+        //   int rescheduleEvent(const Event *, const TimeInterval&);
+        //   int rescheduleEventAndWait(const Event *, const TimeInterval&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "RESCHEDULE\n"
+                             "==========\n";
+
+        bslma::DefaultAllocatorGuard guard(&ta);
+
+        Obj            mX(&ta);
+        TestTimeSource timeSource(&mX);
+        u::Recorder    recorder(&mX, &ta);
+
+        const TimeInterval T  = mX.now();
+        const Int64        TU = T.totalMicroseconds();
+
+        EventHandle h1, h2, h3;
+        mX.scheduleEvent(&h1, T + TimeInterval(10.0),
+                         bdlf::BindUtil::bind(&u::Recorder::record,
+                                              &recorder, 1));
+        mX.scheduleEvent(&h2, T + TimeInterval(1.0),
+                         bdlf::BindUtil::bind(&u::Recorder::record,
+                                              &recorder, 2));
+        mX.scheduleEvent(&h3, T + TimeInterval(3600.0),
+                         bdlf::BindUtil::bind(&u::Recorder::record,
+                                              &recorder, 3));
+
+        ASSERT(0 == mX.rescheduleEvent(h1, T + TimeInterval(2.0)));
+        ASSERT(0 == mX.rescheduleEvent(h2, T + TimeInterval(5000.0)));
+        ASSERT(0 == mX.rescheduleEventAndWait(h3, T + TimeInterval(0.5)));
+        ASSERT(3 == mX.numEvents());
+
+        mX.start();
+        timeSource.advanceTime(TimeInterval(3.0));
+
+        ASSERTV(recorder.count(), 2 == recorder.count());
+        if (2 == recorder.count()) {
+            ASSERT(3 == recorder.d_tags[0]);
+            ASSERT(1 == recorder.d_tags[1]);
+            ASSERT(TU + 3000000 == recorder.d_times[1]);
+        }
+
+        ASSERT(0 != mX.rescheduleEvent(h1, T + TimeInterval(4.0)));
+        ASSERT(0 != mX.rescheduleEventAndWait(h3, T + TimeInterval(4.0)));
+
+        ASSERT(0 == mX.cancelEvent(h2));
+        ASSERT(0 != mX.rescheduleEvent(h2, T + TimeInterval(4.0)));
+
+        timeSource.advanceTime(TimeInterval(6000.0));
+        ASSERTV(recorder.count(), 2 == recorder.count());
+        ASSERT(0 == mX.numEvents());
+
+        mX.stop();
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // RECURRING EVENTS
+        //
+        // Concerns:
+        //: 1 A recurring event is dispatched once per interval, starting at
+        //:   the specified start time or one interval from now.
+        //:
+        //: 2 A recurring event can be canceled, which stops further
+        //:   dispatches; canceling again fails.
+        //:
+        //: 3 'cancelEventAndWait' waits for a recurring event being executed.
+        //:
+        //: 4 References to recurring events are correctly counted.
+        //
+        // Plan:
+        //: 1 Using a test time source, schedule recurring events through
+        //:   every method, advance time, and verify the dispatch counts.
+        //:   (C-1..2, 4)
+        //:
+        //: 2 Using the system clock, schedule a recurring event whose callback
+        //:   sleeps, cancel it with 'cancelEventAndWait' and verify no
+        //:   callback executes afterwards.  (C-3)
+        //
+        // Testing:
+        //   int cancelEvent(const RecurringEvent *);
+        //   int cancelEvent(RecurringEventHandle *);
+        //   int cancelEventAndWait(const Event *);
+        //   int cancelEventAndWait(const RecurringEvent *);
+        //   int cancelEventAndWait(EventHandle *);
+        //   int cancelEventAndWait(RecurringEventHandle *);
+        //   void releaseEventRaw(RecurringEvent *);
+        //   void scheduleRecurringEvent(const TI&, const func&, const TI&);
+        //   void scheduleRecurringEvent(RecurringEventHandle *, TI, fn, TI);
+        //   void scheduleRecurringEventRaw(RecurringEvent **, TI, fn, TI);
+        //   RecurringEvent *addRecurringEventRefRaw(RecurringEvent *) const;
+        //   int numRecurringEvents() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "RECURRING EVENTS\n"
+                             "================\n";
+
+        {
+            bslma::DefaultAllocatorGuard guard(&ta);
+
+            Obj             mX(&ta);
+            TestTimeSource  timeSource(&mX);
+            bsls::AtomicInt c1(0), c2(0), c3(0);
+
+            u::alignOnTick(&timeSource, mX);
+
+            const TimeInterval T = mX.now();
+
+            RecurringEventHandle  h1;
+            RecurringEvent       *r2 = 0;
+
+            mX.scheduleRecurringEvent(TimeInterval(1.0),
+                                      bdlf::BindUtil::bind(&u::increment,
+                                                           &c3));
+            mX.scheduleRecurringEvent(&h1,
+                                      TimeInterval(2.0),
+                                      bdlf::BindUtil::bind(&u::increment,
+                                                           &c1),
+                                      T + TimeInterval(0.5));
+            mX.scheduleRecurringEventRaw(&r2,
+                                         TimeInterval(0, 10 * 1000 * 1000),
+                                         bdlf::BindUtil::bind(&u::increment,
+                                                              &c2));
+            ASSERT(3 == mX.numRecurringEvents());
+            ASSERT(0 == mX.numEvents());
+
+            RecurringEvent *r2Copy = mX.addRecurringEventRefRaw(r2);
+            ASSERT(r2Copy == r2);
+
+            mX.start();
+            for (int i = 0; i < 10; ++i) {
+                timeSource.advanceTime(TimeInterval(1.0));
+            }
+
+            ASSERTV(c1, 5 == c1);
+            ASSERTV(c2, 1000 == c2);
+            ASSERTV(c3, 10 == c3);
+
+            ASSERT(0 == mX.cancelEvent(r2));
+            ASSERT(0 != mX.cancelEvent(r2Copy));
+            mX.releaseEventRaw(r2);
+            mX.releaseEventRaw(r2Copy);
+            ASSERT(2 == mX.numRecurringEvents());
+
+            RecurringEventHandle h1Copy(h1);
+            ASSERT(0 == mX.cancelEventAndWait(&h1));
+            ASSERT(0 == static_cast<const RecurringEvent *>(h1));
+            ASSERT(0 != mX.cancelEvent(&h1Copy));
+            ASSERT(0 == static_cast<const RecurringEvent *>(h1Copy));
+            ASSERT(0 != mX.cancelEvent(&h1Copy));
+
+            for (int i = 0; i < 10; ++i) {
+                timeSource.advanceTime(TimeInterval(1.0));
+            }
+            ASSERTV(c1, 5 == c1);
+            ASSERTV(c2, 1000 == c2);
+            ASSERTV(c3, 20 == c3);
+            ASSERT(1 == mX.numRecurringEvents());
+
+            mX.stop();
+        }
+        {
+            Obj             mX(bsls::SystemClockType::e_MONOTONIC, &ta);
+            bsls::AtomicInt counter(0);
+
+            RecurringEventHandle h;
+            mX.scheduleRecurringEvent(&h,
+                                      TimeInterval(0, 1000),
+                                      bdlf::BindUtil::bind(
+                                                         &u::sleepAndIncrement,
+                                                         &counter,
+                                                         20 * 1000));
+            mX.start();
+            while (0 == counter) {
+                bslmt::ThreadUtil::microSleep(1000);
+            }
+            ASSERT(0 == mX.cancelEventAndWait(&h));
+            const int numAfterCancel = counter;
+            bslmt::ThreadUtil::microSleep(50 * 1000);
+            ASSERTV(numAfterCancel, counter, numAfterCancel == counter);
+
+            EventHandle e;
+            mX.scheduleEvent(&e,
+                             mX.now(),
+                             bdlf::BindUtil::bind(&u::sleepAndIncrement,
+                                                  &counter,
+                                                  20 * 1000));
+            bslmt::ThreadUtil::microSleep(10 * 1000);
+            ASSERT(0 != mX.cancelEventAndWait(&e));
+            ASSERTV(numAfterCancel, counter, numAfterCancel + 1 == counter);
+
+            const Event *nullEvent = 0;
+            ASSERT(0 != mX.cancelEventAndWait(nullEvent));
+            ASSERT(0 != mX.cancelEventAndWait(&e));
+
+            mX.stop();
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // WHEEL LEVELS
+        //
+        // Concerns:
+        //: 1 Events filed in any level of the wheel, including events beyond
+        //:   the span of the wheel, are dispatched no earlier than their
+        //:   scheduled time and no later than one resolution after it.
+        //:
+        //: 2 Events whose rounded expiry times differ are dispatched in time
+        //:   order.
+        //:
+        //: 3 Events scheduled in the past are dispatched immediately.
+        //:
+        //: 4 'resolution' returns the resolution supplied at construction.
+        //
+        // Plan:
+        //: 1 Create a scheduler having a resolution of 1 microsecond, so that
+        //:   the wheel spans a little more than one hour, and schedule events
+        //:   at offsets on either side of every level boundary and beyond the
+        //:   span.  Advance a test time source in uneven steps and verify the
+        //:   dispatch times and order.  (C-1..2)
+        //:
+        //: 2 Repeat with a resolution of 1 millisecond, and verify that events
+        //:   are dispatched at the first tick not earlier than their time.
+        //:   (C-1, 4)
+        //:
+        //: 3 Schedule an event in the past and verify that it is dispatched
+        //:   by the next advance.  (C-3)
+        //
+        // Testing:
+        //   TimerWheelScheduler(ClockType, const TimeInterval&, Allocator *);
+        //   bsls::TimeInterval resolution() const;
+        //   CONCERN: EVENTS ARE CASCADED THROUGH ALL LEVELS OF THE WHEEL
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "WHEEL LEVELS\n"
+                             "============\n";
+
+        bslma::DefaultAllocatorGuard guard(&ta);
+
+        static const Int64 OFFSETS[] = {
+            1, 2, 255, 256, 257, 511, 512, 16383, 16384, 16385,
+            1000000, 1048575, 1048576, 1048577, 67108863, 67108864, 67108865,
+            4294967295LL, 4294967296LL, 4294967297LL, 10000000000LL
+        };
+        const int NUM_OFFSETS = sizeof OFFSETS / sizeof *OFFSETS;
+
+        for (int ri = 0; ri < 2; ++ri) {
+            const Int64 RES = 0 == ri ? 1 : 1000;
+
+            if (veryVerbose) { T_ P(RES) }
+
+            Obj mX(bsls::SystemClockType::e_REALTIME,
+                   TimeInterval(0, static_cast<int>(RES * 1000)),
+                   &ta);
+            ASSERT(TimeInterval(0, static_cast<int>(RES * 1000)) ==
+                                                              mX.resolution());
+
+            TestTimeSource timeSource(&mX);
+            u::Recorder    recorder(&mX, &ta);
+
+            const Int64 T0 = mX.now().totalMicroseconds();
+
+            for (int i = NUM_OFFSETS - 1; i >= 0; --i) {
+                TimeInterval t;
+                t.addMicroseconds(T0 + OFFSETS[i] * RES);
+                mX.scheduleEvent(t, bdlf::BindUtil::bind(&u::Recorder::record,
+                                                         &recorder,
+                                                         i));
+            }
+            ASSERT(NUM_OFFSETS == mX.numEvents());
+
+            mX.start();
+
+            // Advance in uneven steps so that both single ticks and large
+            // jumps are exercised.
+
+            Int64 elapsed = 0;
+            Int64 step    = 1;
+            while (elapsed < OFFSETS[NUM_OFFSETS - 1] * RES + 10 * RES) {
+                TimeInterval s;
+                s.addMicroseconds(step);
+                timeSource.advanceTime(s);
+                elapsed += step;
+                step = step * 3 + 1;
+                if (step > 1000000000LL * RES) {
+                    step = 1000000000LL * RES;
+                }
+            }
+
+            mX.stop();
+
+            ASSERTV(RES, recorder.count(), NUM_OFFSETS == recorder.count());
+            for (int i = 0; i < recorder.count(); ++i) {
+                const int   TAG    = recorder.d_tags[i];
+                const Int64 TIME   = recorder.d_times[i];
+                const Int64 EXPECT = T0 + OFFSETS[TAG] * RES;
+
+                ASSERTV(RES, i, TAG, i == TAG);
+                ASSERTV(RES, TAG, TIME, EXPECT, EXPECT <= TIME);
+            }
+            ASSERT(0 == mX.numEvents());
+        }
+
+        {
+            // Dispatch at the first tick not earlier than the event.
+
+            Obj mX(bsls::SystemClockType::e_REALTIME,
+                   TimeInterval(0, 1000 * 1000),
+                   &ta);
+            TestTimeSource timeSource(&mX);
+            u::Recorder    recorder(&mX, &ta);
+
+            u::alignOnTick(&timeSource, mX);
+
+            const TimeInterval T = mX.now();
+
+            mX.scheduleEvent(T + TimeInterval(0, 500 * 1000),
+                             bdlf::BindUtil::bind(&u::Recorder::record,
+                                                  &recorder,
+                                                  0));
+            mX.start();
+
+            timeSource.advanceTime(TimeInterval(0, 400 * 1000));
+            ASSERT(0 == recorder.count());
+            timeSource.advanceTime(TimeInterval(0, 200 * 1000));
+            ASSERT(0 == recorder.count());
+            timeSource.advanceTime(TimeInterval(0, 300 * 1000));
+            ASSERT(0 == recorder.count());
+            timeSource.advanceTime(TimeInterval(0, 100 * 1000));
+            ASSERT(1 == recorder.count());
+
+            // Event in the past.
+
+            mX.scheduleEvent(T,
+                             bdlf::BindUtil::bind(&u::Recorder::record,
+                                                  &recorder,
+                                                  1));
+            timeSource.advanceTime(TimeInterval(0, 1000));
+            ASSERT(2 == recorder.count());
+
+            mX.stop();
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // ONE-TIME EVENTS AND HANDLES
+        //
+        // Concerns:
+        //: 1 One-time events can be scheduled through every method, and
+        //:   'numEvents' reflects the number of pending events.
+        //:
+        //: 2 A pending event can be canceled exactly once; canceling a
+        //:   dispatched event or a null handle fails.
+        //:
+        //: 3 Handles manage references correctly when copied, assigned and
+        //:   released, and canceling through a handle pointer releases it.
+        //:
+        //: 4 Destroying the scheduler releases all pending events.
+        //
+        // Plan:
+        //: 1 Using a test time source and a test allocator, schedule events,
+        //:   cancel some, and verify dispatches and return values.
+        //:   (C-1..4)
+        //
+        // Testing:
+        //   ~TimerWheelScheduler();
+        //   int cancelEvent(const Event *);
+        //   int cancelEvent(EventHandle *);
+        //   void releaseEventRaw(Event *);
+        //   void scheduleEvent(const TimeInterval&, const function&);
+        //   void scheduleEvent(EventHandle *, const TimeInterval&, function);
+        //   void scheduleEventRaw(Event **, const TimeInterval&, function);
+        //   Event *addEventRefRaw(Event *) const;
+        //   int numEvents() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "ONE-TIME EVENTS AND HANDLES\n"
+                             "===========================\n";
+
+        bslma::DefaultAllocatorGuard guard(&ta);
+
+        {
+            Obj             mX(&ta);
+            TestTimeSource  timeSource(&mX);
+            bsls::AtomicInt counter(0);
+
+            const TimeInterval T = mX.now();
+
+            const bsl::function<void()> INC =
+                             bdlf::BindUtil::bind(&u::increment, &counter);
+
+            EventHandle  h1, h2;
+            Event       *r3 = 0;
+
+            mX.scheduleEvent(T + TimeInterval(1.0), INC);
+            mX.scheduleEvent(&h1, T + TimeInterval(2.0), INC);
+            mX.scheduleEvent(&h2, T + TimeInterval(3.0), INC);
+            mX.scheduleEventRaw(&r3, T + TimeInterval(4.0), INC);
+            ASSERT(0 != r3);
+            ASSERT(4 == mX.numEvents());
+
+            Event *r3Copy = mX.addEventRefRaw(r3);
+            ASSERT(r3Copy == r3);
+
+            EventHandle h2Copy(h2);
+            EventHandle h2Assigned;
+            h2Assigned = h2Copy;
+            ASSERT(static_cast<const Event *>(h2) ==
+                                      static_cast<const Event *>(h2Assigned));
+
+            ASSERT(0 == mX.cancelEvent(&h2Copy));
+            ASSERT(0 == static_cast<const Event *>(h2Copy));
+            ASSERT(0 != mX.cancelEvent(h2));
+            ASSERT(0 != mX.cancelEvent(h2Assigned));
+            ASSERT(0 != mX.cancelEvent(&h2Copy));
+            ASSERT(3 == mX.numEvents());
+
+            const Event *nullEvent = 0;
+            ASSERT(0 != mX.cancelEvent(nullEvent));
+
+            mX.start();
+            timeSource.advanceTime(TimeInterval(2.5));
+            ASSERTV(counter, 2 == counter);
+            ASSERT(1 == mX.numEvents());
+
+            ASSERT(0 != mX.cancelEvent(h1));
+            ASSERT(0 == mX.cancelEvent(r3));
+            ASSERT(0 != mX.cancelEvent(r3Copy));
+            ASSERT(0 == mX.numEvents());
+
+            mX.releaseEventRaw(r3);
+            mX.releaseEventRaw(r3Copy);
+
+            timeSource.advanceTime(TimeInterval(5.0));
+            ASSERTV(counter, 2 == counter);
+
+            h1.release();
+            h1.release();
+            ASSERT(0 == static_cast<const Event *>(h1));
+
+            mX.stop();
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        {
+            // Pending events are released on destruction.
+
+            Obj mX(&ta);
+            for (int i = 0; i < 1000; ++i) {
+                mX.scheduleEvent(mX.now() + TimeInterval(i), &u::noop);
+            }
+            ASSERT(1000 == mX.numEvents());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a scheduler, attach a test time source, schedule a few
+        //:   events and verify that they are dispatched as time advances.
+        //
+        // Testing:
+        //   BREATHING TEST
+        //   TimerWheelScheduler(Allocator *);
+        //   int start();
+        //   void stop();
+        //   bsls::TimeInterval now() const;
+        //   bslma::Allocator *allocator() const;
+        //   TimerWheelSchedulerTestTimeSource(TimerWheelScheduler *);
+        //   bsls::TimeInterval advanceTime(bsls::TimeInterval);
+        //   bsls::TimeInterval now();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "BREATHING TEST\n"
+                             "==============\n";
+
+        bslma::DefaultAllocatorGuard guard(&ta);
+
+        Obj mX(&ta);
+        ASSERT(&ta == mX.allocator());
+
+        TestTimeSource timeSource(&mX);
+        ASSERT(timeSource.now() == mX.now());
+
+        bsls::AtomicInt counter(0);
+
+        const TimeInterval T = mX.now();
+        mX.scheduleEvent(T + TimeInterval(1.0),
+                         bdlf::BindUtil::bind(&u::increment, &counter));
+        mX.scheduleEvent(T + TimeInterval(2.0),
+                         bdlf::BindUtil::bind(&u::increment, &counter));
+
+        ASSERT(0 == mX.start());
+        ASSERT(0 == mX.start());
+
+        ASSERT(T + TimeInterval(0.5) ==
+                                    timeSource.advanceTime(TimeInterval(0.5)));
+        ASSERT(0 == counter);
+
+        timeSource.advanceTime(TimeInterval(1.0));
+        ASSERT(1 == counter);
+
+        timeSource.advanceTime(TimeInterval(1.0));
+        ASSERT(2 == counter);
+        ASSERT(0 == mX.numEvents());
+
+        mX.stop();
+        mX.stop();
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: SCHEDULE/CANCEL THROUGHPUT
+        //
+        // Concerns:
+        //: 1 Scheduling and canceling events, with a large number of events
+        //:   outstanding, is substantially faster than with
+        //:   'bdlmt::EventScheduler'.
+        //
+        // Plan:
+        //: 1 With 1,000,000 outstanding timeouts spread over 60 seconds,
+        //:   repeatedly cancel and reschedule a timeout, for both schedulers,
+        //:   and report the elapsed times.  Optionally specify the number of
+        //:   outstanding events as the second argument.
+        //
+        // Testing:
+        //   PERFORMANCE: SCHEDULE/CANCEL THROUGHPUT VS. EVENTSCHEDULER
+        // --------------------------------------------------------------------
+
+        cout << "PERFORMANCE: SCHEDULE/CANCEL THROUGHPUT\n"
+                "=======================================\n";
+
+        const int NUM_EVENTS = argc > 2 ? bsl::atoi(argv[2]) : 1000 * 1000;
+        const int NUM_OPS    = 1000 * 1000;
+
+        bslma::Allocator *alloc = bslma::Default::globalAllocator();
+        bslma::DefaultAllocatorGuard guard(alloc);
+
+        {
+            Obj mX(alloc);
+            const TimeInterval T = mX.now();
+
+            bsl::vector<EventHandle> handles(NUM_EVENTS, alloc);
+
+            bsls::Stopwatch sw;
+            sw.start();
+            for (int i = 0; i < NUM_EVENTS; ++i) {
+                mX.scheduleEvent(&handles[i],
+                                 T + TimeInterval(0, (i % 60000) * 1000000),
+                                 &u::noop);
+            }
+            sw.stop();
+            const double scheduleTime = sw.accumulatedWallTime();
+
+            sw.reset();
+            sw.start();
+            for (int i = 0; i < NUM_OPS; ++i) {
+                EventHandle& h = handles[i % NUM_EVENTS];
+                mX.cancelEvent(&h);
+                mX.scheduleEvent(&h, T + TimeInterval(30 + i % 30), &u::noop);
+            }
+            sw.stop();
+
+            cout << "TimerWheelScheduler: schedule " << NUM_EVENTS
+                 << " events: " << scheduleTime << "s, "
+                 << NUM_OPS << " cancel+schedule: "
+                 << sw.accumulatedWallTime() << "s" << endl;
+        }
+        {
+            bdlmt::EventScheduler mX(alloc);
+            const TimeInterval T = mX.now();
+
+            bsl::vector<bdlmt::EventSchedulerEventHandle> handles(NUM_EVENTS,
+                                                                  alloc);
+
+            bsls::Stopwatch sw;
+            sw.start();
+            for (int i = 0; i < NUM_EVENTS; ++i) {
+                mX.scheduleEvent(&handles[i],
+                                 T + TimeInterval(0, (i % 60000) * 1000000),
+                                 &u::noop);
+            }
+            sw.stop();
+            const double scheduleTime = sw.accumulatedWallTime();
+
+            sw.reset();
+            sw.start();
+            for (int i = 0; i < NUM_OPS; ++i) {
+                bdlmt::EventSchedulerEventHandle& h = handles[i % NUM_EVENTS];
+                mX.cancelEvent(&h);
+                mX.scheduleEvent(&h, T + TimeInterval(30 + i % 30), &u::noop);
+            }
+            sw.stop();
+
+            cout << "EventScheduler:      schedule " << NUM_EVENTS
+                 << " events: " << scheduleTime << "s, "
+                 << NUM_OPS << " cancel+schedule: "
+                 << sw.accumulatedWallTime() << "s" << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -14,19 +14,41 @@ BSLS_IDENT_RCSID(bdlpcre2_regex_cpp,"$Id$ $CSID$")
 // 'RegEx_MatchContext' class currently implements the following strategy
 // for allocating/deallocating buffers used for pattern matching:
 //:
-//: o The match context for the main thread (the thread that calls
-//:   'initialize') is pre-allocated when the pattern is compiled.
+//: o Buffers (a match context, match data sized by PCRE2 for the capturing
+//:   subpatterns of the pattern, and a JIT stack if one was requested) are
+//:   cached in a fixed array of slots, each holding at most one set of
+//:   buffers, and occupying its own cache line.
 //:
-//: o Match contexts for all other threads are allocated and deallocated within
-//:   each call to 'loadMatchContext' (i.e. when invoked from other thread(s)).
+//: o Each thread is assigned a slot, round-robin, the first time it matches
+//:   any pattern (and keeps it in a thread-local variable, or, on platforms
+//:   not supporting 'BSLMT_THREAD_LOCAL_VARIABLE', hashes its thread id).  A
+//:   match takes the buffers out of the slot of the calling thread with an
+//:   atomic exchange, and puts them back with an atomic compare-and-swap, so
+//:   that a thread matching repeatedly reuses the same buffers, and, provided
+//:   no more threads match concurrently than there are slots, allocates no
+//:   memory after its first match.
+//:
+//: o If the slot is empty (the thread shares its slot with another thread
+//:   that is matching, or is the first to use it), buffers are allocated, and
+//:   are deallocated on release if the slot has been refilled meanwhile.
+//:
+//: o The buffers of the thread that calls 'initialize' are pre-allocated when
+//:   the pattern is compiled.
+//
+// Note that buffers are not held in thread-local storage proper, since they
+// are allocated by the allocator of the 'RegEx' object, and must be released
+// when the object is destroyed, whichever threads used it.
 
 #include <bslma_allocator.h>
 #include <bslma_deallocatorproctor.h>
 #include <bslma_default.h>
 
+#include <bslmt_platform.h>
+#include <bslmt_threadlocalvariable.h>
 #include <bslmt_threadutil.h>
 
 #include <bsls_assert.h>
+#include <bsls_atomic.h>
 #include <bsls_exceptionutil.h>
 
 #include <bsl_cstring.h>    // bsl::memset
@@ -87,6 +109,44 @@ enum {
 };
     // Return values for this API.
 
+namespace {
+
+enum {
+    k_NUM_CACHED_CONTEXTS = 16  // number of slots caching match contexts;
+                                // must be a power of 2
+};
+
+bsls::AtomicOperations::AtomicTypes::Uint s_nextSlotIndex = { 0 };
+    // index of the slot to assign to the next thread
+
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+BSLMT_THREAD_LOCAL_VARIABLE(int, t_slotIndex, -1);
+    // slot assigned to the current thread, or -1 if not yet assigned
+#endif
+
+int currentSlotIndex()
+    // Return the index of the slot caching the match contexts of the calling
+    // thread.
+{
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+    if (0 > t_slotIndex) {
+        const unsigned int count =
+                     bsls::AtomicOperations::addUintNv(&s_nextSlotIndex, 1);
+        t_slotIndex = static_cast<int>((count - 1) &
+                                                 (k_NUM_CACHED_CONTEXTS - 1));
+    }
+    return t_slotIndex;
+#else
+    // Thread ids are often addresses, so use their high-order bits.
+
+    const bsls::Types::Uint64 hash = bslmt::ThreadUtil::selfIdAsUint64()
+                                   * 0x9E3779B97F4A7C15ULL;
+    return static_cast<int>(hash >> 32) & (k_NUM_CACHED_CONTEXTS - 1);
+#endif
+}
+
+}  // close unnamed namespace
+
                         // =============================
                         // struct RegEx_MatchContextData
                         // =============================
@@ -110,32 +170,53 @@ class RegEx_MatchContext {
     // This class manages opaque buffers used by PCRE2 match API.
 
     // PRIVATE TYPES
-    typedef bslmt::ThreadUtil::Handle  ThreadHandle;
-    // Alias for thread handle type.
+    struct Slot {
+        // This 'struct' holds a cached set of match buffers, alone in its
+        // cache line.
+
+        // DATA
+        bsls::AtomicPointer<RegEx_MatchContextData>
+             d_data;                     // cached buffers, or 0
+
+        char d_padding[bslmt::Platform::e_CACHE_LINE_SIZE -
+                       sizeof(bsls::AtomicPointer<RegEx_MatchContextData>)];
+                                         // padding to a cache line
+    };
 
     // DATA
     pcre2_general_context  *d_pcre2Context_p;       // PCRE2 general context
     pcre2_code             *d_pcre2PatternCode_p;   // PCRE2 compiled pattern
     int                     d_depthLimit;           // match depth limit
     size_t                  d_jitStackSize;         // JIT stack size
-    ThreadHandle            d_mainThread;           // main thread ID
-    RegEx_MatchContextData  d_mainThreadMatchData;  // main thread match ctx
+    bslma::Allocator       *d_allocator_p;          // memory allocator (held,
+                                                    // not owned)
+    mutable Slot            d_slots[k_NUM_CACHED_CONTEXTS];
+                                                    // cached match buffers
 
   private:
+    // NOT IMPLEMENTED
+    RegEx_MatchContext(const RegEx_MatchContext&);
+    RegEx_MatchContext& operator=(const RegEx_MatchContext&);
+
+    // PRIVATE MANIPULATORS
+    void deallocateCachedMatchContexts();
+        // Deallocate the match data buffers cached by this object.
+
     // PRIVATE ACCESSORS
-    int allocateMatchContext(RegEx_MatchContextData *matchContextData) const;
-        // Allocate PCRE2 match data buffers and load them into the specified
-        // 'matchContextData'.
+    RegEx_MatchContextData *allocateMatchContext() const;
+        // Allocate PCRE2 match data buffers, and return the address of the
+        // object holding them, or 0 if they cannot be allocated.
 
     void deallocateMatchContext(RegEx_MatchContextData *matchContextData)
                                                                          const;
         // Deallocate PCRE2 match data buffers pointed by the specified
-        // 'matchContextData'.
+        // 'matchContextData', and 'matchContextData' itself.
 
   public:
     // CREATORS
-    RegEx_MatchContext();
-        // Create a 'RegEx_MatchContext' object.
+    explicit RegEx_MatchContext(bslma::Allocator *basicAllocator);
+        // Create a 'RegEx_MatchContext' object using the specified
+        // 'basicAllocator' to supply memory.
 
     ~RegEx_MatchContext();
         // Destroy this object.
@@ -155,16 +236,16 @@ class RegEx_MatchContext {
         // specified 'depthLimit'.
 
     // ACCESSORS
-    int acquireMatchContext(RegEx_MatchContextData *matchContextData) const;
-        // Acquire the match data buffers for the current thread and load the
-        // specified 'matchContextData' with the pointers to the match data
-        // buffers.  The behaviour is undefined unless 'matchContextData' is a
-        // valid pointer.
+    RegEx_MatchContextData *acquireMatchContext() const;
+        // Acquire the match data buffers for the current thread, and return
+        // the address of the object holding them, or 0 if they cannot be
+        // allocated.
 
     void releaseMatchContext(RegEx_MatchContextData *matchContextData) const;
         // Release the match data buffers pointed by the specified
-        // 'matchContextData'.  The behaviour is undefined unless
-        // 'matchContextData' is a valid pointer.
+        // 'matchContextData', obtained by 'acquireMatchContext'.  The
+        // behaviour is undefined unless 'matchContextData' is a valid
+        // pointer.
 };
 
                         // ------------------
@@ -172,37 +253,55 @@ class RegEx_MatchContext {
                         // ------------------
 
 // CREATORS
-RegEx_MatchContext::RegEx_MatchContext()
+RegEx_MatchContext::RegEx_MatchContext(bslma::Allocator *basicAllocator)
 : d_pcre2Context_p(0)
 , d_pcre2PatternCode_p(0)
 , d_depthLimit(0)
 , d_jitStackSize(0)
-, d_mainThread(bslmt::ThreadUtil::invalidHandle())
-, d_mainThreadMatchData()
+, d_allocator_p(basicAllocator)
 {
+    BSLS_ASSERT(basicAllocator);
 }
 
 RegEx_MatchContext::~RegEx_MatchContext()
 {
-    deallocateMatchContext(&d_mainThreadMatchData);
+    deallocateCachedMatchContexts();
+}
+
+// PRIVATE MANIPULATORS
+void RegEx_MatchContext::deallocateCachedMatchContexts()
+{
+    for (int i = 0; i < k_NUM_CACHED_CONTEXTS; ++i) {
+        RegEx_MatchContextData *matchContextData =
+                                             d_slots[i].d_data.swapAcqRel(0);
+        if (matchContextData) {
+            deallocateMatchContext(matchContextData);
+        }
+    }
 }
 
 // PRIVATE ACCESSORS
-int
-RegEx_MatchContext::allocateMatchContext(
-                                RegEx_MatchContextData *matchContextData) const
+RegEx_MatchContextData *RegEx_MatchContext::allocateMatchContext() const
 {
-    BSLS_ASSERT(matchContextData);
     BSLS_ASSERT(d_pcre2Context_p);
     BSLS_ASSERT(d_pcre2PatternCode_p);
 
+    RegEx_MatchContextData *matchContextData = 0;
+    BSLS_TRY {
+        matchContextData = static_cast<RegEx_MatchContextData *>(
+                      d_allocator_p->allocate(sizeof(RegEx_MatchContextData)));
+    } BSLS_CATCH( ... ) {
+        return 0;                                                     // RETURN
+    }
+
     // Match Data
     pcre2_match_data *matchData_p = pcre2_match_data_create_from_pattern(
                                                           d_pcre2PatternCode_p,
                                                           0);
 
     if (0 == matchData_p) {
-        return k_FAILURE;                                             // RETURN
+        d_allocator_p->deallocate(matchContextData);
+        return 0;                                                     // RETURN
     }
 
     // Match context
@@ -211,7 +310,8 @@ RegEx_MatchContext::allocateMatchContext(
 
     if (0 == matchContext_p) {
         pcre2_match_data_free(matchData_p);
-        return k_FAILURE;                                             // RETURN
+        d_allocator_p->deallocate(matchContextData);
+        return 0;                                                     // RETURN
     }
 
     pcre2_set_match_limit(matchContext_p, d_depthLimit);
@@ -226,7 +326,8 @@ RegEx_MatchContext::allocateMatchContext(
         if (0 == jitStack_p) {
             pcre2_match_context_free(matchContext_p);
             pcre2_match_data_free(matchData_p);
-            return k_FAILURE;                                         // RETURN
+            d_allocator_p->deallocate(matchContextData);
+            return 0;                                                 // RETURN
         }
         pcre2_jit_stack_assign(matchContext_p, 0, jitStack_p);
     }
@@ -235,7 +336,7 @@ RegEx_MatchContext::allocateMatchContext(
     matchContextData->d_matchContext_p = matchContext_p;
     matchContextData->d_jitStack_p     = jitStack_p;
 
-    return k_SUCCESS;
+    return matchContextData;
 }
 
 void
@@ -247,6 +348,8 @@ RegEx_MatchContext::deallocateMatchContext(
     pcre2_match_data_free(matchContextData->d_matchData_p);
     pcre2_jit_stack_free(matchContextData->d_jitStack_p);
     pcre2_match_context_free(matchContextData->d_matchContext_p);
+
+    d_allocator_p->deallocate(matchContextData);
 }
 
 // MANIPULATORS
@@ -258,39 +361,47 @@ int RegEx_MatchContext::initialize(pcre2_general_context *pcre2Context,
     BSLS_ASSERT(pcre2Context);
     BSLS_ASSERT(patternCode);
 
-    deallocateMatchContext(&d_mainThreadMatchData);
+    deallocateCachedMatchContexts();
 
-    d_mainThread         = bslmt::ThreadUtil::self();
     d_pcre2Context_p     = pcre2Context;
     d_pcre2PatternCode_p = patternCode;
     d_depthLimit         = depthLimit;
     d_jitStackSize       = jitStackSize;
 
-    return allocateMatchContext(&d_mainThreadMatchData);
+    RegEx_MatchContextData *matchContextData = allocateMatchContext();
+    if (0 == matchContextData) {
+        return k_FAILURE;                                             // RETURN
+    }
+
+    d_slots[currentSlotIndex()].d_data = matchContextData;
+
+    return k_SUCCESS;
 }
 
 void RegEx_MatchContext::setDepthLimit(int depthLimit)
 {
     d_depthLimit = depthLimit;
-    if (d_mainThreadMatchData.d_matchContext_p) {
-        pcre2_set_match_limit(d_mainThreadMatchData.d_matchContext_p,
-                              d_depthLimit);
+
+    for (int i = 0; i < k_NUM_CACHED_CONTEXTS; ++i) {
+        RegEx_MatchContextData *matchContextData = d_slots[i].d_data;
+        if (matchContextData) {
+            pcre2_set_match_limit(matchContextData->d_matchContext_p,
+                                  d_depthLimit);
+        }
     }
 }
 
 // ACCESSORS
-int
-RegEx_MatchContext::acquireMatchContext(
-                                RegEx_MatchContextData *matchContextData) const
+RegEx_MatchContextData *RegEx_MatchContext::acquireMatchContext() const
 {
-    BSLS_ASSERT(matchContextData);
+    Slot& slot = d_slots[currentSlotIndex()];
 
-    if (bslmt::ThreadUtil::isEqual(d_mainThread, bslmt::ThreadUtil::self())) {
-        *matchContextData = d_mainThreadMatchData;
-        return k_SUCCESS;                                             // RETURN
+    RegEx_MatchContextData *matchContextData = slot.d_data.swapAcqRel(0);
+    if (matchContextData) {
+        return matchContextData;                                      // RETURN
     }
 
-    return allocateMatchContext(matchContextData);
+    return allocateMatchContext();
 }
 
 void RegEx_MatchContext::releaseMatchContext(
@@ -298,11 +409,11 @@ void RegEx_MatchContext::releaseMatchContext(
 {
     BSLS_ASSERT(matchContextData);
 
-    if (bslmt::ThreadUtil::isEqual(d_mainThread, bslmt::ThreadUtil::self())) {
-        return;                                                       // RETURN
-    }
+    Slot& slot = d_slots[currentSlotIndex()];
 
-    deallocateMatchContext(matchContextData);
+    if (0 != slot.d_data.testAndSwapAcqRel(0, matchContextData)) {
+        deallocateMatchContext(matchContextData);
+    }
 }
 
                              // -----------
@@ -474,7 +585,7 @@ RegEx::RegEx(bslma::Allocator *basicAllocator)
 , d_jitStackSize(0)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
-    d_matchContext.load(new (*d_allocator_p) RegEx_MatchContext(),
+    d_matchContext.load(new (*d_allocator_p) RegEx_MatchContext(d_allocator_p),
                         d_allocator_p);
 
     d_pcre2Context_p = pcre2_general_context_create(
@@ -624,9 +735,10 @@ int RegEx::match(const char *subject,
     BSLS_ASSERT(subjectOffset <= subjectLength);
     BSLS_ASSERT(isPrepared());
 
-    RegEx_MatchContextData matchContextData;
+    RegEx_MatchContextData *matchContextData =
+                                         d_matchContext->acquireMatchContext();
 
-    if (0 != d_matchContext->acquireMatchContext(&matchContextData)) {
+    if (0 == matchContextData) {
         return k_FAILURE;                                             // RETURN
     }
 
@@ -634,10 +746,10 @@ int RegEx::match(const char *subject,
                                    subjectLength,
                                    subjectOffset,
                                    false,
-                                   matchContextData.d_matchData_p,
-                                   matchContextData.d_matchContext_p);
+                                   matchContextData->d_matchData_p,
+                                   matchContextData->d_matchContext_p);
 
-    d_matchContext->releaseMatchContext(&matchContextData);
+    d_matchContext->releaseMatchContext(matchContextData);
 
     return matchResult;
 }
@@ -652,9 +764,10 @@ int RegEx::match(bsl::pair<size_t, size_t> *result,
     BSLS_ASSERT(subjectOffset <= subjectLength);
     BSLS_ASSERT(isPrepared());
 
-    RegEx_MatchContextData matchContextData;
+    RegEx_MatchContextData *matchContextData =
+                                         d_matchContext->acquireMatchContext();
 
-    if (0 != d_matchContext->acquireMatchContext(&matchContextData)) {
+    if (0 == matchContextData) {
         return k_FAILURE;                                             // RETURN
     }
 
@@ -662,14 +775,14 @@ int RegEx::match(bsl::pair<size_t, size_t> *result,
                                    subjectLength,
                                    subjectOffset,
                                    true,
-                                   matchContextData.d_matchData_p,
-                                   matchContextData.d_matchContext_p);
+                                   matchContextData->d_matchData_p,
+                                   matchContextData->d_matchContext_p);
 
     if (k_SUCCESS == matchResult) {
-        extractMatchResult(matchContextData.d_matchData_p, result);
+        extractMatchResult(matchContextData->d_matchData_p, result);
     }
 
-    d_matchContext->releaseMatchContext(&matchContextData);
+    d_matchContext->releaseMatchContext(matchContextData);
 
     return matchResult;
 }
@@ -684,9 +797,10 @@ int RegEx::match(bslstl::StringRef *result,
     BSLS_ASSERT(subjectOffset <= subjectLength);
     BSLS_ASSERT(isPrepared());
 
-    RegEx_MatchContextData matchContextData;
+    RegEx_MatchContextData *matchContextData =
+                                         d_matchContext->acquireMatchContext();
 
-    if (0 != d_matchContext->acquireMatchContext(&matchContextData)) {
+    if (0 == matchContextData) {
         return k_FAILURE;                                             // RETURN
     }
 
@@ -694,14 +808,14 @@ int RegEx::match(bslstl::StringRef *result,
                                    subjectLength,
                                    subjectOffset,
                                    true,
-                                   matchContextData.d_matchData_p,
-                                   matchContextData.d_matchContext_p);
+                                   matchContextData->d_matchData_p,
+                                   matchContextData->d_matchContext_p);
 
     if (k_SUCCESS == matchResult) {
-        extractMatchResult(matchContextData.d_matchData_p, result, subject);
+        extractMatchResult(matchContextData->d_matchData_p, result, subject);
     }
 
-    d_matchContext->releaseMatchContext(&matchContextData);
+    d_matchContext->releaseMatchContext(matchContextData);
 
     return matchResult;
 }
@@ -716,9 +830,10 @@ int RegEx::match(bsl::vector<bsl::pair<size_t, size_t> > *result,
     BSLS_ASSERT(subjectOffset <= subjectLength);
     BSLS_ASSERT(isPrepared());
 
-    RegEx_MatchContextData matchContextData;
+    RegEx_MatchContextData *matchContextData =
+                                         d_matchContext->acquireMatchContext();
 
-    if (0 != d_matchContext->acquireMatchContext(&matchContextData)) {
+    if (0 == matchContextData) {
         return k_FAILURE;                                             // RETURN
     }
 
@@ -726,14 +841,14 @@ int RegEx::match(bsl::vector<bsl::pair<size_t, size_t> > *result,
                                    subjectLength,
                                    subjectOffset,
                                    true,
-                                   matchContextData.d_matchData_p,
-                                   matchContextData.d_matchContext_p);
+                                   matchContextData->d_matchData_p,
+                                   matchContextData->d_matchContext_p);
 
     if (k_SUCCESS == matchResult) {
-        extractMatchResult(matchContextData.d_matchData_p, result);
+        extractMatchResult(matchContextData->d_matchData_p, result);
     }
 
-    d_matchContext->releaseMatchContext(&matchContextData);
+    d_matchContext->releaseMatchContext(matchContextData);
 
     return matchResult;
 }
@@ -748,9 +863,10 @@ int RegEx::match(bsl::vector<bslstl::StringRef> *result,
     BSLS_ASSERT(subjectOffset <= subjectLength);
     BSLS_ASSERT(isPrepared());
 
-    RegEx_MatchContextData matchContextData;
+    RegEx_MatchContextData *matchContextData =
+                                         d_matchContext->acquireMatchContext();
 
-    if (0 != d_matchContext->acquireMatchContext(&matchContextData)) {
+    if (0 == matchContextData) {
         return k_FAILURE;                                             // RETURN
     }
 
@@ -758,18 +874,49 @@ int RegEx::match(bsl::vector<bslstl::StringRef> *result,
                                    subjectLength,
                                    subjectOffset,
                                    true,
-                                   matchContextData.d_matchData_p,
-                                   matchContextData.d_matchContext_p);
+                                   matchContextData->d_matchData_p,
+                                   matchContextData->d_matchContext_p);
 
     if (k_SUCCESS == matchResult) {
-        extractMatchResult(matchContextData.d_matchData_p, result, subject);
+        extractMatchResult(matchContextData->d_matchData_p, result, subject);
     }
 
-    d_matchContext->releaseMatchContext(&matchContextData);
+    d_matchContext->releaseMatchContext(matchContextData);
 
     return matchResult;
 }
 
+int RegEx::match(bsl::vector<int>                      *results,
+                 const bsl::vector<bslstl::StringRef>&  subjects) const
+{
+    BSLS_ASSERT(results);
+    BSLS_ASSERT(isPrepared());
+
+    RegEx_MatchContextData *matchContextData =
+                                         d_matchContext->acquireMatchContext();
+
+    if (0 == matchContextData) {
+        return k_FAILURE;                                             // RETURN
+    }
+
+    results->resize(subjects.size());
+
+    for (size_t i = 0; i < subjects.size(); ++i) {
+        const bslstl::StringRef& subject = subjects[i];
+
+        (*results)[i] = privateMatch(subject.data(),
+                                     subject.length(),
+                                     0,
+                                     false,
+                                     matchContextData->d_matchData_p,
+                                     matchContextData->d_matchContext_p);
+    }
+
+    d_matchContext->releaseMatchContext(matchContextData);
+
+    return k_SUCCESS;
+}
+
 int RegEx::matchRaw(const char *subject,
                     size_t      subjectLength,
                     size_t      subjectOffset) const
@@ -778,9 +925,10 @@ int RegEx::matchRaw(const char *subject,
     BSLS_ASSERT(subjectOffset <= subjectLength);
     BSLS_ASSERT(isPrepared());
 
-    RegEx_MatchContextData matchContextData;
+    RegEx_MatchContextData *matchContextData =
+                                         d_matchContext->acquireMatchContext();
 
-    if (0 != d_matchContext->acquireMatchContext(&matchContextData)) {
+    if (0 == matchContextData) {
         return k_FAILURE;                                             // RETURN
     }
 
@@ -788,10 +936,10 @@ int RegEx::matchRaw(const char *subject,
                                    subjectLength,
                                    subjectOffset,
                                    true,
-                                   matchContextData.d_matchData_p,
-                                   matchContextData.d_matchContext_p);
+                                   matchContextData->d_matchData_p,
+                                   matchContextData->d_matchContext_p);
 
-    d_matchContext->releaseMatchContext(&matchContextData);
+    d_matchContext->releaseMatchContext(matchContextData);
 
     return matchResult;
 }
@@ -806,9 +954,10 @@ int RegEx::matchRaw(bsl::pair<size_t, size_t> *result,
     BSLS_ASSERT(subjectOffset <= subjectLength);
     BSLS_ASSERT(isPrepared());
 
-    RegEx_MatchContextData matchContextData;
+    RegEx_MatchContextData *matchContextData =
+                                         d_matchContext->acquireMatchContext();
 
-    if (0 != d_matchContext->acquireMatchContext(&matchContextData)) {
+    if (0 == matchContextData) {
         return k_FAILURE;                                             // RETURN
     }
 
@@ -816,14 +965,14 @@ int RegEx::matchRaw(bsl::pair<size_t, size_t> *result,
                                    subjectLength,
                                    subjectOffset,
                                    true,
-                                   matchContextData.d_matchData_p,
-                                   matchContextData.d_matchContext_p);
+                                   matchContextData->d_matchData_p,
+                                   matchContextData->d_matchContext_p);
 
     if (k_SUCCESS == matchResult) {
-        extractMatchResult(matchContextData.d_matchData_p, result);
+        extractMatchResult(matchContextData->d_matchData_p, result);
     }
 
-    d_matchContext->releaseMatchContext(&matchContextData);
+    d_matchContext->releaseMatchContext(matchContextData);
 
     return matchResult;
 }
@@ -838,9 +987,10 @@ int RegEx::matchRaw(bslstl::StringRef *result,
     BSLS_ASSERT(subjectOffset <= subjectLength);
     BSLS_ASSERT(isPrepared());
 
-    RegEx_MatchContextData matchContextData;
+    RegEx_MatchContextData *matchContextData =
+                                         d_matchContext->acquireMatchContext();
 
-    if (0 != d_matchContext->acquireMatchContext(&matchContextData)) {
+    if (0 == matchContextData) {
         return k_FAILURE;                                             // RETURN
     }
 
@@ -848,14 +998,14 @@ int RegEx::matchRaw(bslstl::StringRef *result,
                                    subjectLength,
                                    subjectOffset,
                                    true,
-                                   matchContextData.d_matchData_p,
-                                   matchContextData.d_matchContext_p);
+                                   matchContextData->d_matchData_p,
+                                   matchContextData->d_matchContext_p);
 
     if (k_SUCCESS == matchResult) {
-        extractMatchResult(matchContextData.d_matchData_p, result, subject);
+        extractMatchResult(matchContextData->d_matchData_p, result, subject);
     }
 
-    d_matchContext->releaseMatchContext(&matchContextData);
+    d_matchContext->releaseMatchContext(matchContextData);
 
     return matchResult;
 }
@@ -871,9 +1021,10 @@ int RegEx::matchRaw(
     BSLS_ASSERT(subjectOffset <= subjectLength);
     BSLS_ASSERT(isPrepared());
 
-    RegEx_MatchContextData matchContextData;
+    RegEx_MatchContextData *matchContextData =
+                                         d_matchContext->acquireMatchContext();
 
-    if (0 != d_matchContext->acquireMatchContext(&matchContextData)) {
+    if (0 == matchContextData) {
         return k_FAILURE;                                             // RETURN
     }
 
@@ -881,14 +1032,14 @@ int RegEx::matchRaw(
                                    subjectLength,
                                    subjectOffset,
                                    true,
-                                   matchContextData.d_matchData_p,
-                                   matchContextData.d_matchContext_p);
+                                   matchContextData->d_matchData_p,
+                                   matchContextData->d_matchContext_p);
 
     if (k_SUCCESS == matchResult) {
-        extractMatchResult(matchContextData.d_matchData_p, result);
+        extractMatchResult(matchContextData->d_matchData_p, result);
     }
 
-    d_matchContext->releaseMatchContext(&matchContextData);
+    d_matchContext->releaseMatchContext(matchContextData);
 
     return matchResult;
 }
@@ -903,9 +1054,10 @@ int RegEx::matchRaw(bsl::vector<bslstl::StringRef> *result,
     BSLS_ASSERT(subjectOffset <= subjectLength);
     BSLS_ASSERT(isPrepared());
 
-    RegEx_MatchContextData matchContextData;
+    RegEx_MatchContextData *matchContextData =
+                                         d_matchContext->acquireMatchContext();
 
-    if (0 != d_matchContext->acquireMatchContext(&matchContextData)) {
+    if (0 == matchContextData) {
         return k_FAILURE;                                             // RETURN
     }
 
@@ -913,14 +1065,14 @@ int RegEx::matchRaw(bsl::vector<bslstl::StringRef> *result,
                                    subjectLength,
                                    subjectOffset,
                                    true,
-                                   matchContextData.d_matchData_p,
-                                   matchContextData.d_matchContext_p);
+                                   matchContextData->d_matchData_p,
+                                   matchContextData->d_matchContext_p);
 
     if (k_SUCCESS == matchResult) {
-        extractMatchResult(matchContextData.d_matchData_p, result, subject);
+        extractMatchResult(matchContextData->d_matchData_p, result, subject);
     }
 
-    d_matchContext->releaseMatchContext(&matchContextData);
+    d_matchContext->releaseMatchContext(matchContextData);
 
     return matchResult;
 }
@@ -10,7 +10,7 @@ BSLS_IDENT("$Id$ $CSID$")
 //@CLASSES:
 //  bdlpcre::RegEx: mechanism for compiling and matching regular expressions
 //
-//@SEE_ALSO: http://www.pcre.org/
+//@SEE_ALSO: bdlpcre_regexset, http://www.pcre.org/
 //
 //@DESCRIPTION: This component provides a mechanism, 'bdlpcre::RegEx', for
 // compiling (or "preparing") regular expressions, and subsequently matching
@@ -199,25 +199,28 @@ BSLS_IDENT("$Id$ $CSID$")
 // Note that 'bdlpcre::RegEx' incurs some overhead in order to provide
 // thread-safe pattern matching functionality.  To perform the pattern match,
 // the underlaying PCRE2 library requires a set of buffers that cannot be
-// shared between threads.
+// shared between threads.  These buffers (the match data, sized for the
+// capturing subpatterns of the pattern, and the JIT stack, if one was
+// requested) are cached by the 'bdlpcre::RegEx' object in a small, fixed
+// number of slots, and each thread is assigned one of the slots the first
+// time it matches a pattern.  A thread reuses the buffers cached in its slot
+// from one match to the next, so that, after its first match, 'match'
+// allocates no memory, provided no more threads are concurrently matching the
+// pattern than there are slots.  Otherwise, threads sharing a slot allocate
+// buffers when the slot is in use.  The buffers of the thread that invokes
+// 'prepare' are allocated by 'prepare'.  The cached buffers are released when
+// the object is prepared again or destroyed.
 //
-// The table below demonstrate the difference of invoking the 'match' method
-// from main (thread that invokes 'prepare') and other threads:
-//..
-//   Table 3: Performance cost for 'match' in multi-threaded application
-//  +--------------------+-----------------------+----------------------------+
-//  | Pattern            | 'match' (main thread) |  'match' (other thread(s)) |
-//  +====================+=======================+============================+
-//  | SIMPLE_PATTERN     |    0.0549 (~1.4x)     |           0.0759           |
-//  +--------------------+-----------------------+----------------------------+
-//  | EMAIL_PATTERN      |    0.0259 (~1.8x)     |           0.0464           |
-//  +--------------------+-----------------------+----------------------------+
-//  | IP_ADDRESS_PATTERN |    0.0377 (~1.5x)     |           0.0560           |
-//  +--------------------+-----------------------+----------------------------+
-//..
 // Note that JIT stack is functionally part of the match context. Using large
-// JIT stack can incur additional performance penalty in the multi-threaded
-// applications.
+// JIT stack increases the memory used by each slot.
+//
+///Batch Matching
+///--------------
+// An overload of 'match' taking a vector of subjects matches each of them
+// against the prepared pattern, and loads a vector with the result of each
+// match.  The match data buffers (and the JIT stack, if any) are obtained once
+// for the whole batch, instead of once per subject.  To match each subject
+// against many patterns in a single scan, see 'bdlpcre_regexset'.
 //
 ///Note on memory allocation exceptions
 ///------------------------------------
@@ -868,6 +871,23 @@ class RegEx {
         // that after a successful call, 'result' will contain exactly
         // 'numSubpatterns() + 1' elements.
 
+    int match(bsl::vector<int>                      *results,
+              const bsl::vector<bslstl::StringRef>&  subjects) const;
+        // Match each of the specified 'subjects' against the pattern held by
+        // this regular-expression object ('pattern()'), using the same match
+        // data buffers (and JIT stack) for all of the subjects, and load the
+        // element of the specified 'results' at the index of each subject
+        // with the value that 'match(subject.data(), subject.length())' would
+        // return for that subject (i.e., 0 if it matches, 1 if the depth limit
+        // was exceeded, 2 if memory available for the JIT stack is not large
+        // enough, and another non-zero value otherwise).  Return 0 on success,
+        // and a non-zero value, with no effect on 'results', if the match data
+        // buffers could not be obtained.  The behavior is undefined unless
+        // 'isPrepared() == true'.  Note that after a successful call,
+        // 'results' will contain exactly 'subjects.size()' elements.  Also
+        // note that this method obtains the match data buffers once for all
+        // of the subjects (see {Batch Matching}).
+
     int matchRaw(const char *subject,
                  size_t      subjectLength,
                  size_t      subjectOffset = 0) const;
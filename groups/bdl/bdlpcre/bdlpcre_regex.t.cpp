@@ -65,6 +65,7 @@ using namespace bdlpcre;
 // [ 5] int match(bsl::vector<bslstl::StringRef> *result, ...) const;
 // [ 5] int matchRaw(bslstl::StringRef *result, ...) const;
 // [ 5] int matchRaw(bsl::vector<bslstl::StringRef> *result, ...) const;
+// [19] int match(bsl::vector<int> *, const vector<StringRef>&) const;
 // [11] int numSubpatterns() const;
 // [ 2] const bsl::string& pattern() const;
 // [11] int subpatternIndex(const char *name) const;
@@ -82,7 +83,7 @@ using namespace bdlpcre;
 // [16] UNICODE CHARACTER PROPERTY SUPPORT
 // [17] MEMORY ALIGNMENT
 // [18] CONCERN: 'match' IS THREAD-SAFE
-// [19] USAGE EXAMPLE
+// [20] USAGE EXAMPLE
 // ----------------------------------------------------------------------------
 
 // ============================================================================
@@ -621,6 +622,118 @@ extern "C" void *testPrepareFunction(void *threadArg)
     return 0;
 }
 
+                        // ==============
+                        // BufferReuseJob
+                        // ==============
+
+struct BufferReuseJob {
+    // This 'struct' is used to verify that 'match' reuses the match data
+    // buffers of a thread after its first match.
+
+    // DATA
+    const RegEx                *d_regEx_p;      // prepared RegEx
+    const bslma::TestAllocator *d_allocator_p;  // allocator of 'd_regEx_p'
+};
+
+extern "C" void *bufferReuseFunction(void *threadArg)
+    // This thread function matches a subject repeatedly against a precompiled
+    // 'RegEx' object, and verifies that no memory is allocated after the
+    // first match.
+{
+    const BufferReuseJob *job = static_cast<const BufferReuseJob *>(threadArg);
+
+    const char SUBJECT[] = "XabcabcZ";
+
+    bsl::pair<size_t, size_t> result;
+    ASSERT(0 == job->d_regEx_p->match(&result, SUBJECT, sizeof SUBJECT - 1));
+
+    const bsls::Types::Int64 NUM_ALLOCS = job->d_allocator_p->numAllocations();
+
+    for (int i = 0; i < 100; ++i) {
+        ASSERTV(i, 0 == job->d_regEx_p->match(&result,
+                                              SUBJECT,
+                                              sizeof SUBJECT - 1));
+    }
+
+    ASSERTV(NUM_ALLOCS,
+            job->d_allocator_p->numAllocations(),
+            NUM_ALLOCS == job->d_allocator_p->numAllocations());
+    return 0;
+}
+
+                        // =============
+                        // BatchMatchJob
+                        // =============
+
+struct BatchMatchJob {
+    // This 'struct' is used to test the batch 'match' method from a thread
+    // other than the one that prepared the pattern.
+
+    // DATA
+    const RegEx                          *d_regEx_p;     // prepared RegEx
+    const bsl::vector<bslstl::StringRef> *d_subjects_p;  // subjects to match
+    bsl::vector<int>                     *d_results_p;   // match results
+};
+
+extern "C" void *batchMatchFunction(void *threadArg)
+    // This thread function matches a batch of subjects against a precompiled
+    // 'RegEx' object.
+{
+    const BatchMatchJob *job = static_cast<const BatchMatchJob *>(threadArg);
+
+    int retCode = job->d_regEx_p->match(job->d_results_p, *job->d_subjects_p);
+
+    ASSERTV(retCode, 0 == retCode);
+    return 0;
+}
+
+                        // =============
+                        // ThroughputJob
+                        // =============
+
+struct ThroughputJob {
+    // This 'struct' is used to measure the throughput of 'match' when called
+    // concurrently from several threads.
+
+    // DATA
+    const bsl::vector<const RegEx *> *d_regExes_p;    // prepared RegExes
+    const char *const                *d_lines_p;      // log lines to match
+    int                               d_numLines;     // number of log lines
+    int                               d_iterations;   // passes over the lines
+    bsls::Types::Int64                d_numMatched;   // number of matches
+};
+
+extern "C" void *throughputFunction(void *threadArg)
+    // This thread function matches every log line of the 'ThroughputJob'
+    // supplied by the specified 'threadArg' against every 'RegEx' of the job,
+    // extracting the captured substrings, and records the number of matches.
+{
+    ThroughputJob *job = static_cast<ThroughputJob *>(threadArg);
+
+    const bsl::vector<const RegEx *>& regExes = *job->d_regExes_p;
+
+    bsl::vector<bsl::pair<size_t, size_t> > result;
+    result.reserve(16);
+
+    bsls::Types::Int64 numMatched = 0;
+
+    for (int it = 0; it < job->d_iterations; ++it) {
+        for (int li = 0; li < job->d_numLines; ++li) {
+            const char   *line   = job->d_lines_p[li];
+            const size_t  length = strlen(line);
+
+            for (size_t ri = 0; ri < regExes.size(); ++ri) {
+                if (0 == regExes[ri]->match(&result, line, length)) {
+                    ++numMatched;
+                }
+            }
+        }
+    }
+
+    job->d_numMatched = numMatched;
+    return 0;
+}
+
 }  // close unnamed namespace
 
 //=============================================================================
@@ -719,7 +832,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 19: {
+      case 20: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -772,18 +885,167 @@ int main(int argc, char *argv[])
 //  }
 //..
       } break;
+      case 19: {
+        // --------------------------------------------------------------------
+        // TESTING BATCH 'match'
+        //
+        // Concerns:
+        //: 1 The batch 'match' loads, for each subject, the value returned by
+        //:   'match' for that subject alone, with and without JIT.
+        //:
+        //: 2 The batch 'match' reports exceeding the depth limit for the
+        //:   subjects exceeding it only.
+        //:
+        //: 3 An empty batch loads no results.
+        //:
+        //: 4 The batch 'match' can be called from a thread other than the one
+        //:   that prepared the object.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Prepare a pattern (with and without JIT), match a batch of
+        //:   subjects, and compare the results with those of matching each
+        //:   subject alone.  (C-1)
+        //:
+        //: 2 Set a small depth limit, and match a batch of subjects some of
+        //:   which require a greater depth.  (C-2)
+        //:
+        //: 3 Match an empty batch.  (C-3)
+        //:
+        //: 4 Match a batch from another thread.  (C-4)
+        //:
+        //: 5 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   int match(bsl::vector<int> *, const vector<StringRef>&) const;
+        // --------------------------------------------------------------------
+        if (verbose) cout << endl
+                          << "TESTING BATCH 'match'" << endl
+                          << "=====================" << endl;
+
+        static const char *const SUBJECTS[] = {
+            "",
+            "X",
+            "XZ",
+            "XabcZ",
+            "XabcabcabcZ",
+            "XabZ",
+            "prefix XabcabcZ suffix",
+            "ZabcX",
+        };
+        enum { NUM_SUBJECTS = sizeof SUBJECTS / sizeof *SUBJECTS };
+
+        bsl::vector<bslstl::StringRef> subjects;
+        for (int i = 0; i < NUM_SUBJECTS; ++i) {
+            subjects.push_back(SUBJECTS[i]);
+        }
+
+        for (int cfg = 0; cfg < 2; ++cfg) {
+            const int FLAGS = 0 == cfg ? 0 : Obj::k_FLAG_JIT;
+
+            if (veryVerbose) { T_ P(FLAGS) }
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            Obj mX(&oa);  const Obj& X = mX;
+            ASSERT(0 == mX.prepare(0, 0, "X(abc)*Z", FLAGS));
+
+            bsl::vector<int> results(3, 7);
+            ASSERTV(cfg, 0 == X.match(&results, subjects));
+            ASSERTV(cfg, NUM_SUBJECTS == results.size());
+
+            for (int i = 0; i < NUM_SUBJECTS; ++i) {
+                const int EXP = X.match(SUBJECTS[i], bsl::strlen(SUBJECTS[i]));
+                ASSERTV(cfg, i, EXP, results[i], EXP == results[i]);
+            }
+
+            ASSERTV(cfg, 0 == X.match(&results,
+                                      bsl::vector<bslstl::StringRef>()));
+            ASSERTV(cfg, results.empty());
+        }
+
+        if (verbose) cout << "\nDepth limit." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+            ASSERT(0 == mX.prepare(0, 0, "a(\n)+b"));
+            mX.setDepthLimit(5);
+
+            bsl::vector<bslstl::StringRef> batch;
+            batch.push_back("a\nb");
+            batch.push_back("a\n\n\n\n\nb");
+            batch.push_back("xyz");
+
+            bsl::vector<int> results;
+            ASSERT(0 == X.match(&results, batch));
+            ASSERT(3 == results.size());
+            ASSERT(0 == results[0]);
+            ASSERT(1 == results[1]);
+            ASSERT(0 != results[2] && 1 != results[2]);
+        }
+
+        if (verbose) cout << "\nAnother thread." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+            ASSERT(0 == mX.prepare(0, 0, "X(abc)*Z", Obj::k_FLAG_JIT));
+
+            bsl::vector<int> expected;
+            ASSERT(0 == X.match(&expected, subjects));
+
+            bsl::vector<int> results;
+
+            BatchMatchJob job = { &X, &subjects, &results };
+
+            bslmt::ThreadUtil::Handle handle;
+            ASSERT(0 == bslmt::ThreadUtil::create(&handle,
+                                                  batchMatchFunction,
+                                                  &job));
+            ASSERT(0 == bslmt::ThreadUtil::join(handle));
+            ASSERT(expected == results);
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX;  const Obj& X = mX;
+
+            bsl::vector<int> results;
+
+            ASSERT_FAIL(X.match(&results, subjects));
+
+            ASSERT(0 == mX.prepare(0, 0, "X(abc)*Z"));
+
+            ASSERT_PASS(X.match(&results, subjects));
+            ASSERT_FAIL(X.match(0, subjects));
+        }
+      } break;
       case 18: {
         // --------------------------------------------------------------------
         // TESTING 'match' THREAD SAFETY
         //
         // Concerns:
         //: 1 'match' can be safely called from the multiple threads.
+        //:
+        //: 2 After its first match, a thread (including a thread other than
+        //:   the one that prepared the pattern) matching a pattern allocates
+        //:   no memory.
+        //:
+        //: 3 The match data buffers cached for the threads are released when
+        //:   the object is destroyed.
         //
         // Plan:
         //: 1 Create and prepare a pattern (with and without JIT support)
         //:
         //: 2 Spawn muliple thread and call 'match' from all those thread,
         //:   verify the matchs result in all threads.  C-1)
+        //:
+        //: 3 Prepare a pattern using a test allocator (with and without JIT
+        //:   support and a JIT stack), match it repeatedly from several
+        //:   threads, and verify that no memory is allocated after the first
+        //:   match of each thread, and that all memory is released when the
+        //:   object is destroyed.  (C-2..3)
         //
         // Testing:
         //   CONCERN: 'match' IS THREAD-SAFE
@@ -874,6 +1136,42 @@ int main(int argc, char *argv[])
                 }
             }
         }
+
+        if (verbose) cout << "\nTesting reuse of match data buffers." << endl;
+
+        for (int cfg = 0; cfg < 3; ++cfg) {
+            const int    FLAGS          = 0 == cfg ? 0 : Obj::k_FLAG_JIT;
+            const size_t JIT_STACK_SIZE = 2 == cfg ? 8192 : 0;
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+            {
+                Obj mX(&oa);  const Obj& X = mX;
+                ASSERT(0 == mX.prepare(0,
+                                       0,
+                                       "X(abc)*Z",
+                                       FLAGS,
+                                       JIT_STACK_SIZE));
+
+                BufferReuseJob job = { &X, &oa };
+
+                bslmt::ThreadUtil::Handle threads[4];
+
+                for (int i = 0; i < 4; ++i) {
+                    int rc = bslmt::ThreadUtil::create(&threads[i],
+                                                       bufferReuseFunction,
+                                                       &job);
+                    ASSERTV(rc, 0 == rc);
+                }
+
+                for (int i = 0; i < 4; ++i) {
+                    int rc = bslmt::ThreadUtil::join(threads[i]);
+                    ASSERTV(rc, 0 == rc);
+                }
+
+                bufferReuseFunction(&job);
+            }
+            ASSERTV(cfg, 0 == oa.numBlocksInUse());
+        }
       } break;
       case 17: {
         // --------------------------------------------------------------------
@@ -4024,6 +4322,151 @@ int main(int argc, char *argv[])
 
         ASSERTV(matchTime, matchRawTime, matchTime > matchRawTime);
       } break;
+      case -3: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST 3
+        //
+        // Concerns:
+        //: 1 The throughput of 'match' called concurrently from several
+        //:   threads scales with the number of threads.
+        //:
+        //: 2 Once each thread has matched a pattern, 'match' allocates no
+        //:   memory.
+        //
+        // Plan:
+        //: 1 Prepare a few patterns with capturing subpatterns (with and
+        //:   without JIT, and with and without a JIT stack) typical of log
+        //:   processing, and match every line of a corpus of log lines
+        //:   against each of them from 1, 2, 4, 8, and 16 threads.  Report
+        //:   the throughput, and verify that every thread finds the same
+        //:   number of matches.  (C-1)
+        //:
+        //: 2 Supply a test allocator to the 'RegEx' objects, and report the
+        //:   number of allocations made while matching.  (C-2)
+        //
+        // Testing:
+        //  PERFORMANCE TEST 3
+        // --------------------------------------------------------------------
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST 3" << endl
+                          << "==================" << endl;
+
+        static const char *const PATTERNS[] = {
+            "^(\\S+) (\\S+) \\[([^\\]]+)\\] \"(GET|POST|PUT|DELETE) ([^ ]+)",
+            "status=([0-9]{3}) latency=([0-9]+)us",
+            "user=(?<user>[a-z]+)",
+            "(ERROR|WARN) .*(timeout|refused|reset)",
+        };
+        enum { k_NUM_PATTERNS = sizeof PATTERNS / sizeof *PATTERNS };
+
+        static const char *const LINES[] = {
+            "10.0.0.1 - [19/Oct/2026:12:00:01] \"GET /index.html HTTP/1.1\" "
+                                                 "status=200 latency=87us",
+            "10.0.0.2 alice [19/Oct/2026:12:00:02] \"POST /api/v1/order "
+                                 "HTTP/1.1\" status=201 latency=1200us",
+            "WARN retry 2/5 for 10.1.2.3 user=alice: connection refused",
+            "ERROR connection reset by 192.168.0.7 after 3 retries",
+            "INFO cache hit ratio 0.97 for shard 12",
+            "DEBUG parsed 1024 records in 3 batches user=bob",
+            "10.0.0.3 - [19/Oct/2026:12:00:06] \"GET /health HTTP/1.1\" "
+                                                 "status=503 latency=9999us",
+            "ERROR timeout after 250 ms while calling pricing service",
+            "INFO heartbeat ok",
+        };
+        enum { k_NUM_LINES = sizeof LINES / sizeof *LINES };
+
+        const int ITERATIONS = argc > 2 ? atoi(argv[2]) : 20000;
+
+        static const struct {
+            int    d_flags;         // prepare flags
+            size_t d_jitStackSize;  // JIT stack size
+        } CONFIGS[] = {
+            { 0,                0         },
+            { Obj::k_FLAG_JIT,  0         },
+            { Obj::k_FLAG_JIT,  64 * 1024 },
+        };
+        enum { k_NUM_CONFIGS = sizeof CONFIGS / sizeof *CONFIGS };
+
+        for (int ci = 0; ci < k_NUM_CONFIGS; ++ci) {
+            const int    FLAGS          = CONFIGS[ci].d_flags;
+            const size_t JIT_STACK_SIZE = CONFIGS[ci].d_jitStackSize;
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            bsl::vector<Obj *>       objects;
+            bsl::vector<const Obj *> regExes;
+            for (int pi = 0; pi < k_NUM_PATTERNS; ++pi) {
+                objects.push_back(new (oa) Obj(&oa));
+                ASSERT(0 == objects.back()->prepare(0,
+                                                    0,
+                                                    PATTERNS[pi],
+                                                    FLAGS,
+                                                    JIT_STACK_SIZE));
+                regExes.push_back(objects.back());
+            }
+
+            cout << "\nflags: " << FLAGS
+                 << ", JIT stack size: " << JIT_STACK_SIZE << endl;
+
+            bsls::Types::Int64 expectedMatched = -1;
+
+            for (int numThreads = 1; numThreads <= 16; numThreads *= 2) {
+                bsl::vector<ThroughputJob>             jobs(numThreads);
+                bsl::vector<bslmt::ThreadUtil::Handle> handles(numThreads);
+
+                for (int ti = 0; ti < numThreads; ++ti) {
+                    ThroughputJob& job = jobs[ti];
+                    job.d_regExes_p  = &regExes;
+                    job.d_lines_p    = LINES;
+                    job.d_numLines   = k_NUM_LINES;
+                    job.d_iterations = ITERATIONS / numThreads;
+                    job.d_numMatched = 0;
+                }
+
+                const bsls::Types::Int64 NUM_ALLOCS = oa.numAllocations();
+
+                bsls::Stopwatch timer;
+                timer.start();
+                for (int ti = 0; ti < numThreads; ++ti) {
+                    ASSERT(0 == bslmt::ThreadUtil::create(&handles[ti],
+                                                          throughputFunction,
+                                                          &jobs[ti]));
+                }
+                for (int ti = 0; ti < numThreads; ++ti) {
+                    ASSERT(0 == bslmt::ThreadUtil::join(handles[ti]));
+                }
+                timer.stop();
+
+                const bsls::Types::Int64 numAllocs =
+                                           oa.numAllocations() - NUM_ALLOCS;
+
+                for (int ti = 0; ti < numThreads; ++ti) {
+                    const bsls::Types::Int64 perIteration =
+                                jobs[ti].d_numMatched / jobs[ti].d_iterations;
+                    if (-1 == expectedMatched) {
+                        expectedMatched = perIteration;
+                    }
+                    ASSERTV(numThreads, ti, expectedMatched == perIteration);
+                }
+
+                const double numMatches = static_cast<double>(
+                                      (ITERATIONS / numThreads) * numThreads)
+                                        * k_NUM_LINES * k_NUM_PATTERNS;
+
+                cout << "  threads: " << numThreads
+                     << ", 'match' calls/s: "
+                     << static_cast<bsls::Types::Int64>(
+                                          numMatches / timer.elapsedTime())
+                     << ", allocations per match: "
+                     << static_cast<double>(numAllocs) / numMatches
+                     << endl;
+            }
+
+            for (int pi = 0; pi < k_NUM_PATTERNS; ++pi) {
+                oa.deleteObject(objects[pi]);
+            }
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
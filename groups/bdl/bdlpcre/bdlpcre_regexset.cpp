@@ -0,0 +1,955 @@
+// bdlpcre_regexset.cpp                                               -*-C++-*-
+#include <bdlpcre_regexset.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlpcre_regexset_cpp,"$Id$ $CSID$")
+
+///IMPLEMENTATION NOTES
+///--------------------
+// The patterns of a set are compiled into a single PCRE2 pattern, in which
+// the pattern at index 'i' becomes the alternative:
+//..
+//  (?>pattern)(?C"i")
+//..
+// Once an alternative has matched, PCRE2 calls the callout function installed
+// by 'match' or 'matchAll', which reads the index of the pattern from the
+// callout string.  The atomic group ensures that a pattern matching at a
+// starting position reaches its callout once, instead of once per way the
+// pattern can match there.
+//
+// Since nothing follows the callout of an alternative, the callout last called
+// by a successful match is that of the matched alternative: the callout
+// function installed by 'match' records the index and proceeds.  The callout
+// function installed by 'matchAll' records the index and fails, so that PCRE2
+// tries the remaining alternatives, and then the following starting
+// positions; it aborts the match once every pattern has matched.
+//
+// The index of the pattern is not recorded with a '(*MARK)' preceding the
+// pattern, nor are patterns that already matched pruned by a callout
+// preceding the pattern: a '(*MARK)' prevents PCRE2 from computing the set of
+// code units starting a match, which lets it skip the starting positions at
+// which no pattern can match, and a callout preceding every pattern would
+// be called at every starting position, whether or not the pattern matches.
+//
+// The match buffers are cached in slots, each thread being assigned a slot
+// round-robin the first time it matches, as described in the implementation
+// notes of 'bdlpcre_regex'.
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+
+#include <bslmt_threadlocalvariable.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomicoperations.h>
+#include <bsls_exceptionutil.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstring.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+namespace {
+
+                              // ================
+                              // struct MatchData
+                              // ================
+
+struct MatchData {
+    // This 'struct' holds the state of a call to 'match' or 'matchAll',
+    // passed to the callout function.
+
+    // DATA
+    char *d_matched_p;    // 'd_matched_p[i]' is non-zero if pattern 'i'
+                          // matched, or 0 for a call to 'match'
+
+    int   d_numPatterns;  // number of patterns in the set
+
+    int   d_numMatched;   // number of patterns that matched
+
+    int   d_lastIndex;    // index of the pattern that matched last
+};
+
+enum {
+    k_ALL_MATCHED = PCRE2_ERROR_CALLOUT  // returned by the callout to abort a
+                                         // match in which every pattern has
+                                         // matched
+};
+
+}  // close unnamed namespace
+
+extern "C" {
+
+static void *bdlpcre_regexset_malloc(size_t size, void *context)
+{
+    void *result = 0;
+
+    BloombergLP::bslma::Allocator *basicAllocator =
+                    reinterpret_cast<BloombergLP::bslma::Allocator *>(context);
+    BSLS_TRY {
+        result = basicAllocator->allocate(size);
+    } BSLS_CATCH( ... ) {
+    }
+
+    return result;
+}
+
+static void bdlpcre_regexset_free(void *data, void *context)
+{
+    BloombergLP::bslma::Allocator *basicAllocator =
+                    reinterpret_cast<BloombergLP::bslma::Allocator *>(context);
+
+    basicAllocator->deallocate(data);
+}
+
+static int bdlpcre_regexset_callout(pcre2_callout_block *block, void *data)
+    // Record the pattern identified by the callout string of the specified
+    // 'block' in the specified 'data' (a 'MatchData').  Return 0 to proceed
+    // if 'data' is that of a call to 'match', and otherwise a positive value
+    // to fail the match at this point, or 'k_ALL_MATCHED' to abort the match
+    // if every pattern has matched.
+{
+    MatchData *matchData = static_cast<MatchData *>(data);
+
+    int index = 0;
+    for (PCRE2_SIZE i = 0; i < block->callout_string_length; ++i) {
+        index = index * 10 + (block->callout_string[i] - '0');
+    }
+    BSLS_ASSERT(index < matchData->d_numPatterns);
+
+    matchData->d_lastIndex = index;
+
+    if (0 == matchData->d_matched_p) {
+        return 0;                                                     // RETURN
+    }
+
+    if (!matchData->d_matched_p[index]) {
+        matchData->d_matched_p[index] = 1;
+        if (++matchData->d_numMatched == matchData->d_numPatterns) {
+            return k_ALL_MATCHED;                                     // RETURN
+        }
+    }
+
+    return 1;
+}
+
+}  // close extern "C"
+
+namespace BloombergLP {
+namespace bdlpcre {
+namespace {
+
+enum {
+    k_SUCCESS              =  0,
+    k_DEPTHLIMITFAILURE    =  1,
+    k_JITSTACKLIMITFAILURE =  2,
+    k_FAILURE              = -1
+};
+    // Return values for this API.
+
+enum {
+    k_LOCAL_MATCHED_SIZE = 256  // number of patterns for which 'matchAll'
+                                // records the matched patterns in a local
+                                // array, rather than in allocated memory
+};
+
+bsls::AtomicOperations::AtomicTypes::Uint s_nextSlotIndex = { 0 };
+    // index of the slot to assign to the next thread
+
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+BSLMT_THREAD_LOCAL_VARIABLE(int, t_slotIndex, -1);
+    // slot assigned to the current thread, or -1 if not yet assigned
+#endif
+
+int currentSlotIndex(int numSlots)
+    // Return the index of the slot caching the match buffers of the calling
+    // thread among the specified 'numSlots' slots.  The behavior is undefined
+    // unless 'numSlots' is a power of 2.
+{
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+    if (0 > t_slotIndex) {
+        const unsigned int count =
+                     bsls::AtomicOperations::addUintNv(&s_nextSlotIndex, 1);
+        t_slotIndex = static_cast<int>(count - 1) & 0x7fffffff;
+    }
+    return t_slotIndex & (numSlots - 1);
+#else
+    // Thread ids are often addresses, so use their high-order bits.
+
+    const bsls::Types::Uint64 hash = bslmt::ThreadUtil::selfIdAsUint64()
+                                   * 0x9E3779B97F4A7C15ULL;
+    return static_cast<int>(hash >> 33) & (numSlots - 1);
+#endif
+}
+
+void loadErrorMessage(bsl::string *errorMessage, int errorCode)
+    // Load the specified 'errorMessage', if not null, with the PCRE2 message
+    // describing the specified 'errorCode'.
+{
+    if (0 == errorMessage) {
+        return;                                                       // RETURN
+    }
+
+    unsigned char errorBuffer[256];
+
+    const int length = pcre2_get_error_message(errorCode,
+                                               errorBuffer,
+                                               sizeof errorBuffer);
+    if (0 < length) {
+        errorMessage->assign(reinterpret_cast<const char *>(errorBuffer),
+                             length);
+    }
+    else {
+        errorMessage->assign("");
+    }
+}
+
+char charAt(const bsl::string& pattern, size_t position)
+    // Return the character at the specified 'position' in the specified
+    // 'pattern', or 0 if 'position' is not less than the length of 'pattern'.
+{
+    return position < pattern.length() ? pattern[position] : 0;
+}
+
+bool isDigit(char character)
+    // Return 'true' if the specified 'character' is a decimal digit, and
+    // 'false' otherwise.
+{
+    return '0' <= character && character <= '9';
+}
+
+size_t skipQuotation(const bsl::string& pattern, size_t position)
+    // Return the position in the specified 'pattern' following the '\E'
+    // ending the quotation whose text starts at the specified 'position', or
+    // the length of 'pattern' if the quotation is not ended.
+{
+    const size_t end = pattern.find("\\E", position);
+    return bsl::string::npos == end ? pattern.length() : end + 2;
+}
+
+size_t skipClass(const bsl::string& pattern, size_t position)
+    // Return the position in the specified 'pattern' following the ']'
+    // ending the character class whose text starts at the specified
+    // 'position' (following the opening '['), or the length of 'pattern' if
+    // the class is not ended.
+{
+    if ('^' == charAt(pattern, position)) {
+        ++position;
+    }
+    if (']' == charAt(pattern, position)) {
+        ++position;  // a leading ']' is a literal
+    }
+
+    while (position < pattern.length()) {
+        const char character = pattern[position];
+
+        if ('\\' == character) {
+            position = 'Q' == charAt(pattern, position + 1)
+                       ? skipQuotation(pattern, position + 2)
+                       : position + 2;
+        }
+        else if ('[' == character && ':' == charAt(pattern, position + 1)) {
+            // POSIX class, e.g., '[:alpha:]'
+
+            const size_t end = pattern.find(":]", position + 2);
+            position = bsl::string::npos == end ? position + 1 : end + 2;
+        }
+        else if (']' == character) {
+            return position + 1;                                      // RETURN
+        }
+        else {
+            ++position;
+        }
+    }
+
+    return position;
+}
+
+bool isVerb(const bsl::string& pattern, size_t position)
+    // Return 'true' if the specified 'pattern' has, at the specified
+    // 'position' (following an opening '(*'), the name of a backtracking
+    // control verb, and 'false' otherwise (e.g., for an option setting at the
+    // start of a pattern, such as '(*UTF)').
+{
+    static const char *const k_VERBS[] = {
+        "", "ACCEPT", "COMMIT", "F", "FAIL", "MARK", "PRUNE", "SKIP", "THEN"
+    };  // "" is the '(*:NAME)' abbreviation of '(*MARK:NAME)'
+
+    const size_t end = pattern.find_first_of(":)", position);
+    if (bsl::string::npos == end) {
+        return false;                                                 // RETURN
+    }
+
+    for (size_t i = 0; i < sizeof k_VERBS / sizeof *k_VERBS; ++i) {
+        if (0 == pattern.compare(position, end - position, k_VERBS[i])) {
+            return true;                                              // RETURN
+        }
+    }
+    return false;
+}
+
+const char *findUnsupportedConstruct(size_t             *offset,
+                                     const bsl::string&  pattern,
+                                     int                 numCaptureGroups)
+    // Return a message describing the first construct of the specified
+    // valid 'pattern', having the specified 'numCaptureGroups' capture
+    // groups, that is not supported in a set of patterns, and load its offset
+    // in 'pattern' into the specified 'offset'; return 0, and leave 'offset'
+    // unchanged, if 'pattern' has no such construct.  Note that the
+    // constructs are recognized outside of quotations, character classes, and
+    // comments, except that comments of the extended syntax ('(?x)') are
+    // scanned as if they were part of the pattern.
+{
+    size_t position = 0;
+
+    while (position < pattern.length()) {
+        const size_t start = position;
+        const char   next  = charAt(pattern, position + 1);
+
+        switch (pattern[position]) {
+          case '\\': {
+            if ('Q' == next) {
+                position = skipQuotation(pattern, position + 2);
+            }
+            else if ('1' <= next && next <= '9') {
+                // '\N' is a back reference if 'N' is less than 10, or if the
+                // pattern has at least 'N' capture groups; otherwise it is an
+                // octal character code.
+
+                int number = 0;
+                ++position;
+                while (isDigit(charAt(pattern, position))) {
+                    if (number < 100000) {
+                        number = number * 10 + (pattern[position] - '0');
+                    }
+                    ++position;
+                }
+                if (number < 10 || number <= numCaptureGroups) {
+                    *offset = start;
+                    return "numbered back reference is not supported in a "
+                           "pattern set";                             // RETURN
+                }
+            }
+            else if ('g' == next) {
+                // '\gN', '\g{N}', '\g<N>', and '\g'N'', but not the relative
+                // forms (e.g., '\g{-1}') or the named forms
+
+                char first = charAt(pattern, position + 2);
+                if ('{' == first || '<' == first || '\'' == first) {
+                    first = charAt(pattern, position + 3);
+                }
+                if (isDigit(first)) {
+                    *offset = start;
+                    return "numbered back reference or subroutine call is "
+                           "not supported in a pattern set";          // RETURN
+                }
+                position += 2;
+            }
+            else {
+                position += 'c' == next ? 3 : 2;  // '\cX' is a control code
+            }
+          } break;
+          case '[': {
+            position = skipClass(pattern, position + 1);
+          } break;
+          case '(': {
+            const char third = charAt(pattern, position + 2);
+
+            if ('?' == next && '#' == third) {
+                const size_t end = pattern.find(')', position + 3);
+                position = bsl::string::npos == end ? pattern.length()
+                                                    : end + 1;
+            }
+            else if ('?' == next && (isDigit(third) || 'R' == third)) {
+                *offset = start;
+                return "numbered subroutine call or recursion is not "
+                       "supported in a pattern set";                  // RETURN
+            }
+            else if ('?' == next
+                  && '(' == third
+                  && isDigit(charAt(pattern, position + 3))) {
+                *offset = start;
+                return "numbered group condition is not supported in a "
+                       "pattern set";                                 // RETURN
+            }
+            else if ('?' == next && 'C' == third) {
+                *offset = start;
+                return "callout is not supported in a pattern set";   // RETURN
+            }
+            else if ('*' == next && isVerb(pattern, position + 2)) {
+                *offset = start;
+                return "backtracking control verb is not supported in a "
+                       "pattern set";                                 // RETURN
+            }
+            else {
+                ++position;
+            }
+          } break;
+          default: {
+            ++position;
+          } break;
+        }
+    }
+
+    return 0;
+}
+
+bool endsInComment(const bsl::string&     pattern,
+                   unsigned int           pcreFlags,
+                   pcre2_compile_context *compileContext)
+    // Return 'true' if the specified valid 'pattern', compiled with the
+    // specified 'pcreFlags' and 'compileContext', ends within an
+    // extended-mode comment (e.g., "(?x)a # note"), which would extend over
+    // whatever follows the pattern, and 'false' otherwise.
+{
+    if (bsl::string::npos == pattern.find('#')) {
+        return false;                                                 // RETURN
+    }
+
+    bsl::string enclosed(pattern.get_allocator());
+    enclosed += "(?:";
+    enclosed += pattern;
+    enclosed += "\\E)";
+
+    int         errorCode;
+    PCRE2_SIZE  errorOffset;
+    pcre2_code *code = pcre2_compile(
+                      reinterpret_cast<const unsigned char*>(enclosed.data()),
+                      enclosed.length(),
+                      pcreFlags,
+                      &errorCode,
+                      &errorOffset,
+                      compileContext);
+    if (0 == code) {
+        return true;                                                  // RETURN
+    }
+    pcre2_code_free(code);
+    return false;
+}
+
+}  // close unnamed namespace
+
+                              // --------------
+                              // class RegExSet
+                              // --------------
+
+// PRIVATE MANIPULATORS
+void RegExSet::deallocateCachedBuffers()
+{
+    for (int i = 0; i < k_NUM_CACHED_BUFFERS; ++i) {
+        MatchBuffers *buffers = d_slots[i].d_buffers.swapAcqRel(0);
+        if (buffers) {
+            deallocateBuffers(buffers);
+        }
+    }
+}
+
+// PRIVATE ACCESSORS
+RegExSet::MatchBuffers *RegExSet::acquireBuffers() const
+{
+    BufferSlot& slot = d_slots[currentSlotIndex(k_NUM_CACHED_BUFFERS)];
+
+    MatchBuffers *buffers = slot.d_buffers.swapAcqRel(0);
+    if (buffers) {
+        return buffers;                                               // RETURN
+    }
+
+    return allocateBuffers();
+}
+
+RegExSet::MatchBuffers *RegExSet::allocateBuffers() const
+{
+    BSLS_ASSERT(d_patternCode_p);
+
+    MatchBuffers *buffers = 0;
+    BSLS_TRY {
+        buffers = static_cast<MatchBuffers *>(
+                               d_allocator_p->allocate(sizeof(MatchBuffers)));
+    } BSLS_CATCH( ... ) {
+        return 0;                                                     // RETURN
+    }
+
+    pcre2_match_data *matchData = pcre2_match_data_create_from_pattern(
+                                                              d_patternCode_p,
+                                                              0);
+    if (0 == matchData) {
+        d_allocator_p->deallocate(buffers);
+        return 0;                                                     // RETURN
+    }
+
+    pcre2_match_context *matchContext = pcre2_match_context_create(
+                                                             d_pcre2Context_p);
+    if (0 == matchContext) {
+        pcre2_match_data_free(matchData);
+        d_allocator_p->deallocate(buffers);
+        return 0;                                                     // RETURN
+    }
+
+    pcre2_set_match_limit(matchContext, d_depthLimit);
+
+    pcre2_jit_stack *jitStack = 0;
+    if (d_jitStackSize) {
+        jitStack = pcre2_jit_stack_create(d_jitStackSize,
+                                          d_jitStackSize,
+                                          d_pcre2Context_p);
+        if (0 == jitStack) {
+            pcre2_match_context_free(matchContext);
+            pcre2_match_data_free(matchData);
+            d_allocator_p->deallocate(buffers);
+            return 0;                                                 // RETURN
+        }
+        pcre2_jit_stack_assign(matchContext, 0, jitStack);
+    }
+
+    buffers->d_matchContext_p = matchContext;
+    buffers->d_matchData_p    = matchData;
+    buffers->d_jitStack_p     = jitStack;
+
+    return buffers;
+}
+
+void RegExSet::deallocateBuffers(MatchBuffers *buffers) const
+{
+    BSLS_ASSERT(buffers);
+
+    pcre2_match_data_free(buffers->d_matchData_p);
+    pcre2_jit_stack_free(buffers->d_jitStack_p);
+    pcre2_match_context_free(buffers->d_matchContext_p);
+
+    d_allocator_p->deallocate(buffers);
+}
+
+int RegExSet::privateMatch(const MatchBuffers&  buffers,
+                           const char          *subject,
+                           size_t               subjectLength,
+                           size_t               subjectOffset) const
+{
+    const unsigned char *actualSubject =
+               reinterpret_cast<const unsigned char*>(subject ? subject : "");
+
+    const int returnValue = pcre2_match(d_patternCode_p,
+                                        actualSubject,
+                                        subjectLength,
+                                        subjectOffset,
+                                        0,
+                                        buffers.d_matchData_p,
+                                        buffers.d_matchContext_p);
+
+    if (0 <= returnValue) {
+        return k_SUCCESS;                                             // RETURN
+    }
+    if (k_ALL_MATCHED == returnValue) {
+        return k_SUCCESS;                                             // RETURN
+    }
+    if (PCRE2_ERROR_MATCHLIMIT == returnValue) {
+        return k_DEPTHLIMITFAILURE;                                   // RETURN
+    }
+    if (PCRE2_ERROR_JIT_STACKLIMIT == returnValue) {
+        return k_JITSTACKLIMITFAILURE;                                // RETURN
+    }
+    return k_FAILURE;
+}
+
+void RegExSet::releaseBuffers(MatchBuffers *buffers) const
+{
+    BSLS_ASSERT(buffers);
+
+    BufferSlot& slot = d_slots[currentSlotIndex(k_NUM_CACHED_BUFFERS)];
+
+    if (0 != slot.d_buffers.testAndSwapAcqRel(0, buffers)) {
+        deallocateBuffers(buffers);
+    }
+}
+
+// CREATORS
+RegExSet::RegExSet(bslma::Allocator *basicAllocator)
+: d_flags(0)
+, d_patterns(basicAllocator)
+, d_pcre2Context_p(0)
+, d_compileContext_p(0)
+, d_patternCode_p(0)
+, d_depthLimit(RegEx::defaultDepthLimit())
+, d_jitStackSize(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    d_pcre2Context_p = pcre2_general_context_create(
+                                           &bdlpcre_regexset_malloc,
+                                           &bdlpcre_regexset_free,
+                                           static_cast<void *>(d_allocator_p));
+    BSLS_ASSERT(0 != d_pcre2Context_p);
+
+    d_compileContext_p = pcre2_compile_context_create(d_pcre2Context_p);
+    BSLS_ASSERT(0 != d_compileContext_p);
+}
+
+RegExSet::~RegExSet()
+{
+    clear();
+    pcre2_compile_context_free(d_compileContext_p);
+    pcre2_general_context_free(d_pcre2Context_p);
+}
+
+// MANIPULATORS
+void RegExSet::clear()
+{
+    if (isPrepared()) {
+        deallocateCachedBuffers();
+        pcre2_code_free(d_patternCode_p);
+        d_patternCode_p = 0;
+        d_flags         = 0;
+        d_jitStackSize  = 0;
+        d_patterns.clear();
+    }
+}
+
+int RegExSet::prepare(bsl::string                     *errorMessage,
+                      size_t                          *errorOffset,
+                      int                             *errorPatternIndex,
+                      const bsl::vector<bsl::string>&  patterns,
+                      int                              flags,
+                      size_t                           jitStackSize)
+{
+    const int VALID_FLAGS = RegEx::k_FLAG_CASELESS
+                          | RegEx::k_FLAG_DOTMATCHESALL
+                          | RegEx::k_FLAG_MULTILINE
+                          | RegEx::k_FLAG_UTF8
+                          | RegEx::k_FLAG_JIT;
+    (void) VALID_FLAGS;
+
+    BSLS_ASSERT(0 == (flags & ~VALID_FLAGS));
+
+    clear();
+
+    const bool useJit = (flags & RegEx::k_FLAG_JIT)
+                                                    && RegEx::isJitAvailable();
+
+    unsigned int pcreFlags = 0;
+    pcreFlags |= flags & RegEx::k_FLAG_CASELESS      ? PCRE2_CASELESS  : 0;
+    pcreFlags |= flags & RegEx::k_FLAG_DOTMATCHESALL ? PCRE2_DOTALL    : 0;
+    pcreFlags |= flags & RegEx::k_FLAG_MULTILINE     ? PCRE2_MULTILINE : 0;
+    pcreFlags |= flags & RegEx::k_FLAG_UTF8          ? PCRE2_UTF       : 0;
+
+    int        errorCode;
+    PCRE2_SIZE pcreErrorOffset;
+
+    // Compile each pattern alone, to report its errors in its own terms, and
+    // build the combined pattern, noting where each pattern starts in it.
+
+    bsl::string         combined(d_allocator_p);
+    bsl::vector<size_t> starts(d_allocator_p);
+
+    for (size_t i = 0; i < patterns.size(); ++i) {
+        const bsl::string& pattern = patterns[i];
+
+        pcre2_code *code = pcre2_compile(
+                        reinterpret_cast<const unsigned char*>(pattern.data()),
+                         pattern.length(),
+                         pcreFlags,
+                         &errorCode,
+                         &pcreErrorOffset,
+                         d_compileContext_p);
+        if (0 == code) {
+            loadErrorMessage(errorMessage, errorCode);
+            if (errorOffset) {
+                *errorOffset = pcreErrorOffset;
+            }
+            if (errorPatternIndex) {
+                *errorPatternIndex = static_cast<int>(i);
+            }
+            return k_FAILURE;                                         // RETURN
+        }
+
+        uint32_t numCaptureGroups = 0;
+        pcre2_pattern_info(code, PCRE2_INFO_CAPTURECOUNT, &numCaptureGroups);
+        pcre2_code_free(code);
+
+        // Reject the constructs that would not behave in the combined pattern
+        // as they do in the pattern alone (see "Restrictions on Patterns" in
+        // the component documentation).
+
+        size_t      constructOffset;
+        const char *unsupported = findUnsupportedConstruct(
+                                       &constructOffset,
+                                       pattern,
+                                       static_cast<int>(numCaptureGroups));
+        if (unsupported) {
+            if (errorMessage) {
+                errorMessage->assign(unsupported);
+            }
+            if (errorOffset) {
+                *errorOffset = constructOffset;
+            }
+            if (errorPatternIndex) {
+                *errorPatternIndex = static_cast<int>(i);
+            }
+            return k_FAILURE;                                         // RETURN
+        }
+
+        if (0 != i) {
+            combined += '|';
+        }
+        combined += "(?>";
+        starts.push_back(combined.length());
+        combined += pattern;
+
+        // A pattern ending within an extended-mode comment would comment out
+        // the end of its alternative: the comment is ended by a newline
+        // (which, in extended mode, is not matched).  A pattern ending within
+        // a '\Q' quotation would quote the closing parenthesis, which is
+        // therefore preceded by a '\E' (ignored outside of a quotation).
+
+        if (endsInComment(pattern, pcreFlags, d_compileContext_p)) {
+            combined += '\n';
+        }
+
+        combined += "\\E)(?C\"";
+        combined += bsl::to_string(i);
+        combined += "\")";
+    }
+
+    if (patterns.empty()) {
+        combined = "(*FAIL)";
+    }
+
+    pcre2_code *patternCode = pcre2_compile(
+                       reinterpret_cast<const unsigned char*>(combined.data()),
+                        combined.length(),
+                        pcreFlags,
+                        &errorCode,
+                        &pcreErrorOffset,
+                        d_compileContext_p);
+
+    if (0 == patternCode) {
+        // Attribute the error to the pattern containing its offset.
+
+        loadErrorMessage(errorMessage, errorCode);
+
+        const bsl::vector<size_t>::const_iterator next =
+                     bsl::upper_bound(starts.begin(), starts.end(),
+                                      static_cast<size_t>(pcreErrorOffset));
+        const int index = static_cast<int>(next - starts.begin()) - 1;
+
+        if (0 <= index
+         && pcreErrorOffset <= starts[index] + patterns[index].length()) {
+            if (errorOffset) {
+                *errorOffset = pcreErrorOffset - starts[index];
+            }
+            if (errorPatternIndex) {
+                *errorPatternIndex = index;
+            }
+        }
+        else {
+            if (errorOffset) {
+                *errorOffset = 0;
+            }
+            if (errorPatternIndex) {
+                *errorPatternIndex = -1;
+            }
+        }
+        return k_FAILURE;                                             // RETURN
+    }
+
+    if (useJit && 0 != pcre2_jit_compile(patternCode, PCRE2_JIT_COMPLETE)) {
+        pcre2_code_free(patternCode);
+        if (errorMessage) {
+            errorMessage->assign("JIT compilation failed.");
+        }
+        if (errorOffset) {
+            *errorOffset = 0;
+        }
+        if (errorPatternIndex) {
+            *errorPatternIndex = -1;
+        }
+        return k_FAILURE;                                             // RETURN
+    }
+
+    d_patternCode_p = patternCode;
+    d_jitStackSize  = useJit ? jitStackSize : 0;
+
+    MatchBuffers *buffers = allocateBuffers();
+    if (0 == buffers) {
+        pcre2_code_free(d_patternCode_p);
+        d_patternCode_p = 0;
+        d_jitStackSize  = 0;
+        if (errorMessage) {
+            errorMessage->assign("Unable to create match contexts.");
+        }
+        if (errorOffset) {
+            *errorOffset = 0;
+        }
+        if (errorPatternIndex) {
+            *errorPatternIndex = -1;
+        }
+        return k_FAILURE;                                             // RETURN
+    }
+
+    d_slots[currentSlotIndex(k_NUM_CACHED_BUFFERS)].d_buffers = buffers;
+    d_flags    = flags;
+    d_patterns = patterns;
+
+    return k_SUCCESS;
+}
+
+int RegExSet::setDepthLimit(int depthLimit)
+{
+    const int previous = d_depthLimit;
+
+    d_depthLimit = depthLimit;
+
+    for (int i = 0; i < k_NUM_CACHED_BUFFERS; ++i) {
+        MatchBuffers *buffers = d_slots[i].d_buffers;
+        if (buffers) {
+            pcre2_set_match_limit(buffers->d_matchContext_p, d_depthLimit);
+        }
+    }
+
+    return previous;
+}
+
+// ACCESSORS
+int RegExSet::match(int        *patternIndex,
+                    const char *subject,
+                    size_t      subjectLength,
+                    size_t      subjectOffset) const
+{
+    BSLS_ASSERT(patternIndex);
+
+    bsl::pair<size_t, size_t> result;
+    return match(patternIndex, &result, subject, subjectLength, subjectOffset);
+}
+
+int RegExSet::match(int                       *patternIndex,
+                    bsl::pair<size_t, size_t> *result,
+                    const char                *subject,
+                    size_t                     subjectLength,
+                    size_t                     subjectOffset) const
+{
+    BSLS_ASSERT(patternIndex);
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(subject || 0 == subjectLength);
+    BSLS_ASSERT(subjectOffset <= subjectLength);
+    BSLS_ASSERT(isPrepared());
+
+    MatchBuffers *buffers = acquireBuffers();
+
+    if (0 == buffers) {
+        return k_FAILURE;                                             // RETURN
+    }
+
+    MatchData data;
+    data.d_matched_p   = 0;
+    data.d_numPatterns = numPatterns();
+    data.d_numMatched  = 0;
+    data.d_lastIndex   = -1;
+
+    pcre2_set_callout(buffers->d_matchContext_p,
+                      &bdlpcre_regexset_callout,
+                      &data);
+
+    const int rc = privateMatch(*buffers,
+                                subject,
+                                subjectLength,
+                                subjectOffset);
+
+    if (k_SUCCESS == rc) {
+        *patternIndex = data.d_lastIndex;
+
+        const PCRE2_SIZE *ovector =
+                            pcre2_get_ovector_pointer(buffers->d_matchData_p);
+        *result = bsl::make_pair(ovector[0], ovector[1] - ovector[0]);
+    }
+
+    releaseBuffers(buffers);
+
+    return rc;
+}
+
+int RegExSet::matchAll(bsl::vector<int> *patternIndices,
+                       const char       *subject,
+                       size_t            subjectLength,
+                       size_t            subjectOffset) const
+{
+    BSLS_ASSERT(patternIndices);
+    BSLS_ASSERT(subject || 0 == subjectLength);
+    BSLS_ASSERT(subjectOffset <= subjectLength);
+    BSLS_ASSERT(isPrepared());
+
+    const int numPatterns = this->numPatterns();
+
+    if (0 == numPatterns) {
+        return k_FAILURE;                                             // RETURN
+    }
+
+    // Record the matched patterns in a local array, unless there are too many
+    // patterns.
+
+    char              localMatched[k_LOCAL_MATCHED_SIZE];
+    bsl::vector<char> allocatedMatched(d_allocator_p);
+
+    MatchData data;
+    if (numPatterns <= k_LOCAL_MATCHED_SIZE) {
+        data.d_matched_p = localMatched;
+    }
+    else {
+        allocatedMatched.resize(numPatterns);
+        data.d_matched_p = allocatedMatched.data();
+    }
+    bsl::memset(data.d_matched_p, 0, numPatterns);
+    data.d_numPatterns = numPatterns;
+    data.d_numMatched  = 0;
+    data.d_lastIndex   = -1;
+
+    MatchBuffers *buffers = acquireBuffers();
+
+    if (0 == buffers) {
+        return k_FAILURE;                                             // RETURN
+    }
+
+    pcre2_set_callout(buffers->d_matchContext_p,
+                      &bdlpcre_regexset_callout,
+                      &data);
+
+    // Every alternative fails at its callout, so that the match succeeds only
+    // if aborted once every pattern has matched.
+
+    int rc = privateMatch(*buffers, subject, subjectLength, subjectOffset);
+
+    releaseBuffers(buffers);
+
+    if (k_FAILURE == rc && 0 < data.d_numMatched) {
+        rc = k_SUCCESS;
+    }
+
+    if (k_SUCCESS == rc) {
+        patternIndices->clear();
+        patternIndices->reserve(data.d_numMatched);
+        for (int i = 0; i < numPatterns; ++i) {
+            if (data.d_matched_p[i]) {
+                patternIndices->push_back(i);
+            }
+        }
+    }
+
+    return rc;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
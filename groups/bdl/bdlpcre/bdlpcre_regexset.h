@@ -0,0 +1,466 @@
+// bdlpcre_regexset.h                                                 -*-C++-*-
+#ifndef INCLUDED_BDLPCRE_REGEXSET
+#define INCLUDED_BDLPCRE_REGEXSET
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+//@PURPOSE: Provide a mechanism matching a subject against many patterns.
+//
+//@CLASSES:
+//  bdlpcre::RegExSet: mechanism matching a set of patterns in a single scan
+//
+//@SEE_ALSO: bdlpcre_regex, http://www.pcre.org/
+//
+//@DESCRIPTION: This component provides a mechanism, 'bdlpcre::RegExSet', for
+// compiling (or "preparing") a set of regular expressions, and subsequently
+// matching subject strings against all of them in a single scan of each
+// subject.  The regular expressions have the syntax supported by
+// 'bdlpcre::RegEx' (see 'bdlpcre_regex').
+//
+// Matching a subject against each of N patterns prepared in as many
+// 'bdlpcre::RegEx' objects scans the subject N times, and pays N times the
+// fixed cost of a match (obtaining the match data buffers, setting up the
+// match, and, if the subject does not match, trying every starting position).
+// 'bdlpcre::RegExSet' instead compiles the patterns into a single PCRE2
+// pattern, an alternation of the patterns in which each alternative is
+// followed by a callout naming its index, so that a subject is scanned once,
+// and the pattern (or patterns) that matched are identified by their
+// callouts.  The combined pattern is JIT-compiled if 'RegEx::k_FLAG_JIT' is
+// supplied to 'prepare' (and JIT is available).
+//
+// Two kinds of matches are provided:
+//: 1 'match' finds the leftmost match of any of the patterns, and loads the
+//:   index of the pattern that matched.  If several patterns match at the
+//:   leftmost position, the index of the first of them (in the order supplied
+//:   to 'prepare') is loaded.
+//:
+//: 2 'matchAll' loads the indices of all the patterns that match anywhere in
+//:   the subject.  The scan stops as soon as every pattern has matched.
+//
+///"Prepared" State
+///----------------
+// A 'bdlpcre::RegExSet' object must be prepared with a valid set of patterns
+// before attempting to match subject strings.  Upon construction, a
+// 'bdlpcre::RegExSet' object is in the "unprepared" state.  A successful call
+// to the 'prepare' method puts the object into the "prepared" state.  The
+// 'clear' method, as well as an unsuccessful call to 'prepare', puts the
+// object into the "unprepared" state.  A set of zero patterns can be prepared;
+// no subject matches it.
+//
+///Restrictions on Patterns
+///------------------------
+// Each pattern is first compiled alone, so that a syntax error is reported
+// with the index of the offending pattern, and the offset of the error within
+// that pattern.  Each pattern is then enclosed in an atomic group, and
+// combined with the others.  Since the patterns share a single compiled
+// pattern, the following constructs, which are valid in a 'bdlpcre::RegEx',
+// are not supported in a 'bdlpcre::RegExSet':
+//
+//: o Numbered back references, subroutine calls, and group conditions
+//:   (e.g., '\1', '(?1)', or '(?(1)...)') would refer to the sub-patterns of
+//:   the combined pattern, whose numbers differ from those of the pattern
+//:   alone, and a recursion ('(?R)') would recurse into the combined pattern.
+//:   Relative references (e.g., '\g{-1}'), and named references, are not
+//:   affected.
+//:
+//: o The names of sub-patterns must be distinct across all of the patterns of
+//:   the set.
+//:
+//: o Callouts (e.g., '(?C1)') are used to identify the alternatives, and must
+//:   not appear in the patterns.  Neither may backtracking control verbs
+//:   (e.g., '(*PRUNE)', '(*SKIP)', or '(*COMMIT)'), whose effect would extend
+//:   to the alternatives of the other patterns.
+//:
+//: o Options at the start of a pattern that apply to a whole compiled pattern
+//:   (e.g., '(*UTF)' or '(*CRLF)') cannot be applied to one alternative.
+//:   Flags set by an internal option setting (e.g., '(?i)') apply to the
+//:   rest of the pattern in which they appear, as for a 'bdlpcre::RegEx'.
+//
+// 'prepare' fails if a pattern uses one of these constructs, and reports the
+// index of the pattern, and the offset of the construct in that pattern.
+//
+// Note that a pattern matches a subject in a 'bdlpcre::RegExSet' if and only
+// if it matches the subject alone (prepared with the same flags) in a
+// 'bdlpcre::RegEx', provided it does not use the constructs listed above.
+//
+///Thread Safety
+///-------------
+// 'bdlpcre::RegExSet' is *const* *thread-safe*, meaning that accessors
+// (including 'match' and 'matchAll') may be invoked concurrently from
+// different threads, but it is not safe to access or modify a
+// 'bdlpcre::RegExSet' in one thread while another thread modifies the same
+// object.
+//
+// As for 'bdlpcre::RegEx', the match data buffers (and the JIT stack, if one
+// was requested) are cached by the object in a small, fixed number of slots,
+// and each thread reuses the buffers of its slot from one call to 'match' or
+// 'matchAll' to the next, so that, after its first call, a thread allocates
+// no memory (unless more threads match concurrently than there are slots, or
+// 'matchAll' is called for a set of more than 256 patterns).
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Classifying Log Records
+/// - - - - - - - - - - - - - - - - -
+// Suppose that we classify the lines of a log according to a set of patterns,
+// each describing a kind of event.  First, we prepare a set holding the
+// patterns:
+//..
+//  bsl::vector<bsl::string> patterns;
+//  patterns.push_back("connection (?:refused|reset)");   // 0
+//  patterns.push_back("timeout after [0-9]+ ?ms");       // 1
+//  patterns.push_back("^ERROR");                         // 2
+//  patterns.push_back("user=[a-z]+");                    // 3
+//
+//  bdlpcre::RegExSet regExSet;
+//  bsl::string       errorMessage;
+//  size_t            errorOffset;
+//  int               errorPatternIndex;
+//
+//  int rc = regExSet.prepare(&errorMessage,
+//                            &errorOffset,
+//                            &errorPatternIndex,
+//                            patterns,
+//                            bdlpcre::RegEx::k_FLAG_JIT);
+//  assert(0 == rc);
+//  assert(4 == regExSet.numPatterns());
+//..
+// Then, we find the first kind of event described by a log line, i.e., the
+// pattern matching the leftmost part of the line:
+//..
+//  const char LINE[] = "ERROR user=alice: connection reset by peer";
+//
+//  int patternIndex;
+//  rc = regExSet.match(&patternIndex, LINE, sizeof(LINE) - 1);
+//  assert(0 == rc);
+//  assert(2 == patternIndex);
+//..
+// Next, we find all of the kinds of events described by the line, in a single
+// scan of the line:
+//..
+//  bsl::vector<int> patternIndices;
+//  rc = regExSet.matchAll(&patternIndices, LINE, sizeof(LINE) - 1);
+//  assert(0 == rc);
+//  assert(3 == patternIndices.size());
+//  assert(0 == patternIndices[0]);
+//  assert(2 == patternIndices[1]);
+//  assert(3 == patternIndices[2]);
+//..
+// Finally, we observe that a line matching none of the patterns is reported as
+// not matching:
+//..
+//  const char OTHER[] = "INFO heartbeat";
+//  assert(0 != regExSet.match(&patternIndex, OTHER, sizeof(OTHER) - 1));
+//  assert(0 != regExSet.matchAll(&patternIndices,
+//                                OTHER,
+//                                sizeof(OTHER) - 1));
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlpcre_regex.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_platform.h>
+
+#include <bsls_atomic.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_string.h>
+#include <bsl_utility.h>        // 'bsl::pair'
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+
+namespace bdlpcre {
+
+                              // ==============
+                              // class RegExSet
+                              // ==============
+
+class RegExSet {
+    // This class provides a mechanism for compiling a set of regular
+    // expressions into a single pattern, and matching subject strings against
+    // all of them in a single scan.  See the component documentation for
+    // details.
+
+    // PRIVATE TYPES
+    struct MatchBuffers {
+        // This 'struct' holds the PCRE2 buffers used by one match.
+
+        pcre2_match_context *d_matchContext_p;  // PCRE2 match context
+        pcre2_match_data    *d_matchData_p;     // PCRE2 match data
+        pcre2_jit_stack     *d_jitStack_p;      // PCRE2 JIT stack, or 0
+    };
+
+    enum {
+        k_NUM_CACHED_BUFFERS = 16  // number of slots caching match buffers;
+                                   // must be a power of 2
+    };
+
+    struct BufferSlot {
+        // This 'struct' holds cached match buffers, alone in its cache line.
+
+        bsls::AtomicPointer<MatchBuffers>
+             d_buffers;               // cached buffers, or 0
+
+        char d_padding[bslmt::Platform::e_CACHE_LINE_SIZE -
+                       sizeof(bsls::AtomicPointer<MatchBuffers>)];
+                                      // padding to a cache line
+    };
+
+    // DATA
+    int                       d_flags;             // prepare flags
+
+    bsl::vector<bsl::string>  d_patterns;          // patterns of the set
+
+    pcre2_general_context    *d_pcre2Context_p;    // PCRE2 general context
+
+    pcre2_compile_context    *d_compileContext_p;  // PCRE2 compile context
+
+    pcre2_code               *d_patternCode_p;     // combined pattern, or 0
+
+    int                       d_depthLimit;        // match limit
+
+    size_t                    d_jitStackSize;      // JIT stack size, or 0
+
+    mutable BufferSlot        d_slots[k_NUM_CACHED_BUFFERS];
+                                                   // buffers cached for the
+                                                   // matching threads
+
+    bslma::Allocator         *d_allocator_p;       // memory allocator (held,
+                                                   // not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    RegExSet(const RegExSet&);
+    RegExSet& operator=(const RegExSet&);
+
+    // PRIVATE MANIPULATORS
+    void deallocateCachedBuffers();
+        // Deallocate the match buffers cached by this object.
+
+    // PRIVATE ACCESSORS
+    MatchBuffers *acquireBuffers() const;
+        // Return the address of match buffers usable by the calling thread,
+        // taken from the slot of the calling thread if it holds any, and
+        // allocated otherwise, or 0 if they cannot be allocated.
+
+    MatchBuffers *allocateBuffers() const;
+        // Allocate match buffers for the combined pattern, and return their
+        // address, or 0 if they cannot be allocated.
+
+    void deallocateBuffers(MatchBuffers *buffers) const;
+        // Deallocate the specified 'buffers'.
+
+    int privateMatch(const MatchBuffers&  buffers,
+                     const char          *subject,
+                     size_t               subjectLength,
+                     size_t               subjectOffset) const;
+        // Match the specified 'subject', having the specified 'subjectLength',
+        // against the combined pattern, beginning at the specified
+        // 'subjectOffset', using the specified 'buffers'.  Return 0 on
+        // success, 1 if the depth limit was exceeded, 2 if memory available
+        // for the JIT stack is not large enough, and another non-zero value
+        // otherwise.
+
+    void releaseBuffers(MatchBuffers *buffers) const;
+        // Release the specified 'buffers', obtained by 'acquireBuffers',
+        // caching them in the slot of the calling thread if it is empty, and
+        // deallocating them otherwise.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(RegExSet, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit RegExSet(bslma::Allocator *basicAllocator = 0);
+        // Create a regular-expression set object in the "unprepared" state.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.
+
+    ~RegExSet();
+        // Destroy this regular-expression set object.
+
+    // MANIPULATORS
+    void clear();
+        // Free resources used by this object and put this object into the
+        // "unprepared" state.  This method has no effect if this object is
+        // already in the "unprepared" state.
+
+    int prepare(bsl::string                     *errorMessage,
+                size_t                          *errorOffset,
+                int                             *errorPatternIndex,
+                const bsl::vector<bsl::string>&  patterns,
+                int                              flags = 0,
+                size_t                           jitStackSize = 0);
+        // Prepare this object with the specified 'patterns', and the
+        // optionally specified 'flags' and 'jitStackSize', having the same
+        // meaning as for 'RegEx::prepare', applied to all of the patterns.  On
+        // success, put this object into the "prepared" state and return 0,
+        // with no effect on the specified 'errorMessage', 'errorOffset', and
+        // 'errorPatternIndex'.  Otherwise, (1) put this object into the
+        // "unprepared" state, (2) load 'errorMessage' (if non-null) with a
+        // string describing the error detected, (3) load 'errorOffset' (if
+        // non-null) with the offset, in the offending pattern, at which the
+        // error was detected, (4) load 'errorPatternIndex' (if non-null) with
+        // the index of the offending pattern in 'patterns' (or -1 if the
+        // error is not specific to a pattern), and (5) return a non-zero
+        // value.  The behavior is undefined unless 'flags' is the bit-wise
+        // inclusive-or of 0 or more of the 'RegEx::k_FLAG_*' values.  Note
+        // that a pattern using one of the constructs listed in "Restrictions
+        // on Patterns" in the component documentation is an error.
+
+    int setDepthLimit(int depthLimit);
+        // Set the evaluation recursion depth limit for this object to the
+        // specified 'depthLimit'.  Return the previous depth limit.
+
+    // ACCESSORS
+    int depthLimit() const;
+        // Return the evaluation recursion depth limit for this object.
+
+    int flags() const;
+        // Return the flags that were supplied to the most recent successful
+        // call to the 'prepare' method of this object.  The behavior is
+        // undefined unless 'isPrepared() == true'.
+
+    bool isPrepared() const;
+        // Return 'true' if this object is in the "prepared" state, and 'false'
+        // otherwise.
+
+    size_t jitStackSize() const;
+        // Return the size of the JIT stack specified to the most recent
+        // successful call to 'prepare' with 'RegEx::k_FLAG_JIT' (if JIT is
+        // available), and 0 otherwise.
+
+    int match(int        *patternIndex,
+              const char *subject,
+              size_t      subjectLength,
+              size_t      subjectOffset = 0) const;
+    int match(int                       *patternIndex,
+              bsl::pair<size_t, size_t> *result,
+              const char                *subject,
+              size_t                     subjectLength,
+              size_t                     subjectOffset = 0) const;
+        // Find the leftmost match, in the specified 'subject' having the
+        // specified 'subjectLength', of any of the patterns of this set,
+        // beginning at the optionally specified 'subjectOffset' in 'subject'
+        // (or at the start of 'subject' if 'subjectOffset' is not specified).
+        // On success, load the specified 'patternIndex' with the index of the
+        // matching pattern (the lowest such index, if several patterns match
+        // at the leftmost position), optionally load the specified 'result'
+        // with the '(offset, length)' pair indicating the match, and return
+        // 0.  Otherwise, return a non-zero value with no effect on
+        // 'patternIndex' and 'result'.  The return value is 1 if the failure
+        // is caused by exceeding the depth limit, and 2 if memory available
+        // for the JIT stack is not large enough.  The behavior is undefined
+        // unless 'isPrepared() == true', 'subject || subjectLength == 0', and
+        // 'subjectOffset <= subjectLength'.  The behavior is also undefined if
+        // this object was prepared with 'RegEx::k_FLAG_UTF8', but 'subject' is
+        // not valid UTF-8.  Note that 'subject' need not be null-terminated
+        // and may contain embedded null characters.
+
+    int matchAll(bsl::vector<int> *patternIndices,
+                 const char       *subject,
+                 size_t            subjectLength,
+                 size_t            subjectOffset = 0) const;
+        // Load the specified 'patternIndices' with the indices, in increasing
+        // order, of the patterns of this set that match anywhere in the
+        // specified 'subject' having the specified 'subjectLength', beginning
+        // at the optionally specified 'subjectOffset' in 'subject' (or at the
+        // start of 'subject' if 'subjectOffset' is not specified), and return
+        // 0 if at least one pattern matches.  Otherwise, return a non-zero
+        // value with no effect on 'patternIndices'.  The return value is 1 if
+        // the failure is caused by exceeding the depth limit, and 2 if memory
+        // available for the JIT stack is not large enough.  The behavior is
+        // undefined unless 'isPrepared() == true',
+        // 'subject || subjectLength == 0', and
+        // 'subjectOffset <= subjectLength'.  The behavior is also undefined if
+        // this object was prepared with 'RegEx::k_FLAG_UTF8', but 'subject' is
+        // not valid UTF-8.  Note that 'subject' need not be null-terminated
+        // and may contain embedded null characters.
+
+    int numPatterns() const;
+        // Return the number of patterns of this set.  The behavior is
+        // undefined unless 'isPrepared() == true'.
+
+    const bsl::string& pattern(int index) const;
+        // Return a reference to the non-modifiable pattern at the specified
+        // 'index' in this set.  The behavior is undefined unless
+        // 'isPrepared() == true' and '0 <= index < numPatterns()'.
+};
+
+// ============================================================================
+//                              INLINE DEFINITIONS
+// ============================================================================
+
+                              // --------------
+                              // class RegExSet
+                              // --------------
+
+// ACCESSORS
+inline
+int RegExSet::depthLimit() const
+{
+    return d_depthLimit;
+}
+
+inline
+int RegExSet::flags() const
+{
+    return d_flags;
+}
+
+inline
+bool RegExSet::isPrepared() const
+{
+    return 0 != d_patternCode_p;
+}
+
+inline
+size_t RegExSet::jitStackSize() const
+{
+    return d_jitStackSize;
+}
+
+inline
+int RegExSet::numPatterns() const
+{
+    return static_cast<int>(d_patterns.size());
+}
+
+inline
+const bsl::string& RegExSet::pattern(int index) const
+{
+    return d_patterns[index];
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
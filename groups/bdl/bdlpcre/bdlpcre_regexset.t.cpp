@@ -0,0 +1,1338 @@
+// bdlpcre_regexset.t.cpp                                             -*-C++-*-
+#include <bdlpcre_regexset.h>
+
+#include <bdlpcre_regex.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_threadutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                 TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test is a mechanism that compiles a set of regular
+// expressions into a single PCRE2 pattern.  The results of matching a subject
+// against the set are verified against those of matching the subject against
+// each pattern alone, prepared in a 'bdlpcre::RegEx' object, for a table of
+// patterns and subjects, with and without JIT.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] RegExSet(bslma::Allocator *basicAllocator = 0);
+// [ 2] ~RegExSet();
+//
+// MANIPULATORS
+// [ 2] void clear();
+// [ 2] int prepare(string *, size_t *, int *, const vector<string>&, ...);
+// [ 3] int setDepthLimit(int);
+//
+// ACCESSORS
+// [ 3] int depthLimit() const;
+// [ 2] int flags() const;
+// [ 2] bool isPrepared() const;
+// [ 2] size_t jitStackSize() const;
+// [ 3] int match(int *, const char *, size_t, size_t) const;
+// [ 3] int match(int *, pair<size_t, size_t> *, const char *, ...) const;
+// [ 4] int matchAll(vector<int> *, const char *, size_t, size_t) const;
+// [ 2] int numPatterns() const;
+// [ 2] const bsl::string& pattern(int) const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] CONCERN: 'match' AND 'matchAll' ARE THREAD-SAFE
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE: SET VERSUS SEPARATE PATTERNS
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                       GLOBAL TEST VALUES
+// ----------------------------------------------------------------------------
+
+static bool verbose;
+static bool veryVerbose;
+static bool veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+// ============================================================================
+//                     GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlpcre::RegExSet Obj;
+typedef bdlpcre::RegEx    RegEx;
+
+typedef bsl::pair<size_t, size_t> Range;
+
+static const char *const PATTERNS[] = {
+    "abc",                                 //  0
+    "^ERROR",                              //  1
+    "[0-9]{3,}",                           //  2
+    "(a|b)+c",                             //  3
+    "x(?<name>y+)z",                       //  4
+    "(?i)Warn(?:ing)?",                    //  5
+    "colou?r",                             //  6
+    "\\bend$",                             //  7
+    "\\Qa.b",                              //  8
+    "(\\w)\\g{-1}",                        //  9
+    "q*",                                  // 10
+};
+enum { NUM_PATTERNS = sizeof PATTERNS / sizeof *PATTERNS };
+
+static const char *const SUBJECTS[] = {
+    "",
+    "abc",
+    "ERROR: abc 1234",
+    "no error here",
+    "xyyz and a.b",
+    "WARNING: color 12",
+    "bbc warn the end",
+    "aab",
+    "hello",
+    "the colour of 99 end",
+    "xz yz xyz",
+};
+enum { NUM_SUBJECTS = sizeof SUBJECTS / sizeof *SUBJECTS };
+
+// ============================================================================
+//                       GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+bsl::vector<bsl::string> patternVector(int numPatterns = NUM_PATTERNS)
+    // Return a vector holding the first specified 'numPatterns' patterns of
+    // 'PATTERNS'.
+{
+    bsl::vector<bsl::string> result;
+    for (int i = 0; i < numPatterns; ++i) {
+        result.push_back(PATTERNS[i]);
+    }
+    return result;
+}
+
+void expectedMatches(bsl::vector<int>                *allIndices,
+                     int                             *firstIndex,
+                     bsl::pair<size_t, size_t>       *firstMatch,
+                     const bsl::vector<bsl::string>&  patterns,
+                     const char                      *subject,
+                     int                              flags)
+    // Load the specified 'allIndices' with the indices of the specified
+    // 'patterns' that match the specified 'subject' when prepared alone with
+    // the specified 'flags' in a 'bdlpcre::RegEx', the specified 'firstIndex'
+    // with the index of the first of the patterns having the leftmost match
+    // (or -1 if no pattern matches), and the specified 'firstMatch' with the
+    // leftmost match.
+{
+    allIndices->clear();
+    *firstIndex = -1;
+
+    const size_t length = bsl::strlen(subject);
+
+    for (int i = 0; i < static_cast<int>(patterns.size()); ++i) {
+        RegEx regEx;
+        int   rc = regEx.prepare(0, 0, patterns[i].c_str(), flags);
+        ASSERTV(i, 0 == rc);
+
+        bsl::pair<size_t, size_t> match;
+        if (0 == regEx.match(&match, subject, length)) {
+            allIndices->push_back(i);
+            if (-1 == *firstIndex || match.first < firstMatch->first) {
+                *firstIndex = i;
+                *firstMatch = match;
+            }
+        }
+    }
+}
+
+                            // ===============
+                            // struct MatchJob
+                            // ===============
+
+struct MatchJob {
+    // This 'struct' matches the subjects of 'SUBJECTS' against a prepared set
+    // in a thread, and verifies the results.
+
+    // DATA
+    const Obj                *d_set_p;       // prepared set
+    const bsl::vector<int>   *d_expected_p;  // expected 'match' index per
+                                             // subject
+    const bsl::vector<bsl::vector<int> >
+                             *d_expectedAll_p;
+                                             // expected 'matchAll' indices per
+                                             // subject
+};
+
+extern "C" void *matchThread(void *arg)
+    // Match the subjects against the set held by the specified 'arg' (a
+    // 'MatchJob'), and verify the results.
+{
+    const MatchJob *job = static_cast<const MatchJob *>(arg);
+
+    for (int iteration = 0; iteration < 200; ++iteration) {
+        for (int si = 0; si < NUM_SUBJECTS; ++si) {
+            const char   *SUBJECT = SUBJECTS[si];
+            const size_t  LENGTH  = bsl::strlen(SUBJECT);
+
+            int index = -1;
+            int rc    = job->d_set_p->match(&index, SUBJECT, LENGTH);
+            ASSERTV(si, (*job->d_expected_p)[si], index,
+                    (*job->d_expected_p)[si] == (0 == rc ? index : -1));
+
+            bsl::vector<int> indices;
+            rc = job->d_set_p->matchAll(&indices, SUBJECT, LENGTH);
+            ASSERTV(si, (*job->d_expectedAll_p)[si] == indices);
+            ASSERTV(si, indices.empty() == (0 != rc));
+        }
+    }
+    return 0;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+
+    verbose             = argc > 2;
+    veryVerbose         = argc > 3;
+    veryVeryVerbose     = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::Default::setDefaultAllocatorRaw(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Classifying Log Records
+/// - - - - - - - - - - - - - - - - -
+// Suppose that we classify the lines of a log according to a set of patterns,
+// each describing a kind of event.  First, we prepare a set holding the
+// patterns:
+//..
+    bsl::vector<bsl::string> patterns;
+    patterns.push_back("connection (?:refused|reset)");   // 0
+    patterns.push_back("timeout after [0-9]+ ?ms");       // 1
+    patterns.push_back("^ERROR");                         // 2
+    patterns.push_back("user=[a-z]+");                    // 3
+
+    bdlpcre::RegExSet regExSet;
+    bsl::string       errorMessage;
+    size_t            errorOffset;
+    int               errorPatternIndex;
+
+    int rc = regExSet.prepare(&errorMessage,
+                              &errorOffset,
+                              &errorPatternIndex,
+                              patterns,
+                              bdlpcre::RegEx::k_FLAG_JIT);
+    ASSERT(0 == rc);
+    ASSERT(4 == regExSet.numPatterns());
+//..
+// Then, we find the first kind of event described by a log line, i.e., the
+// pattern matching the leftmost part of the line:
+//..
+    const char LINE[] = "ERROR user=alice: connection reset by peer";
+
+    int patternIndex;
+    rc = regExSet.match(&patternIndex, LINE, sizeof(LINE) - 1);
+    ASSERT(0 == rc);
+    ASSERT(2 == patternIndex);
+//..
+// Next, we find all of the kinds of events described by the line, in a single
+// scan of the line:
+//..
+    bsl::vector<int> patternIndices;
+    rc = regExSet.matchAll(&patternIndices, LINE, sizeof(LINE) - 1);
+    ASSERT(0 == rc);
+    ASSERT(3 == patternIndices.size());
+    ASSERT(0 == patternIndices[0]);
+    ASSERT(2 == patternIndices[1]);
+    ASSERT(3 == patternIndices[2]);
+//..
+// Finally, we observe that a line matching none of the patterns is reported as
+// not matching:
+//..
+    const char OTHER[] = "INFO heartbeat";
+    ASSERT(0 != regExSet.match(&patternIndex, OTHER, sizeof(OTHER) - 1));
+    ASSERT(0 != regExSet.matchAll(&patternIndices,
+                                  OTHER,
+                                  sizeof(OTHER) - 1));
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCERN: 'match' AND 'matchAll' ARE THREAD-SAFE
+        //
+        // Concerns:
+        //: 1 'match' and 'matchAll' can be called concurrently from several
+        //:   threads (other than the thread that prepared the set), with and
+        //:   without JIT.
+        //
+        // Plan:
+        //: 1 Prepare a set, compute the expected results of each subject, and
+        //:   match the subjects concurrently from several threads, verifying
+        //:   the results.  (C-1)
+        //
+        // Testing:
+        //   CONCERN: 'match' AND 'matchAll' ARE THREAD-SAFE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: 'match' AND 'matchAll' ARE THREAD-SAFE"
+                          << endl
+                          << "==============================================="
+                          << endl;
+
+        const bsl::vector<bsl::string> patterns = patternVector();
+
+        for (int cfg = 0; cfg < 3; ++cfg) {
+            const int    FLAGS     = 0 == cfg ? 0 : RegEx::k_FLAG_JIT;
+            const size_t JIT_STACK = 2 == cfg ? 32 * 1024 : 0;
+
+            if (veryVerbose) { T_ P_(FLAGS) P(JIT_STACK) }
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            Obj mX(&oa);  const Obj& X = mX;
+            ASSERTV(cfg,
+                    0 == mX.prepare(0, 0, 0, patterns, FLAGS, JIT_STACK));
+
+            bsl::vector<int>               expected(NUM_SUBJECTS);
+            bsl::vector<bsl::vector<int> > expectedAll(NUM_SUBJECTS);
+            for (int si = 0; si < NUM_SUBJECTS; ++si) {
+                bsl::pair<size_t, size_t> match;
+                expectedMatches(&expectedAll[si],
+                                &expected[si],
+                                &match,
+                                patterns,
+                                SUBJECTS[si],
+                                FLAGS);
+            }
+
+            MatchJob job = { &X, &expected, &expectedAll };
+
+            enum { k_NUM_THREADS = 8 };
+            bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::create(&handles[i],
+                                                      matchThread,
+                                                      &job));
+            }
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+            }
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'matchAll'
+        //
+        // Concerns:
+        //: 1 'matchAll' loads, in increasing order, the indices of exactly the
+        //:   patterns that match the subject alone, with and without JIT, and
+        //:   returns 0 if and only if at least one pattern matches.
+        //:
+        //: 2 'matchAll' begins matching at the supplied offset.
+        //:
+        //: 3 On failure, 'matchAll' has no effect on the loaded indices.
+        //:
+        //: 4 'matchAll' supports a set of more patterns than it records in a
+        //:   local array.
+        //:
+        //: 5 A set of zero patterns matches no subject.
+        //:
+        //: 6 'matchAll' allocates no memory from the default allocator, and,
+        //:   from the thread that prepared the set, for a set of less than
+        //:   257 patterns, no memory at all.
+        //:
+        //: 7 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For every subject of a table, and every number of the patterns
+        //:   of a table, compare the indices loaded by 'matchAll' with those
+        //:   of the patterns matching the subject alone in a
+        //:   'bdlpcre::RegEx'.  (C-1, 6)
+        //:
+        //: 2 Match a subject from a non-zero offset.  (C-2)
+        //:
+        //: 3 Match a subject matching no pattern, and verify that the indices
+        //:   are unchanged.  (C-3)
+        //:
+        //: 4 Prepare a set of 300 literal patterns, and match subjects
+        //:   containing some of them.  (C-4)
+        //:
+        //: 5 Prepare an empty set, and match subjects.  (C-5)
+        //:
+        //: 6 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-7)
+        //
+        // Testing:
+        //   int matchAll(vector<int> *, const char *, size_t, size_t) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'matchAll'" << endl
+                          << "==================" << endl;
+
+        for (int cfg = 0; cfg < 2; ++cfg) {
+            const int FLAGS = 0 == cfg ? 0 : RegEx::k_FLAG_JIT;
+
+            if (verbose) cout << "\nComparing with separate patterns, flags "
+                              << FLAGS << "." << endl;
+
+            for (int np = 1; np <= NUM_PATTERNS; ++np) {
+                const bsl::vector<bsl::string> patterns = patternVector(np);
+
+                bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+                Obj mX(&oa);  const Obj& X = mX;
+                ASSERTV(np, 0 == mX.prepare(0, 0, 0, patterns, FLAGS));
+
+                for (int si = 0; si < NUM_SUBJECTS; ++si) {
+                    const char   *SUBJECT = SUBJECTS[si];
+                    const size_t  LENGTH  = bsl::strlen(SUBJECT);
+
+                    bsl::vector<int>          expected;
+                    int                       expectedFirst;
+                    bsl::pair<size_t, size_t> firstMatch;
+                    expectedMatches(&expected,
+                                    &expectedFirst,
+                                    &firstMatch,
+                                    patterns,
+                                    SUBJECT,
+                                    FLAGS);
+
+                    bsl::vector<int> indices(&oa);
+                    indices.reserve(NUM_PATTERNS);
+
+                    const bsls::Types::Int64 NUM_ALLOCS =
+                                                     oa.numAllocations();
+                    const bsls::Types::Int64 NUM_DEFAULT_ALLOCS =
+                                       defaultAllocator.numAllocations();
+
+                    const int rc = X.matchAll(&indices, SUBJECT, LENGTH);
+
+                    ASSERTV(np, si, NUM_ALLOCS == oa.numAllocations());
+                    ASSERTV(np, si, NUM_DEFAULT_ALLOCS ==
+                                          defaultAllocator.numAllocations());
+
+                    if (veryVeryVerbose) {
+                        T_ P_(np) P_(SUBJECT) P_(rc) P(indices.size())
+                    }
+
+                    ASSERTV(np, si, expected.empty() == (0 != rc));
+                    if (0 == rc) {
+                        ASSERTV(np, si, expected == indices);
+                    }
+                }
+            }
+        }
+
+        const bsl::vector<bsl::string> patterns = patternVector();
+
+        if (verbose) cout << "\nMatching from an offset." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+            ASSERT(0 == mX.prepare(0, 0, 0, patterns));
+
+            const char SUBJECT[] = "abc xyz";
+
+            bsl::vector<int> indices;
+            ASSERT(0 == X.matchAll(&indices, SUBJECT, sizeof SUBJECT - 1));
+            ASSERT(4 == indices.size());   // 0, 3, 4, 10
+            ASSERT(0 == X.matchAll(&indices, SUBJECT, sizeof SUBJECT - 1, 1));
+            ASSERT(3 == indices.size());   // 3, 4, 10
+            ASSERT( 3 == indices[0]);
+            ASSERT( 4 == indices[1]);
+            ASSERT(10 == indices[2]);
+        }
+
+        if (verbose) cout << "\nNo effect on failure." << endl;
+        {
+            bsl::vector<bsl::string> literals;
+            literals.push_back("abc");
+            literals.push_back("def");
+
+            Obj mX;  const Obj& X = mX;
+            ASSERT(0 == mX.prepare(0, 0, 0, literals));
+
+            bsl::vector<int> indices(3, 7);
+            ASSERT(0 != X.matchAll(&indices, "xyz", 3));
+            ASSERT(bsl::vector<int>(3, 7) == indices);
+            ASSERT(0 != X.matchAll(&indices, "abc", 3, 1));
+            ASSERT(bsl::vector<int>(3, 7) == indices);
+            ASSERT(0 == X.matchAll(&indices, "defabc", 6));
+            ASSERT(2 == indices.size());
+        }
+
+        if (verbose) cout << "\nMany patterns." << endl;
+        {
+            enum { k_NUM_LITERALS = 300 };
+
+            bsl::vector<bsl::string> literals;
+            for (int i = 0; i < k_NUM_LITERALS; ++i) {
+                bsl::ostringstream oss;
+                oss << "<" << i << ">";
+                literals.push_back(oss.str());
+            }
+
+            for (int cfg = 0; cfg < 2; ++cfg) {
+                const int FLAGS = 0 == cfg ? 0 : RegEx::k_FLAG_JIT;
+
+                Obj mX;  const Obj& X = mX;
+                ASSERT(0 == mX.prepare(0, 0, 0, literals, FLAGS));
+                ASSERT(k_NUM_LITERALS == X.numPatterns());
+
+                const char SUBJECT[] = "<299> <7> <7> <0> <300> <256>";
+
+                bsl::vector<int> indices;
+                ASSERT(0 == X.matchAll(&indices, SUBJECT, sizeof SUBJECT - 1));
+                ASSERTV(indices.size(), 4 == indices.size());
+                if (4 == indices.size()) {
+                    ASSERT(  0 == indices[0]);
+                    ASSERT(  7 == indices[1]);
+                    ASSERT(256 == indices[2]);
+                    ASSERT(299 == indices[3]);
+                }
+
+                int index;
+                ASSERT(0 == X.match(&index, SUBJECT, sizeof SUBJECT - 1));
+                ASSERT(299 == index);
+            }
+        }
+
+        if (verbose) cout << "\nEmpty set." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+            ASSERT(0 == mX.prepare(0, 0, 0, bsl::vector<bsl::string>()));
+            ASSERT(X.isPrepared());
+            ASSERT(0 == X.numPatterns());
+
+            bsl::vector<int> indices;
+            int              index;
+            ASSERT(0 != X.matchAll(&indices, "", 0));
+            ASSERT(0 != X.matchAll(&indices, "abc", 3));
+            ASSERT(0 != X.match(&index, "", 0));
+            ASSERT(0 != X.match(&index, "abc", 3));
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX;  const Obj& X = mX;
+
+            bsl::vector<int> indices;
+
+            ASSERT_FAIL(X.matchAll(&indices, "abc", 3));
+
+            ASSERT(0 == mX.prepare(0, 0, 0, patterns));
+
+            ASSERT_PASS(X.matchAll(&indices, "abc", 3));
+            ASSERT_FAIL(X.matchAll(0, "abc", 3));
+            ASSERT_PASS(X.matchAll(&indices, 0, 0));
+            ASSERT_FAIL(X.matchAll(&indices, 0, 1));
+            ASSERT_PASS(X.matchAll(&indices, "abc", 3, 3));
+            ASSERT_FAIL(X.matchAll(&indices, "abc", 3, 4));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'match'
+        //
+        // Concerns:
+        //: 1 'match' loads the index of the first of the patterns having the
+        //:   leftmost match in the subject, and the '(offset, length)' pair
+        //:   of that match, with and without JIT.
+        //:
+        //: 2 'match' begins matching at the supplied offset.
+        //:
+        //: 3 On failure, 'match' has no effect on its results.
+        //:
+        //: 4 'match' reports exceeding the depth limit.
+        //:
+        //: 5 'match' allocates no memory from the thread that prepared the
+        //:   set.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For every subject of a table, compare the index and the match
+        //:   loaded by 'match' with those computed by matching each pattern
+        //:   alone in a 'bdlpcre::RegEx'.  (C-1, 5)
+        //:
+        //: 2 Match a subject from non-zero offsets.  (C-2)
+        //:
+        //: 3 Match subjects matching no pattern.  (C-3)
+        //:
+        //: 4 Set a small depth limit, and match a subject requiring
+        //:   backtracking.  (C-4)
+        //:
+        //: 5 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-6)
+        //
+        // Testing:
+        //   int match(int *, const char *, size_t, size_t) const;
+        //   int match(int *, pair<size_t, size_t> *, const char *, ...) const;
+        //   int setDepthLimit(int);
+        //   int depthLimit() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'match'" << endl
+                          << "===============" << endl;
+
+        const bsl::vector<bsl::string> patterns = patternVector();
+
+        for (int cfg = 0; cfg < 2; ++cfg) {
+            const int FLAGS = 0 == cfg ? 0 : RegEx::k_FLAG_JIT;
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            Obj mX(&oa);  const Obj& X = mX;
+            ASSERT(0 == mX.prepare(0, 0, 0, patterns, FLAGS));
+
+            for (int si = 0; si < NUM_SUBJECTS; ++si) {
+                const char   *SUBJECT = SUBJECTS[si];
+                const size_t  LENGTH  = bsl::strlen(SUBJECT);
+
+                bsl::vector<int>          expectedAll;
+                int                       EXP_INDEX;
+                bsl::pair<size_t, size_t> EXP_MATCH;
+                expectedMatches(&expectedAll,
+                                &EXP_INDEX,
+                                &EXP_MATCH,
+                                patterns,
+                                SUBJECT,
+                                FLAGS);
+
+                const bsls::Types::Int64 NUM_ALLOCS = oa.numAllocations();
+
+                int                       index = -1;
+                bsl::pair<size_t, size_t> match(99, 99);
+                const int rc = X.match(&index, &match, SUBJECT, LENGTH);
+
+                ASSERTV(si, NUM_ALLOCS == oa.numAllocations());
+
+                if (veryVeryVerbose) {
+                    T_ P_(SUBJECT) P_(rc) P_(index) P(EXP_INDEX)
+                }
+
+                if (-1 == EXP_INDEX) {
+                    ASSERTV(si, 0 != rc);
+                    ASSERTV(si, -1 == index);
+                    ASSERTV(si, Range(99, 99) == match);
+                }
+                else {
+                    ASSERTV(si, 0 == rc);
+                    ASSERTV(si, EXP_INDEX, index, EXP_INDEX == index);
+                    ASSERTV(si, EXP_MATCH == match);
+                }
+
+                int index2 = -1;
+                ASSERTV(si, rc == X.match(&index2, SUBJECT, LENGTH));
+                ASSERTV(si, index == index2);
+            }
+        }
+
+        if (verbose) cout << "\nMatching from an offset." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+            ASSERT(0 == mX.prepare(0, 0, 0, patterns));
+
+            const char SUBJECT[] = "123 abc";
+
+            int                       index;
+            bsl::pair<size_t, size_t> match;
+
+            ASSERT(0 == X.match(&index, &match, SUBJECT, 7));
+            ASSERT(2 == index);
+            ASSERT(Range(0, 3) == match);
+
+            ASSERT(0 == X.match(&index, &match, SUBJECT, 7, 1));
+            ASSERT(10 == index);                       // "q*" at offset 1
+            ASSERT(Range(1, 0) == match);
+        }
+
+        if (verbose) cout << "\nNo match." << endl;
+        {
+            bsl::vector<bsl::string> literals;
+            literals.push_back("abc");
+            literals.push_back("[0-9]+");
+
+            Obj mX;  const Obj& X = mX;
+            ASSERT(0 == mX.prepare(0, 0, 0, literals));
+
+            int                       index = 7;
+            bsl::pair<size_t, size_t> match(8, 9);
+            ASSERT(0 != X.match(&index, &match, "xyz", 3));
+            ASSERT(0 != X.match(&index, &match, "abc", 3, 1));
+            ASSERT(0 != X.match(&index, "ab", 2));
+            ASSERT(7 == index);
+            ASSERT(Range(8, 9) == match);
+
+            ASSERT(0 == X.match(&index, &match, "xx42abc", 7));
+            ASSERT(1 == index);
+            ASSERT(Range(2, 2) == match);
+        }
+
+        if (verbose) cout << "\nDepth limit." << endl;
+        {
+            bsl::vector<bsl::string> nested;
+            nested.push_back("a(\n)+b");
+
+            Obj mX;  const Obj& X = mX;
+            ASSERT(RegEx::defaultDepthLimit() == X.depthLimit());
+            ASSERT(0 == mX.prepare(0, 0, 0, nested));
+
+            ASSERT(RegEx::defaultDepthLimit() == mX.setDepthLimit(5));
+            ASSERT(5 == X.depthLimit());
+
+            const char SUBJECT[] = "a\n\n\n\n\nb";
+
+            int              index;
+            bsl::vector<int> indices;
+            ASSERT(1 == X.match(&index, SUBJECT, sizeof SUBJECT - 1));
+            ASSERT(1 == X.matchAll(&indices, SUBJECT, sizeof SUBJECT - 1));
+
+            ASSERT(5 == mX.setDepthLimit(RegEx::defaultDepthLimit()));
+            ASSERT(0 == X.match(&index, SUBJECT, sizeof SUBJECT - 1));
+            ASSERT(0 == X.matchAll(&indices, SUBJECT, sizeof SUBJECT - 1));
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX;  const Obj& X = mX;
+
+            int                       index;
+            bsl::pair<size_t, size_t> match;
+
+            ASSERT_FAIL(X.match(&index, "abc", 3));
+
+            ASSERT(0 == mX.prepare(0, 0, 0, patterns));
+
+            ASSERT_PASS(X.match(&index, "abc", 3));
+            ASSERT_FAIL(X.match(0, "abc", 3));
+            ASSERT_FAIL(X.match(&index, 0, "abc", 3));
+            ASSERT_PASS(X.match(&index, &match, 0, 0));
+            ASSERT_FAIL(X.match(&index, &match, 0, 1));
+            ASSERT_PASS(X.match(&index, &match, "abc", 3, 3));
+            ASSERT_FAIL(X.match(&index, &match, "abc", 3, 4));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'prepare' AND 'clear'
+        //
+        // Concerns:
+        //: 1 A newly created object is in the "unprepared" state, and uses
+        //:   the supplied allocator (or the default allocator).
+        //:
+        //: 2 A successful 'prepare' puts the object into the "prepared"
+        //:   state, and records the patterns, the flags, and the JIT stack
+        //:   size.
+        //:
+        //: 3 An unsuccessful 'prepare' puts the object into the "unprepared"
+        //:   state, and reports the index of the offending pattern, and the
+        //:   offset of the error in that pattern.
+        //:
+        //: 4 'clear' puts the object into the "unprepared" state.
+        //:
+        //: 5 All memory is supplied by the object allocator, and is released
+        //:   on destruction.
+        //:
+        //: 6 A pattern using a numbered back reference, subroutine call, or
+        //:   group condition, a recursion, a callout, or a backtracking
+        //:   control verb is rejected, and the index of the pattern and the
+        //:   offset of the construct are reported, but similar constructs
+        //:   that are supported (relative and named references, or text in a
+        //:   quotation, a character class, or a comment) are accepted.
+        //:
+        //: 7 A pattern ending within an extended-mode comment is accepted,
+        //:   and its comment does not extend over the following patterns.
+        //
+        // Plan:
+        //: 1 Create objects with and without an allocator, prepare them with
+        //:   valid and invalid sets of patterns, and verify the state and the
+        //:   reported errors.  (C-1..6)
+        //:
+        //: 2 Prepare a set of patterns ending within a comment in extended
+        //:   mode, or with a '#' outside of extended mode, and verify the
+        //:   index of the pattern matching each of a few subjects.  (C-7)
+        //
+        // Testing:
+        //   RegExSet(bslma::Allocator *basicAllocator = 0);
+        //   ~RegExSet();
+        //   void clear();
+        //   int prepare(string *, size_t *, int *, const vector<string>&,...);
+        //   int flags() const;
+        //   bool isPrepared() const;
+        //   size_t jitStackSize() const;
+        //   int numPatterns() const;
+        //   const bsl::string& pattern(int) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'prepare' AND 'clear'" << endl
+                          << "=============================" << endl;
+
+        const bsl::vector<bsl::string> patterns = patternVector();
+
+        if (verbose) cout << "\nValid patterns." << endl;
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+            bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+            const bsls::Types::Int64 NUM_DEFAULT_BLOCKS =
+                                             defaultAllocator.numBlocksInUse();
+            {
+                const bsl::vector<bsl::string> PATTERNS(patterns, &sa);
+
+                Obj mX(&oa);  const Obj& X = mX;
+                ASSERT(false == X.isPrepared());
+                ASSERT(NUM_DEFAULT_BLOCKS ==
+                                           defaultAllocator.numBlocksInUse());
+
+                bsl::string errorMessage(&sa);
+                size_t      errorOffset       = 99;
+                int         errorPatternIndex = 99;
+
+                ASSERT(0 == mX.prepare(&errorMessage,
+                                       &errorOffset,
+                                       &errorPatternIndex,
+                                       PATTERNS,
+                                       RegEx::k_FLAG_JIT,
+                                       16 * 1024));
+                ASSERT(X.isPrepared());
+                ASSERT(errorMessage.empty());
+                ASSERT(99 == errorOffset);
+                ASSERT(99 == errorPatternIndex);
+                ASSERT(RegEx::k_FLAG_JIT == X.flags());
+                ASSERT((RegEx::isJitAvailable() ? 16 * 1024 : 0) ==
+                                                             X.jitStackSize());
+                ASSERT(NUM_PATTERNS == X.numPatterns());
+                for (int i = 0; i < NUM_PATTERNS; ++i) {
+                    ASSERTV(i, PATTERNS[i] == X.pattern(i));
+                }
+                ASSERT(0 < oa.numBlocksInUse());
+                ASSERT(NUM_DEFAULT_BLOCKS ==
+                                           defaultAllocator.numBlocksInUse());
+
+                ASSERT(0 == mX.prepare(0,
+                                       0,
+                                       0,
+                                       PATTERNS,
+                                       RegEx::k_FLAG_CASELESS));
+                ASSERT(RegEx::k_FLAG_CASELESS == X.flags());
+                ASSERT(0 == X.jitStackSize());
+
+                mX.clear();
+                ASSERT(false == X.isPrepared());
+                mX.clear();
+                ASSERT(false == X.isPrepared());
+            }
+            ASSERT(0 == oa.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nDefault allocator." << endl;
+        {
+            const bsls::Types::Int64 NUM_BLOCKS =
+                                             defaultAllocator.numBlocksInUse();
+            {
+                Obj mX;
+                ASSERT(0 == mX.prepare(0, 0, 0, patterns));
+                ASSERT(NUM_BLOCKS < defaultAllocator.numBlocksInUse());
+            }
+            ASSERT(NUM_BLOCKS == defaultAllocator.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nInvalid patterns." << endl;
+        {
+            static const struct {
+                int         d_line;         // source line number
+                const char *d_patterns[3];  // patterns (null-terminated)
+                int         d_index;        // expected pattern index
+                size_t      d_offset;       // expected error offset
+            } DATA[] = {
+                //LINE  PATTERNS                     INDEX  OFFSET
+                //----  ---------------------------  -----  ------
+                { L_,   { "(abc", 0 },               0,     4      },
+                { L_,   { "abc", "a)|(b", 0 },       1,     1      },
+                { L_,   { "abc", "x", "[a-" },       2,     3      },
+                { L_,   { "(?<n>a)", "(?<n>b)", 0 }, 1,     5      },
+                { L_,   { "abc", "(a)\\1", 0 },      1,     3      },
+                { L_,   { "(a)(b)(c)(d)(e)(f)(g)(h)(i)(j)\\10", 0 },
+                                                     0,     30     },
+                { L_,   { "(a)\\g1", 0 },           0,     3      },
+                { L_,   { "(a)\\g{1}", 0 },         0,     3      },
+                { L_,   { "(a)\\g<1>", 0 },         0,     3      },
+                { L_,   { "x", "(a)b(?1)", 0 },      1,     4      },
+                { L_,   { "a(?R)?b", 0 },            0,     1      },
+                { L_,   { "(a)?(?(1)b|c)", 0 },      0,     4      },
+                { L_,   { "x", "y", "a(?C1)b" },     2,     1      },
+                { L_,   { "a(?C\"s\")b", 0 },        0,     1      },
+                { L_,   { "a(*PRUNE)b", 0 },         0,     1      },
+                { L_,   { "a(*COMMIT)", 0 },         0,     1      },
+                { L_,   { "(*:m)a", 0 },             0,     0      },
+                { L_,   { "x", "a(*SKIP:m)b", 0 },   1,     1      },
+            };
+            enum { NUM_DATA = sizeof DATA / sizeof *DATA };
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int    LINE   = DATA[ti].d_line;
+                const int    INDEX  = DATA[ti].d_index;
+                const size_t OFFSET = DATA[ti].d_offset;
+
+                bsl::vector<bsl::string> invalid;
+                for (int i = 0; i < 3 && DATA[ti].d_patterns[i]; ++i) {
+                    invalid.push_back(DATA[ti].d_patterns[i]);
+                }
+
+                bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+                {
+                    Obj mX(&oa);  const Obj& X = mX;
+                    ASSERT(0 == mX.prepare(0, 0, 0, patterns));
+
+                    bsl::string errorMessage;
+                    size_t      errorOffset       = 99;
+                    int         errorPatternIndex = 99;
+
+                    ASSERTV(LINE, 0 != mX.prepare(&errorMessage,
+                                                  &errorOffset,
+                                                  &errorPatternIndex,
+                                                  invalid));
+                    ASSERTV(LINE, false == X.isPrepared());
+                    ASSERTV(LINE, !errorMessage.empty());
+                    ASSERTV(LINE, INDEX, errorPatternIndex,
+                            INDEX == errorPatternIndex);
+                    ASSERTV(LINE, OFFSET, errorOffset,
+                            OFFSET == errorOffset);
+
+                    if (veryVerbose) { T_ P_(LINE) P(errorMessage) }
+
+                    ASSERTV(LINE, 0 != mX.prepare(0, 0, 0, invalid));
+                }
+                ASSERTV(LINE, 0 == oa.numBlocksInUse());
+            }
+        }
+
+        if (verbose) cout << "\nSupported look-alike constructs." << endl;
+        {
+            static const struct {
+                int         d_line;     // source line number
+                const char *d_pattern;  // pattern
+            } DATA[] = {
+                //LINE  PATTERN
+                //----  -------
+                { L_,   "(a)\\g{-1}"                },
+                { L_,   "(a)\\g-1"                  },
+                { L_,   "(a)(?-1)"                  },
+                { L_,   "(?+1)(a)"                  },
+                { L_,   "(a)\\g<-1>"                },
+                { L_,   "(?<n>a)\\k<n>(?&n)"        },
+                { L_,   "(?P<n>a)(?P=n)(?P>n)"      },
+                { L_,   "(?<n>a)?(?(<n>)b|c)"       },
+                { L_,   "\\12"                      },
+                { L_,   "\\Q(?1)\\1(*PRUNE)\\E"       },
+                { L_,   "[(?C1)\\1]"                },
+                { L_,   "[]\\Q]\\E(?R)]"              },
+                { L_,   "[[:alpha:](?1)]"           },
+                { L_,   "(?#\\1 (?C1)a"             },
+            };
+            enum { NUM_DATA = sizeof DATA / sizeof *DATA };
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE    = DATA[ti].d_line;
+                const char *const PATTERN = DATA[ti].d_pattern;
+
+                bsl::vector<bsl::string> valid;
+                valid.push_back("x(y)");
+                valid.push_back(PATTERN);
+
+                bsl::string errorMessage;
+                size_t      errorOffset       = 99;
+                int         errorPatternIndex = 99;
+
+                Obj mX;  const Obj& X = mX;
+                ASSERTV(LINE, errorMessage, errorOffset, errorPatternIndex,
+                        0 == mX.prepare(&errorMessage,
+                                        &errorOffset,
+                                        &errorPatternIndex,
+                                        valid));
+                ASSERTV(LINE, X.isPrepared());
+            }
+        }
+
+        if (verbose) cout << "\nPatterns ending in a comment." << endl;
+        {
+            bsl::vector<bsl::string> commented;
+            commented.push_back("(?x) a b # note");
+            commented.push_back("c # d");
+            commented.push_back("(?x)e#");
+            commented.push_back("(?x)f (?-x:g) # )");
+            commented.push_back("h(?x)#");
+
+            bsl::string errorMessage;
+            size_t      errorOffset       = 99;
+            int         errorPatternIndex = 99;
+
+            Obj mX;  const Obj& X = mX;
+            ASSERTV(errorMessage, errorOffset, errorPatternIndex,
+                    0 == mX.prepare(&errorMessage,
+                                    &errorOffset,
+                                    &errorPatternIndex,
+                                    commented));
+            ASSERT(X.isPrepared());
+
+            static const struct {
+                int         d_line;     // source line number
+                const char *d_subject;  // subject
+                int         d_index;    // index of matching pattern, or -1
+            } DATA[] = {
+                //LINE  SUBJECT     INDEX
+                //----  -------     -----
+                { L_,   "ab",        0   },
+                { L_,   "a b",      -1   },
+                { L_,   "c # d",     1   },
+                { L_,   "cd",       -1   },
+                { L_,   "e",         2   },
+                { L_,   "fg",        3   },
+                { L_,   "f g",      -1   },
+                { L_,   "h",         4   },
+                { L_,   "h\n",       4   },
+            };
+            enum { NUM_DATA = sizeof DATA / sizeof *DATA };
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE    = DATA[ti].d_line;
+                const char *const SUBJECT = DATA[ti].d_subject;
+                const int         INDEX   = DATA[ti].d_index;
+
+                int patternIndex = 99;
+                const int rc = X.match(&patternIndex,
+                                       SUBJECT,
+                                       bsl::strlen(SUBJECT));
+                if (0 <= INDEX) {
+                    ASSERTV(LINE, rc, 0 == rc);
+                    ASSERTV(LINE, patternIndex, INDEX == patternIndex);
+                }
+                else {
+                    ASSERTV(LINE, rc, 0 != rc);
+                }
+            }
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Prepare a set of patterns, and match a few subjects.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bsl::vector<bsl::string> patterns;
+        patterns.push_back("foo");
+        patterns.push_back("ba[rz]");
+        patterns.push_back("[0-9]+");
+
+        Obj mX;  const Obj& X = mX;
+        ASSERT(false == X.isPrepared());
+
+        ASSERT(0 == mX.prepare(0, 0, 0, patterns));
+        ASSERT(X.isPrepared());
+        ASSERT(3 == X.numPatterns());
+        ASSERT("ba[rz]" == X.pattern(1));
+
+        int index;
+        ASSERT(0 == X.match(&index, "a baz 12 foo", 12));
+        ASSERT(1 == index);
+
+        bsl::vector<int> indices;
+        ASSERT(0 == X.matchAll(&indices, "a baz 12 foo", 12));
+        ASSERT(3 == indices.size());
+
+        ASSERT(0 == X.matchAll(&indices, "123", 3));
+        ASSERT(1 == indices.size());
+        ASSERT(2 == indices[0]);
+
+        ASSERT(0 != X.match(&index, "nothing", 7));
+        ASSERT(0 != X.matchAll(&indices, "nothing", 7));
+
+        mX.clear();
+        ASSERT(false == X.isPrepared());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: SET VERSUS SEPARATE PATTERNS
+        //
+        // Concerns:
+        //: 1 Matching a subject against a set of patterns in a single scan is
+        //:   faster than matching it against each pattern separately.
+        //
+        // Plan:
+        //: 1 Prepare a set of patterns typical of log classification, both in
+        //:   a 'bdlpcre::RegExSet' and in separate 'bdlpcre::RegEx' objects
+        //:   (with JIT), and measure the time taken to find the patterns
+        //:   matching each of a corpus of log lines, from the thread that
+        //:   prepared the patterns and from another thread.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: SET VERSUS SEPARATE PATTERNS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: SET VERSUS SEPARATE PATTERNS"
+                          << endl
+                          << "========================================="
+                          << endl;
+
+        static const char *const LOG_PATTERNS[] = {
+            "connection (?:refused|reset|timed out)",
+            "timeout after [0-9]+ ?ms",
+            "^ERROR",
+            "^WARN",
+            "user=[a-z]+",
+            "\\b(?:[0-9]{1,3}\\.){3}[0-9]{1,3}\\b",
+            "status=5[0-9][0-9]",
+            "OutOfMemory",
+            "disk (?:full|quota exceeded)",
+            "retry [0-9]+/[0-9]+",
+            "latency=[0-9]{4,}us",
+            "checksum mismatch",
+            "segfault|SIGSEGV",
+            "deadlock detected",
+            "certificate (?:expired|revoked)",
+            "queue depth [0-9]{5,}",
+            "GC pause [0-9]+ms",
+            "permission denied",
+            "no route to host",
+            "invalid token",
+        };
+        enum { k_NUM_LOG_PATTERNS = sizeof LOG_PATTERNS /
+                                                        sizeof *LOG_PATTERNS };
+
+        static const char *const LINES[] = {
+            "INFO 2026-10-19 12:00:01 request served status=200 latency=87us",
+            "WARN 2026-10-19 12:00:02 retry 2/5 for 10.1.2.3 user=alice",
+            "ERROR 2026-10-19 12:00:03 connection reset by 192.168.0.7",
+            "INFO 2026-10-19 12:00:04 cache hit ratio 0.97 for shard 12",
+            "DEBUG 2026-10-19 12:00:05 parsed 1024 records in 3 batches",
+            "INFO 2026-10-19 12:00:06 served status=503 latency=9999us",
+            "ERROR 2026-10-19 12:00:07 timeout after 250 ms user=bob",
+            "INFO 2026-10-19 12:00:08 heartbeat ok",
+        };
+        enum { k_NUM_LINES = sizeof LINES / sizeof *LINES };
+
+        const int NUM_ITERATIONS = argc > 2 ? atoi(argv[2]) : 20000;
+
+        bsl::vector<bsl::string> patterns;
+        for (int i = 0; i < k_NUM_LOG_PATTERNS; ++i) {
+            patterns.push_back(LOG_PATTERNS[i]);
+        }
+
+        Obj mX;  const Obj& X = mX;
+        ASSERT(0 == mX.prepare(0, 0, 0, patterns, RegEx::k_FLAG_JIT));
+
+        bsl::vector<RegEx *> regExes;
+        for (int i = 0; i < k_NUM_LOG_PATTERNS; ++i) {
+            regExes.push_back(new RegEx());
+            ASSERT(0 == regExes.back()->prepare(0,
+                                                0,
+                                                LOG_PATTERNS[i],
+                                                RegEx::k_FLAG_JIT));
+        }
+
+        bsl::vector<size_t> lengths;
+        for (int li = 0; li < k_NUM_LINES; ++li) {
+            lengths.push_back(bsl::strlen(LINES[li]));
+        }
+
+        bsls::Stopwatch  timer;
+        bsl::vector<int> indices;
+        long             numMatched = 0;
+
+        timer.start(true);
+        for (int it = 0; it < NUM_ITERATIONS; ++it) {
+            for (int li = 0; li < k_NUM_LINES; ++li) {
+                for (int i = 0; i < k_NUM_LOG_PATTERNS; ++i) {
+                    if (0 == regExes[i]->match(LINES[li], lengths[li])) {
+                        ++numMatched;
+                    }
+                }
+            }
+        }
+        timer.stop();
+        const double separateTime = timer.accumulatedWallTime();
+
+        long numMatchedSet = 0;
+        timer.reset();
+        timer.start(true);
+        for (int it = 0; it < NUM_ITERATIONS; ++it) {
+            for (int li = 0; li < k_NUM_LINES; ++li) {
+                if (0 == X.matchAll(&indices, LINES[li], lengths[li])) {
+                    numMatchedSet += indices.size();
+                }
+            }
+        }
+        timer.stop();
+        const double setTime = timer.accumulatedWallTime();
+
+        ASSERTV(numMatched, numMatchedSet, numMatched == numMatchedSet);
+
+        const double numLines = static_cast<double>(NUM_ITERATIONS) *
+                                                                   k_NUM_LINES;
+
+        cout << "patterns: " << k_NUM_LOG_PATTERNS
+             << ", lines: " << numLines << endl
+             << "separate RegEx::match:  "
+             << separateTime / numLines * 1e9 << " ns/line" << endl
+             << "RegExSet::matchAll:     "
+             << setTime / numLines * 1e9 << " ns/line" << endl;
+
+        for (int i = 0; i < k_NUM_LOG_PATTERNS; ++i) {
+            delete regExes[i];
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
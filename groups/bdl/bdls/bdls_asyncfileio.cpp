@@ -0,0 +1,1242 @@
+// bdls_asyncfileio.cpp                                               -*-C++-*-
+#include <bdls_asyncfileio.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdls_asyncfileio_cpp,"$Id$ $CSID$")
+
+#include <bdlf_bind.h>
+
+#include <bslma_default.h>
+
+#include <bslmt_condition.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_atomicoperations.h>
+#include <bsls_platform.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstring.h>
+#include <bsl_deque.h>
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>
+#else
+#include <bsl_c_errno.h>
+
+#include <unistd.h>
+#endif
+
+#if defined(BSLS_PLATFORM_OS_LINUX) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+
+#if defined(IORING_FEAT_RW_CUR_POS) && defined(__NR_io_uring_setup)
+#define BDLS_ASYNCFILEIO_HAS_IO_URING 1
+#endif
+#endif
+#endif
+
+///Implementation Notes
+///--------------------
+// The back ends implement the protocol 'AsyncFileIo_Impl', which also counts
+// the pending requests (those whose callbacks have not returned) for 'drain'.
+//
+// The 'e_THREADS' back end holds a queue of "jobs", each being either a whole
+// sequential batch or a single request of a concurrent batch, from which the
+// worker threads take jobs and perform their requests with blocking system
+// calls.
+//
+// The 'e_IO_URING' back end uses the 'io_uring' system calls directly (rather
+// than 'liburing', which is not a dependency of this library).  The callback
+// of each request in the kernel is held in a "slot", whose index is the
+// 'user_data' of the request.  There are as many slots as submission-queue
+// entries, and the completion queue has (at least) as many entries, so the
+// completion queue cannot overflow.  A batch for which there are not enough
+// free slots is held in a backlog, which is submitted, in order, as slots are
+// freed by the thread reaping completions; hence 'submit' never blocks, and
+// can be called from a callback.  The requests of a sequential batch are
+// linked ('IOSQE_IO_LINK'), so that the kernel performs them in order, and
+// cancels the rest of the chain when one fails.  The reaping thread is woken
+// to stop by a 'IORING_OP_NOP' request whose 'user_data' is 'k_WAKEUP'.
+
+namespace BloombergLP {
+namespace bdls {
+namespace {
+namespace u {
+
+typedef AsyncFileIo_Request       Request;
+typedef AsyncFileIoBatch::Callback Callback;
+
+                                 // =========
+                                 // class Job
+                                 // =========
+
+class Job {
+    // This class holds requests performed together, and their callbacks.
+
+  public:
+    // DATA
+    bsl::vector<Request>  d_requests;    // requests
+    bsl::vector<Callback> d_callbacks;   // callback per request
+    bool                  d_sequential;  // 'true' if a sequential batch
+    bsl::size_t           d_next;        // index of the first request not
+                                         // yet submitted to the kernel
+
+  private:
+    // NOT IMPLEMENTED
+    Job(const Job&);
+    Job& operator=(const Job&);
+
+  public:
+    // CREATORS
+    explicit Job(bslma::Allocator *basicAllocator)
+        // Create an empty job, using the specified 'basicAllocator' to supply
+        // memory.
+    : d_requests(basicAllocator)
+    , d_callbacks(basicAllocator)
+    , d_sequential(false)
+    , d_next(0)
+    {
+    }
+};
+
+bool isShortTransfer(const Request& request, int result)
+    // Return 'true' if the specified 'result' of the specified 'request' is
+    // that of a read or write that transferred fewer bytes than requested, or
+    // of a failure, and 'false' otherwise.
+{
+    if (result < 0) {
+        return true;                                                  // RETURN
+    }
+    return (Request::e_READ == request.d_operation
+         || Request::e_WRITE == request.d_operation)
+        && result < request.d_numBytes;
+}
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+int transfer(const Request& request)
+    // Perform the specified read or write 'request' using blocking system
+    // calls, and return its result.
+{
+    const bool  isRead = Request::e_READ == request.d_operation;
+    char       *buffer = request.d_buffer_p;
+    int         done   = 0;
+
+    while (done < request.d_numBytes) {
+        OVERLAPPED  overlapped;
+        OVERLAPPED *overlapped_p = 0;
+        if (0 <= request.d_offset) {
+            const unsigned long long offset = request.d_offset + done;
+
+            bsl::memset(&overlapped, 0, sizeof overlapped);
+            overlapped.Offset     = static_cast<DWORD>(offset);
+            overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32);
+            overlapped_p          = &overlapped;
+        }
+
+        DWORD      count = 0;
+        const BOOL ok    = isRead
+                         ? ReadFile(request.d_descriptor,
+                                    buffer + done,
+                                    request.d_numBytes - done,
+                                    &count,
+                                    overlapped_p)
+                         : WriteFile(request.d_descriptor,
+                                     buffer + done,
+                                     request.d_numBytes - done,
+                                     &count,
+                                     overlapped_p);
+        if (!ok) {
+            const DWORD error = GetLastError();
+            if (ERROR_HANDLE_EOF == error) {
+                break;
+            }
+            return done ? done : -static_cast<int>(error);            // RETURN
+        }
+        done += static_cast<int>(count);
+        if (isRead || 0 == count) {
+            break;
+        }
+    }
+    return done;
+}
+
+int perform(const Request& request)
+    // Perform the specified 'request' using blocking system calls, and return
+    // its result.
+{
+    switch (request.d_operation) {
+      case Request::e_READ:
+      case Request::e_WRITE: {
+        return transfer(request);                                     // RETURN
+      } break;
+      case Request::e_SYNC:
+      case Request::e_DATA_SYNC: {
+        return FlushFileBuffers(request.d_descriptor)
+               ? 0
+               : -static_cast<int>(GetLastError());                   // RETURN
+      } break;
+    }
+    return -static_cast<int>(ERROR_INVALID_FUNCTION);
+}
+
+#else
+
+int transfer(const Request& request)
+    // Perform the specified read or write 'request' using blocking system
+    // calls, and return its result.
+{
+    const bool  isRead = Request::e_READ == request.d_operation;
+    char       *buffer = request.d_buffer_p;
+    int         done   = 0;
+
+    while (done < request.d_numBytes) {
+        const bsl::size_t remaining = request.d_numBytes - done;
+        ssize_t           rc;
+        if (0 <= request.d_offset) {
+            const off_t offset = static_cast<off_t>(request.d_offset + done);
+
+            rc = isRead
+               ? ::pread(request.d_descriptor,
+                         buffer + done,
+                         remaining,
+                         offset)
+               : ::pwrite(request.d_descriptor,
+                          buffer + done,
+                          remaining,
+                          offset);
+        }
+        else {
+            rc = isRead
+               ? ::read(request.d_descriptor, buffer + done, remaining)
+               : ::write(request.d_descriptor, buffer + done, remaining);
+        }
+
+        if (rc < 0) {
+            if (EINTR == errno) {
+                continue;
+            }
+            return done ? done : -errno;                              // RETURN
+        }
+        done += static_cast<int>(rc);
+        if (isRead || 0 == rc) {
+            // A read returns what is available; a write is continued until
+            // complete.
+
+            break;
+        }
+    }
+    return done;
+}
+
+int perform(const Request& request)
+    // Perform the specified 'request' using blocking system calls, and return
+    // its result.
+{
+    switch (request.d_operation) {
+      case Request::e_READ:
+      case Request::e_WRITE: {
+        return transfer(request);                                     // RETURN
+      } break;
+      case Request::e_SYNC: {
+        return 0 == ::fsync(request.d_descriptor) ? 0 : -errno;       // RETURN
+      } break;
+      case Request::e_DATA_SYNC: {
+#if defined(BSLS_PLATFORM_OS_LINUX) || defined(BSLS_PLATFORM_OS_SOLARIS)
+        return 0 == ::fdatasync(request.d_descriptor) ? 0 : -errno;   // RETURN
+#else
+        return 0 == ::fsync(request.d_descriptor) ? 0 : -errno;       // RETURN
+#endif
+      } break;
+    }
+    return -EINVAL;
+}
+
+#endif
+
+}  // close namespace u
+}  // close unnamed namespace
+
+                           // ======================
+                           // class AsyncFileIo_Impl
+                           // ======================
+
+class AsyncFileIo_Impl {
+    // This class defines the protocol of the back ends of 'AsyncFileIo', and
+    // counts the pending requests.
+
+  protected:
+    // PROTECTED TYPES
+    typedef AsyncFileIoBatch::Callback Callback;
+
+  private:
+    // DATA
+    bslmt::Mutex     d_mutex;        // protects 'd_numPending' for waiting
+    bslmt::Condition d_condition;    // signaled when no request is pending
+    bsls::AtomicInt  d_numPending;   // requests whose callbacks have not
+                                     // returned
+
+  protected:
+    // PROTECTED MANIPULATORS
+    void complete(Callback *callback, int result);
+        // Invoke the specified 'callback' (if not empty) with the specified
+        // 'result', clear 'callback', and account for the completion of its
+        // request.
+
+  public:
+    // CREATORS
+    AsyncFileIo_Impl();
+        // Create a back end having no pending request.
+
+    virtual ~AsyncFileIo_Impl();
+        // Destroy this object.  The behavior is undefined unless no request
+        // is pending and 'stop' has been called.
+
+    // MANIPULATORS
+    void drain();
+        // Block until no request is pending.
+
+    virtual void stop() = 0;
+        // Stop the threads of this back end.  The behavior is undefined
+        // unless no request is pending.
+
+    int submit(u::Job *job);
+        // Submit the requests of the specified 'job', and take ownership of
+        // 'job'.  Return 0 on success, and a non-zero value, with no effect,
+        // otherwise.
+
+    // ACCESSORS
+    virtual AsyncFileIo::BackEnd backEnd() const = 0;
+        // Return the back end implemented by this object.
+
+    int numPending() const;
+        // Return the number of pending requests.
+
+  private:
+    // PRIVATE MANIPULATORS
+    virtual int doSubmit(u::Job *job) = 0;
+        // Submit the requests of the specified 'job', and take ownership of
+        // 'job'.  Return 0 on success, and a non-zero value, with no effect,
+        // otherwise.  The requests of 'job' are already counted as pending.
+};
+
+                           // ----------------------
+                           // class AsyncFileIo_Impl
+                           // ----------------------
+
+// PROTECTED MANIPULATORS
+void AsyncFileIo_Impl::complete(Callback *callback, int result)
+{
+    if (*callback) {
+        (*callback)(result);
+        *callback = Callback();
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+    if (0 == --d_numPending) {
+        d_condition.broadcast();
+    }
+}
+
+// CREATORS
+AsyncFileIo_Impl::AsyncFileIo_Impl()
+: d_numPending(0)
+{
+}
+
+AsyncFileIo_Impl::~AsyncFileIo_Impl()
+{
+    BSLS_ASSERT(0 == d_numPending);
+}
+
+// MANIPULATORS
+void AsyncFileIo_Impl::drain()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+    while (0 != d_numPending) {
+        d_condition.wait(&d_mutex);
+    }
+}
+
+int AsyncFileIo_Impl::submit(u::Job *job)
+{
+    const int numRequests = static_cast<int>(job->d_requests.size());
+
+    d_numPending.add(numRequests);
+    if (0 != doSubmit(job)) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        if (0 == d_numPending.add(-numRequests)) {
+            d_condition.broadcast();
+        }
+        return -1;                                                    // RETURN
+    }
+    return 0;
+}
+
+// ACCESSORS
+int AsyncFileIo_Impl::numPending() const
+{
+    return d_numPending;
+}
+
+namespace {
+namespace u {
+
+                             // =================
+                             // class ThreadsImpl
+                             // =================
+
+class ThreadsImpl : public AsyncFileIo_Impl {
+    // This class implements the 'e_THREADS' back end.
+
+    // DATA
+    bslmt::Mutex                           d_mutex;      // protects queue
+    bslmt::Condition                       d_condition;  // signaled on push
+                                                         // and stop
+    bsl::deque<Job *>                      d_queue;      // jobs (owned)
+    bool                                   d_stopping;   // 'stop' called
+    bsl::vector<bslmt::ThreadUtil::Handle> d_threads;    // worker threads
+    bslma::Allocator                      *d_allocator_p;
+
+    // PRIVATE MANIPULATORS
+    virtual int doSubmit(Job *job);
+        // Queue the requests of the specified 'job' for execution by the
+        // worker threads.
+
+    void perform(Job *job);
+        // Perform the requests of the specified 'job' and invoke their
+        // callbacks.
+
+    void workerMain();
+        // Perform jobs until 'stop' is called.
+
+  public:
+    // CREATORS
+    explicit ThreadsImpl(bslma::Allocator *basicAllocator);
+        // Create a back end having no threads, using the specified
+        // 'basicAllocator' to supply memory.
+
+    virtual ~ThreadsImpl();
+        // Destroy this object.
+
+    // MANIPULATORS
+    int start(int numThreads);
+        // Create the specified 'numThreads' worker threads.  Return 0 on
+        // success, and a non-zero value, having created no thread,
+        // otherwise.
+
+    virtual void stop();
+        // Join the worker threads.
+
+    // ACCESSORS
+    virtual AsyncFileIo::BackEnd backEnd() const;
+        // Return 'AsyncFileIo::e_THREADS'.
+};
+
+                             // -----------------
+                             // class ThreadsImpl
+                             // -----------------
+
+// PRIVATE MANIPULATORS
+int ThreadsImpl::doSubmit(Job *job)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    if (job->d_sequential || 1 == job->d_requests.size()) {
+        d_queue.push_back(job);
+    }
+    else {
+        // Split a concurrent batch into single-request jobs, so that its
+        // requests are performed by all of the threads.
+
+        for (bsl::size_t i = 0; i < job->d_requests.size(); ++i) {
+            Job *single = new (*d_allocator_p) Job(d_allocator_p);
+            single->d_requests.push_back(job->d_requests[i]);
+            single->d_callbacks.push_back(Callback());
+            single->d_callbacks.back().swap(job->d_callbacks[i]);
+            d_queue.push_back(single);
+        }
+        d_allocator_p->deleteObject(job);
+    }
+    d_condition.broadcast();
+    return 0;
+}
+
+void ThreadsImpl::perform(Job *job)
+{
+    bool canceled = false;
+    for (bsl::size_t i = 0; i < job->d_requests.size(); ++i) {
+        const Request& request = job->d_requests[i];
+
+        int result = AsyncFileIo::k_CANCELED;
+        if (!canceled) {
+            result = u::perform(request);
+            canceled = job->d_sequential && isShortTransfer(request, result);
+        }
+        complete(&job->d_callbacks[i], result);
+    }
+}
+
+void ThreadsImpl::workerMain()
+{
+    while (true) {
+        Job *job;
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+            while (d_queue.empty() && !d_stopping) {
+                d_condition.wait(&d_mutex);
+            }
+            if (d_queue.empty()) {
+                return;                                               // RETURN
+            }
+            job = d_queue.front();
+            d_queue.pop_front();
+        }
+        perform(job);
+        d_allocator_p->deleteObject(job);
+    }
+}
+
+// CREATORS
+ThreadsImpl::ThreadsImpl(bslma::Allocator *basicAllocator)
+: d_queue(basicAllocator)
+, d_stopping(false)
+, d_threads(basicAllocator)
+, d_allocator_p(basicAllocator)
+{
+}
+
+ThreadsImpl::~ThreadsImpl()
+{
+    BSLS_ASSERT(d_threads.empty());
+    BSLS_ASSERT(d_queue.empty());
+}
+
+// MANIPULATORS
+int ThreadsImpl::start(int numThreads)
+{
+    BSLS_ASSERT(d_threads.empty());
+
+    for (int i = 0; i < numThreads; ++i) {
+        bslmt::ThreadUtil::Handle handle;
+        if (0 != bslmt::ThreadUtil::create(
+                            &handle,
+                            bdlf::BindUtil::bind(&ThreadsImpl::workerMain,
+                                                 this))) {
+            stop();
+            return -1;                                                // RETURN
+        }
+        d_threads.push_back(handle);
+    }
+    return 0;
+}
+
+void ThreadsImpl::stop()
+{
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        d_stopping = true;
+        d_condition.broadcast();
+    }
+    for (bsl::size_t i = 0; i < d_threads.size(); ++i) {
+        bslmt::ThreadUtil::join(d_threads[i]);
+    }
+    d_threads.clear();
+    d_stopping = false;
+}
+
+// ACCESSORS
+AsyncFileIo::BackEnd ThreadsImpl::backEnd() const
+{
+    return AsyncFileIo::e_THREADS;
+}
+
+#ifdef BDLS_ASYNCFILEIO_HAS_IO_URING
+
+                              // ===============
+                              // class UringImpl
+                              // ===============
+
+class UringImpl : public AsyncFileIo_Impl {
+    // This class implements the 'e_IO_URING' back end.
+
+    // PRIVATE TYPES
+    typedef bsls::AtomicOperations        AtomicOps;
+    typedef AtomicOps::AtomicTypes::Uint  AtomicUint;
+
+    enum { k_WAKEUP = -1 };  // 'user_data' of the request stopping the
+                             // reaping thread
+
+    // DATA
+    int                         d_ringFd;          // 'io_uring' instance
+    void                       *d_sqRing_p;        // mapped submission ring
+    bsl::size_t                 d_sqRingSize;      // size of 'd_sqRing_p'
+    void                       *d_cqRing_p;        // mapped completion ring
+    bsl::size_t                 d_cqRingSize;      // size of 'd_cqRing_p'
+    io_uring_sqe               *d_sqes_p;          // mapped submission
+                                                   // queue entries
+    bsl::size_t                 d_sqesSize;        // size of 'd_sqes_p'
+    AtomicUint                 *d_sqHead_p;        // kernel-owned head
+    AtomicUint                 *d_sqTail_p;        // tail (ours)
+    unsigned                    d_sqMask;          // index mask
+    unsigned                   *d_sqArray_p;       // indices of entries
+    AtomicUint                 *d_cqHead_p;        // head (ours)
+    AtomicUint                 *d_cqTail_p;        // kernel-owned tail
+    unsigned                    d_cqMask;          // index mask
+    io_uring_cqe               *d_cqes_p;          // completion entries
+
+    bslmt::Mutex                d_mutex;           // protects the following
+                                                   // and the submission ring
+    bsl::vector<Callback>       d_slots;           // callback per slot
+    bsl::vector<int>            d_freeSlots;       // indices of free slots
+    bsl::deque<Job *>           d_backlog;         // jobs waiting for slots
+                                                   // (owned)
+    bsls::AtomicBool            d_stopping;        // 'stop' called
+
+    bslmt::ThreadUtil::Handle   d_reaper;          // reaping thread
+    bool                        d_reaperStarted;   // 'true' once created
+    bsl::vector<bsls::Types::Uint64>
+                                d_reapedSlots;     // reaper scratch
+    bsl::vector<int>            d_reapedResults;   // reaper scratch
+    bsl::vector<Callback>       d_reapedCallbacks; // reaper scratch
+    bslma::Allocator           *d_allocator_p;     // memory allocator (held)
+
+    // PRIVATE MANIPULATORS
+    virtual int doSubmit(Job *job);
+        // Append the specified 'job' to the backlog, and submit as much of
+        // the backlog as possible.
+
+    int enter(unsigned toSubmit, unsigned minComplete, unsigned flags);
+        // Invoke 'io_uring_enter' with the specified 'toSubmit',
+        // 'minComplete', and 'flags', retrying if interrupted.  Return the
+        // result of the system call, or the negated 'errno' on failure.
+
+    void prepare(unsigned                tail,
+                 const Request&          request,
+                 bsls::Types::Uint64     userData,
+                 bool                    link);
+        // Fill the submission-queue entry at the specified 'tail' with the
+        // specified 'request', having the specified 'userData', and linked to
+        // the next entry if the specified 'link' is 'true'.
+
+    void reaperMain();
+        // Reap completions, invoke their callbacks, and submit the backlog,
+        // until the wake-up request is reaped after 'stop' is called.
+
+    void submitBacklog();
+        // Submit, in order, the requests of the backlog for which slots are
+        // available.  The behavior is undefined unless 'd_mutex' is locked.
+
+  public:
+    // CREATORS
+    explicit UringImpl(bslma::Allocator *basicAllocator);
+        // Create a back end having no 'io_uring' instance, using the
+        // specified 'basicAllocator' to supply memory.
+
+    virtual ~UringImpl();
+        // Release the 'io_uring' instance, and destroy this object.
+
+    // MANIPULATORS
+    int start(int queueDepth);
+        // Create an 'io_uring' instance having at least the specified
+        // 'queueDepth' submission-queue entries, and the reaping thread.
+        // Return 0 on success, and a non-zero value otherwise.
+
+    virtual void stop();
+        // Stop the reaping thread.
+
+    // ACCESSORS
+    virtual AsyncFileIo::BackEnd backEnd() const;
+        // Return 'AsyncFileIo::e_IO_URING'.
+
+    int queueDepth() const;
+        // Return the number of submission-queue entries.
+};
+
+                              // ---------------
+                              // class UringImpl
+                              // ---------------
+
+// PRIVATE MANIPULATORS
+int UringImpl::doSubmit(Job *job)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    if (job->d_sequential && job->d_requests.size() > d_slots.size()) {
+        return -1;                                                    // RETURN
+    }
+    d_backlog.push_back(job);
+    submitBacklog();
+    return 0;
+}
+
+int UringImpl::enter(unsigned toSubmit, unsigned minComplete, unsigned flags)
+{
+    while (true) {
+        const long rc = ::syscall(__NR_io_uring_enter,
+                                  d_ringFd,
+                                  toSubmit,
+                                  minComplete,
+                                  flags,
+                                  static_cast<void *>(0),
+                                  0);
+        if (0 <= rc) {
+            return static_cast<int>(rc);                              // RETURN
+        }
+        if (EINTR != errno && EAGAIN != errno && EBUSY != errno) {
+            return -errno;                                            // RETURN
+        }
+        if (EINTR != errno) {
+            bslmt::ThreadUtil::yield();
+        }
+    }
+}
+
+void UringImpl::prepare(unsigned             tail,
+                        const Request&       request,
+                        bsls::Types::Uint64  userData,
+                        bool                 link)
+{
+    const unsigned  index = tail & d_sqMask;
+    io_uring_sqe   *sqe   = d_sqes_p + index;
+
+    bsl::memset(sqe, 0, sizeof *sqe);
+    sqe->fd        = request.d_descriptor;
+    sqe->flags     = link ? IOSQE_IO_LINK : 0;
+    sqe->user_data = userData;
+
+    switch (request.d_operation) {
+      case Request::e_READ:
+      case Request::e_WRITE: {
+        sqe->opcode = Request::e_READ == request.d_operation
+                    ? IORING_OP_READ
+                    : IORING_OP_WRITE;
+        sqe->addr   = reinterpret_cast<bsls::Types::Uint64>(
+                                                          request.d_buffer_p);
+        sqe->len    = static_cast<unsigned>(request.d_numBytes);
+        sqe->off    = request.d_offset < 0
+                    ? ~static_cast<bsls::Types::Uint64>(0)
+                    : static_cast<bsls::Types::Uint64>(request.d_offset);
+      } break;
+      case Request::e_SYNC: {
+        sqe->opcode = IORING_OP_FSYNC;
+      } break;
+      case Request::e_DATA_SYNC: {
+        sqe->opcode      = IORING_OP_FSYNC;
+        sqe->fsync_flags = IORING_FSYNC_DATASYNC;
+      } break;
+    }
+    d_sqArray_p[index] = index;
+}
+
+void UringImpl::reaperMain()
+{
+    bool stop = false;
+    while (!stop) {
+        enter(0, 1, IORING_ENTER_GETEVENTS);
+
+        const unsigned head = AtomicOps::getUintRelaxed(d_cqHead_p);
+        const unsigned tail = AtomicOps::getUintAcquire(d_cqTail_p);
+        if (head == tail) {
+            continue;
+        }
+
+        d_reapedSlots.clear();
+        d_reapedResults.clear();
+        for (unsigned i = head; i != tail; ++i) {
+            const io_uring_cqe& cqe = d_cqes_p[i & d_cqMask];
+            d_reapedSlots.push_back(cqe.user_data);
+            d_reapedResults.push_back(cqe.res);
+        }
+        AtomicOps::setUintRelease(d_cqHead_p, tail);
+
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+            d_reapedCallbacks.resize(d_reapedSlots.size());
+            for (bsl::size_t i = 0; i < d_reapedSlots.size(); ++i) {
+                const bsls::Types::Uint64 slot = d_reapedSlots[i];
+                if (static_cast<bsls::Types::Uint64>(k_WAKEUP) == slot) {
+                    stop = d_stopping;
+                    continue;
+                }
+                d_reapedCallbacks[i].swap(d_slots[static_cast<int>(slot)]);
+                d_freeSlots.push_back(static_cast<int>(slot));
+            }
+            submitBacklog();
+        }
+
+        for (bsl::size_t i = 0; i < d_reapedSlots.size(); ++i) {
+            if (static_cast<bsls::Types::Uint64>(k_WAKEUP)
+                                                        == d_reapedSlots[i]) {
+                continue;
+            }
+            const int result = -ECANCELED == d_reapedResults[i]
+                             ? static_cast<int>(AsyncFileIo::k_CANCELED)
+                             : d_reapedResults[i];
+            complete(&d_reapedCallbacks[i], result);
+        }
+    }
+}
+
+void UringImpl::submitBacklog()
+{
+    const unsigned start = AtomicOps::getUintRelaxed(d_sqTail_p);
+    unsigned       tail  = start;
+
+    while (!d_backlog.empty()) {
+        Job               *job       = d_backlog.front();
+        const bsl::size_t  size      = job->d_requests.size();
+        const bsl::size_t  available = d_freeSlots.size();
+
+        if (0 == available
+         || (job->d_sequential && available < size - job->d_next)) {
+            break;
+        }
+
+        while (job->d_next < size && !d_freeSlots.empty()) {
+            const int slot = d_freeSlots.back();
+            d_freeSlots.pop_back();
+            d_slots[slot].swap(job->d_callbacks[job->d_next]);
+
+            prepare(tail++,
+                    job->d_requests[job->d_next],
+                    static_cast<bsls::Types::Uint64>(slot),
+                    job->d_sequential && job->d_next + 1 < size);
+            ++job->d_next;
+        }
+
+        if (job->d_next < size) {
+            break;
+        }
+        d_backlog.pop_front();
+        d_allocator_p->deleteObject(job);
+    }
+
+    if (tail == start) {
+        return;                                                       // RETURN
+    }
+    AtomicOps::setUintRelease(d_sqTail_p, tail);
+
+    // Without 'IORING_SETUP_SQPOLL', 'io_uring_enter' consumes the submitted
+    // entries before returning, unless it fails outright, which can only be
+    // due to a resource shortage, and is then retried.
+
+    unsigned submitted = 0;
+    while (submitted < tail - start) {
+        const int rc = enter(tail - start - submitted, 0, 0);
+        if (0 < rc) {
+            submitted += rc;
+        }
+        else {
+            bslmt::ThreadUtil::yield();
+        }
+    }
+}
+
+// CREATORS
+UringImpl::UringImpl(bslma::Allocator *basicAllocator)
+: d_ringFd(-1)
+, d_sqRing_p(MAP_FAILED)
+, d_sqRingSize(0)
+, d_cqRing_p(MAP_FAILED)
+, d_cqRingSize(0)
+, d_sqes_p(static_cast<io_uring_sqe *>(MAP_FAILED))
+, d_sqesSize(0)
+, d_sqHead_p(0)
+, d_sqTail_p(0)
+, d_sqMask(0)
+, d_sqArray_p(0)
+, d_cqHead_p(0)
+, d_cqTail_p(0)
+, d_cqMask(0)
+, d_cqes_p(0)
+, d_slots(basicAllocator)
+, d_freeSlots(basicAllocator)
+, d_backlog(basicAllocator)
+, d_stopping(false)
+, d_reaperStarted(false)
+, d_reapedSlots(basicAllocator)
+, d_reapedResults(basicAllocator)
+, d_reapedCallbacks(basicAllocator)
+, d_allocator_p(basicAllocator)
+{
+}
+
+UringImpl::~UringImpl()
+{
+    BSLS_ASSERT(!d_reaperStarted);
+    BSLS_ASSERT(d_backlog.empty());
+
+    if (MAP_FAILED != static_cast<void *>(d_sqes_p)) {
+        ::munmap(d_sqes_p, d_sqesSize);
+    }
+    if (MAP_FAILED != d_cqRing_p && d_cqRing_p != d_sqRing_p) {
+        ::munmap(d_cqRing_p, d_cqRingSize);
+    }
+    if (MAP_FAILED != d_sqRing_p) {
+        ::munmap(d_sqRing_p, d_sqRingSize);
+    }
+    if (0 <= d_ringFd) {
+        ::close(d_ringFd);
+    }
+}
+
+// MANIPULATORS
+int UringImpl::start(int queueDepth)
+{
+    io_uring_params params;
+    bsl::memset(&params, 0, sizeof params);
+
+    const long fd = ::syscall(__NR_io_uring_setup, queueDepth, &params);
+    if (fd < 0) {
+        return -1;                                                    // RETURN
+    }
+    d_ringFd = static_cast<int>(fd);
+
+    // Reads and writes at the current file position require Linux 5.6.
+
+    if (!(params.features & IORING_FEAT_RW_CUR_POS)) {
+        return -1;                                                    // RETURN
+    }
+
+    d_sqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    d_cqRingSize = params.cq_off.cqes
+                 + params.cq_entries * sizeof(io_uring_cqe);
+    d_sqesSize   = params.sq_entries * sizeof(io_uring_sqe);
+
+    const bool singleMmap = params.features & IORING_FEAT_SINGLE_MMAP;
+    if (singleMmap) {
+        d_sqRingSize = d_cqRingSize = bsl::max(d_sqRingSize, d_cqRingSize);
+    }
+
+    d_sqRing_p = ::mmap(0,
+                        d_sqRingSize,
+                        PROT_READ | PROT_WRITE,
+                        MAP_SHARED | MAP_POPULATE,
+                        d_ringFd,
+                        IORING_OFF_SQ_RING);
+    if (MAP_FAILED == d_sqRing_p) {
+        return -1;                                                    // RETURN
+    }
+    d_cqRing_p = singleMmap ? d_sqRing_p
+                            : ::mmap(0,
+                                     d_cqRingSize,
+                                     PROT_READ | PROT_WRITE,
+                                     MAP_SHARED | MAP_POPULATE,
+                                     d_ringFd,
+                                     IORING_OFF_CQ_RING);
+    if (MAP_FAILED == d_cqRing_p) {
+        return -1;                                                    // RETURN
+    }
+    d_sqes_p = static_cast<io_uring_sqe *>(::mmap(0,
+                                                  d_sqesSize,
+                                                  PROT_READ | PROT_WRITE,
+                                                  MAP_SHARED | MAP_POPULATE,
+                                                  d_ringFd,
+                                                  IORING_OFF_SQES));
+    if (MAP_FAILED == static_cast<void *>(d_sqes_p)) {
+        return -1;                                                    // RETURN
+    }
+
+    // The ring indices are 32-bit words shared with the kernel, accessed
+    // through 'bsls::AtomicOperations' to obtain the required ordering.
+
+    char *sq = static_cast<char *>(d_sqRing_p);
+    char *cq = static_cast<char *>(d_cqRing_p);
+
+    d_sqHead_p  = reinterpret_cast<AtomicUint *>(sq + params.sq_off.head);
+    d_sqTail_p  = reinterpret_cast<AtomicUint *>(sq + params.sq_off.tail);
+    d_sqMask    = *reinterpret_cast<unsigned *>(sq + params.sq_off.ring_mask);
+    d_sqArray_p = reinterpret_cast<unsigned *>(sq + params.sq_off.array);
+    d_cqHead_p  = reinterpret_cast<AtomicUint *>(cq + params.cq_off.head);
+    d_cqTail_p  = reinterpret_cast<AtomicUint *>(cq + params.cq_off.tail);
+    d_cqMask    = *reinterpret_cast<unsigned *>(cq + params.cq_off.ring_mask);
+    d_cqes_p    = reinterpret_cast<io_uring_cqe *>(cq + params.cq_off.cqes);
+
+    // One slot per submission-queue entry; the completion queue is at least
+    // as large, so it cannot overflow.
+
+    BSLS_ASSERT(params.cq_entries >= params.sq_entries);
+
+    d_slots.resize(params.sq_entries);
+    d_freeSlots.reserve(params.sq_entries);
+    for (int i = static_cast<int>(params.sq_entries) - 1; 0 <= i; --i) {
+        d_freeSlots.push_back(i);
+    }
+    d_reapedSlots.reserve(params.cq_entries);
+    d_reapedResults.reserve(params.cq_entries);
+    d_reapedCallbacks.reserve(params.cq_entries);
+
+    if (0 != bslmt::ThreadUtil::create(
+                              &d_reaper,
+                              bdlf::BindUtil::bind(&UringImpl::reaperMain,
+                                                   this))) {
+        return -1;                                                    // RETURN
+    }
+    d_reaperStarted = true;
+    return 0;
+}
+
+void UringImpl::stop()
+{
+    if (!d_reaperStarted) {
+        return;                                                       // RETURN
+    }
+
+    d_stopping = true;
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        BSLS_ASSERT(d_backlog.empty());
+
+        const unsigned tail = AtomicOps::getUintRelaxed(d_sqTail_p);
+        io_uring_sqe   *sqe = d_sqes_p + (tail & d_sqMask);
+
+        bsl::memset(sqe, 0, sizeof *sqe);
+        sqe->opcode    = IORING_OP_NOP;
+        sqe->user_data = static_cast<bsls::Types::Uint64>(k_WAKEUP);
+        d_sqArray_p[tail & d_sqMask] = tail & d_sqMask;
+        AtomicOps::setUintRelease(d_sqTail_p, tail + 1);
+
+        while (1 != enter(1, 0, 0)) {
+            bslmt::ThreadUtil::yield();
+        }
+    }
+    bslmt::ThreadUtil::join(d_reaper);
+    d_reaperStarted = false;
+}
+
+// ACCESSORS
+AsyncFileIo::BackEnd UringImpl::backEnd() const
+{
+    return AsyncFileIo::e_IO_URING;
+}
+
+int UringImpl::queueDepth() const
+{
+    return static_cast<int>(d_slots.size());
+}
+
+#endif
+
+}  // close namespace u
+}  // close unnamed namespace
+
+                          // ----------------------
+                          // class AsyncFileIoBatch
+                          // ----------------------
+
+// CREATORS
+AsyncFileIoBatch::AsyncFileIoBatch(bslma::Allocator *basicAllocator)
+: d_requests(basicAllocator)
+, d_callbacks(basicAllocator)
+, d_order(e_SEQUENTIAL)
+{
+}
+
+AsyncFileIoBatch::AsyncFileIoBatch(Order             order,
+                                   bslma::Allocator *basicAllocator)
+: d_requests(basicAllocator)
+, d_callbacks(basicAllocator)
+, d_order(order)
+{
+}
+
+// MANIPULATORS
+void AsyncFileIoBatch::addRead(FilesystemUtil::FileDescriptor  descriptor,
+                               char                           *buffer,
+                               int                             numBytes,
+                               FilesystemUtil::Offset          offset,
+                               const Callback&                 callback)
+{
+    BSLS_ASSERT(buffer || 0 == numBytes);
+    BSLS_ASSERT(0 <= numBytes);
+
+    const AsyncFileIo_Request request = { AsyncFileIo_Request::e_READ,
+                                          descriptor,
+                                          buffer,
+                                          numBytes,
+                                          offset };
+    d_requests.push_back(request);
+    d_callbacks.push_back(callback);
+}
+
+void AsyncFileIoBatch::addSync(FilesystemUtil::FileDescriptor descriptor,
+                               const Callback&                callback,
+                               bool                           dataOnlyFlag)
+{
+    const AsyncFileIo_Request request = {
+                               dataOnlyFlag ? AsyncFileIo_Request::e_DATA_SYNC
+                                            : AsyncFileIo_Request::e_SYNC,
+                               descriptor,
+                               0,
+                               0,
+                               0 };
+    d_requests.push_back(request);
+    d_callbacks.push_back(callback);
+}
+
+void AsyncFileIoBatch::addWrite(FilesystemUtil::FileDescriptor  descriptor,
+                                const char                     *buffer,
+                                int                             numBytes,
+                                FilesystemUtil::Offset          offset,
+                                const Callback&                 callback)
+{
+    BSLS_ASSERT(buffer || 0 == numBytes);
+    BSLS_ASSERT(0 <= numBytes);
+
+    const AsyncFileIo_Request request = { AsyncFileIo_Request::e_WRITE,
+                                          descriptor,
+                                          const_cast<char *>(buffer),
+                                          numBytes,
+                                          offset };
+    d_requests.push_back(request);
+    d_callbacks.push_back(callback);
+}
+
+void AsyncFileIoBatch::clear()
+{
+    d_requests.clear();
+    d_callbacks.clear();
+}
+
+                             // -----------------
+                             // class AsyncFileIo
+                             // -----------------
+
+// CREATORS
+AsyncFileIo::AsyncFileIo(bslma::Allocator *basicAllocator)
+: d_requestedBackEnd(e_IO_URING)
+, d_queueDepth(k_DEFAULT_QUEUE_DEPTH)
+, d_numThreads(k_DEFAULT_NUM_THREADS)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+AsyncFileIo::AsyncFileIo(BackEnd           backEnd,
+                         int               queueDepth,
+                         int               numThreads,
+                         bslma::Allocator *basicAllocator)
+: d_requestedBackEnd(backEnd)
+, d_queueDepth(queueDepth)
+, d_numThreads(numThreads)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 < queueDepth);
+    BSLS_ASSERT(0 < numThreads);
+}
+
+AsyncFileIo::~AsyncFileIo()
+{
+    stop();
+}
+
+// MANIPULATORS
+void AsyncFileIo::drain()
+{
+    if (d_impl) {
+        d_impl->drain();
+    }
+}
+
+int AsyncFileIo::start()
+{
+    if (d_impl) {
+        return 0;                                                     // RETURN
+    }
+
+#ifdef BDLS_ASYNCFILEIO_HAS_IO_URING
+    if (e_THREADS != d_requestedBackEnd) {
+        bslma::ManagedPtr<u::UringImpl> uring(
+                              new (*d_allocator_p) u::UringImpl(d_allocator_p),
+                              d_allocator_p);
+        if (0 == uring->start(d_queueDepth)) {
+            d_impl = uring;
+            return 0;                                                 // RETURN
+        }
+    }
+#endif
+
+    bslma::ManagedPtr<u::ThreadsImpl> threads(
+                            new (*d_allocator_p) u::ThreadsImpl(d_allocator_p),
+                            d_allocator_p);
+    if (0 != threads->start(d_numThreads)) {
+        return -1;                                                    // RETURN
+    }
+    d_impl = threads;
+    return 0;
+}
+
+void AsyncFileIo::stop()
+{
+    if (!d_impl) {
+        return;                                                       // RETURN
+    }
+    d_impl->drain();
+    d_impl->stop();
+    d_impl.reset();
+}
+
+int AsyncFileIo::submit(AsyncFileIoBatch *batch)
+{
+    BSLS_ASSERT(batch);
+
+    if (!d_impl) {
+        return -1;                                                    // RETURN
+    }
+    if (batch->d_requests.empty()) {
+        return 0;                                                     // RETURN
+    }
+
+    u::Job *job = new (*d_allocator_p) u::Job(d_allocator_p);
+    job->d_requests.swap(batch->d_requests);
+    job->d_callbacks.swap(batch->d_callbacks);
+    job->d_sequential = AsyncFileIoBatch::e_SEQUENTIAL == batch->d_order;
+
+    if (0 != d_impl->submit(job)) {
+        batch->d_requests.swap(job->d_requests);
+        batch->d_callbacks.swap(job->d_callbacks);
+        d_allocator_p->deleteObject(job);
+        return -1;                                                    // RETURN
+    }
+    return 0;
+}
+
+// ACCESSORS
+AsyncFileIo::BackEnd AsyncFileIo::backEnd() const
+{
+    return d_impl ? d_impl->backEnd() : e_NONE;
+}
+
+int AsyncFileIo::numPendingRequests() const
+{
+    return d_impl ? d_impl->numPending() : 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,472 @@
+// bdls_asyncfileio.h                                                 -*-C++-*-
+#ifndef INCLUDED_BDLS_ASYNCFILEIO
+#define INCLUDED_BDLS_ASYNCFILEIO
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide asynchronous, batched file reads, writes, and syncs.
+//
+//@CLASSES:
+//  bdls::AsyncFileIo: mechanism performing batches of file I/O requests
+//  bdls::AsyncFileIoBatch: sequence of file I/O requests submitted together
+//
+//@SEE_ALSO: bdls_filesystemutil, bdls_fdstreambuf
+//
+//@DESCRIPTION: This component provides a mechanism, 'bdls::AsyncFileIo',
+// that performs file reads, writes, and syncs (i.e., 'fsync' and 'fdatasync')
+// asynchronously, and a container, 'bdls::AsyncFileIoBatch', of such requests
+// that are submitted to an 'AsyncFileIo' together.  The completion of each
+// request is reported by invoking a callback, supplied with the request, that
+// is passed the result of the request.
+//
+// Submitting a batch costs the submitting thread at most one system call,
+// whatever the number of requests in the batch, and no system call is made
+// by the submitting thread to wait for, or to reap, completions.  This makes
+// 'AsyncFileIo' suitable to take file I/O off latency-sensitive threads, and
+// to amortize the cost of 'fsync' over many writes ("group commit": see
+// 'bdls::FdStreamBuf::setAsyncFileIo').
+//
+///Back Ends
+///---------
+// An 'AsyncFileIo' performs requests using one of two back ends:
+//
+//: 'e_IO_URING':
+//:   On Linux, requests are submitted to an 'io_uring' instance (kernel 5.6 or
+//:   later), and a single internal thread waits for, and dispatches,
+//:   completions.  The requests of a batch are placed on the submission queue
+//:   and submitted by a single 'io_uring_enter' system call.
+//:
+//: 'e_THREADS':
+//:   On other platforms, or if 'io_uring' is unavailable (e.g., the kernel is
+//:   too old, or the system call is disallowed by a sandbox), requests are
+//:   performed by a set of internal worker threads using blocking system
+//:   calls.
+//
+// The back end is selected by 'start', and reported by 'backEnd'.  The back
+// end does not affect the results of requests, except that the results of
+// failed requests are the negated system error codes of the platform.
+//
+///Requests and Results
+///--------------------
+// The following requests are supported (see 'AsyncFileIoBatch'):
+//
+//: 'read':
+//:   Read at most the specified number of bytes from a file into a buffer.
+//:   The result is the number of bytes read (0 at the end of the file).
+//:
+//: 'write':
+//:   Write the specified number of bytes from a buffer to a file.  The result
+//:   is the number of bytes written, which is the number requested unless an
+//:   error occurred.
+//:
+//: 'sync':
+//:   Flush the data (and, optionally, the metadata) of a file to its storage
+//:   device.  The result is 0.
+//
+// Reads and writes are performed at a specified file offset, or, if the
+// offset is negative, at the current file position of the file descriptor,
+// which is then advanced (i.e., as by 'read' and 'write' rather than by
+// 'pread' and 'pwrite').  The result of a request that failed is a negative
+// value: the negated system error code ('errno' on Unix, 'GetLastError' on
+// Windows), or 'k_CANCELED' for a request that was not performed because an
+// earlier request of its (sequential) batch failed.  The buffer of a read or
+// write request must remain valid until the callback of the request has been
+// invoked.
+//
+///Ordering
+///--------
+// The requests of a batch created with 'e_SEQUENTIAL' order are performed one
+// after another, in the order in which they were added, and, if a request
+// fails, or a read or write transfers fewer bytes than requested, the
+// remaining requests of the batch are canceled.  For example, a batch
+// holding writes followed by a sync makes the data of the writes durable only
+// if all of them succeeded.  The requests of a batch created with
+// 'e_CONCURRENT' order, and of distinct batches, may be performed in any
+// order, and concurrently.
+//
+///Callbacks
+///---------
+// Callbacks are invoked from a thread internal to the 'AsyncFileIo' object,
+// one at a time per back-end thread, so a callback that blocks delays the
+// completion of other requests.  A callback may submit a batch, but must not
+// call 'drain' or 'stop'.  Note that the callbacks of a sequential batch are
+// invoked in the order of its requests.
+//
+///Thread Safety
+///-------------
+// 'drain', 'submit', and the accessors of 'AsyncFileIo' can be invoked
+// concurrently on the same object; 'start' and 'stop' must not be invoked
+// concurrently with any other method.  'AsyncFileIoBatch' is not thread-safe.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Committing Records to a Journal
+/// - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we are writing records to a journal file, and that a record
+// may be acknowledged only once it is durable.  Rather than blocking on a
+// 'write' and an 'fsync' for each record, we submit the writes of all of the
+// records at hand, followed by a single sync, as one sequential batch.
+//
+// First, we define a callback recording the results of the requests:
+//..
+//  void recordResult(bsl::vector<int> *results, int result)
+//      // Append the specified 'result' to the specified 'results'.
+//  {
+//      results->push_back(result);
+//  }
+//..
+// Then, we create and start an 'AsyncFileIo' object, and open the journal
+// (here named by 'journalPath'):
+//..
+//  bdls::AsyncFileIo asyncFileIo;
+//  int               rc = asyncFileIo.start();
+//  assert(0 == rc);
+//
+//  bdls::FilesystemUtil::FileDescriptor fd = bdls::FilesystemUtil::open(
+//                                     journalPath,
+//                                     bdls::FilesystemUtil::e_OPEN_OR_CREATE,
+//                                     bdls::FilesystemUtil::e_READ_APPEND);
+//  assert(bdls::FilesystemUtil::k_INVALID_FD != fd);
+//..
+// Next, we add the writes of the records, and a sync, to a batch.  The
+// callbacks are invoked from a single thread, since the batch is sequential,
+// so the results can be appended to a vector without synchronization:
+//..
+//  const char *records[] = { "record 1\n", "record 2\n", "record 3\n" };
+//
+//  bsl::vector<int>       results;
+//  bdls::AsyncFileIoBatch batch;
+//  for (int i = 0; i < 3; ++i) {
+//      batch.addWrite(fd,
+//                     records[i],
+//                     static_cast<int>(bsl::strlen(records[i])),
+//                     -1,
+//                     bdlf::BindUtil::bind(&recordResult,
+//                                          &results,
+//                                          bdlf::PlaceHolders::_1));
+//  }
+//  batch.addSync(fd,
+//                bdlf::BindUtil::bind(&recordResult,
+//                                     &results,
+//                                     bdlf::PlaceHolders::_1));
+//..
+// Now, we submit the batch, and, once the data is durable (here, simply by
+// waiting for all requests to complete), we observe the results:
+//..
+//  rc = asyncFileIo.submit(&batch);
+//  assert(0 == rc);
+//  assert(0 == batch.numRequests());
+//
+//  asyncFileIo.drain();
+//
+//  assert(4 == results.size());
+//  assert(9 == results[0]);
+//  assert(9 == results[1]);
+//  assert(9 == results[2]);
+//  assert(0 == results[3]);
+//..
+// Finally, we close the journal and stop the 'AsyncFileIo' object:
+//..
+//  bdls::FilesystemUtil::close(fd);
+//  asyncFileIo.stop();
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdls_filesystemutil.h>
+
+#include <bslma_allocator.h>
+#include <bslma_managedptr.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsl_functional.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdls {
+
+class AsyncFileIo_Impl;
+
+                        // ==========================
+                        // struct AsyncFileIo_Request
+                        // ==========================
+
+struct AsyncFileIo_Request {
+    // This component-private 'struct' describes a file I/O request, excluding
+    // its callback.
+
+    // TYPES
+    enum Operation {
+        // Enumerate the requested operations.
+
+        e_READ,
+        e_WRITE,
+        e_SYNC,
+        e_DATA_SYNC
+    };
+
+    // DATA
+    Operation                      d_operation;   // requested operation
+    FilesystemUtil::FileDescriptor d_descriptor;  // file
+    char                          *d_buffer_p;    // data (held, not owned)
+    int                            d_numBytes;    // size of 'd_buffer_p'
+    FilesystemUtil::Offset         d_offset;      // offset, or -1 if current
+};
+
+                          // ======================
+                          // class AsyncFileIoBatch
+                          // ======================
+
+class AsyncFileIoBatch {
+    // This class provides a sequence of file I/O requests, each with a
+    // callback, that are submitted together to an 'AsyncFileIo' object.
+
+  public:
+    // TYPES
+    typedef bsl::function<void(int result)> Callback;
+        // 'Callback' is an alias for a function object invoked with the
+        // result of a request (see {Requests and Results}).
+
+    enum Order {
+        // Enumerate the orders in which the requests of a batch can be
+        // performed (see {Ordering}).
+
+        e_SEQUENTIAL,  // one after another; failure cancels the rest
+        e_CONCURRENT   // in any order
+    };
+
+  private:
+    // DATA
+    bsl::vector<AsyncFileIo_Request> d_requests;   // requests
+    bsl::vector<Callback>            d_callbacks;  // callback per request
+    Order                            d_order;      // order of the requests
+
+    // FRIENDS
+    friend class AsyncFileIo;
+
+  private:
+    // NOT IMPLEMENTED
+    AsyncFileIoBatch(const AsyncFileIoBatch&);
+    AsyncFileIoBatch& operator=(const AsyncFileIoBatch&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(AsyncFileIoBatch,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit AsyncFileIoBatch(bslma::Allocator *basicAllocator = 0);
+    explicit AsyncFileIoBatch(Order             order,
+                              bslma::Allocator *basicAllocator = 0);
+        // Create an empty batch whose requests are performed in the
+        // optionally specified 'order'.  If 'order' is not specified,
+        // 'e_SEQUENTIAL' is used.  Optionally specify a 'basicAllocator' used
+        // to supply memory.  If 'basicAllocator' is 0, the currently
+        // installed default allocator is used.
+
+    //! ~AsyncFileIoBatch() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    void addRead(FilesystemUtil::FileDescriptor  descriptor,
+                 char                           *buffer,
+                 int                             numBytes,
+                 FilesystemUtil::Offset          offset,
+                 const Callback&                 callback);
+        // Append to this batch a request to read at most the specified
+        // 'numBytes' bytes from the file having the specified 'descriptor'
+        // into the specified 'buffer', at the specified 'offset' or, if
+        // 'offset' is negative, at the current file position, and to then
+        // invoke the specified 'callback' with the result.  The behavior is
+        // undefined unless '0 <= numBytes' and 'buffer' remains valid until
+        // 'callback' is invoked.
+
+    void addSync(FilesystemUtil::FileDescriptor descriptor,
+                 const Callback&                callback,
+                 bool                           dataOnlyFlag = false);
+        // Append to this batch a request to flush the data and metadata of
+        // the file having the specified 'descriptor' to its storage device,
+        // and to then invoke the specified 'callback' with the result.  If the
+        // optionally specified 'dataOnlyFlag' is 'true', metadata not needed
+        // to read the data (e.g., the modification time) is not flushed, as
+        // by 'fdatasync', where supported.
+
+    void addWrite(FilesystemUtil::FileDescriptor  descriptor,
+                  const char                     *buffer,
+                  int                             numBytes,
+                  FilesystemUtil::Offset          offset,
+                  const Callback&                 callback);
+        // Append to this batch a request to write the specified 'numBytes'
+        // bytes from the specified 'buffer' to the file having the specified
+        // 'descriptor', at the specified 'offset' or, if 'offset' is
+        // negative, at the current file position, and to then invoke the
+        // specified 'callback' with the result.  The behavior is undefined
+        // unless '0 <= numBytes' and 'buffer' remains valid until 'callback'
+        // is invoked.
+
+    void clear();
+        // Remove all requests from this batch.
+
+    // ACCESSORS
+    int numRequests() const;
+        // Return the number of requests in this batch.
+
+    Order order() const;
+        // Return the order in which the requests of this batch are performed.
+};
+
+                             // =================
+                             // class AsyncFileIo
+                             // =================
+
+class AsyncFileIo {
+    // This mechanism performs batches of file I/O requests asynchronously,
+    // using 'io_uring' where available, and worker threads otherwise.
+
+  public:
+    // TYPES
+    typedef AsyncFileIoBatch::Callback Callback;
+
+    enum BackEnd {
+        // Enumerate the back ends performing the requests (see {Back Ends}).
+
+        e_NONE,       // not started
+        e_IO_URING,   // Linux 'io_uring'
+        e_THREADS     // worker threads
+    };
+
+    enum {
+        k_CANCELED = -0x7fff  // result of a request canceled due to the
+                              // failure of an earlier request of its batch
+    };
+
+    enum {
+        k_DEFAULT_QUEUE_DEPTH = 256,  // 'io_uring' submission-queue entries
+        k_DEFAULT_NUM_THREADS = 2     // worker threads of 'e_THREADS'
+    };
+
+  private:
+    // DATA
+    BackEnd                             d_requestedBackEnd;  // preference
+    int                                 d_queueDepth;        // see ctor
+    int                                 d_numThreads;        // see ctor
+    bslma::ManagedPtr<AsyncFileIo_Impl> d_impl;              // started back
+                                                             // end, or empty
+    bslma::Allocator                   *d_allocator_p;       // memory
+                                                             // allocator
+                                                             // (held)
+
+  private:
+    // NOT IMPLEMENTED
+    AsyncFileIo(const AsyncFileIo&);
+    AsyncFileIo& operator=(const AsyncFileIo&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(AsyncFileIo, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit AsyncFileIo(bslma::Allocator *basicAllocator = 0);
+    AsyncFileIo(BackEnd           backEnd,
+                int               queueDepth,
+                int               numThreads,
+                bslma::Allocator *basicAllocator = 0);
+        // Create an 'AsyncFileIo' object in the stopped state.  Optionally
+        // specify the preferred 'backEnd', the 'queueDepth' of the 'io_uring'
+        // submission queue (which bounds the number of requests in progress in
+        // the kernel, excess requests being queued internally, and the number
+        // of requests of a sequential batch), and the 'numThreads' worker
+        // threads of the 'e_THREADS' back end.  If 'backEnd' is 'e_NONE' or
+        // 'e_IO_URING', 'io_uring' is used if available, and worker threads
+        // otherwise; if 'backEnd' is 'e_THREADS', worker threads are used.  If
+        // these are not specified, 'e_IO_URING', 'k_DEFAULT_QUEUE_DEPTH', and
+        // 'k_DEFAULT_NUM_THREADS' are used.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The behavior is
+        // undefined unless '0 < queueDepth' and '0 < numThreads'.
+
+    ~AsyncFileIo();
+        // Stop this object, as by 'stop', and destroy it.
+
+    // MANIPULATORS
+    void drain();
+        // Block until every request submitted to this object has completed
+        // and its callback has returned.  The behavior is undefined if this
+        // method is called from a callback.
+
+    int start();
+        // Start this object, selecting its back end.  Return 0 on success, and
+        // a non-zero value otherwise.  This method has no effect, and returns
+        // 0, if this object is already started.
+
+    void stop();
+        // Wait for every submitted request to complete (as by 'drain'), and
+        // stop this object.  This method has no effect if this object is
+        // stopped.  The behavior is undefined if this method is called from a
+        // callback.
+
+    int submit(AsyncFileIoBatch *batch);
+        // Submit the requests of the specified 'batch' for execution, and
+        // clear 'batch'.  Return 0 on success, and a non-zero value, with no
+        // effect, if this object is not started, or if 'batch' is sequential
+        // and has more requests than the queue depth of the 'e_IO_URING' back
+        // end.  This method does not block waiting for earlier requests to
+        // complete, and may be called from a callback.
+
+    // ACCESSORS
+    BackEnd backEnd() const;
+        // Return the back end of this object, or 'e_NONE' if this object is
+        // not started.
+
+    int numPendingRequests() const;
+        // Return the number of submitted requests whose callbacks have not
+        // yet returned.  Note that the value returned may be out of date by
+        // the time it is used.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                          // ----------------------
+                          // class AsyncFileIoBatch
+                          // ----------------------
+
+// ACCESSORS
+inline
+int AsyncFileIoBatch::numRequests() const
+{
+    return static_cast<int>(d_requests.size());
+}
+
+inline
+AsyncFileIoBatch::Order AsyncFileIoBatch::order() const
+{
+    return d_order;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
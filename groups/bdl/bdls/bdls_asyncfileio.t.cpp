@@ -0,0 +1,1303 @@
+// bdls_asyncfileio.t.cpp                                             -*-C++-*-
+#include <bdls_asyncfileio.h>
+
+#include <bdls_filesystemutil.h>
+#include <bdls_pathutil.h>
+
+#include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_platform.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+using bsl::flush;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test provides a value-semantic-free container of
+// requests, 'bdls::AsyncFileIoBatch', and a mechanism, 'bdls::AsyncFileIo',
+// performing them.  The mechanism is tested with each of its back ends (the
+// 'e_IO_URING' back end being tested only where it is available) by
+// performing requests on files in a temporary directory, and comparing their
+// results, and the resulting file contents, with those expected.
+// ----------------------------------------------------------------------------
+// AsyncFileIoBatch
+// [ 2] AsyncFileIoBatch(bslma::Allocator *basicAllocator = 0);
+// [ 2] AsyncFileIoBatch(Order order, bslma::Allocator *basicAllocator);
+// [ 2] void addRead(fd, buffer, numBytes, offset, callback);
+// [ 2] void addSync(fd, callback, dataOnlyFlag = false);
+// [ 2] void addWrite(fd, buffer, numBytes, offset, callback);
+// [ 2] void clear();
+// [ 2] int numRequests() const;
+// [ 2] Order order() const;
+//
+// AsyncFileIo
+// [ 3] AsyncFileIo(bslma::Allocator *basicAllocator = 0);
+// [ 3] AsyncFileIo(backEnd, queueDepth, numThreads, basicAllocator = 0);
+// [ 3] ~AsyncFileIo();
+// [ 3] int start();
+// [ 3] void stop();
+// [ 4] int submit(AsyncFileIoBatch *batch);
+// [ 6] void drain();
+// [ 3] BackEnd backEnd() const;
+// [ 6] int numPendingRequests() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] CONCERN: A FAILURE CANCELS THE REST OF A SEQUENTIAL BATCH
+// [ 6] CONCERN: REQUESTS BEYOND THE QUEUE DEPTH ARE PERFORMED
+// [ 7] CONCERN: CALLBACKS CAN SUBMIT BATCHES
+// [ 8] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST: GROUP COMMIT
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                GLOBAL TYPEDEFS/CONSTANTS/VARIABLES FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdls::AsyncFileIo      Obj;
+typedef bdls::AsyncFileIoBatch Batch;
+typedef bdls::FilesystemUtil   FUtil;
+
+int                 test;
+bool             verbose;
+bool         veryVerbose;
+bool     veryVeryVerbose;
+bool veryVeryVeryVerbose;
+
+// ============================================================================
+//                       GLOBAL HELPER CLASSES FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+class TempDirectoryGuard {
+    // This class implements a scoped temporary directory guard.  The guard
+    // tries to create a temporary directory in the system-wide temp directory
+    // and falls back to the current directory.
+
+    // DATA
+    bsl::string       d_dirName;      // path to the created directory
+    bslma::Allocator *d_allocator_p;  // memory allocator (held, not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    TempDirectoryGuard(const TempDirectoryGuard&);
+    TempDirectoryGuard& operator=(const TempDirectoryGuard&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(TempDirectoryGuard,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit TempDirectoryGuard(bslma::Allocator *basicAllocator = 0)
+        // Create temporary directory in the system-wide temp or current
+        // directory.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.
+    : d_dirName(bslma::Default::allocator(basicAllocator))
+    , d_allocator_p(bslma::Default::allocator(basicAllocator))
+    {
+        bsl::string tmpPath(d_allocator_p);
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+        char tmpPathBuf[MAX_PATH];
+        GetTempPath(MAX_PATH, tmpPathBuf);
+        tmpPath.assign(tmpPathBuf);
+#else
+        const char *envTmpPath = bsl::getenv("TMPDIR");
+        if (envTmpPath) {
+            tmpPath.assign(envTmpPath);
+        }
+#endif
+
+        int res = bdls::PathUtil::appendIfValid(&tmpPath, "bdls_");
+        ASSERTV(tmpPath, 0 == res);
+
+        res = bdls::FilesystemUtil::createTemporaryDirectory(&d_dirName,
+                                                             tmpPath);
+        ASSERTV(tmpPath, 0 == res);
+    }
+
+    ~TempDirectoryGuard()
+        // Destroy this object and remove the temporary directory (recursively)
+        // created at construction.
+    {
+        bdls::FilesystemUtil::remove(d_dirName, true);
+    }
+
+    // ACCESSORS
+    const bsl::string& getTempDirName() const
+        // Return a 'const' reference to the name of the created temporary
+        // directory.
+    {
+        return d_dirName;
+    }
+};
+
+namespace u {
+
+class Results {
+    // This class provides a thread-safe record of the results of requests,
+    // identified by index, and of the order in which they completed.
+
+    // DATA
+    mutable bslmt::Mutex d_mutex;      // protects the following
+    bsl::vector<int>     d_results;    // result per request
+    bsl::vector<int>     d_completed;  // indices, in completion order
+
+  public:
+    // CREATORS
+    explicit Results(int numRequests, bslma::Allocator *basicAllocator = 0)
+        // Create a record of the specified 'numRequests' requests, none of
+        // which has completed.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.
+    : d_results(numRequests, 1, basicAllocator)
+    , d_completed(basicAllocator)
+    {
+    }
+
+    // MANIPULATORS
+    void set(int index, int result)
+        // Record the specified 'result' of the request at the specified
+        // 'index'.
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        d_results[index] = result;
+        d_completed.push_back(index);
+    }
+
+    Obj::Callback callback(int index)
+        // Return a callback recording the result of the request at the
+        // specified 'index'.
+    {
+        return bdlf::BindUtil::bind(&Results::set,
+                                    this,
+                                    index,
+                                    bdlf::PlaceHolders::_1);
+    }
+
+    // ACCESSORS
+    const bsl::vector<int>& completed() const
+        // Return the indices of the completed requests, in completion order.
+    {
+        return d_completed;
+    }
+
+    int operator[](int index) const
+        // Return the result of the request at the specified 'index', or 1 if
+        // it has not completed.
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        return d_results[index];
+    }
+};
+
+bsl::string readFile(const bsl::string& path)
+    // Return the contents of the file at the specified 'path'.
+{
+    bsl::string           result;
+    FUtil::FileDescriptor fd = FUtil::open(path,
+                                           FUtil::e_OPEN,
+                                           FUtil::e_READ_ONLY);
+    ASSERTV(path, FUtil::k_INVALID_FD != fd);
+
+    char buffer[4096];
+    int  rc;
+    while (0 < (rc = FUtil::read(fd, buffer, sizeof buffer))) {
+        result.append(buffer, rc);
+    }
+    FUtil::close(fd);
+    return result;
+}
+
+const Obj::BackEnd BACK_ENDS[] = { Obj::e_THREADS, Obj::e_IO_URING };
+const int          NUM_BACK_ENDS = sizeof BACK_ENDS / sizeof *BACK_ENDS;
+
+bool startObj(Obj *obj, Obj::BackEnd backEnd)
+    // Start the specified 'obj', and return 'true' if it uses the specified
+    // 'backEnd', and 'false' otherwise (in which case 'obj' is stopped).
+{
+    ASSERT(0 == obj->start());
+    if (backEnd != obj->backEnd()) {
+        if (verbose) {
+            cout << "Back end " << backEnd << " unavailable" << endl;
+        }
+        obj->stop();
+        return false;                                                 // RETURN
+    }
+    return true;
+}
+
+class Chain {
+    // This class submits, from the callback of each write, a batch writing
+    // the next of a number of records, until all are written.
+
+    // DATA
+    Obj                   *d_obj_p;       // performs the writes
+    FUtil::FileDescriptor  d_fd;          // file written
+    int                    d_numRecords;  // records to write
+    int                    d_next;        // index of the next record
+    bsl::vector<int>       d_results;     // result per record
+
+  public:
+    // CREATORS
+    Chain(Obj *obj, FUtil::FileDescriptor fd, int numRecords)
+        // Create a chain writing the specified 'numRecords' records to the
+        // specified 'fd' using the specified 'obj'.
+    : d_obj_p(obj)
+    , d_fd(fd)
+    , d_numRecords(numRecords)
+    , d_next(0)
+    {
+    }
+
+    // MANIPULATORS
+    void submitNext()
+        // Submit the write of the next record.
+    {
+        static const char k_RECORD[] = "0123456789";
+
+        Batch batch;
+        batch.addWrite(d_fd,
+                       k_RECORD,
+                       10,
+                       10 * d_next,
+                       bdlf::BindUtil::bind(&Chain::written,
+                                            this,
+                                            bdlf::PlaceHolders::_1));
+        ++d_next;
+        ASSERT(0 == d_obj_p->submit(&batch));
+    }
+
+    void written(int result)
+        // Record the specified 'result' and submit the next record, if any.
+    {
+        d_results.push_back(result);
+        if (d_next < d_numRecords) {
+            submitNext();
+        }
+    }
+
+    // ACCESSORS
+    const bsl::vector<int>& results() const
+        // Return the results of the completed writes.
+    {
+        return d_results;
+    }
+};
+
+}  // close namespace u
+}  // close unnamed namespace
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Committing Records to a Journal
+/// - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we are writing records to a journal file, and that a record
+// may be acknowledged only once it is durable.  Rather than blocking on a
+// 'write' and an 'fsync' for each record, we submit the writes of all of the
+// records at hand, followed by a single sync, as one sequential batch.
+//
+// First, we define a callback recording the results of the requests:
+//..
+    void recordResult(bsl::vector<int> *results, int result)
+        // Append the specified 'result' to the specified 'results'.
+    {
+        results->push_back(result);
+    }
+//..
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    test                = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    verbose             = argc > 2;
+    veryVerbose         = argc > 3;
+    veryVeryVerbose     = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        TempDirectoryGuard tempDirGuard;
+
+        bsl::string journalPath(tempDirGuard.getTempDirName());
+        bdls::PathUtil::appendRaw(&journalPath, "journal");
+
+// Then, we create and start an 'AsyncFileIo' object, and open the journal
+// (here named by 'journalPath'):
+//..
+    bdls::AsyncFileIo asyncFileIo;
+    int               rc = asyncFileIo.start();
+    ASSERT(0 == rc);
+
+    bdls::FilesystemUtil::FileDescriptor fd = bdls::FilesystemUtil::open(
+                                       journalPath,
+                                       bdls::FilesystemUtil::e_OPEN_OR_CREATE,
+                                       bdls::FilesystemUtil::e_READ_APPEND);
+    ASSERT(bdls::FilesystemUtil::k_INVALID_FD != fd);
+//..
+// Next, we add the writes of the records, and a sync, to a batch.  The
+// callbacks are invoked from a single thread, since the batch is sequential,
+// so the results can be appended to a vector without synchronization:
+//..
+    const char *records[] = { "record 1\n", "record 2\n", "record 3\n" };
+
+    bsl::vector<int>       results;
+    bdls::AsyncFileIoBatch batch;
+    for (int i = 0; i < 3; ++i) {
+        batch.addWrite(fd,
+                       records[i],
+                       static_cast<int>(bsl::strlen(records[i])),
+                       -1,
+                       bdlf::BindUtil::bind(&recordResult,
+                                            &results,
+                                            bdlf::PlaceHolders::_1));
+    }
+    batch.addSync(fd,
+                  bdlf::BindUtil::bind(&recordResult,
+                                       &results,
+                                       bdlf::PlaceHolders::_1));
+//..
+// Now, we submit the batch, and, once the data is durable (here, simply by
+// waiting for all requests to complete), we observe the results:
+//..
+    rc = asyncFileIo.submit(&batch);
+    ASSERT(0 == rc);
+    ASSERT(0 == batch.numRequests());
+
+    asyncFileIo.drain();
+
+    ASSERT(4 == results.size());
+    ASSERT(9 == results[0]);
+    ASSERT(9 == results[1]);
+    ASSERT(9 == results[2]);
+    ASSERT(0 == results[3]);
+//..
+// Finally, we close the journal and stop the 'AsyncFileIo' object:
+//..
+    bdls::FilesystemUtil::close(fd);
+    asyncFileIo.stop();
+//..
+
+        ASSERT("record 1\nrecord 2\nrecord 3\n" == u::readFile(journalPath));
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // CONCERN: CALLBACKS CAN SUBMIT BATCHES
+        //
+        // Concerns:
+        //: 1 A callback can submit a batch, with either back end.
+        //:
+        //: 2 'drain' waits for batches submitted by callbacks.
+        //
+        // Plan:
+        //: 1 For each back end, write a number of records, each from the
+        //:   callback of the previous one, and verify, after 'drain', that
+        //:   all of them were written.  (C-1..2)
+        //
+        // Testing:
+        //   CONCERN: CALLBACKS CAN SUBMIT BATCHES
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: CALLBACKS CAN SUBMIT BATCHES" << endl
+                          << "=====================================" << endl;
+
+        TempDirectoryGuard tempDirGuard;
+
+        const int NUM_RECORDS = 100;
+
+        for (int bi = 0; bi < u::NUM_BACK_ENDS; ++bi) {
+            const Obj::BackEnd BACK_END = u::BACK_ENDS[bi];
+
+            Obj mX(BACK_END, 4, 2);
+            if (!u::startObj(&mX, BACK_END)) {
+                continue;
+            }
+
+            bsl::string path(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&path, "chain");
+            FUtil::FileDescriptor fd = FUtil::open(path,
+                                                   FUtil::e_CREATE,
+                                                   FUtil::e_READ_WRITE);
+            ASSERT(FUtil::k_INVALID_FD != fd);
+
+            u::Chain chain(&mX, fd, NUM_RECORDS);
+            chain.submitNext();
+            mX.drain();
+
+            ASSERTV(BACK_END, NUM_RECORDS == chain.results().size());
+            for (bsl::size_t i = 0; i < chain.results().size(); ++i) {
+                ASSERTV(BACK_END, i, 10 == chain.results()[i]);
+            }
+            ASSERTV(BACK_END, 10 * NUM_RECORDS == FUtil::getFileSize(path));
+
+            FUtil::close(fd);
+            FUtil::remove(path);
+            mX.stop();
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONCERN: REQUESTS BEYOND THE QUEUE DEPTH ARE PERFORMED
+        //
+        // Concerns:
+        //: 1 All requests of a concurrent batch having more requests than the
+        //:   queue depth are performed.
+        //:
+        //: 2 Batches can be submitted concurrently from several threads.
+        //:
+        //: 3 'numPendingRequests' counts the requests whose callbacks have not
+        //:   returned, and is 0 after 'drain'.
+        //
+        // Plan:
+        //: 1 For each back end, using a queue depth of 4, write, at distinct
+        //:   offsets, many records in concurrent batches submitted from
+        //:   several threads, and verify the results and the contents of the
+        //:   file.  (C-1..2)
+        //:
+        //: 2 Verify that 'numPendingRequests' is 0 after 'drain', and while
+        //:   not started.  (C-3)
+        //
+        // Testing:
+        //   void drain();
+        //   int numPendingRequests() const;
+        //   CONCERN: REQUESTS BEYOND THE QUEUE DEPTH ARE PERFORMED
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                    << "CONCERN: REQUESTS BEYOND THE QUEUE DEPTH ARE PERFORMED"
+                    << endl
+                    << "======================================================"
+                    << endl;
+
+        TempDirectoryGuard tempDirGuard;
+
+        enum { k_NUM_THREADS = 4, k_PER_THREAD = 250, k_RECORD_SIZE = 8 };
+        const int NUM_RECORDS = k_NUM_THREADS * k_PER_THREAD;
+
+        bsl::vector<bsl::string> records(NUM_RECORDS);
+        bsl::string              expected;
+        for (int i = 0; i < NUM_RECORDS; ++i) {
+            bsl::ostringstream record;
+            record.width(k_RECORD_SIZE - 1);
+            record << i << '\n';
+            records[i] = record.str();
+            ASSERT(k_RECORD_SIZE == records[i].size());
+            expected += records[i];
+        }
+
+        for (int bi = 0; bi < u::NUM_BACK_ENDS; ++bi) {
+            const Obj::BackEnd BACK_END = u::BACK_ENDS[bi];
+
+            Obj mX(BACK_END, 4, 3);  const Obj& X = mX;
+            ASSERT(0 == X.numPendingRequests());
+            if (!u::startObj(&mX, BACK_END)) {
+                continue;
+            }
+
+            bsl::string path(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&path, "concurrent");
+            FUtil::FileDescriptor fd = FUtil::open(path,
+                                                   FUtil::e_CREATE,
+                                                   FUtil::e_READ_WRITE);
+            ASSERT(FUtil::k_INVALID_FD != fd);
+
+            u::Results results(NUM_RECORDS);
+
+            struct Submitter {
+                static void run(Obj                      *obj,
+                                FUtil::FileDescriptor     fd,
+                                bsl::vector<bsl::string> *records,
+                                u::Results               *results,
+                                int                       first)
+                {
+                    // Submit batches of 10 records.
+
+                    for (int i = first; i < first + k_PER_THREAD; i += 10) {
+                        Batch batch(Batch::e_CONCURRENT);
+                        for (int j = i; j < i + 10; ++j) {
+                            batch.addWrite(fd,
+                                           (*records)[j].c_str(),
+                                           k_RECORD_SIZE,
+                                           k_RECORD_SIZE * j,
+                                           results->callback(j));
+                        }
+                        ASSERT(0 == obj->submit(&batch));
+                    }
+                }
+            };
+
+            bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+            for (int t = 0; t < k_NUM_THREADS; ++t) {
+                ASSERT(0 == bslmt::ThreadUtil::create(
+                                    &handles[t],
+                                    bdlf::BindUtil::bind(&Submitter::run,
+                                                         &mX,
+                                                         fd,
+                                                         &records,
+                                                         &results,
+                                                         t * k_PER_THREAD)));
+            }
+            for (int t = 0; t < k_NUM_THREADS; ++t) {
+                bslmt::ThreadUtil::join(handles[t]);
+            }
+            mX.drain();
+            ASSERTV(BACK_END, 0 == X.numPendingRequests());
+
+            ASSERTV(BACK_END, NUM_RECORDS == results.completed().size());
+            for (int i = 0; i < NUM_RECORDS; ++i) {
+                ASSERTV(BACK_END, i, results[i], k_RECORD_SIZE == results[i]);
+            }
+            FUtil::close(fd);
+            ASSERTV(BACK_END, expected == u::readFile(path));
+
+            FUtil::remove(path);
+            mX.stop();
+            ASSERT(0 == X.numPendingRequests());
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCERN: A FAILURE CANCELS THE REST OF A SEQUENTIAL BATCH
+        //
+        // Concerns:
+        //: 1 The requests of a sequential batch are performed in order, and
+        //:   their callbacks are invoked in order.
+        //:
+        //: 2 The requests following a failed request of a sequential batch
+        //:   are canceled, and have the result 'k_CANCELED'.
+        //:
+        //: 3 The requests following a short read of a sequential batch are
+        //:   canceled.
+        //:
+        //: 4 The failure of a request of a concurrent batch does not affect
+        //:   the other requests.
+        //
+        // Plan:
+        //: 1 For each back end, submit sequential batches holding appending
+        //:   writes, a write to an invalid file descriptor, and a short read,
+        //:   and verify the results, their order, and the contents of the
+        //:   file.  (C-1..3)
+        //:
+        //: 2 Submit a concurrent batch holding the same requests, and verify
+        //:   that only the invalid write fails.  (C-4)
+        //
+        // Testing:
+        //   CONCERN: A FAILURE CANCELS THE REST OF A SEQUENTIAL BATCH
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                 << "CONCERN: A FAILURE CANCELS THE REST OF A SEQUENTIAL BATCH"
+                 << endl
+                 << "========================================================="
+                 << endl;
+
+        TempDirectoryGuard tempDirGuard;
+
+        for (int bi = 0; bi < u::NUM_BACK_ENDS; ++bi) {
+            const Obj::BackEnd BACK_END = u::BACK_ENDS[bi];
+
+            Obj mX(BACK_END, 8, 2);
+            if (!u::startObj(&mX, BACK_END)) {
+                continue;
+            }
+
+            bsl::string path(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&path, "cancel");
+            FUtil::FileDescriptor fd = FUtil::open(path,
+                                                   FUtil::e_CREATE,
+                                                   FUtil::e_READ_APPEND);
+            ASSERT(FUtil::k_INVALID_FD != fd);
+
+            bsl::string badPath(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&badPath, "bad");
+
+            FUtil::FileDescriptor badFd = FUtil::open(badPath,
+                                                      FUtil::e_CREATE,
+                                                      FUtil::e_READ_WRITE);
+            FUtil::close(badFd);  // 'badFd' is now invalid
+
+            {
+                u::Results results(5);
+                Batch      batch;
+                batch.addWrite(fd, "abc", 3, -1, results.callback(0));
+                batch.addWrite(fd, "def", 3, -1, results.callback(1));
+                batch.addWrite(badFd, "ghi", 3, -1, results.callback(2));
+                batch.addWrite(fd, "jkl", 3, -1, results.callback(3));
+                batch.addSync(fd, results.callback(4));
+                ASSERT(0 == mX.submit(&batch));
+                mX.drain();
+
+                ASSERTV(BACK_END, results[0], 3 == results[0]);
+                ASSERTV(BACK_END, results[1], 3 == results[1]);
+                ASSERTV(BACK_END, results[2], results[2] < 0);
+                ASSERTV(BACK_END, results[2], Obj::k_CANCELED != results[2]);
+                ASSERTV(BACK_END, results[3],
+                        Obj::k_CANCELED == results[3]);
+                ASSERTV(BACK_END, results[4],
+                        Obj::k_CANCELED == results[4]);
+
+                ASSERTV(BACK_END, 5 == results.completed().size());
+                for (int i = 0; i < 5; ++i) {
+                    ASSERTV(BACK_END, i, i == results.completed()[i]);
+                }
+                ASSERTV(BACK_END, "abcdef" == u::readFile(path));
+            }
+            {
+                char       buffer[16];
+                u::Results results(2);
+                Batch      batch;
+                batch.addRead(fd, buffer, sizeof buffer, 0,
+                              results.callback(0));
+                batch.addWrite(fd, "xyz", 3, -1, results.callback(1));
+                ASSERT(0 == mX.submit(&batch));
+                mX.drain();
+
+                ASSERTV(BACK_END, results[0], 6 == results[0]);
+                ASSERTV(BACK_END, results[1], Obj::k_CANCELED == results[1]);
+                ASSERTV(BACK_END, "abcdef" == u::readFile(path));
+            }
+            {
+                u::Results results(3);
+                Batch      batch(Batch::e_CONCURRENT);
+                batch.addWrite(fd, "abc", 3, -1, results.callback(0));
+                batch.addWrite(badFd, "ghi", 3, -1, results.callback(1));
+                batch.addSync(fd, results.callback(2));
+                ASSERT(0 == mX.submit(&batch));
+                mX.drain();
+
+                ASSERTV(BACK_END, results[0], 3 == results[0]);
+                ASSERTV(BACK_END, results[1], results[1] < 0);
+                ASSERTV(BACK_END, results[1], Obj::k_CANCELED != results[1]);
+                ASSERTV(BACK_END, results[2], 0 == results[2]);
+            }
+
+            FUtil::close(fd);
+            FUtil::remove(path);
+            mX.stop();
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'submit'
+        //
+        // Concerns:
+        //: 1 Writes and reads at an offset transfer the requested data at
+        //:   that offset, and do not change the file position.
+        //:
+        //: 2 Writes and reads at a negative offset transfer the requested
+        //:   data at the current file position, and advance it.
+        //:
+        //: 3 A read at the end of the file has the result 0.
+        //:
+        //: 4 Syncs, with and without 'dataOnlyFlag', have the result 0.
+        //:
+        //: 5 A request on an invalid file descriptor fails with a negative
+        //:   result other than 'k_CANCELED'.
+        //:
+        //: 6 'submit' clears the batch, and leaves it unchanged on failure.
+        //:
+        //: 7 An empty batch is accepted.
+        //
+        // Plan:
+        //: 1 For each back end, perform each kind of request, and verify the
+        //:   results, the contents of the buffers and of the file, and the
+        //:   file position.  (C-1..5)
+        //:
+        //: 2 Verify the batch after 'submit', including when the object is
+        //:   stopped, and submit an empty batch.  (C-6..7)
+        //
+        // Testing:
+        //   int submit(AsyncFileIoBatch *batch);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'submit'" << endl
+                          << "================" << endl;
+
+        TempDirectoryGuard tempDirGuard;
+
+        for (int bi = 0; bi < u::NUM_BACK_ENDS; ++bi) {
+            const Obj::BackEnd BACK_END = u::BACK_ENDS[bi];
+
+            Obj mX(BACK_END, 8, 2);
+            Batch batch;
+            batch.addSync(FUtil::k_INVALID_FD, Obj::Callback());
+            ASSERT(0 != mX.submit(&batch));
+            ASSERT(1 == batch.numRequests());
+            batch.clear();
+
+            if (!u::startObj(&mX, BACK_END)) {
+                continue;
+            }
+            ASSERT(0 == mX.submit(&batch));
+
+            bsl::string path(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&path, "submit");
+            FUtil::FileDescriptor fd = FUtil::open(path,
+                                                   FUtil::e_CREATE,
+                                                   FUtil::e_READ_WRITE);
+            ASSERT(FUtil::k_INVALID_FD != fd);
+
+            // Writes at offsets and at the file position.
+
+            {
+                u::Results results(4);
+                batch.addWrite(fd, "0123456789", 10, 0, results.callback(0));
+                batch.addWrite(fd, "abc", 3, 20, results.callback(1));
+                batch.addWrite(fd, "ABCD", 4, -1, results.callback(2));
+                batch.addSync(fd, results.callback(3), true);
+                ASSERT(4 == batch.numRequests());
+                ASSERT(0 == mX.submit(&batch));
+                ASSERT(0 == batch.numRequests());
+                mX.drain();
+
+                ASSERTV(BACK_END, results[0], 10 == results[0]);
+                ASSERTV(BACK_END, results[1],  3 == results[1]);
+                ASSERTV(BACK_END, results[2],  4 == results[2]);
+                ASSERTV(BACK_END, results[3],  0 == results[3]);
+                ASSERTV(BACK_END,
+                        4 == FUtil::seek(fd, 0, FUtil::e_SEEK_FROM_CURRENT));
+
+                const bsl::string contents = u::readFile(path);
+                ASSERTV(BACK_END, 23 == contents.size());
+                ASSERTV(BACK_END, "ABCD456789" == contents.substr(0, 10));
+                ASSERTV(BACK_END, "abc" == contents.substr(20));
+            }
+
+            // Reads at offsets, at the file position, and at the end of the
+            // file.
+
+            {
+                char       buffer[3][8];
+                u::Results results(5);
+                bsl::memset(buffer, 0, sizeof buffer);
+                batch.addRead(fd, buffer[0], 4, 6, results.callback(0));
+                batch.addRead(fd, buffer[1], 4, -1, results.callback(1));
+                batch.addRead(fd, buffer[2], 8, 20, results.callback(2));
+                batch.addRead(fd, buffer[2] + 4, 4, 23, results.callback(3));
+                batch.addSync(fd, results.callback(4));
+                ASSERT(0 == mX.submit(&batch));
+                mX.drain();
+
+                ASSERTV(BACK_END, results[0], 4 == results[0]);
+                ASSERTV(BACK_END, results[1], 4 == results[1]);
+                ASSERTV(BACK_END, results[2], 3 == results[2]);
+                ASSERTV(BACK_END, results[3], Obj::k_CANCELED == results[3]);
+                ASSERTV(BACK_END, results[4], Obj::k_CANCELED == results[4]);
+                ASSERTV(BACK_END, 0 == bsl::memcmp(buffer[0], "6789", 4));
+                ASSERTV(BACK_END, 0 == bsl::memcmp(buffer[1], "4567", 4));
+                ASSERTV(BACK_END, 0 == bsl::memcmp(buffer[2], "abc", 3));
+                ASSERTV(BACK_END,
+                        8 == FUtil::seek(fd, 0, FUtil::e_SEEK_FROM_CURRENT));
+            }
+            {
+                char       buffer[4];
+                u::Results results(2);
+                batch.addRead(fd, buffer, 4, 23, results.callback(0));
+                batch.addSync(fd, results.callback(1));
+                ASSERT(0 == mX.submit(&batch));
+                mX.drain();
+
+                // A read at the end of the file is a short read, canceling
+                // the rest of the batch.
+
+                ASSERTV(BACK_END, results[0], 0 == results[0]);
+                ASSERTV(BACK_END, results[1], Obj::k_CANCELED == results[1]);
+            }
+
+            // Requests on an invalid descriptor.
+
+            FUtil::close(fd);
+            {
+                char       buffer[4];
+                u::Results results(3);
+                Batch      concurrent(Batch::e_CONCURRENT);
+                concurrent.addRead(fd, buffer, 4, 0, results.callback(0));
+                concurrent.addWrite(fd, "abc", 3, -1, results.callback(1));
+                concurrent.addSync(fd, results.callback(2));
+                ASSERT(0 == mX.submit(&concurrent));
+                mX.drain();
+
+                for (int i = 0; i < 3; ++i) {
+                    ASSERTV(BACK_END, i, results[i], results[i] < 0);
+                    ASSERTV(BACK_END, i, results[i],
+                            Obj::k_CANCELED != results[i]);
+                }
+            }
+            FUtil::remove(path);
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'start' AND 'stop'
+        //
+        // Concerns:
+        //: 1 An object is created stopped, with no back end.
+        //:
+        //: 2 'start' selects the worker threads if requested, and 'io_uring'
+        //:   otherwise, where available.
+        //:
+        //: 3 'start' and 'stop' have no effect if the object is already
+        //:   started or stopped, respectively, and the object can be
+        //:   restarted.
+        //:
+        //: 4 The 'e_IO_URING' back end rejects a sequential batch having
+        //:   more requests than the queue depth, but accepts such a
+        //:   concurrent batch.
+        //:
+        //: 5 The destructor stops the object, after the completion of the
+        //:   submitted requests.
+        //:
+        //: 6 All memory is supplied by the specified allocator.
+        //
+        // Plan:
+        //: 1 Create objects requesting each back end, start and stop them,
+        //:   and verify 'backEnd'.  (C-1..3)
+        //:
+        //: 2 Submit batches larger than the queue depth.  (C-4)
+        //:
+        //: 3 Destroy a started object having submitted requests, and verify
+        //:   that the callbacks were invoked.  (C-5)
+        //:
+        //: 4 Use a test allocator, and verify that the default allocator is
+        //:   not used.  (C-6)
+        //
+        // Testing:
+        //   AsyncFileIo(bslma::Allocator *basicAllocator = 0);
+        //   AsyncFileIo(backEnd, queueDepth, numThreads, basicAllocator = 0);
+        //   ~AsyncFileIo();
+        //   int start();
+        //   void stop();
+        //   BackEnd backEnd() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'start' AND 'stop'" << endl
+                          << "==========================" << endl;
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+        bslma::TestAllocator         oa("object", veryVeryVeryVerbose);
+
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            ASSERT(Obj::e_NONE == X.backEnd());
+            mX.stop();
+            ASSERT(Obj::e_NONE == X.backEnd());
+
+            ASSERT(0 == mX.start());
+            const Obj::BackEnd BACK_END = X.backEnd();
+            if (verbose) { P(BACK_END); }
+#ifdef BSLS_PLATFORM_OS_LINUX
+            ASSERTV(BACK_END, Obj::e_NONE != BACK_END);
+#else
+            ASSERTV(BACK_END, Obj::e_THREADS == BACK_END);
+#endif
+            ASSERT(0 == mX.start());
+            ASSERT(BACK_END == X.backEnd());
+
+            mX.stop();
+            ASSERT(Obj::e_NONE == X.backEnd());
+            ASSERT(0 == mX.start());
+            ASSERT(BACK_END == X.backEnd());
+        }
+        {
+            Obj mX(Obj::e_THREADS, 1, 1, &oa);  const Obj& X = mX;
+            ASSERT(Obj::e_NONE == X.backEnd());
+            ASSERT(0 == mX.start());
+            ASSERT(Obj::e_THREADS == X.backEnd());
+
+            Batch batch(&oa);
+            batch.addSync(FUtil::k_INVALID_FD, Obj::Callback());
+            batch.addSync(FUtil::k_INVALID_FD, Obj::Callback());
+            ASSERT(0 == mX.submit(&batch));
+        }
+        {
+            Obj mX(Obj::e_IO_URING, 2, 1, &oa);
+            if (u::startObj(&mX, Obj::e_IO_URING)) {
+                Batch sequential(&oa);
+                Batch concurrent(Batch::e_CONCURRENT, &oa);
+                for (int i = 0; i < 16; ++i) {
+                    sequential.addSync(FUtil::k_INVALID_FD, Obj::Callback());
+                    concurrent.addSync(FUtil::k_INVALID_FD, Obj::Callback());
+                }
+                ASSERT(0 != mX.submit(&sequential));
+                ASSERT(16 == sequential.numRequests());
+                ASSERT(0 == mX.submit(&concurrent));
+                ASSERT(0 == concurrent.numRequests());
+            }
+        }
+        for (int bi = 0; bi < u::NUM_BACK_ENDS; ++bi) {
+            const Obj::BackEnd BACK_END = u::BACK_ENDS[bi];
+
+            u::Results results(64, &oa);
+            {
+                Obj mX(BACK_END, 4, 2, &oa);
+                ASSERT(0 == mX.start());
+
+                Batch batch(Batch::e_CONCURRENT, &oa);
+                for (int i = 0; i < 64; ++i) {
+                    batch.addSync(FUtil::k_INVALID_FD, results.callback(i));
+                }
+                ASSERT(0 == mX.submit(&batch));
+            }
+            ASSERTV(BACK_END, 64 == results.completed().size());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'AsyncFileIoBatch'
+        //
+        // Concerns:
+        //: 1 A batch is created empty, with the specified order, or
+        //:   'e_SEQUENTIAL' by default.
+        //:
+        //: 2 Each 'add*' method appends one request.
+        //:
+        //: 3 'clear' removes all requests.
+        //:
+        //: 4 All memory is supplied by the specified allocator.
+        //
+        // Plan:
+        //: 1 Create batches, add requests, and verify 'numRequests' and
+        //:   'order', using a test allocator.  (C-1..4)
+        //
+        // Testing:
+        //   AsyncFileIoBatch(bslma::Allocator *basicAllocator = 0);
+        //   AsyncFileIoBatch(Order order, bslma::Allocator *basicAllocator);
+        //   void addRead(fd, buffer, numBytes, offset, callback);
+        //   void addSync(fd, callback, dataOnlyFlag = false);
+        //   void addWrite(fd, buffer, numBytes, offset, callback);
+        //   void clear();
+        //   int numRequests() const;
+        //   Order order() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'AsyncFileIoBatch'" << endl
+                          << "==========================" << endl;
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+        bslma::TestAllocator         oa("object", veryVeryVeryVerbose);
+
+        {
+            Batch mX(&oa);  const Batch& X = mX;
+            ASSERT(0 == X.numRequests());
+            ASSERT(Batch::e_SEQUENTIAL == X.order());
+
+            char buffer[4];
+            mX.addRead(FUtil::k_INVALID_FD, buffer, 4, 0, Obj::Callback());
+            ASSERT(1 == X.numRequests());
+            mX.addWrite(FUtil::k_INVALID_FD, "abc", 3, -1, Obj::Callback());
+            ASSERT(2 == X.numRequests());
+            mX.addSync(FUtil::k_INVALID_FD, Obj::Callback());
+            ASSERT(3 == X.numRequests());
+            mX.addSync(FUtil::k_INVALID_FD, Obj::Callback(), true);
+            ASSERT(4 == X.numRequests());
+            ASSERT(0 < oa.numBlocksInUse());
+
+            mX.clear();
+            ASSERT(0 == X.numRequests());
+            ASSERT(Batch::e_SEQUENTIAL == X.order());
+        }
+        {
+            Batch mX(Batch::e_CONCURRENT, &oa);  const Batch& X = mX;
+            ASSERT(0 == X.numRequests());
+            ASSERT(Batch::e_CONCURRENT == X.order());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == da.numBlocksTotal());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic
+        //   functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Write a file, sync it, and read it back, with the default back
+        //:   end.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        TempDirectoryGuard tempDirGuard;
+
+        Obj mX;  const Obj& X = mX;
+        ASSERT(0 == mX.start());
+        if (verbose) { P(X.backEnd()); }
+
+        bsl::string path(tempDirGuard.getTempDirName());
+        bdls::PathUtil::appendRaw(&path, "breathing");
+        FUtil::FileDescriptor fd = FUtil::open(path,
+                                               FUtil::e_CREATE,
+                                               FUtil::e_READ_WRITE);
+        ASSERT(FUtil::k_INVALID_FD != fd);
+
+        u::Results results(3);
+        char       buffer[6] = { 0 };
+        Batch      batch;
+        batch.addWrite(fd, "hello", 5, 0, results.callback(0));
+        batch.addSync(fd, results.callback(1));
+        batch.addRead(fd, buffer, 5, 0, results.callback(2));
+        ASSERT(0 == mX.submit(&batch));
+        mX.drain();
+
+        ASSERTV(results[0], 5 == results[0]);
+        ASSERTV(results[1], 0 == results[1]);
+        ASSERTV(results[2], 5 == results[2]);
+        ASSERT(0 == bsl::strcmp("hello", buffer));
+
+        FUtil::close(fd);
+        mX.stop();
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: GROUP COMMIT
+        //
+        // Concerns:
+        //: 1 Submitting records, with a single data sync per batch, to an
+        //:   'AsyncFileIo' object is faster than writing and syncing each
+        //:   record synchronously.
+        //
+        // Plan:
+        //: 1 Write a number of records (optionally specified as the second
+        //:   argument), and sync them, first with 'write' and 'fdatasync' per
+        //:   record on the calling thread, then as batches of records
+        //:   followed by a single data sync, for each back end, and report
+        //:   the times.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST: GROUP COMMIT
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE TEST: GROUP COMMIT" << endl
+             << "==============================" << endl;
+
+        TempDirectoryGuard tempDirGuard;
+
+        const int NUM_RECORDS = argc > 2 ? bsl::atoi(argv[2]) : 2000;
+        const int BATCH_SIZE  = 32;
+        const bsl::string RECORD(100, 'x');
+        bsl::string path(tempDirGuard.getTempDirName());
+        bdls::PathUtil::appendRaw(&path, "perf");
+
+        {
+            FUtil::FileDescriptor fd = FUtil::open(path,
+                                                   FUtil::e_CREATE,
+                                                   FUtil::e_READ_APPEND);
+            ASSERT(FUtil::k_INVALID_FD != fd);
+
+            bsls::Stopwatch timer;
+            timer.start();
+            for (int i = 0; i < NUM_RECORDS; ++i) {
+                FUtil::write(fd,
+                             RECORD.data(),
+                             static_cast<int>(RECORD.size()));
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+                FlushFileBuffers(fd);
+#else
+                ::fdatasync(fd);
+#endif
+            }
+            timer.stop();
+            cout << "write+fdatasync per record: " << timer.elapsedTime()
+                 << 's' << endl;
+
+            FUtil::close(fd);
+            FUtil::remove(path);
+        }
+
+        for (int bi = 0; bi < u::NUM_BACK_ENDS; ++bi) {
+            const Obj::BackEnd BACK_END = u::BACK_ENDS[bi];
+
+            Obj mX(BACK_END, 256, 2);
+            if (!u::startObj(&mX, BACK_END)) {
+                continue;
+            }
+
+            FUtil::FileDescriptor fd = FUtil::open(path,
+                                                   FUtil::e_CREATE,
+                                                   FUtil::e_READ_APPEND);
+            ASSERT(FUtil::k_INVALID_FD != fd);
+
+            bsls::Stopwatch timer;
+            timer.start();
+            for (int i = 0; i < NUM_RECORDS; i += BATCH_SIZE) {
+                Batch batch;
+                for (int j = i; j < i + BATCH_SIZE && j < NUM_RECORDS; ++j) {
+                    batch.addWrite(fd,
+                                   RECORD.data(),
+                                   static_cast<int>(RECORD.size()),
+                                   -1,
+                                   Obj::Callback());
+                }
+                batch.addSync(fd, Obj::Callback(), true);
+                ASSERT(0 == mX.submit(&batch));
+            }
+            mX.drain();
+            timer.stop();
+            cout << "back end " << BACK_END << ", batches of " << BATCH_SIZE
+                 << " + fdatasync: " << timer.elapsedTime() << 's' << endl;
+
+            ASSERT(NUM_RECORDS * static_cast<bsls::Types::Int64>(RECORD.size())
+                                                  == FUtil::getFileSize(path));
+            FUtil::close(fd);
+            FUtil::remove(path);
+            mX.stop();
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
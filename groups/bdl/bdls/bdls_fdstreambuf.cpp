@@ -26,19 +26,35 @@ BSLS_IDENT_RCSID(bdls_fdstreambuf_cpp,"$Id$ $CSID$")
 // bdls::FdStreamBuf: inherits from 'bsl::streambuf', is meant to be a form of
 // streambuf that can be initialized or attached to a file descriptor, that
 // will then perform standard streambuf actions on that file descriptor.
-
+//
+// bdls::FdStreamBuf_AsyncState: holds the output of a 'bdls::FdStreamBuf'
+// handed to a 'bdls::AsyncFileIo' object.  Output flushed while a write is in
+// progress is appended to a "pending" buffer, which is written, as a single
+// request, by the completion callback of the write in progress.  The two
+// buffers are swapped rather than reallocated, so that steady-state output
+// allocates no memory.
+
+#include <bdls_asyncfileio.h>
 #include <bdls_filesystemutil.h>
 #include <bdls_memoryutil.h>
 
+#include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
+
 #include <bslma_allocator.h>
 #include <bslma_default.h>
 
+#include <bslmt_condition.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+
 #include <bsls_assert.h>
 #include <bsls_types.h>
 
 #include <bsl_algorithm.h>
 #include <bsl_locale.h>
 #include <bsl_streambuf.h>
+#include <bsl_vector.h>
 
 #include <bsl_ctime.h>
 #include <bsl_cstring.h>              // for memcpy, memchr
@@ -495,6 +511,251 @@ FdStreamBuf_FileHandler::fileSize() const
     return ret;
 }
 
+                        // ============================
+                        // class FdStreamBuf_AsyncState
+                        // ============================
+
+class FdStreamBuf_AsyncState {
+    // This class holds the output of an 'FdStreamBuf' written asynchronously
+    // by an 'AsyncFileIo' object.
+
+    // PRIVATE TYPES
+    enum { k_PENDING_CAPACITY = 64 * 1024 };  // pending bytes above which
+                                              // 'write' waits
+
+    // DATA
+    AsyncFileIo                    *d_asyncFileIo_p;  // performs the writes
+                                                      // (held, not owned)
+    bool                            d_syncFlag;       // sync after writes
+    bslmt::Mutex                    d_mutex;          // protects the
+                                                      // following
+    bslmt::Condition                d_condition;      // signaled when a
+                                                      // write completes
+    bsl::vector<char>               d_pending;        // output not yet
+                                                      // submitted
+    bsl::vector<char>               d_inFlight;       // output being written
+    bool                            d_inFlightFlag;   // a write is in
+                                                      // progress
+    bool                            d_errorFlag;      // a write failed
+    FilesystemUtil::FileDescriptor  d_descriptor;     // file written
+    bsl::streamoff                  d_position;       // file position once
+                                                      // all output is
+                                                      // written
+    bslma::Allocator               *d_allocator_p;    // memory allocator
+                                                      // (held, not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    FdStreamBuf_AsyncState(const FdStreamBuf_AsyncState&);
+    FdStreamBuf_AsyncState& operator=(const FdStreamBuf_AsyncState&);
+
+    // PRIVATE MANIPULATORS
+    void submitPending();
+        // Submit the write of the pending output, followed, if 'd_syncFlag'
+        // is 'true', by a data sync.  The behavior is undefined unless
+        // 'd_mutex' is locked, no write is in progress, and output is
+        // pending.
+
+    void writeCompleted(int expected, bool lastFlag, int result);
+        // Record the failure of a request of the write in progress if the
+        // specified 'result' differs from the specified 'expected' result,
+        // and, if the specified 'lastFlag' is 'true', end the write in
+        // progress and submit the pending output, if any.
+
+  public:
+    // CREATORS
+    FdStreamBuf_AsyncState(AsyncFileIo      *asyncFileIo,
+                           bool              syncFlag,
+                           bslma::Allocator *basicAllocator);
+        // Create an object writing output using the specified 'asyncFileIo',
+        // followed by a data sync if the specified 'syncFlag' is 'true', and
+        // using the specified 'basicAllocator' to supply memory.
+
+    ~FdStreamBuf_AsyncState();
+        // Destroy this object.  The behavior is undefined unless no output is
+        // pending or being written.
+
+    // MANIPULATORS
+    int wait();
+        // Block until all output is written.  Return 0 on success, and a
+        // non-zero value if a write failed since the last report of a
+        // failure.
+
+    int write(FilesystemUtil::FileDescriptor  descriptor,
+              const char                     *data,
+              int                             numBytes);
+        // Append the specified 'numBytes' bytes of 'data' to the output to be
+        // written at the current position of the specified 'descriptor', and
+        // submit it unless a write is in progress.  Block while the pending
+        // output is too large.  Return 0 on success, and a non-zero value,
+        // with no effect, if a write failed since the last report of a
+        // failure.  The behavior is undefined unless 'descriptor' is that
+        // of any output pending or being written.
+
+    // ACCESSORS
+    bool position(bsl::streamoff *result);
+        // Load into the specified 'result' the position of the file
+        // descriptor once all output is written, and return 'true', if output
+        // is pending or being written; return 'false' otherwise.
+};
+
+                        // ----------------------------
+                        // class FdStreamBuf_AsyncState
+                        // ----------------------------
+
+// PRIVATE MANIPULATORS
+void FdStreamBuf_AsyncState::submitPending()
+{
+    BSLS_ASSERT(!d_inFlightFlag);
+    BSLS_ASSERT(!d_pending.empty());
+
+    using namespace bdlf::PlaceHolders;
+
+    typedef FdStreamBuf_AsyncState State;
+
+    d_inFlight.swap(d_pending);
+    d_inFlightFlag = true;
+
+    const int numBytes = static_cast<int>(d_inFlight.size());
+
+    AsyncFileIoBatch batch(d_allocator_p);
+    batch.addWrite(d_descriptor,
+                   d_inFlight.data(),
+                   numBytes,
+                   -1,
+                   bdlf::BindUtil::bind(&State::writeCompleted,
+                                        this,
+                                        numBytes,
+                                        !d_syncFlag,
+                                        _1));
+    if (d_syncFlag) {
+        batch.addSync(d_descriptor,
+                      bdlf::BindUtil::bind(&State::writeCompleted,
+                                           this,
+                                           0,
+                                           true,
+                                           _1),
+                      true);
+    }
+
+    if (0 != d_asyncFileIo_p->submit(&batch)) {
+        d_inFlight.clear();
+        d_inFlightFlag = false;
+        d_errorFlag    = true;
+    }
+}
+
+void FdStreamBuf_AsyncState::writeCompleted(int  expected,
+                                            bool lastFlag,
+                                            int  result)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    if (expected != result) {
+        d_errorFlag = true;
+    }
+    if (lastFlag) {
+        d_inFlight.clear();
+        d_inFlightFlag = false;
+        if (!d_pending.empty()) {
+            submitPending();
+        }
+        d_condition.broadcast();
+    }
+}
+
+// CREATORS
+FdStreamBuf_AsyncState::FdStreamBuf_AsyncState(
+                                          AsyncFileIo      *asyncFileIo,
+                                          bool              syncFlag,
+                                          bslma::Allocator *basicAllocator)
+: d_asyncFileIo_p(asyncFileIo)
+, d_syncFlag(syncFlag)
+, d_pending(basicAllocator)
+, d_inFlight(basicAllocator)
+, d_inFlightFlag(false)
+, d_errorFlag(false)
+, d_descriptor(FilesystemUtil::k_INVALID_FD)
+, d_position(0)
+, d_allocator_p(basicAllocator)
+{
+    BSLS_ASSERT(asyncFileIo);
+}
+
+FdStreamBuf_AsyncState::~FdStreamBuf_AsyncState()
+{
+    BSLS_ASSERT(!d_inFlightFlag);
+    BSLS_ASSERT(d_pending.empty());
+}
+
+// MANIPULATORS
+int FdStreamBuf_AsyncState::wait()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    while (d_inFlightFlag) {
+        d_condition.wait(&d_mutex);
+    }
+
+    const bool errorFlag = d_errorFlag;
+    d_errorFlag = false;
+    return errorFlag ? -1 : 0;
+}
+
+int FdStreamBuf_AsyncState::write(FilesystemUtil::FileDescriptor  descriptor,
+                                  const char                     *data,
+                                  int                             numBytes)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    while (!d_pending.empty()
+        && d_pending.size() + numBytes > k_PENDING_CAPACITY
+        && !d_errorFlag) {
+        d_condition.wait(&d_mutex);
+    }
+
+    if (d_errorFlag) {
+        d_errorFlag = false;
+        return -1;                                                    // RETURN
+    }
+    if (0 == numBytes) {
+        return 0;                                                     // RETURN
+    }
+
+    if (!d_inFlightFlag) {
+        // No output is pending or being written, so the position of the
+        // file descriptor is up to date.
+
+        BSLS_ASSERT(d_pending.empty());
+
+        d_descriptor = descriptor;
+        d_position   = FilesystemUtil::seek(descriptor,
+                                            0,
+                                            FileUtil::e_SEEK_FROM_CURRENT);
+    }
+    BSLS_ASSERT(descriptor == d_descriptor);
+
+    d_pending.insert(d_pending.end(), data, data + numBytes);
+    d_position += numBytes;
+
+    if (!d_inFlightFlag) {
+        submitPending();
+    }
+    return 0;
+}
+
+// ACCESSORS
+bool FdStreamBuf_AsyncState::position(bsl::streamoff *result)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    if (!d_inFlightFlag) {
+        return false;                                                 // RETURN
+    }
+    *result = d_position;
+    return true;
+}
+
                              // -----------------
                              // class FdStreamBuf
                              // -----------------
@@ -517,6 +778,7 @@ FdStreamBuf::FdStreamBuf(FilesystemUtil::FileDescriptor  fileDescriptor,
 , d_savedEgptr_p(0)
 , d_mmapBase_p(0)
 , d_mmapLen(0)
+, d_asyncState_p(0)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     reset(fileDescriptor, writableFlag, willCloseOnResetFlag, binaryModeFlag);
@@ -526,6 +788,9 @@ FdStreamBuf::~FdStreamBuf()
 {
     clear();
     deallocateBuffer();
+    if (d_asyncState_p) {
+        d_allocator_p->deleteObject(d_asyncState_p);
+    }
 }
 
 // PRIVATE MANIPULATORS
@@ -548,7 +813,8 @@ int FdStreamBuf::switchToInputMode()
         // flush the output buffer
 
         if (traits_type::eq_int_type(overflow(traits_type::eof()),
-                                     traits_type::eof())) {
+                                     traits_type::eof())
+         || 0 != waitForAsyncWrites()) {
             return -1;                                                // RETURN
         }
       } break;
@@ -765,7 +1031,7 @@ int FdStreamBuf::seekInit()
         bool ok = !traits_type::eq_int_type(overflow(traits_type::eof()),
                                             traits_type::eof());
 
-        if (!ok) {
+        if (!ok || 0 != waitForAsyncWrites()) {
             d_mode = e_ERROR_MODE;
             setp(0, 0);
             return -1;                                                // RETURN
@@ -803,6 +1069,11 @@ int FdStreamBuf::flush()
         }
     }
 
+    // Wait for asynchronous writes, so that the file descriptor can be
+    // closed.
+
+    ok &= 0 == waitForAsyncWrites();
+
     d_mmapBase_p = 0;
     d_mmapLen    = 0;
 
@@ -993,10 +1264,14 @@ FdStreamBuf::overflow(int_type c)
         *iend++ = static_cast<char>(c);
     }
 
-    const int_type ret = d_fileHandler.write(d_buf_p,
-                                             static_cast<int>(iend - d_buf_p))
-                         ? outputError()
-                         : traits_type::not_eof(c);
+    const int numBytes = static_cast<int>(iend - d_buf_p);
+    const int rc       = d_asyncState_p && d_fileHandler.isInBinaryMode()
+                       ? d_asyncState_p->write(d_fileHandler.fileDescriptor(),
+                                               d_buf_p,
+                                               numBytes)
+                       : d_fileHandler.write(d_buf_p, numBytes);
+
+    const int_type ret = rc ? outputError() : traits_type::not_eof(c);
     setp(d_buf_p, d_bufEOS_p - 1);
 
     return ret;
@@ -1050,6 +1325,14 @@ bsl::streambuf::pos_type FdStreamBuf::seekoff(off_type                offset,
     if (CUR == dir && 0 == offset && e_OUTPUT_MODE == d_mode) {
         const bsl::streamoff outDiskAdjust = d_fileHandler.getOffset(pbase(),
                                                                      pptr());
+
+        // While asynchronous writes are in progress, the position of the file
+        // descriptor is not that of the end of the output flushed so far.
+
+        bsl::streamoff asyncPosition;
+        if (d_asyncState_p && d_asyncState_p->position(&asyncPosition)) {
+            return pos_type(asyncPosition + outDiskAdjust);           // RETURN
+        }
         return pos_type(d_fileHandler.seek(0, CUR) + outDiskAdjust);  // RETURN
     }
 
@@ -1316,6 +1599,44 @@ bsl::streamsize FdStreamBuf::xsputn(const char      *buffer,
 
     return buffer - start;
 }
+
+// MANIPULATORS
+int FdStreamBuf::setAsyncFileIo(AsyncFileIo *asyncFileIo, bool syncFlag)
+{
+    bool ok = true;
+
+    if (e_OUTPUT_MODE == d_mode) {
+        ok &= !traits_type::eq_int_type(overflow(traits_type::eof()),
+                                        traits_type::eof());
+    }
+    ok &= 0 == waitForAsyncWrites();
+
+    if (d_asyncState_p) {
+        d_allocator_p->deleteObject(d_asyncState_p);
+        d_asyncState_p = 0;
+    }
+    if (asyncFileIo) {
+        d_asyncState_p = new (*d_allocator_p) FdStreamBuf_AsyncState(
+                                                               asyncFileIo,
+                                                               syncFlag,
+                                                               d_allocator_p);
+    }
+
+    return ok ? 0 : -1;
+}
+
+int FdStreamBuf::waitForAsyncWrites()
+{
+    if (!d_asyncState_p) {
+        return 0;                                                     // RETURN
+    }
+    if (0 != d_asyncState_p->wait()) {
+        outputError();
+        return -1;                                                    // RETURN
+    }
+    return 0;
+}
+
 }  // close package namespace
 
 }  // close enterprise namespace
@@ -18,7 +18,7 @@ BSLS_IDENT("$Id: $")
 //@CLASSES:
 //   bdls::FdStreamBuf: stream buffer constructed with file descriptor
 //
-//@SEE_ALSO: <bsl::streambuf>
+//@SEE_ALSO: <bsl::streambuf>, bdls_asyncfileio
 //
 //@DESCRIPTION: This component implements a class, 'bdls::FdStreamBuf', derived
 // from the C++ standard library's 'bsl::streambuf' that can be associated with
@@ -56,6 +56,28 @@ BSLS_IDENT("$Id: $")
 // files opened in binary mode on Windows, '0x1a' is treated like any other
 // byte.
 //
+///Asynchronous Output
+///-------------------
+// By default, the contents of the output buffer are written to the file
+// descriptor, by a blocking system call, whenever the buffer is full or
+// flushed (e.g., by 'pubsync').  If a started 'bdls::AsyncFileIo' object is
+// supplied to 'setAsyncFileIo', the contents of the output buffer are instead
+// copied to an internal buffer, and written by the 'AsyncFileIo' object, so
+// that writing and flushing the stream does not block on the file system.
+// While a write is in progress, further output accumulates in the internal
+// buffer, and is written, as a single request, once the write in progress
+// completes; a flush blocks only if the internal buffer is full.  If
+// 'setAsyncFileIo' is also passed a 'true' 'syncFlag', each such write is
+// followed by a data sync ('fdatasync'), so that output becomes durable in
+// groups of flushes ("group commit") without any thread blocking on a sync.
+//
+// An error of an asynchronous write is reported by the next output operation,
+// or by 'waitForAsyncWrites', which blocks until the written output has
+// reached the file.  Seeking, reading, 'reset', 'clear', 'release', and the
+// destructor wait for asynchronous writes to complete, so the file descriptor
+// is not closed while writes are in progress.  Asynchronous output is used
+// only for files in binary mode (i.e., always on Unix).
+//
 // Note that the public methods of the 'bsl::streambuf' class used in the usage
 // example are not described here.  See documentation in
 // "The C++ Programming Language, Third Edition", by Bjarne Stroustrup,
@@ -376,6 +398,9 @@ BSLS_IDENT("$Id: $")
 namespace BloombergLP {
 namespace bdls {
 
+class AsyncFileIo;
+class FdStreamBuf_AsyncState;
+
                     // ====================================
                     // helper class FdStreamBuf_FileHandler
                     // ====================================
@@ -683,6 +708,13 @@ class FdStreamBuf : public bsl::streambuf {
 
     bsl::streamoff    d_mmapLen;          // length of mapped area
 
+                        // asynchronous output
+
+    FdStreamBuf_AsyncState
+                     *d_asyncState_p;     // state of asynchronous output
+                                          // (owned), or 0 if output is
+                                          // synchronous
+
                         // memory allocator
 
     bslma::Allocator *d_allocator_p;      // allocator (held, not owned)
@@ -973,6 +1005,27 @@ class FdStreamBuf : public bsl::streambuf {
         // succeeds with no effect if 'isOpened' was false.  Note that
         // 'fileDescriptor' is 'FilesystemUtil::k_INVALID_FD' after this call.
 
+    int setAsyncFileIo(AsyncFileIo *asyncFileIo, bool syncFlag = false);
+        // Write the output of this object using the specified 'asyncFileIo',
+        // or, if 'asyncFileIo' is 0, using blocking system calls (see
+        // {Asynchronous Output}).  If the optionally specified 'syncFlag' is
+        // 'true', follow each asynchronous write with a data sync.  Before
+        // the change, flush the output buffer and wait for asynchronous
+        // writes in progress to complete.  Return 0 on success, and a
+        // non-zero value if the flush, or an asynchronous write, failed.  The
+        // setting is retained by 'reset' and 'clear'.  The behavior is
+        // undefined unless 'asyncFileIo' (if not 0) is started, and remains
+        // started until output is again synchronous, or this object is
+        // destroyed.
+
+    int waitForAsyncWrites();
+        // Block until the asynchronous writes of output already flushed from
+        // the output buffer have completed.  Return 0 on success, and a
+        // non-zero value if an asynchronous write failed, in which case this
+        // object enters an error state cleared by a seek, 'reset', or
+        // 'clear'.  This method has no effect, and returns 0, if output is
+        // synchronous.
+
     // ACCESSORS
     FilesystemUtil::FileDescriptor fileDescriptor() const;
         // Return the file descriptor associated with this object, or
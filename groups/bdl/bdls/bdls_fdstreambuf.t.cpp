@@ -11,6 +11,7 @@
 
 #include <bslim_testutil.h>
 
+#include <bdls_asyncfileio.h>
 #include <bdls_filesystemutil.h>
 #include <bdls_memoryutil.h>
 #include <bdls_processutil.h>
@@ -337,7 +338,7 @@ int main(int argc, char *argv[])
 #endif
 
     switch (test) { case 0:
-      case 18: {
+      case 19: {
         // --------------------------------------------------------------------
         // TESTING STREAMBUF USAGE EXAMPLE
         //
@@ -494,7 +495,7 @@ int main(int argc, char *argv[])
 
         bdls::FilesystemUtil::remove(fileNameBuffer);
       } break;
-      case 17: {
+      case 18: {
         // --------------------------------------------------------------------
         // TESTING STREAM USAGE EXAMPLE
         //
@@ -629,6 +630,135 @@ int main(int argc, char *argv[])
 
         bdls::FilesystemUtil::remove(fileNameBuffer);
       } break;
+      case 17: {
+        // --------------------------------------------------------------------
+        // TESTING ASYNCHRONOUS OUTPUT
+        //
+        // Concerns:
+        //: 1 Once 'setAsyncFileIo' is called, output flushed from the buffer
+        //:   is written, in order, by the 'AsyncFileIo' object, with and
+        //:   without a data sync.
+        //:
+        //: 2 'tellp' reports the position of the end of the output while
+        //:   writes are in progress.
+        //:
+        //: 3 Seeking and reading wait for the writes to complete.
+        //:
+        //: 4 A failed write is reported by 'waitForAsyncWrites'.
+        //:
+        //: 5 'setAsyncFileIo(0)' restores synchronous output.
+        //
+        // Plan:
+        //: 1 For each back end, and each value of 'syncFlag', write lines
+        //:   through an 'ostream', flushing every few lines, and verify
+        //:   'tellp'; then seek to the start, and read the file back.
+        //:   (C-1..3)
+        //:
+        //: 2 Write to a file descriptor that is not writable, and verify that
+        //:   'waitForAsyncWrites' fails.  (C-4)
+        //:
+        //: 3 Restore synchronous output, write, and verify that the output is
+        //:   in the file without waiting.  (C-5)
+        //
+        // Testing:
+        //   int setAsyncFileIo(AsyncFileIo *asyncFileIo, bool syncFlag);
+        //   int waitForAsyncWrites();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING ASYNCHRONOUS OUTPUT\n"
+                             "===========================\n";
+
+        char fileNameBuffer[100];
+        bsl::sprintf(fileNameBuffer, fileNameTemplate, "async",
+                                            bdls::ProcessUtil::getProcessId());
+
+        const bdls::AsyncFileIo::BackEnd BACK_ENDS[] = {
+            bdls::AsyncFileIo::e_THREADS,
+            bdls::AsyncFileIo::e_IO_URING
+        };
+
+        const int NUM_LINES = 1000;
+
+        for (int bi = 0; bi < 2; ++bi) {
+            const bdls::AsyncFileIo::BackEnd BACK_END = BACK_ENDS[bi];
+
+            bdls::AsyncFileIo asyncFileIo(BACK_END, 16, 2);
+            ASSERT(0 == asyncFileIo.start());
+            if (BACK_END != asyncFileIo.backEnd()) {
+                continue;
+            }
+
+            for (int syncFlag = 0; syncFlag < 2; ++syncFlag) {
+                if (veryVerbose) { P_(BACK_END); P(syncFlag); }
+
+                FileUtil::remove(fileNameBuffer);
+                FdType fd = FileUtil::open(fileNameBuffer,
+                                           FileUtil::e_CREATE,
+                                           FileUtil::e_READ_WRITE);
+                ASSERT(FileUtil::k_INVALID_FD != fd);
+
+                Obj sb(fd, true, true, true);
+                ASSERT(0 == sb.setAsyncFileIo(&asyncFileIo, syncFlag));
+
+                bsl::ostream os(&sb);
+                bsl::string  expected;
+                for (int i = 0; i < NUM_LINES; ++i) {
+                    bsl::ostringstream line;
+                    line << "line " << i << '\n';
+                    expected += line.str();
+
+                    os << line.str();
+                    if (0 == i % 7) {
+                        os.flush();
+                    }
+                    ASSERTV(BACK_END, syncFlag, i,
+                            static_cast<bsl::streamoff>(expected.size())
+                                                                == os.tellp());
+                }
+                os.flush();
+                ASSERT(os.good());
+
+                ASSERT(0 == sb.pubseekpos(0));
+
+                bsl::string actual(expected.size() + 10, '\0');
+                const bsl::streamsize numRead = sb.sgetn(&actual[0],
+                                                         actual.size());
+                ASSERTV(BACK_END, syncFlag, numRead,
+                        static_cast<bsl::streamsize>(expected.size())
+                                                                  == numRead);
+                actual.resize(numRead);
+                ASSERTV(BACK_END, syncFlag, expected == actual);
+
+                // Restore synchronous output.
+
+                ASSERT(0 == sb.setAsyncFileIo(0));
+                ASSERT(0 == sb.pubseekoff(0, bsl::ios_base::end)
+                                  - static_cast<bsl::streamoff>(numRead));
+                ASSERT(3 == sb.sputn("end", 3));
+                ASSERT(0 == sb.pubsync());
+                ASSERTV(BACK_END, syncFlag,
+                        static_cast<FileUtil::Offset>(expected.size() + 3)
+                                     == FileUtil::getFileSize(fileNameBuffer));
+            }
+
+            // A failed write is reported.
+
+            FdType fd = FileUtil::open(fileNameBuffer,
+                                       FileUtil::e_OPEN,
+                                       FileUtil::e_READ_ONLY);
+            ASSERT(FileUtil::k_INVALID_FD != fd);
+            {
+                Obj sb(fd, true, true, true);
+                ASSERT(0 == sb.setAsyncFileIo(&asyncFileIo));
+
+                ASSERT(3 == sb.sputn("abc", 3));
+                ASSERT(0 == sb.pubsync());
+                ASSERTV(BACK_END, 0 != sb.waitForAsyncWrites());
+                ASSERT(0 == sb.waitForAsyncWrites());
+            }
+            FileUtil::remove(fileNameBuffer);
+        }
+      } break;
       case 16: {
         // --------------------------------------------------------------------
         // TESTING NULL SEEKS
@@ -0,0 +1,170 @@
+// bdls_mappedfile.cpp                                                -*-C++-*-
+#include <bdls_mappedfile.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdls_mappedfile_cpp,"$Id$ $CSID$")
+
+#include <bdls_filesystemutil.h>
+#include <bdls_memoryutil.h>
+
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#ifdef BSLS_PLATFORM_OS_UNIX
+#include <sys/mman.h>
+#endif
+
+///Implementation Notes
+///--------------------
+// The file descriptor is closed as soon as the file is mapped: on all
+// supported platforms, a mapping remains valid after the descriptor (or
+// handle) used to create it is closed.  An empty file is "mapped" without
+// calling 'FilesystemUtil::map', which does not accept mappings of 0 bytes.
+
+namespace BloombergLP {
+namespace bdls {
+
+namespace {
+namespace u {
+
+int adviseMapping(const char                *address,
+                  bsl::size_t                size,
+                  MappedFile::AccessPattern  pattern)
+    // Tell the operating system that the mapping of the specified 'size'
+    // bytes at the specified 'address' will be accessed according to the
+    // specified 'pattern'.  Return 0 on success, and a non-zero value
+    // otherwise.
+{
+#ifdef BSLS_PLATFORM_OS_UNIX
+    int advice = MADV_NORMAL;
+    switch (pattern) {
+      case MappedFile::e_NORMAL: {
+        advice = MADV_NORMAL;
+      } break;
+      case MappedFile::e_SEQUENTIAL: {
+        advice = MADV_SEQUENTIAL;
+      } break;
+      case MappedFile::e_RANDOM: {
+        advice = MADV_RANDOM;
+      } break;
+    }
+    return ::madvise(const_cast<char *>(address), size, advice);
+#else
+    (void)address;
+    (void)size;
+    (void)pattern;
+    return 0;
+#endif
+}
+
+void requestHugePages(const char *address, bsl::size_t size)
+    // Request that the mapping of the specified 'size' bytes at the specified
+    // 'address' be backed by huge pages, if supported.
+{
+#if defined(BSLS_PLATFORM_OS_LINUX) && defined(MADV_HUGEPAGE)
+    ::madvise(const_cast<char *>(address), size, MADV_HUGEPAGE);
+#else
+    (void)address;
+    (void)size;
+#endif
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+                              // ----------------
+                              // class MappedFile
+                              // ----------------
+
+// MANIPULATORS
+int MappedFile::advise(AccessPattern pattern)
+{
+    BSLS_ASSERT(d_isOpen);
+
+    if (0 == d_size) {
+        return 0;                                                     // RETURN
+    }
+    return u::adviseMapping(d_data_p, d_size, pattern);
+}
+
+void MappedFile::close()
+{
+    if (d_data_p) {
+        FilesystemUtil::unmap(const_cast<char *>(d_data_p), d_size);
+    }
+    d_data_p = 0;
+    d_size   = 0;
+    d_isOpen = false;
+}
+
+int MappedFile::open(const char    *path,
+                     AccessPattern  pattern,
+                     bool           useHugePages)
+{
+    BSLS_ASSERT(path);
+
+    close();
+
+    const FilesystemUtil::FileDescriptor fd = FilesystemUtil::open(
+                                                 path,
+                                                 FilesystemUtil::e_OPEN,
+                                                 FilesystemUtil::e_READ_ONLY);
+    if (FilesystemUtil::k_INVALID_FD == fd) {
+        return -1;                                                    // RETURN
+    }
+
+    const FilesystemUtil::Offset fileSize =
+                 FilesystemUtil::seek(fd, 0, FilesystemUtil::e_SEEK_FROM_END);
+    if (fileSize < 0 ||
+        static_cast<bsls::Types::Uint64>(fileSize) >
+                       static_cast<bsls::Types::Uint64>(~bsl::size_t(0))) {
+        FilesystemUtil::close(fd);
+        return -2;                                                    // RETURN
+    }
+
+    void *address = 0;
+    if (0 < fileSize) {
+        const int rc = FilesystemUtil::map(fd,
+                                           &address,
+                                           0,
+                                           static_cast<bsl::size_t>(fileSize),
+                                           MemoryUtil::k_ACCESS_READ);
+        if (0 != rc) {
+            FilesystemUtil::close(fd);
+            return -3;                                                // RETURN
+        }
+    }
+    FilesystemUtil::close(fd);
+
+    d_data_p = static_cast<const char *>(address);
+    d_size   = static_cast<bsl::size_t>(fileSize);
+    d_isOpen = true;
+
+    if (d_size) {
+        if (useHugePages) {
+            u::requestHugePages(d_data_p, d_size);
+        }
+        u::adviseMapping(d_data_p, d_size, pattern);
+    }
+
+    return 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
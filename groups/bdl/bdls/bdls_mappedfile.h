@@ -0,0 +1,297 @@
+// bdls_mappedfile.h                                                  -*-C++-*-
+#ifndef INCLUDED_BDLS_MAPPEDFILE
+#define INCLUDED_BDLS_MAPPEDFILE
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a read-only memory mapping of a whole file.
+//
+//@CLASSES:
+//  bdls::MappedFile: mechanism owning a read-only mapping of a file
+//
+//@SEE_ALSO: bdls_filesystemutil, bslx_byteinstream
+//
+//@DESCRIPTION: This component provides a mechanism, 'bdls::MappedFile', that
+// maps the whole of a file into the address space of the process for reading
+// (using 'bdls::FilesystemUtil::map'), and unmaps it on 'close' or on
+// destruction.  The contents of the file are then accessible as a contiguous,
+// non-modifiable array of 'size()' bytes at 'data()'; the pages of the file
+// are read by the operating system when first accessed, and no copy of the
+// data is made by the process.
+//
+// This is the most efficient way to read large files that are processed in
+// place, such as snapshots of data externalized in the BDEX format: a
+// 'bslx::ByteInStream' constructed on 'data()' and 'size()' reads directly
+// from the mapping, and its 'getStringView' and 'getArrayUint8View' methods
+// provide views of the strings and arrays of bytes of the snapshot without
+// copying them (see {Example 1}).  Note that the cost of reading a file is
+// then proportional to the amount of data actually accessed, and that the
+// process does not need to reserve memory for the whole of the file.
+//
+///Access Pattern Hints
+///--------------------
+// On UNIX platforms, the operating system is told how the mapping will be
+// accessed (using 'madvise'), according to the 'AccessPattern' supplied to
+// 'open', or later to 'advise':
+//
+//: 'e_SEQUENTIAL': The file is read from its beginning to its end: the pages
+//:   are read ahead aggressively, and may be reclaimed soon after being
+//:   accessed.  This is the default, appropriate for streaming.
+//:
+//: 'e_RANDOM': The file is accessed at random: read-ahead is disabled.
+//:
+//: 'e_NORMAL': The default behavior of the operating system.
+//
+// In addition, 'open' optionally requests that the mapping be backed by huge
+// pages (on Linux, 'MADV_HUGEPAGE'), reducing the number of TLB misses when
+// accessing large files.  Note that huge pages are used for file mappings only
+// if supported by both the kernel and the file system; otherwise the request
+// has no effect.  All of these hints affect only the performance of the
+// mapping, never its contents, and are ignored on platforms that do not
+// support them (e.g., Windows).
+//
+///Thread Safety
+///-------------
+// 'bdls::MappedFile' is *const* *thread-safe*: the contents of the mapping can
+// be read concurrently by multiple threads, but 'open', 'close', and 'advise'
+// must not be called concurrently with any other method.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Reading a BDEX Snapshot
+/// - - - - - - - - - - - - - - - - -
+// Suppose that a large set of reference data was externalized to a file using
+// 'bslx::ByteOutStream', and that we want to load it at startup without
+// reading the whole file into memory first.
+//
+// First, we create a (small) snapshot containing a number of records, each
+// comprised of an identifier and a name:
+//..
+//  bsl::string fileName;
+//  bdls::FilesystemUtil::FileDescriptor fd =
+//               bdls::FilesystemUtil::createTemporaryFile(&fileName, "snap");
+//  assert(bdls::FilesystemUtil::k_INVALID_FD != fd);
+//
+//  bslx::ByteOutStream out(20150813);
+//  out.putLength(2);
+//  out.putInt32(1);    out.putString(bsl::string("IBM"));
+//  out.putInt32(2);    out.putString(bsl::string("AAPL"));
+//
+//  int rc = bdls::FilesystemUtil::write(fd,
+//                                       out.data(),
+//                                       static_cast<int>(out.length()));
+//  assert(static_cast<int>(out.length()) == rc);
+//  bdls::FilesystemUtil::close(fd);
+//..
+// Then, we map the snapshot, telling the operating system that we will read
+// it sequentially:
+//..
+//  bdls::MappedFile file;
+//  rc = file.open(fileName.c_str(), bdls::MappedFile::e_SEQUENTIAL);
+//  assert(0 == rc);
+//  assert(out.length() == file.size());
+//..
+// Next, we unexternalize the records directly from the mapping, obtaining
+// the names as views of the mapping instead of copies:
+//..
+//  bslx::ByteInStream in(file.data(), file.size());
+//
+//  int numRecords;
+//  in.getLength(numRecords);
+//  assert(2 == numRecords);
+//
+//  int              id;
+//  bsl::string_view name;
+//  in.getInt32(id);    in.getStringView(name);
+//  assert(1 == id);    assert("IBM" == name);
+//  in.getInt32(id);    in.getStringView(name);
+//  assert(2 == id);    assert("AAPL" == name);
+//
+//  assert(in);
+//  assert(in.isEmpty());
+//..
+// Finally, we observe that the names refer to the mapping, and so must not be
+// used after the mapping is closed:
+//..
+//  assert(file.data() <= name.data());
+//  assert(name.data() + name.size() <= file.data() + file.size());
+//
+//  file.close();
+//  assert(!file.isOpen());
+//
+//  bdls::FilesystemUtil::remove(fileName);
+//..
+
+#include <bdlscm_version.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_string.h>
+
+namespace BloombergLP {
+namespace bdls {
+
+                              // ================
+                              // class MappedFile
+                              // ================
+
+class MappedFile {
+    // This mechanism class owns a read-only memory mapping of the whole of a
+    // file.  See the component-level documentation for details.
+
+  public:
+    // TYPES
+    enum AccessPattern {
+        // Enumerate the ways in which the mapping is accessed, used as hints
+        // to the operating system (see {Access Pattern Hints}).
+
+        e_NORMAL,      // no particular pattern
+        e_SEQUENTIAL,  // from the beginning to the end of the file
+        e_RANDOM       // in no particular order
+    };
+
+  private:
+    // DATA
+    const char  *d_data_p;  // address of the mapping, or 0 if none (or empty)
+
+    bsl::size_t  d_size;    // size of the mapping (i.e., of the file)
+
+    bool         d_isOpen;  // 'true' if a file is mapped (possibly empty)
+
+  private:
+    // NOT IMPLEMENTED
+    MappedFile(const MappedFile&);
+    MappedFile& operator=(const MappedFile&);
+
+  public:
+    // CREATORS
+    MappedFile();
+        // Create an object that does not map any file.
+
+    ~MappedFile();
+        // Unmap the file mapped by this object, if any, and destroy this
+        // object.
+
+    // MANIPULATORS
+    int advise(AccessPattern pattern);
+        // Tell the operating system that the mapping of this object will be
+        // accessed according to the specified 'pattern'.  Return 0 on success,
+        // and a non-zero value otherwise.  The behavior is undefined unless
+        // 'isOpen()'.  Note that on platforms that do not support access
+        // pattern hints, this method has no effect and returns 0.
+
+    void close();
+        // Unmap the file mapped by this object, if any.  Note that the address
+        // returned by 'data()' (and any address within the mapping) is invalid
+        // after this call.
+
+    int open(const char         *path,
+             AccessPattern       pattern = e_SEQUENTIAL,
+             bool                useHugePages = false);
+    int open(const bsl::string&  path,
+             AccessPattern       pattern = e_SEQUENTIAL,
+             bool                useHugePages = false);
+        // Map the whole of the file at the specified 'path' into memory for
+        // reading, unmapping the file previously mapped by this object, if
+        // any.  Optionally specify the 'pattern' in which the mapping will be
+        // accessed; if 'pattern' is not specified, 'e_SEQUENTIAL' is used.
+        // Optionally specify 'useHugePages' indicating whether to request
+        // that the mapping be backed by huge pages; if 'useHugePages' is not
+        // specified, the system default is used.  Return 0 on success, and a
+        // non-zero value otherwise (e.g., if the file does not exist, cannot
+        // be read, or is larger than the address space of the process), in
+        // which case this object does not map any file.  Note that a failure
+        // to apply 'pattern' or 'useHugePages' is not an error.  Also note
+        // that the behavior of reading the mapping is undefined if the file is
+        // truncated while mapped.
+
+    // ACCESSORS
+    const char *data() const;
+        // Return the address of the contents of the file mapped by this
+        // object, or 0 if this object does not map a file or the file is
+        // empty.  The behavior of accessing elements outside the range
+        // '[ data() .. data() + (size() - 1) ]' is undefined.
+
+    bool isOpen() const;
+        // Return 'true' if this object maps a file, and 'false' otherwise.
+
+    bsl::size_t size() const;
+        // Return the number of bytes of the file mapped by this object, or 0
+        // if this object does not map a file.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                              // ----------------
+                              // class MappedFile
+                              // ----------------
+
+// CREATORS
+inline
+MappedFile::MappedFile()
+: d_data_p(0)
+, d_size(0)
+, d_isOpen(false)
+{
+}
+
+inline
+MappedFile::~MappedFile()
+{
+    close();
+}
+
+// MANIPULATORS
+inline
+int MappedFile::open(const bsl::string& path,
+                     AccessPattern      pattern,
+                     bool               useHugePages)
+{
+    return open(path.c_str(), pattern, useHugePages);
+}
+
+// ACCESSORS
+inline
+const char *MappedFile::data() const
+{
+    return d_data_p;
+}
+
+inline
+bool MappedFile::isOpen() const
+{
+    return d_isOpen;
+}
+
+inline
+bsl::size_t MappedFile::size() const
+{
+    return d_size;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,540 @@
+// bdls_mappedfile.t.cpp                                              -*-C++-*-
+#include <bdls_mappedfile.h>
+
+#include <bdls_filesystemutil.h>
+
+#include <bslim_testutil.h>
+
+#include <bslx_byteinstream.h>
+#include <bslx_byteoutstream.h>
+
+#include <bsls_asserttest.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_string_view.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                              TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a mechanism owning a read-only memory mapping of
+// a file.  We verify that the mapping provides the contents of files of
+// various sizes, that failures leave the object without a mapping, and that
+// the access pattern hints do not affect the contents of the mapping.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] MappedFile();
+// [ 2] ~MappedFile();
+//
+// MANIPULATORS
+// [ 3] int advise(AccessPattern pattern);
+// [ 2] void close();
+// [ 2] int open(const char *path, AccessPattern pattern, bool huge);
+// [ 2] int open(const string& path, AccessPattern pattern, bool huge);
+//
+// ACCESSORS
+// [ 2] const char *data() const;
+// [ 2] bool isOpen() const;
+// [ 2] bsl::size_t size() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                     NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdls::MappedFile     Obj;
+typedef bdls::FilesystemUtil Util;
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static bsl::string makeContents(bsl::size_t size)
+    // Return a string of the specified 'size' characters following a pattern
+    // that does not repeat with a period of a power of 2.
+{
+    bsl::string result(size, '\0');
+    for (bsl::size_t i = 0; i < size; ++i) {
+        result[i] = static_cast<char>(i % 251);
+    }
+    return result;
+}
+
+static bsl::string createFile(const bsl::string& contents)
+    // Create a temporary file having the specified 'contents', and return its
+    // name.
+{
+    bsl::string          fileName;
+    Util::FileDescriptor fd = Util::createTemporaryFile(&fileName,
+                                                        "bdls_mappedfile");
+    ASSERT(Util::k_INVALID_FD != fd);
+
+    const int numBytes = static_cast<int>(contents.size());
+    if (numBytes) {
+        ASSERT(numBytes == Util::write(fd, contents.data(), numBytes));
+    }
+    Util::close(fd);
+
+    return fileName;
+}
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Reading a BDEX Snapshot
+/// - - - - - - - - - - - - - - - - -
+// Suppose that a large set of reference data was externalized to a file using
+// 'bslx::ByteOutStream', and that we want to load it at startup without
+// reading the whole file into memory first.
+//
+// First, we create a (small) snapshot containing a number of records, each
+// comprised of an identifier and a name:
+//..
+    bsl::string fileName;
+    bdls::FilesystemUtil::FileDescriptor fd =
+                 bdls::FilesystemUtil::createTemporaryFile(&fileName, "snap");
+    ASSERT(bdls::FilesystemUtil::k_INVALID_FD != fd);
+
+    bslx::ByteOutStream out(20150813);
+    out.putLength(2);
+    out.putInt32(1);    out.putString(bsl::string("IBM"));
+    out.putInt32(2);    out.putString(bsl::string("AAPL"));
+
+    int rc = bdls::FilesystemUtil::write(fd,
+                                         out.data(),
+                                         static_cast<int>(out.length()));
+    ASSERT(static_cast<int>(out.length()) == rc);
+    bdls::FilesystemUtil::close(fd);
+//..
+// Then, we map the snapshot, telling the operating system that we will read
+// it sequentially:
+//..
+    bdls::MappedFile file;
+    rc = file.open(fileName.c_str(), bdls::MappedFile::e_SEQUENTIAL);
+    ASSERT(0 == rc);
+    ASSERT(out.length() == file.size());
+//..
+// Next, we unexternalize the records directly from the mapping, obtaining
+// the names as views of the mapping instead of copies:
+//..
+    bslx::ByteInStream in(file.data(), file.size());
+
+    int numRecords;
+    in.getLength(numRecords);
+    ASSERT(2 == numRecords);
+
+    int              id;
+    bsl::string_view name;
+    in.getInt32(id);    in.getStringView(name);
+    ASSERT(1 == id);    ASSERT("IBM" == name);
+    in.getInt32(id);    in.getStringView(name);
+    ASSERT(2 == id);    ASSERT("AAPL" == name);
+
+    ASSERT(in);
+    ASSERT(in.isEmpty());
+//..
+// Finally, we observe that the names refer to the mapping, and so must not be
+// used after the mapping is closed:
+//..
+    ASSERT(file.data() <= name.data());
+    ASSERT(name.data() + name.size() <= file.data() + file.size());
+
+    file.close();
+    ASSERT(!file.isOpen());
+
+    bdls::FilesystemUtil::remove(fileName);
+//..
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // ACCESS PATTERN HINTS
+        //
+        // Concerns:
+        //: 1 Every access pattern, with and without huge pages, can be
+        //:   requested at 'open', and does not affect the contents of the
+        //:   mapping.
+        //:
+        //: 2 'advise' succeeds for every access pattern, including on an
+        //:   empty file, and does not affect the contents of the mapping.
+        //:
+        //: 3 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Map a file spanning several pages with each combination of
+        //:   access pattern and huge page request, then apply each access
+        //:   pattern with 'advise', verifying the contents each time.
+        //:   (C-1..2)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-3)
+        //
+        // Testing:
+        //   int advise(AccessPattern pattern);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ACCESS PATTERN HINTS" << endl
+                          << "====================" << endl;
+
+        const Obj::AccessPattern PATTERNS[] = { Obj::e_NORMAL,
+                                                Obj::e_SEQUENTIAL,
+                                                Obj::e_RANDOM };
+        const int NUM_PATTERNS = static_cast<int>(sizeof PATTERNS /
+                                                  sizeof *PATTERNS);
+
+        const bsl::string CONTENTS = makeContents(5 * 4096 + 17);
+        const bsl::string fileName = createFile(CONTENTS);
+
+        for (int ti = 0; ti < NUM_PATTERNS; ++ti) {
+            for (int huge = 0; huge < 2; ++huge) {
+                if (veryVerbose) { T_ P_(ti) P(huge) }
+
+                Obj mX;  const Obj& X = mX;
+
+                ASSERTV(ti, huge, 0 == mX.open(fileName, PATTERNS[ti], huge));
+                ASSERTV(ti, huge, CONTENTS.size() == X.size());
+                ASSERTV(ti, huge, 0 == bsl::memcmp(X.data(),
+                                                   CONTENTS.data(),
+                                                   X.size()));
+
+                for (int tj = 0; tj < NUM_PATTERNS; ++tj) {
+                    ASSERTV(ti, tj, huge, 0 == mX.advise(PATTERNS[tj]));
+                    ASSERTV(ti, tj, huge, 0 == bsl::memcmp(X.data(),
+                                                           CONTENTS.data(),
+                                                           X.size()));
+                }
+            }
+        }
+        Util::remove(fileName);
+
+        if (verbose) cout << "\nEmpty file." << endl;
+        {
+            const bsl::string emptyName = createFile(bsl::string());
+
+            Obj mX;
+            ASSERT(0 == mX.open(emptyName, Obj::e_RANDOM, true));
+            for (int tj = 0; tj < NUM_PATTERNS; ++tj) {
+                ASSERTV(tj, 0 == mX.advise(PATTERNS[tj]));
+            }
+            Util::remove(emptyName);
+        }
+
+        if (verbose) cout << "\nNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX;
+            ASSERT_FAIL(mX.advise(Obj::e_NORMAL));
+            ASSERT_FAIL(mX.open(static_cast<const char *>(0)));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // OPEN, CLOSE, AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 A default-constructed object does not map a file.
+        //:
+        //: 2 'open' maps the whole file: 'data()' provides its contents, and
+        //:   'size()' its size, for files of 1 byte, of exactly and not
+        //:   exactly a number of pages.
+        //:
+        //: 3 An empty file is mapped with a null 'data()' and a 0 'size()'.
+        //:
+        //: 4 'open' of a file that does not exist fails, and leaves the object
+        //:   without a mapping (even if it had a mapping before).
+        //:
+        //: 5 'open' of an object that maps a file replaces the mapping.
+        //:
+        //: 6 'close' removes the mapping, and has no effect on an object that
+        //:   does not map a file.
+        //:
+        //: 7 The contents of the mapping are not affected by the removal of
+        //:   the file once mapped.
+        //:
+        //: 8 Both overloads of 'open' are equivalent.
+        //
+        // Plan:
+        //: 1 Create files of various sizes, and verify the state of objects
+        //:   mapping them with either overload of 'open'.  (C-1..3, 8)
+        //:
+        //: 2 Open a non-existent file, with and without a previous mapping.
+        //:   (C-4)
+        //:
+        //: 3 Open several files successively with the same object.  (C-5)
+        //:
+        //: 4 Close objects with and without a mapping.  (C-6)
+        //:
+        //: 5 Remove a file while mapped and verify the mapping.  (C-7)
+        //
+        // Testing:
+        //   MappedFile();
+        //   ~MappedFile();
+        //   void close();
+        //   int open(const char *path, AccessPattern pattern, bool huge);
+        //   int open(const string& path, AccessPattern pattern, bool huge);
+        //   const char *data() const;
+        //   bool isOpen() const;
+        //   bsl::size_t size() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "OPEN, CLOSE, AND ACCESSORS" << endl
+                          << "==========================" << endl;
+
+        const bsl::size_t SIZES[] = { 0, 1, 100, 4095, 4096, 4097, 65536,
+                                      1000 * 1000 };
+        const int NUM_SIZES = static_cast<int>(sizeof SIZES / sizeof *SIZES);
+
+        if (verbose) cout << "\nMapping files of various sizes." << endl;
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const bsl::size_t SIZE     = SIZES[ti];
+            const bsl::string CONTENTS = makeContents(SIZE);
+            const bsl::string fileName = createFile(CONTENTS);
+
+            if (veryVerbose) { T_ P(SIZE) }
+
+            for (int overload = 0; overload < 2; ++overload) {
+                Obj mX;  const Obj& X = mX;
+
+                ASSERTV(SIZE, !X.isOpen());
+                ASSERTV(SIZE, 0 == X.data());
+                ASSERTV(SIZE, 0 == X.size());
+
+                const int rc = overload
+                               ? mX.open(fileName)
+                               : mX.open(fileName.c_str());
+                ASSERTV(SIZE, overload, 0 == rc);
+                ASSERTV(SIZE, overload, X.isOpen());
+                ASSERTV(SIZE, overload, SIZE == X.size());
+                ASSERTV(SIZE, overload, (0 == SIZE) == (0 == X.data()));
+                ASSERTV(SIZE, overload, 0 == bsl::memcmp(X.data(),
+                                                         CONTENTS.data(),
+                                                         SIZE));
+
+                mX.close();
+                ASSERTV(SIZE, overload, !X.isOpen());
+                ASSERTV(SIZE, overload, 0 == X.data());
+                ASSERTV(SIZE, overload, 0 == X.size());
+
+                mX.close();
+                ASSERTV(SIZE, overload, !X.isOpen());
+            }
+
+            Util::remove(fileName);
+        }
+
+        if (verbose) cout << "\nOpening a non-existent file." << endl;
+        {
+            const bsl::string CONTENTS = makeContents(10);
+            const bsl::string fileName = createFile(CONTENTS);
+            const bsl::string missing  = fileName + ".missing";
+
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(0 != mX.open(missing));
+            ASSERT(!X.isOpen());
+            ASSERT(0 == X.data());
+            ASSERT(0 == X.size());
+
+            ASSERT(0 == mX.open(fileName));
+            ASSERT(X.isOpen());
+
+            ASSERT(0 != mX.open(missing));
+            ASSERT(!X.isOpen());
+            ASSERT(0 == X.data());
+            ASSERT(0 == X.size());
+
+            Util::remove(fileName);
+        }
+
+        if (verbose) cout << "\nReplacing and outliving a mapping." << endl;
+        {
+            const bsl::string CONTENTS1 = makeContents(5000);
+            const bsl::string CONTENTS2 = makeContents(300);
+            const bsl::string fileName1 = createFile(CONTENTS1);
+            const bsl::string fileName2 = createFile(CONTENTS2);
+
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(0 == mX.open(fileName1));
+            ASSERT(CONTENTS1.size() == X.size());
+
+            ASSERT(0 == mX.open(fileName2));
+            ASSERT(CONTENTS2.size() == X.size());
+            ASSERT(0 == bsl::memcmp(X.data(), CONTENTS2.data(), X.size()));
+
+            Util::remove(fileName2);
+            ASSERT(0 == bsl::memcmp(X.data(), CONTENTS2.data(), X.size()));
+
+            ASSERT(0 == mX.open(fileName1));
+            ASSERT(0 == bsl::memcmp(X.data(), CONTENTS1.data(), X.size()));
+
+            Util::remove(fileName1);
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Map a small file and verify its contents.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        const bsl::string CONTENTS("Hello, world!");
+        const bsl::string fileName = createFile(CONTENTS);
+
+        {
+            Obj mX;  const Obj& X = mX;
+            ASSERT(!X.isOpen());
+
+            ASSERT(0 == mX.open(fileName));
+            ASSERT(X.isOpen());
+            ASSERT(CONTENTS == bsl::string(X.data(), X.size()));
+        }
+
+        Util::remove(fileName);
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
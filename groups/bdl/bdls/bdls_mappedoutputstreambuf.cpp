@@ -0,0 +1,331 @@
+// bdls_mappedoutputstreambuf.cpp                                     -*-C++-*-
+#include <bdls_mappedoutputstreambuf.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdls_mappedoutputstreambuf_cpp,"$Id$ $CSID$")
+
+#include <bdls_memoryutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstring.h>
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+///Implementation Notes
+///--------------------
+// The put area of the stream buffer is the window currently mapped, with
+// 'pbase()' at the start of the window (not at the position at which the
+// window was first written), so that the current position is always
+// 'd_windowOffset + (pptr() - pbase())'.  Windows start at multiples of the
+// window size, which is itself a multiple of the allocation granularity of
+// mappings on every supported platform (64 kilobytes on Windows, the page
+// size elsewhere), as mapping offsets must be.
+//
+// The reserved size of the file is tracked in 'd_reservedSize' so that
+// growing the file is only attempted when a window would extend beyond it,
+// rather than on every window change.
+
+namespace BloombergLP {
+namespace bdls {
+
+namespace {
+namespace u {
+
+typedef FilesystemUtil::FileDescriptor FileDescriptor;
+typedef FilesystemUtil::Offset         Offset;
+
+enum {
+    k_MIN_GRANULARITY = 64 * 1024  // allocation granularity of mappings on
+                                   // Windows, and a multiple of the page size
+                                   // elsewhere
+};
+
+bsl::size_t roundWindowSize(bsl::size_t windowSize)
+    // Return the specified 'windowSize' rounded up to a multiple of the
+    // allocation granularity of memory mappings.
+{
+    const bsl::size_t granularity = bsl::max<bsl::size_t>(
+                                         k_MIN_GRANULARITY,
+                                         MemoryUtil::pageSize());
+
+    return (windowSize + granularity - 1) / granularity * granularity;
+}
+
+int truncate(FileDescriptor descriptor, Offset size)
+    // Set the size of the file having the specified 'descriptor' to the
+    // specified 'size'.  Return 0 on success, and a non-zero value otherwise.
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    LARGE_INTEGER newSize;
+    newSize.QuadPart = size;
+
+    if (!SetFilePointerEx(descriptor, newSize, NULL, FILE_BEGIN)) {
+        return -1;                                                    // RETURN
+    }
+    return SetEndOfFile(descriptor) ? 0 : -1;
+#else
+    return ::ftruncate(descriptor, static_cast<off_t>(size));
+#endif
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+                       // ---------------------------
+                       // class MappedOutputStreamBuf
+                       // ---------------------------
+
+// CONSTANTS
+const bsl::size_t            MappedOutputStreamBuf::k_DEFAULT_WINDOW_SIZE;
+const FilesystemUtil::Offset MappedOutputStreamBuf::k_DEFAULT_GROWTH_INCREMENT;
+
+// PRIVATE MANIPULATORS
+int MappedOutputStreamBuf::mapWindow(Offset position)
+{
+    BSLS_ASSERT(0 == d_window_p);
+    BSLS_ASSERT(0 <= position);
+
+    const Offset windowSize   = static_cast<Offset>(d_windowSize);
+    const Offset windowOffset = position - position % windowSize;
+    const Offset windowEnd    = windowOffset + windowSize;
+
+    if (windowEnd > d_reservedSize) {
+        const Offset newSize = bsl::max(windowEnd,
+                                        d_reservedSize + d_growthIncrement);
+
+        if (0 != FilesystemUtil::growFile(d_descriptor, newSize, true)) {
+            return -1;                                                // RETURN
+        }
+        d_reservedSize = newSize;
+    }
+
+    void *address;
+    if (0 != FilesystemUtil::map(d_descriptor,
+                                 &address,
+                                 windowOffset,
+                                 d_windowSize,
+                                 MemoryUtil::k_ACCESS_READ_WRITE)) {
+        return -1;                                                    // RETURN
+    }
+
+    d_window_p     = static_cast<char *>(address);
+    d_windowOffset = windowOffset;
+
+    setp(d_window_p, d_window_p + d_windowSize);
+    pbump(static_cast<int>(position - windowOffset));
+
+    return 0;
+}
+
+void MappedOutputStreamBuf::unmapWindow()
+{
+    if (0 == d_window_p) {
+        return;                                                       // RETURN
+    }
+
+    const Offset current = position();
+
+    // Errors are ignored: the window is unmapped (and written back
+    // eventually) regardless.
+
+    FilesystemUtil::sync(d_window_p, d_windowSize, false);
+    FilesystemUtil::unmap(d_window_p, d_windowSize);
+
+    d_window_p     = 0;
+    d_windowOffset = current;
+    setp(0, 0);
+}
+
+// CREATORS
+MappedOutputStreamBuf::MappedOutputStreamBuf(bsl::size_t windowSize)
+: d_descriptor(FilesystemUtil::k_INVALID_FD)
+, d_willCloseFlag(false)
+, d_windowSize(u::roundWindowSize(windowSize ? windowSize
+                                             : k_DEFAULT_WINDOW_SIZE))
+, d_windowOffset(0)
+, d_window_p(0)
+, d_reservedSize(0)
+, d_growthIncrement(k_DEFAULT_GROWTH_INCREMENT)
+, d_errorFlag(false)
+{
+}
+
+MappedOutputStreamBuf::~MappedOutputStreamBuf()
+{
+    clear();
+}
+
+// MANIPULATORS
+int MappedOutputStreamBuf::clear()
+{
+    if (!isOpened()) {
+        return 0;                                                     // RETURN
+    }
+
+    unmapWindow();
+
+    int rc = 0;
+
+    if (0 != u::truncate(d_descriptor, d_windowOffset)) {
+        rc = -1;
+    }
+    if (d_willCloseFlag && 0 != FilesystemUtil::close(d_descriptor)) {
+        rc = -1;
+    }
+
+    d_descriptor    = FilesystemUtil::k_INVALID_FD;
+    d_willCloseFlag = false;
+    d_windowOffset  = 0;
+    d_reservedSize  = 0;
+    d_errorFlag     = false;
+
+    return rc;
+}
+
+int MappedOutputStreamBuf::reset(
+                           FilesystemUtil::FileDescriptor descriptor,
+                           FilesystemUtil::Offset         position,
+                           bool                           willCloseOnResetFlag,
+                           FilesystemUtil::Offset         growthIncrement)
+{
+    BSLS_ASSERT(FilesystemUtil::k_INVALID_FD != descriptor);
+    BSLS_ASSERT(0 <= position);
+    BSLS_ASSERT(0 <= growthIncrement);
+
+    int rc = clear();
+
+    const Offset fileSize = FilesystemUtil::seek(
+                                       descriptor,
+                                       0,
+                                       FilesystemUtil::e_SEEK_FROM_END);
+    if (0 > fileSize) {
+        if (willCloseOnResetFlag) {
+            FilesystemUtil::close(descriptor);
+        }
+        return -1;                                                    // RETURN
+    }
+
+    d_descriptor      = descriptor;
+    d_willCloseFlag   = willCloseOnResetFlag;
+    d_windowOffset    = position;
+    d_reservedSize    = fileSize;
+    d_growthIncrement = growthIncrement ? growthIncrement
+                                        : k_DEFAULT_GROWTH_INCREMENT;
+
+    if (0 != mapWindow(position)) {
+        // Do not truncate a file that this object has not written.
+
+        if (willCloseOnResetFlag) {
+            FilesystemUtil::close(descriptor);
+        }
+        d_descriptor   = FilesystemUtil::k_INVALID_FD;
+        d_windowOffset = 0;
+        d_reservedSize = 0;
+        return -1;                                                    // RETURN
+    }
+
+    return rc;
+}
+
+// PROTECTED MANIPULATORS
+MappedOutputStreamBuf::int_type MappedOutputStreamBuf::overflow(int_type c)
+{
+    if (!isOpened() || d_errorFlag) {
+        return traits_type::eof();                                    // RETURN
+    }
+
+    const Offset current = position();
+
+    unmapWindow();
+
+    if (0 != mapWindow(current)) {
+        d_errorFlag = true;
+        return traits_type::eof();                                    // RETURN
+    }
+
+    if (traits_type::eq_int_type(c, traits_type::eof())) {
+        return traits_type::not_eof(c);                               // RETURN
+    }
+
+    *pptr() = traits_type::to_char_type(c);
+    pbump(1);
+
+    return c;
+}
+
+MappedOutputStreamBuf::pos_type
+MappedOutputStreamBuf::seekoff(off_type                offset,
+                               bsl::ios_base::seekdir  whence,
+                               bsl::ios_base::openmode mode)
+{
+    if (!isOpened()
+     || 0 != offset
+     || bsl::ios_base::beg == whence
+     || 0 == (mode & bsl::ios_base::out)) {
+        return pos_type(-1);                                          // RETURN
+    }
+
+    return pos_type(position());
+}
+
+MappedOutputStreamBuf::pos_type
+MappedOutputStreamBuf::seekpos(pos_type, bsl::ios_base::openmode)
+{
+    return pos_type(-1);
+}
+
+int MappedOutputStreamBuf::sync()
+{
+    return isOpened() && !d_errorFlag ? 0 : -1;
+}
+
+bsl::streamsize MappedOutputStreamBuf::xsputn(const char      *buffer,
+                                              bsl::streamsize  numBytes)
+{
+    BSLS_ASSERT(buffer || 0 == numBytes);
+
+    bsl::streamsize numWritten = 0;
+
+    while (numWritten < numBytes) {
+        if (epptr() == pptr()
+         && traits_type::eq_int_type(overflow(), traits_type::eof())) {
+            break;
+        }
+
+        const bsl::streamsize n = bsl::min<bsl::streamsize>(
+                                                        numBytes - numWritten,
+                                                        epptr() - pptr());
+
+        bsl::memcpy(pptr(), buffer + numWritten, static_cast<bsl::size_t>(n));
+        pbump(static_cast<int>(n));
+        numWritten += n;
+    }
+
+    return numWritten;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,338 @@
+// bdls_mappedoutputstreambuf.h                                       -*-C++-*-
+#ifndef INCLUDED_BDLS_MAPPEDOUTPUTSTREAMBUF
+#define INCLUDED_BDLS_MAPPEDOUTPUTSTREAMBUF
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an output stream buffer writing through a memory mapping.
+//
+//@CLASSES:
+//  bdls::MappedOutputStreamBuf: output 'streambuf' over a sliding file mapping
+//
+//@SEE_ALSO: bdls_fdstreambuf, bdls_filesystemutil
+//
+//@DESCRIPTION: This component provides a class, 'bdls::MappedOutputStreamBuf',
+// that implements the output portion of the 'bsl::basic_streambuf' protocol
+// by copying characters directly into a memory mapping of a file, rather than
+// into a buffer that is written to the file by system calls.  Only a window of
+// the file, of a size specified at construction, is mapped at any one time;
+// when the window is full, it is unmapped, and the next window of the file is
+// mapped.  Characters written to the stream buffer are therefore copied once,
+// into the page cache, and the only system calls made are those that move the
+// window.
+//
+// A 'MappedOutputStreamBuf' appends to a file, starting at a position supplied
+// to 'reset'.  Since writing to a mapped page beyond the end of a file is
+// undefined behavior (and, where the file system reserves space lazily, a
+// full disk would be reported by a signal rather than an error status), the
+// file is grown, and its space reserved on disk, in large increments ahead of
+// the window, and a failure to do so is reported as an output error of the
+// stream buffer.  When the stream buffer is cleared (or destroyed, or reset
+// to another file), the file is truncated to the number of characters
+// actually written.
+//
+///Visibility and Durability
+///-------------------------
+// Characters written to a 'MappedOutputStreamBuf' are immediately visible to
+// other processes reading the file (the mapping is shared), so that 'sync' has
+// nothing to do and makes no system call.  Writeback of each window to the
+// storage device is initiated (without waiting for it to complete) when the
+// window is unmapped, so that the modified pages are written out periodically,
+// every window's worth of output, rather than only when the kernel flushes its
+// dirty pages.  Neither operation makes the data durable in the event of a
+// system crash; use 'bdls::FilesystemUtil::sync' or 'fsync' for that.
+//
+// Note that, until the stream buffer is cleared, the size of the file reflects
+// the reserved space rather than the number of characters written, and the
+// reserved but unwritten part of the file reads as unspecified (typically
+// zero) bytes; a file left by a process that terminated abnormally therefore
+// ends with such bytes.
+//
+///Seeking
+///-------
+// A 'MappedOutputStreamBuf' only appends to its file: 'seekoff' supports
+// reporting the current position (as used by 'bsl::ostream::tellp'), and no
+// other form of seeking.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Writing a File Through a Mapping
+///- - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we want to write a large number of short lines to a file
+// without making a system call for each line.
+//
+// First, we open the file for reading and writing (which mapping the file for
+// writing requires on most platforms):
+//..
+//  typedef bdls::FilesystemUtil FileUtil;
+//
+//  FileUtil::FileDescriptor fd = FileUtil::open(fileName,
+//                                               FileUtil::e_OPEN_OR_CREATE,
+//                                               FileUtil::e_READ_WRITE,
+//                                               FileUtil::e_TRUNCATE);
+//  assert(FileUtil::k_INVALID_FD != fd);
+//..
+// Then, we create a 'bdls::MappedOutputStreamBuf' that maps 64 kilobytes of
+// the file at a time, associate it with the file, starting at its beginning,
+// and create an 'bsl::ostream' using it:
+//..
+//  bdls::MappedOutputStreamBuf streamBuf(64 * 1024);
+//
+//  int rc = streamBuf.reset(fd, 0);
+//  assert(0 == rc);
+//
+//  bsl::ostream os(&streamBuf);
+//..
+// Next, we write the lines:
+//..
+//  for (int i = 0; i < 10000; ++i) {
+//      os << "line " << i << '\n';
+//  }
+//  assert(os);
+//
+//  const bsl::streamoff length = os.tellp();
+//  assert(length <= FileUtil::getFileSize(fileName));
+//..
+// Notice that the size of the file is at least the number of characters
+// written, since space is reserved ahead of the window.
+//
+// Finally, we clear the stream buffer, which truncates the file to the
+// characters written and closes it:
+//..
+//  rc = streamBuf.clear();
+//  assert(0 == rc);
+//  assert(length == FileUtil::getFileSize(fileName));
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdls_filesystemutil.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_ios.h>
+#include <bsl_streambuf.h>
+
+namespace BloombergLP {
+namespace bdls {
+
+                       // ===========================
+                       // class MappedOutputStreamBuf
+                       // ===========================
+
+class MappedOutputStreamBuf : public bsl::streambuf {
+    // This class implements the output portion of the 'bsl::streambuf'
+    // protocol over a sliding memory mapping of a file.  Input and seeking
+    // (other than reporting the current position) are not supported.
+
+    // PRIVATE TYPES
+    typedef FilesystemUtil::FileDescriptor FileDescriptor;
+    typedef FilesystemUtil::Offset         Offset;
+
+    // DATA
+    FileDescriptor  d_descriptor;        // file written, or 'k_INVALID_FD'
+
+    bool            d_willCloseFlag;     // 'true' if 'd_descriptor' is closed
+                                         // by 'clear'
+
+    bsl::size_t     d_windowSize;        // size of each mapped window
+
+    Offset          d_windowOffset;      // offset in the file of the window
+                                         // currently mapped, or of the next
+                                         // character if none is mapped
+
+    char           *d_window_p;          // currently mapped window, or 0
+
+    Offset          d_reservedSize;      // size to which the file has been
+                                         // grown
+
+    Offset          d_growthIncrement;   // minimum amount by which the file
+                                         // is grown
+
+    bool            d_errorFlag;         // 'true' if moving the window failed
+
+  private:
+    // NOT IMPLEMENTED
+    MappedOutputStreamBuf(const MappedOutputStreamBuf&);
+    MappedOutputStreamBuf& operator=(const MappedOutputStreamBuf&);
+
+    // PRIVATE MANIPULATORS
+    int mapWindow(Offset position);
+        // Map the window of the file containing the specified 'position',
+        // growing the file as necessary, and make it the put area of this
+        // object, with the next character written at 'position'.  Return 0 on
+        // success, and a non-zero value otherwise.
+
+    void unmapWindow();
+        // Initiate writeback of the window currently mapped, if any, unmap
+        // it, and set the put area of this object to empty.
+
+  public:
+    // CONSTANTS
+    static const bsl::size_t k_DEFAULT_WINDOW_SIZE = 1024 * 1024;
+        // default size of the mapped window
+
+    static const Offset      k_DEFAULT_GROWTH_INCREMENT = 16 * 1024 * 1024;
+        // default minimum amount by which a file is grown
+
+    // CREATORS
+    explicit MappedOutputStreamBuf(bsl::size_t windowSize = 0);
+        // Create a stream buffer that is not associated with a file.
+        // Optionally specify a 'windowSize', the number of bytes of the file
+        // mapped at a time; if 'windowSize' is 0, 'k_DEFAULT_WINDOW_SIZE' is
+        // used.  'windowSize' is rounded up to a multiple of the allocation
+        // granularity of memory mappings on this platform.  Note that this
+        // object allocates no memory.
+
+    virtual ~MappedOutputStreamBuf();
+        // Clear this stream buffer (see 'clear') and destroy it.
+
+    // MANIPULATORS
+    int clear();
+        // Unmap the window currently mapped, truncate the associated file to
+        // the current position, close the file if so specified at 'reset',
+        // and disassociate this object from the file.  Return 0 on success,
+        // and a non-zero value otherwise (in which case this object is still
+        // disassociated from the file).  This method has no effect, and
+        // returns 0, if this object is not associated with a file.
+
+    int reset(FilesystemUtil::FileDescriptor descriptor,
+              FilesystemUtil::Offset         position,
+              bool                           willCloseOnResetFlag = true,
+              FilesystemUtil::Offset         growthIncrement = 0);
+        // Clear this stream buffer (see 'clear') and associate it with the
+        // specified 'descriptor', to which characters are written starting at
+        // the specified 'position'.  Optionally specify a
+        // 'willCloseOnResetFlag' indicating whether 'descriptor' is closed
+        // when this object is cleared, reset, or destroyed.  Optionally
+        // specify a 'growthIncrement', the minimum number of bytes by which
+        // the file is grown, with its space reserved on disk, when the window
+        // reaches the end of the space already reserved; if 'growthIncrement'
+        // is 0, 'k_DEFAULT_GROWTH_INCREMENT' is used.  Return 0 on success,
+        // and a non-zero value otherwise (in which case this object is not
+        // associated with a file, and 'descriptor' is closed if
+        // 'willCloseOnResetFlag' is 'true').  The behavior is undefined
+        // unless 'descriptor' refers to a regular file open for both reading
+        // and writing, '0 <= position', '0 <= growthIncrement', and the file
+        // is not truncated by other means while associated with this object.
+        // Note that bytes of the file at and beyond 'position' are
+        // overwritten, and that a file created with the anticipated size
+        // already reserved (see 'FilesystemUtil::growFile') is not grown
+        // again until its reserved space is exhausted.
+
+    // ACCESSORS
+    FilesystemUtil::FileDescriptor fileDescriptor() const;
+        // Return the file descriptor associated with this object, or
+        // 'FilesystemUtil::k_INVALID_FD' if there is none.
+
+    bool isOpened() const;
+        // Return 'true' if this object is associated with a file, and 'false'
+        // otherwise.
+
+    FilesystemUtil::Offset position() const;
+        // Return the offset in the file at which the next character will be
+        // written, or -1 if this object is not associated with a file.
+
+    bsl::size_t windowSize() const;
+        // Return the number of bytes of the file mapped at a time.
+
+  protected:
+    // PROTECTED MEMBER FUNCTIONS
+
+    // The following member functions override protected virtual functions
+    // inherited from the base class, and are specified to be protected as part
+    // of the standard library 'bsl::streambuf' interface.
+
+    // PROTECTED MANIPULATORS
+    virtual int_type overflow(int_type c = traits_type::eof());
+        // Map the next window of the file and, unless the optionally specified
+        // 'c' is 'traits_type::eof()', write 'c' to it.  Return
+        // 'traits_type::eof()' on failure, and a value other than
+        // 'traits_type::eof()' otherwise.
+
+    virtual pos_type seekoff(
+        off_type                offset,
+        bsl::ios_base::seekdir  whence,
+        bsl::ios_base::openmode mode = bsl::ios_base::in | bsl::ios_base::out);
+        // Return the current position, as for 'position', if the specified
+        // 'offset' is 0, the specified 'whence' is 'bsl::ios_base::cur' or
+        // 'bsl::ios_base::end', and the optionally specified 'mode' includes
+        // 'bsl::ios_base::out', and -1 otherwise.
+
+    virtual pos_type seekpos(
+        pos_type                position,
+        bsl::ios_base::openmode mode = bsl::ios_base::in | bsl::ios_base::out);
+        // Return -1.  Note that the specified 'position' and 'mode' are
+        // ignored, since seeking is not supported.
+
+    virtual int sync();
+        // Return 0 if this object is associated with a file and no output
+        // error has occurred, and -1 otherwise.  Note that characters written
+        // are already visible to readers of the file (see {Visibility and
+        // Durability}), so that this method makes no system call.
+
+    virtual bsl::streamsize xsputn(const char      *buffer,
+                                   bsl::streamsize  numBytes);
+        // Write up to the specified 'numBytes' characters from the specified
+        // 'buffer' to the file, moving the window as needed, and return the
+        // number of characters written.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                       // ---------------------------
+                       // class MappedOutputStreamBuf
+                       // ---------------------------
+
+// ACCESSORS
+inline
+FilesystemUtil::FileDescriptor MappedOutputStreamBuf::fileDescriptor() const
+{
+    return d_descriptor;
+}
+
+inline
+bool MappedOutputStreamBuf::isOpened() const
+{
+    return FilesystemUtil::k_INVALID_FD != d_descriptor;
+}
+
+inline
+FilesystemUtil::Offset MappedOutputStreamBuf::position() const
+{
+    if (!isOpened()) {
+        return -1;                                                    // RETURN
+    }
+    return d_windowOffset + (pptr() - pbase());
+}
+
+inline
+bsl::size_t MappedOutputStreamBuf::windowSize() const
+{
+    return d_windowSize;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,810 @@
+// bdls_mappedoutputstreambuf.t.cpp                                   -*-C++-*-
+#include <bdls_mappedoutputstreambuf.h>
+
+#include <bdls_fdstreambuf.h>
+#include <bdls_filesystemutil.h>
+#include <bdls_memoryutil.h>
+#include <bdls_pathutil.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_platform.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_fstream.h>
+#include <bsl_iostream.h>
+#include <bsl_ostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>
+#endif
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+using bsl::flush;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test provides a mechanism, an output stream buffer
+// writing to a file through a sliding memory mapping.  It is tested by writing
+// to files in a temporary directory, through the stream buffer directly and
+// through a 'bsl::ostream', and comparing the resulting file contents and
+// sizes with those expected.  Small windows and growth increments are used so
+// that the window is moved, and the file grown, many times.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit MappedOutputStreamBuf(bsl::size_t windowSize = 0);
+// [ 2] ~MappedOutputStreamBuf();
+//
+// MANIPULATORS
+// [ 2] int clear();
+// [ 2] int reset(descriptor, position, willCloseOnResetFlag, growthIncrement);
+// [ 3] int_type overflow(int_type c);
+// [ 3] pos_type seekoff(off_type, seekdir, openmode);
+// [ 3] pos_type seekpos(pos_type, openmode);
+// [ 3] int sync();
+// [ 3] bsl::streamsize xsputn(const char *buffer, bsl::streamsize numBytes);
+//
+// ACCESSORS
+// [ 2] FilesystemUtil::FileDescriptor fileDescriptor() const;
+// [ 2] bool isOpened() const;
+// [ 3] FilesystemUtil::Offset position() const;
+// [ 2] bsl::size_t windowSize() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST: FLUSHED LINES
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                GLOBAL TYPEDEFS/CONSTANTS/VARIABLES FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdls::MappedOutputStreamBuf Obj;
+typedef bdls::FilesystemUtil        FUtil;
+typedef bsls::Types::Int64          Int64;
+
+int                 test;
+bool             verbose;
+bool         veryVerbose;
+bool     veryVeryVerbose;
+bool veryVeryVeryVerbose;
+
+// ============================================================================
+//                       GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+class TempDirectoryGuard {
+    // This class implements a scoped temporary directory guard.  The guard
+    // tries to create a temporary directory in the system-wide temp directory
+    // and falls back to the current directory.
+
+    // DATA
+    bsl::string       d_dirName;      // path to the created directory
+    bslma::Allocator *d_allocator_p;  // memory allocator (held, not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    TempDirectoryGuard(const TempDirectoryGuard&);
+    TempDirectoryGuard& operator=(const TempDirectoryGuard&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(TempDirectoryGuard,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit TempDirectoryGuard(bslma::Allocator *basicAllocator = 0)
+        // Create temporary directory in the system-wide temp or current
+        // directory.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.
+    : d_dirName(bslma::Default::allocator(basicAllocator))
+    , d_allocator_p(bslma::Default::allocator(basicAllocator))
+    {
+        bsl::string tmpPath(d_allocator_p);
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+        char tmpPathBuf[MAX_PATH];
+        GetTempPath(MAX_PATH, tmpPathBuf);
+        tmpPath.assign(tmpPathBuf);
+#else
+        const char *envTmpPath = bsl::getenv("TMPDIR");
+        if (envTmpPath) {
+            tmpPath.assign(envTmpPath);
+        }
+#endif
+
+        int res = bdls::PathUtil::appendIfValid(&tmpPath, "bdls_");
+        ASSERTV(tmpPath, 0 == res);
+
+        res = bdls::FilesystemUtil::createTemporaryDirectory(&d_dirName,
+                                                             tmpPath);
+        ASSERTV(tmpPath, 0 == res);
+    }
+
+    ~TempDirectoryGuard()
+        // Destroy this object and remove the temporary directory (recursively)
+        // created at construction.
+    {
+        bdls::FilesystemUtil::remove(d_dirName, true);
+    }
+
+    // ACCESSORS
+    const bsl::string& getTempDirName() const
+        // Return a 'const' reference to the name of the created temporary
+        // directory.
+    {
+        return d_dirName;
+    }
+};
+
+namespace u {
+
+FUtil::FileDescriptor openReadWrite(const bsl::string& path)
+    // Open, for reading and writing, the file at the specified 'path',
+    // creating it if it does not exist, and return its descriptor.
+{
+    return FUtil::open(path, FUtil::e_OPEN_OR_CREATE, FUtil::e_READ_WRITE);
+}
+
+bsl::string readFile(const bsl::string& path)
+    // Return the content of the file at the specified 'path'.
+{
+    bsl::ifstream      in(path.c_str(), bsl::ios::in | bsl::ios::binary);
+    bsl::ostringstream content;
+    content << in.rdbuf();
+    return content.str();
+}
+
+void writeFile(const bsl::string& path, const bsl::string& content)
+    // Replace the content of the file at the specified 'path' with the
+    // specified 'content'.
+{
+    bsl::ofstream out(path.c_str(), bsl::ios::out | bsl::ios::binary);
+    out << content;
+}
+
+char patternChar(Int64 position)
+    // Return the character expected at the specified 'position' of a file
+    // written in the output test.
+{
+    return static_cast<char>('a' + position % 23);
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    test                = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    verbose             = argc > 2;
+    veryVerbose         = argc > 3;
+    veryVeryVerbose     = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        TempDirectoryGuard tempDirGuard;
+
+        bsl::string fileName(tempDirGuard.getTempDirName());
+        bdls::PathUtil::appendRaw(&fileName, "usage");
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Writing a File Through a Mapping
+///- - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we want to write a large number of short lines to a file
+// without making a system call for each line.
+//
+// First, we open the file for reading and writing (which mapping the file for
+// writing requires on most platforms):
+//..
+    typedef bdls::FilesystemUtil FileUtil;
+
+    FileUtil::FileDescriptor fd = FileUtil::open(fileName,
+                                                 FileUtil::e_OPEN_OR_CREATE,
+                                                 FileUtil::e_READ_WRITE,
+                                                 FileUtil::e_TRUNCATE);
+    ASSERT(FileUtil::k_INVALID_FD != fd);
+//..
+// Then, we create a 'bdls::MappedOutputStreamBuf' that maps 64 kilobytes of
+// the file at a time, associate it with the file, starting at its beginning,
+// and create an 'bsl::ostream' using it:
+//..
+    bdls::MappedOutputStreamBuf streamBuf(64 * 1024);
+
+    int rc = streamBuf.reset(fd, 0);
+    ASSERT(0 == rc);
+
+    bsl::ostream os(&streamBuf);
+//..
+// Next, we write the lines:
+//..
+    for (int i = 0; i < 10000; ++i) {
+        os << "line " << i << '\n';
+    }
+    ASSERT(os);
+
+    const bsl::streamoff length = os.tellp();
+    ASSERT(length <= FileUtil::getFileSize(fileName));
+//..
+// Notice that the size of the file is at least the number of characters
+// written, since space is reserved ahead of the window.
+//
+// Finally, we clear the stream buffer, which truncates the file to the
+// characters written and closes it:
+//..
+    rc = streamBuf.clear();
+    ASSERT(0 == rc);
+    ASSERT(length == FileUtil::getFileSize(fileName));
+//..
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING OUTPUT
+        //
+        // Concerns:
+        //: 1 Characters written with 'sputc' and 'sputn', in any mixture and
+        //:   of any length, are written to the file in order, including across
+        //:   window boundaries and growths of the file.
+        //:
+        //: 2 'position' (and 'tellp') report the number of characters written
+        //:   since the position supplied to 'reset'.
+        //:
+        //: 3 The file is at least as large as the position while the stream
+        //:   buffer is associated with it, and is truncated to the position
+        //:   when it is cleared.
+        //:
+        //: 4 Seeking other than to report the position fails, and 'sync'
+        //:   succeeds while the stream buffer is associated with a file.
+        //
+        // Plan:
+        //: 1 Using a small window and growth increment, write a pattern
+        //:   through an 'ostream' in chunks of varying lengths (including
+        //:   lengths greater than the window), single characters, and
+        //:   'flush'es, checking 'tellp', 'position', and the file size after
+        //:   each chunk.  Clear the stream buffer and compare the file with
+        //:   the pattern.  (C-1..3)
+        //:
+        //: 2 Verify the results of 'seekoff', 'seekpos', and 'sync' with and
+        //:   without an associated file.  (C-4)
+        //
+        // Testing:
+        //   int_type overflow(int_type c);
+        //   pos_type seekoff(off_type, seekdir, openmode);
+        //   pos_type seekpos(pos_type, openmode);
+        //   int sync();
+        //   bsl::streamsize xsputn(const char *buffer, bsl::streamsize n);
+        //   FilesystemUtil::Offset position() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING OUTPUT" << endl
+                          << "==============" << endl;
+
+        TempDirectoryGuard tempDirGuard;
+
+        bsl::string path(tempDirGuard.getTempDirName());
+        bdls::PathUtil::appendRaw(&path, "pattern");
+
+        Obj mX(1);  const Obj& X = mX;
+        const Int64 WINDOW = static_cast<Int64>(X.windowSize());
+
+        const int LENGTHS[] = { 1, 7, 0, 4095, 4096, 4097,
+                                static_cast<int>(WINDOW) - 1,
+                                static_cast<int>(WINDOW),
+                                static_cast<int>(WINDOW) + 1,
+                                3 * static_cast<int>(WINDOW) + 17,
+                                100 };
+        const int NUM_LENGTHS = static_cast<int>(sizeof LENGTHS
+                                                 / sizeof *LENGTHS);
+
+        bsl::string chunk;
+
+        for (int growth = 0; growth < 2; ++growth) {
+            const Int64 INCREMENT = growth ? 3 * WINDOW : 1;
+
+            FUtil::FileDescriptor fd = u::openReadWrite(path);
+            ASSERT(FUtil::k_INVALID_FD != fd);
+            ASSERT(0 == mX.reset(fd, 0, true, INCREMENT));
+
+            bsl::ostream os(&mX);
+            Int64        position = 0;
+
+            for (int round = 0; round < 3; ++round) {
+                for (int i = 0; i < NUM_LENGTHS; ++i) {
+                    const int LENGTH = LENGTHS[i];
+
+                    chunk.resize(LENGTH);
+                    for (int j = 0; j < LENGTH; ++j) {
+                        chunk[j] = u::patternChar(position + j);
+                    }
+
+                    if (1 == LENGTH && 1 == round) {
+                        os.put(chunk[0]);
+                    }
+                    else {
+                        os.write(chunk.data(), LENGTH);
+                    }
+                    if (2 == round) {
+                        os.flush();
+                    }
+                    position += LENGTH;
+
+                    ASSERTV(growth, round, i, os.good());
+                    ASSERTV(growth, round, i, position == os.tellp());
+                    ASSERTV(growth, round, i, position == X.position());
+                    ASSERTV(growth, round, i,
+                            position <= FUtil::getFileSize(path));
+                }
+            }
+
+            ASSERT(0 == mX.pubsync());
+            ASSERT(-1 == mX.pubseekoff(0, bsl::ios_base::beg));
+            ASSERT(-1 == mX.pubseekoff(1, bsl::ios_base::cur));
+            ASSERT(-1 == mX.pubseekoff(0, bsl::ios_base::cur,
+                                       bsl::ios_base::in));
+            ASSERT(position == mX.pubseekoff(0, bsl::ios_base::end));
+            ASSERT(-1 == mX.pubseekpos(0));
+            ASSERT(-1 == mX.pubseekpos(position));
+
+            ASSERT(0 == mX.clear());
+            ASSERT(position == FUtil::getFileSize(path));
+
+            const bsl::string content = u::readFile(path);
+            ASSERT(static_cast<Int64>(content.size()) == position);
+
+            Int64 firstMismatch = -1;
+            for (Int64 i = 0; i < position; ++i) {
+                if (content[static_cast<bsl::size_t>(i)] !=
+                                                         u::patternChar(i)) {
+                    firstMismatch = i;
+                    break;
+                }
+            }
+            ASSERTV(growth, firstMismatch, -1 == firstMismatch);
+
+            FUtil::remove(path);
+        }
+
+        if (verbose) cout << "\tTesting without a file." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+
+            bsl::ostream os(&mX);
+            os << "x";
+            ASSERT(!os.good());
+
+            ASSERT(-1 == X.position());
+            ASSERT(-1 == mX.pubsync());
+            ASSERT(-1 == mX.pubseekoff(0, bsl::ios_base::cur));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING CREATORS, 'reset', AND 'clear'
+        //
+        // Concerns:
+        //: 1 The window size is the default if 0 is supplied, and is rounded
+        //:   up to a multiple of the page size (and of 64 kilobytes)
+        //:   otherwise.
+        //:
+        //: 2 'reset' writes from the supplied position, preserving the
+        //:   content of the file before it, and 'clear' truncates the file to
+        //:   the position reached, discarding any content after it.
+        //:
+        //: 3 The descriptor is closed by 'clear' (and by the destructor) if
+        //:   and only if so specified at 'reset'.
+        //:
+        //: 4 A file whose space was reserved beforehand is not grown by
+        //:   'reset'.
+        //:
+        //: 5 'reset' fails, without modifying the file, if the descriptor is
+        //:   not writable, and 'clear' on an object not associated with a file
+        //:   succeeds.
+        //
+        // Plan:
+        //: 1 Construct objects with various window sizes and verify
+        //:   'windowSize'.  (C-1)
+        //:
+        //: 2 Write a file, reset an object to it at various positions, write
+        //:   some characters, clear it, and verify the file content.  (C-2)
+        //:
+        //: 3 Reset with 'willCloseOnResetFlag' of 'false' and 'true', clear,
+        //:   and verify whether the descriptor is still usable.  (C-3)
+        //:
+        //: 4 Grow a file, with reserved space, to a size larger than the
+        //:   window, reset an object to it, and verify the file size.  (C-4)
+        //:
+        //: 5 Reset an object to a read-only descriptor and verify the result
+        //:   and the file.  (C-5)
+        //
+        // Testing:
+        //   explicit MappedOutputStreamBuf(bsl::size_t windowSize = 0);
+        //   ~MappedOutputStreamBuf();
+        //   int clear();
+        //   int reset(descriptor, position, willCloseOnResetFlag, growth);
+        //   FilesystemUtil::FileDescriptor fileDescriptor() const;
+        //   bool isOpened() const;
+        //   bsl::size_t windowSize() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING CREATORS, 'reset', AND 'clear'" << endl
+                          << "======================================" << endl;
+
+        TempDirectoryGuard tempDirGuard;
+
+        const bsl::size_t PAGE = bdls::MemoryUtil::pageSize();
+        const bsl::size_t GRAN = PAGE > 65536 ? PAGE : 65536;
+
+        if (verbose) cout << "\tTesting 'windowSize'." << endl;
+        {
+            const struct {
+                int         d_line;
+                bsl::size_t d_size;
+                bsl::size_t d_expected;
+            } DATA[] = {
+                { L_, 0,            Obj::k_DEFAULT_WINDOW_SIZE },
+                { L_, 1,            GRAN                       },
+                { L_, GRAN - 1,     GRAN                       },
+                { L_, GRAN,         GRAN                       },
+                { L_, GRAN + 1,     2 * GRAN                   },
+                { L_, 10 * GRAN,    10 * GRAN                  },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            for (int i = 0; i < NUM_DATA; ++i) {
+                const int LINE = DATA[i].d_line;
+
+                const Obj X(DATA[i].d_size);
+                ASSERTV(LINE, DATA[i].d_expected == X.windowSize());
+                ASSERTV(LINE, !X.isOpened());
+                ASSERTV(LINE, FUtil::k_INVALID_FD == X.fileDescriptor());
+            }
+        }
+
+        bsl::string path(tempDirGuard.getTempDirName());
+        bdls::PathUtil::appendRaw(&path, "reset");
+
+        if (verbose) cout << "\tTesting 'reset' positions." << endl;
+        {
+            const bsl::string ORIGINAL(1000, 'o');
+
+            const Int64 POSITIONS[] = { 0, 1, 500, 999, 1000 };
+            const int   NUM_POSITIONS = static_cast<int>(sizeof POSITIONS
+                                                       / sizeof *POSITIONS);
+
+            for (int i = 0; i < NUM_POSITIONS; ++i) {
+                const Int64 POSITION = POSITIONS[i];
+
+                u::writeFile(path, ORIGINAL);
+
+                FUtil::FileDescriptor fd = u::openReadWrite(path);
+                ASSERT(FUtil::k_INVALID_FD != fd);
+
+                Obj mX;  const Obj& X = mX;
+                ASSERTV(i, 0 == mX.reset(fd, POSITION));
+                ASSERTV(i, X.isOpened());
+                ASSERTV(i, fd == X.fileDescriptor());
+                ASSERTV(i, POSITION == X.position());
+
+                ASSERTV(i, 3 == mX.sputn("new", 3));
+                ASSERTV(i, 0 == mX.clear());
+                ASSERTV(i, !X.isOpened());
+                ASSERTV(i, FUtil::k_INVALID_FD == X.fileDescriptor());
+
+                const bsl::size_t PREFIX = static_cast<bsl::size_t>(POSITION);
+                const bsl::string EXPECTED = ORIGINAL.substr(0, PREFIX)
+                                           + "new";
+                ASSERTV(i, EXPECTED == u::readFile(path));
+            }
+        }
+
+        if (verbose) cout << "\tTesting 'willCloseOnResetFlag'." << endl;
+        {
+            for (int willClose = 0; willClose < 2; ++willClose) {
+                FUtil::FileDescriptor fd = u::openReadWrite(path);
+                ASSERT(FUtil::k_INVALID_FD != fd);
+                {
+                    Obj mX;
+                    ASSERT(0 == mX.reset(fd, 0, willClose));
+                    ASSERT(2 == mX.sputn("ab", 2));
+                    if (willClose) {
+                        continue;  // destructor clears
+                    }
+                    ASSERT(0 == mX.clear());
+                }
+
+                // The descriptor is still usable.
+
+                ASSERT(2 == FUtil::seek(fd, 0, FUtil::e_SEEK_FROM_END));
+                ASSERT(0 == FUtil::close(fd));
+            }
+            ASSERT("ab" == u::readFile(path));
+        }
+
+        if (verbose) cout << "\tTesting a preallocated file." << endl;
+        {
+            FUtil::remove(path);
+
+            const Int64 SIZE = 8 * static_cast<Int64>(GRAN);
+
+            FUtil::FileDescriptor fd = u::openReadWrite(path);
+            ASSERT(FUtil::k_INVALID_FD != fd);
+            ASSERT(0 == FUtil::growFile(fd, SIZE, true));
+
+            Obj mX(GRAN);
+            ASSERT(0 == mX.reset(fd, 0, true, 1));
+            ASSERT(SIZE == FUtil::getFileSize(path));
+
+            bsl::string data(static_cast<bsl::size_t>(SIZE), 'p');
+            ASSERT(SIZE == mX.sputn(data.data(), SIZE));
+            ASSERT(SIZE == FUtil::getFileSize(path));
+
+            ASSERT(1 == mX.sputn("q", 1));
+            ASSERT(SIZE + static_cast<Int64>(GRAN)
+                                                == FUtil::getFileSize(path));
+
+            ASSERT(0 == mX.clear());
+            ASSERT(SIZE + 1 == FUtil::getFileSize(path));
+        }
+
+        if (verbose) cout << "\tTesting failures." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+            ASSERT(0 == mX.clear());
+
+            u::writeFile(path, "content");
+
+            FUtil::FileDescriptor fd = FUtil::open(path,
+                                                   FUtil::e_OPEN,
+                                                   FUtil::e_READ_ONLY);
+            ASSERT(FUtil::k_INVALID_FD != fd);
+
+            ASSERT(0 != mX.reset(fd, 0, false));
+            ASSERT(!X.isOpened());
+            ASSERT("content" == u::readFile(path));
+
+            ASSERT(0 == FUtil::close(fd));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Write lines to a file through an 'ostream', and verify the
+        //:   content of the file.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        TempDirectoryGuard tempDirGuard;
+
+        bsl::string path(tempDirGuard.getTempDirName());
+        bdls::PathUtil::appendRaw(&path, "breathing");
+
+        FUtil::FileDescriptor fd = u::openReadWrite(path);
+        ASSERT(FUtil::k_INVALID_FD != fd);
+
+        Obj mX;  const Obj& X = mX;
+        ASSERT(!X.isOpened());
+        ASSERT(Obj::k_DEFAULT_WINDOW_SIZE == X.windowSize());
+
+        ASSERT(0 == mX.reset(fd, 0));
+        ASSERT(X.isOpened());
+
+        bsl::ostream       os(&mX);
+        bsl::ostringstream expected;
+        for (int i = 0; i < 1000; ++i) {
+            os       << "line " << i << endl;
+            expected << "line " << i << endl;
+        }
+        ASSERT(os.good());
+        ASSERT(static_cast<Int64>(expected.str().size()) == os.tellp());
+
+        ASSERT(0 == mX.clear());
+        ASSERT(!X.isOpened());
+        ASSERT(expected.str() == u::readFile(path));
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: FLUSHED LINES
+        //
+        // Concerns:
+        //: 1 Writing lines, each followed by a flush (as a log file observer
+        //:   does), through a 'MappedOutputStreamBuf' is faster than through a
+        //:   'bdls::FdStreamBuf'.
+        //
+        // Plan:
+        //: 1 Write a number of lines (optionally specified as the second
+        //:   argument), flushing after each, through an 'ostream' using each
+        //:   stream buffer, and report the times.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST: FLUSHED LINES
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE TEST: FLUSHED LINES" << endl
+             << "===============================" << endl;
+
+        TempDirectoryGuard tempDirGuard;
+
+        const int         NUM_LINES = argc > 2 ? bsl::atoi(argv[2]) : 200000;
+        const bsl::string LINE(120, 'x');
+
+        {
+            bsl::string path(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&path, "fd");
+
+            FUtil::FileDescriptor fd = FUtil::open(path,
+                                                   FUtil::e_CREATE,
+                                                   FUtil::e_READ_APPEND);
+            ASSERT(FUtil::k_INVALID_FD != fd);
+
+            bdls::FdStreamBuf streamBuf(fd, true, true, true);
+            bsl::ostream      os(&streamBuf);
+
+            bsls::Stopwatch timer;
+            timer.start();
+            for (int i = 0; i < NUM_LINES; ++i) {
+                os << LINE << '\n' << flush;
+            }
+            timer.stop();
+
+            cout << "FdStreamBuf:           " << timer.elapsedTime() << "s"
+                 << endl;
+        }
+        {
+            bsl::string path(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&path, "mapped");
+
+            FUtil::FileDescriptor fd = u::openReadWrite(path);
+            ASSERT(FUtil::k_INVALID_FD != fd);
+
+            Obj          streamBuf;
+            bsl::ostream os(&streamBuf);
+
+            bsls::Stopwatch timer;
+            timer.start();
+            ASSERT(0 == streamBuf.reset(fd, 0));
+            for (int i = 0; i < NUM_LINES; ++i) {
+                os << LINE << '\n' << flush;
+            }
+            ASSERT(0 == streamBuf.clear());
+            timer.stop();
+
+            cout << "MappedOutputStreamBuf: " << timer.elapsedTime() << "s"
+                 << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,224 @@
+// bdlt_cachingdatetimeformatter.cpp                                  -*-C++-*-
+#include <bdlt_cachingdatetimeformatter.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlt_cachingdatetimeformatter_cpp,"$Id$ $CSID$")
+
+#include <bdlt_datetime.h>
+#include <bdlt_datetimeinterval.h>
+#include <bdlt_datetimetz.h>
+#include <bdlt_timeunitratio.h>
+
+#include <bsl_cstring.h>
+
+///Implementation Notes
+///--------------------
+// The cache is keyed by the number of whole seconds between the (local)
+// datetime being formatted and 'Datetime()' (i.e., '0001-01-01T00:00:00', as
+// the subtraction of 'Datetime' objects treats 24:00 as 0:00), the offset,
+// and whether a zone designator is generated.  Both formats represent the
+// fractional second as a fixed number of digits at a fixed position (20 for
+// ISO 8601, following "YYYY-MM-DDThh:mm:ss" and the decimal sign, and 18 for
+// FIX, following "YYYYMMDD-hh:mm:ss."), so a cache hit only overwrites those
+// digits in a copy of the cached string.
+//
+// Note that the default 'Datetime' value, '0001-01-01T24:00:00', has the same
+// key as '0001-01-01T00:00:00', but the two values have different
+// representations.  Values during the first day are therefore never cached.
+
+namespace BloombergLP {
+namespace bdlt {
+
+namespace {
+namespace u {
+
+const int k_ISO8601_FRACTION_INDEX = sizeof "YYYY-MM-DDThh:mm:ss." - 1;
+const int k_FIX_FRACTION_INDEX     = sizeof "YYYYMMDD-hh:mm:ss."   - 1;
+
+const char k_DIGIT_PAIRS[] = "00010203040506070809"
+                             "10111213141516171819"
+                             "20212223242526272829"
+                             "30313233343536373839"
+                             "40414243444546474849"
+                             "50515253545556575859"
+                             "60616263646566676869"
+                             "70717273747576777879"
+                             "80818283848586878889"
+                             "90919293949596979899";
+
+void generateFraction(char *buffer, int microsecond, int precision)
+    // Write to the specified 'buffer' the first specified 'precision' digits
+    // of the specified 'microsecond', formatted as 6 digits.  The behavior is
+    // undefined unless '0 <= microsecond < 1000000' and
+    // '0 <= precision <= 6'.
+{
+    char digits[6];
+    bsl::memcpy(digits,     k_DIGIT_PAIRS + 2 * (microsecond / 10000),    2);
+    bsl::memcpy(digits + 2, k_DIGIT_PAIRS + 2 * (microsecond / 100 % 100), 2);
+    bsl::memcpy(digits + 4, k_DIGIT_PAIRS + 2 * (microsecond % 100),       2);
+    bsl::memcpy(buffer, digits, precision);
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+                      // ------------------------------
+                      // class CachingDatetimeFormatter
+                      // ------------------------------
+
+// PRIVATE MANIPULATORS
+int CachingDatetimeFormatter::generateImp(char            *buffer,
+                                          const Datetime&  localDatetime,
+                                          int              offset,
+                                          bool             hasOffset)
+{
+    const bsls::Types::Int64 totalMicroseconds =
+                      (localDatetime - Datetime()).totalMicroseconds();
+    const bsls::Types::Int64 second =
+                                totalMicroseconds / TimeUnitRatio::k_US_PER_S;
+    const int                microsecond = static_cast<int>(
+                                totalMicroseconds % TimeUnitRatio::k_US_PER_S);
+
+    if (second          == d_cachedSecond
+     && hasOffset       == d_cachedHasOffset
+     && (!hasOffset || offset == d_cachedOffset)) {
+        bsl::memcpy(buffer, d_cache, d_cachedLength);
+        u::generateFraction(buffer + d_fractionIndex,
+                            microsecond,
+                            d_precision);
+        return d_cachedLength;                                        // RETURN
+    }
+
+    int length;
+    if (e_ISO8601 == d_format) {
+        length = hasOffset
+               ? Iso8601Util::generateRaw(d_cache,
+                                          DatetimeTz(localDatetime, offset),
+                                          d_iso8601Configuration)
+               : Iso8601Util::generateRaw(d_cache,
+                                          localDatetime,
+                                          d_iso8601Configuration);
+    }
+    else {
+        length = hasOffset
+               ? FixUtil::generateRaw(d_cache,
+                                      DatetimeTz(localDatetime, offset),
+                                      d_fixConfiguration)
+               : FixUtil::generateRaw(d_cache,
+                                      localDatetime,
+                                      d_fixConfiguration);
+    }
+    bsl::memcpy(buffer, d_cache, length);
+
+    if (second < TimeUnitRatio::k_S_PER_D) {
+        d_cachedSecond = -1;
+    }
+    else {
+        d_cachedSecond    = second;
+        d_cachedOffset    = offset;
+        d_cachedHasOffset = hasOffset;
+        d_cachedLength    = length;
+    }
+    return length;
+}
+
+// CREATORS
+CachingDatetimeFormatter::CachingDatetimeFormatter()
+: d_format(e_ISO8601)
+, d_iso8601Configuration()
+, d_fixConfiguration()
+, d_cachedSecond(-1)
+, d_cachedOffset(0)
+, d_cachedHasOffset(false)
+, d_cachedLength(0)
+, d_fractionIndex(u::k_ISO8601_FRACTION_INDEX)
+, d_precision(d_iso8601Configuration.fractionalSecondPrecision())
+{
+}
+
+CachingDatetimeFormatter::CachingDatetimeFormatter(
+                                const Iso8601UtilConfiguration& configuration)
+: d_format(e_ISO8601)
+, d_iso8601Configuration(configuration)
+, d_fixConfiguration()
+, d_cachedSecond(-1)
+, d_cachedOffset(0)
+, d_cachedHasOffset(false)
+, d_cachedLength(0)
+, d_fractionIndex(u::k_ISO8601_FRACTION_INDEX)
+, d_precision(configuration.fractionalSecondPrecision())
+{
+}
+
+CachingDatetimeFormatter::CachingDatetimeFormatter(
+                                     const FixUtilConfiguration& configuration)
+: d_format(e_FIX)
+, d_iso8601Configuration()
+, d_fixConfiguration(configuration)
+, d_cachedSecond(-1)
+, d_cachedOffset(0)
+, d_cachedHasOffset(false)
+, d_cachedLength(0)
+, d_fractionIndex(u::k_FIX_FRACTION_INDEX)
+, d_precision(configuration.fractionalSecondPrecision())
+{
+}
+
+// MANIPULATORS
+int CachingDatetimeFormatter::generate(bsl::string     *string,
+                                       const Datetime&  object)
+{
+    BSLS_ASSERT(string);
+
+    char      buffer[k_MAX_STRLEN];
+    const int length = generateRaw(buffer, object);
+
+    string->assign(buffer, length);
+    return length;
+}
+
+int CachingDatetimeFormatter::generate(bsl::string       *string,
+                                       const DatetimeTz&  object)
+{
+    BSLS_ASSERT(string);
+
+    char      buffer[k_MAX_STRLEN];
+    const int length = generateRaw(buffer, object);
+
+    string->assign(buffer, length);
+    return length;
+}
+
+int CachingDatetimeFormatter::generateRaw(char *buffer, const Datetime& object)
+{
+    BSLS_ASSERT(buffer);
+
+    return generateImp(buffer, object, 0, false);
+}
+
+int CachingDatetimeFormatter::generateRaw(char              *buffer,
+                                          const DatetimeTz&  object)
+{
+    BSLS_ASSERT(buffer);
+
+    return generateImp(buffer, object.localDatetime(), object.offset(), true);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,680 @@
+// bdlt_cachingdatetimeformatter.t.cpp                                -*-C++-*-
+#include <bdlt_cachingdatetimeformatter.h>
+
+#include <bdlt_datetime.h>
+#include <bdlt_datetimetz.h>
+#include <bdlt_fixutil.h>
+#include <bdlt_fixutilconfiguration.h>
+#include <bdlt_iso8601util.h>
+#include <bdlt_iso8601utilconfiguration.h>
+
+#include <bslim_testutil.h>
+
+#include <bsls_asserttest.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                              TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a mechanism generating the same strings as the
+// 'generateRaw' functions of 'bdlt::Iso8601Util' and 'bdlt::FixUtil', using a
+// cache.  We verify, for every configuration, that sequences of values
+// exercising cache hits (values in the same second) and misses (values in
+// different seconds, with different offsets, or with and without an offset)
+// are formatted exactly as by the utility functions.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] CachingDatetimeFormatter();
+// [ 2] CachingDatetimeFormatter(const Iso8601UtilConfiguration&);
+// [ 3] CachingDatetimeFormatter(const FixUtilConfiguration&);
+//
+// MANIPULATORS
+// [ 4] int generate(bsl::string *, const Datetime&);
+// [ 4] int generate(bsl::string *, const DatetimeTz&);
+// [ 2] int generateRaw(char *, const Datetime&);
+// [ 2] int generateRaw(char *, const DatetimeTz&);
+// [ 4] void reset();
+//
+// ACCESSORS
+// [ 3] const FixUtilConfiguration& fixConfiguration() const;
+// [ 2] Format format() const;
+// [ 2] const Iso8601UtilConfiguration& iso8601Configuration() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                     NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlt::CachingDatetimeFormatter Obj;
+typedef bdlt::Iso8601UtilConfiguration IsoConfig;
+typedef bdlt::FixUtilConfiguration     FixConfig;
+
+const struct {
+    int d_line;
+    int d_year;
+    int d_month;
+    int d_day;
+    int d_hour;
+    int d_minute;
+    int d_second;
+    int d_millisecond;
+    int d_microsecond;
+} DATA[] = {
+    //LINE  YEAR  MON  DAY  HR  MIN  SEC   MS   US
+    //----  ----  ---  ---  --  ---  ---  ---  ---
+    { L_,      1,   1,   1, 24,   0,   0,   0,   0 },
+    { L_,      1,   1,   1,  0,   0,   0,   0,   0 },
+    { L_,      1,   1,   1, 23,  59,  59, 999, 999 },
+    { L_,      1,   1,   2,  0,   0,   0,   0,   0 },
+    { L_,      1,   1,   2,  0,   0,   0,   0,   1 },
+    { L_,      1,   1,   3,  0,   0,   0,   0,   0 },
+    { L_,      1,   1,   3,  0,   0,   0, 500,   0 },
+    { L_,   1999,  12,  31, 23,  59,  59, 999, 999 },
+    { L_,   2000,   1,   1,  0,   0,   0,   0,   0 },
+    { L_,   2000,   1,   1,  0,   0,   0,   0,   7 },
+    { L_,   2000,   1,   1,  0,   0,   0,  10,   0 },
+    { L_,   2000,   1,   1,  0,   0,   0, 999, 999 },
+    { L_,   2000,   1,   1,  0,   0,   1,   0,   0 },
+    { L_,   2026,  10,  19,  8,  59,  59, 123, 456 },
+    { L_,   2026,  10,  19,  8,  59,  59, 123, 457 },
+    { L_,   2026,  10,  19,  8,  59,  59, 124,   0 },
+    { L_,   2026,  10,  19,  8,  59,  58, 124,   0 },
+    { L_,   9999,  12,  31, 23,  59,  59, 999, 998 },
+    { L_,   9999,  12,  31, 23,  59,  59, 999, 999 },
+};
+const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+const int OFFSETS[] = { 0, 0, 90, -90, -1439, 1439, 0 };
+const int NUM_OFFSETS = static_cast<int>(sizeof OFFSETS / sizeof *OFFSETS);
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static bdlt::Datetime makeDatetime(int index)
+    // Return the datetime described by the element at the specified 'index'
+    // of 'DATA'.
+{
+    return bdlt::Datetime(DATA[index].d_year,
+                          DATA[index].d_month,
+                          DATA[index].d_day,
+                          DATA[index].d_hour,
+                          DATA[index].d_minute,
+                          DATA[index].d_second,
+                          DATA[index].d_millisecond,
+                          DATA[index].d_microsecond);
+}
+
+static bsl::string expectedIso(const bdlt::Datetime& value,
+                               const IsoConfig&      config)
+    // Return the string generated by 'bdlt::Iso8601Util' for the specified
+    // 'value' with the specified 'config'.
+{
+    char buffer[Obj::k_MAX_STRLEN];
+    return bsl::string(buffer,
+                       bdlt::Iso8601Util::generateRaw(buffer, value, config));
+}
+
+static bsl::string expectedIso(const bdlt::DatetimeTz& value,
+                               const IsoConfig&        config)
+    // Return the string generated by 'bdlt::Iso8601Util' for the specified
+    // 'value' with the specified 'config'.
+{
+    char buffer[Obj::k_MAX_STRLEN];
+    return bsl::string(buffer,
+                       bdlt::Iso8601Util::generateRaw(buffer, value, config));
+}
+
+static bsl::string expectedFix(const bdlt::Datetime& value,
+                               const FixConfig&      config)
+    // Return the string generated by 'bdlt::FixUtil' for the specified
+    // 'value' with the specified 'config'.
+{
+    char buffer[Obj::k_MAX_STRLEN];
+    return bsl::string(buffer,
+                       bdlt::FixUtil::generateRaw(buffer, value, config));
+}
+
+static bsl::string expectedFix(const bdlt::DatetimeTz& value,
+                               const FixConfig&        config)
+    // Return the string generated by 'bdlt::FixUtil' for the specified
+    // 'value' with the specified 'config'.
+{
+    char buffer[Obj::k_MAX_STRLEN];
+    return bsl::string(buffer,
+                       bdlt::FixUtil::generateRaw(buffer, value, config));
+}
+
+template <class VALUE>
+static bsl::string actual(Obj *formatter, const VALUE& value)
+    // Return the string generated by the specified 'formatter' for the
+    // specified 'value'.
+{
+    char buffer[Obj::k_MAX_STRLEN];
+    return bsl::string(buffer, formatter->generateRaw(buffer, value));
+}
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Formatting a Sequence of Timestamps
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we are writing the timestamps of a sequence of events, which
+// are usually a few microseconds apart, in ISO 8601 format with microsecond
+// precision.
+//
+// First, we create a formatter with the desired configuration:
+//..
+    bdlt::Iso8601UtilConfiguration configuration;
+    configuration.setFractionalSecondPrecision(6);
+
+    bdlt::CachingDatetimeFormatter formatter(configuration);
+//..
+// Then, we format the timestamp of a first event.  The whole string is
+// generated, and the cache of 'formatter' is loaded:
+//..
+    char buffer[bdlt::CachingDatetimeFormatter::k_MAX_STRLEN + 1];
+
+    bdlt::Datetime timestamp(2026, 10, 19, 23, 59, 59, 123, 456);
+
+    int length = formatter.generateRaw(buffer, timestamp);
+    buffer[length] = '\0';
+
+    ASSERT(0 == bsl::strcmp("2026-10-19T23:59:59.123456", buffer));
+//..
+// Next, we format the timestamp of a second event, which occurs during the
+// same second.  Only the fractional second is generated:
+//..
+    timestamp.addMicroseconds(12);
+
+    length = formatter.generateRaw(buffer, timestamp);
+    buffer[length] = '\0';
+
+    ASSERT(0 == bsl::strcmp("2026-10-19T23:59:59.123468", buffer));
+//..
+// Finally, we format the timestamp of a third event, occurring during the
+// following second (and day), and observe that the result is the same as the
+// one generated by 'bdlt::Iso8601Util':
+//..
+    timestamp.addMilliseconds(900);
+
+    length = formatter.generateRaw(buffer, timestamp);
+    buffer[length] = '\0';
+
+    ASSERT(0 == bsl::strcmp("2026-10-20T00:00:00.023468", buffer));
+
+    char expected[bdlt::Iso8601Util::k_DATETIME_STRLEN + 1];
+    bdlt::Iso8601Util::generate(expected,
+                                sizeof expected,
+                                timestamp,
+                                configuration);
+
+    ASSERT(0 == bsl::strcmp(expected, buffer));
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'generate' AND 'reset'
+        //
+        // Concerns:
+        //: 1 'generate' loads the string generated by 'generateRaw' and
+        //:   returns its length.
+        //:
+        //: 2 'reset' does not affect the generated strings.
+        //:
+        //: 3 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For a sequence of values, compare the output of 'generate' with
+        //:   the expected string, calling 'reset' between some of the calls.
+        //:   (C-1..2)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for a null 'string'.  (C-3)
+        //
+        // Testing:
+        //   int generate(bsl::string *, const Datetime&);
+        //   int generate(bsl::string *, const DatetimeTz&);
+        //   void reset();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'generate' AND 'reset'" << endl
+                          << "======================" << endl;
+
+        IsoConfig config;
+        config.setFractionalSecondPrecision(6);
+
+        Obj         mX(config);
+        bsl::string result("garbage");
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int                  LINE = DATA[ti].d_line;
+            const bdlt::Datetime       X    = makeDatetime(ti);
+            const bdlt::DatetimeTz     XTZ(X, 24 == X.hour() ? 0 : 60);
+
+            if (veryVerbose) { T_ P_(LINE) P(X) }
+
+            int length = mX.generate(&result, X);
+            ASSERTV(LINE, expectedIso(X, config) == result);
+            ASSERTV(LINE, static_cast<int>(result.size()) == length);
+
+            if (ti % 2) {
+                mX.reset();
+            }
+
+            length = mX.generate(&result, XTZ);
+            ASSERTV(LINE, expectedIso(XTZ, config) == result);
+            ASSERTV(LINE, static_cast<int>(result.size()) == length);
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const bdlt::Datetime   X;
+            const bdlt::DatetimeTz XTZ;
+
+            ASSERT_PASS(mX.generate(&result, X));
+            ASSERT_FAIL(mX.generate(0,       X));
+            ASSERT_PASS(mX.generate(&result, XTZ));
+            ASSERT_FAIL(mX.generate(0,       XTZ));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // FIX FORMAT
+        //
+        // Concerns:
+        //: 1 A formatter created with a 'FixUtilConfiguration' generates the
+        //:   strings generated by 'FixUtil::generateRaw' with that
+        //:   configuration, including when its cache is hit.
+        //:
+        //: 2 'fixConfiguration' returns the configuration of the formatter.
+        //
+        // Plan:
+        //: 1 For each precision and each setting of 'useZAbbreviationForUtc',
+        //:   and for each of a sequence of offsets, format each value of
+        //:   'DATA' (which includes consecutive values in the same second) as
+        //:   a 'Datetime' and as a 'DatetimeTz', twice each, and compare with
+        //:   the output of 'FixUtil'.  (C-1..2)
+        //
+        // Testing:
+        //   CachingDatetimeFormatter(const FixUtilConfiguration&);
+        //   const FixUtilConfiguration& fixConfiguration() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "FIX FORMAT" << endl
+                          << "==========" << endl;
+
+        for (int precision = 0; precision <= 6; ++precision) {
+        for (int useZ = 0; useZ < 2; ++useZ) {
+            FixConfig config;
+            config.setFractionalSecondPrecision(precision);
+            config.setUseZAbbreviationForUtc(useZ);
+
+            if (veryVerbose) { T_ P(config) }
+
+            Obj mX(config);  const Obj& X = mX;
+
+            ASSERT(Obj::e_FIX == X.format());
+            ASSERT(config     == X.fixConfiguration());
+
+            for (int oi = 0; oi < NUM_OFFSETS; ++oi) {
+                const int OFFSET = OFFSETS[oi];
+
+                for (int ti = 0; ti < NUM_DATA; ++ti) {
+                    const int              LINE = DATA[ti].d_line;
+                    const bdlt::Datetime   V    = makeDatetime(ti);
+                    const bdlt::DatetimeTz VTZ(V, 24 == V.hour() ? 0 : OFFSET);
+
+                    const bsl::string EXP   = expectedFix(V,   config);
+                    const bsl::string EXPTZ = expectedFix(VTZ, config);
+
+                    ASSERTV(LINE, precision, EXP, EXP == actual(&mX, V));
+                    ASSERTV(LINE, precision, EXP, EXP == actual(&mX, V));
+                    ASSERTV(LINE, precision, OFFSET, EXPTZ,
+                            EXPTZ == actual(&mX, VTZ));
+                    ASSERTV(LINE, precision, OFFSET, EXPTZ,
+                            EXPTZ == actual(&mX, VTZ));
+                    ASSERTV(LINE, precision, EXP, EXP == actual(&mX, V));
+                }
+            }
+        }
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // ISO 8601 FORMAT
+        //
+        // Concerns:
+        //: 1 A default-constructed formatter generates the strings generated
+        //:   by 'Iso8601Util::generateRaw' with the default configuration.
+        //:
+        //: 2 A formatter created with an 'Iso8601UtilConfiguration' generates
+        //:   the strings generated by 'Iso8601Util::generateRaw' with that
+        //:   configuration, including when its cache is hit, for every
+        //:   configuration.
+        //:
+        //: 3 Values in the same second but having different offsets, or with
+        //:   and without an offset, are not confused.
+        //:
+        //: 4 The default 'Datetime' value (24:00) and the following day are
+        //:   not confused.
+        //:
+        //: 5 'format' and 'iso8601Configuration' return the format and
+        //:   configuration of the formatter.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For each configuration, and for each of a sequence of offsets
+        //:   (including repeated ones), format each value of 'DATA' (which
+        //:   includes the default value, the following day, and consecutive
+        //:   values in the same second) as a 'Datetime' and as a
+        //:   'DatetimeTz', twice each, and compare with the output of
+        //:   'Iso8601Util'.  (C-1..5)
+        //:
+        //: 2 Format each microsecond of a second, in a random order, and
+        //:   compare with the output of 'Iso8601Util'.  (C-2)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for a null 'buffer'.  (C-6)
+        //
+        // Testing:
+        //   CachingDatetimeFormatter();
+        //   CachingDatetimeFormatter(const Iso8601UtilConfiguration&);
+        //   int generateRaw(char *, const Datetime&);
+        //   int generateRaw(char *, const DatetimeTz&);
+        //   Format format() const;
+        //   const Iso8601UtilConfiguration& iso8601Configuration() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ISO 8601 FORMAT" << endl
+                          << "===============" << endl;
+
+        if (verbose) cout << "\nDefault configuration." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(Obj::e_ISO8601 == X.format());
+            ASSERT(IsoConfig()    == X.iso8601Configuration());
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int            LINE = DATA[ti].d_line;
+                const bdlt::Datetime V    = makeDatetime(ti);
+
+                ASSERTV(LINE, expectedIso(V, IsoConfig()) == actual(&mX, V));
+            }
+        }
+
+        if (verbose) cout << "\nAll configurations." << endl;
+
+        for (int precision = 0; precision <= 6; ++precision) {
+        for (int flags = 0; flags < 8; ++flags) {
+            IsoConfig config;
+            config.setFractionalSecondPrecision(precision);
+            config.setOmitColonInZoneDesignator(flags & 1);
+            config.setUseCommaForDecimalSign(flags & 2);
+            config.setUseZAbbreviationForUtc(flags & 4);
+
+            if (veryVerbose) { T_ P(config) }
+
+            Obj mX(config);  const Obj& X = mX;
+
+            ASSERT(Obj::e_ISO8601 == X.format());
+            ASSERT(config         == X.iso8601Configuration());
+
+            for (int oi = 0; oi < NUM_OFFSETS; ++oi) {
+                const int OFFSET = OFFSETS[oi];
+
+                for (int ti = 0; ti < NUM_DATA; ++ti) {
+                    const int              LINE = DATA[ti].d_line;
+                    const bdlt::Datetime   V    = makeDatetime(ti);
+                    const bdlt::DatetimeTz VTZ(V, 24 == V.hour() ? 0 : OFFSET);
+
+                    const bsl::string EXP   = expectedIso(V,   config);
+                    const bsl::string EXPTZ = expectedIso(VTZ, config);
+
+                    ASSERTV(LINE, precision, EXP, EXP == actual(&mX, V));
+                    ASSERTV(LINE, precision, EXP, EXP == actual(&mX, V));
+                    ASSERTV(LINE, precision, OFFSET, EXPTZ,
+                            EXPTZ == actual(&mX, VTZ));
+                    ASSERTV(LINE, precision, OFFSET, EXPTZ,
+                            EXPTZ == actual(&mX, VTZ));
+                    ASSERTV(LINE, precision, EXP, EXP == actual(&mX, V));
+                }
+            }
+        }
+        }
+
+        if (verbose) cout << "\nEvery microsecond of a second." << endl;
+        {
+            IsoConfig config;
+            config.setFractionalSecondPrecision(6);
+
+            Obj mX(config);
+
+            const bdlt::Datetime BASE(2026, 10, 19, 8, 59, 59);
+
+            unsigned int microsecond = 0;
+            for (int i = 0; i < 1000000; ++i) {
+                // 'microsecond' takes each value in '[0 .. 1000000)' once.
+
+                microsecond = (microsecond + 7919) % 1000000;
+
+                bdlt::Datetime value(BASE);
+                value.addMicroseconds(microsecond);
+
+                char buffer[Obj::k_MAX_STRLEN];
+                char expected[Obj::k_MAX_STRLEN];
+
+                const int length = mX.generateRaw(buffer, value);
+                ASSERTV(microsecond,
+                        length == bdlt::Iso8601Util::generateRaw(expected,
+                                                                 value,
+                                                                 config));
+                ASSERTV(microsecond,
+                        0 == bsl::memcmp(buffer, expected, length));
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX;
+
+            char                   buffer[Obj::k_MAX_STRLEN];
+            const bdlt::Datetime   X;
+            const bdlt::DatetimeTz XTZ;
+
+            ASSERT_PASS(mX.generateRaw(buffer, X));
+            ASSERT_FAIL(mX.generateRaw(0,      X));
+            ASSERT_PASS(mX.generateRaw(buffer, XTZ));
+            ASSERT_FAIL(mX.generateRaw(0,      XTZ));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Format a few values in the same and in different seconds, in both
+        //:   formats, and verify the strings.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        IsoConfig isoConfig;
+        isoConfig.setFractionalSecondPrecision(3);
+
+        Obj mX(isoConfig);
+
+        bdlt::Datetime value(2005, 1, 31, 8, 59, 59, 123);
+
+        ASSERT("2005-01-31T08:59:59.123" == actual(&mX, value));
+
+        value.addMilliseconds(500);
+        ASSERT("2005-01-31T08:59:59.623" == actual(&mX, value));
+
+        value.addMilliseconds(500);
+        ASSERT("2005-01-31T09:00:00.123" == actual(&mX, value));
+
+        ASSERT("2005-01-31T09:00:00.123-04:00" ==
+                               actual(&mX, bdlt::DatetimeTz(value, -240)));
+
+        FixConfig fixConfig;
+        fixConfig.setFractionalSecondPrecision(6);
+
+        Obj mY(fixConfig);
+
+        ASSERT("20050131-09:00:00.123000" == actual(&mY, value));
+
+        value.addMicroseconds(1);
+        ASSERT("20050131-09:00:00.123001" == actual(&mY, value));
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -12,6 +12,10 @@ BSLS_IDENT_RCSID(bdlt_iso8601util_cpp,"$Id$ $CSID$")
 #include <bdlt_time.h>
 #include <bdlt_timetz.h>
 
+#include <bsls_byteorderutil.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
 #include <bsl_algorithm.h>
 #include <bsl_cctype.h>
 #include <bsl_cstring.h>
@@ -323,6 +327,150 @@ int parseTime(const char         **nextPos,
     return 0;
 }
 
+static inline
+int byteAt(bsls::Types::Uint64 word, int index)
+    // Return the value of the byte at the specified 'index' of the specified
+    // 'word', bytes being numbered from the least significant one.  The
+    // behavior is undefined unless '0 <= index < 8'.
+{
+    return static_cast<int>((word >> (8 * index)) & 0xFF);
+}
+
+static
+int parseDatetimeFixedLayout(Datetime   *result,
+                             const char *string,
+                             int         length)
+    // Load into the specified 'result' the datetime represented by the
+    // specified initial 'length' characters of the specified 'string' if
+    // those characters have the "YYYY-MM-DDThh:mm:ss[.s{1,6}][Z]" layout
+    // (accepting 't' and 'z' in lieu of 'T' and 'Z', and ',' in lieu of '.')
+    // and represent a valid datetime having an hour less than 24 and no leap
+    // second.  Return 0 on success, and a non-zero value (with no effect)
+    // otherwise.  Note that 'parse' accepts all the strings accepted by this
+    // function, and loads the same values for them; this function checks the
+    // whole layout in a few word-wide operations, and is intended to be tried
+    // before the general parser.
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(string);
+
+    enum {
+        k_FRACTION_INDEX = sizeof "YYYY-MM-DDThh:mm:ss" - 1,
+        k_MAX_LENGTH     = sizeof "YYYY-MM-DDThh:mm:ss.ffffffZ" - 1,
+        k_NUM_WORDS      = 4
+    };
+
+    if (length < k_FRACTION_INDEX || length > k_MAX_LENGTH) {
+        return -1;                                                    // RETURN
+    }
+
+    const char *end = string + length;
+    if ('Z' == end[-1] || 'z' == end[-1]) {
+        --end;
+    }
+
+    // 'fractionLength' counts the decimal sign.
+
+    const int fractionLength =
+                       static_cast<int>(end - string) - k_FRACTION_INDEX;
+    if (fractionLength < 0 || 1 == fractionLength || fractionLength > 7) {
+        return -1;                                                    // RETURN
+    }
+
+    // Copy the string in the canonical "YYYY-MM-DDThh:mm:ss.ffffff" layout,
+    // padding the fractional second with '0' digits to microseconds, followed
+    // by 0 bytes.
+
+    char buffer[k_NUM_WORDS * 8];
+    bsl::memcpy(buffer, string, k_FRACTION_INDEX);
+    buffer[k_FRACTION_INDEX] = '.';
+    bsl::memset(buffer + k_FRACTION_INDEX + 1, '0', 6);
+    bsl::memset(buffer + k_FRACTION_INDEX + 7,
+                0,
+                sizeof buffer - k_FRACTION_INDEX - 7);
+    if (fractionLength) {
+        const char sign = string[k_FRACTION_INDEX];
+        if ('.' != sign && ',' != sign) {
+            return -1;                                                // RETURN
+        }
+        bsl::memcpy(buffer + k_FRACTION_INDEX + 1,
+                    string + k_FRACTION_INDEX + 1,
+                    fractionLength - 1);
+    }
+    if ('t' == buffer[10]) {
+        buffer[10] = 'T';
+    }
+
+    // Each word 'w' of the canonical string is valid if, for each byte,
+    // '(w & MASK) == EXPECTED' (digits are in '[0x30 .. 0x3F]', and the other
+    // characters are as expected), and '((w + ADDEND) & MASK) == EXPECTED'
+    // (digits are not in '[0x3A .. 0x3F]').  Bytes are numbered from the least
+    // significant one.
+
+    static const bsls::Types::Uint64 k_MASK[k_NUM_WORDS] = {
+        0xFFF0F0FFF0F0F0F0ULL,  // "YYYY-MM-"
+        0xF0F0FFF0F0FFF0F0ULL,  // "DDThh:mm"
+        0xF0F0F0F0FFF0F0FFULL,  // ":ss.ffff"
+        0xFFFFFFFFFFFFF0F0ULL   // "ff"
+    };
+    static const bsls::Types::Uint64 k_EXPECTED[k_NUM_WORDS] = {
+        0x2D30302D30303030ULL,
+        0x30303A3030543030ULL,
+        0x303030302E30303AULL,
+        0x0000000000003030ULL
+    };
+    static const bsls::Types::Uint64 k_ADDEND[k_NUM_WORDS] = {
+        0x0006060006060606ULL,
+        0x0606000606000606ULL,
+        0x0606060600060600ULL,
+        0x0000000000000606ULL
+    };
+
+    bsls::Types::Uint64 pairs[k_NUM_WORDS];
+    bsls::Types::Uint64 mismatch = 0;
+
+    for (int i = 0; i < k_NUM_WORDS; ++i) {
+        bsls::Types::Uint64 word;
+        bsl::memcpy(&word, buffer + 8 * i, 8);
+#ifdef BSLS_PLATFORM_IS_BIG_ENDIAN
+        word = bsls::ByteOrderUtil::swapBytes(word);
+#endif
+        mismatch |= (word & k_MASK[i]) ^ k_EXPECTED[i];
+        mismatch |= ((word + k_ADDEND[i]) & k_MASK[i]) ^ k_EXPECTED[i];
+
+        // Byte 'j' of 'pairs[i]' is the value of the two digits at bytes 'j'
+        // and 'j + 1' of 'word' (if both are digits).
+
+        const bsls::Types::Uint64 digits = word & ~k_MASK[i];
+        pairs[i] = digits * 10 + (digits >> 8);
+    }
+
+    if (mismatch) {
+        return -1;                                                    // RETURN
+    }
+
+    const int hour   = byteAt(pairs[1], 3);
+    const int second = byteAt(pairs[2], 1);
+
+    if (hour > 23 || second > 59) {
+        return -1;                                                    // RETURN
+    }
+
+    const int year        = byteAt(pairs[0], 0) * 100 + byteAt(pairs[0], 2);
+    const int microsecond = byteAt(pairs[2], 4) * 10000
+                          + byteAt(pairs[2], 6) * 100
+                          + byteAt(pairs[3], 0);
+
+    return result->setDatetimeIfValid(year,
+                                      byteAt(pairs[0], 5),
+                                      byteAt(pairs[1], 0),
+                                      hour,
+                                      byteAt(pairs[1], 6),
+                                      second,
+                                      microsecond / 1000,
+                                      microsecond % 1000);
+}
+
 static
 int parseZoneDesignator(const char **nextPos,
                         int         *minuteOffset,
@@ -1549,6 +1697,12 @@ int Iso8601Util::parse(Datetime *result, const char *string, int length)
     //
     // The fractional second and zone designator are independently optional.
 
+    // 0. Try the common fixed layout, having no offset.
+
+    if (0 == parseDatetimeFixedLayout(result, string, length)) {
+        return 0;                                                     // RETURN
+    }
+
     // 1. Parse as a 'DatetimeTz'.
 
     DatetimeTz datetimeTz;
@@ -1719,6 +1873,15 @@ int Iso8601Util::parse(DatetimeTz *result, const char *string, int length)
     //
     // The fractional second and zone designator are independently optional.
 
+    // 0. Try the common fixed layout, having no offset.
+
+    Datetime datetime;
+
+    if (0 == parseDatetimeFixedLayout(&datetime, string, length)) {
+        result->setDatetimeTz(datetime, 0);
+        return 0;                                                     // RETURN
+    }
+
     enum { k_MINIMUM_LENGTH = sizeof "YYYY-MM-DDThh:mm:ss" - 1 };
 
     if (length < k_MINIMUM_LENGTH) {
@@ -134,7 +134,8 @@ using namespace bsl;
 // [ 7] int generateRaw(char *, const DatetimeTz&, bool useZ);
 #endif // BDE_OMIT_INTERNAL_DEPRECATED
 //-----------------------------------------------------------------------------
-// [12] USAGE EXAMPLE
+// [12] PARSE: FIXED-LAYOUT DATETIMES
+// [13] USAGE EXAMPLE
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -794,7 +795,7 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 12: {
+      case 13: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -991,6 +992,201 @@ if (veryVerbose)
 //..
 
       } break;
+      case 12: {
+        // --------------------------------------------------------------------
+        // PARSE: FIXED-LAYOUT DATETIMES
+        //
+        // Concerns:
+        //: 1 Strings having the "YYYY-MM-DDThh:mm:ss[.s{1,6}][Z]" layout,
+        //:   which are parsed without the general parser when valid, are
+        //:   parsed into the expected 'Datetime' and 'DatetimeTz' values.
+        //:
+        //: 2 Strings that differ from such a layout in a single character,
+        //:   including invalid strings and valid strings parsed by the general
+        //:   parser (e.g., having an hour of 24 or a leap second), are parsed
+        //:   as if their zone designator, if any, were "+00:00".
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, parse strings of every length
+        //:   having the fixed layout, and verify the results.  (C-1)
+        //:
+        //: 2 For each string of P-1, and for each string obtained by
+        //:   replacing one of its characters with one of a set of characters
+        //:   (digits, separators, letters, and characters adjacent to digits),
+        //:   verify that parsing into a 'Datetime' and a 'DatetimeTz' has the
+        //:   same outcome as parsing the same string with a "+00:00" zone
+        //:   designator instead of "Z" (or no zone designator), which does not
+        //:   have the fixed layout.  (C-2)
+        //
+        // Testing:
+        //   PARSE: FIXED-LAYOUT DATETIMES
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PARSE: FIXED-LAYOUT DATETIMES" << endl
+                          << "=============================" << endl;
+
+        static const struct {
+            int         d_line;
+            const char *d_input;
+            int         d_year;
+            int         d_month;
+            int         d_day;
+            int         d_hour;
+            int         d_min;
+            int         d_sec;
+            int         d_msec;
+            int         d_usec;
+        } DATA[] = {
+            //LINE  INPUT
+            //----  -----
+            //      YEAR  MON  DAY  HR  MIN  SEC  MSEC  USEC
+            //      ----  ---  ---  --  ---  ---  ----  ----
+            { L_,   "0001-01-01T00:00:00",
+                       1,   1,   1,  0,   0,   0,    0,    0 },
+            { L_,   "9999-12-31T23:59:59.999999",
+                    9999,  12,  31, 23,  59,  59,  999,  999 },
+            { L_,   "2005-01-31T08:59:59Z",
+                    2005,   1,  31,  8,  59,  59,    0,    0 },
+            { L_,   "2005-01-31t08:59:59z",
+                    2005,   1,  31,  8,  59,  59,    0,    0 },
+            { L_,   "2005-01-31T08:59:59.1",
+                    2005,   1,  31,  8,  59,  59,  100,    0 },
+            { L_,   "2005-01-31T08:59:59,12",
+                    2005,   1,  31,  8,  59,  59,  120,    0 },
+            { L_,   "2005-01-31T08:59:59.123Z",
+                    2005,   1,  31,  8,  59,  59,  123,    0 },
+            { L_,   "2005-01-31T08:59:59.1234",
+                    2005,   1,  31,  8,  59,  59,  123,  400 },
+            { L_,   "2005-01-31T08:59:59.12345z",
+                    2005,   1,  31,  8,  59,  59,  123,  450 },
+            { L_,   "2005-01-31T08:59:59.123456Z",
+                    2005,   1,  31,  8,  59,  59,  123,  456 },
+            { L_,   "2000-02-29T12:34:56.000001",
+                    2000,   2,  29, 12,  34,  56,    0,    1 },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        const char REPLACEMENTS[] = "0159/:;-.,TtZz+ A\x7f";
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int          LINE   = DATA[ti].d_line;
+            const bsl::string  INPUT  = DATA[ti].d_input;
+
+            const bdlt::Datetime   EXPECTED(DATA[ti].d_year,
+                                            DATA[ti].d_month,
+                                            DATA[ti].d_day,
+                                            DATA[ti].d_hour,
+                                            DATA[ti].d_min,
+                                            DATA[ti].d_sec,
+                                            DATA[ti].d_msec,
+                                            DATA[ti].d_usec);
+            const bdlt::DatetimeTz EXPECTED_TZ(EXPECTED, 0);
+
+            if (veryVerbose) { T_ P_(LINE) P(INPUT) }
+
+            bdlt::Datetime   mX;  const bdlt::Datetime&   X  = mX;
+            bdlt::DatetimeTz mZ;  const bdlt::DatetimeTz& Z  = mZ;
+
+            ASSERTV(LINE, 0 == Util::parse(&mX, INPUT.data(),
+                                           static_cast<int>(INPUT.size())));
+            ASSERTV(LINE, EXPECTED, X, EXPECTED == X);
+
+            ASSERTV(LINE, 0 == Util::parse(&mZ, INPUT.data(),
+                                           static_cast<int>(INPUT.size())));
+            ASSERTV(LINE, EXPECTED_TZ, Z, EXPECTED_TZ == Z);
+
+            for (bsl::size_t i = 0; i < INPUT.size(); ++i) {
+            for (bsl::size_t ri = 0; ri < sizeof REPLACEMENTS - 1; ++ri) {
+                const char REPLACEMENT = REPLACEMENTS[ri];
+
+                if (19 <= i && ('+' == REPLACEMENT || '-' == REPLACEMENT)) {
+                    // The string would have a zone designator other than "Z".
+
+                    continue;
+                }
+
+                bsl::string input(INPUT);
+                input[i] = REPLACEMENT;
+
+                bsl::string ref(input);
+                const char  last = ref[ref.size() - 1];
+                if ('Z' == last || 'z' == last) {
+                    ref.resize(ref.size() - 1);
+                }
+                ref += "+00:00";
+
+                const int LENGTH     = static_cast<int>(input.size());
+                const int REF_LENGTH = static_cast<int>(ref.size());
+
+                bdlt::Datetime   mA, mB;
+                bdlt::DatetimeTz mC, mD;
+
+                const int RC_A = Util::parse(&mA, input.data(), LENGTH);
+                const int RC_B = Util::parse(&mB, ref.data(), REF_LENGTH);
+                const int RC_C = Util::parse(&mC, input.data(), LENGTH);
+                const int RC_D = Util::parse(&mD, ref.data(), REF_LENGTH);
+
+                ASSERTV(LINE, input, RC_A, RC_B, (0 == RC_A) == (0 == RC_B));
+                ASSERTV(LINE, input, mA, mB, mA == mB);
+                ASSERTV(LINE, input, RC_C, RC_D, (0 == RC_C) == (0 == RC_D));
+                ASSERTV(LINE, input, mC, mD, mC == mD);
+            }
+            }
+        }
+
+        if (verbose) cout << "\nSpecial values." << endl;
+        {
+            static const char *INPUTS[] = {
+                "2005-01-31T24:00:00",
+                "0001-01-01T24:00:00",
+                "0001-01-01T24:00:00.000000Z",
+                "2005-12-31T23:59:60",
+                "2005-12-31T23:59:60.5Z",
+                "2005-02-29T00:00:00",
+                "2005-13-01T00:00:00",
+                "2005-00-01T00:00:00",
+                "2005-01-00T00:00:00",
+                "0000-01-01T00:00:00",
+                "2005-01-31T08:60:00",
+                "2005-01-31T08:59:59.1234567",
+                "2005-01-31T08:59:59.9999999Z",
+                "2005-01-31T08:59:59.Z",
+                "2005-01-31T08:59:59ZZ",
+            };
+            const int NUM_INPUTS = static_cast<int>(sizeof  INPUTS
+                                                  / sizeof *INPUTS);
+
+            for (int ti = 0; ti < NUM_INPUTS; ++ti) {
+                const bsl::string input(INPUTS[ti]);
+
+                bsl::string ref(input);
+                const char  last = ref[ref.size() - 1];
+                if ('Z' == last || 'z' == last) {
+                    ref.resize(ref.size() - 1);
+                }
+                ref += "+00:00";
+
+                const int LENGTH     = static_cast<int>(input.size());
+                const int REF_LENGTH = static_cast<int>(ref.size());
+
+                bdlt::Datetime   mA, mB;
+                bdlt::DatetimeTz mC, mD;
+
+                const int RC_A = Util::parse(&mA, input.data(), LENGTH);
+                const int RC_B = Util::parse(&mB, ref.data(), REF_LENGTH);
+                const int RC_C = Util::parse(&mC, input.data(), LENGTH);
+                const int RC_D = Util::parse(&mD, ref.data(), REF_LENGTH);
+
+                if (veryVerbose) { T_ P_(input) P_(RC_A) P(RC_C) }
+
+                ASSERTV(input, RC_A, RC_B, (0 == RC_A) == (0 == RC_B));
+                ASSERTV(input, mA, mB, mA == mB);
+                ASSERTV(input, RC_C, RC_D, (0 == RC_C) == (0 == RC_D));
+                ASSERTV(input, mC, mD, mC == mD);
+            }
+        }
+      } break;
       case 11: {
         // --------------------------------------------------------------------
         // PARSE: DATETIME & DATETIMETZ
@@ -0,0 +1,401 @@
+// bslh_aeshashalgorithm.cpp                                          -*-C++-*-
+#include <bslh_aeshashalgorithm.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#include <bsls_assert.h>
+#include <bsls_atomicoperations.h>
+#include <bsls_platform.h>
+
+#include <string.h>  // for 'memcpy'
+
+#if defined(BSLS_PLATFORM_CPU_X86_64)                                         \
+ && (defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG))
+# define BSLH_AESHASHALGORITHM_AESNI 1
+# define BSLH_AESHASHALGORITHM_TARGET_AES __attribute__((target("aes,sse2")))
+# include <cpuid.h>
+# include <wmmintrin.h>
+#elif defined(BSLS_PLATFORM_CPU_X86_64) && defined(BSLS_PLATFORM_CMP_MSVC)
+# define BSLH_AESHASHALGORITHM_AESNI 1
+# define BSLH_AESHASHALGORITHM_TARGET_AES
+# include <intrin.h>
+# include <wmmintrin.h>
+#else
+# define BSLH_AESHASHALGORITHM_TARGET_AES
+#endif
+
+///Implementation Notes
+///--------------------
+// The algorithm is specified in terms of the 'AESENC' instruction, which
+// performs one (non-final) round of the AES cipher on a 128-bit 'state' with
+// a 128-bit 'roundKey':
+//..
+//  AESENC(state, roundKey) =
+//               MixColumns(ShiftRows(SubBytes(state))) XOR roundKey
+//..
+// where the 16 bytes of 'state' are the column-major 4x4 matrix of FIPS-197,
+// in the order in which the instruction loads them from memory.  Denoting by
+// 'K0' and 'K1' the two keys, by 'L0' and 'L1' the two lanes, and by 'B0' and
+// 'B1' the two halves of a block, each block except the last is processed as:
+//..
+//  L0 = AESENC(L0 XOR B0, K0)
+//  L1 = AESENC(L1 XOR B1, K1)
+//..
+// and the last block 'T0', 'T1' (1 to 32 bytes, or none for an empty input,
+// padded with zeros), is processed, and the hash finalized, as:
+//..
+//  L0 = AESENC(L0 XOR T0, K0)
+//  L1 = AESENC(L1 XOR T1, K1)
+//  H  = AESENC(L0, L1) XOR totalLength
+//  H  = AESENC(AESENC(AESENC(H, K0), K1), K0)
+//  return low64(H) XOR high64(H)
+//..
+// The portable implementation performs the round with the AES S-box and the
+// 'xtime' operation of FIPS-197; it is verified against the hardware
+// implementation by the test driver.
+//
+// Whether the processor supports the AES instructions is determined once, by
+// the 'CPUID' instruction, and cached.
+
+namespace BloombergLP {
+namespace bslh {
+namespace {
+namespace u {
+
+typedef AesHashAlgorithm_Imp Imp;
+
+const unsigned char k_SBOX[256] = {
+    // The AES S-box (FIPS-197, figure 7).
+
+    0x63, 0x7c, 0x77, 0x7b, 0xf2, 0x6b, 0x6f, 0xc5,
+    0x30, 0x01, 0x67, 0x2b, 0xfe, 0xd7, 0xab, 0x76,
+    0xca, 0x82, 0xc9, 0x7d, 0xfa, 0x59, 0x47, 0xf0,
+    0xad, 0xd4, 0xa2, 0xaf, 0x9c, 0xa4, 0x72, 0xc0,
+    0xb7, 0xfd, 0x93, 0x26, 0x36, 0x3f, 0xf7, 0xcc,
+    0x34, 0xa5, 0xe5, 0xf1, 0x71, 0xd8, 0x31, 0x15,
+    0x04, 0xc7, 0x23, 0xc3, 0x18, 0x96, 0x05, 0x9a,
+    0x07, 0x12, 0x80, 0xe2, 0xeb, 0x27, 0xb2, 0x75,
+    0x09, 0x83, 0x2c, 0x1a, 0x1b, 0x6e, 0x5a, 0xa0,
+    0x52, 0x3b, 0xd6, 0xb3, 0x29, 0xe3, 0x2f, 0x84,
+    0x53, 0xd1, 0x00, 0xed, 0x20, 0xfc, 0xb1, 0x5b,
+    0x6a, 0xcb, 0xbe, 0x39, 0x4a, 0x4c, 0x58, 0xcf,
+    0xd0, 0xef, 0xaa, 0xfb, 0x43, 0x4d, 0x33, 0x85,
+    0x45, 0xf9, 0x02, 0x7f, 0x50, 0x3c, 0x9f, 0xa8,
+    0x51, 0xa3, 0x40, 0x8f, 0x92, 0x9d, 0x38, 0xf5,
+    0xbc, 0xb6, 0xda, 0x21, 0x10, 0xff, 0xf3, 0xd2,
+    0xcd, 0x0c, 0x13, 0xec, 0x5f, 0x97, 0x44, 0x17,
+    0xc4, 0xa7, 0x7e, 0x3d, 0x64, 0x5d, 0x19, 0x73,
+    0x60, 0x81, 0x4f, 0xdc, 0x22, 0x2a, 0x90, 0x88,
+    0x46, 0xee, 0xb8, 0x14, 0xde, 0x5e, 0x0b, 0xdb,
+    0xe0, 0x32, 0x3a, 0x0a, 0x49, 0x06, 0x24, 0x5c,
+    0xc2, 0xd3, 0xac, 0x62, 0x91, 0x95, 0xe4, 0x79,
+    0xe7, 0xc8, 0x37, 0x6d, 0x8d, 0xd5, 0x4e, 0xa9,
+    0x6c, 0x56, 0xf4, 0xea, 0x65, 0x7a, 0xae, 0x08,
+    0xba, 0x78, 0x25, 0x2e, 0x1c, 0xa6, 0xb4, 0xc6,
+    0xe8, 0xdd, 0x74, 0x1f, 0x4b, 0xbd, 0x8b, 0x8a,
+    0x70, 0x3e, 0xb5, 0x66, 0x48, 0x03, 0xf6, 0x0e,
+    0x61, 0x35, 0x57, 0xb9, 0x86, 0xc1, 0x1d, 0x9e,
+    0xe1, 0xf8, 0x98, 0x11, 0x69, 0xd9, 0x8e, 0x94,
+    0x9b, 0x1e, 0x87, 0xe9, 0xce, 0x55, 0x28, 0xdf,
+    0x8c, 0xa1, 0x89, 0x0d, 0xbf, 0xe6, 0x42, 0x68,
+    0x41, 0x99, 0x2d, 0x0f, 0xb0, 0x54, 0xbb, 0x16,
+};
+
+inline
+unsigned char xtime(unsigned char value)
+    // Return the product of the specified 'value' by 'x' (i.e., 2) in the
+    // finite field of AES.
+{
+    return static_cast<unsigned char>((value << 1) ^
+                                      (value & 0x80 ? 0x1b : 0));
+}
+
+void aesenc(unsigned char       *state,
+            const unsigned char *roundKey)
+    // Perform one round of AES encryption, with the specified 'roundKey', on
+    // the specified 'state', having the same effect as the 'AESENC'
+    // instruction.
+{
+    // 'SubBytes' and 'ShiftRows': byte 'r + 4 * c' (row 'r', column 'c') of
+    // the result is the substitution of byte 'r + 4 * ((c + r) % 4)'.
+
+    unsigned char shifted[Imp::k_LANE_SIZE];
+    for (int c = 0; c < 4; ++c) {
+        for (int r = 0; r < 4; ++r) {
+            shifted[r + 4 * c] = k_SBOX[state[r + 4 * ((c + r) & 3)]];
+        }
+    }
+
+    // 'MixColumns' and 'AddRoundKey'.
+
+    for (int c = 0; c < 4; ++c) {
+        const unsigned char *a = shifted + 4 * c;
+        unsigned char       *s = state   + 4 * c;
+        const unsigned char *k = roundKey + 4 * c;
+
+        const unsigned char all = a[0] ^ a[1] ^ a[2] ^ a[3];
+
+        s[0] = a[0] ^ all ^ xtime(a[0] ^ a[1]) ^ k[0];
+        s[1] = a[1] ^ all ^ xtime(a[1] ^ a[2]) ^ k[1];
+        s[2] = a[2] ^ all ^ xtime(a[2] ^ a[3]) ^ k[2];
+        s[3] = a[3] ^ all ^ xtime(a[3] ^ a[0]) ^ k[3];
+    }
+}
+
+inline
+void xorInto(unsigned char *destination, const unsigned char *source)
+    // XOR the 16 bytes at the specified 'source' into those at the specified
+    // 'destination'.
+{
+    for (int i = 0; i < Imp::k_LANE_SIZE; ++i) {
+        destination[i] ^= source[i];
+    }
+}
+
+int detectAesInstructions()
+    // Return 1 if the processor supports the AES instructions, and 0
+    // otherwise.
+{
+#if defined(BSLH_AESHASHALGORITHM_AESNI)
+# if defined(BSLS_PLATFORM_CMP_MSVC)
+    int info[4];
+    __cpuid(info, 1);
+    const unsigned int ecx = static_cast<unsigned int>(info[2]);
+# else
+    unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+        return 0;                                                     // RETURN
+    }
+# endif
+    return (ecx >> 25) & 1;  // 'CPUID.01H:ECX.AES[bit 25]'
+#else
+    return 0;
+#endif
+}
+
+#if defined(BSLH_AESHASHALGORITHM_AESNI)
+BSLH_AESHASHALGORITHM_TARGET_AES
+inline
+__m128i load(const unsigned char *source)
+    // Return the 16 bytes at the specified 'source'.
+{
+    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(source));
+}
+#endif
+
+}  // close namespace u
+}  // close unnamed namespace
+
+                      // ---------------------------------
+                      // struct bslh::AesHashAlgorithm_Imp
+                      // ---------------------------------
+
+// CLASS METHODS
+BSLH_AESHASHALGORITHM_TARGET_AES
+AesHashAlgorithm_Imp::Uint64 AesHashAlgorithm_Imp::finalizeAccelerated(
+                                             const unsigned char *lanes,
+                                             const unsigned char *keys,
+                                             const unsigned char *tail,
+                                             Uint64               totalLength)
+{
+    BSLS_ASSERT(lanes);
+    BSLS_ASSERT(keys);
+    BSLS_ASSERT(tail);
+
+#if defined(BSLH_AESHASHALGORITHM_AESNI)
+    const __m128i k0 = u::load(keys);
+    const __m128i k1 = u::load(keys + k_LANE_SIZE);
+
+    const __m128i l0 = _mm_aesenc_si128(
+                              _mm_xor_si128(u::load(lanes), u::load(tail)),
+                              k0);
+    const __m128i l1 = _mm_aesenc_si128(
+                _mm_xor_si128(u::load(lanes + k_LANE_SIZE),
+                              u::load(tail + k_LANE_SIZE)),
+                k1);
+
+    __m128i h = _mm_aesenc_si128(l0, l1);
+    h = _mm_xor_si128(h,
+                      _mm_set_epi64x(0, static_cast<long long>(totalLength)));
+    h = _mm_aesenc_si128(h, k0);
+    h = _mm_aesenc_si128(h, k1);
+    h = _mm_aesenc_si128(h, k0);
+
+    unsigned char result[k_LANE_SIZE];
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(result), h);
+
+    Uint64 low;
+    Uint64 high;
+    memcpy(&low,  result,     sizeof low);
+    memcpy(&high, result + 8, sizeof high);
+
+    return BSLS_BYTEORDER_LE_U64_TO_HOST(low)
+         ^ BSLS_BYTEORDER_LE_U64_TO_HOST(high);
+#else
+    return finalizePortable(lanes, keys, tail, totalLength);
+#endif
+}
+
+AesHashAlgorithm_Imp::Uint64 AesHashAlgorithm_Imp::finalizePortable(
+                                             const unsigned char *lanes,
+                                             const unsigned char *keys,
+                                             const unsigned char *tail,
+                                             Uint64               totalLength)
+{
+    BSLS_ASSERT(lanes);
+    BSLS_ASSERT(keys);
+    BSLS_ASSERT(tail);
+
+    const unsigned char *k0 = keys;
+    const unsigned char *k1 = keys + k_LANE_SIZE;
+
+    unsigned char l0[k_LANE_SIZE];
+    unsigned char l1[k_LANE_SIZE];
+    memcpy(l0, lanes,               k_LANE_SIZE);
+    memcpy(l1, lanes + k_LANE_SIZE, k_LANE_SIZE);
+
+    u::xorInto(l0, tail);
+    u::aesenc(l0, k0);
+    u::xorInto(l1, tail + k_LANE_SIZE);
+    u::aesenc(l1, k1);
+
+    unsigned char *h = l0;
+    u::aesenc(h, l1);
+    for (int i = 0; i < 8; ++i) {
+        h[i] ^= static_cast<unsigned char>(totalLength >> (8 * i));
+    }
+    u::aesenc(h, k0);
+    u::aesenc(h, k1);
+    u::aesenc(h, k0);
+
+    Uint64 result = 0;
+    for (int i = 7; i >= 0; --i) {
+        result = (result << 8) | (h[i] ^ h[i + 8]);
+    }
+    return result;
+}
+
+bool AesHashAlgorithm_Imp::hasAesInstructions()
+{
+    static bsls::AtomicOperations::AtomicTypes::Int hasAes = { -1 };
+
+    int result = bsls::AtomicOperations::getIntRelaxed(&hasAes);
+    if (result < 0) {
+        result = u::detectAesInstructions();
+        bsls::AtomicOperations::setIntRelaxed(&hasAes, result);
+    }
+
+    return result;
+}
+
+BSLH_AESHASHALGORITHM_TARGET_AES
+void AesHashAlgorithm_Imp::processBlocksAccelerated(
+                                              unsigned char       *lanes,
+                                              const unsigned char *keys,
+                                              const unsigned char *data,
+                                              size_t               numBlocks)
+{
+    BSLS_ASSERT(lanes);
+    BSLS_ASSERT(keys);
+    BSLS_ASSERT(data || 0 == numBlocks);
+
+#if defined(BSLH_AESHASHALGORITHM_AESNI)
+    const __m128i k0 = u::load(keys);
+    const __m128i k1 = u::load(keys + k_LANE_SIZE);
+
+    __m128i l0 = u::load(lanes);
+    __m128i l1 = u::load(lanes + k_LANE_SIZE);
+
+    for (; numBlocks; --numBlocks, data += k_BLOCK_SIZE) {
+        l0 = _mm_aesenc_si128(_mm_xor_si128(l0, u::load(data)), k0);
+        l1 = _mm_aesenc_si128(_mm_xor_si128(l1, u::load(data + k_LANE_SIZE)),
+                              k1);
+    }
+
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(lanes),               l0);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(lanes + k_LANE_SIZE), l1);
+#else
+    processBlocksPortable(lanes, keys, data, numBlocks);
+#endif
+}
+
+void AesHashAlgorithm_Imp::processBlocksPortable(
+                                              unsigned char       *lanes,
+                                              const unsigned char *keys,
+                                              const unsigned char *data,
+                                              size_t               numBlocks)
+{
+    BSLS_ASSERT(lanes);
+    BSLS_ASSERT(keys);
+    BSLS_ASSERT(data || 0 == numBlocks);
+
+    for (; numBlocks; --numBlocks, data += k_BLOCK_SIZE) {
+        u::xorInto(lanes, data);
+        u::aesenc(lanes, keys);
+        u::xorInto(lanes + k_LANE_SIZE, data + k_LANE_SIZE);
+        u::aesenc(lanes + k_LANE_SIZE, keys + k_LANE_SIZE);
+    }
+}
+
+                          // ----------------------------
+                          // class bslh::AesHashAlgorithm
+                          // ----------------------------
+
+// PRIVATE MANIPULATORS
+void AesHashAlgorithm::updateLong(const unsigned char *data, size_t numBytes)
+{
+    BSLS_ASSERT(data);
+    BSLS_ASSERT(Imp::k_BLOCK_SIZE < d_bufferLength + numBytes);
+
+    d_totalLength += numBytes;
+
+    // Complete and process the buffered block, which is known not to be the
+    // last one.
+
+    if (d_bufferLength) {
+        const size_t numToCopy = Imp::k_BLOCK_SIZE - d_bufferLength;
+
+        memcpy(d_buffer + d_bufferLength, data, numToCopy);
+        data     += numToCopy;
+        numBytes -= numToCopy;
+
+        Imp::processBlocks(d_lanes, d_keys, d_buffer, 1);
+        d_bufferLength = 0;
+    }
+
+    // Process the blocks of 'data' directly, keeping the last 1 to
+    // 'Imp::k_BLOCK_SIZE' bytes in the buffer for 'computeHash'.
+
+    const size_t numBlocks = (numBytes - 1) / Imp::k_BLOCK_SIZE;
+    if (numBlocks) {
+        Imp::processBlocks(d_lanes, d_keys, data, numBlocks);
+        data     += numBlocks * Imp::k_BLOCK_SIZE;
+        numBytes -= numBlocks * Imp::k_BLOCK_SIZE;
+    }
+
+    memcpy(d_buffer, data, numBytes);
+    d_bufferLength = numBytes;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#undef BSLH_AESHASHALGORITHM_AESNI
+#undef BSLH_AESHASHALGORITHM_TARGET_AES
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
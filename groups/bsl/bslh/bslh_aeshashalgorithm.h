@@ -0,0 +1,459 @@
+// bslh_aeshashalgorithm.h                                            -*-C++-*-
+#ifndef INCLUDED_BSLH_AESHASHALGORITHM
+#define INCLUDED_BSLH_AESHASHALGORITHM
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a hashing algorithm built on the AES round function.
+//
+//@CLASSES:
+//  bslh::AesHashAlgorithm: functor implementing an AES-round-based algorithm
+//
+//@SEE_ALSO: bslh_hash, bslh_wyhashalgorithm, bslh_spookyhashalgorithm
+//
+//@DESCRIPTION: 'bslh::AesHashAlgorithm' implements a hashing algorithm whose
+// mixing function is one round of the AES block cipher (the 'AESENC'
+// instruction of x86 processors): a single 'AESENC' mixes 128 bits of state
+// with a latency of a few cycles, and two rounds diffuse every input bit into
+// every output bit.  The algorithm absorbs the input in blocks of 32 bytes
+// into two 128-bit lanes, each XOR-ing its half of the block into its state
+// and applying one AES round keyed by the seed, and finalizes the hash by
+// combining the lanes and the total length with four more rounds.
+//
+// The implementation uses the AES instructions of the processor when they are
+// available, as determined at run-time, and a portable implementation of the
+// AES round otherwise.  Both implementations produce the same hash values;
+// however, the portable implementation is several times slower than
+// 'bslh::WyHashAlgorithm', which should be preferred on processors without AES
+// instructions (see 'isHardwareAccelerated').
+//
+// This class satisfies the requirements for regular 'bslh' hashing algorithms
+// and seeded 'bslh' hashing algorithms, defined in 'bslh_hash.h' and
+// 'bslh_seededhash.h' respectively.  More information can be found in the
+// package level documentation for 'bslh'.
+//
+///Security
+///--------
+// Although it is built from the AES round function, this algorithm is *not* a
+// cryptographic hash: a single round per block is easily inverted, and there
+// are *no* security guarantees made by 'bslh::AesHashAlgorithm', meaning
+// attackers may be able to engineer keys that will cause a Denial of Service
+// (DoS) attack in hash tables using this algorithm.  If security is required,
+// an algorithm that documents better secure properties should be used, such
+// as 'bslh::SipHashAlgorithm'.
+//
+///Speed
+///-----
+// This algorithm will compute a hash on the order of O(n) where 'n' is the
+// length of the input data.  With hardware acceleration, its throughput on
+// long keys exceeds that of 'bslh::SpookyHashAlgorithm'; on short keys,
+// however, the dependent AES rounds of the finalization make it slower than
+// 'bslh::WyHashAlgorithm', which should be preferred for keys of less than a
+// few hundred bytes.  The negative test case of the test driver measures the
+// speed of the algorithms of this package over several distributions of key
+// lengths.
+//
+///Hash Distribution
+///-----------------
+// Output hashes will be well distributed and will avalanche, which means
+// changing one bit of the input will change approximately 50% of the output
+// bits.  This will prevent similar values from funneling to the same hash or
+// bucket.  The test driver verifies the avalanche and the absence of
+// collisions on sets of sparse and short keys, in the manner of SMHasher.
+//
+///Hash Consistency
+///----------------
+// This hash algorithm is endian-independent: the hash produced for a given
+// sequence of bytes and a given seed is the same on all platforms, with or
+// without hardware acceleration.  However, if the data being hashed is not a
+// character string but has internal structure, such as being integral or
+// floating-point, it is likely ordered in different ways depending on the
+// platform, and thus will not hash to the same value.
+//
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example: Computing a Seeded Checksum of a Buffer
+/// - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we want to detect, with high probability, whether a large buffer
+// received from a trusted source differs from the buffer that was sent, and
+// want a checksum that is fast to compute on long inputs.
+//
+// First, we create a seed, which must be the same for the sender and the
+// receiver:
+//..
+//  const char seed[bslh::AesHashAlgorithm::k_SEED_LENGTH] = {
+//      'c', 'h', 'e', 'c', 'k', 's', 'u', 'm', 0, 1, 2, 3, 4, 5, 6, 7 };
+//..
+// Then, we compute the checksum of the buffer, supplying it in two pieces:
+//..
+//  char buffer[1000];
+//  memset(buffer, 'x', sizeof buffer);
+//
+//  bslh::AesHashAlgorithm hashSent(seed);
+//  hashSent(buffer,       400);
+//  hashSent(buffer + 400, 600);
+//  const bsls::Types::Uint64 sent = hashSent.computeHash();
+//..
+// Now, we compute the checksum of the received buffer, at once:
+//..
+//  bslh::AesHashAlgorithm hashReceived(seed);
+//  hashReceived(buffer, sizeof buffer);
+//..
+// Finally, we verify that the checksums match, regardless of how the data was
+// supplied to the algorithm:
+//..
+//  assert(sent == hashReceived.computeHash());
+//..
+
+#include <bslscm_version.h>
+
+#include <bslmf_isbitwisemoveable.h>
+
+#include <bsls_assert.h>
+#include <bsls_byteorder.h>
+#include <bsls_types.h>
+
+#include <stddef.h>  // for 'size_t'
+#include <string.h>  // for 'memcpy', 'memset'
+
+namespace BloombergLP {
+namespace bslh {
+
+                      // =================================
+                      // struct bslh::AesHashAlgorithm_Imp
+                      // =================================
+
+struct AesHashAlgorithm_Imp {
+    // [!PRIVATE!] This component-private 'struct' provides a namespace for
+    // the two implementations, portable and hardware-accelerated, of the
+    // block processing and finalization of 'AesHashAlgorithm'.  The lanes,
+    // keys, and data are sequences of bytes, a 128-bit value being stored as
+    // 16 bytes in the order in which an AES instruction loads them.
+
+    // TYPES
+    typedef bsls::Types::Uint64 Uint64;
+
+    enum {
+        k_LANE_SIZE  = 16,  // size of a lane, and of a key, in bytes
+
+        k_BLOCK_SIZE = 32   // size of a block of input, in bytes
+    };
+
+    // CLASS METHODS
+    static Uint64 finalize(const unsigned char *lanes,
+                           const unsigned char *keys,
+                           const unsigned char *tail,
+                           Uint64               totalLength);
+        // Return the hash of an input of the specified 'totalLength' whose
+        // blocks, but the last, have been processed into the specified
+        // 'lanes' using the specified 'keys', and whose last block, padded
+        // with zeros, is the specified 'tail', using the AES instructions if
+        // 'hasAesInstructions()', and the portable implementation otherwise.
+
+    static Uint64 finalizeAccelerated(const unsigned char *lanes,
+                                      const unsigned char *keys,
+                                      const unsigned char *tail,
+                                      Uint64               totalLength);
+        // Return the same value as 'finalize' using the AES instructions.  The
+        // behavior is undefined unless 'hasAesInstructions()'.
+
+    static Uint64 finalizePortable(const unsigned char *lanes,
+                                   const unsigned char *keys,
+                                   const unsigned char *tail,
+                                   Uint64               totalLength);
+        // Return the same value as 'finalize' without using the AES
+        // instructions.
+
+    static bool hasAesInstructions();
+        // Return 'true' if the AES instructions are supported by the processor
+        // and used by this component, and 'false' otherwise.
+
+    static void processBlocks(unsigned char       *lanes,
+                              const unsigned char *keys,
+                              const unsigned char *data,
+                              size_t               numBlocks);
+        // Incorporate the specified 'numBlocks' blocks of the specified 'data'
+        // into the specified 'lanes', using the specified 'keys', using the
+        // AES instructions if 'hasAesInstructions()', and the portable
+        // implementation otherwise.
+
+    static void processBlocksAccelerated(unsigned char       *lanes,
+                                         const unsigned char *keys,
+                                         const unsigned char *data,
+                                         size_t               numBlocks);
+        // Perform the same operation as 'processBlocks' using the AES
+        // instructions.  The behavior is undefined unless
+        // 'hasAesInstructions()'.
+
+    static void processBlocksPortable(unsigned char       *lanes,
+                                      const unsigned char *keys,
+                                      const unsigned char *data,
+                                      size_t               numBlocks);
+        // Perform the same operation as 'processBlocks' without using the AES
+        // instructions.
+};
+
+                          // ============================
+                          // class bslh::AesHashAlgorithm
+                          // ============================
+
+class AesHashAlgorithm {
+    // This class implements a hashing algorithm built on the AES round
+    // function in an interface that is usable in the modular hashing system
+    // in 'bslh'.
+
+  private:
+    // PRIVATE TYPES
+    typedef bsls::Types::Uint64  Uint64;
+        // Typedef for a 64-bit integer type used in the hashing algorithm.
+
+    typedef AesHashAlgorithm_Imp Imp;
+
+    // DATA
+    unsigned char d_lanes[2 * Imp::k_LANE_SIZE];
+        // Stores the intermediate state of the two lanes of the algorithm as
+        // blocks are accumulated.
+
+    unsigned char d_keys[2 * Imp::k_LANE_SIZE];
+        // The round keys of the two lanes, derived from the seed.
+
+    unsigned char d_buffer[Imp::k_BLOCK_SIZE];
+        // Buffers the data until it is known not to be the last block of the
+        // input, which is processed by 'computeHash'.
+
+    size_t        d_bufferLength;
+        // The length of the data currently stored in the buffer.
+
+    Uint64        d_totalLength;
+        // The total length of all data that has been passed into the
+        // algorithm.
+
+    // PRIVATE CLASS METHODS
+    static void store64(unsigned char *destination, Uint64 value);
+        // Store the specified 'value' as 8 little-endian bytes at the
+        // specified 'destination'.
+
+    // PRIVATE MANIPULATORS
+    void initialize(Uint64 seedLow, Uint64 seedHigh);
+        // Initialize the state of this algorithm with the seed whose low and
+        // high halves are the specified 'seedLow' and 'seedHigh'.
+
+    void updateLong(const unsigned char *data, size_t numBytes);
+        // Incorporate the specified 'data', of the specified 'numBytes', into
+        // the state of this algorithm, processing the blocks preceding the
+        // last 1 to 'Imp::k_BLOCK_SIZE' bytes of the data supplied so far.
+        // The behavior is undefined unless
+        // 'Imp::k_BLOCK_SIZE < d_bufferLength + numBytes'.
+
+    // NOT IMPLEMENTED
+    AesHashAlgorithm(const AesHashAlgorithm& original); // = delete;
+        // Do not allow copy construction.
+
+    AesHashAlgorithm& operator=(const AesHashAlgorithm& rhs); // = delete;
+        // Do not allow assignment.
+
+  public:
+    // TYPES
+    typedef Uint64 result_type;
+        // Typedef indicating the value type returned by this algorithm.
+
+    // CONSTANTS
+    enum { k_SEED_LENGTH = 16 }; // Seed length in bytes.
+
+    // CLASS METHODS
+    static bool isHardwareAccelerated();
+        // Return 'true' if this algorithm uses the AES instructions of the
+        // processor, and 'false' if it uses its (slower) portable
+        // implementation.
+
+    // CREATORS
+    AesHashAlgorithm();
+        // Create a 'bslh::AesHashAlgorithm' using a default initial seed.
+
+    explicit AesHashAlgorithm(const char *seed);
+        // Create a 'bslh::AesHashAlgorithm', seeded with a 128-bit
+        // ('k_SEED_LENGTH' bytes) seed pointed to by the specified 'seed'.
+        // Each bit of the supplied seed will contribute to the final hash
+        // produced by 'computeHash()'.  The behavior is undefined unless
+        // 'seed' points to at least 16 bytes of initialized memory.
+
+    //! ~AesHashAlgorithm() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    void operator()(const void *data, size_t numBytes);
+        // Incorporate the specified 'data', of at least the specified
+        // 'numBytes', into the internal state of the hashing algorithm.  Every
+        // bit of data incorporated into the internal state of the algorithm
+        // will contribute to the final hash produced by 'computeHash()'.  The
+        // same hash will be produced regardless of whether a sequence of bytes
+        // is passed in all at once or through multiple calls to this member
+        // function.  Input where 'numBytes' is 0 will have no effect on the
+        // internal state of the algorithm.  The behavior is undefined unless
+        // 'data' points to a valid memory location with at least 'numBytes'
+        // bytes of initialized memory or 'numBytes' is zero.
+
+    result_type computeHash();
+        // Return the finalized version of the hash that has been accumulated.
+        // Note that this changes the internal state of the object, so calling
+        // 'computeHash()' multiple times in a row will return different
+        // results, and only the first result returned will match the expected
+        // result of the algorithm.  Also note that a value will be returned,
+        // even if data has not been passed into 'operator()'.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                      // ---------------------------------
+                      // struct bslh::AesHashAlgorithm_Imp
+                      // ---------------------------------
+
+// CLASS METHODS
+inline
+AesHashAlgorithm_Imp::Uint64 AesHashAlgorithm_Imp::finalize(
+                                             const unsigned char *lanes,
+                                             const unsigned char *keys,
+                                             const unsigned char *tail,
+                                             Uint64               totalLength)
+{
+    return hasAesInstructions()
+           ? finalizeAccelerated(lanes, keys, tail, totalLength)
+           : finalizePortable(lanes, keys, tail, totalLength);
+}
+
+inline
+void AesHashAlgorithm_Imp::processBlocks(unsigned char       *lanes,
+                                         const unsigned char *keys,
+                                         const unsigned char *data,
+                                         size_t               numBlocks)
+{
+    if (hasAesInstructions()) {
+        processBlocksAccelerated(lanes, keys, data, numBlocks);
+    }
+    else {
+        processBlocksPortable(lanes, keys, data, numBlocks);
+    }
+}
+
+                          // ----------------------------
+                          // class bslh::AesHashAlgorithm
+                          // ----------------------------
+
+// PRIVATE CLASS METHODS
+inline
+void AesHashAlgorithm::store64(unsigned char *destination, Uint64 value)
+{
+    value = BSLS_BYTEORDER_HOST_U64_TO_LE(value);
+    memcpy(destination, &value, sizeof value);
+}
+
+// PRIVATE MANIPULATORS
+inline
+void AesHashAlgorithm::initialize(Uint64 seedLow, Uint64 seedHigh)
+{
+    // The constants are the first 256 bits of the fractional part of 'pi'.
+
+    store64(d_keys,      seedLow  ^ 0x243f6a8885a308d3ULL);
+    store64(d_keys +  8, seedHigh ^ 0x13198a2e03707344ULL);
+    store64(d_keys + 16, seedLow  ^ 0xa4093822299f31d0ULL);
+    store64(d_keys + 24, seedHigh ^ 0x082efa98ec4e6c89ULL);
+
+    memcpy(d_lanes,                    d_keys + Imp::k_LANE_SIZE,
+           Imp::k_LANE_SIZE);
+    memcpy(d_lanes + Imp::k_LANE_SIZE, d_keys,
+           Imp::k_LANE_SIZE);
+
+    d_bufferLength = 0;
+    d_totalLength  = 0;
+}
+
+// CLASS METHODS
+inline
+bool AesHashAlgorithm::isHardwareAccelerated()
+{
+    return Imp::hasAesInstructions();
+}
+
+// CREATORS
+inline
+AesHashAlgorithm::AesHashAlgorithm()
+{
+    initialize(0, 0);
+}
+
+inline
+AesHashAlgorithm::AesHashAlgorithm(const char *seed)
+{
+    BSLS_ASSERT(seed);
+
+    Uint64 seedLow;
+    Uint64 seedHigh;
+    memcpy(&seedLow,  seed,     sizeof seedLow);
+    memcpy(&seedHigh, seed + 8, sizeof seedHigh);
+
+    initialize(BSLS_BYTEORDER_LE_U64_TO_HOST(seedLow),
+               BSLS_BYTEORDER_LE_U64_TO_HOST(seedHigh));
+}
+
+// MANIPULATORS
+inline
+void AesHashAlgorithm::operator()(const void *data, size_t numBytes)
+{
+    BSLS_ASSERT(0 != data || 0 == numBytes);
+
+    if (numBytes <= Imp::k_BLOCK_SIZE - d_bufferLength) {
+        if (numBytes) {
+            memcpy(d_buffer + d_bufferLength, data, numBytes);
+            d_bufferLength += numBytes;
+            d_totalLength  += numBytes;
+        }
+        return;                                                       // RETURN
+    }
+
+    updateLong(static_cast<const unsigned char *>(data), numBytes);
+}
+
+inline
+AesHashAlgorithm::result_type AesHashAlgorithm::computeHash()
+{
+    memset(d_buffer + d_bufferLength, 0, Imp::k_BLOCK_SIZE - d_bufferLength);
+
+    return Imp::finalize(d_lanes, d_keys, d_buffer, d_totalLength);
+}
+
+}  // close package namespace
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+namespace bslmf {
+template <>
+struct IsBitwiseMoveable<bslh::AesHashAlgorithm>
+    : bsl::true_type {};
+}  // close namespace bslmf
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,70 @@
+// bslh_wyhashalgorithm.cpp                                           -*-C++-*-
+#include <bslh_wyhashalgorithm.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#include <bsls_assert.h>
+
+#include <string.h>  // for 'memcpy'
+
+namespace BloombergLP {
+namespace bslh {
+
+                          // ---------------------------
+                          // class bslh::WyHashAlgorithm
+                          // ---------------------------
+
+// PRIVATE MANIPULATORS
+void WyHashAlgorithm::updateLong(const unsigned char *data, size_t numBytes)
+{
+    BSLS_ASSERT(data);
+    BSLS_ASSERT(k_BLOCK_SIZE < d_bufferLength + numBytes);
+
+    d_totalLength += numBytes;
+
+    // Complete and process the buffered block, which is known not to be the
+    // last one.
+
+    if (d_bufferLength) {
+        const size_t numToCopy = k_BLOCK_SIZE - d_bufferLength;
+
+        memcpy(d_buffer + d_bufferLength, data, numToCopy);
+        data     += numToCopy;
+        numBytes -= numToCopy;
+
+        processBlock(d_buffer);
+        d_bufferLength = 0;
+    }
+
+    // Process the blocks of 'data' directly, keeping the last 1 to
+    // 'k_BLOCK_SIZE' bytes in the buffer for 'computeHash'.
+
+    while (numBytes > k_BLOCK_SIZE) {
+        processBlock(data);
+        data     += k_BLOCK_SIZE;
+        numBytes -= k_BLOCK_SIZE;
+    }
+
+    memcpy(d_buffer, data, numBytes);
+    d_bufferLength = numBytes;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
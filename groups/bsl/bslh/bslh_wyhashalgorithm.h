@@ -0,0 +1,503 @@
+// bslh_wyhashalgorithm.h                                             -*-C++-*-
+#ifndef INCLUDED_BSLH_WYHASHALGORITHM
+#define INCLUDED_BSLH_WYHASHALGORITHM
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an implementation of a wyhash-style multiply-mix algorithm.
+//
+//@CLASSES:
+//  bslh::WyHashAlgorithm: functor implementing a wyhash-style algorithm
+//
+//@SEE_ALSO: bslh_hash, bslh_aeshashalgorithm, bslh_spookyhashalgorithm
+//
+//@DESCRIPTION: 'bslh::WyHashAlgorithm' implements a hashing algorithm of the
+// family of wyhash (by Wang Yi) and rapidhash (by Nicolas De Carli), whose
+// only non-trivial operation is the "multiply-mix": the full 128-bit product
+// of two 64-bit words, folded back to 64 bits by XOR-ing its two halves.  On
+// 64-bit platforms, a multiply-mix is a single instruction, and the algorithm
+// hashes the short keys (up to 16 bytes) that dominate the use of hash tables
+// with two multiply-mix operations, plus the reads of the key.  See:
+// https://github.com/wangyi-fudan/wyhash and
+// https://github.com/Nicoshev/rapidhash
+//
+// The algorithm reads keys of up to 16 bytes with (possibly overlapping)
+// 4-byte reads, as wyhash does, and processes longer keys in blocks of 48
+// bytes in three independent lanes, as rapidhash does, which allows the
+// processor to execute the three multiplications concurrently.  Unlike the
+// reference implementations, which hash a contiguous key, this class buffers
+// the data supplied to 'operator()' so that a sequence of bytes produces the
+// same hash whether it is supplied at once or in pieces, as required of 'bslh'
+// hashing algorithms; the hash values produced are therefore *not* those of
+// the reference implementations.
+//
+// This class satisfies the requirements for regular 'bslh' hashing algorithms
+// and seeded 'bslh' hashing algorithms, defined in 'bslh_hash.h' and
+// 'bslh_seededhash.h' respectively.  More information can be found in the
+// package level documentation for 'bslh'.
+//
+///Security
+///--------
+// There are *no* security guarantees made by 'bslh::WyHashAlgorithm', meaning
+// attackers may be able to engineer keys that will cause a Denial of Service
+// (DoS) attack in hash tables using this algorithm, even if they do not know
+// the seed used to initialize it.  If security is required, an algorithm that
+// documents better secure properties should be used, such as
+// 'bslh::SipHashAlgorithm'.
+//
+///Speed
+///-----
+// This algorithm will compute a hash on the order of O(n) where 'n' is the
+// length of the input data.  It is designed for keys of a few bytes to a few
+// dozens of bytes, on which it is faster than 'bslh::SpookyHashAlgorithm',
+// and several times faster than 'bslh::SipHashAlgorithm'; on long keys, its
+// throughput exceeds that of 'bslh::SpookyHashAlgorithm'.  The negative test
+// case of the test driver measures the speed of the algorithms of this
+// package over several distributions of key lengths.
+//
+///Hash Distribution
+///-----------------
+// Output hashes will be well distributed and will avalanche, which means
+// changing one bit of the input will change approximately 50% of the output
+// bits.  This will prevent similar values from funneling to the same hash or
+// bucket.  The test driver verifies the avalanche and the absence of
+// collisions on sets of sparse and short keys, in the manner of SMHasher.
+//
+///Hash Consistency
+///----------------
+// This hash algorithm is endian-independent: the input is read as a sequence
+// of little-endian words, so the hash produced for a given sequence of bytes
+// and a given seed is the same on all platforms.  However, if the data being
+// hashed is not a character string but has internal structure, such as being
+// integral or floating-point, it is likely ordered in different ways depending
+// on the platform, and thus will not hash to the same value.
+//
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example: Hashing Short Keys in an Unordered Set
+///- - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we maintain a set of ticker symbols, which are short strings, and
+// that profiling shows that hashing them takes a significant share of the
+// time spent looking them up.  We can use 'bslh::WyHashAlgorithm', which is
+// designed for short keys.
+//
+// First, we define a type for the ticker symbols, making it hashable with the
+// 'bslh' framework:
+//..
+//  class Ticker {
+//      // This class identifies a security by its ticker symbol.
+//
+//      // DATA
+//      char d_symbol[8];  // null-padded symbol
+//
+//    public:
+//      // CREATORS
+//      explicit Ticker(const char *symbol)
+//          // Create a 'Ticker' having the specified 'symbol'.  The behavior
+//          // is undefined unless 'symbol' has at most 8 characters.
+//      {
+//          memset(d_symbol, 0, sizeof d_symbol);
+//          memcpy(d_symbol, symbol, strlen(symbol));
+//      }
+//
+//      // ACCESSORS
+//      bool operator==(const Ticker& other) const
+//          // Return 'true' if this object has the same symbol as the
+//          // specified 'other' object, and 'false' otherwise.
+//      {
+//          return 0 == memcmp(d_symbol, other.d_symbol, sizeof d_symbol);
+//      }
+//
+//      template <class HASH_ALGORITHM>
+//      friend void hashAppend(HASH_ALGORITHM& algorithm,
+//                             const Ticker&   ticker)
+//          // Incorporate the specified 'ticker' into the specified
+//          // 'algorithm'.
+//      {
+//          algorithm(ticker.d_symbol, sizeof ticker.d_symbol);
+//      }
+//  };
+//..
+// Then, we define the hash functor, which applies 'bslh::WyHashAlgorithm' to
+// a 'Ticker' (note that 'bslh::Hash<bslh::WyHashAlgorithm>' provides the same
+// functionality for any type having a 'hashAppend' function):
+//..
+//  struct TickerHash {
+//      // This 'struct' is a functor hashing 'Ticker' objects.
+//
+//      size_t operator()(const Ticker& ticker) const
+//          // Return the hash of the specified 'ticker'.
+//      {
+//          bslh::WyHashAlgorithm algorithm;
+//          hashAppend(algorithm, ticker);
+//          return static_cast<size_t>(algorithm.computeHash());
+//      }
+//  };
+//..
+// Now, we hash a few tickers:
+//..
+//  TickerHash hasher;
+//
+//  const size_t h1 = hasher(Ticker("IBM"));
+//  const size_t h2 = hasher(Ticker("IBM"));
+//  const size_t h3 = hasher(Ticker("MSFT"));
+//..
+// Finally, we verify that equal tickers have equal hashes, and that distinct
+// tickers have (as expected, with overwhelming probability) distinct hashes:
+//..
+//  assert(h1 == h2);
+//  assert(h1 != h3);
+//..
+
+#include <bslscm_version.h>
+
+#include <bslmf_isbitwisemoveable.h>
+
+#include <bsls_assert.h>
+#include <bsls_byteorder.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <stddef.h>  // for 'size_t'
+#include <string.h>  // for 'memcpy'
+
+namespace BloombergLP {
+namespace bslh {
+
+                          // ===========================
+                          // class bslh::WyHashAlgorithm
+                          // ===========================
+
+class WyHashAlgorithm {
+    // This class implements a wyhash-style multiply-mix hashing algorithm in
+    // an interface that is usable in the modular hashing system in 'bslh'.
+
+  private:
+    // PRIVATE TYPES
+    typedef bsls::Types::Uint64 Uint64;
+        // Typedef for a 64-bit integer type used in the hashing algorithm.
+
+    enum {
+        k_BLOCK_SIZE = 48  // number of bytes processed by each step of the
+                           // algorithm on long keys
+    };
+
+    // DATA
+    Uint64        d_lane0;
+    Uint64        d_lane1;
+    Uint64        d_lane2;
+        // Stores the intermediate state of the three lanes of the algorithm
+        // as blocks are accumulated.
+
+    Uint64        d_totalLength;
+        // The total length of all data that has been passed into the
+        // algorithm.
+
+    size_t        d_bufferLength;
+        // The length of the data currently stored in the buffer.
+
+    union {
+        Uint64        d_alignment;
+            // Provides alignment.
+
+        unsigned char d_buffer[k_BLOCK_SIZE];
+            // Buffers the data until it is known not to be the last block of
+            // the input, which is processed by 'computeHash'.
+    };
+
+    // PRIVATE CLASS METHODS
+    static Uint64 mix(Uint64 lhs, Uint64 rhs);
+        // Return the XOR of the two halves of the 128-bit product of the
+        // specified 'lhs' and 'rhs'.
+
+    static void multiply(Uint64 *low, Uint64 *high);
+        // Load into the specified 'low' and 'high' the low and high halves,
+        // respectively, of the 128-bit product of their values.
+
+    static Uint64 read32(const unsigned char *data);
+        // Return the 4 bytes at the specified 'data' as a little-endian
+        // integer.
+
+    static Uint64 read64(const unsigned char *data);
+        // Return the 8 bytes at the specified 'data' as a little-endian
+        // integer.
+
+    // PRIVATE MANIPULATORS
+    void initialize(Uint64 seed);
+        // Initialize the state of this algorithm with the specified 'seed'.
+
+    void processBlock(const unsigned char *block);
+        // Incorporate the 'k_BLOCK_SIZE' bytes at the specified 'block' into
+        // the lanes of this algorithm.
+
+    void updateLong(const unsigned char *data, size_t numBytes);
+        // Incorporate the specified 'data', of the specified 'numBytes', into
+        // the state of this algorithm, processing the blocks preceding the
+        // last 1 to 'k_BLOCK_SIZE' bytes of the data supplied so far.  The
+        // behavior is undefined unless
+        // 'k_BLOCK_SIZE < d_bufferLength + numBytes'.
+
+    // NOT IMPLEMENTED
+    WyHashAlgorithm(const WyHashAlgorithm& original); // = delete;
+        // Do not allow copy construction.
+
+    WyHashAlgorithm& operator=(const WyHashAlgorithm& rhs); // = delete;
+        // Do not allow assignment.
+
+  public:
+    // TYPES
+    typedef Uint64 result_type;
+        // Typedef indicating the value type returned by this algorithm.
+
+    // CONSTANTS
+    enum { k_SEED_LENGTH = 8 }; // Seed length in bytes.
+
+    // CREATORS
+    WyHashAlgorithm();
+        // Create a 'bslh::WyHashAlgorithm' using a default initial seed.
+
+    explicit WyHashAlgorithm(const char *seed);
+        // Create a 'bslh::WyHashAlgorithm', seeded with a 64-bit
+        // ('k_SEED_LENGTH' bytes) seed pointed to by the specified 'seed'.
+        // Each bit of the supplied seed will contribute to the final hash
+        // produced by 'computeHash()'.  The behavior is undefined unless
+        // 'seed' points to at least 8 bytes of initialized memory.
+
+    //! ~WyHashAlgorithm() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    void operator()(const void *data, size_t numBytes);
+        // Incorporate the specified 'data', of at least the specified
+        // 'numBytes', into the internal state of the hashing algorithm.  Every
+        // bit of data incorporated into the internal state of the algorithm
+        // will contribute to the final hash produced by 'computeHash()'.  The
+        // same hash will be produced regardless of whether a sequence of bytes
+        // is passed in all at once or through multiple calls to this member
+        // function.  Input where 'numBytes' is 0 will have no effect on the
+        // internal state of the algorithm.  The behavior is undefined unless
+        // 'data' points to a valid memory location with at least 'numBytes'
+        // bytes of initialized memory or 'numBytes' is zero.
+
+    result_type computeHash();
+        // Return the finalized version of the hash that has been accumulated.
+        // Note that this changes the internal state of the object, so calling
+        // 'computeHash()' multiple times in a row will return different
+        // results, and only the first result returned will match the expected
+        // result of the algorithm.  Also note that a value will be returned,
+        // even if data has not been passed into 'operator()'.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                          // ---------------------------
+                          // class bslh::WyHashAlgorithm
+                          // ---------------------------
+
+// PRIVATE CLASS METHODS
+inline
+WyHashAlgorithm::Uint64 WyHashAlgorithm::mix(Uint64 lhs, Uint64 rhs)
+{
+    multiply(&lhs, &rhs);
+    return lhs ^ rhs;
+}
+
+inline
+void WyHashAlgorithm::multiply(Uint64 *low, Uint64 *high)
+{
+    BSLS_ASSERT_SAFE(low);
+    BSLS_ASSERT_SAFE(high);
+
+#if defined(BSLS_PLATFORM_CPU_64_BIT)                                         \
+ && (defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG))
+    __extension__ typedef unsigned __int128 Uint128;
+
+    const Uint128 product = static_cast<Uint128>(*low) * *high;
+
+    *low  = static_cast<Uint64>(product);
+    *high = static_cast<Uint64>(product >> 64);
+#else
+    // Compute the product from the four products of the 32-bit halves.
+
+    const Uint64 lhsHi = *low  >> 32;
+    const Uint64 lhsLo = *low  & 0xffffffffULL;
+    const Uint64 rhsHi = *high >> 32;
+    const Uint64 rhsLo = *high & 0xffffffffULL;
+
+    const Uint64 hh = lhsHi * rhsHi;
+    const Uint64 hl = lhsHi * rhsLo;
+    const Uint64 lh = lhsLo * rhsHi;
+    const Uint64 ll = lhsLo * rhsLo;
+
+    const Uint64 middle = (ll >> 32) + (hl & 0xffffffffULL) + lh;
+
+    *low  = (middle << 32) | (ll & 0xffffffffULL);
+    *high = hh + (hl >> 32) + (middle >> 32);
+#endif
+}
+
+inline
+WyHashAlgorithm::Uint64 WyHashAlgorithm::read32(const unsigned char *data)
+{
+    unsigned int value;
+    memcpy(&value, data, sizeof value);
+    return BSLS_BYTEORDER_LE_U32_TO_HOST(value);
+}
+
+inline
+WyHashAlgorithm::Uint64 WyHashAlgorithm::read64(const unsigned char *data)
+{
+    Uint64 value;
+    memcpy(&value, data, sizeof value);
+    return BSLS_BYTEORDER_LE_U64_TO_HOST(value);
+}
+
+// PRIVATE MANIPULATORS
+inline
+void WyHashAlgorithm::initialize(Uint64 seed)
+{
+    seed ^= mix(seed ^ 0x2d358dccaa6c78a5ULL, 0x8bb84b93962eacc9ULL);
+
+    d_lane0         = seed;
+    d_lane1         = seed;
+    d_lane2         = seed;
+    d_totalLength   = 0;
+    d_bufferLength  = 0;
+}
+
+inline
+void WyHashAlgorithm::processBlock(const unsigned char *block)
+{
+    d_lane0 = mix(read64(block)      ^ 0x2d358dccaa6c78a5ULL,
+                  read64(block +  8) ^ d_lane0);
+    d_lane1 = mix(read64(block + 16) ^ 0x8bb84b93962eacc9ULL,
+                  read64(block + 24) ^ d_lane1);
+    d_lane2 = mix(read64(block + 32) ^ 0x4b33a62ed433d4a3ULL,
+                  read64(block + 40) ^ d_lane2);
+}
+
+// CREATORS
+inline
+WyHashAlgorithm::WyHashAlgorithm()
+{
+    initialize(0);
+}
+
+inline
+WyHashAlgorithm::WyHashAlgorithm(const char *seed)
+{
+    BSLS_ASSERT(seed);
+
+    initialize(read64(reinterpret_cast<const unsigned char *>(seed)));
+}
+
+// MANIPULATORS
+inline
+void WyHashAlgorithm::operator()(const void *data, size_t numBytes)
+{
+    BSLS_ASSERT(0 != data || 0 == numBytes);
+
+    if (numBytes <= k_BLOCK_SIZE - d_bufferLength) {
+        if (numBytes) {
+            memcpy(d_buffer + d_bufferLength, data, numBytes);
+            d_bufferLength += numBytes;
+            d_totalLength  += numBytes;
+        }
+        return;                                                       // RETURN
+    }
+
+    updateLong(static_cast<const unsigned char *>(data), numBytes);
+}
+
+inline
+WyHashAlgorithm::result_type WyHashAlgorithm::computeHash()
+{
+    // The buffer holds the last 'd_bufferLength' bytes of the input, which
+    // are all the input if it is at most 'k_BLOCK_SIZE' bytes long, and
+    // between 1 and 'k_BLOCK_SIZE' bytes otherwise.
+
+    Uint64 seed = d_lane0;
+    if (d_totalLength > k_BLOCK_SIZE) {
+        seed ^= d_lane1 ^ d_lane2;
+    }
+
+    const unsigned char *p = d_buffer;
+    size_t               n = d_bufferLength;
+
+    Uint64 a;
+    Uint64 b;
+
+    while (n > 16) {
+        seed = mix(read64(p) ^ 0x8bb84b93962eacc9ULL, read64(p + 8) ^ seed);
+        p += 16;
+        n -= 16;
+    }
+
+    if (p != d_buffer) {
+        // At least 16 bytes precede 'p + n' in the buffer: read the last 16
+        // bytes, overlapping those already processed.
+
+        a = read64(p + n - 16);
+        b = read64(p + n - 8);
+    }
+    else if (n >= 4) {
+        const size_t delta = (n & 24) >> (n >> 3);
+
+        a = (read32(p) << 32)         | read32(p + n - 4);
+        b = (read32(p + delta) << 32) | read32(p + n - 4 - delta);
+    }
+    else if (n > 0) {
+        a = static_cast<Uint64>(p[0])      << 56
+          | static_cast<Uint64>(p[n >> 1]) << 32
+          | static_cast<Uint64>(p[n - 1]);
+        b = 0;
+    }
+    else {
+        a = 0;
+        b = 0;
+    }
+
+    a ^= 0x8bb84b93962eacc9ULL;
+    b ^= seed;
+    multiply(&a, &b);
+
+    return mix(a ^ 0x2d358dccaa6c78a5ULL ^ d_totalLength,
+               b ^ 0x8bb84b93962eacc9ULL);
+}
+
+}  // close package namespace
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+namespace bslmf {
+template <>
+struct IsBitwiseMoveable<bslh::WyHashAlgorithm>
+    : bsl::true_type {};
+}  // close namespace bslmf
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
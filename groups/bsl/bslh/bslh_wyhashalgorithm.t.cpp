@@ -0,0 +1,1147 @@
+// bslh_wyhashalgorithm.t.cpp                                         -*-C++-*-
+#include <bslh_wyhashalgorithm.h>
+
+#include <bslh_siphashalgorithm.h>
+#include <bslh_spookyhashalgorithmimp.h>
+
+#include <bslmf_isbitwisemoveable.h>
+#include <bslmf_issame.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace BloombergLP;
+using namespace bslh;
+
+//=============================================================================
+//                                  TEST PLAN
+//-----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test is a 'bslh' hashing algorithm.  The basic test plan
+// is to compare the output of the function call operator with the expected
+// output generated by a known-good version of the algorithm, and to verify
+// that the output does not depend on how the input is segmented across calls
+// to the function call operator, in particular around the boundaries of the
+// internal blocks.  The component will also be tested for conformance to the
+// requirements on 'bslh' hashing algorithms, outlined in the 'bslh' package
+// level documentation, and for the statistical quality of its output
+// (avalanche and collisions of sparse keys).
+//-----------------------------------------------------------------------------
+// TYPEDEF
+// [ 4] typedef bsls::Types::Uint64 result_type;
+//
+// CONSTANTS
+// [ 5] enum { k_SEED_LENGTH = 8 };
+//
+// CREATORS
+// [ 2] WyHashAlgorithm();
+// [ 2] explicit WyHashAlgorithm(const char *seed);
+// [ 2] ~WyHashAlgorithm();
+//
+// MANIPULATORS
+// [ 3] void operator()(const void *data, size_t numBytes);
+// [ 3] result_type computeHash();
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] Trait IsBitwiseMoveable
+// [ 7] SEGMENTATION INDEPENDENCE
+// [ 8] HASH QUALITY
+// [ 9] USAGE EXAMPLE
+// [-1] PERFORMANCE: HASHING KEYS OF VARIOUS LENGTHS
+//-----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BSL ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", line, message);
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BSL TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P            BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_           BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+//=============================================================================
+//                   GLOBAL TYPEDEFS AND DATA FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef WyHashAlgorithm     Obj;
+typedef bsls::Types::Uint64 Uint64;
+
+const char genericSeed[Obj::k_SEED_LENGTH] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+
+//=============================================================================
+//                       GLOBAL HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+static Uint64 nextRandom(Uint64 *state)
+    // Return the next value of the "splitmix64" pseudo-random sequence whose
+    // state is the specified 'state', and advance 'state'.
+{
+    Uint64 z = (*state += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+static void fillRandom(unsigned char *buffer, size_t numBytes, Uint64 *state)
+    // Load into the specified 'buffer' the specified 'numBytes' pseudo-random
+    // bytes generated from the specified 'state'.
+{
+    for (size_t i = 0; i < numBytes; ++i) {
+        buffer[i] = static_cast<unsigned char>(nextRandom(state) >> 56);
+    }
+}
+
+static Uint64 hashOnce(const void *data, size_t numBytes)
+    // Return the hash of the specified 'data' having the specified 'numBytes'
+    // computed by a default-constructed 'Obj' in a single call.
+{
+    Obj algorithm;
+    algorithm(data, numBytes);
+    return algorithm.computeHash();
+}
+
+static int compareUint64(const void *lhs, const void *rhs)
+    // Return a negative value, 0, or a positive value if the 'Uint64' pointed
+    // to by the specified 'lhs' is less than, equal to, or greater than the
+    // 'Uint64' pointed to by the specified 'rhs', respectively.
+{
+    const Uint64 a = *static_cast<const Uint64 *>(lhs);
+    const Uint64 b = *static_cast<const Uint64 *>(rhs);
+
+    return a < b ? -1 : a > b ? 1 : 0;
+}
+
+static int countDuplicates(Uint64 *values, int numValues, Uint64 mask)
+    // Return the number of values among the specified 'numValues' 'values'
+    // that are, in the bits set in the specified 'mask', equal to another
+    // value preceding them once sorted.  Note that 'values' is modified.
+{
+    for (int i = 0; i < numValues; ++i) {
+        values[i] &= mask;
+    }
+    qsort(values, numValues, sizeof *values, &compareUint64);
+
+    int result = 0;
+    for (int i = 1; i < numValues; ++i) {
+        result += values[i] == values[i - 1];
+    }
+    return result;
+}
+
+static double worstAvalancheBias(int keyLength, int numSamples, Uint64 seed)
+    // Return the greatest deviation from 0.5, over all the pairs of a bit of
+    // input and a bit of output, of the proportion of the specified
+    // 'numSamples' random keys of the specified 'keyLength' bytes, generated
+    // from the specified 'seed', for which flipping the bit of input flips the
+    // bit of output.  The behavior is undefined unless
+    // '0 < keyLength <= 128'.
+{
+    enum { k_MAX_KEY_LENGTH = 128 };
+
+    static int    counts[k_MAX_KEY_LENGTH * 8][64];
+    unsigned char key[k_MAX_KEY_LENGTH];
+
+    const int numBits = keyLength * 8;
+    memset(counts, 0, sizeof counts);
+
+    for (int sample = 0; sample < numSamples; ++sample) {
+        fillRandom(key, keyLength, &seed);
+        const Uint64 hash = hashOnce(key, keyLength);
+
+        for (int bit = 0; bit < numBits; ++bit) {
+            key[bit / 8] ^= static_cast<unsigned char>(1 << (bit % 8));
+            Uint64 diff = hash ^ hashOnce(key, keyLength);
+            key[bit / 8] ^= static_cast<unsigned char>(1 << (bit % 8));
+
+            for (int out = 0; diff; ++out, diff >>= 1) {
+                counts[bit][out] += static_cast<int>(diff & 1);
+            }
+        }
+    }
+
+    double result = 0;
+    for (int bit = 0; bit < numBits; ++bit) {
+        for (int out = 0; out < 64; ++out) {
+            double bias = static_cast<double>(counts[bit][out]) / numSamples
+                                                                        - 0.5;
+            bias = bias < 0 ? -bias : bias;
+            result = bias > result ? bias : result;
+        }
+    }
+    return result;
+}
+
+//=============================================================================
+//                             USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example: Hashing Short Keys in an Unordered Set
+///- - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we maintain a set of ticker symbols, which are short strings, and
+// that profiling shows that hashing them takes a significant share of the
+// time spent looking them up.  We can use 'bslh::WyHashAlgorithm', which is
+// designed for short keys.
+//
+// First, we define a type for the ticker symbols, making it hashable with the
+// 'bslh' framework:
+//..
+    class Ticker {
+        // This class identifies a security by its ticker symbol.
+
+        // DATA
+        char d_symbol[8];  // null-padded symbol
+
+      public:
+        // CREATORS
+        explicit Ticker(const char *symbol)
+            // Create a 'Ticker' having the specified 'symbol'.  The behavior
+            // is undefined unless 'symbol' has at most 8 characters.
+        {
+            memset(d_symbol, 0, sizeof d_symbol);
+            memcpy(d_symbol, symbol, strlen(symbol));
+        }
+
+        // ACCESSORS
+        bool operator==(const Ticker& other) const
+            // Return 'true' if this object has the same symbol as the
+            // specified 'other' object, and 'false' otherwise.
+        {
+            return 0 == memcmp(d_symbol, other.d_symbol, sizeof d_symbol);
+        }
+
+        template <class HASH_ALGORITHM>
+        friend void hashAppend(HASH_ALGORITHM& algorithm,
+                               const Ticker&   ticker)
+            // Incorporate the specified 'ticker' into the specified
+            // 'algorithm'.
+        {
+            algorithm(ticker.d_symbol, sizeof ticker.d_symbol);
+        }
+    };
+//..
+// Then, we define the hash functor, which applies 'bslh::WyHashAlgorithm' to
+// a 'Ticker' (note that 'bslh::Hash<bslh::WyHashAlgorithm>' provides the same
+// functionality for any type having a 'hashAppend' function):
+//..
+    struct TickerHash {
+        // This 'struct' is a functor hashing 'Ticker' objects.
+
+        size_t operator()(const Ticker& ticker) const
+            // Return the hash of the specified 'ticker'.
+        {
+            bslh::WyHashAlgorithm algorithm;
+            hashAppend(algorithm, ticker);
+            return static_cast<size_t>(algorithm.computeHash());
+        }
+    };
+//..
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVeryVeryVerbose;  // suppress warning
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:
+      case 9: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   The hashing algorithm can be applied to user defined types which
+        //   implement the 'hashAppend' protocol.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate the usage example from the header file into the test
+        //:   driver, remove leading comment characters, and replace 'assert'
+        //:   with 'ASSERT'. (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// Now, we hash a few tickers:
+//..
+        TickerHash hasher;
+
+        const size_t h1 = hasher(Ticker("IBM"));
+        const size_t h2 = hasher(Ticker("IBM"));
+        const size_t h3 = hasher(Ticker("MSFT"));
+//..
+// Finally, we verify that equal tickers have equal hashes, and that distinct
+// tickers have (as expected, with overwhelming probability) distinct hashes:
+//..
+        ASSERT(h1 == h2);
+        ASSERT(h1 != h3);
+//..
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // HASH QUALITY
+        //   Verify that the output of the algorithm has the statistical
+        //   properties expected of a hash function suitable for hash tables,
+        //   in the manner of the SMHasher test suite.
+        //
+        // Concerns:
+        //: 1 Flipping any bit of the input flips each bit of the output with a
+        //:   probability close to 1/2 ("avalanche"), for key lengths on both
+        //:   sides of each boundary of the internal processing (4, 8, 16, and
+        //:   48 bytes).
+        //:
+        //: 2 Keys differing in few bits (e.g., small integers, or mostly zero
+        //:   buffers) do not collide, neither on all 64 bits of the hash, nor
+        //:   on its lower 32 bits beyond the number expected of a random
+        //:   function.
+        //:
+        //: 3 The hashes of the same key under seeds differing in one bit are
+        //:   distinct.
+        //
+        // Plan:
+        //: 1 For each of a set of key lengths, flip each bit of 2000 random
+        //:   keys and verify that the proportion of flips of each bit of the
+        //:   output is within 6 standard deviations of 1/2, the standard
+        //:   deviation being computed from the number of distinct pairs of
+        //:   keys (e.g., 0.011 for 2000 pairs, and 0.044 for the 128 pairs
+        //:   of 1-byte keys differing in a given bit). (C-1)
+        //:
+        //: 2 Hash all the keys of 8 and 32 bytes having at most two bits set
+        //:   and verify that there is no collision of the 64-bit hashes, and
+        //:   that the number of collisions of the lower 32 bits is small (the
+        //:   expected number is about 0.13). (C-2)
+        //:
+        //: 3 For each bit of the seed, hash a fixed key with the seed having
+        //:   only that bit set, and verify that all the hashes, and the hash
+        //:   with a zero seed, are distinct. (C-3)
+        //
+        // Testing:
+        //   HASH QUALITY
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nHASH QUALITY"
+                            "\n============\n");
+
+        if (verbose) printf("Avalanche. (C-1)\n");
+        {
+            static const int LENGTHS[] = {
+                1, 2, 3, 4, 7, 8, 12, 16, 17, 31, 32, 48, 49, 64, 100
+            };
+            const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+            for (int i = 0; i < NUM_LENGTHS; ++i) {
+                const int    LENGTH    = LENGTHS[i];
+                const int    NUM_PAIRS = 1 == LENGTH ? 128 : 2000;
+                const double MAX_BIAS  = 6 * 0.5 / sqrt(double(NUM_PAIRS));
+                const double BIAS      = worstAvalancheBias(LENGTH, 2000, i);
+
+                if (veryVerbose) { P_(LENGTH) P_(BIAS) P(MAX_BIAS) }
+
+                ASSERTV(LENGTH, BIAS, MAX_BIAS, BIAS < MAX_BIAS);
+            }
+        }
+
+        if (verbose) printf("Sparse keys. (C-2)\n");
+        {
+            static const int LENGTHS[] = { 8, 32 };
+            const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+            for (int i = 0; i < NUM_LENGTHS; ++i) {
+                const int LENGTH   = LENGTHS[i];
+                const int NUM_BITS = LENGTH * 8;
+                const int NUM_KEYS = 1 + NUM_BITS + NUM_BITS * (NUM_BITS - 1)
+                                                                          / 2;
+
+                Uint64        *hashes = static_cast<Uint64 *>(
+                                         malloc(NUM_KEYS * sizeof(Uint64)));
+                unsigned char  key[32];
+                int            numKeys = 0;
+
+                memset(key, 0, sizeof key);
+                hashes[numKeys++] = hashOnce(key, LENGTH);
+
+                for (int b1 = 0; b1 < NUM_BITS; ++b1) {
+                    key[b1 / 8] ^= static_cast<unsigned char>(1 << (b1 % 8));
+                    hashes[numKeys++] = hashOnce(key, LENGTH);
+
+                    for (int b2 = b1 + 1; b2 < NUM_BITS; ++b2) {
+                        key[b2 / 8] ^=
+                                    static_cast<unsigned char>(1 << (b2 % 8));
+                        hashes[numKeys++] = hashOnce(key, LENGTH);
+                        key[b2 / 8] ^=
+                                    static_cast<unsigned char>(1 << (b2 % 8));
+                    }
+                    key[b1 / 8] ^= static_cast<unsigned char>(1 << (b1 % 8));
+                }
+                ASSERTV(LENGTH, numKeys, NUM_KEYS == numKeys);
+
+                const int NUM_FULL = countDuplicates(hashes,
+                                                     numKeys,
+                                                     ~0ULL);
+                const int NUM_LOW  = countDuplicates(hashes,
+                                                     numKeys,
+                                                     0xffffffffULL);
+
+                if (veryVerbose) { P_(LENGTH) P_(NUM_FULL) P(NUM_LOW) }
+
+                ASSERTV(LENGTH, NUM_FULL, 0 == NUM_FULL);
+                ASSERTV(LENGTH, NUM_LOW,  3 >= NUM_LOW);
+
+                free(hashes);
+            }
+        }
+
+        if (verbose) printf("Seed sensitivity. (C-3)\n");
+        {
+            enum { k_NUM_BITS = Obj::k_SEED_LENGTH * 8 };
+
+            const char *KEY = "seed sensitivity";
+
+            Uint64 hashes[k_NUM_BITS + 1];
+            char   seed[Obj::k_SEED_LENGTH];
+
+            memset(seed, 0, sizeof seed);
+            for (int bit = 0; bit < k_NUM_BITS; ++bit) {
+                seed[bit / 8] = static_cast<char>(1 << (bit % 8));
+
+                Obj algorithm(seed);
+                algorithm(KEY, strlen(KEY));
+                hashes[bit] = algorithm.computeHash();
+
+                seed[bit / 8] = 0;
+            }
+            hashes[k_NUM_BITS] = hashOnce(KEY, strlen(KEY));
+
+            ASSERT(0 == countDuplicates(hashes, k_NUM_BITS + 1, ~0ULL));
+        }
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // SEGMENTATION INDEPENDENCE
+        //   Verify that the hash of a sequence of bytes does not depend on how
+        //   it is split across calls to 'operator()', including splits on
+        //   either side of the boundaries of the internal blocks.
+        //
+        // Concerns:
+        //: 1 The hash of a sequence of bytes supplied in two pieces is the
+        //:   same as the hash of the sequence supplied at once, for every
+        //:   split point, and for lengths up to several blocks.
+        //:
+        //: 2 The hash of a sequence of bytes supplied in many pieces of random
+        //:   lengths is the same as the hash of the sequence supplied at once.
+        //:
+        //: 3 The hashes of sequences of different lengths are distinct, even
+        //:   if the sequences are zero bytes.
+        //
+        // Plan:
+        //: 1 For each length up to 4 blocks and a few bytes, and each split
+        //:   point, hash a random sequence in two pieces and compare with the
+        //:   hash of the sequence supplied at once. (C-1)
+        //:
+        //: 2 For long random sequences, hash them in pieces of random lengths
+        //:   and compare with the hash of the sequence supplied at once. (C-2)
+        //:
+        //: 3 Hash sequences of 0 to 200 zero bytes and verify that the hashes
+        //:   are distinct. (C-3)
+        //
+        // Testing:
+        //   SEGMENTATION INDEPENDENCE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nSEGMENTATION INDEPENDENCE"
+                            "\n=========================\n");
+
+        enum { k_MAX_LENGTH = 4 * 48 + 8 };
+
+        Uint64        state = 0;
+        unsigned char data[4096];
+
+        fillRandom(data, sizeof data, &state);
+
+        if (verbose) printf("Two pieces. (C-1)\n");
+        {
+            for (int length = 0; length <= k_MAX_LENGTH; ++length) {
+                const Uint64 EXP = hashOnce(data, length);
+
+                for (int split = 0; split <= length; ++split) {
+                    Obj algorithm;
+                    algorithm(data, split);
+                    algorithm(data + split, length - split);
+
+                    ASSERTV(length, split, EXP == algorithm.computeHash());
+                }
+            }
+        }
+
+        if (verbose) printf("Random pieces. (C-2)\n");
+        {
+            for (int i = 0; i < 100; ++i) {
+                const size_t LENGTH = static_cast<size_t>(
+                                            nextRandom(&state) % sizeof data);
+                const Uint64 EXP    = hashOnce(data, LENGTH);
+
+                Obj    algorithm;
+                size_t offset = 0;
+                while (offset < LENGTH) {
+                    size_t numBytes = static_cast<size_t>(
+                                                 nextRandom(&state) % 120);
+                    if (numBytes > LENGTH - offset) {
+                        numBytes = LENGTH - offset;
+                    }
+                    algorithm(data + offset, numBytes);
+                    offset += numBytes;
+                }
+
+                ASSERTV(i, LENGTH, EXP == algorithm.computeHash());
+            }
+        }
+
+        if (verbose) printf("Distinct lengths. (C-3)\n");
+        {
+            enum { k_NUM_LENGTHS = 201 };
+
+            unsigned char zeros[k_NUM_LENGTHS];
+            Uint64        hashes[k_NUM_LENGTHS];
+
+            memset(zeros, 0, sizeof zeros);
+            for (int length = 0; length < k_NUM_LENGTHS; ++length) {
+                hashes[length] = hashOnce(zeros, length);
+            }
+
+            ASSERT(0 == countDuplicates(hashes, k_NUM_LENGTHS, ~0ULL));
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING BDE TYPE TRAITS
+        //   The class is bitwise movable and should have a trait that
+        //   indicates that.
+        //
+        // Concerns:
+        //: 1 The class is marked as 'IsBitwiseMoveable'.
+        //
+        // Plan:
+        //: 1 ASSERT the presence of the trait using the 'bslmf::IsBitwise'
+        //:   metafunction. (C-1)
+        //
+        // Testing:
+        //   Trait IsBitwiseMoveable
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING BDE TYPE TRAITS"
+                            "\n=======================\n");
+
+        if (verbose) printf("ASSERT the presence of the trait using the"
+                            " 'bslmf::IsBitwiseMoveable' metafunction."
+                            " (C-1)\n");
+        {
+            ASSERT(bslmf::IsBitwiseMoveable<WyHashAlgorithm>::value);
+        }
+
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING 'k_SEED_LENGTH'
+        //   The class is a seeded algorithm and should expose a
+        //   'k_SEED_LENGTH' enum.
+        //
+        // Concerns:
+        //: 1 'k_SEED_LENGTH' is publicly accessible.
+        //:
+        //: 2 'k_SEED_LENGTH' has the correct value.
+        //
+        // Plan:
+        //: 1 Access 'k_SEED_LENGTH' and ASSERT it is equal to the expected
+        //:   value. (C-1,2)
+        //
+        // Testing:
+        //   enum { k_SEED_LENGTH = 8 };
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'k_SEED_LENGTH'"
+                            "\n=======================\n");
+
+        if (verbose) printf("Access 'k_SEED_LENGTH' and ASSERT it is equal to"
+                            " the expected value. (C-1,2)\n");
+        {
+            ASSERT(8 == WyHashAlgorithm::k_SEED_LENGTH);
+        }
+
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'result_type' TYPEDEF
+        //   Verify that the class offers the result type that it will return.
+        //
+        // Concerns:
+        //: 1 The typedef 'result_type' is publicly accessible and an alias for
+        //:   'bsls::Types::Uint64'.
+        //:
+        //: 2 'computeHash()' returns 'result_type'
+        //
+        // Plan:
+        //: 1 ASSERT the typedef is accessible and is the correct type using
+        //:   'bslmf::IsSame'. (C-1)
+        //:
+        //: 2 Declare the expected signature of 'computeHash()' and then
+        //:   assign to it.  If it compiles, the test passes. (C-2)
+        //
+        // Testing:
+        //   typedef bsls::Types::Uint64 result_type;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'result_type' TYPEDEF"
+                            "\n=============================\n");
+
+        if (verbose) printf("ASSERT the typedef is accessible and is the"
+                            " correct type using 'bslmf::IsSame'. (C-1)\n");
+        {
+            ASSERT((bslmf::IsSame<bsls::Types::Uint64,
+                                        WyHashAlgorithm::result_type>::VALUE));
+        }
+
+        if (verbose) printf("Declare the expected signature of 'computeHash()'"
+                            " and then assign to it.  If it compiles, the test"
+                            " passes. (C-2)\n");
+        {
+            Obj::result_type (Obj::*expectedSignature) ();
+
+            (void)(expectedSignature = &Obj::computeHash);
+        }
+
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'operator()' AND 'computeHash()'
+        //   Verify the class provides an overload for the function call
+        //   operator that can be called with some bytes and a length.  Verify
+        //   that calling 'operator()' will permute the algorithm's internal
+        //   state as specified by the algorithm.  Verify that 'computeHash()'
+        //   returns the final value specified by the algorithm.
+        //
+        // Concerns:
+        //: 1 The function call operator is callable.
+        //:
+        //: 2 Given the same bytes, the function call operator will permute the
+        //:   internal state of the algorithm in the same way, regardless of
+        //:   whether the bytes are passed in all at once or in pieces.
+        //:
+        //: 3 Byte sequences passed in to 'operator()' with a length of 0 will
+        //:   not contribute to the final hash.
+        //:
+        //: 4 'computeHash()' exists and returns the appropriate value
+        //:   according to the algorithm.
+        //:
+        //: 5 'operator()' does a BSLS_ASSERT for null pointers and non-zero
+        //:   length, and not for null pointers and zero length.
+        //
+        // Plan:
+        //: 1 Insert various lengths of c-strings into the algorithm both all
+        //:   at once and char by char using 'operator()'.  Assert that the
+        //:   algorithm produces the same result in both cases. (C-1,2)
+        //:
+        //: 2 Hash c-strings all at once and with multiple calls to
+        //:   'operator()' with length 0.  Assert that both methods of hashing
+        //:   c-strings produce the same values. (C-3)
+        //:
+        //: 3 Check the output of 'computeHash()' against the expected results
+        //:   from a known good version of the algorithm. (C-4)
+        //:
+        //: 4 Call 'operator()' with a null pointer. (C-5)
+        //
+        // Testing:
+        //   void operator()(const void *data, size_t numBytes);
+        //   result_type computeHash();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'operator()' AND 'computeHash()'"
+                            "\n========================================\n");
+
+        static const struct {
+            int                  d_line;
+            const char           d_value [21];
+            bsls::Types::Uint64  d_expectedHash;
+        } DATA[] = {
+         {  L_,                      "", 10602188539874428322ULL,},
+         {  L_,                     "1",  6089950790521452057ULL,},
+         {  L_,                    "12", 11415413169853883921ULL,},
+         {  L_,                   "123",  2231340098225782732ULL,},
+         {  L_,                  "1234",  9479618551612963370ULL,},
+         {  L_,                 "12345", 16250504964929829867ULL,},
+         {  L_,                "123456",  8862334128322694281ULL,},
+         {  L_,               "1234567",  4302668659090657040ULL,},
+         {  L_,              "12345678", 16884480881891038673ULL,},
+         {  L_,             "123456789",  9538011394315986228ULL,},
+         {  L_,            "1234567890", 14179359685721273011ULL,},
+         {  L_,           "12345678901", 14433514146029026093ULL,},
+         {  L_,          "123456789012", 16966810603020175516ULL,},
+         {  L_,         "1234567890123", 17035561255675570052ULL,},
+         {  L_,        "12345678901234",  3843878481517910140ULL,},
+         {  L_,       "123456789012345",  2046797755189214434ULL,},
+         {  L_,      "1234567890123456",   907035178663842108ULL,},
+         {  L_,     "12345678901234567", 18192345620073581257ULL,},
+         {  L_,    "123456789012345678", 10867889578446987524ULL,},
+         {  L_,   "1234567890123456789", 12410676863811293513ULL,},
+         {  L_,  "12345678901234567890", 17014185259216636145ULL,},
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        if (verbose) printf("Insert various lengths of c-strings into the"
+                            " algorithm both all at once and char by char"
+                            " using 'operator()'.  Assert that the algorithm"
+                            " produces the same result in both cases. (C-1,2)"
+                            "\n");
+        {
+            for (int i = 0; i != NUM_DATA; ++i) {
+                const int   LINE  = DATA[i].d_line;
+                const char *VALUE = DATA[i].d_value;
+
+                if (veryVerbose) printf("Hashing: %s\n", VALUE);
+
+                Obj contiguousHash(genericSeed);
+                Obj dispirateHash(genericSeed);
+
+                contiguousHash(VALUE, strlen(VALUE));
+                for (unsigned int j = 0; j < strlen(VALUE); ++j){
+                    if (veryVeryVerbose) printf("Hashing by char: %c\n",
+                                                                     VALUE[j]);
+                    dispirateHash(&VALUE[j], sizeof(char));
+                }
+
+                LOOP_ASSERT(LINE, contiguousHash.computeHash() ==
+                                                  dispirateHash.computeHash());
+            }
+        }
+
+        if (verbose) printf("Hash c-strings all at once and with multiple"
+                            " calls to 'operator()' with length 0.  Assert"
+                            " that both methods of hashing c-strings produce"
+                            " the same values. (C-3)\n");
+        {
+            for (int i = 0; i != NUM_DATA; ++i) {
+                const int   LINE  = DATA[i].d_line;
+                const char *VALUE = DATA[i].d_value;
+
+                if (veryVerbose) printf("Hashing: %s\n", VALUE);
+
+                Obj contiguousHash(genericSeed);
+                Obj dispirateHash(genericSeed);
+
+                contiguousHash(VALUE, strlen(VALUE));
+                for (unsigned int j = 0; j < strlen(VALUE); ++j){
+                    if (veryVeryVerbose) printf("Hashing by char: %c\n",
+                                                                     VALUE[j]);
+                    dispirateHash(&VALUE[j], sizeof(char));
+                    dispirateHash(VALUE, 0);
+                }
+
+                LOOP_ASSERT(LINE, contiguousHash.computeHash() ==
+                                                  dispirateHash.computeHash());
+            }
+        }
+
+        if (verbose) printf("Check the output of 'computeHash()' against the"
+                            " expected results from a known good version of"
+                            " the algorithm. (C-4)\n");
+        {
+            for (int i = 0; i != NUM_DATA; ++i) {
+                const int                 LINE  = DATA[i].d_line;
+                const char               *VALUE = DATA[i].d_value;
+                const bsls::Types::Uint64 HASH  = DATA[i].d_expectedHash;
+
+                Obj hash(genericSeed);
+                hash(VALUE, strlen(VALUE));
+                bsls::Types::Uint64  hashResult = hash.computeHash();
+
+                if (veryVerbose) printf("Hashing: %s, Expecting: %llu,"
+                                        " Generated: %llu\n",
+                                        VALUE,
+                                        HASH,
+                                        hashResult);
+
+                LOOP_ASSERT(LINE, hashResult == HASH);
+            }
+        }
+
+        if (verbose) printf("Call 'operator()' with null pointers. (C-5)\n");
+        {
+            const char data[5] = {'a', 'b', 'c', 'd', 'e'};
+
+            bsls::AssertTestHandlerGuard guard;
+
+            ASSERT_FAIL(Obj(genericSeed).operator()(   0, 5));
+            ASSERT_PASS(Obj(genericSeed).operator()(   0, 0));
+            ASSERT_PASS(Obj(genericSeed).operator()(data, 5));
+        }
+
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING CREATORS
+        //   Ensure that the default and the parameterized constructors, and
+        //   the implicit destructor, are publicly callable.
+        //
+        // Concerns:
+        //: 1 Objects can be created using the default constructor.
+        //:
+        //: 2 Objects can be created using the parameterized constructor.
+        //:
+        //: 3 Objects can be destroyed.
+        //:
+        //: 4 A default-constructed object behaves as one constructed with a
+        //:   seed whose bytes are all 0, and objects constructed with
+        //:   distinct seeds produce distinct hashes.
+        //:
+        //: 5 The parameterized constructor does a BSLS_ASSERT for null
+        //:   pointers.
+        //
+        // Plan:
+        //: 1 Call the default and the parameterized constructors and allow
+        //:   the objects to leave scope to be destroyed. (C-1..3)
+        //:
+        //: 2 Hash the same value with a default-constructed object, and with
+        //:   objects constructed with a zero seed and a non-zero seed, and
+        //:   compare the results. (C-4)
+        //:
+        //: 3 Call the parameterized constructor with a null pointer. (C-5)
+        //
+        // Testing:
+        //   WyHashAlgorithm();
+        //   explicit WyHashAlgorithm(const char *seed);
+        //   ~WyHashAlgorithm();
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            printf("\nTESTING CREATORS"
+                   "\n================\n");
+
+        if (verbose) printf("Call the default and the parameterized"
+                            " constructors and allow the objects to leave"
+                            " scope to be destroyed. (C-1..3)\n");
+        {
+            Obj alg1;
+            Obj alg2(genericSeed);
+        }
+
+        if (verbose) printf("Compare the hashes produced with various"
+                            " seeds. (C-4)\n");
+        {
+            const char  SEED[Obj::k_SEED_LENGTH] = {
+                                              1, 2, 3, 4, 5, 6, 7, 8 };
+            const char *VALUE = "Hello World";
+
+            Obj alg1;
+            Obj alg2(genericSeed);
+            Obj alg3(SEED);
+
+            alg1(VALUE, strlen(VALUE));
+            alg2(VALUE, strlen(VALUE));
+            alg3(VALUE, strlen(VALUE));
+
+            const Uint64 HASH1 = alg1.computeHash();
+            const Uint64 HASH2 = alg2.computeHash();
+            const Uint64 HASH3 = alg3.computeHash();
+
+            ASSERTV(HASH1, HASH2, HASH1 == HASH2);
+            ASSERTV(HASH1, HASH3, HASH1 != HASH3);
+        }
+
+        if (verbose) printf("Call the parameterized constructor with a null"
+                            " pointer. (C-5)\n");
+        {
+            bsls::AssertTestHandlerGuard guard;
+
+            ASSERT_FAIL(Obj dummy(0));
+            ASSERT_PASS(Obj dummy(genericSeed));
+        }
+
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create an instance of 'bslh::WyHashAlgorithm'. (C-1)
+        //:
+        //: 2 Verify different hashes are produced for different c-strings.
+        //:   (C-1)
+        //:
+        //: 3 Verify the same hashes are produced for the same c-strings. (C-1)
+        //:
+        //: 4 Verify different hashes are produced for different 'int's. (C-1)
+        //:
+        //: 5 Verify the same hashes are produced for the same 'int's. (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        if (verbose) printf("Instantiate 'bslh::WyHashAlgorithm'\n");
+        {
+            WyHashAlgorithm hashAlg;
+        }
+
+        if (verbose) printf("Verify different hashes are produced for"
+                            " different c-strings.\n");
+        {
+            WyHashAlgorithm hashAlg1;
+            WyHashAlgorithm hashAlg2;
+            const char * str1 = "Hello World";
+            const char * str2 = "Goodbye World";
+            hashAlg1(str1, strlen(str1));
+            hashAlg2(str2, strlen(str2));
+            ASSERT(hashAlg1.computeHash() != hashAlg2.computeHash());
+        }
+
+        if (verbose) printf("Verify the same hashes are produced for the same"
+                            " c-strings.\n");
+        {
+            WyHashAlgorithm hashAlg1;
+            WyHashAlgorithm hashAlg2;
+            const char * str1 = "Hello World";
+            const char * str2 = "Hello World";
+            hashAlg1(str1, strlen(str1));
+            hashAlg2(str2, strlen(str2));
+            ASSERT(hashAlg1.computeHash() == hashAlg2.computeHash());
+        }
+
+        if (verbose) printf("Verify different hashes are produced for"
+                            " different ints.\n");
+        {
+            WyHashAlgorithm hashAlg1;
+            WyHashAlgorithm hashAlg2;
+            int int1 = 123456;
+            int int2 = 654321;
+            hashAlg1(&int1, sizeof(int));
+            hashAlg2(&int2, sizeof(int));
+            ASSERT(hashAlg1.computeHash() != hashAlg2.computeHash());
+        }
+
+        if (verbose) printf("Verify the same hashes are produced for the same"
+                            " ints.\n");
+        {
+            WyHashAlgorithm hashAlg1;
+            WyHashAlgorithm hashAlg2;
+            int int1 = 123456;
+            int int2 = 123456;
+            hashAlg1(&int1, sizeof(int));
+            hashAlg2(&int2, sizeof(int));
+            ASSERT(hashAlg1.computeHash() == hashAlg2.computeHash());
+        }
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: HASHING KEYS OF VARIOUS LENGTHS
+        //   Compare the throughput of this algorithm with that of the other
+        //   'bslh' algorithms on keys of the lengths typical of hash tables.
+        //
+        // Concerns:
+        //: 1 The algorithm is faster than 'bslh::SipHashAlgorithm' and the
+        //:   SpookyHash algorithm on short keys.
+        //
+        // Plan:
+        //: 1 For each of several distributions of key lengths (fixed, and
+        //:   uniform between 1 and 32 bytes), hash a large number of keys
+        //:   with each algorithm and report the time per key.  An optional
+        //:   second argument specifies the number of keys per distribution.
+        //:   (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: HASHING KEYS OF VARIOUS LENGTHS
+        // --------------------------------------------------------------------
+
+        if (verbose) printf(
+                       "\nPERFORMANCE: HASHING KEYS OF VARIOUS LENGTHS"
+                       "\n============================================\n");
+
+        const int NUM_KEYS = argc > 2 ? atoi(argv[2]) : 1000000;
+
+        enum { k_NUM_LENGTHS = 1024 };
+
+        static const struct {
+            const char *d_name;     // name of the distribution
+            int         d_minimum;  // minimum key length
+            int         d_maximum;  // maximum key length
+        } DISTRIBUTIONS[] = {
+            { "8",       8,    8 },
+            { "16",     16,   16 },
+            { "32",     32,   32 },
+            { "1..32",   1,   32 },
+            { "64",     64,   64 },
+            { "256",   256,  256 },
+            { "4096", 4096, 4096 },
+        };
+        const int NUM_DISTRIBUTIONS = sizeof DISTRIBUTIONS
+                                                     / sizeof *DISTRIBUTIONS;
+
+        static unsigned char data[4096 + k_NUM_LENGTHS];
+        int                  lengths[k_NUM_LENGTHS];
+        Uint64               state = 0;
+
+        fillRandom(data, sizeof data, &state);
+
+        printf("%-8s %12s %12s %12s\n", "length", "wyhash", "siphash",
+                                                                    "spooky");
+
+        for (int d = 0; d < NUM_DISTRIBUTIONS; ++d) {
+            const int MIN = DISTRIBUTIONS[d].d_minimum;
+            const int MAX = DISTRIBUTIONS[d].d_maximum;
+
+            for (int i = 0; i < k_NUM_LENGTHS; ++i) {
+                lengths[i] = MIN + static_cast<int>(
+                                      nextRandom(&state) % (MAX - MIN + 1));
+            }
+
+            const int NUM_ITERATIONS = MAX > 64 ? NUM_KEYS * 64 / MAX
+                                                : NUM_KEYS;
+
+            double times[3];
+            Uint64 sink = 0;
+
+            for (int a = 0; a < 3; ++a) {
+                bsls::Stopwatch timer;
+                timer.start();
+
+                for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                    const int            INDEX  = i % k_NUM_LENGTHS;
+                    const unsigned char *KEY    = data + INDEX;
+                    const size_t         LENGTH = lengths[INDEX];
+
+                    switch (a) {
+                      case 0: {
+                        WyHashAlgorithm algorithm;
+                        algorithm(KEY, LENGTH);
+                        sink += algorithm.computeHash();
+                      } break;
+                      case 1: {
+                        SipHashAlgorithm algorithm(genericSeed);
+                        algorithm(KEY, LENGTH);
+                        sink += algorithm.computeHash();
+                      } break;
+                      default: {
+                        sink += SpookyHashAlgorithmImp::hash64(KEY,
+                                                               LENGTH,
+                                                               0);
+                      } break;
+                    }
+                }
+
+                timer.stop();
+                times[a] = timer.accumulatedWallTime() * 1e9 / NUM_ITERATIONS;
+            }
+
+            printf("%-8s %9.1f ns %9.1f ns %9.1f ns\n",
+                   DISTRIBUTIONS[d].d_name,
+                   times[0],
+                   times[1],
+                   times[2]);
+
+            if (veryVerbose) { P(sink) }
+        }
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
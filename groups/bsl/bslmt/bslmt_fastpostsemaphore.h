@@ -41,6 +41,15 @@ BSLS_IDENT("$Id: $")
 // absolute offset since the epoch of this clock (which matches the epoch used
 // in 'bsls::SystemTime::now(bsls::SystemClockType::e_MONOTONIC)'.
 //
+///Wait Strategy
+///-------------
+// A 'bslmt::WaitStrategy' may be supplied at construction to have a thread
+// that finds no available resource in 'wait' or 'timedWait' spin, then yield,
+// before blocking (see 'bslmt_waitstrategy').  Spinning lowers the latency of
+// a hand-off between threads when resources are posted shortly after being
+// waited for, at the expense of CPU time.  The default strategy blocks without
+// spinning.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -254,6 +263,7 @@ BSLS_IDENT("$Id: $")
 #include <bslmt_lockguard.h>
 #include <bslmt_mutex.h>
 #include <bslmt_threadutil.h>
+#include <bslmt_waitstrategy.h>
 
 #include <bsls_atomicoperations.h>
 #include <bsls_systemclocktype.h>
@@ -321,6 +331,30 @@ class FastPostSemaphore {
         // passed to the 'timedWait' method are to be interpreted.  If
         // 'clockType' is not specified then the realtime system clock is used.
 
+    explicit
+    FastPostSemaphore(
+    const WaitStrategy&         waitStrategy,
+    bsls::SystemClockType::Enum clockType = bsls::SystemClockType::e_REALTIME);
+        // Create a 'FastPostSemaphore' object initially having a count of 0,
+        // whose waiting threads spin as indicated by the specified
+        // 'waitStrategy' before blocking.  Optionally specify a 'clockType'
+        // indicating the type of the system clock against which the
+        // 'bsls::TimeInterval' timeouts passed to the 'timedWait' method are
+        // to be interpreted.  If 'clockType' is not specified then the
+        // realtime system clock is used.
+
+    FastPostSemaphore(
+    int                         count,
+    const WaitStrategy&         waitStrategy,
+    bsls::SystemClockType::Enum clockType = bsls::SystemClockType::e_REALTIME);
+        // Create a 'FastPostSemaphore' object initially having the specified
+        // 'count', whose waiting threads spin as indicated by the specified
+        // 'waitStrategy' before blocking.  Optionally specify a 'clockType'
+        // indicating the type of the system clock against which the
+        // 'bsls::TimeInterval' timeouts passed to the 'timedWait' method are
+        // to be interpreted.  If 'clockType' is not specified then the
+        // realtime system clock is used.
+
     //! ~FastPostSemaphore() = default;
         // Destroy this object.
 
@@ -406,6 +440,9 @@ class FastPostSemaphore {
         // Return 'true' if this semaphore is wait disabled, and 'false'
         // otherwise.  Note that the semaphore is created in the "wait enabled"
         // state.
+
+    const WaitStrategy& waitStrategy() const;
+        // Return a 'const' reference to the wait strategy of this semaphore.
 };
 
 // ============================================================================
@@ -430,6 +467,21 @@ FastPostSemaphore::FastPostSemaphore(int                         count,
 {
 }
 
+inline
+FastPostSemaphore::FastPostSemaphore(const WaitStrategy&         waitStrategy,
+                                     bsls::SystemClockType::Enum clockType)
+: d_impl(waitStrategy, clockType)
+{
+}
+
+inline
+FastPostSemaphore::FastPostSemaphore(int                         count,
+                                     const WaitStrategy&         waitStrategy,
+                                     bsls::SystemClockType::Enum clockType)
+: d_impl(count, waitStrategy, clockType)
+{
+}
+
 // MANIPULATORS
 inline
 void FastPostSemaphore::disable()
@@ -504,6 +556,12 @@ bool FastPostSemaphore::isDisabled() const
     return d_impl.isDisabled();
 }
 
+inline
+const WaitStrategy& FastPostSemaphore::waitStrategy() const
+{
+    return d_impl.waitStrategy();
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
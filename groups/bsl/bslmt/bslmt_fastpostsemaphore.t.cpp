@@ -26,6 +26,8 @@ using namespace bsl;
 // CREATORS
 // [ 2] FastPostSemaphore(clockType = e_REALTIME);
 // [ 2] FastPostSemaphore(int count, clockType = e_REALTIME);
+// [ 9] FastPostSemaphore(strategy, clockType = e_REALTIME);
+// [ 9] FastPostSemaphore(count, strategy, clockType = e_REALTIME);
 //
 // MANIPULATORS
 // [ 4] void enable();
@@ -42,6 +44,7 @@ using namespace bsl;
 // [ 4] int getDisabledState() const;
 // [ 6] int getValue() const;
 // [ 4] bool isDisabled() const;
+// [ 9] const WaitStrategy& waitStrategy() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 8] USAGE EXAMPLE
@@ -291,6 +294,66 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 9: {
+        // --------------------------------------------------------------------
+        // TESTING WAIT STRATEGY
+        //
+        // Concerns:
+        //: 1 The constructors taking a wait strategy forward the count, the
+        //:   strategy, and the clock type to the implementation.
+        //:
+        //: 2 'waitStrategy' forwards to the implementation.
+        //
+        // Plan:
+        //: 1 Create objects with the constructors and verify 'getValue',
+        //:   'waitStrategy', and the result of 'timedWait' with an expired
+        //:   timeout of the indicated clock.  (C-1..2)
+        //
+        // Testing:
+        //   FastPostSemaphore(strategy, clockType = e_REALTIME);
+        //   FastPostSemaphore(count, strategy, clockType = e_REALTIME);
+        //   const WaitStrategy& waitStrategy() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING WAIT STRATEGY" << endl
+                          << "=====================" << endl;
+
+        const bslmt::WaitStrategy STRATEGY(1000, 2, true);
+
+        {
+            Obj mX;
+
+            ASSERT(bslmt::WaitStrategy() == mX.waitStrategy());
+        }
+        {
+            Obj mX(STRATEGY);
+
+            ASSERT(STRATEGY == mX.waitStrategy());
+            ASSERT(0        == mX.getValue());
+            ASSERT(Obj::e_TIMED_OUT ==
+                          mX.timedWait(bsls::SystemTime::nowRealtimeClock()));
+        }
+        {
+            Obj mX(STRATEGY, bsls::SystemClockType::e_MONOTONIC);
+
+            ASSERT(STRATEGY == mX.waitStrategy());
+            ASSERT(Obj::e_TIMED_OUT ==
+                         mX.timedWait(bsls::SystemTime::nowMonotonicClock()));
+        }
+        {
+            Obj mX(2, STRATEGY, bsls::SystemClockType::e_MONOTONIC);
+
+            ASSERT(STRATEGY == mX.waitStrategy());
+            ASSERT(2        == mX.getValue());
+
+            mX.wait();
+            mX.wait();
+
+            ASSERT(Obj::e_TIMED_OUT ==
+                         mX.timedWait(bsls::SystemTime::nowMonotonicClock()));
+        }
+      } break;
       case 8: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
@@ -42,6 +42,15 @@ BSLS_IDENT("$Id: $")
 // absolute offset since the epoch of this clock (which matches the epoch used
 // in 'bsls::SystemTime::now(bsls::SystemClockType::e_MONOTONIC)'.
 //
+///Wait Strategy
+///-------------
+// A 'bslmt::WaitStrategy' may be supplied at construction to have a thread
+// that finds no available resource in 'wait' or 'timedWait' spin, then yield,
+// re-examining the count of the semaphore, before blocking on the condition
+// variable (see 'bslmt_waitstrategy').  A thread that obtains a resource while
+// spinning avoids the cost of blocking and of being signalled.  The default
+// strategy blocks without spinning.
+//
 ///Usage
 ///-----
 // There is no usage example for this component since it is not meant for
@@ -50,6 +59,7 @@ BSLS_IDENT("$Id: $")
 #include <bslscm_version.h>
 
 #include <bslmt_lockguard.h>
+#include <bslmt_waitstrategy.h>
 
 #include <bsls_systemclocktype.h>
 #include <bsls_timeinterval.h>
@@ -74,14 +84,22 @@ class FastPostSemaphoreImpl {
     typedef          bsls::Types::Int64            Int64;
 
     // DATA
-    AtomicInt64 d_state;          // bit pattern representing the state of the
-                                  // semaphore (see *Implementation* *Note*)
+    AtomicInt64  d_state;          // bit pattern representing the state of
+                                   // the semaphore (see *Implementation*
+                                   // *Note*)
+
+    MUTEX        d_waitMutex;      // mutex used with 'd_waitCondition', does
+                                   // not protect any values
+
+    CONDITION    d_waitCondition;  // condition variable for
+                                   // blocking/signalling threads in the wait
+                                   // methods
 
-    MUTEX       d_waitMutex;      // mutex used with 'd_waitCondition', does
-                                  // not protect any values
+    WaitStrategy d_waitStrategy;   // how a thread spins before blocking
 
-    CONDITION   d_waitCondition;  // condition variable for blocking/signalling
-                                  // threads in the wait methods
+    AtomicInt64  d_spinEstimate;   // estimated number of spins before a
+                                   // resource is available (used only if
+                                   // 'd_waitStrategy.isAdaptive()')
 
     // PRIVATE CLASS METHODS
     static bsls::Types::Int64 disabledGeneration(Int64 state);
@@ -113,6 +131,13 @@ class FastPostSemaphoreImpl {
         // wait operations (without further 'post' invocations).
 
     // PRIVATE MANIPULATORS
+    Int64 spinWait(const Int64 disabledGen);
+        // Spin, then yield, as indicated by the wait strategy of this
+        // semaphore, until the state of this semaphore indicates that the
+        // calling thread need not block, or the disabled generation of this
+        // semaphore differs from the specified 'disabledGen'; return the last
+        // loaded state of this semaphore.
+
     int timedWaitSlowPath(const bsls::TimeInterval& timeout,
                           const bsls::Types::Int64  initialState);
         // If this semaphore becomes disabled as detected from the disabled
@@ -193,6 +218,30 @@ class FastPostSemaphoreImpl {
         // timeouts passed to the 'timedWait' method are to be interpreted.  If
         // 'clockType' is not specified then the realtime system clock is used.
 
+    explicit
+    FastPostSemaphoreImpl(
+    const WaitStrategy&         waitStrategy,
+    bsls::SystemClockType::Enum clockType = bsls::SystemClockType::e_REALTIME);
+        // Create a 'FastPostSemaphoreImpl' object initially having a count of
+        // 0, whose waiting threads spin as indicated by the specified
+        // 'waitStrategy' before blocking.  Optionally specify a 'clockType'
+        // indicating the type of the system clock against which the
+        // 'bsls::TimeInterval' timeouts passed to the 'timedWait' method are
+        // to be interpreted.  If 'clockType' is not specified then the
+        // realtime system clock is used.
+
+    FastPostSemaphoreImpl(
+    int                         count,
+    const WaitStrategy&         waitStrategy,
+    bsls::SystemClockType::Enum clockType = bsls::SystemClockType::e_REALTIME);
+        // Create a 'FastPostSemaphoreImpl' object initially having the
+        // specified 'count', whose waiting threads spin as indicated by the
+        // specified 'waitStrategy' before blocking.  Optionally specify a
+        // 'clockType' indicating the type of the system clock against which
+        // the 'bsls::TimeInterval' timeouts passed to the 'timedWait' method
+        // are to be interpreted.  If 'clockType' is not specified then the
+        // realtime system clock is used.
+
     // ~FastPostSemaphoreImpl() = default;
         // Destroy this object.
 
@@ -277,6 +326,9 @@ class FastPostSemaphoreImpl {
         // Return 'true' if this semaphore is wait disabled, and 'false'
         // otherwise.  Note that the semaphore is created in the "wait enabled"
         // state.
+
+    const WaitStrategy& waitStrategy() const;
+        // Return a 'const' reference to the wait strategy of this semaphore.
 };
 
 // ============================================================================
@@ -339,6 +391,64 @@ bool FastPostSemaphoreImpl<ATOMIC_OP, MUTEX, CONDITION, THREADUTIL>
 }
 
 // PRIVATE MANIPULATORS
+template <class ATOMIC_OP, class MUTEX, class CONDITION, class THREADUTIL>
+bsls::Types::Int64 FastPostSemaphoreImpl<ATOMIC_OP,
+                                         MUTEX,
+                                         CONDITION,
+                                         THREADUTIL>
+                                           ::spinWait(const Int64 disabledGen)
+{
+    Int64 estimate = 0;
+
+    if (d_waitStrategy.isAdaptive()) {
+        // Note that concurrent updates may leave the estimate slightly out of
+        // range.
+
+        estimate = ATOMIC_OP::getInt64Acquire(&d_spinEstimate);
+        if (estimate < 0) {
+            estimate = 0;
+        }
+        else if (estimate > d_waitStrategy.spinCount()) {
+            estimate = d_waitStrategy.spinCount();
+        }
+    }
+
+    const int limit = d_waitStrategy.spinLimit(static_cast<int>(estimate));
+
+    Int64 state    = ATOMIC_OP::getInt64Acquire(&d_state);
+    int   numSpins = 0;
+
+    while (   numSpins < limit
+           && willHaveBlockedThread(state)
+           && disabledGen == disabledGeneration(state)) {
+        WaitStrategy::pause();
+        ++numSpins;
+
+        state = ATOMIC_OP::getInt64Acquire(&d_state);
+    }
+
+    if (d_waitStrategy.isAdaptive()) {
+        const int newEstimate = WaitStrategy::updateSpinEstimate(
+                                                  static_cast<int>(estimate),
+                                                  numSpins);
+        if (newEstimate != estimate) {
+            ATOMIC_OP::addInt64AcqRel(&d_spinEstimate, newEstimate - estimate);
+        }
+    }
+
+    for (int i = 0;
+            i < d_waitStrategy.yieldCount()
+         && willHaveBlockedThread(state)
+         && disabledGen == disabledGeneration(state);
+         ++i) {
+        THREADUTIL::yield();
+
+        state = ATOMIC_OP::getInt64Acquire(&d_state);
+    }
+
+    return state;
+}
+
 template <class ATOMIC_OP, class MUTEX, class CONDITION, class THREADUTIL>
 int FastPostSemaphoreImpl<ATOMIC_OP, MUTEX, CONDITION, THREADUTIL>
                     ::timedWaitSlowPath(const bsls::TimeInterval& timeout,
@@ -348,12 +458,20 @@ int FastPostSemaphoreImpl<ATOMIC_OP, MUTEX, CONDITION, THREADUTIL>
 
     const Int64 disabledGen = disabledGeneration(initialState);
 
-    // 'state' currently indicates the thread should block, yield and retest
-    // instead
+    // 'state' currently indicates the thread should block, spin as indicated
+    // by the wait strategy, then yield and retest instead
 
-    THREADUTIL::yield();
+    Int64 state = initialState;
 
-    Int64 state = ATOMIC_OP::getInt64Acquire(&d_state);
+    if (!d_waitStrategy.isParkOnly()) {
+        state = spinWait(disabledGen);
+    }
+
+    if (willHaveBlockedThread(state)) {
+        THREADUTIL::yield();
+
+        state = ATOMIC_OP::getInt64Acquire(&d_state);
+    }
 
     if (willHaveBlockedThread(state)) {
         {
@@ -428,12 +546,20 @@ int FastPostSemaphoreImpl<ATOMIC_OP, MUTEX, CONDITION, THREADUTIL>
 
     const Int64 disabledGen = disabledGeneration(initialState);
 
-    // 'state' currently indicates the thread should block, yield and retest
-    // instead
+    // 'state' currently indicates the thread should block, spin as indicated
+    // by the wait strategy, then yield and retest instead
 
-    THREADUTIL::yield();
+    Int64 state = initialState;
 
-    Int64 state = ATOMIC_OP::getInt64Acquire(&d_state);
+    if (!d_waitStrategy.isParkOnly()) {
+        state = spinWait(disabledGen);
+    }
+
+    if (willHaveBlockedThread(state)) {
+        THREADUTIL::yield();
+
+        state = ATOMIC_OP::getInt64Acquire(&d_state);
+    }
 
     if (willHaveBlockedThread(state)) {
         {
@@ -504,8 +630,10 @@ FastPostSemaphoreImpl<ATOMIC_OP, MUTEX, CONDITION, THREADUTIL>
                  ::FastPostSemaphoreImpl(bsls::SystemClockType::Enum clockType)
 : d_waitMutex()
 , d_waitCondition(clockType)
+, d_waitStrategy()
 {
     ATOMIC_OP::initInt64(&d_state, 0);
+    ATOMIC_OP::initInt64(&d_spinEstimate, 0);
 }
 
 template <class ATOMIC_OP, class MUTEX, class CONDITION, class THREADUTIL>
@@ -515,8 +643,37 @@ FastPostSemaphoreImpl<ATOMIC_OP, MUTEX, CONDITION, THREADUTIL>
                                          bsls::SystemClockType::Enum clockType)
 : d_waitMutex()
 , d_waitCondition(clockType)
+, d_waitStrategy()
 {
     ATOMIC_OP::initInt64(&d_state, k_AVAILABLE_INC * count);
+    ATOMIC_OP::initInt64(&d_spinEstimate, 0);
+}
+
+template <class ATOMIC_OP, class MUTEX, class CONDITION, class THREADUTIL>
+inline
+FastPostSemaphoreImpl<ATOMIC_OP, MUTEX, CONDITION, THREADUTIL>
+              ::FastPostSemaphoreImpl(const WaitStrategy&         waitStrategy,
+                                      bsls::SystemClockType::Enum clockType)
+: d_waitMutex()
+, d_waitCondition(clockType)
+, d_waitStrategy(waitStrategy)
+{
+    ATOMIC_OP::initInt64(&d_state, 0);
+    ATOMIC_OP::initInt64(&d_spinEstimate, 0);
+}
+
+template <class ATOMIC_OP, class MUTEX, class CONDITION, class THREADUTIL>
+inline
+FastPostSemaphoreImpl<ATOMIC_OP, MUTEX, CONDITION, THREADUTIL>
+              ::FastPostSemaphoreImpl(int                         count,
+                                      const WaitStrategy&         waitStrategy,
+                                      bsls::SystemClockType::Enum clockType)
+: d_waitMutex()
+, d_waitCondition(clockType)
+, d_waitStrategy(waitStrategy)
+{
+    ATOMIC_OP::initInt64(&d_state, k_AVAILABLE_INC * count);
+    ATOMIC_OP::initInt64(&d_spinEstimate, 0);
 }
 
 // MANIPULATORS
@@ -783,6 +940,15 @@ bool FastPostSemaphoreImpl<ATOMIC_OP, MUTEX, CONDITION, THREADUTIL>
     return isDisabled(state);
 }
 
+template <class ATOMIC_OP, class MUTEX, class CONDITION, class THREADUTIL>
+inline
+const WaitStrategy&
+FastPostSemaphoreImpl<ATOMIC_OP, MUTEX, CONDITION, THREADUTIL>
+                                                         ::waitStrategy() const
+{
+    return d_waitStrategy;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -37,6 +37,8 @@ using namespace bsl;
 // CREATORS
 // [ 2] FastPostSemaphoreImpl(clockType = e_REALTIME);
 // [ 2] FastPostSemaphoreImpl(int count, clockType = e_REALTIME);
+// [10] FastPostSemaphoreImpl(strategy, clockType = e_REALTIME);
+// [10] FastPostSemaphoreImpl(count, strategy, clockType = e_REALTIME);
 //
 // MANIPULATORS
 // [ 4] void enable();
@@ -53,10 +55,12 @@ using namespace bsl;
 // [ 4] int getDisabledState() const;
 // [ 7] int getValue() const;
 // [ 4] bool isDisabled() const;
+// [10] const WaitStrategy& waitStrategy() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 5] CONCERN: MANIPULATORS SIGNAL AS EXPECTED
 // [ 9] CONCERN: NO RACES RESULTING IN METHOD NON-COMPLETION
+// [10] CONCERN: WAITING THREADS SPIN AS INDICATED BY THE WAIT STRATEGY
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -1035,6 +1039,27 @@ extern "C" void *waitExpectSuccess(void *arg)
     return 0;
 }
 
+struct PingPongData {
+    Obj *d_ping_p;         // semaphore posted by the main thread
+    Obj *d_pong_p;         // semaphore posted by the other thread
+    int  d_numRoundTrips;  // number of round trips
+};
+
+extern "C" void *pingPong(void *arg)
+    // Wait on 'd_ping_p' and post 'd_pong_p', 'd_numRoundTrips' times, where
+    // the members are those of the 'PingPongData' object at the specified
+    // 'arg'.
+{
+    PingPongData& data = *static_cast<PingPongData *>(arg);
+
+    for (int i = 0; i < data.d_numRoundTrips; ++i) {
+        ASSERT(Obj::e_SUCCESS == data.d_ping_p->wait());
+        data.d_pong_p->post();
+    }
+
+    return 0;
+}
+
 // ============================================================================
 //                                USAGE EXAMPLE
 // ----------------------------------------------------------------------------
@@ -1064,6 +1089,142 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 10: {
+        // --------------------------------------------------------------------
+        // TESTING WAIT STRATEGY
+        //
+        // Concerns:
+        //: 1 The constructors taking a wait strategy set the initial count,
+        //:   and 'waitStrategy' returns the supplied strategy.
+        //:
+        //: 2 The default-constructed semaphore has a park-only strategy.
+        //:
+        //: 3 With every strategy, a waiting thread obtains the posted
+        //:   resources, whether it obtains them while spinning, yielding, or
+        //:   blocked.
+        //:
+        //: 4 A thread spinning in 'wait' or 'timedWait' returns 'e_DISABLED'
+        //:   when the semaphore is disabled.
+        //
+        // Plan:
+        //: 1 Create objects with the constructors and verify 'getValue' and
+        //:   'waitStrategy'.  (C-1..2)
+        //:
+        //: 2 For a set of strategies, bounce a resource between two threads
+        //:   through a pair of semaphores and verify completion.  (C-3)
+        //:
+        //: 3 Disable a semaphore, having a strategy spinning for much longer
+        //:   than the test, on which threads wait, and verify the threads
+        //:   return.  (C-4)
+        //
+        // Testing:
+        //   FastPostSemaphoreImpl(strategy, clockType = e_REALTIME);
+        //   FastPostSemaphoreImpl(count, strategy, clockType = e_REALTIME);
+        //   const WaitStrategy& waitStrategy() const;
+        //   CONCERN: WAITING THREADS SPIN AS INDICATED BY THE WAIT STRATEGY
+        // --------------------------------------------------------------------
+
+        if (verbose) {
+            cout << endl
+                 << "TESTING WAIT STRATEGY" << endl
+                 << "=====================" << endl;
+        }
+
+        const bslmt::WaitStrategy STRATEGIES[] = {
+            bslmt::WaitStrategy(),
+            bslmt::WaitStrategy(1000, 0),
+            bslmt::WaitStrategy(0, 4),
+            bslmt::WaitStrategy(1000, 4, true),
+            bslmt::WaitStrategy(4000, 0, true),
+        };
+        const int NUM_STRATEGIES = sizeof STRATEGIES / sizeof *STRATEGIES;
+
+        {
+            Obj mX;
+
+            ASSERT(mX.waitStrategy().isParkOnly());
+        }
+
+        for (int i = 0; i < NUM_STRATEGIES; ++i) {
+            const bslmt::WaitStrategy& STRATEGY = STRATEGIES[i];
+
+            {
+                Obj mX(STRATEGY);
+
+                ASSERTV(i, STRATEGY == mX.waitStrategy());
+                ASSERTV(i, 0        == mX.getValue());
+            }
+            {
+                Obj mX(3, STRATEGY, bsls::SystemClockType::e_MONOTONIC);
+
+                ASSERTV(i, STRATEGY == mX.waitStrategy());
+                ASSERTV(i, 3        == mX.getValue());
+
+                ASSERTV(i, 0 == mX.timedWait(
+                                   bsls::SystemTime::nowMonotonicClock()));
+                ASSERTV(i, 2 == mX.getValue());
+            }
+            {
+                Obj mPing(STRATEGY);
+                Obj mPong(STRATEGY);
+
+                PingPongData data = { &mPing, &mPong, 500 };
+
+                s_continue = 1;
+
+                bslmt::ThreadUtil::Handle watchdogHandle;
+                bslmt::ThreadUtil::create(
+                                       &watchdogHandle,
+                                       watchdog,
+                                       const_cast<char *>("wait strategy"));
+
+                bslmt::ThreadUtil::Handle handle;
+                bslmt::ThreadUtil::create(&handle, pingPong, &data);
+
+                for (int j = 0; j < data.d_numRoundTrips; ++j) {
+                    mPing.post();
+                    ASSERTV(i, j, Obj::e_SUCCESS == mPong.wait());
+                }
+
+                bslmt::ThreadUtil::join(handle);
+
+                s_continue = 0;
+
+                bslmt::ThreadUtil::join(watchdogHandle);
+
+                ASSERTV(i, 0 == mPing.getValue());
+                ASSERTV(i, 0 == mPong.getValue());
+            }
+        }
+
+        if (verbose) cout << "\nTesting 'disable' while spinning." << endl;
+        {
+            Obj mX(bslmt::WaitStrategy(1 << 30, 0));
+
+            s_continue = 1;
+
+            bslmt::ThreadUtil::Handle watchdogHandle;
+            bslmt::ThreadUtil::create(&watchdogHandle,
+                                      watchdog,
+                                      const_cast<char *>("disable spinning"));
+
+            bslmt::ThreadUtil::Handle handle1;
+            bslmt::ThreadUtil::Handle handle2;
+            bslmt::ThreadUtil::create(&handle1, waitExpectDisabled, &mX);
+            bslmt::ThreadUtil::create(&handle2, timedWaitExpectDisabled, &mX);
+
+            bslmt::ThreadUtil::microSleep(k_DECISECOND);
+
+            mX.disable();
+
+            bslmt::ThreadUtil::join(handle1);
+            bslmt::ThreadUtil::join(handle2);
+
+            s_continue = 0;
+
+            bslmt::ThreadUtil::join(watchdogHandle);
+        }
+      } break;
       case 9: {
         // --------------------------------------------------------------------
         // CONCERN: NO RACES RESULTING IN METHOD NON-COMPLETION
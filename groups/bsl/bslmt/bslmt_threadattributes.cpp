@@ -25,7 +25,8 @@ namespace BloombergLP {
 
 // CREATORS
 bslmt::ThreadAttributes::ThreadAttributes()
-: d_detachedState(e_CREATE_JOINABLE)
+: d_cpuAffinity(static_cast<bslma::Allocator *>(0))
+, d_detachedState(e_CREATE_JOINABLE)
 , d_guardSize(e_UNSET_GUARD_SIZE)
 , d_inheritScheduleFlag(true)
 , d_schedulingPolicy(e_SCHED_DEFAULT)
@@ -36,7 +37,8 @@ bslmt::ThreadAttributes::ThreadAttributes()
 }
 
 bslmt::ThreadAttributes::ThreadAttributes(bslma::Allocator *basicAllocator)
-: d_detachedState(e_CREATE_JOINABLE)
+: d_cpuAffinity(basicAllocator)
+, d_detachedState(e_CREATE_JOINABLE)
 , d_guardSize(e_UNSET_GUARD_SIZE)
 , d_inheritScheduleFlag(true)
 , d_schedulingPolicy(e_SCHED_DEFAULT)
@@ -50,7 +52,8 @@ bslmt::ThreadAttributes::ThreadAttributes(
                                 const bslmt::ThreadAttributes&  original,
                                 bslma::Allocator               *basicAllocator)
 
-: d_detachedState(original.d_detachedState)
+: d_cpuAffinity(original.d_cpuAffinity, basicAllocator)
+, d_detachedState(original.d_detachedState)
 , d_guardSize(original.d_guardSize)
 , d_inheritScheduleFlag(original.d_inheritScheduleFlag)
 , d_schedulingPolicy(original.d_schedulingPolicy)
@@ -64,6 +67,7 @@ bslmt::ThreadAttributes::ThreadAttributes(
 bslmt::ThreadAttributes& bslmt::ThreadAttributes::operator=(
                                             const bslmt::ThreadAttributes& rhs)
 {
+    d_cpuAffinity         = rhs.d_cpuAffinity;
     d_detachedState       = rhs.d_detachedState;
     d_guardSize           = rhs.d_guardSize;
     d_inheritScheduleFlag = rhs.d_inheritScheduleFlag;
@@ -79,7 +83,8 @@ bslmt::ThreadAttributes& bslmt::ThreadAttributes::operator=(
 bool bslmt::operator==(const ThreadAttributes& lhs,
                        const ThreadAttributes& rhs)
 {
-    return lhs.detachedState()      == rhs.detachedState()      &&
+    return lhs.cpuAffinity()        == rhs.cpuAffinity()        &&
+           lhs.detachedState()      == rhs.detachedState()      &&
            lhs.guardSize()          == rhs.guardSize()          &&
            lhs.inheritSchedule()    == rhs.inheritSchedule()    &&
            lhs.schedulingPolicy()   == rhs.schedulingPolicy()   &&
@@ -91,7 +96,8 @@ bool bslmt::operator==(const ThreadAttributes& lhs,
 bool bslmt::operator!=(const ThreadAttributes& lhs,
                        const ThreadAttributes& rhs)
 {
-    return lhs.detachedState()      != rhs.detachedState()      ||
+    return lhs.cpuAffinity()        != rhs.cpuAffinity()        ||
+           lhs.detachedState()      != rhs.detachedState()      ||
            lhs.guardSize()          != rhs.guardSize()          ||
            lhs.inheritSchedule()    != rhs.inheritSchedule()    ||
            lhs.schedulingPolicy()   != rhs.schedulingPolicy()   ||
@@ -29,6 +29,7 @@ BSLS_IDENT("$Id: $")
 //..
 //  Name                Type                   Default
 //  ------------------  ---------------------  ----------------------
+//  cpuAffinity         bsl::vector<int>       empty
 //  detachedState       enum DetachedState     e_CREATE_JOINABLE
 //  stackSize           int                    e_UNSET_STACK_SIZE
 //  guardSize           int                    e_UNSET_GUARD_SIZE
@@ -41,8 +42,20 @@ BSLS_IDENT("$Id: $")
 //  ---------     ---------------------------------------------------
 //  stackSize     'e_UNSET_STACK_SIZE == stackSize || 0 <= stackSize'
 //  guardSize     'e_UNSET_GUARD_SIZE == guardSize || 0 <= guardSize'
+//  cpuAffinity   every element is non-negative
 //..
 //
+///'cpuAffinity' Attribute
+///- - - - - - - - - - - -
+// The 'cpuAffinity' attribute is the set of the (zero-based, operating-system
+// assigned) indices of the CPUs on which a created thread may run.  If
+// 'cpuAffinity' is empty (the default), the created thread may run on any CPU
+// available to the task.  Binding the threads that share data to the CPUs of
+// one socket (or one NUMA node) avoids the cost of migrating threads, and
+// their caches, between sockets.  If the set contains no CPU available to
+// the task, thread creation fails.  At this time, only Linux supports this
+// attribute; it is ignored on other platforms.
+//
 ///'detachedState' Attribute
 ///- - - - - - - - - - - - -
 // The 'detachedState' attribute indicates whether an associated thread should
@@ -288,6 +301,7 @@ BSLS_IDENT("$Id: $")
 
 #include <bsl_c_limits.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
 
 namespace BloombergLP {
 namespace bslmt {
@@ -371,6 +385,9 @@ class ThreadAttributes {
 
   private:
     // DATA
+    bsl::vector<int> d_cpuAffinity;         // CPUs on which the thread may
+                                            // run (empty if unrestricted)
+
     DetachedState    d_detachedState;       // whether the thread is detached
                                             // or joinable
 
@@ -402,6 +419,7 @@ class ThreadAttributes {
     explicit ThreadAttributes(bslma::Allocator *basicAllocator);
         // Create a 'ThreadAttributes' object having the (default) attribute
         // values:
+        //: o 'cpuAffinity()        == bsl::vector<int>()'
         //: o 'detachedState()      == e_CREATE_JOINABLE'
         //: o 'guardSize()          == e_UNSET_GUARD_SIZE'
         //: o 'inheritSchedule()    == true'
@@ -426,6 +444,16 @@ class ThreadAttributes {
         // return a reference providing modifiable access to this object.
 
     // MANIPULATORS
+    ThreadAttributes& setCpuAffinity(const bsl::vector<int>& value);
+        // Set the 'cpuAffinity' attribute of this object to the specified
+        // 'value', the set of the indices of the CPUs on which a thread
+        // created with this object may run.  Return a non-'const' reference
+        // to this object (see also {Fluent Interface}).  An empty 'value'
+        // (the default) indicates that the thread may run on any CPU
+        // available to the task.  The behavior is undefined unless every
+        // element of 'value' is non-negative.  Note that this attribute is
+        // ignored on platforms other than Linux.
+
     ThreadAttributes& setDetachedState(DetachedState value);
         // Set the 'detachedState' attribute of this object to the specified
         // 'value'.  Return a non-'const' reference to this object (see also
@@ -490,6 +518,13 @@ class ThreadAttributes {
         // {Fluent Interface}).
 
     // ACCESSORS
+    const bsl::vector<int>& cpuAffinity() const;
+        // Return a reference providing non-modifiable access to the
+        // 'cpuAffinity' attribute of this object, the set of the indices of
+        // the CPUs on which a thread created with this object may run.  An
+        // empty set indicates that the thread may run on any CPU available to
+        // the task.
+
     DetachedState detachedState() const;
         // Return the value of the 'detachedState' attribute of this object.  A
         // value of 'e_CREATE_JOINABLE' indicates that a thread must be joined
@@ -549,16 +584,18 @@ class ThreadAttributes {
 bool operator==(const ThreadAttributes& lhs, const ThreadAttributes& rhs);
     // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
     // value, and 'false' otherwise.  Two 'ThreadAttributes' objects have the
-    // same value if the corresponding values of their 'detachedState',
-    // 'guardSize', 'inheritSchedule', 'schedulingPolicy',
-    // 'schedulingPriority', and 'stackSize' attributes are the same.
+    // same value if the corresponding values of their 'cpuAffinity',
+    // 'detachedState', 'guardSize', 'inheritSchedule', 'schedulingPolicy',
+    // 'schedulingPriority', 'stackSize', and 'threadName' attributes are the
+    // same.
 
 bool operator!=(const ThreadAttributes& lhs, const ThreadAttributes& rhs);
     // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
     // same value, and 'false' otherwise.  Two 'baltzo::LocalTimeDescriptor'
     // objects do not have the same value if the corresponding values of their
-    // 'detachedState', 'guardSize', 'inheritSchedule', 'schedulingPolicy',
-    // 'schedulingPriority', and 'stackSize' attributes are not the same.
+    // 'cpuAffinity', 'detachedState', 'guardSize', 'inheritSchedule',
+    // 'schedulingPolicy', 'schedulingPriority', 'stackSize', and 'threadName'
+    // attributes are not the same.
 
 // ============================================================================
 //                             INLINE DEFINITIONS
@@ -569,6 +606,15 @@ bool operator!=(const ThreadAttributes& lhs, const ThreadAttributes& rhs);
                           // ----------------------
 
 // MANIPULATORS
+inline
+ThreadAttributes& ThreadAttributes::setCpuAffinity(
+                                               const bsl::vector<int>& value)
+{
+    d_cpuAffinity = value;
+
+    return *this;
+}
+
 inline
 ThreadAttributes& ThreadAttributes::setDetachedState(
                                          ThreadAttributes::DetachedState value)
@@ -643,6 +689,12 @@ ThreadAttributes& ThreadAttributes::setThreadName(
 }
 
 // ACCESSORS
+inline
+const bsl::vector<int>& ThreadAttributes::cpuAffinity() const
+{
+    return d_cpuAffinity;
+}
+
 inline
 ThreadAttributes::DetachedState ThreadAttributes::detachedState() const
 {
@@ -24,6 +24,7 @@
 #include <bsl_cstdlib.h>
 #include <bsl_ios.h>
 #include <bsl_iostream.h>
+#include <bsl_vector.h>
 
 #ifdef BSLMT_PLATFORM_POSIX_THREADS
 #include <pthread.h>
@@ -318,7 +319,7 @@ int main(int argc, char *argv[])
         // --------------------------------------------------------------------
         // Testing Primary Manipulators / Accessors
         //
-        // For each of the 6 attributes of Attribute, set the attribute on a
+        // For each of the 8 attributes of Attribute, set the attribute on a
         // newly constructed object, copy the object, and use the accessor for
         // that attribute to verify the value.  Also verify that each (fluent)
         //  manipulator returns a non-'const' reference to the targeted object.
@@ -342,37 +343,49 @@ int main(int argc, char *argv[])
             bool                   d_inheritSchedule;
             int                    d_stackSize;
             int                    d_guardSize;
+            int                    d_numCpus;
             const char            *d_threadName;
         } PARAM[] = {
-           {L_, Obj::e_CREATE_DETACHED, Obj::e_SCHED_OTHER, 0, 0, 0, 0, "" },
-           {L_, Obj::e_CREATE_DETACHED, Obj::e_SCHED_OTHER, 0, 0, 0, 0, "x" },
-           {L_, Obj::e_CREATE_DETACHED, Obj::e_SCHED_OTHER, 0, 0, 0, 0,
+           {L_, Obj::e_CREATE_DETACHED, Obj::e_SCHED_OTHER, 0, 0, 0, 0, 0,
+                                                                        "" },
+           {L_, Obj::e_CREATE_DETACHED, Obj::e_SCHED_OTHER, 0, 0, 0, 0, 0,
+                                                                       "x" },
+           {L_, Obj::e_CREATE_DETACHED, Obj::e_SCHED_OTHER, 0, 0, 0, 0, 1,
                                                                 "short name" },
-           {L_, Obj::e_CREATE_DETACHED, Obj::e_SCHED_OTHER, 0, 0, 0, 0,
+           {L_, Obj::e_CREATE_DETACHED, Obj::e_SCHED_OTHER, 0, 0, 0, 0, 0,
                                "How long is your thread name? I wanna know." },
-           {L_, Obj::e_CREATE_DETACHED, Obj::e_SCHED_FIFO, 0, 0, 0, 0,
+           {L_, Obj::e_CREATE_DETACHED, Obj::e_SCHED_FIFO, 0, 0, 0, 0, 2,
                                       "incredibly terribly long thread name" },
-           {L_, Obj::e_CREATE_DETACHED, Obj::e_SCHED_FIFO, 5, 0, 0, 0,
+           {L_, Obj::e_CREATE_DETACHED, Obj::e_SCHED_FIFO, 5, 0, 0, 0, 0,
                             "My thread name is sooooooooooooooooooooo long." },
-           {L_, Obj::e_CREATE_DETACHED, Obj::e_SCHED_FIFO, 4, true, 0, 0,
+           {L_, Obj::e_CREATE_DETACHED, Obj::e_SCHED_FIFO, 4, true, 0, 0, 3,
                    "My thread name got lost and couldn't find its way home." },
-           {L_, Obj::e_CREATE_DETACHED, Obj::e_SCHED_FIFO, 3, 0, 300000, 0,
+           {L_, Obj::e_CREATE_DETACHED, Obj::e_SCHED_FIFO, 3, 0, 300000, 0, 0,
                                 "My thread name goes to the next time zone." },
-           {L_, Obj::e_CREATE_DETACHED, Obj::e_SCHED_FIFO, 3, 0, 80000, 0,
+           {L_, Obj::e_CREATE_DETACHED, Obj::e_SCHED_FIFO, 3, 0, 80000, 0, 4,
                                                                 "short name" },
-           {L_, Obj::e_CREATE_DETACHED, Obj::e_SCHED_FIFO, 2, 0, 0, 2000,
+           {L_, Obj::e_CREATE_DETACHED, Obj::e_SCHED_FIFO, 2, 0, 0, 2000, 0,
                               "My thread name goes to Nova Scotia and back." },
-           {L_, Obj::e_CREATE_DETACHED, Obj::e_SCHED_FIFO, 2, 0, 0, 2000,
+           {L_, Obj::e_CREATE_DETACHED, Obj::e_SCHED_FIFO, 2, 0, 0, 2000, 64,
                  "That's nothing!"
                          "  The other end of my thread name is in Timbuktu." }
         };
 
         size_t numParams = sizeof(PARAM) / sizeof(Parameters);
         for (unsigned i = 0; i < numParams; ++i) {
+            bsl::vector<int> cpus(&ta);
+            for (int j = 0; j < PARAM[i].d_numCpus; ++j) {
+                cpus.push_back(2 * j + 1);
+            }
+
             const Int64 numTaPreAlloc = ta.numAllocations();
             const Int64 numDaPreAlloc = da.numAllocations();
 
             Obj mX(&ta);    const Obj& X = mX;
+            {
+                Obj &rv = mX.setCpuAffinity(cpus);
+                ASSERTV(&rv, &mX, &rv == &mX);
+            }
             {
                 Obj &rv = mX.setDetachedState(PARAM[i].d_detachedState);
                 ASSERTV(&rv, &mX, &rv == &mX);
@@ -404,7 +417,8 @@ int main(int argc, char *argv[])
             }
 
             ASSERT(da.numAllocations() == numDaPreAlloc);
-            ASSERTV(X.threadName(), (X.threadName().length() > 15) ==
+            ASSERTV(X.threadName(), (X.threadName().length() > 15 ||
+                                     0 < PARAM[i].d_numCpus) ==
                                         (ta.numAllocations() > numTaPreAlloc));
 
             Obj mY(&ta);
@@ -487,6 +501,15 @@ int main(int argc, char *argv[])
                         PARAM[i].d_threadName == Y.threadName());
             LOOP_ASSERT(PARAM[i].d_line,
                         PARAM[i].d_threadName == Z.threadName());
+            LOOP_ASSERT(PARAM[i].d_line, cpus == X.cpuAffinity());
+            LOOP_ASSERT(PARAM[i].d_line, cpus == Y.cpuAffinity());
+            LOOP_ASSERT(PARAM[i].d_line, cpus == Z.cpuAffinity());
+
+            if (0 < PARAM[i].d_numCpus) {
+                mY.setCpuAffinity(bsl::vector<int>());
+                LOOP_ASSERT(PARAM[i].d_line, X != Y);
+                LOOP_ASSERT(PARAM[i].d_line, Y.cpuAffinity().empty());
+            }
         }
       } break;
       case 1: {
@@ -517,6 +540,7 @@ int main(int argc, char *argv[])
         ASSERT(X.inheritSchedule());
         ASSERT(0 != X.stackSize());
         ASSERT("" == X.threadName());
+        ASSERT(X.cpuAffinity().empty());
       } break;
       case -1: {
         // --------------------------------------------------------------------
@@ -31,6 +31,7 @@ BSLS_IDENT_RCSID(bslmt_threadutilimpl_pthread_cpp,"$Id$ $CSID$")
 #include <bsl_cstring.h>
 #include <bsl_ctime.h>
 #include <bsl_c_limits.h>
+#include <bsl_vector.h>
 
 #include <pthread.h>
 #include <unistd.h>        // sysconf, geteuid
@@ -44,6 +45,7 @@ BSLS_IDENT_RCSID(bslmt_threadutilimpl_pthread_cpp,"$Id$ $CSID$")
 #elif defined(BSLS_PLATFORM_OS_SOLARIS)
 # include <sys/utsname.h>
 #elif defined(BSLS_PLATFORM_OS_LINUX)
+# include <sched.h>        // CPU_ALLOC
 # include <sys/prctl.h>
 #elif defined(BSLS_PLATFORM_OS_HPUX)
 # include <sys/mpctl.h>
@@ -193,6 +195,31 @@ static int initPthreadAttribute(pthread_attr_t                 *destination,
         rc |= pthread_attr_setstacksize(destination, stackSize);
     }
 
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    const bsl::vector<int>& cpuAffinity = src.cpuAffinity();
+    if (!cpuAffinity.empty()) {
+        const int maxCpu = *bsl::max_element(cpuAffinity.begin(),
+                                             cpuAffinity.end());
+        BSLS_ASSERT(0 <= maxCpu);
+
+        cpu_set_t *cpuSet = CPU_ALLOC(maxCpu + 1);
+        if (!cpuSet) {
+            return rc | -1;                                           // RETURN
+        }
+
+        const bsl::size_t cpuSetSize = CPU_ALLOC_SIZE(maxCpu + 1);
+        CPU_ZERO_S(cpuSetSize, cpuSet);
+        for (bsl::size_t i = 0; i < cpuAffinity.size(); ++i) {
+            BSLS_ASSERT(0 <= cpuAffinity[i]);
+
+            CPU_SET_S(cpuAffinity[i], cpuSetSize, cpuSet);
+        }
+
+        rc |= pthread_attr_setaffinity_np(destination, cpuSetSize, cpuSet);
+        CPU_FREE(cpuSet);
+    }
+#endif
+
     return rc;
 }
 
@@ -0,0 +1,344 @@
+// bslmt_waitstrategy.h                                               -*-C++-*-
+
+#ifndef INCLUDED_BSLMT_WAITSTRATEGY
+#define INCLUDED_BSLMT_WAITSTRATEGY
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a description of how a thread waits before blocking.
+//
+//@CLASSES:
+//  bslmt::WaitStrategy: spin, yield, and park policy of a waiting thread
+//
+//@SEE_ALSO: bslmt_fastpostsemaphore, bdlcc_boundedqueue, bdlcc_fixedqueue
+//
+//@DESCRIPTION: This component provides a simply constrained attribute class,
+// 'bslmt::WaitStrategy', describing how a thread that must wait for a
+// resource (e.g., an element of a queue) behaves before it blocks ("parks")
+// in the operating system.  Blocking and being woken cost a system call each,
+// and the wake-up latency of a parked thread is typically several
+// microseconds; when the resource is expected to become available within a
+// comparable time, the waiting thread achieves a lower latency by first
+// checking for the resource repeatedly:
+//
+//: 1 *spin*: up to 'spinCount' times, separated by a processor "pause" hint
+//:   (see 'pause'), without giving up the CPU;
+//:
+//: 2 *yield*: up to 'yieldCount' times, separated by a yield of the CPU to the
+//:   other runnable threads;
+//:
+//: 3 *park*: block until woken by the thread providing the resource.
+//
+// The default-constructed strategy neither spins nor yields, and so parks the
+// waiting thread immediately; spinning is a trade of CPU time for latency, and
+// must be requested explicitly.  Note that spinning is beneficial only if the
+// waiting thread and the thread providing the resource run on different CPUs:
+// otherwise, the spinning thread merely delays the thread it waits for.
+//
+///Adaptive Spinning
+///-----------------
+// If 'isAdaptive()' is 'true', the number of spins is tuned at run-time, in
+// the manner of the adaptive mutexes of the GNU C library: the object using
+// the strategy maintains an estimate of the number of spins after which the
+// resource becomes available, at most '2 * estimate + 10' (and at most
+// 'spinCount') spins are performed by each waiting thread, and the estimate is
+// then moved by one eighth toward the number of spins actually performed.
+// Hence, the spinning phase follows the typical time a resource takes to
+// become available, within the bound set by 'spinCount'.  The 'spinLimit' and
+// 'updateSpinEstimate' methods implement this computation for the users of
+// this component.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Waiting for a Flag
+///- - - - - - - - - - - - - - -
+// Suppose that a thread waits for a flag set by another thread, and that we
+// want it to spin, adaptively, before resorting to a (costly) blocking wait.
+// First, we define the strategy and the state maintaining the estimate:
+//..
+//  bslmt::WaitStrategy strategy(1000, 0, true);
+//  int                 spinEstimate = 0;
+//
+//  bsls::AtomicInt     flag(1);  // already set, for the example
+//..
+// Then, we spin up to the number of times indicated by the strategy:
+//..
+//  const int limit = strategy.spinLimit(spinEstimate);
+//  int       numSpins = 0;
+//  while (numSpins < limit && 0 == flag.loadAcquire()) {
+//      bslmt::WaitStrategy::pause();
+//      ++numSpins;
+//  }
+//..
+// Finally, we update the estimate and, if the flag is still not set, block:
+//..
+//  spinEstimate = bslmt::WaitStrategy::updateSpinEstimate(spinEstimate,
+//                                                         numSpins);
+//  assert(0 != flag.loadAcquire());
+//..
+
+#include <bslscm_version.h>
+
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+
+#if defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64)
+#include <emmintrin.h>
+#endif
+
+namespace BloombergLP {
+namespace bslmt {
+
+                            // ==================
+                            // class WaitStrategy
+                            // ==================
+
+class WaitStrategy {
+    // This simply constrained attribute class describes how a waiting thread
+    // spins, yields, and then parks.  See the component-level documentation.
+
+    // DATA
+    int  d_spinCount;   // maximum number of spins before yielding
+
+    int  d_yieldCount;  // number of yields before parking
+
+    bool d_isAdaptive;  // 'true' if the number of spins is tuned at run-time
+
+  public:
+    // PUBLIC CONSTANTS
+    enum {
+        k_MIN_ADAPTIVE_SPIN_COUNT = 10  // spins allowed with a 0 estimate
+    };
+
+    // CLASS METHODS
+    static void pause();
+        // Hint to the processor that the calling thread is busy-waiting (e.g.,
+        // execute the 'pause' instruction of Intel processors), reducing the
+        // power consumption and the penalty of exiting the loop.  On platforms
+        // without such a hint, this method has no effect.
+
+    static int updateSpinEstimate(int spinEstimate, int numSpins);
+        // Return the specified 'spinEstimate' moved by one eighth toward the
+        // specified 'numSpins'.  The behavior is undefined unless
+        // '0 <= spinEstimate' and '0 <= numSpins'.
+
+    // CREATORS
+    WaitStrategy();
+        // Create a wait strategy that parks the waiting thread immediately:
+        // 'spinCount()', 'yieldCount()' are 0, and 'isAdaptive()' is 'false'.
+
+    WaitStrategy(int spinCount, int yieldCount, bool isAdaptive = false);
+        // Create a wait strategy that spins up to the specified 'spinCount'
+        // times, then yields up to the specified 'yieldCount' times, before
+        // parking.  Optionally specify 'isAdaptive' indicating whether the
+        // number of spins is tuned at run-time (see {Adaptive Spinning}).  If
+        // 'isAdaptive' is not specified, the number of spins is 'spinCount'.
+        // The behavior is undefined unless '0 <= spinCount' and
+        // '0 <= yieldCount'.
+
+    // WaitStrategy(const WaitStrategy&) = default;
+    // ~WaitStrategy() = default;
+
+    // MANIPULATORS
+    // WaitStrategy& operator=(const WaitStrategy&) = default;
+
+    void setAdaptive(bool value);
+        // Set the "adaptive" attribute of this object to the specified
+        // 'value'.
+
+    void setSpinCount(int value);
+        // Set the "spin count" attribute of this object to the specified
+        // 'value'.  The behavior is undefined unless '0 <= value'.
+
+    void setYieldCount(int value);
+        // Set the "yield count" attribute of this object to the specified
+        // 'value'.  The behavior is undefined unless '0 <= value'.
+
+    // ACCESSORS
+    bool isAdaptive() const;
+        // Return 'true' if the number of spins is tuned at run-time, and
+        // 'false' otherwise.
+
+    bool isParkOnly() const;
+        // Return 'true' if this strategy neither spins nor yields, and 'false'
+        // otherwise.
+
+    int spinCount() const;
+        // Return the maximum number of spins before yielding.
+
+    int spinLimit(int spinEstimate) const;
+        // Return the number of spins a waiting thread performs, before
+        // yielding, given the specified 'spinEstimate': 'spinCount()' if
+        // '!isAdaptive()', and the minimum of 'spinCount()' and
+        // '2 * spinEstimate + k_MIN_ADAPTIVE_SPIN_COUNT' otherwise.  The
+        // behavior is undefined unless '0 <= spinEstimate'.
+
+    int yieldCount() const;
+        // Return the number of yields before parking.
+};
+
+// FREE OPERATORS
+bool operator==(const WaitStrategy& lhs, const WaitStrategy& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'WaitStrategy' objects have the same
+    // value if they have the same spin count, yield count, and "adaptive"
+    // attribute.
+
+bool operator!=(const WaitStrategy& lhs, const WaitStrategy& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  Two 'WaitStrategy' objects do not
+    // have the same value if they differ in spin count, yield count, or
+    // "adaptive" attribute.
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                            // ------------------
+                            // class WaitStrategy
+                            // ------------------
+
+// CLASS METHODS
+inline
+void WaitStrategy::pause()
+{
+#if defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64)
+    _mm_pause();
+#endif
+}
+
+inline
+int WaitStrategy::updateSpinEstimate(int spinEstimate, int numSpins)
+{
+    BSLS_ASSERT(0 <= spinEstimate);
+    BSLS_ASSERT(0 <= numSpins);
+
+    return spinEstimate + (numSpins - spinEstimate) / 8;
+}
+
+// CREATORS
+inline
+WaitStrategy::WaitStrategy()
+: d_spinCount(0)
+, d_yieldCount(0)
+, d_isAdaptive(false)
+{
+}
+
+inline
+WaitStrategy::WaitStrategy(int spinCount, int yieldCount, bool isAdaptive)
+: d_spinCount(spinCount)
+, d_yieldCount(yieldCount)
+, d_isAdaptive(isAdaptive)
+{
+    BSLS_ASSERT(0 <= spinCount);
+    BSLS_ASSERT(0 <= yieldCount);
+}
+
+// MANIPULATORS
+inline
+void WaitStrategy::setAdaptive(bool value)
+{
+    d_isAdaptive = value;
+}
+
+inline
+void WaitStrategy::setSpinCount(int value)
+{
+    BSLS_ASSERT(0 <= value);
+
+    d_spinCount = value;
+}
+
+inline
+void WaitStrategy::setYieldCount(int value)
+{
+    BSLS_ASSERT(0 <= value);
+
+    d_yieldCount = value;
+}
+
+// ACCESSORS
+inline
+bool WaitStrategy::isAdaptive() const
+{
+    return d_isAdaptive;
+}
+
+inline
+bool WaitStrategy::isParkOnly() const
+{
+    return 0 == d_spinCount && 0 == d_yieldCount;
+}
+
+inline
+int WaitStrategy::spinCount() const
+{
+    return d_spinCount;
+}
+
+inline
+int WaitStrategy::spinLimit(int spinEstimate) const
+{
+    BSLS_ASSERT(0 <= spinEstimate);
+
+    if (!d_isAdaptive) {
+        return d_spinCount;                                           // RETURN
+    }
+
+    // Note that the computation is performed so as not to overflow.
+
+    if (spinEstimate >= d_spinCount / 2) {
+        return d_spinCount;                                           // RETURN
+    }
+
+    const int limit = 2 * spinEstimate + k_MIN_ADAPTIVE_SPIN_COUNT;
+
+    return limit < d_spinCount ? limit : d_spinCount;
+}
+
+inline
+int WaitStrategy::yieldCount() const
+{
+    return d_yieldCount;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+inline
+bool bslmt::operator==(const WaitStrategy& lhs, const WaitStrategy& rhs)
+{
+    return lhs.spinCount()  == rhs.spinCount()
+        && lhs.yieldCount() == rhs.yieldCount()
+        && lhs.isAdaptive() == rhs.isAdaptive();
+}
+
+inline
+bool bslmt::operator!=(const WaitStrategy& lhs, const WaitStrategy& rhs)
+{
+    return !(lhs == rhs);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,520 @@
+// bslmt_waitstrategy.t.cpp                                           -*-C++-*-
+#include <bslmt_waitstrategy.h>
+
+#include <bslim_testutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_atomic.h>
+
+#include <bsl_climits.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// 'bslmt::WaitStrategy' is a simply constrained attribute class.  The
+// constructors, manipulators, accessors, and equality operators are tested
+// directly; the computation of the number of spins ('spinLimit' and
+// 'updateSpinEstimate') is verified against a table of expected values.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 4] static void pause();
+// [ 4] static int updateSpinEstimate(int spinEstimate, int numSpins);
+//
+// CREATORS
+// [ 2] WaitStrategy();
+// [ 2] WaitStrategy(int spinCount, int yieldCount, bool isAdaptive = false);
+//
+// MANIPULATORS
+// [ 2] void setAdaptive(bool value);
+// [ 2] void setSpinCount(int value);
+// [ 2] void setYieldCount(int value);
+//
+// ACCESSORS
+// [ 2] bool isAdaptive() const;
+// [ 2] bool isParkOnly() const;
+// [ 2] int spinCount() const;
+// [ 4] int spinLimit(int spinEstimate) const;
+// [ 2] int yieldCount() const;
+//
+// FREE OPERATORS
+// [ 3] bool operator==(const WaitStrategy& lhs, const WaitStrategy& rhs);
+// [ 3] bool operator!=(const WaitStrategy& lhs, const WaitStrategy& rhs);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                     NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bslmt::WaitStrategy Obj;
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Waiting for a Flag
+///- - - - - - - - - - - - - - -
+// Suppose that a thread waits for a flag set by another thread, and that we
+// want it to spin, adaptively, before resorting to a (costly) blocking wait.
+// First, we define the strategy and the state maintaining the estimate:
+//..
+    bslmt::WaitStrategy strategy(1000, 0, true);
+    int                 spinEstimate = 0;
+
+    bsls::AtomicInt     flag(1);  // already set, for the example
+//..
+// Then, we spin up to the number of times indicated by the strategy:
+//..
+    const int limit = strategy.spinLimit(spinEstimate);
+    int       numSpins = 0;
+    while (numSpins < limit && 0 == flag.loadAcquire()) {
+        bslmt::WaitStrategy::pause();
+        ++numSpins;
+    }
+//..
+// Finally, we update the estimate and, if the flag is still not set, block:
+//..
+    spinEstimate = bslmt::WaitStrategy::updateSpinEstimate(spinEstimate,
+                                                           numSpins);
+    ASSERT(0 != flag.loadAcquire());
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // SPIN LIMIT
+        //
+        // Concerns:
+        //: 1 'spinLimit' returns 'spinCount()' for a non-adaptive strategy,
+        //:   whatever the estimate.
+        //:
+        //: 2 'spinLimit' returns the minimum of 'spinCount()' and
+        //:   '2 * spinEstimate + 10' for an adaptive strategy, without
+        //:   overflowing for large estimates.
+        //:
+        //: 3 'updateSpinEstimate' moves the estimate by one eighth toward the
+        //:   number of spins, converging on a constant number of spins.
+        //:
+        //: 4 'pause' can be invoked.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, verify 'spinLimit' and
+        //:   'updateSpinEstimate'.  (C-1..3)
+        //:
+        //: 2 Iterate 'updateSpinEstimate' with a constant number of spins and
+        //:   verify the estimate converges.  (C-3)
+        //:
+        //: 3 Invoke 'pause'.  (C-4)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid values.  (C-5)
+        //
+        // Testing:
+        //   static void pause();
+        //   static int updateSpinEstimate(int spinEstimate, int numSpins);
+        //   int spinLimit(int spinEstimate) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "SPIN LIMIT" << endl
+                          << "==========" << endl;
+
+        static const struct {
+            int  d_line;
+            int  d_spinCount;
+            bool d_isAdaptive;
+            int  d_spinEstimate;
+            int  d_expLimit;
+        } DATA[] = {
+            //LINE  COUNT    ADAPT  ESTIMATE  EXP
+            //----  -------  -----  --------  ----
+            { L_,         0, false,        0,    0 },
+            { L_,         0, true,         0,    0 },
+            { L_,         0, true,       100,    0 },
+            { L_,       100, false,        0,  100 },
+            { L_,       100, false,      500,  100 },
+            { L_,       100, true,         0,   10 },
+            { L_,       100, true,        20,   50 },
+            { L_,       100, true,        45,  100 },
+            { L_,       100, true,        49,  100 },
+            { L_,       100, true,        50,  100 },
+            { L_,       100, true,       500,  100 },
+            { L_,         5, true,         0,    5 },
+            { L_,   INT_MAX, true,         0,   10 },
+            { L_,   INT_MAX, true,   INT_MAX, INT_MAX },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int  LINE     = DATA[ti].d_line;
+            const int  COUNT    = DATA[ti].d_spinCount;
+            const bool ADAPT    = DATA[ti].d_isAdaptive;
+            const int  ESTIMATE = DATA[ti].d_spinEstimate;
+            const int  EXP      = DATA[ti].d_expLimit;
+
+            if (veryVerbose) { P_(LINE) P_(COUNT) P_(ADAPT) P(ESTIMATE) }
+
+            const Obj X(COUNT, 0, ADAPT);
+
+            ASSERTV(LINE, EXP, X.spinLimit(ESTIMATE),
+                    EXP == X.spinLimit(ESTIMATE));
+        }
+
+        ASSERT( 0 == Obj::updateSpinEstimate(  0,   0));
+        ASSERT( 1 == Obj::updateSpinEstimate(  0,   8));
+        ASSERT( 0 == Obj::updateSpinEstimate(  0,   7));
+        ASSERT(88 == Obj::updateSpinEstimate(100,   0));
+        ASSERT(99 == Obj::updateSpinEstimate(100,  92));
+        ASSERT(95 == Obj::updateSpinEstimate( 90, 130));
+
+        {
+            int estimate = 0;
+            for (int i = 0; i < 200; ++i) {
+                estimate = Obj::updateSpinEstimate(estimate, 400);
+            }
+            ASSERTV(estimate, 393 <= estimate && estimate <= 400);
+
+            for (int i = 0; i < 200; ++i) {
+                estimate = Obj::updateSpinEstimate(estimate, 0);
+            }
+            ASSERTV(estimate, estimate < 8);
+        }
+
+        for (int i = 0; i < 1000; ++i) {
+            Obj::pause();
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const Obj X(10, 0, true);
+
+            ASSERT_PASS(X.spinLimit(0));
+            ASSERT_FAIL(X.spinLimit(-1));
+
+            ASSERT_PASS(Obj::updateSpinEstimate( 0,  0));
+            ASSERT_FAIL(Obj::updateSpinEstimate(-1,  0));
+            ASSERT_FAIL(Obj::updateSpinEstimate( 0, -1));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // EQUALITY OPERATORS
+        //
+        // Concerns:
+        //: 1 Two objects compare equal if and only if each of their attributes
+        //:   compares equal.
+        //:
+        //: 2 'operator!=' is the negation of 'operator=='.
+        //
+        // Plan:
+        //: 1 For every pair of objects from a set of objects differing in
+        //:   exactly one attribute, verify the result of the operators.
+        //:   (C-1..2)
+        //
+        // Testing:
+        //   bool operator==(const WaitStrategy& lhs, const WaitStrategy& rhs);
+        //   bool operator!=(const WaitStrategy& lhs, const WaitStrategy& rhs);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "EQUALITY OPERATORS" << endl
+                          << "==================" << endl;
+
+        const Obj VALUES[] = {
+            Obj(),
+            Obj(1, 0, false),
+            Obj(0, 1, false),
+            Obj(0, 0, true),
+            Obj(1000, 10, true),
+            Obj(1000, 10, false),
+        };
+        const int NUM_VALUES = sizeof VALUES / sizeof *VALUES;
+
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            for (int j = 0; j < NUM_VALUES; ++j) {
+                const Obj& X = VALUES[i];
+                const Obj& Y = VALUES[j];
+
+                ASSERTV(i, j, (i == j) == (X == Y));
+                ASSERTV(i, j, (i != j) == (X != Y));
+            }
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS, MANIPULATORS, AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 The default constructor creates a strategy that parks
+        //:   immediately.
+        //:
+        //: 2 The value constructor sets each attribute, and 'isAdaptive'
+        //:   defaults to 'false'.
+        //:
+        //: 3 Each manipulator sets its attribute and no other.
+        //:
+        //: 4 'isParkOnly' is 'true' if and only if both counts are 0.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create objects with each constructor and verify the accessors.
+        //:   (C-1..2, 4)
+        //:
+        //: 2 Invoke each manipulator and verify all accessors.  (C-3..4)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid values.  (C-5)
+        //
+        // Testing:
+        //   WaitStrategy();
+        //   WaitStrategy(int spinCount, int yieldCount, bool isAdaptive);
+        //   void setAdaptive(bool value);
+        //   void setSpinCount(int value);
+        //   void setYieldCount(int value);
+        //   bool isAdaptive() const;
+        //   bool isParkOnly() const;
+        //   int spinCount() const;
+        //   int yieldCount() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS, MANIPULATORS, AND ACCESSORS" << endl
+                          << "=====================================" << endl;
+
+        {
+            const Obj X;
+
+            ASSERT(0     == X.spinCount());
+            ASSERT(0     == X.yieldCount());
+            ASSERT(false == X.isAdaptive());
+            ASSERT(true  == X.isParkOnly());
+        }
+        {
+            const Obj X(100, 5);
+
+            ASSERT(100   == X.spinCount());
+            ASSERT(5     == X.yieldCount());
+            ASSERT(false == X.isAdaptive());
+            ASSERT(false == X.isParkOnly());
+        }
+        {
+            const Obj X(0, 0, true);
+
+            ASSERT(0     == X.spinCount());
+            ASSERT(0     == X.yieldCount());
+            ASSERT(true  == X.isAdaptive());
+            ASSERT(true  == X.isParkOnly());
+        }
+        {
+            Obj mX;  const Obj& X = mX;
+
+            mX.setSpinCount(7);
+            ASSERT(7     == X.spinCount());
+            ASSERT(0     == X.yieldCount());
+            ASSERT(false == X.isAdaptive());
+            ASSERT(false == X.isParkOnly());
+
+            mX.setYieldCount(3);
+            ASSERT(7     == X.spinCount());
+            ASSERT(3     == X.yieldCount());
+            ASSERT(false == X.isAdaptive());
+
+            mX.setAdaptive(true);
+            ASSERT(7     == X.spinCount());
+            ASSERT(3     == X.yieldCount());
+            ASSERT(true  == X.isAdaptive());
+
+            mX.setSpinCount(0);
+            ASSERT(false == X.isParkOnly());
+
+            mX.setYieldCount(0);
+            ASSERT(true  == X.isParkOnly());
+            ASSERT(true  == X.isAdaptive());
+
+            mX.setAdaptive(false);
+            ASSERT(false == X.isAdaptive());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(Obj( 0,  0));
+            ASSERT_FAIL(Obj(-1,  0));
+            ASSERT_FAIL(Obj( 0, -1));
+
+            Obj mX;
+
+            ASSERT_PASS(mX.setSpinCount(0));
+            ASSERT_FAIL(mX.setSpinCount(-1));
+            ASSERT_PASS(mX.setYieldCount(0));
+            ASSERT_FAIL(mX.setYieldCount(-1));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create, copy, assign, and compare objects.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        Obj mX;  const Obj& X = mX;
+        Obj mY(1000, 10, true);  const Obj& Y = mY;
+
+        ASSERT(X != Y);
+
+        Obj mZ(Y);  const Obj& Z = mZ;
+
+        ASSERT(Y == Z);
+
+        mZ = X;
+
+        ASSERT(X == Z);
+        ASSERT(Y != Z);
+
+        ASSERT(10 == Y.spinLimit(0));
+        ASSERT(0  == X.spinLimit(0));
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -22,6 +22,12 @@ BSLS_IDENT("$Id: $")
 // make sure that the lifetime and visibility of the buffer is sufficient to
 // satisfy the needs of the input stream.
 //
+// For the same reason, strings and arrays of bytes can be read without being
+// copied: 'getStringView' and 'getArrayUint8View' return views of the data in
+// the buffer, which remain valid as long as the buffer.  This is particularly
+// useful when the buffer is a memory-mapped file (see 'bdls_mappedfile'), in
+// which case the data is read from the file only when the view is accessed.
+//
 // This component is intended to be used in conjunction with the
 // 'bslx_byteoutstream' "externalization" component.  Each input method of
 // 'bslx::ByteInStream' reads either a value or a homogeneous array of values
@@ -326,6 +332,7 @@ BSLS_IDENT("$Id: $")
 #include <bsl_cstddef.h>
 #include <bsl_iosfwd.h>
 #include <bsl_string.h>
+#include <bsl_string_view.h>
 #include <bsl_vector.h>
 
 namespace BloombergLP {
@@ -627,6 +634,32 @@ class ByteInStream {
         // value, this stream is marked invalid and the value of 'variable' is
         // undefined.
 
+                      // *** views of the buffer ***
+
+    ByteInStream& getArrayUint8View(const char *& variables,
+                                    int           numVariables);
+        // Assign to the specified 'variables' the address, in the buffer of
+        // this stream, of the specified 'numVariables' one-byte sequences of
+        // this stream at the current cursor location, update the cursor
+        // location, and return a reference to this stream.  If this stream is
+        // initially invalid, this operation has no effect.  If this function
+        // otherwise fails to extract a valid value, this stream is marked
+        // invalid and the value of 'variables' is unchanged.  The behavior is
+        // undefined unless '0 <= numVariables'.  Note that this method reads
+        // the format written by 'putArrayUint8' without copying the bytes,
+        // which remain valid only as long as the buffer of this stream.
+
+    ByteInStream& getStringView(bsl::string_view& variable);
+        // Assign to the specified 'variable' a view of the string comprised of
+        // the length of the string (see 'getLength') and the string data (see
+        // 'getArrayUint8View'), update the cursor location, and return a
+        // reference to this stream.  If this stream is initially invalid, this
+        // operation has no effect.  If this function otherwise fails to
+        // extract a valid value, this stream is marked invalid and the value
+        // of 'variable' is unchanged.  Note that this method reads the format
+        // written by 'putString' without copying the string data, which
+        // remains valid only as long as the buffer of this stream.
+
                       // *** arrays of integer values ***
 
     ByteInStream& getArrayInt64(bsls::Types::Int64 *variables,
@@ -1420,6 +1453,52 @@ ByteInStream& ByteInStream::getString(bsl::string& variable)
         getArrayUint8(&variable[initialLength], length - initialLength);
     }
 
+    return *this;
+}
+
+                      // *** views of the buffer ***
+
+inline
+ByteInStream& ByteInStream::getArrayUint8View(const char *& variables,
+                                              int           numVariables)
+{
+    BSLS_ASSERT_SAFE(0 <= numVariables);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    const bsl::size_t len = numVariables;
+    if (cursor() + len <= length()) {
+        variables  = d_buffer + cursor();
+        d_cursor  += len;
+    }
+    else {
+        invalidate();
+    }
+
+    return *this;
+}
+
+inline
+ByteInStream& ByteInStream::getStringView(bsl::string_view& variable)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    int length;
+    getLength(length);
+
+    const char *data = 0;
+    getArrayUint8View(data, length);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(isValid())) {
+        variable = bsl::string_view(data, length);
+    }
+
     return *this;
 }
 
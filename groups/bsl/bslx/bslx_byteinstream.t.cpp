@@ -15,6 +15,7 @@
 #include <bsl_iostream.h>
 #include <bsl_sstream.h>
 #include <bsl_string.h>
+#include <bsl_string_view.h>
 
 using namespace BloombergLP;
 using namespace bsl;
@@ -66,6 +67,8 @@ using namespace bslx;
 // [14] getFloat64(double& variable);
 // [13] getFloat32(float& variable);
 // [26] getString(bsl::string& variable);
+// [30] getArrayUint8View(const char *& variables, int numVariables);
+// [30] getStringView(bsl::string_view& variable);
 // [22] getArrayInt64(bsls::Types::Int64 *variables, int numVariables);
 // [22] getArrayUint64(bsls::Types::Uint64 *variables, int numVariables);
 // [21] getArrayInt56(bsls::Types::Int64 *variables, int numVariables);
@@ -102,7 +105,7 @@ using namespace bslx;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [29] THIRD-PARTY EXTERNALIZATION
-// [30] USAGE EXAMPLE
+// [31] USAGE EXAMPLE
 // ----------------------------------------------------------------------------
 
 // ============================================================================
@@ -532,7 +535,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:
-      case 30: {
+      case 31: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -603,6 +606,151 @@ if (veryVerbose) {
 //..
 
       } break;
+      case 30: {
+        // --------------------------------------------------------------------
+        // GET VIEWS
+        //   Verify these methods return views of the expected data.
+        //
+        // Concerns:
+        //: 1 The methods return views of the data written by 'putString' and
+        //:   'putArrayUint8', and update the cursor.
+        //:
+        //: 2 The views refer to the buffer of the stream (i.e., no data is
+        //:   copied).
+        //:
+        //: 3 The methods invalidate the stream, and leave the variable
+        //:   unchanged, if the data is insufficient.
+        //:
+        //: 4 The methods have no effect on an invalid stream.
+        //:
+        //: 5 The methods return a reference to the stream.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Unexternalize, as views, data externalized by 'ByteOutStream'
+        //:   at different offsets and verify the values and addresses.
+        //:   (C-1..2)
+        //:
+        //: 2 Unexternalize from truncated and invalid streams.  (C-3..4)
+        //:
+        //: 3 Verify the return values.  (C-5)
+        //:
+        //: 4 Verify defensive checks are triggered for invalid values.  (C-6)
+        //
+        // Testing:
+        //   getArrayUint8View(const char *& variables, int numVariables);
+        //   getStringView(bsl::string_view& variable);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "GET VIEWS" << endl
+                          << "=========" << endl;
+
+        if (verbose) cout << "\nTesting the values of the views." << endl;
+        {
+            const bsl::string LONG(300, 'x');
+
+            Out o(VERSION_SELECTOR);
+            o.putString(bsl::string("alpha"));    o.putInt8(0xFF);
+            o.putArrayUint8("beta", 4);           o.putInt8(0xFE);
+            o.putString(bsl::string());           o.putInt8(0xFD);
+            o.putString(LONG);                    o.putInt8(0xFC);
+
+            Obj mX(o.data(), o.length());  const Obj& X = mX;
+
+            if (veryVerbose) { P(X) }
+
+            char              marker;
+            bsl::string_view  view;
+            const char       *bytes = 0;
+
+            mX.getStringView(view);          mX.getInt8(marker);
+            ASSERT("alpha" == view);         ASSERT('\xFF' == marker);
+            ASSERT(X.data() + 1 == view.data());
+
+            mX.getArrayUint8View(bytes, 4);  mX.getInt8(marker);
+            ASSERT(0 == bsl::memcmp(bytes, "beta", 4));
+            ASSERT('\xFE' == marker);
+            ASSERT(X.data() + 7 == bytes);
+
+            mX.getStringView(view);          mX.getInt8(marker);
+            ASSERT(view.empty());            ASSERT('\xFD' == marker);
+
+            mX.getStringView(view);          mX.getInt8(marker);
+            ASSERT(LONG == view);            ASSERT('\xFC' == marker);
+            ASSERT(X.data() + 18 == view.data());
+
+            ASSERT(X);
+            ASSERT(X.isEmpty());
+            ASSERT(X.cursor() == X.length());
+        }
+
+        if (verbose) cout << "\nTesting insufficient data." << endl;
+        {
+            Out o(VERSION_SELECTOR);
+            o.putString(bsl::string("alpha"));
+
+            for (bsl::size_t len = 0; len < o.length(); ++len) {
+                Obj mX(o.data(), len);  const Obj& X = mX;
+
+                bsl::string_view view("unchanged");
+                mX.getStringView(view);
+                ASSERTV(len, !X);
+                ASSERTV(len, "unchanged" == view);
+
+                const char *bytes = "unchanged";
+                Obj mY(o.data(), len);  const Obj& Y = mY;
+                mY.getArrayUint8View(bytes, static_cast<int>(len) + 1);
+                ASSERTV(len, !Y);
+                ASSERTV(len, 0 == bsl::strcmp(bytes, "unchanged"));
+            }
+        }
+
+        if (verbose) cout << "\nTesting invalid streams." << endl;
+        {
+            Out o(VERSION_SELECTOR);
+            o.putString(bsl::string("alpha"));
+
+            Obj mX(o.data(), o.length());  const Obj& X = mX;
+
+            bsl::string_view  view;
+            const char       *bytes = 0;
+
+            mX.invalidate();
+            mX.getStringView(view);
+            ASSERT(view.empty());
+            ASSERT(0 == X.cursor());
+
+            mX.getArrayUint8View(bytes, 1);
+            ASSERT(0 == bytes);
+            ASSERT(0 == X.cursor());
+        }
+
+        if (verbose) cout << "\nTesting the return values." << endl;
+        {
+            Out o(VERSION_SELECTOR);
+            o.putString(bsl::string("alpha"));
+
+            Obj mX(o.data(), o.length());
+
+            bsl::string_view  view;
+            const char       *bytes = 0;
+            ASSERT(&mX == &mX.getStringView(view));
+            ASSERT(&mX == &mX.getArrayUint8View(bytes, 0));
+        }
+
+        if (verbose) cout << "\nNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard guard;
+
+            Obj mX("", 0);
+
+            const char *bytes = 0;
+            ASSERT_SAFE_PASS(mX.getArrayUint8View(bytes,  0));
+            ASSERT_SAFE_FAIL(mX.getArrayUint8View(bytes, -1));
+        }
+      } break;
       case 29: {
         // --------------------------------------------------------------------
         // THIRD-PARTY EXTERNALIZATION
@@ -69,6 +69,20 @@ BSLS_IDENT("$Id: $")
 // See the 'bslx' package-level documentation for more detailed information
 // about versioning.
 //
+///Externalizing Large Payloads
+///-----------------------------
+// 'bslx::ByteOutStream' writes to a single contiguous buffer, which is grown
+// geometrically as needed, copying the data written so far at each regrowth.
+// When the size of the payload is known, or can be estimated, in advance, the
+// copies can be avoided by supplying an 'initialCapacity' at construction,
+// or by calling 'reserveCapacity'.  Otherwise, and for payloads large enough
+// that a contiguous buffer is undesirable, 'bslx::GenericOutStream' writes
+// the same format directly to the storage of any 'STREAMBUF' -- e.g., a
+// caller-provided buffer ('bdlsb::FixedMemOutStreamBuf'), or a blob of
+// fixed-size segments ('bdlbb::OutBlobStreamBuf').  Both streams convert
+// arrays of fixed-size values to network byte order in bulk (see
+// 'bslx_marshallingutil').
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
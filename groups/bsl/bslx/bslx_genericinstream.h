@@ -64,6 +64,13 @@ BSLS_IDENT("$Id: $")
 // The class 'bslx::StreambufInStream' is a 'typedef' for
 // 'bslx::GenericInStream<bsl::streambuf>'.
 //
+///Unexternalizing Large Arrays
+///----------------------------
+// The arrays of 16-, 32-, and 64-bit integers, and of 'float' and 'double'
+// values, are read from the 'STREAMBUF' in chunks of 512 bytes, each with a
+// single call to 'sgetn', and converted from network byte order in bulk (see
+// 'bslx_marshallingutil').
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.  The first example
@@ -507,6 +514,7 @@ BSLS_IDENT("$Id: $")
 #include <bslscm_version.h>
 
 #include <bslx_instreamfunctions.h>
+#include <bslx_marshallingutil.h>
 
 #include <bsls_assert.h>
 #include <bsls_performancehint.h>
@@ -554,6 +562,11 @@ class GenericInStream {
         k_SIZEOF_FLOAT32 = 4
     };
 
+    enum {
+        k_CHUNK_SIZE = 512  // size (in bytes) of the local buffer in which
+                            // arrays are read before being converted
+    };
+
     // DATA
     STREAMBUF *d_streamBuf;  // held stream to read from
 
@@ -566,6 +579,24 @@ class GenericInStream {
 
   private:
     // PRIVATE MANIPULATORS
+    template <class TYPE>
+    GenericInStream& getArrayInChunks(TYPE  *variables,
+                                      int    numVariables,
+                                      int    size,
+                                      void (*getArray)(TYPE       *,
+                                                       const char *,
+                                                       int));
+        // Extract from this stream the specified 'numVariables' values of the
+        // wire format of the specified 'size' bytes each, place them, as
+        // converted by the specified 'getArray' function, into the specified
+        // 'variables' array, and return a reference to this stream.  The
+        // values are read in chunks of at most 'k_CHUNK_SIZE' bytes, each
+        // with a single call to 'sgetn'.  If this stream is initially
+        // invalid, this operation has no effect.  If this function otherwise
+        // fails to extract a valid array, this stream is marked invalid and
+        // the value of 'variables' is undefined.  The behavior is undefined
+        // unless '0 <= numVariables' and '0 < size <= k_CHUNK_SIZE'.
+
     void validate();
         // Put this output stream into a valid state.  This function has no
         // effect if this stream is already valid.
@@ -1081,6 +1112,51 @@ GenericInStream<STREAMBUF>&
                         // ---------------------
 
 // PRIVATE MANIPULATORS
+template <class STREAMBUF>
+template <class TYPE>
+GenericInStream<STREAMBUF>&
+GenericInStream<STREAMBUF>::getArrayInChunks(TYPE  *variables,
+                                             int    numVariables,
+                                             int    size,
+                                             void (*getArray)(TYPE       *,
+                                                              const char *,
+                                                              int))
+{
+    BSLS_ASSERT(variables);
+    BSLS_ASSERT(0 <= numVariables);
+    BSLS_ASSERT(0 < size && size <= k_CHUNK_SIZE);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(   !isValid()
+                                              || 0 == numVariables)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    invalidate();
+
+    char      buffer[k_CHUNK_SIZE];
+    const int maxChunkLength = k_CHUNK_SIZE / size;
+
+    while (0 < numVariables) {
+        const int chunkLength = numVariables < maxChunkLength
+                                ? numVariables
+                                : maxChunkLength;
+        const int numBytes    = chunkLength * size;
+
+        if (numBytes != d_streamBuf->sgetn(buffer, numBytes)) {
+            return *this;                                             // RETURN
+        }
+        getArray(variables, buffer, chunkLength);
+
+        variables    += chunkLength;
+        numVariables -= chunkLength;
+    }
+
+    validate();
+
+    return *this;
+}
+
 template <class STREAMBUF>
 inline
 void GenericInStream<STREAMBUF>::validate()
@@ -1900,18 +1976,11 @@ GenericInStream<STREAMBUF>::getArrayInt64(bsls::Types::Int64 *variables,
     BSLS_ASSERT(variables);
     BSLS_ASSERT(0 <= numVariables);
 
-    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(   !isValid()
-                                              || 0 == numVariables)) {
-        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-        return *this;                                                 // RETURN
-    }
-
-    const bsls::Types::Int64 *end = variables + numVariables;
-    for (; variables != end; ++variables) {
-        getInt64(*variables);
-    }
-
-    return *this;
+    return getArrayInChunks<bsls::Types::Int64>(
+                                              variables,
+                                              numVariables,
+                                              k_SIZEOF_INT64,
+                                              &MarshallingUtil::getArrayInt64);
 }
 
 template <class STREAMBUF>
@@ -1922,18 +1991,11 @@ GenericInStream<STREAMBUF>::getArrayUint64(bsls::Types::Uint64 *variables,
     BSLS_ASSERT(variables);
     BSLS_ASSERT(0 <= numVariables);
 
-    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(   !isValid()
-                                              || 0 == numVariables)) {
-        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-        return *this;                                                 // RETURN
-    }
-
-    const bsls::Types::Uint64 *end = variables + numVariables;
-    for (; variables != end; ++variables) {
-        getUint64(*variables);
-    }
-
-    return *this;
+    return getArrayInChunks<bsls::Types::Uint64>(
+                                             variables,
+                                             numVariables,
+                                             k_SIZEOF_INT64,
+                                             &MarshallingUtil::getArrayUint64);
 }
 
 template <class STREAMBUF>
@@ -2075,18 +2137,10 @@ GenericInStream<STREAMBUF>::getArrayInt32(int *variables, int numVariables)
     BSLS_ASSERT(variables);
     BSLS_ASSERT(0 <= numVariables);
 
-    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(   !isValid()
-                                              || 0 == numVariables)) {
-        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-        return *this;                                                 // RETURN
-    }
-
-    const int *end = variables + numVariables;
-    for (; variables != end; ++variables) {
-        getInt32(*variables);
-    }
-
-    return *this;
+    return getArrayInChunks<int>(variables,
+                                 numVariables,
+                                 k_SIZEOF_INT32,
+                                 &MarshallingUtil::getArrayInt32);
 }
 
 template <class STREAMBUF>
@@ -2097,18 +2151,10 @@ GenericInStream<STREAMBUF>::getArrayUint32(unsigned int *variables,
     BSLS_ASSERT(variables);
     BSLS_ASSERT(0 <= numVariables);
 
-    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(   !isValid()
-                                              || 0 == numVariables)) {
-        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-        return *this;                                                 // RETURN
-    }
-
-    const unsigned int *end = variables + numVariables;
-    for (; variables != end; ++variables) {
-        getUint32(*variables);
-    }
-
-    return *this;
+    return getArrayInChunks<unsigned int>(variables,
+                                          numVariables,
+                                          k_SIZEOF_INT32,
+                                          &MarshallingUtil::getArrayUint32);
 }
 
 template <class STREAMBUF>
@@ -2162,18 +2208,10 @@ GenericInStream<STREAMBUF>::getArrayInt16(short *variables,
     BSLS_ASSERT(variables);
     BSLS_ASSERT(0 <= numVariables);
 
-    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(   !isValid()
-                                              || 0 == numVariables)) {
-        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-        return *this;                                                 // RETURN
-    }
-
-    const short *end = variables + numVariables;
-    for (; variables != end; ++variables) {
-        getInt16(*variables);
-    }
-
-    return *this;
+    return getArrayInChunks<short>(variables,
+                                   numVariables,
+                                   k_SIZEOF_INT16,
+                                   &MarshallingUtil::getArrayInt16);
 }
 
 template <class STREAMBUF>
@@ -2184,18 +2222,10 @@ GenericInStream<STREAMBUF>::getArrayUint16(unsigned short *variables,
     BSLS_ASSERT(variables);
     BSLS_ASSERT(0 <= numVariables);
 
-    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(   !isValid()
-                                              || 0 == numVariables)) {
-        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-        return *this;                                                 // RETURN
-    }
-
-    const unsigned short *end = variables + numVariables;
-    for (; variables != end; ++variables) {
-        getUint16(*variables);
-    }
-
-    return *this;
+    return getArrayInChunks<unsigned short>(variables,
+                                            numVariables,
+                                            k_SIZEOF_INT16,
+                                            &MarshallingUtil::getArrayUint16);
 }
 
 template <class STREAMBUF>
@@ -2266,18 +2296,10 @@ GenericInStream<STREAMBUF>::getArrayFloat64(double *variables,
     BSLS_ASSERT(variables);
     BSLS_ASSERT(0 <= numVariables);
 
-    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(   !isValid()
-                                              || 0 == numVariables)) {
-        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-        return *this;                                                 // RETURN
-    }
-
-    const double *end = variables + numVariables;
-    for (; variables != end; ++variables) {
-        getFloat64(*variables);
-    }
-
-    return *this;
+    return getArrayInChunks<double>(variables,
+                                    numVariables,
+                                    k_SIZEOF_FLOAT64,
+                                    &MarshallingUtil::getArrayFloat64);
 }
 
 template <class STREAMBUF>
@@ -2288,18 +2310,10 @@ GenericInStream<STREAMBUF>::getArrayFloat32(float *variables,
     BSLS_ASSERT(variables);
     BSLS_ASSERT(0 <= numVariables);
 
-    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(   !isValid()
-                                              || 0 == numVariables)) {
-        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-        return *this;                                                 // RETURN
-    }
-
-    const float *end = variables + numVariables;
-    for (; variables != end; ++variables) {
-        getFloat32(*variables);
-    }
-
-    return *this;
+    return getArrayInChunks<float>(variables,
+                                   numVariables,
+                                   k_SIZEOF_FLOAT32,
+                                   &MarshallingUtil::getArrayFloat32);
 }
 
 // ACCESSORS
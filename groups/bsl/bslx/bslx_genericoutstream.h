@@ -59,6 +59,18 @@ BSLS_IDENT("$Id: $")
 // The class 'bslx::StreambufOutStream' is a 'typedef' of
 // 'bslx::GenericOutStream<bsl::streambuf>'.
 //
+///Externalizing Large Arrays
+///--------------------------
+// The arrays of 16-, 32-, and 64-bit integers, and of 'float' and 'double'
+// values, are converted to network byte order in bulk (see
+// 'bslx_marshallingutil') into a local buffer, and written to the 'STREAMBUF'
+// in chunks of 512 bytes, each with a single call to 'sputn'.  Hence, a
+// 'bslx::GenericOutStream' is an efficient means to externalize large
+// payloads directly into storage managed by the 'STREAMBUF' -- e.g., a
+// caller-provided buffer ('bdlsb::FixedMemOutStreamBuf'), or a sequence of
+// fixed-size segments ('bdlbb::OutBlobStreamBuf') -- avoiding the copies made
+// by the regrowth of the contiguous buffer of 'bslx::ByteOutStream'.
+//
 ///Versioning
 ///----------
 // BDEX provides two concepts that support versioning the BDEX serialization
@@ -286,6 +298,7 @@ BSLS_IDENT("$Id: $")
 
 #include <bslscm_version.h>
 
+#include <bslx_marshallingutil.h>
 #include <bslx_outstreamfunctions.h>
 
 #include <bsls_assert.h>
@@ -332,6 +345,11 @@ class GenericOutStream {
         k_SIZEOF_FLOAT32 = 4
     };
 
+    enum {
+        k_CHUNK_SIZE = 512  // size (in bytes) of the local buffer in which
+                            // arrays are converted before being written
+    };
+
     // DATA
     STREAMBUF *d_streamBuf;        // held stream to write to
 
@@ -348,6 +366,23 @@ class GenericOutStream {
 
   private:
     // PRIVATE MANIPULATORS
+    template <class TYPE>
+    GenericOutStream& putArrayInChunks(
+                                   const TYPE *values,
+                                   int         numValues,
+                                   int         size,
+                                   void      (*putArray)(char       *,
+                                                         const TYPE *,
+                                                         int));
+        // Write to this stream the specified 'numValues' elements of the
+        // specified 'values', converted to the wire format of the specified
+        // 'size' bytes each by the specified 'putArray' function, and return
+        // a reference to this stream.  The values are converted in chunks of
+        // at most 'k_CHUNK_SIZE' bytes, each written with a single call to
+        // 'sputn'.  If this stream is initially invalid, this operation has
+        // no effect.  The behavior is undefined unless '0 <= numValues' and
+        // '0 < size <= k_CHUNK_SIZE'.
+
     void validate();
         // Put this output stream into a valid state.  This function has no
         // effect if this stream is already valid.
@@ -766,6 +801,50 @@ operator<<(GenericOutStream<STREAMBUF>& stream, const TYPE& value);
                         // ----------------------
 
 // PRIVATE MANIPULATORS
+template <class STREAMBUF>
+template <class TYPE>
+GenericOutStream<STREAMBUF>&
+GenericOutStream<STREAMBUF>::putArrayInChunks(
+                                   const TYPE *values,
+                                   int         numValues,
+                                   int         size,
+                                   void      (*putArray)(char       *,
+                                                         const TYPE *,
+                                                         int))
+{
+    BSLS_ASSERT(values);
+    BSLS_ASSERT(0 <= numValues);
+    BSLS_ASSERT(0 < size && size <= k_CHUNK_SIZE);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid() || 0 == numValues)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    invalidate();
+
+    char      buffer[k_CHUNK_SIZE];
+    const int maxChunkLength = k_CHUNK_SIZE / size;
+
+    while (0 < numValues) {
+        const int chunkLength = numValues < maxChunkLength ? numValues
+                                                           : maxChunkLength;
+        const int numBytes    = chunkLength * size;
+
+        putArray(buffer, values, chunkLength);
+        if (numBytes != d_streamBuf->sputn(buffer, numBytes)) {
+            return *this;                                             // RETURN
+        }
+
+        values    += chunkLength;
+        numValues -= chunkLength;
+    }
+
+    validate();
+
+    return *this;
+}
+
 template <class STREAMBUF>
 inline
 void GenericOutStream<STREAMBUF>::validate()
@@ -1242,17 +1321,11 @@ GenericOutStream<STREAMBUF>::putArrayInt64(const bsls::Types::Int64 *values,
     BSLS_ASSERT(values);
     BSLS_ASSERT(0 <= numValues);
 
-    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid() || 0 == numValues)) {
-        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-        return *this;                                                 // RETURN
-    }
-
-    const bsls::Types::Int64 *end = values + numValues;
-    for (; values != end; ++values) {
-        putInt64(*values);
-    }
-
-    return *this;
+    return putArrayInChunks<bsls::Types::Int64>(
+                                              values,
+                                              numValues,
+                                              k_SIZEOF_INT64,
+                                              &MarshallingUtil::putArrayInt64);
 }
 
 template <class STREAMBUF>
@@ -1264,17 +1337,11 @@ GenericOutStream<STREAMBUF>::putArrayUint64(
     BSLS_ASSERT(values);
     BSLS_ASSERT(0 <= numValues);
 
-    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid() || 0 == numValues)) {
-        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-        return *this;                                                 // RETURN
-    }
-
-    const bsls::Types::Uint64 *end = values + numValues;
-    for (; values != end; ++values) {
-        putUint64(*values);
-    }
-
-    return *this;
+    return putArrayInChunks<bsls::Types::Uint64>(
+                                              values,
+                                              numValues,
+                                              k_SIZEOF_INT64,
+                                              &MarshallingUtil::putArrayInt64);
 }
 
 template <class STREAMBUF>
@@ -1413,17 +1480,10 @@ GenericOutStream<STREAMBUF>::putArrayInt32(const int *values, int numValues)
     BSLS_ASSERT(values);
     BSLS_ASSERT(0 <= numValues);
 
-    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid() || 0 == numValues)) {
-        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-        return *this;                                                 // RETURN
-    }
-
-    const int *end = values + numValues;
-    for (; values != end; ++values) {
-        putInt32(*values);
-    }
-
-    return *this;
+    return putArrayInChunks<int>(values,
+                                 numValues,
+                                 k_SIZEOF_INT32,
+                                 &MarshallingUtil::putArrayInt32);
 }
 
 template <class STREAMBUF>
@@ -1434,17 +1494,10 @@ GenericOutStream<STREAMBUF>::putArrayUint32(const unsigned int *values,
     BSLS_ASSERT(values);
     BSLS_ASSERT(0 <= numValues);
 
-    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid() || 0 == numValues)) {
-        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-        return *this;                                                 // RETURN
-    }
-
-    const unsigned int *end = values + numValues;
-    for (; values != end; ++values) {
-        putUint32(*values);
-    }
-
-    return *this;
+    return putArrayInChunks<unsigned int>(values,
+                                          numValues,
+                                          k_SIZEOF_INT32,
+                                          &MarshallingUtil::putArrayInt32);
 }
 
 template <class STREAMBUF>
@@ -1495,17 +1548,10 @@ GenericOutStream<STREAMBUF>::putArrayInt16(const short *values, int numValues)
     BSLS_ASSERT(values);
     BSLS_ASSERT(0 <= numValues);
 
-    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid() || 0 == numValues)) {
-        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-        return *this;                                                 // RETURN
-    }
-
-    const short *end = values + numValues;
-    for (; values != end; ++values) {
-        putInt16(*values);
-    }
-
-    return *this;
+    return putArrayInChunks<short>(values,
+                                   numValues,
+                                   k_SIZEOF_INT16,
+                                   &MarshallingUtil::putArrayInt16);
 }
 
 template <class STREAMBUF>
@@ -1516,17 +1562,10 @@ GenericOutStream<STREAMBUF>::putArrayUint16(const unsigned short *values,
     BSLS_ASSERT(values);
     BSLS_ASSERT(0 <= numValues);
 
-    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid() || 0 == numValues)) {
-        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-        return *this;                                                 // RETURN
-    }
-
-    const unsigned short *end = values + numValues;
-    for (; values != end; ++values) {
-        putUint16(*values);
-    }
-
-    return *this;
+    return putArrayInChunks<unsigned short>(values,
+                                            numValues,
+                                            k_SIZEOF_INT16,
+                                            &MarshallingUtil::putArrayInt16);
 }
 
 template <class STREAMBUF>
@@ -1631,17 +1670,10 @@ GenericOutStream<STREAMBUF>::putArrayFloat64(const double *values,
     BSLS_ASSERT(values);
     BSLS_ASSERT(0 <= numValues);
 
-    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid() || 0 == numValues)) {
-        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-        return *this;                                                 // RETURN
-    }
-
-    const double *end = values + numValues;
-    for (; values != end; ++values) {
-        putFloat64(*values);
-    }
-
-    return *this;
+    return putArrayInChunks<double>(values,
+                                    numValues,
+                                    k_SIZEOF_FLOAT64,
+                                    &MarshallingUtil::putArrayFloat64);
 }
 
 template <class STREAMBUF>
@@ -1652,17 +1684,10 @@ GenericOutStream<STREAMBUF>::putArrayFloat32(const float *values,
     BSLS_ASSERT(values);
     BSLS_ASSERT(0 <= numValues);
 
-    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid() || 0 == numValues)) {
-        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-        return *this;                                                 // RETURN
-    }
-
-    const float *end = values + numValues;
-    for (; values != end; ++values) {
-        putFloat32(*values);
-    }
-
-    return *this;
+    return putArrayInChunks<float>(values,
+                                   numValues,
+                                   k_SIZEOF_FLOAT32,
+                                   &MarshallingUtil::putArrayFloat32);
 }
 
 // ACCESSORS
@@ -4,8 +4,226 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(bslx_marshallingutil_cpp,"$Id$ $CSID$")
 
+#include <bsls_atomicoperations.h>
+
+#include <bsl_cstddef.h>
+
+#if defined(BSLS_PLATFORM_CPU_X86_64)                                         \
+ && (defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG))
+# define BSLX_MARSHALLINGUTIL_SIMD 1
+# define BSLX_MARSHALLINGUTIL_TARGET_SSSE3 __attribute__((target("ssse3")))
+# define BSLX_MARSHALLINGUTIL_TARGET_AVX2  __attribute__((target("avx2")))
+# include <cpuid.h>
+# include <immintrin.h>
+#endif
+
+///Implementation Notes
+///--------------------
+// The arrays of 16-, 32-, and 64-bit integers, and of 'float' and 'double'
+// values, whose in-memory size matches their size in the wire format, are
+// converted between host and network byte order in bulk by 'u::convertArray'
+// rather than one value at a time.  On big-endian platforms the conversion is
+// a 'memcpy'.  On little-endian platforms the bytes of each value are
+// reversed, 32 bytes at a time using the 'vpshufb' instruction of AVX2, and
+// 16 bytes at a time using the 'pshufb' instruction of SSSE3, when the
+// processor supports them (as determined once, by the 'CPUID' instruction),
+// with the remaining bytes reversed by a portable loop.  Note that the
+// reversal of the bytes of each value is its own inverse, so the same kernel
+// serves both the 'put' and the 'get' functions.
+
 namespace BloombergLP {
 namespace bslx {
+namespace {
+namespace u {
+
+enum InstructionSet {
+    // Enumerate the instruction sets used to reverse the bytes of the values
+    // of an array, in increasing order of capability.
+
+    e_PORTABLE = 0,
+    e_SSSE3    = 1,
+    e_AVX2     = 2
+};
+
+#if BSLS_PLATFORM_IS_LITTLE_ENDIAN
+template <int SIZE>
+void reverseBytesPortable(char        *destination,
+                          const char  *source,
+                          bsl::size_t  numBytes)
+    // Load into the specified 'destination' the specified 'numBytes' bytes of
+    // the specified 'source', reversing the order of the bytes of each
+    // (template parameter) 'SIZE'-byte value.  The behavior is undefined
+    // unless 'numBytes' is a multiple of 'SIZE' and 'destination' and
+    // 'source' do not overlap.
+{
+    const char *end = source + numBytes;
+    for (; source != end; source += SIZE, destination += SIZE) {
+        for (int i = 0; i < SIZE; ++i) {
+            destination[i] = source[SIZE - 1 - i];
+        }
+    }
+}
+#endif
+
+#if defined(BSLX_MARSHALLINGUTIL_SIMD)
+const char k_SHUFFLE_MASKS[3][16] = {
+    // Masks of 'pshufb' reversing the bytes of each 2-, 4-, and 8-byte value
+    // of a 16-byte vector, respectively.
+
+    { 1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14 },
+    { 3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12 },
+    { 7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8 }
+};
+
+int detectInstructionSet()
+    // Return the most capable 'InstructionSet' supported by the processor and
+    // the operating system.
+{
+    unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)
+     || !(ecx & (1u << 9))) {                     // 'CPUID.01H:ECX.SSSE3[9]'
+        return e_PORTABLE;                                            // RETURN
+    }
+
+    // AVX2 requires the operating system to save the 'ymm' registers, as
+    // reported by 'XGETBV' if 'CPUID.01H:ECX.OSXSAVE[27]' is set.
+
+    const unsigned int k_OSXSAVE_AVX = (1u << 27) | (1u << 28);
+    if ((ecx & k_OSXSAVE_AVX) != k_OSXSAVE_AVX) {
+        return e_SSSE3;                                               // RETURN
+    }
+
+    unsigned int xcr0Low = 0, xcr0High = 0;
+    __asm__ __volatile__("xgetbv" : "=a"(xcr0Low), "=d"(xcr0High) : "c"(0));
+    if (6 != (xcr0Low & 6) || __get_cpuid_max(0, 0) < 7) {
+        return e_SSSE3;                                               // RETURN
+    }
+
+    __cpuid_count(7, 0, eax, ebx, ecx, edx);
+    return ebx & (1u << 5) ? e_AVX2 : e_SSSE3;    // 'CPUID.07H:EBX.AVX2[5]'
+}
+
+int instructionSet()
+    // Return the most capable 'InstructionSet' supported by the processor and
+    // the operating system, detecting it on first use.
+{
+    static bsls::AtomicOperations::AtomicTypes::Int cached = { -1 };
+
+    int result = bsls::AtomicOperations::getIntRelaxed(&cached);
+    if (result < 0) {
+        result = detectInstructionSet();
+        bsls::AtomicOperations::setIntRelaxed(&cached, result);
+    }
+
+    return result;
+}
+
+BSLX_MARSHALLINGUTIL_TARGET_SSSE3
+bsl::size_t reverseBytesSsse3(char        *destination,
+                              const char  *source,
+                              bsl::size_t  numBytes,
+                              const char  *mask)
+    // Load into the specified 'destination' the bytes of the specified
+    // 'source' shuffled, 16 at a time, by the specified 'mask', for as many
+    // whole 16-byte vectors as the specified 'numBytes' contains, and return
+    // the number of bytes loaded.  The behavior is undefined unless the
+    // processor supports SSSE3.
+{
+    const __m128i shuffle =
+                      _mm_loadu_si128(reinterpret_cast<const __m128i *>(mask));
+
+    bsl::size_t offset = 0;
+    for (; offset + 16 <= numBytes; offset += 16) {
+        const __m128i value = _mm_loadu_si128(
+                           reinterpret_cast<const __m128i *>(source + offset));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(destination + offset),
+                         _mm_shuffle_epi8(value, shuffle));
+    }
+    return offset;
+}
+
+BSLX_MARSHALLINGUTIL_TARGET_AVX2
+bsl::size_t reverseBytesAvx2(char        *destination,
+                             const char  *source,
+                             bsl::size_t  numBytes,
+                             const char  *mask)
+    // Load into the specified 'destination' the bytes of the specified
+    // 'source' shuffled, 16 at a time, by the specified 'mask', for as many
+    // whole 32-byte vectors as the specified 'numBytes' contains, and return
+    // the number of bytes loaded.  The behavior is undefined unless the
+    // processor supports AVX2.
+{
+    const __m256i shuffle = _mm256_broadcastsi128_si256(
+                     _mm_loadu_si128(reinterpret_cast<const __m128i *>(mask)));
+
+    bsl::size_t offset = 0;
+    for (; offset + 32 <= numBytes; offset += 32) {
+        const __m256i value = _mm256_loadu_si256(
+                           reinterpret_cast<const __m256i *>(source + offset));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(destination + offset),
+                            _mm256_shuffle_epi8(value, shuffle));
+    }
+    return offset;
+}
+#endif
+
+void convertArray(char       *destination,
+                  const char *source,
+                  int         numValues,
+                  int         size)
+    // Load into the specified 'destination' the specified 'numValues' values
+    // of the specified 'size' bytes each at the specified 'source', converted
+    // between host and network byte order.  The behavior is undefined unless
+    // 'size' is 2, 4, or 8, and 'destination' and 'source' do not overlap.
+{
+    BSLS_ASSERT(2 == size || 4 == size || 8 == size);
+
+    const bsl::size_t numBytes = static_cast<bsl::size_t>(numValues) * size;
+
+#if BSLS_PLATFORM_IS_LITTLE_ENDIAN
+    bsl::size_t offset = 0;
+
+# if defined(BSLX_MARSHALLINGUTIL_SIMD)
+    if (numBytes >= 16) {
+        const int   set  = instructionSet();
+        const char *mask = k_SHUFFLE_MASKS[2 == size ? 0 : 4 == size ? 1 : 2];
+
+        if (e_AVX2 == set) {
+            offset = reverseBytesAvx2(destination, source, numBytes, mask);
+        }
+        if (e_PORTABLE != set) {
+            offset += reverseBytesSsse3(destination + offset,
+                                        source + offset,
+                                        numBytes - offset,
+                                        mask);
+        }
+    }
+# endif
+
+    switch (size) {
+      case 2: {
+        reverseBytesPortable<2>(destination + offset,
+                                source + offset,
+                                numBytes - offset);
+      } break;
+      case 4: {
+        reverseBytesPortable<4>(destination + offset,
+                                source + offset,
+                                numBytes - offset);
+      } break;
+      default: {
+        reverseBytesPortable<8>(destination + offset,
+                                source + offset,
+                                numBytes - offset);
+      } break;
+    }
+#else
+    bsl::memcpy(destination, source, numBytes);
+#endif
+}
+
+}  // close namespace u
+}  // close unnamed namespace
 
                         // ----------------------
                         // struct MarshallingUtil
@@ -23,6 +241,14 @@ void MarshallingUtil::putArrayInt64(char                     *buffer,
     BSLS_ASSERT(values);
     BSLS_ASSERT(0 <= numValues);
 
+    if (sizeof *values == k_SIZEOF_INT64) {
+        u::convertArray(buffer,
+                        reinterpret_cast<const char *>(values),
+                        numValues,
+                        k_SIZEOF_INT64);
+        return;                                                       // RETURN
+    }
+
     const bsls::Types::Int64 *end = values + numValues;
     for (; values != end; ++values) {
         putInt64(buffer, *values);
@@ -38,6 +264,14 @@ void MarshallingUtil::putArrayInt64(char                      *buffer,
     BSLS_ASSERT(values);
     BSLS_ASSERT(0 <= numValues);
 
+    if (sizeof *values == k_SIZEOF_INT64) {
+        u::convertArray(buffer,
+                        reinterpret_cast<const char *>(values),
+                        numValues,
+                        k_SIZEOF_INT64);
+        return;                                                       // RETURN
+    }
+
     const bsls::Types::Uint64 *end = values + numValues;
     for (; values != end; ++values) {
         putInt64(buffer, *values);
@@ -143,6 +377,14 @@ void MarshallingUtil::putArrayInt32(char      *buffer,
     BSLS_ASSERT(values);
     BSLS_ASSERT(0 <= numValues);
 
+    if (sizeof *values == k_SIZEOF_INT32) {
+        u::convertArray(buffer,
+                        reinterpret_cast<const char *>(values),
+                        numValues,
+                        k_SIZEOF_INT32);
+        return;                                                       // RETURN
+    }
+
     const int *end = values + numValues;
     for (; values != end; ++values) {
         putInt32(buffer, *values);
@@ -158,6 +400,14 @@ void MarshallingUtil::putArrayInt32(char               *buffer,
     BSLS_ASSERT(values);
     BSLS_ASSERT(0 <= numValues);
 
+    if (sizeof *values == k_SIZEOF_INT32) {
+        u::convertArray(buffer,
+                        reinterpret_cast<const char *>(values),
+                        numValues,
+                        k_SIZEOF_INT32);
+        return;                                                       // RETURN
+    }
+
     const unsigned int *end = values + numValues;
     for (; values != end; ++values) {
         putInt32(buffer, *values);
@@ -203,6 +453,14 @@ void MarshallingUtil::putArrayInt16(char        *buffer,
     BSLS_ASSERT(values);
     BSLS_ASSERT(0 <= numValues);
 
+    if (sizeof *values == k_SIZEOF_INT16) {
+        u::convertArray(buffer,
+                        reinterpret_cast<const char *>(values),
+                        numValues,
+                        k_SIZEOF_INT16);
+        return;                                                       // RETURN
+    }
+
     const short *end = values + numValues;
     for (; values != end; ++values) {
         putInt16(buffer, *values);
@@ -218,6 +476,14 @@ void MarshallingUtil::putArrayInt16(char                 *buffer,
     BSLS_ASSERT(values);
     BSLS_ASSERT(0 <= numValues);
 
+    if (sizeof *values == k_SIZEOF_INT16) {
+        u::convertArray(buffer,
+                        reinterpret_cast<const char *>(values),
+                        numValues,
+                        k_SIZEOF_INT16);
+        return;                                                       // RETURN
+    }
+
     const unsigned short *end = values + numValues;
     for (; values != end; ++values) {
         putInt16(buffer, *values);
@@ -235,6 +501,14 @@ void MarshallingUtil::putArrayFloat64(char         *buffer,
     BSLS_ASSERT(values);
     BSLS_ASSERT(0 <= numValues);
 
+    if (sizeof *values == k_SIZEOF_FLOAT64) {
+        u::convertArray(buffer,
+                        reinterpret_cast<const char *>(values),
+                        numValues,
+                        k_SIZEOF_FLOAT64);
+        return;                                                       // RETURN
+    }
+
     const double *end = values + numValues;
     for (; values < end; ++values) {
         putFloat64(buffer, *values);
@@ -250,6 +524,14 @@ void MarshallingUtil::putArrayFloat32(char        *buffer,
     BSLS_ASSERT(values);
     BSLS_ASSERT(0 <= numValues);
 
+    if (sizeof *values == k_SIZEOF_FLOAT32) {
+        u::convertArray(buffer,
+                        reinterpret_cast<const char *>(values),
+                        numValues,
+                        k_SIZEOF_FLOAT32);
+        return;                                                       // RETURN
+    }
+
     const float *end = values + numValues;
     for (; values < end; ++values) {
         putFloat32(buffer, *values);
@@ -267,6 +549,14 @@ void MarshallingUtil::getArrayInt64(bsls::Types::Int64 *variables,
     BSLS_ASSERT(buffer);
     BSLS_ASSERT(0 <= numVariables);
 
+    if (sizeof *variables == k_SIZEOF_INT64) {
+        u::convertArray(reinterpret_cast<char *>(variables),
+                        buffer,
+                        numVariables,
+                        k_SIZEOF_INT64);
+        return;                                                       // RETURN
+    }
+
     const bsls::Types::Int64 *end = variables + numVariables;
     for (; variables != end; ++variables) {
         getInt64(variables, buffer);
@@ -282,6 +572,14 @@ void MarshallingUtil::getArrayUint64(bsls::Types::Uint64 *variables,
     BSLS_ASSERT(buffer);
     BSLS_ASSERT(0 <= numVariables);
 
+    if (sizeof *variables == k_SIZEOF_INT64) {
+        u::convertArray(reinterpret_cast<char *>(variables),
+                        buffer,
+                        numVariables,
+                        k_SIZEOF_INT64);
+        return;                                                       // RETURN
+    }
+
     const bsls::Types::Uint64 *end = variables + numVariables;
     for (; variables != end; ++variables) {
         getUint64(variables, buffer);
@@ -387,6 +685,14 @@ void MarshallingUtil::getArrayInt32(int        *variables,
     BSLS_ASSERT(buffer);
     BSLS_ASSERT(0 <= numVariables);
 
+    if (sizeof *variables == k_SIZEOF_INT32) {
+        u::convertArray(reinterpret_cast<char *>(variables),
+                        buffer,
+                        numVariables,
+                        k_SIZEOF_INT32);
+        return;                                                       // RETURN
+    }
+
     const int *end = variables + numVariables;
     for (; variables != end; ++variables) {
         getInt32(variables, buffer);
@@ -402,6 +708,14 @@ void MarshallingUtil::getArrayUint32(unsigned int *variables,
     BSLS_ASSERT(buffer);
     BSLS_ASSERT(0 <= numVariables);
 
+    if (sizeof *variables == k_SIZEOF_INT32) {
+        u::convertArray(reinterpret_cast<char *>(variables),
+                        buffer,
+                        numVariables,
+                        k_SIZEOF_INT32);
+        return;                                                       // RETURN
+    }
+
     const unsigned int *end = variables + numVariables;
     for (; variables != end; ++variables) {
         getUint32(variables, buffer);
@@ -447,6 +761,14 @@ void MarshallingUtil::getArrayInt16(short      *variables,
     BSLS_ASSERT(buffer);
     BSLS_ASSERT(0 <= numVariables);
 
+    if (sizeof *variables == k_SIZEOF_INT16) {
+        u::convertArray(reinterpret_cast<char *>(variables),
+                        buffer,
+                        numVariables,
+                        k_SIZEOF_INT16);
+        return;                                                       // RETURN
+    }
+
     const short *end = variables + numVariables;
     for (; variables != end; ++variables) {
         getInt16(variables, buffer);
@@ -462,6 +784,14 @@ void MarshallingUtil::getArrayUint16(unsigned short *variables,
     BSLS_ASSERT(buffer);
     BSLS_ASSERT(0 <= numVariables);
 
+    if (sizeof *variables == k_SIZEOF_INT16) {
+        u::convertArray(reinterpret_cast<char *>(variables),
+                        buffer,
+                        numVariables,
+                        k_SIZEOF_INT16);
+        return;                                                       // RETURN
+    }
+
     const unsigned short *end = variables + numVariables;
     for (; variables != end; ++variables) {
         getUint16(variables, buffer);
@@ -479,6 +809,14 @@ void MarshallingUtil::getArrayFloat64(double     *variables,
     BSLS_ASSERT(buffer);
     BSLS_ASSERT(0 <= numVariables);
 
+    if (sizeof *variables == k_SIZEOF_FLOAT64) {
+        u::convertArray(reinterpret_cast<char *>(variables),
+                        buffer,
+                        numVariables,
+                        k_SIZEOF_FLOAT64);
+        return;                                                       // RETURN
+    }
+
     const double *end = variables + numVariables;
     for (; variables != end; ++variables) {
         getFloat64(variables, buffer);
@@ -494,6 +832,14 @@ void MarshallingUtil::getArrayFloat32(float      *variables,
     BSLS_ASSERT(buffer);
     BSLS_ASSERT(0 <= numVariables);
 
+    if (sizeof *variables == k_SIZEOF_FLOAT32) {
+        u::convertArray(reinterpret_cast<char *>(variables),
+                        buffer,
+                        numVariables,
+                        k_SIZEOF_FLOAT32);
+        return;                                                       // RETURN
+    }
+
     const float *end = variables + numVariables;
     for (; variables != end; ++variables) {
         getFloat32(variables, buffer);
@@ -504,6 +850,10 @@ void MarshallingUtil::getArrayFloat32(float      *variables,
 }  // close package namespace
 }  // close enterprise namespace
 
+#undef BSLX_MARSHALLINGUTIL_SIMD
+#undef BSLX_MARSHALLINGUTIL_TARGET_SSSE3
+#undef BSLX_MARSHALLINGUTIL_TARGET_AVX2
+
 // ----------------------------------------------------------------------------
 // Copyright 2014 Bloomberg Finance L.P.
 //
@@ -156,6 +156,19 @@ BSLS_IDENT("$Id: $")
 //    LSB                              MSB
 //..
 //
+///Performance of Array Functions
+///------------------------------
+// The 'putArray' and 'getArray' functions for 16-, 32-, and 64-bit integers,
+// and for 'float' and 'double' values, convert the whole array at once when
+// the size of the C++ type matches the size of its wire format (e.g., 'int'
+// and 32 bits), which is the case on all supported platforms.  On
+// little-endian x86-64 processors, the bytes of 16 (SSSE3) or 32 (AVX2)
+// bytes of values are reversed by a single instruction, the most capable
+// instruction set supported by the processor being determined at run-time;
+// other platforms use a portable loop, and big-endian platforms a 'memcpy'.
+// The other array functions convert the values one at a time.  Note that
+// 'buffer' and the array of values must not overlap.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -6,6 +6,7 @@
 #include <bsls_asserttest.h>
 #include <bsls_bsltestutil.h>
 #include <bsls_platform.h>
+#include <bsls_types.h>
 
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
@@ -115,7 +116,8 @@ using namespace bslx;
 // [ 2] EXPLORE DOUBLE FORMAT -- make sure format is IEEE-COMPLIANT
 // [ 3] EXPLORE FLOAT FORMAT -- make sure format is IEEE-COMPLIANT
 // [24] STRESS TEST - Used to determine performance characteristics.
-// [25] USAGE EXAMPLE
+// [25] BULK CONVERSION OF ARRAYS
+// [26] USAGE EXAMPLE
 // ----------------------------------------------------------------------------
 
 // ============================================================================
@@ -322,6 +324,87 @@ static void printFloat(ostream& stream, float number)
     printFloatBits(stream, number) << ": " << number << endl;
 }
 
+// ============================================================================
+//                      FUNCTIONS TO VERIFY BULK CONVERSION
+// ----------------------------------------------------------------------------
+
+static bsls::Types::Uint64 nextRandom(bsls::Types::Uint64 *state)
+    // Return the next value of the pseudo-random sequence whose state is the
+    // specified 'state', and update 'state'.
+{
+    *state = *state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return *state ^ (*state >> 29);
+}
+
+template <class TYPE, class PUT_TYPE>
+void testBulkConversion(void (*putArray)(char *, const TYPE *, int),
+                        void (*getArray)(TYPE *, const char *, int),
+                        void (*put)(char *, PUT_TYPE),
+                        void (*get)(TYPE *, const char *),
+                        int    size,
+                        bool   veryVerbose)
+    // Verify that the specified 'putArray' and 'getArray' functions, which
+    // convert arrays of values of the parameterized 'TYPE' to and from
+    // elements of the specified 'size' bytes, produce the same results as the
+    // specified 'put' and 'get' functions applied to each element, for arrays
+    // of 0 to 130 elements at each of the first 4 offsets of the buffer.  If
+    // the specified 'veryVerbose' is 'true', print 'size'.  Note that 130
+    // elements exceed several 32-byte blocks for every element size, and that
+    // the lengths cover every number of elements remaining after the blocks.
+{
+    enum { k_MAX_LENGTH = 130, k_MAX_OFFSET = 4, k_MAX_SIZE = 8 };
+
+    if (veryVerbose) { T_ P(size) }
+
+    bsls::Types::Uint64 state = size;
+
+    TYPE values[k_MAX_LENGTH];
+    for (int i = 0; i < k_MAX_LENGTH; ++i) {
+        values[i] = static_cast<TYPE>(
+                     static_cast<bsls::Types::Int64>(nextRandom(&state) >> 1));
+    }
+
+    char expected[k_MAX_LENGTH * k_MAX_SIZE];
+    for (int i = 0; i < k_MAX_LENGTH; ++i) {
+        put(expected + i * size, values[i]);
+    }
+
+    for (int offset = 0; offset < k_MAX_OFFSET; ++offset) {
+        for (int length = 0; length <= k_MAX_LENGTH; ++length) {
+            char buffer[k_MAX_OFFSET + k_MAX_LENGTH * k_MAX_SIZE + 1];
+            bsl::memset(buffer, 0x5a, sizeof buffer);
+
+            putArray(buffer + offset, values, length);
+
+            const int numBytes = length * size;
+
+            ASSERTV(size, offset, length,
+                    0 == bsl::memcmp(buffer + offset, expected, numBytes));
+            ASSERTV(size, offset, length, 0x5a == buffer[offset + numBytes]);
+            for (int i = 0; i < offset; ++i) {
+                ASSERTV(size, offset, length, i, 0x5a == buffer[i]);
+            }
+
+            TYPE results[k_MAX_LENGTH + 1];
+            bsl::memset(results, 0x5a, sizeof results);
+
+            getArray(results, buffer + offset, length);
+
+            for (int i = 0; i < length; ++i) {
+                TYPE value;
+                get(&value, expected + i * size);
+                ASSERTV(size, offset, length, i,
+                        0 == bsl::memcmp(&value, results + i, sizeof value));
+            }
+            const char *tail =
+                             reinterpret_cast<const char *>(results + length);
+            for (int i = 0; i < static_cast<int>(sizeof(TYPE)); ++i) {
+                ASSERTV(size, offset, length, i, 0x5a == tail[i]);
+            }
+        }
+    }
+}
+
 // ============================================================================
 //                               MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -335,7 +418,7 @@ int main(int argc, char *argv[]) {
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:
-      case 25: {
+      case 26: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -397,6 +480,89 @@ int main(int argc, char *argv[]) {
 //..
 
       } break;
+      case 25: {
+        // --------------------------------------------------------------------
+        // BULK CONVERSION OF ARRAYS
+        //   Verify the array functions converting blocks of elements at once.
+        //
+        // Concerns:
+        //: 1 The array functions for 16-, 32-, and 64-bit values, which
+        //:   convert blocks of elements at once, produce the same bytes and
+        //:   values as the functions converting a single element.
+        //:
+        //: 2 The result does not depend on the alignment of the buffer or on
+        //:   the number of elements remaining after the blocks.
+        //:
+        //: 3 No byte outside of the array is written.
+        //
+        // Plan:
+        //: 1 For each such array function, compare the results of 'putArray'
+        //:   and 'getArray' on arrays of 0 to 130 elements, at buffer offsets
+        //:   0 to 3, to the results of the single-element functions, and
+        //:   verify that the bytes around the result are unchanged.
+        //:   (C-1..3)
+        //
+        // Testing:
+        //   BULK CONVERSION OF ARRAYS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BULK CONVERSION OF ARRAYS" << endl
+                          << "=========================" << endl;
+
+        typedef bsls::Types::Int64  I64;
+        typedef bsls::Types::Uint64 U64;
+        typedef MarshallingUtil     Util;
+
+        testBulkConversion<I64, I64>(&Util::putArrayInt64,
+                                     &Util::getArrayInt64,
+                                     &Util::putInt64,
+                                     &Util::getInt64,
+                                     Util::k_SIZEOF_INT64,
+                                     veryVerbose);
+        testBulkConversion<U64, I64>(&Util::putArrayInt64,
+                                     &Util::getArrayUint64,
+                                     &Util::putInt64,
+                                     &Util::getUint64,
+                                     Util::k_SIZEOF_INT64,
+                                     veryVerbose);
+        testBulkConversion<int, int>(&Util::putArrayInt32,
+                                     &Util::getArrayInt32,
+                                     &Util::putInt32,
+                                     &Util::getInt32,
+                                     Util::k_SIZEOF_INT32,
+                                     veryVerbose);
+        testBulkConversion<unsigned int, int>(&Util::putArrayInt32,
+                                              &Util::getArrayUint32,
+                                              &Util::putInt32,
+                                              &Util::getUint32,
+                                              Util::k_SIZEOF_INT32,
+                                              veryVerbose);
+        testBulkConversion<short, int>(&Util::putArrayInt16,
+                                       &Util::getArrayInt16,
+                                       &Util::putInt16,
+                                       &Util::getInt16,
+                                       Util::k_SIZEOF_INT16,
+                                       veryVerbose);
+        testBulkConversion<unsigned short, int>(&Util::putArrayInt16,
+                                                &Util::getArrayUint16,
+                                                &Util::putInt16,
+                                                &Util::getUint16,
+                                                Util::k_SIZEOF_INT16,
+                                                veryVerbose);
+        testBulkConversion<double, double>(&Util::putArrayFloat64,
+                                           &Util::getArrayFloat64,
+                                           &Util::putFloat64,
+                                           &Util::getFloat64,
+                                           Util::k_SIZEOF_FLOAT64,
+                                           veryVerbose);
+        testBulkConversion<float, float>(&Util::putArrayFloat32,
+                                         &Util::getArrayFloat32,
+                                         &Util::putFloat32,
+                                         &Util::getFloat32,
+                                         Util::k_SIZEOF_FLOAT32,
+                                         veryVerbose);
+      } break;
       case 24: {
         // --------------------------------------------------------------------
         // STRESS TEST
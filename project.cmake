@@ -45,6 +45,7 @@ function(bdeproj_project_process_uors proj listDir)
         ${proj}
         ${listDir}/thirdparty/inteldfp
         ${listDir}/thirdparty/pcre2
+        ${listDir}/thirdparty/zstd
         ${listDir}/standalones/s_baltst
     )
 endfunction()
@@ -0,0 +1,95 @@
+// m_balllogcat.m.cpp                                                 -*-C++-*-
+
+//@PURPOSE: Print the content of compressed 'ball' log files.
+//
+//@DESCRIPTION: This application writes to standard output the decompressed
+// content of the compressed log files (see 'ball_compressedfilestreambuf')
+// named on its command line, in order, or of standard input if no file is
+// named.  A file that ends with an incomplete frame, such as a log file that
+// is still being written, is printed up to that frame, and reported with a
+// warning on standard error.  The exit status is 0 on success (including
+// incomplete trailing frames), and 1 if any file cannot be opened or read, or
+// contains a malformed frame.
+//
+///Usage
+///-----
+//..
+//  $ m_balllogcat.tsk server.log.20261019_101500 server.log | grep ERROR
+//..
+
+#include <ball_compressedfileutil.h>
+
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+
+using namespace BloombergLP;
+
+namespace {
+
+int printFile(const char *fileName)
+    // Write the decompressed content of the file having the specified
+    // 'fileName', or of standard input if 'fileName' is "-", to standard
+    // output, reporting any failure on standard error.  Return 0 on success,
+    // and a non-zero value otherwise.
+{
+    const bool isStdin = 0 == bsl::strcmp(fileName, "-");
+
+    const int rc = isStdin
+                 ? ball::CompressedFileUtil::decompress(bsl::cout, bsl::cin)
+                 : ball::CompressedFileUtil::decompressFile(bsl::cout,
+                                                            fileName);
+    bsl::cout.flush();
+
+    if (0 < rc) {
+        bsl::cerr << "m_balllogcat: warning: " << fileName
+                  << ": ends with an incomplete frame" << bsl::endl;
+    }
+    else if (0 > rc) {
+        bsl::cerr << "m_balllogcat: " << fileName
+                  << ": cannot decompress (rc = " << rc << ')' << bsl::endl;
+        return 1;                                                     // RETURN
+    }
+    return 0;
+}
+
+}  // close unnamed namespace
+
+int main(int argc, char *argv[])
+{
+    if (1 < argc && (0 == bsl::strcmp(argv[1], "-h")
+                  || 0 == bsl::strcmp(argv[1], "--help"))) {
+        bsl::cout << "usage: " << argv[0] << " [FILE]...\n"
+                  << "Print the content of compressed ball log files "
+                  << "(standard input if no FILE, or FILE is -)."
+                  << bsl::endl;
+        return 0;                                                     // RETURN
+    }
+
+    if (argc < 2) {
+        return printFile("-");                                        // RETURN
+    }
+
+    int status = 0;
+    for (int i = 1; i < argc; ++i) {
+        if (0 != printFile(argv[i])) {
+            status = 1;
+        }
+    }
+    return status;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,140 @@
+include(bde_utils)
+include(bde_struct)
+include(bde_uor)
+
+bde_prefixed_override(zstd process_standalone_package)
+function(zstd_process_standalone_package retUOR listFile isntallOpts)
+    bde_assert_no_extra_args()
+
+    get_filename_component(listDir ${listFile} DIRECTORY)
+    get_filename_component(rootDir ${listDir} DIRECTORY)
+
+    set(TARGET zstd)
+
+    set(headers
+        ${rootDir}/zstd.h
+        ${rootDir}/zstd_errors.h
+    )
+
+    set(sources
+        ${rootDir}/common/debug.c
+        ${rootDir}/common/entropy_common.c
+        ${rootDir}/common/error_private.c
+        ${rootDir}/common/fse_decompress.c
+        ${rootDir}/common/pool.c
+        ${rootDir}/common/threading.c
+        ${rootDir}/common/xxhash.c
+        ${rootDir}/common/zstd_common.c
+        ${rootDir}/compress/fse_compress.c
+        ${rootDir}/compress/hist.c
+        ${rootDir}/compress/huf_compress.c
+        ${rootDir}/compress/zstd_compress.c
+        ${rootDir}/compress/zstd_compress_literals.c
+        ${rootDir}/compress/zstd_compress_sequences.c
+        ${rootDir}/compress/zstd_compress_superblock.c
+        ${rootDir}/compress/zstd_double_fast.c
+        ${rootDir}/compress/zstd_fast.c
+        ${rootDir}/compress/zstd_lazy.c
+        ${rootDir}/compress/zstd_ldm.c
+        ${rootDir}/compress/zstd_opt.c
+        ${rootDir}/compress/zstd_preSplit.c
+        ${rootDir}/compress/zstdmt_compress.c
+        ${rootDir}/decompress/huf_decompress.c
+        ${rootDir}/decompress/zstd_ddict.c
+        ${rootDir}/decompress/zstd_decompress.c
+        ${rootDir}/decompress/zstd_decompress_block.c
+    )
+
+    bde_ufid_add_library(${TARGET} ${sources} ${headers})
+
+    # Set up PIC
+    # This code does not work in 3.8, but will be fixed in later versions.
+    # The -fPIC flag is set explicitely in the compile options for now.
+    if(${bde_ufid_is_shr} OR ${bde_ufid_is_pic})
+        set_target_properties(${TARGET} PROPERTIES POSITION_INDEPENDENT_CODE 1)
+    endif()
+
+    # Compile options and definitions.  The x86-64 assembly implementation of
+    # Huffman decoding is not vendored, and the library is built without its
+    # internal multithreading support.
+    target_compile_definitions(
+        ${TARGET}
+        PRIVATE
+            "ZSTD_DISABLE_ASM"
+    )
+
+    target_compile_options(
+        ${TARGET}
+        PRIVATE
+            # Compiler specific compile options.
+            $<$<C_COMPILER_ID:AppleClang>:
+                $<$<OR:${bde_ufid_is_shr},${bde_ufid_is_pic}>: -fPIC>
+            >
+            $<$<C_COMPILER_ID:Clang>:
+                $<$<OR:${bde_ufid_is_shr},${bde_ufid_is_pic}>: -fPIC>
+            >
+            $<$<C_COMPILER_ID:GNU>:
+                -fdiagnostics-show-option
+                -std=gnu99
+                $<$<OR:${bde_ufid_is_shr},${bde_ufid_is_pic}>: -fPIC>
+            >
+            $<$<C_COMPILER_ID:SunPro>:
+                -temp=/bb/data/tmp
+                $<$<OR:${bde_ufid_is_shr},${bde_ufid_is_pic}>: -xcode=pic32>
+            >
+            $<$<C_COMPILER_ID:XL>:
+                $<$<OR:${bde_ufid_is_shr},${bde_ufid_is_pic}>: -qpic>
+                $<${bde_ufid_is_mt}: -qthreaded>
+            >
+    )
+
+    target_compile_definitions(
+        ${TARGET}
+        PRIVATE
+            $<${bde_ufid_is_mt}: _REENTRANT>
+    )
+
+    get_filename_component(
+        EXTERNAL_INCLUDE_DIR
+        ${rootDir} DIRECTORY
+    )
+
+    target_include_directories(
+        ${TARGET}
+        PUBLIC
+            $<BUILD_INTERFACE:${EXTERNAL_INCLUDE_DIR}>
+    )
+
+    bde_struct_get_field(component ${installOpts} COMPONENT)
+    bde_struct_get_field(includeInstallDir ${installOpts} INCLUDE_DIR)
+    install(
+        FILES ${headers}
+        COMPONENT "${component}-headers"
+        DESTINATION "${includeInstallDir}/${TARGET}"
+    )
+
+    target_include_directories(
+        ${TARGET}
+        PUBLIC
+            $<INSTALL_INTERFACE:${includeInstallDir}>
+    )
+
+    # Don't create interfaces to only use our own build/usage reqiurements
+    bde_struct_create(
+        uor
+        BDE_UOR_TYPE
+        NAME "${TARGET}"
+        TARGET "${TARGET}"
+    )
+    standalone_package_install(${uor} ${listFile} ${installOpts})
+
+    # Meta data install
+    install(
+        DIRECTORY ${listDir}
+        COMPONENT "${component}-meta"
+        DESTINATION "share/bdemeta/thirdparty/${component}"
+        EXCLUDE_FROM_ALL
+    )
+
+    bde_return(${uor})
+endfunction()